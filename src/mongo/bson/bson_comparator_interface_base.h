@@ -253,6 +253,10 @@ protected:
         return FlatSet(elements.begin(), elements.end(), LessThan(this));
     }
 
+    FlatSet makeFlatSet(std::initializer_list<T> init = {}) const {
+        return FlatSet(init.begin(), init.end(), LessThan(this));
+    }
+
     template <typename InputIterator>
     FlatSet makeFlatSetFromSortedUnique(InputIterator begin, InputIterator end) const {
         dassert(std::is_sorted(begin, end, LessThan(this)));
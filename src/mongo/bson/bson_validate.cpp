@@ -34,12 +34,17 @@
 #include <limits>
 #include <vector>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
 #include "mongo/base/data_view.h"
 #include "mongo/bson/bson_depth.h"
 #include "mongo/bson/bson_validate.h"
 #include "mongo/bson/oid.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/server_parameters.h"
+#include "mongo/platform/bits.h"
 #include "mongo/platform/decimal128.h"
 
 namespace mongo {
@@ -417,8 +422,242 @@ Status validateBSONIterative(Buffer* buffer) {
     return Status::OK();
 }
 
+/**
+ * Returns a pointer to the first NUL byte in [p, end), or nullptr if there is none. SSE2 is
+ * baseline on x86_64, so the vector path needs no runtime dispatch there; other platforms fall
+ * back to memchr. For the short field names that dominate element headers this avoids the libc
+ * call overhead entirely.
+ */
+inline const char* scanToNul(const char* p, const char* end) {
+#if defined(__x86_64__) || defined(_M_X64)
+    const __m128i zero = _mm_setzero_si128();
+    while (end - p >= 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, zero));
+        if (mask) {
+            return p + countTrailingZeros64(mask);
+        }
+        p += 16;
+    }
+    while (p != end) {
+        if (*p == '\0') {
+            return p;
+        }
+        ++p;
+    }
+    return nullptr;
+#else
+    return static_cast<const char*>(memchr(p, 0, end - p));
+#endif
+}
+
+enum class StructuralResult {
+    kValid,
+    kInvalid,
+    // The buffer contains a construct (CodeWScope) the structural pass does not handle; the
+    // caller must re-validate with the full validator.
+    kFallback,
+};
+
+/**
+ * Single forward pass that validates the structure of the BSON in [data, data + maxLength)
+ * without materializing elements or tracking _id. Frames hold the expected one-past-the-end
+ * pointer of each open object so size mismatches surface as soon as the object closes.
+ */
+StructuralResult validateStructurally(const char* data, uint64_t maxLength) {
+    const char* pos = data;
+    const char* const bufEnd = data + maxLength;
+
+    std::vector<const char*> frames;
+    frames.reserve(16);
+
+    // Opens the object whose size header begins at 'pos', pushing its expected end.
+    const auto openObject = [&]() -> bool {
+        if (bufEnd - pos < 5) {
+            return false;
+        }
+        const int32_t size = ConstDataView(pos).read<LittleEndian<int32_t>>();
+        if (size < 5 || size > bufEnd - pos) {
+            return false;
+        }
+        if (frames.size() > BSONDepth::getMaxAllowableDepth()) {
+            return false;
+        }
+        frames.push_back(pos + size);
+        pos += sizeof(int32_t);
+        return true;
+    };
+
+    if (!openObject()) {
+        return StructuralResult::kInvalid;
+    }
+
+    while (!frames.empty()) {
+        const char* const objEnd = frames.back();
+        if (pos >= objEnd) {
+            return StructuralResult::kInvalid;
+        }
+        const signed char type = *pos++;
+        if (type == EOO) {
+            if (pos != objEnd) {
+                return StructuralResult::kInvalid;
+            }
+            frames.pop_back();
+            continue;
+        }
+
+        const char* nameEnd = scanToNul(pos, objEnd);
+        if (!nameEnd) {
+            return StructuralResult::kInvalid;
+        }
+        pos = nameEnd + 1;
+
+        // Skips a size-prefixed, NUL-terminated string (String/Code/Symbol payload).
+        const auto skipString = [&]() -> bool {
+            if (objEnd - pos < 4) {
+                return false;
+            }
+            const int32_t sz = ConstDataView(pos).read<LittleEndian<int32_t>>();
+            if (sz < 1 || sz > objEnd - pos - 4) {
+                return false;
+            }
+            if (pos[4 + sz - 1] != '\0') {
+                return false;
+            }
+            pos += 4 + sz;
+            return true;
+        };
+
+        switch (type) {
+            case MinKey:
+            case MaxKey:
+            case jstNULL:
+            case Undefined:
+                break;
+
+            case jstOID:
+                if (objEnd - pos < OID::kOIDSize) {
+                    return StructuralResult::kInvalid;
+                }
+                pos += OID::kOIDSize;
+                break;
+
+            case NumberInt:
+                if (objEnd - pos < static_cast<int>(sizeof(int32_t))) {
+                    return StructuralResult::kInvalid;
+                }
+                pos += sizeof(int32_t);
+                break;
+
+            case Bool:
+                if (pos == objEnd || (*pos != 0 && *pos != 1)) {
+                    return StructuralResult::kInvalid;
+                }
+                ++pos;
+                break;
+
+            case NumberDouble:
+            case NumberLong:
+            case bsonTimestamp:
+            case Date:
+                if (objEnd - pos < static_cast<int>(sizeof(int64_t))) {
+                    return StructuralResult::kInvalid;
+                }
+                pos += sizeof(int64_t);
+                break;
+
+            case NumberDecimal:
+                if (objEnd - pos < static_cast<int>(sizeof(Decimal128::Value))) {
+                    return StructuralResult::kInvalid;
+                }
+                pos += sizeof(Decimal128::Value);
+                break;
+
+            case DBRef:
+                if (!skipString()) {
+                    return StructuralResult::kInvalid;
+                }
+                if (objEnd - pos < OID::kOIDSize) {
+                    return StructuralResult::kInvalid;
+                }
+                pos += OID::kOIDSize;
+                break;
+
+            case RegEx:
+                for (int i = 0; i < 2; ++i) {
+                    const char* strEnd = scanToNul(pos, objEnd);
+                    if (!strEnd) {
+                        return StructuralResult::kInvalid;
+                    }
+                    pos = strEnd + 1;
+                }
+                break;
+
+            case Code:
+            case Symbol:
+            case String:
+                if (!skipString()) {
+                    return StructuralResult::kInvalid;
+                }
+                break;
+
+            case BinData: {
+                if (objEnd - pos < 4) {
+                    return StructuralResult::kInvalid;
+                }
+                const int32_t sz = ConstDataView(pos).read<LittleEndian<int32_t>>();
+                if (sz < 0 || sz == std::numeric_limits<int>::max() || objEnd - pos - 5 < sz) {
+                    return StructuralResult::kInvalid;
+                }
+                pos += 5 + sz;
+                break;
+            }
+
+            case CodeWScope:
+                // Rare enough that keeping its nested bookkeeping out of this loop is a win;
+                // let the full validator handle the whole buffer instead.
+                return StructuralResult::kFallback;
+
+            case Object:
+            case Array:
+                if (!openObject()) {
+                    return StructuralResult::kInvalid;
+                }
+                break;
+
+            default:
+                return StructuralResult::kInvalid;
+        }
+    }
+
+    return StructuralResult::kValid;
+}
+
 }  // namespace
 
+Status validateBSON(const char* originalBuffer, uint64_t maxLength) {
+    if (maxLength < 5) {
+        return Status(ErrorCodes::InvalidBSON, "bson data has to be at least 5 bytes");
+    }
+
+    switch (validateStructurally(originalBuffer, maxLength)) {
+        case StructuralResult::kValid:
+            return Status::OK();
+        case StructuralResult::kFallback:
+            return validateBSON(originalBuffer, maxLength, BSONVersion::kLatest);
+        case StructuralResult::kInvalid: {
+            // Rescan with the full validator to produce an error message that names the offending
+            // element and the document's _id.
+            Status status = validateBSON(originalBuffer, maxLength, BSONVersion::kLatest);
+            if (!status.isOK()) {
+                return status;
+            }
+            return Status(ErrorCodes::InvalidBSON, "structurally invalid bson");
+        }
+    }
+    MONGO_UNREACHABLE;
+}
+
 Status validateBSON(const char* originalBuffer, uint64_t maxLength, BSONVersion version) {
     if (maxLength < 5) {
         return Status(ErrorCodes::InvalidBSON, "bson data has to be at least 5 bytes");
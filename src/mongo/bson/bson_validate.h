@@ -49,4 +49,14 @@ class Status;
  */
 Status validateBSON(const char* buf, uint64_t maxLength, BSONVersion version);
 
+/**
+ * Structure-only validation against the latest BSON version. This is a single forward pass over
+ * the buffer that scans field names and string payloads with vectorized kernels where the
+ * platform supports them, and does not track the document's _id while scanning. On malformed
+ * input it re-runs the full validator above so callers still get a detailed error that names the
+ * offending element and _id. Intended for hot ingest paths (e.g. OP_MSG parsing) that validate
+ * every document off the wire.
+ */
+Status validateBSON(const char* buf, uint64_t maxLength);
+
 }  // namespace mongo
@@ -336,6 +336,57 @@ TEST(BSONValidateFast, StringHasSomething) {
     ASSERT_NOT_OK(validateBSON(x.objdata(), x.objsize(), BSONVersion::kLatest));
 }
 
+TEST(BSONValidateStructural, AgreesWithFullValidatorOnValidObjects) {
+    const BSONObj objs[] = {
+        BSONObj(),
+        BSON("foo" << 17 << "bar"
+                   << "eliot"),
+        BSON("a" << 1 << "b" << BSON("c" << 2 << "d" << BSONArrayBuilder().obj() << "e"
+                                         << BSON_ARRAY("1" << 2 << 3))),
+        BSON("r" << BSONRegEx("abc.*", "i") << "bin" << BSONBinData("xyz", 3, BinDataGeneral)
+                 << "ts"
+                 << Timestamp(1, 2)
+                 << "d"
+                 << 3.14),
+        BSON("code" << BSONCodeWScope("x = 1", BSON("x" << 0))),
+    };
+    for (const auto& obj : objs) {
+        ASSERT_OK(validateBSON(obj.objdata(), obj.objsize()));
+        ASSERT_OK(validateBSON(obj.objdata(), obj.objsize(), BSONVersion::kLatest));
+    }
+}
+
+TEST(BSONValidateStructural, LongFieldNamesScanCorrectly) {
+    // Field names longer than one vector width exercise the chunked NUL scan.
+    BSONObjBuilder b;
+    b.append(std::string(100, 'x'), 1);
+    b.append(std::string(15, 'y'), 2);
+    b.append(std::string(16, 'z'), 3);
+    const BSONObj x = b.obj();
+    ASSERT_OK(validateBSON(x.objdata(), x.objsize()));
+}
+
+TEST(BSONValidateStructural, DetailedErrorOnInvalidObject) {
+    BufBuilder bb;
+    BSONObjBuilder ob(bb);
+    ob.append("_id", 1);
+    appendInvalidStringElement("not_id", &bb);
+    const BSONObj x = ob.done();
+    const Status status = validateBSON(x.objdata(), x.objsize());
+    ASSERT_NOT_OK(status);
+    ASSERT_EQUALS(
+        status.reason(),
+        "not null terminated string in element with field name 'not_id' in object with _id: 1");
+}
+
+TEST(BSONValidateStructural, TruncatedBufferIsRejected) {
+    const BSONObj x = BSON("a" << 1 << "b" << BSON("c" << 2));
+    for (int len = 1; len < x.objsize(); ++len) {
+        ASSERT_NOT_OK(validateBSON(x.objdata(), len));
+    }
+    ASSERT_OK(validateBSON(x.objdata(), x.objsize()));
+}
+
 TEST(BSONValidateBool, BoolValuesAreValidated) {
     BSONObjBuilder bob;
     bob.append("x", false);
@@ -62,6 +62,19 @@ public:
         return makeSet(init);
     }
 
+    /**
+     * Constructs a BSONObjFlatSet whose equivalence classes are given by this comparator. This
+     * comparator must outlive the returned set.
+     *
+     * Unlike a BSONObjSet, the elements are kept in a single sorted, contiguous buffer rather
+     * than one heap node per element, and clear() retains the buffer's capacity. Prefer this
+     * representation for small sets which are built, iterated and discarded frequently, such as
+     * per-document index key sets.
+     */
+    FlatSet makeBSONObjFlatSet(std::initializer_list<BSONObj> init = {}) const {
+        return makeFlatSet(init);
+    }
+
     /**
      * Constructs a BSONObjUnorderedSet whose equivalence classes are given by this
      * comparator. This comparator must outlive the returned set.
@@ -93,6 +106,8 @@ public:
 
 using BSONObjSet = BSONComparatorInterfaceBase<BSONObj>::Set;
 
+using BSONObjFlatSet = BSONComparatorInterfaceBase<BSONObj>::FlatSet;
+
 using BSONObjUnorderedSet = BSONComparatorInterfaceBase<BSONObj>::UnorderedSet;
 
 template <typename ValueType>
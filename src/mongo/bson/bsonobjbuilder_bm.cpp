@@ -51,4 +51,42 @@ void BM_arrayBuilder(benchmark::State& state) {
 
 BENCHMARK(BM_arrayBuilder)->Ranges({{{1}, {100'000}}});
 
+// Models the builder churn of an update operation: many short-lived builders per op, with each
+// buffer individually malloc'ed and freed.
+void BM_builderChurnHeap(benchmark::State& state) {
+    size_t totalBytes = 0;
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        for (auto j = 0; j < state.range(0); j++) {
+            BufBuilder builder(64);
+            builder.appendNum(j);
+            builder.appendStr("some moderately sized update payload");
+            totalBytes += builder.len();
+            benchmark::DoNotOptimize(builder.buf());
+        }
+    }
+    state.SetBytesProcessed(totalBytes);
+}
+
+// Same workload with all builders drawing from one arena that is reset per "operation".
+void BM_builderChurnArena(benchmark::State& state) {
+    size_t totalBytes = 0;
+    BufBuilderArena arena;
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        for (auto j = 0; j < state.range(0); j++) {
+            ArenaBufBuilder builder(&arena, 64);
+            builder.appendNum(j);
+            builder.appendStr("some moderately sized update payload");
+            totalBytes += builder.len();
+            benchmark::DoNotOptimize(builder.buf());
+        }
+        arena.reset();
+    }
+    state.SetBytesProcessed(totalBytes);
+}
+
+BENCHMARK(BM_builderChurnHeap)->Ranges({{{1}, {1'000}}});
+BENCHMARK(BM_builderChurnArena)->Ranges({{{1}, {1'000}}});
+
 }  // namespace mongo
@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cfloat>
 #include <cinttypes>
 #include <cstdint>
@@ -39,6 +40,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <string>
+#include <vector>
 
 #include <boost/optional.hpp>
 
@@ -155,6 +157,145 @@ private:
     void* _ptr = _buf;
 };
 
+/**
+ * A bump allocator backing one or more ArenaBufBuilders. Allocations are carved out of
+ * malloc'ed chunks and individual frees are no-ops; all memory is reclaimed at once by reset()
+ * or destruction. This suits per-operation scratch builders that are discarded together, such
+ * as the intermediate objects materialized while applying an update.
+ */
+class BufBuilderArena {
+    MONGO_DISALLOW_COPYING(BufBuilderArena);
+
+public:
+    enum { kDefaultChunkSize = 64 * 1024 };
+
+    explicit BufBuilderArena(size_t chunkSize = kDefaultChunkSize) : _chunkSize(chunkSize) {}
+
+    ~BufBuilderArena() {
+        for (auto&& chunk : _chunks)
+            ::free(chunk.begin);
+    }
+
+    void* allocate(size_t sz) {
+        sz = _aligned(sz);
+        if (_chunks.empty() || _chunks.back().remaining() < sz)
+            _addChunk(sz);
+        auto& chunk = _chunks.back();
+        void* result = chunk.next;
+        chunk.next += sz;
+        return result;
+    }
+
+    /**
+     * Attempts to extend the allocation at 'ptr' from 'oldSz' to 'newSz' bytes without moving
+     * it. Only possible when it was the most recent allocation out of the current chunk.
+     */
+    bool growInPlace(void* ptr, size_t oldSz, size_t newSz) {
+        if (_chunks.empty())
+            return false;
+        auto& chunk = _chunks.back();
+        char* p = static_cast<char*>(ptr);
+        if (p + _aligned(oldSz) != chunk.next || newSz > oldSz + chunk.remaining())
+            return false;
+        chunk.next = p + _aligned(newSz);
+        return true;
+    }
+
+    /**
+     * Rewinds the arena, invalidating everything allocated from it. The largest chunk is kept
+     * so a steady-state operation stops allocating from the system entirely.
+     */
+    void reset() {
+        if (_chunks.empty())
+            return;
+        auto largest = std::max_element(
+            _chunks.begin(), _chunks.end(), [](const Chunk& a, const Chunk& b) {
+                return a.size < b.size;
+            });
+        Chunk keep = *largest;
+        _chunks.erase(largest);
+        for (auto&& chunk : _chunks)
+            ::free(chunk.begin);
+        _chunks.clear();
+        keep.next = keep.begin;
+        _chunks.push_back(keep);
+    }
+
+private:
+    struct Chunk {
+        char* begin;
+        char* next;
+        size_t size;
+
+        size_t remaining() const {
+            return size - (next - begin);
+        }
+    };
+
+    static size_t _aligned(size_t sz) {
+        return (sz + 7) & ~size_t(7);
+    }
+
+    void _addChunk(size_t minSize) {
+        const size_t sz = std::max(_chunkSize, _aligned(minSize));
+        char* mem = static_cast<char*>(mongoMalloc(sz));
+        _chunks.push_back({mem, mem, sz});
+    }
+
+    std::vector<Chunk> _chunks;
+    size_t _chunkSize;
+};
+
+/**
+ * Satisfies the _BufBuilder allocator contract with memory drawn from a BufBuilderArena.
+ * free() is a no-op; the builder's memory lives until the arena is reset or destroyed, so the
+ * built object may safely outlive the builder (but not the arena).
+ */
+class ArenaAllocator {
+    MONGO_DISALLOW_COPYING(ArenaAllocator);
+
+public:
+    explicit ArenaAllocator(BufBuilderArena* arena) : _arena(arena) {}
+
+    ArenaAllocator(ArenaAllocator&&) = default;
+    ArenaAllocator& operator=(ArenaAllocator&&) = default;
+
+    void malloc(size_t sz) {
+        _ptr = _arena->allocate(sz);
+        _size = sz;
+    }
+
+    void realloc(size_t sz) {
+        if (_ptr && _arena->growInPlace(_ptr, _size, sz)) {
+            _size = sz;
+            return;
+        }
+        void* next = _arena->allocate(sz);
+        if (_ptr)
+            memcpy(next, _ptr, std::min(_size, sz));
+        _ptr = next;
+        _size = sz;
+    }
+
+    void free() {
+        // The arena reclaims this memory wholesale on reset().
+        _ptr = nullptr;
+        _size = 0;
+    }
+
+    // Not supported on this allocator.
+    void release() = delete;
+
+    char* get() const {
+        return static_cast<char*>(_ptr);
+    }
+
+private:
+    BufBuilderArena* _arena;
+    void* _ptr = nullptr;
+    size_t _size = 0;
+};
+
 template <class BufferAllocator>
 class _BufBuilder {
 public:
@@ -166,6 +307,18 @@ public:
         reservedBytes = 0;
     }
 
+    /** Forwards 'allocatorArgs' to the allocator's constructor, for allocators that are not
+        default constructible (e.g. ArenaAllocator). */
+    template <typename Arg0, typename... Args>
+    explicit _BufBuilder(int initsize, Arg0&& arg0, Args&&... allocatorArgs)
+        : _buf(std::forward<Arg0>(arg0), std::forward<Args>(allocatorArgs)...), size(initsize) {
+        if (size > 0) {
+            _buf.malloc(size);
+        }
+        l = 0;
+        reservedBytes = 0;
+    }
+
     void kill() {
         _buf.free();
     }
@@ -382,6 +535,19 @@ public:
 };
 MONGO_STATIC_ASSERT(!std::is_move_constructible<StackBufBuilder>::value);
 
+/** An ArenaBufBuilder grows in memory owned by a BufBuilderArena, so a chain of builders
+      created and dropped while servicing one operation performs no individual frees; the
+      whole arena is reset when the operation finishes. The built data stays valid after the
+      builder is destroyed, until the arena is reset. As with StackBufBuilder, release() is
+      not available since the buffer cannot be handed off.
+*/
+class ArenaBufBuilder : public _BufBuilder<ArenaAllocator> {
+public:
+    explicit ArenaBufBuilder(BufBuilderArena* arena, int initsize = 512)
+        : _BufBuilder<ArenaAllocator>(initsize, arena) {}
+    void release() = delete;  // not allowed. not implemented.
+};
+
 /** std::stringstream deals with locale so this is a lot faster than std::stringstream for UTF8 */
 template <typename Allocator>
 class StringBuilderImpl {
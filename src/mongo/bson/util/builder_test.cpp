@@ -106,6 +106,50 @@ void testStringBuilderIntegral() {
     }
 }
 
+TEST(Builder, ArenaBufBuilderBasic) {
+    BufBuilderArena arena;
+    ArenaBufBuilder bb(&arena);
+    bb.appendStr("eliot");
+    ASSERT_EQUALS(0, strcmp(bb.buf(), "eliot"));
+}
+
+TEST(Builder, ArenaBufBuilderGrowsAcrossChunks) {
+    // A tiny chunk size forces growth to relocate into fresh chunks.
+    BufBuilderArena arena(32);
+    ArenaBufBuilder bb(&arena, 16);
+    std::string payload;
+    for (int i = 0; i < 100; ++i) {
+        payload += "0123456789";
+        bb.appendStr(payload.c_str(), /*includeEndingNull*/ false);
+    }
+    // Verify the accumulated contents survived every relocation.
+    std::string expected;
+    std::string chunk;
+    for (int i = 0; i < 100; ++i) {
+        chunk += "0123456789";
+        expected += chunk;
+    }
+    ASSERT_EQUALS(expected.size(), static_cast<size_t>(bb.len()));
+    ASSERT_EQUALS(0, memcmp(bb.buf(), expected.c_str(), expected.size()));
+}
+
+TEST(Builder, ArenaDataOutlivesBuilderUntilReset) {
+    BufBuilderArena arena;
+    const char* data;
+    {
+        ArenaBufBuilder bb(&arena);
+        bb.appendStr("still here");
+        data = bb.buf();
+    }
+    ASSERT_EQUALS(0, strcmp(data, "still here"));
+
+    arena.reset();
+    ArenaBufBuilder bb(&arena);
+    bb.appendStr("recycled");
+    // The retained chunk is reused from its start after reset().
+    ASSERT_EQUALS(static_cast<const void*>(data), static_cast<const void*>(bb.buf()));
+}
+
 TEST(Builder, AppendInt) {
     testStringBuilderIntegral<int>();
 }
@@ -47,6 +47,7 @@
 #include "mongo/client/sasl_client_authenticate.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/stdx/utility.h"
+#include "mongo/util/dns_cache.h"
 #include "mongo/util/dns_name.h"
 #include "mongo/util/dns_query.h"
 #include "mongo/util/hex.h"
@@ -216,7 +217,7 @@ MongoURI::OptionsMap addTXTOptions(std::map<std::string, std::string> options,
     options.insert({"ssl", "true"});
 
     // Get all TXT records and parse them as options, adding them to the options set.
-    auto txtRecords = dns::getTXTRecords(host);
+    auto txtRecords = dns::globalDNSCache().getTXTRecords(host);
     if (txtRecords.empty()) {
         return {std::make_move_iterator(begin(options)), std::make_move_iterator(end(options))};
     }
@@ -410,7 +411,7 @@ MongoURI MongoURI::parseImpl(const std::string& url) {
         const mongo::dns::HostName srvSubdomain("_mongodb._tcp");
 
         const auto srvEntries =
-            dns::lookupSRVRecords(srvSubdomain.resolvedIn(host).canonicalName());
+            dns::globalDNSCache().lookupSRVRecords(srvSubdomain.resolvedIn(host).canonicalName());
 
         auto makeFQDN = [](dns::HostName hostName) {
             hostName.forceQualification();
@@ -1090,10 +1090,19 @@ HostAndPort SetState::getMatchingHost(const ReadPreferenceSetting& criteria) con
         // The difference between these is handled by Node::matches
         case ReadPreference::SecondaryOnly:
         case ReadPreference::Nearest: {
-            stdx::function<bool(const Node&)> matchNode = [](const Node& node) -> bool {
-                return true;
+            // How the staleness of a node is evaluated below. Plain state checked inline rather
+            // than a per-call stdx::function, which would heap-allocate and copy the criteria on
+            // every host selection.
+            enum class StalenessCheck {
+                kMatchAll,         // no maxStalenessSeconds in the criteria
+                kMatchNone,        // maxStalenessSeconds set but no node can satisfy it
+                kFromLatestWrite,  // no usable primary; compare against the freshest secondary
+                kFromPrimary,      // compare against the primary's staleness
             };
-            // build comparator
+            auto stalenessCheck = StalenessCheck::kMatchAll;
+            Date_t maxWriteTime;
+            Seconds primaryStaleness;
+
             if (criteria.maxStalenessSeconds.count()) {
                 auto masterIt = std::find_if(nodes.begin(), nodes.end(), isMaster);
                 if (masterIt == nodes.end() || !masterIt->lastWriteDate.toMillisSinceEpoch()) {
@@ -1102,6 +1111,7 @@ HostAndPort SetState::getMatchingHost(const ReadPreferenceSetting& criteria) con
                     };
                     // use only non failed nodes
                     std::vector<const Node*> upNodes;
+                    upNodes.reserve(nodes.size());
                     for (auto nodeIt = nodes.begin(); nodeIt != nodes.end(); ++nodeIt) {
                         if (nodeIt->isUp && nodeIt->lastWriteDate.toMillisSinceEpoch()) {
                             upNodes.push_back(&(*nodeIt));
@@ -1110,32 +1120,47 @@ HostAndPort SetState::getMatchingHost(const ReadPreferenceSetting& criteria) con
                     auto latestSecNode =
                         std::max_element(upNodes.begin(), upNodes.end(), writeDateCmp);
                     if (latestSecNode == upNodes.end()) {
-                        matchNode = [](const Node& node) -> bool { return false; };
+                        stalenessCheck = StalenessCheck::kMatchNone;
                     } else {
-                        Date_t maxWriteTime = (*latestSecNode)->lastWriteDate;
-                        matchNode = [=](const Node& node) -> bool {
-                            return duration_cast<Seconds>(maxWriteTime - node.lastWriteDate) +
-                                refreshPeriod <=
-                                criteria.maxStalenessSeconds;
-                        };
+                        stalenessCheck = StalenessCheck::kFromLatestWrite;
+                        maxWriteTime = (*latestSecNode)->lastWriteDate;
                     }
                 } else {
-                    Seconds primaryStaleness = duration_cast<Seconds>(
-                        masterIt->lastWriteDateUpdateTime - masterIt->lastWriteDate);
-                    matchNode = [=](const Node& node) -> bool {
+                    stalenessCheck = StalenessCheck::kFromPrimary;
+                    primaryStaleness = duration_cast<Seconds>(masterIt->lastWriteDateUpdateTime -
+                                                              masterIt->lastWriteDate);
+                }
+            }
+
+            auto matchNode = [&](const Node& node) -> bool {
+                switch (stalenessCheck) {
+                    case StalenessCheck::kMatchAll:
+                        return true;
+                    case StalenessCheck::kMatchNone:
+                        return false;
+                    case StalenessCheck::kFromLatestWrite:
+                        return duration_cast<Seconds>(maxWriteTime - node.lastWriteDate) +
+                            refreshPeriod <=
+                            criteria.maxStalenessSeconds;
+                    case StalenessCheck::kFromPrimary:
                         return duration_cast<Seconds>(node.lastWriteDateUpdateTime -
                                                       node.lastWriteDate) -
                             primaryStaleness + refreshPeriod <=
                             criteria.maxStalenessSeconds;
-                    };
                 }
-            }
+                MONGO_UNREACHABLE;
+            };
+
+            // Reused across tags so we allocate the backing storage at most once per call rather
+            // than once per tag. This is called under the set's mutex on every host selection.
+            std::vector<const Node*> matchingNodes;
+            matchingNodes.reserve(nodes.size());
 
             BSONForEach(tagElem, criteria.tags.getTagBSON()) {
                 uassert(16358, "Tags should be a BSON object", tagElem.isABSONObj());
                 BSONObj tag = tagElem.Obj();
 
-                std::vector<const Node*> matchingNodes;
+                matchingNodes.clear();
                 for (size_t i = 0; i < nodes.size(); i++) {
                     if (nodes[i].matches(criteria.pref) && nodes[i].matches(tag) &&
                         matchNode(nodes[i])) {
@@ -62,18 +62,27 @@ std::string CompactOptions::toString() const {
 //
 
 void CappedInsertNotifier::notifyAll() {
+    _version.fetchAndAdd(1);
+    if (_waiters.load() == 0) {
+        // Nobody is parked on the condition variable. Any thread about to wait will observe the
+        // version bump above once it acquires '_mutex', so skipping the lock and broadcast here
+        // is safe and keeps waiter-free capped inserts (notably every oplog write) off the
+        // notifier mutex.
+        return;
+    }
     stdx::lock_guard<stdx::mutex> lk(_mutex);
-    ++_version;
     _notifier.notify_all();
 }
 
 void CappedInsertNotifier::waitUntil(uint64_t prevVersion, Date_t deadline) const {
     stdx::unique_lock<stdx::mutex> lk(_mutex);
-    while (!_dead && prevVersion == _version) {
+    _waiters.fetchAndAdd(1);
+    while (!_dead && prevVersion == _version.load()) {
         if (stdx::cv_status::timeout == _notifier.wait_until(lk, deadline.toSystemTimePoint())) {
-            return;
+            break;
         }
     }
+    _waiters.fetchAndSubtract(1);
 }
 
 void CappedInsertNotifier::kill() {
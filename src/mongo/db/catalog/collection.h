@@ -52,6 +52,7 @@
 #include "mongo/db/storage/capped_callback.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/snapshot.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/functional.h"
 #include "mongo/stdx/mutex.h"
@@ -61,6 +62,7 @@ class CappedCallback;
 class CollectionCatalogEntry;
 class DatabaseCatalogEntry;
 class ExtentManager;
+class FieldRefSet;
 class IndexCatalog;
 class IndexCatalogEntry;
 class IndexDescriptor;
@@ -96,6 +98,11 @@ struct CollectionUpdateArgs {
     bool fromMigrate = false;
 
     StoreDocOption storeDocOption = StoreDocOption::None;
+
+    // The set of paths modified by the update, used to skip maintenance of indexes which the
+    // update cannot affect. Null when the modified paths are unknown (e.g. a replacement update),
+    // in which case all indexes are maintained. Not owned here; must outlive the update call.
+    const FieldRefSet* modifiedPaths = nullptr;
 };
 
 /**
@@ -121,7 +128,7 @@ public:
      * Returns the version for use as an additional wake condition when used above.
      */
     uint64_t getVersion() const {
-        return _version;
+        return _version.load();
     }
 
     /**
@@ -138,14 +145,20 @@ private:
     // Signalled when a successful insert is made into a capped collection.
     mutable stdx::condition_variable _notifier;
 
-    // Mutex used with '_notifier'. Protects access to '_version'.
+    // Mutex used with '_notifier'. Protects access to '_dead' and serializes waiters against
+    // notifications.
     mutable stdx::mutex _mutex;
 
     // A counter, incremented on insertion of new data into the capped collection.
     //
     // The condition which '_cappedNewDataNotifier' is being notified of is an increment of this
-    // counter. Access to this counter is synchronized with '_mutex'.
-    uint64_t _version = 0;
+    // counter.
+    AtomicWord<uint64_t> _version{0};
+
+    // Number of threads blocked in waitUntil(). Incremented under '_mutex' before a waiter first
+    // checks '_version', so notifyAll() can skip taking '_mutex' and broadcasting when this is
+    // zero without the waiter missing the version bump.
+    mutable AtomicWord<uint32_t> _waiters{0};
 
     // True once the notifier is dead.
     bool _dead = false;
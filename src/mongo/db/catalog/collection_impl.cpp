@@ -402,6 +402,8 @@ Status CollectionImpl::insertDocuments(OperationContext* opCtx,
 
     const SnapshotId sid = opCtx->recoveryUnit()->getSnapshotId();
 
+    _infoCache->notifyOfWriteOp();
+
     status = _insertDocuments(opCtx, begin, end, opDebug);
     if (!status.isOK()) {
         return status;
@@ -461,6 +463,8 @@ Status CollectionImpl::insertDocumentForBulkLoader(OperationContext* opCtx,
 
     dassert(opCtx->lockState()->isCollectionLockedForMode(ns().toString(), MODE_IX));
 
+    _infoCache->notifyOfWriteOp();
+
     // TODO SERVER-30638: using timestamp 0 for these inserts, which are non-oplog so we don't yet
     // care about their correct timestamps.
     StatusWith<RecordId> loc =
@@ -567,6 +571,8 @@ void CollectionImpl::notifyCappedWaitersIfNeeded() {
 Status CollectionImpl::aboutToDeleteCapped(OperationContext* opCtx,
                                            const RecordId& loc,
                                            RecordData data) {
+    _infoCache->notifyOfWriteOp();
+
     BSONObj doc = data.releaseToBson();
     int64_t* const nullKeysDeleted = nullptr;
     _indexCatalog->unindexRecord(opCtx, doc, loc, false, nullKeysDeleted);
@@ -601,6 +607,8 @@ void CollectionImpl::deleteDocument(OperationContext* opCtx,
         deletedDoc.emplace(doc.value().getOwned());
     }
 
+    _infoCache->notifyOfWriteOp();
+
     int64_t keysDeleted;
     _indexCatalog->unindexRecord(opCtx, doc.value(), loc, noWarn, &keysDeleted);
     _recordStore->deleteRecord(opCtx, loc);
@@ -674,14 +682,21 @@ RecordId CollectionImpl::updateDocument(OperationContext* opCtx,
 
     args->preImageDoc = oldDoc.value().getOwned();
 
+    _infoCache->notifyOfWriteOp();
+
     Status updateStatus =
         _recordStore->updateRecord(opCtx, oldLocation, newDoc.objdata(), newDoc.objsize());
 
     if (indexesAffected) {
         int64_t keysInserted, keysDeleted;
 
-        uassertStatusOK(_indexCatalog->updateRecord(
-            opCtx, args->preImageDoc.get(), newDoc, oldLocation, &keysInserted, &keysDeleted));
+        uassertStatusOK(_indexCatalog->updateRecord(opCtx,
+                                                    args->preImageDoc.get(),
+                                                    newDoc,
+                                                    oldLocation,
+                                                    args->modifiedPaths,
+                                                    &keysInserted,
+                                                    &keysDeleted));
 
         if (opDebug) {
             opDebug->additiveMetrics.incrementKeysInserted(keysInserted);
@@ -717,6 +732,8 @@ StatusWith<RecordData> CollectionImpl::updateDocumentWithDamages(
     invariant(oldRec.snapshotId() == opCtx->recoveryUnit()->getSnapshotId());
     invariant(updateWithDamagesSupported());
 
+    _infoCache->notifyOfWriteOp();
+
     auto newRecStatus =
         _recordStore->updateWithDamages(opCtx, loc, oldRec.value(), damageSource, damages);
 
@@ -800,6 +817,7 @@ Status CollectionImpl::truncate(OperationContext* opCtx) {
     // 2) drop indexes
     _indexCatalog->dropAllIndexes(opCtx, true);
     _cursorManager->invalidateAll(opCtx, false, "collection truncated");
+    _infoCache->notifyOfWriteOp();
 
     // 3) truncate record store
     auto status = _recordStore->truncate(opCtx);
@@ -823,6 +841,7 @@ void CollectionImpl::cappedTruncateAfter(OperationContext* opCtx, RecordId end,
     invariant(_indexCatalog->numIndexesInProgress(opCtx) == 0);
 
     _cursorManager->invalidateAll(opCtx, false, "capped collection truncated");
+    _infoCache->notifyOfWriteOp();
     _recordStore->cappedTruncateAfter(opCtx, end, inclusive);
 }
 
@@ -1228,7 +1247,7 @@ Status CollectionImpl::validate(OperationContext* opCtx,
         IndexConsistency indexConsistency(
             opCtx, this, ns(), _recordStore, std::move(collLk), background);
         RecordStoreValidateAdaptor indexValidator = RecordStoreValidateAdaptor(
-            opCtx, &indexConsistency, level, _indexCatalog.get(), &indexNsResultsMap);
+            opCtx, &indexConsistency, level, background, _indexCatalog.get(), &indexNsResultsMap);
 
         // Validate the record store
         std::string uuidString = str::stream()
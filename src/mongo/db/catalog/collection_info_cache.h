@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "mongo/db/catalog/point_read_cache.h"
 #include "mongo/db/collection_index_usage_tracker.h"
 #include "mongo/db/query/plan_cache.h"
 #include "mongo/db/query/query_settings.h"
@@ -63,6 +64,11 @@ public:
      */
     virtual QuerySettings* getQuerySettings() const = 0;
 
+    /**
+     * Get the PointReadCache for this collection.
+     */
+    virtual PointReadCache* getPointReadCache() const = 0;
+
     /* get set of index keys for this namespace.  handy to quickly check if a given
        field is indexed (Note it might be a secondary component of a compound index.)
     */
@@ -105,6 +111,12 @@ public:
     virtual void notifyOfQuery(OperationContext* const opCtx,
                                const std::set<std::string>& indexesUsed) = 0;
 
+    /**
+     * Signal to the cache that a document write is being applied to the collection. Invalidates
+     * any cached point read results.
+     */
+    virtual void notifyOfWriteOp() = 0;
+
     virtual void setNs(NamespaceString ns) = 0;
 };
 }  // namespace mongo
@@ -58,6 +58,7 @@ CollectionInfoCacheImpl::CollectionInfoCacheImpl(Collection* collection, const N
       _keysComputed(false),
       _planCache(stdx::make_unique<PlanCache>(ns.ns())),
       _querySettings(stdx::make_unique<QuerySettings>()),
+      _pointReadCache(stdx::make_unique<PointReadCache>()),
       _indexUsageTracker(getGlobalServiceContext()->getPreciseClockSource()) {}
 
 CollectionInfoCacheImpl::~CollectionInfoCacheImpl() {
@@ -188,6 +189,14 @@ QuerySettings* CollectionInfoCacheImpl::getQuerySettings() const {
     return _querySettings.get();
 }
 
+PointReadCache* CollectionInfoCacheImpl::getPointReadCache() const {
+    return _pointReadCache.get();
+}
+
+void CollectionInfoCacheImpl::notifyOfWriteOp() {
+    _pointReadCache->notifyOfWriteOp();
+}
+
 void CollectionInfoCacheImpl::updatePlanCacheIndexEntries(OperationContext* opCtx) {
     std::vector<CoreIndexInfo> indexCores;
 
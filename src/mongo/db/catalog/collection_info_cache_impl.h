@@ -63,6 +63,11 @@ public:
      */
     QuerySettings* getQuerySettings() const;
 
+    /**
+     * Get the PointReadCache for this collection.
+     */
+    PointReadCache* getPointReadCache() const;
+
     /* get set of index keys for this namespace.  handy to quickly check if a given
        field is indexed (Note it might be a secondary component of a compound index.)
     */
@@ -109,6 +114,12 @@ public:
      */
     void notifyOfQuery(OperationContext* opCtx, const std::set<std::string>& indexesUsed);
 
+    /**
+     * Signal to the cache that a document write is being applied to the collection. Invalidates
+     * any cached point read results.
+     */
+    void notifyOfWriteOp();
+
     void setNs(NamespaceString ns) override;
 
 private:
@@ -136,6 +147,9 @@ private:
     // Includes index filters.
     std::unique_ptr<QuerySettings> _querySettings;
 
+    // A cache for the results of point reads through the _id index.
+    std::unique_ptr<PointReadCache> _pointReadCache;
+
     // Tracks index usage statistics for this collection.
     CollectionIndexUsageTracker _indexUsageTracker;
 
@@ -76,28 +76,41 @@ Database* DatabaseHolderImpl::getDb(OperationContext* opCtx, StringData ns) cons
     const StringData db = _todb(ns);
     invariant(opCtx->lockState()->isDbLockedForMode(db, MODE_IS));
 
-    stdx::lock_guard<SimpleMutex> lk(_m);
-    DBs::const_iterator it = _dbs.find(db);
-    if (it != _dbs.end()) {
+    auto& partition = _partition(db);
+    stdx::lock_guard<SimpleMutex> lk(partition.mutex);
+    DBs::const_iterator it = partition.dbs.find(db);
+    if (it != partition.dbs.end()) {
         return it->second;
     }
 
     return NULL;
 }
 
+std::vector<stdx::unique_lock<SimpleMutex>> DatabaseHolderImpl::_lockAllPartitions() const {
+    std::vector<stdx::unique_lock<SimpleMutex>> locks;
+    locks.reserve(kNumPartitions);
+    for (auto& partition : _partitions) {
+        locks.emplace_back(partition.mutex);
+    }
+    return locks;
+}
+
 std::set<std::string> DatabaseHolderImpl::_getNamesWithConflictingCasing_inlock(StringData name) {
     std::set<std::string> duplicates;
 
-    for (const auto& nameAndPointer : _dbs) {
-        // A name that's equal with case-insensitive match must be identical, or it's a duplicate.
-        if (name.equalCaseInsensitive(nameAndPointer.first) && name != nameAndPointer.first)
-            duplicates.insert(nameAndPointer.first);
+    for (const auto& partition : _partitions) {
+        for (const auto& nameAndPointer : partition.dbs) {
+            // A name that's equal with case-insensitive match must be identical, or it's a
+            // duplicate.
+            if (name.equalCaseInsensitive(nameAndPointer.first) && name != nameAndPointer.first)
+                duplicates.insert(nameAndPointer.first);
+        }
     }
     return duplicates;
 }
 
 std::set<std::string> DatabaseHolderImpl::getNamesWithConflictingCasing(StringData name) {
-    stdx::lock_guard<SimpleMutex> lk(_m);
+    auto allLocks = _lockAllPartitions();
     return _getNamesWithConflictingCasing_inlock(name);
 }
 
@@ -108,36 +121,42 @@ Database* DatabaseHolderImpl::openDb(OperationContext* opCtx, StringData ns, boo
     if (justCreated)
         *justCreated = false;  // Until proven otherwise.
 
-    stdx::unique_lock<SimpleMutex> lk(_m);
-
-    // The following will insert a nullptr for dbname, which will treated the same as a non-
-    // existant database by the get method, yet still counts in getNamesWithConflictingCasing.
-    if (auto db = _dbs[dbname])
-        return db;
+    auto& partition = _partition(dbname);
+
+    {
+        // The placeholder insertion below must be atomic with the case-conflict check, which
+        // reads every partition, so take all the partition locks. Opening a database is rare
+        // enough that this doesn't matter for performance.
+        auto allLocks = _lockAllPartitions();
+
+        // The following will insert a nullptr for dbname, which will treated the same as a non-
+        // existant database by the get method, yet still counts in getNamesWithConflictingCasing.
+        if (auto db = partition.dbs[dbname])
+            return db;
+
+        auto duplicates = _getNamesWithConflictingCasing_inlock(dbname);
+        if (!duplicates.empty()) {
+            // Remove the nullptr placeholder before failing.
+            partition.dbs.erase(dbname);
+            uasserted(ErrorCodes::DatabaseDifferCase,
+                      str::stream() << "db already exists with different case already have: ["
+                                    << *duplicates.cbegin()
+                                    << "] trying to create ["
+                                    << dbname.toString()
+                                    << "]");
+        }
+    }
 
     // We've inserted a nullptr entry for dbname: make sure to remove it on unsuccessful exit.
-    auto removeDbGuard = makeGuard([this, &lk, dbname] {
-        if (!lk.owns_lock())
-            lk.lock();
-        _dbs.erase(dbname);
+    auto removeDbGuard = makeGuard([this, &partition, dbname] {
+        stdx::lock_guard<SimpleMutex> lk(partition.mutex);
+        partition.dbs.erase(dbname);
     });
 
-    // Check casing in lock to avoid transient duplicates.
-    auto duplicates = _getNamesWithConflictingCasing_inlock(dbname);
-    uassert(ErrorCodes::DatabaseDifferCase,
-            str::stream() << "db already exists with different case already have: ["
-                          << *duplicates.cbegin()
-                          << "] trying to create ["
-                          << dbname.toString()
-                          << "]",
-            duplicates.empty());
-
-
     // Do the catalog lookup and database creation outside of the scoped lock, because these may
     // block. Only one thread can be inside this method for the same DB name, because of the
     // requirement for X-lock on the database when we enter. So there is no way we can insert two
     // different databases for the same name.
-    lk.unlock();
     StorageEngine* storageEngine = getGlobalServiceContext()->getStorageEngine();
     DatabaseCatalogEntry* entry = storageEngine->getDatabaseCatalogEntry(opCtx, dbname);
 
@@ -152,9 +171,9 @@ Database* DatabaseHolderImpl::openDb(OperationContext* opCtx, StringData ns, boo
 
     // Finally replace our nullptr entry with the new Database pointer.
     removeDbGuard.dismiss();
-    lk.lock();
-    auto it = _dbs.find(dbname);
-    invariant(it != _dbs.end() && it->second == nullptr);
+    auto allLocks = _lockAllPartitions();
+    auto it = partition.dbs.find(dbname);
+    invariant(it != partition.dbs.end() && it->second == nullptr);
     it->second = newDb.release();
     invariant(_getNamesWithConflictingCasing_inlock(dbname.toString()).empty());
 
@@ -203,10 +222,11 @@ void DatabaseHolderImpl::close(OperationContext* opCtx, StringData ns, const std
 
     const StringData dbName = _todb(ns);
 
-    stdx::lock_guard<SimpleMutex> lk(_m);
+    auto& partition = _partition(dbName);
+    stdx::lock_guard<SimpleMutex> lk(partition.mutex);
 
-    DBs::const_iterator it = _dbs.find(dbName);
-    if (it == _dbs.end()) {
+    DBs::const_iterator it = partition.dbs.find(dbName);
+    if (it == partition.dbs.end()) {
         return;
     }
 
@@ -218,7 +238,7 @@ void DatabaseHolderImpl::close(OperationContext* opCtx, StringData ns, const std
     delete db;
     db = nullptr;
 
-    _dbs.erase(it);
+    partition.dbs.erase(it);
 
     getGlobalServiceContext()
         ->getStorageEngine()
@@ -229,24 +249,28 @@ void DatabaseHolderImpl::close(OperationContext* opCtx, StringData ns, const std
 void DatabaseHolderImpl::closeAll(OperationContext* opCtx, const std::string& reason) {
     invariant(opCtx->lockState()->isW());
 
-    stdx::lock_guard<SimpleMutex> lk(_m);
+    auto allLocks = _lockAllPartitions();
 
+    // Check for background operations on every database before closing any of them.
     std::set<std::string> dbs;
-    for (DBs::const_iterator i = _dbs.begin(); i != _dbs.end(); ++i) {
-        BackgroundOperation::assertNoBgOpInProgForDb(i->first);
-        dbs.insert(i->first);
+    for (auto& partition : _partitions) {
+        for (DBs::const_iterator i = partition.dbs.begin(); i != partition.dbs.end(); ++i) {
+            BackgroundOperation::assertNoBgOpInProgForDb(i->first);
+            dbs.insert(i->first);
+        }
     }
 
     for (const auto& name : dbs) {
         LOG(2) << "DatabaseHolder::closeAll name:" << name;
 
-        Database* db = _dbs[name];
+        auto& partition = _partition(name);
+        Database* db = partition.dbs[name];
         repl::oplogCheckCloseDatabase(opCtx, db);
         evictDatabaseFromUUIDCatalog(opCtx, db);
         db->close(opCtx, reason);
         delete db;
 
-        _dbs.erase(name);
+        partition.dbs.erase(name);
 
         getGlobalServiceContext()
             ->getStorageEngine()
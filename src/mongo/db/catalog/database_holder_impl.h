@@ -30,8 +30,12 @@
 
 #pragma once
 
+#include <array>
+#include <vector>
+
 #include "mongo/db/catalog/database_holder.h"
 
+#include "mongo/stdx/mutex.h"
 #include "mongo/util/concurrency/mutex.h"
 #include "mongo/util/string_map.h"
 
@@ -64,8 +68,25 @@ private:
     std::set<std::string> _getNamesWithConflictingCasing_inlock(StringData name);
 
     typedef StringMap<Database*> DBs;
-    mutable SimpleMutex _m;
-    DBs _dbs;
+
+    // getDb runs for essentially every operation, so the open databases are partitioned by the
+    // hash of the database name, each partition guarded by its own mutex. Operations that need
+    // a consistent view of all open databases (openDb and the case-conflict check) lock every
+    // partition in index order via _lockAllPartitions().
+    static const size_t kNumPartitions = 16;
+
+    struct Partition {
+        mutable SimpleMutex mutex;
+        DBs dbs;
+    };
+
+    Partition& _partition(StringData db) const {
+        return _partitions[StringMapHasher{}(db) % kNumPartitions];
+    }
+
+    std::vector<stdx::unique_lock<SimpleMutex>> _lockAllPartitions() const;
+
+    mutable std::array<Partition, kNumPartitions> _partitions;
 
     // Databases objects and their constituent collections are destroyed and recreated when
     // databases are closed and opened. We use this counter to assign a new epoch to a database when
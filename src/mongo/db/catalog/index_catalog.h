@@ -44,6 +44,7 @@
 namespace mongo {
 class Client;
 class Collection;
+class FieldRefSet;
 
 class IndexDescriptor;
 struct InsertDeleteOptions;
@@ -397,12 +398,18 @@ public:
      * Both 'keysInsertedOut' and 'keysDeletedOut' are required and will be set to the number of
      * index keys inserted and deleted by this operation, respectively.
      *
+     * 'modifiedPaths' optionally contains the set of paths modified by the update. When non-null,
+     * indexes whose indexed paths cannot intersect the modified paths are skipped entirely, since
+     * their keys are unchanged by the update. When null, the modified paths are unknown (e.g. a
+     * replacement update) and all indexes are maintained.
+     *
      * This method may throw.
      */
     virtual Status updateRecord(OperationContext* const opCtx,
                                 const BSONObj& oldDoc,
                                 const BSONObj& newDoc,
                                 const RecordId& recordId,
+                                const FieldRefSet* modifiedPaths,
                                 int64_t* const keysInsertedOut,
                                 int64_t* const keysDeletedOut) = 0;
 
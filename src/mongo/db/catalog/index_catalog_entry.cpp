@@ -89,9 +89,17 @@ std::shared_ptr<IndexCatalogEntry> IndexCatalogEntryContainer::release(
             continue;
         auto e = std::move(*i);
         _entries.erase(i);
+        if (e.get() == _idIndex)
+            _idIndex = nullptr;
         return e;
     }
     return nullptr;
 }
 
+void IndexCatalogEntryContainer::add(std::shared_ptr<IndexCatalogEntry>&& entry) {
+    if (entry->descriptor()->isIdIndex())
+        _idIndex = entry.get();
+    _entries.push_back(std::move(entry));
+}
+
 }  // namespace mongo
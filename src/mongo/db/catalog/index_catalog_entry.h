@@ -54,6 +54,7 @@ class IndexBuildInterceptor;
 class IndexDescriptor;
 class MatchExpression;
 class OperationContext;
+class UpdateIndexData;
 
 class IndexCatalogEntry {
 public:
@@ -85,6 +86,13 @@ public:
 
     virtual const MatchExpression* getFilterExpression() const = 0;
 
+    /**
+     * Returns the set of paths which, if modified by an update, may change this index's keys or
+     * its partial filter eligibility. Updates which modify no path in this set cannot affect this
+     * index.
+     */
+    virtual const UpdateIndexData& getIndexedPaths() const = 0;
+
     virtual const CollatorInterface* getCollator() const = 0;
 
     /// ---------------------
@@ -203,8 +211,14 @@ public:
         return static_cast<bool>(release(desc));
     }
 
-    void add(std::shared_ptr<IndexCatalogEntry>&& entry) {
-        _entries.push_back(std::move(entry));
+    void add(std::shared_ptr<IndexCatalogEntry>&& entry);
+
+    /**
+     * Returns the entry for the _id index, or null if this container does not hold one. The
+     * pointer is maintained by add()/release() so lookups do not scan the entries.
+     */
+    IndexCatalogEntry* idIndex() const {
+        return _idIndex;
     }
 
     std::vector<std::shared_ptr<const IndexCatalogEntry>> getAllEntries() const {
@@ -213,5 +227,6 @@ public:
 
 private:
     std::vector<std::shared_ptr<IndexCatalogEntry>> _entries;
+    IndexCatalogEntry* _idIndex = nullptr;
 };
 }  // namespace mongo
@@ -42,13 +42,17 @@
 #include "mongo/db/catalog/head_manager.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
+#include "mongo/db/fts/fts_spec.h"
 #include "mongo/db/index/index_access_method.h"
 #include "mongo/db/index/index_descriptor.h"
+#include "mongo/db/index/wildcard_access_method.h"
+#include "mongo/db/index_names.h"
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/matcher/expression_parser.h"
 #include "mongo/db/multi_key_path_tracker.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/query/collation/collator_factory_interface.h"
+#include "mongo/db/query/planner_ixselect.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/transaction_participant.h"
 #include "mongo/stdx/memory.h"
@@ -142,6 +146,63 @@ IndexCatalogEntryImpl::~IndexCatalogEntryImpl() {
 void IndexCatalogEntryImpl::init(std::unique_ptr<IndexAccessMethod> accessMethod) {
     invariant(!_accessMethod);
     _accessMethod = std::move(accessMethod);
+    _computeIndexedPaths();
+}
+
+void IndexCatalogEntryImpl::_computeIndexedPaths() {
+    if (_descriptor->getAccessMethodName() == IndexNames::WILDCARD) {
+        // Obtain the projection used by the $** index's key generator.
+        const auto* pathProj =
+            static_cast<const WildcardAccessMethod*>(_accessMethod.get())->getProjectionExec();
+        // If the projection is an exclusion, then we must check the new document's keys on all
+        // updates, since we do not exhaustively know the set of paths to be indexed.
+        if (pathProj->getType() == ProjectionExecAgg::ProjectionType::kExclusionProjection) {
+            _indexedPaths.allPathsIndexed();
+        } else {
+            // If a subtree was specified in the keyPattern, or if an inclusion projection is
+            // present, then we need only index the path(s) preserved by the projection.
+            for (const auto& path : pathProj->getExhaustivePaths()) {
+                _indexedPaths.addPath(path);
+            }
+        }
+    } else if (_descriptor->getAccessMethodName() == IndexNames::TEXT) {
+        fts::FTSSpec ftsSpec(_descriptor->infoObj());
+
+        if (ftsSpec.wildcard()) {
+            _indexedPaths.allPathsIndexed();
+        } else {
+            for (size_t i = 0; i < ftsSpec.numExtraBefore(); ++i) {
+                _indexedPaths.addPath(FieldRef(ftsSpec.extraBefore(i)));
+            }
+            for (fts::Weights::const_iterator it = ftsSpec.weights().begin();
+                 it != ftsSpec.weights().end();
+                 ++it) {
+                _indexedPaths.addPath(FieldRef(it->first));
+            }
+            for (size_t i = 0; i < ftsSpec.numExtraAfter(); ++i) {
+                _indexedPaths.addPath(FieldRef(ftsSpec.extraAfter(i)));
+            }
+            // Any update to a path containing "language" as a component could change the
+            // language of a subdocument.  Add the override field as a path component.
+            _indexedPaths.addPathComponent(ftsSpec.languageOverrideField());
+        }
+    } else {
+        BSONObjIterator it(_descriptor->keyPattern());
+        while (it.more()) {
+            BSONElement elem = it.next();
+            _indexedPaths.addPath(FieldRef(elem.fieldName()));
+        }
+    }
+
+    // An update to a path referenced by a partial filter expression can change whether the
+    // document belongs in the index at all.
+    if (_filterExpression) {
+        stdx::unordered_set<std::string> paths;
+        QueryPlannerIXSelect::getFields(_filterExpression.get(), &paths);
+        for (auto it = paths.begin(); it != paths.end(); ++it) {
+            _indexedPaths.addPath(FieldRef(*it));
+        }
+    }
 }
 
 const RecordId& IndexCatalogEntryImpl::head(OperationContext* opCtx) const {
@@ -168,6 +229,16 @@ bool IndexCatalogEntryImpl::isReady(OperationContext* opCtx) const {
 }
 
 bool IndexCatalogEntryImpl::isMultikey(OperationContext* opCtx) const {
+    if (_isMultikeyCommitted(opCtx)) {
+        return true;
+    }
+
+    // A flip performed by a concurrent operation is respected before that operation commits. This
+    // only makes planning more conservative; if the operation rolls back, the pessimism is undone.
+    return _numUncommittedMultikeyFlips.load() > 0;
+}
+
+bool IndexCatalogEntryImpl::_isMultikeyCommitted(OperationContext* opCtx) const {
     auto ret = _isMultikey.load();
     if (ret) {
         return true;
@@ -197,12 +268,16 @@ bool IndexCatalogEntryImpl::isMultikey(OperationContext* opCtx) const {
 MultikeyPaths IndexCatalogEntryImpl::getMultikeyPaths(OperationContext* opCtx) const {
     stdx::lock_guard<stdx::mutex> lk(_indexMultikeyPathsMutex);
 
+    MultikeyPaths ret = _indexMultikeyPaths;
+    for (const MultikeyPaths& pending : _uncommittedMultikeyPaths) {
+        MultikeyPathTracker::mergeMultikeyPaths(&ret, pending);
+    }
+
     auto txnParticipant = TransactionParticipant::get(opCtx);
     if (!txnParticipant || !txnParticipant->inMultiDocumentTransaction()) {
-        return _indexMultikeyPaths;
+        return ret;
     }
 
-    MultikeyPaths ret = _indexMultikeyPaths;
     for (const MultikeyPathInfo& path : txnParticipant->getUncommittedMultikeyPathInfos()) {
         if (path.nss == NamespaceString(_ns) && path.indexName == _descriptor->indexName()) {
             MultikeyPathTracker::mergeMultikeyPaths(&ret, path.multikeyPaths);
@@ -240,7 +315,7 @@ void IndexCatalogEntryImpl::setHead(OperationContext* opCtx, RecordId newHead) {
 
 void IndexCatalogEntryImpl::setMultikey(OperationContext* opCtx,
                                         const MultikeyPaths& multikeyPaths) {
-    if (!_indexTracksPathLevelMultikeyInfo && isMultikey(opCtx)) {
+    if (!_indexTracksPathLevelMultikeyInfo && _isMultikeyCommitted(opCtx)) {
         // If the index is already set as multikey and we don't have any path-level information to
         // update, then there's nothing more for us to do.
         return;
@@ -301,6 +376,26 @@ void IndexCatalogEntryImpl::setMultikey(OperationContext* opCtx,
         return;
     }
 
+    // Make the flip visible to planning immediately rather than when this transaction commits, so
+    // concurrent readers don't plan around a single-key index that already has array keys pending.
+    // Treating the index as multikey early is always legal; if this transaction rolls back, the
+    // pessimism is simply undone. Durability still comes from the catalog write below committing
+    // with this operation, so concurrent flippers must not skip their own writes based on this
+    // in-memory state (see _isMultikeyCommitted()).
+    _numUncommittedMultikeyFlips.addAndFetch(1);
+    std::list<MultikeyPaths>::iterator pendingPathsIt{};
+    if (_indexTracksPathLevelMultikeyInfo) {
+        stdx::lock_guard<stdx::mutex> lk(_indexMultikeyPathsMutex);
+        pendingPathsIt = _uncommittedMultikeyPaths.insert(_uncommittedMultikeyPaths.end(), paths);
+    }
+    opCtx->recoveryUnit()->onRollback([this, pendingPathsIt] {
+        _numUncommittedMultikeyFlips.subtractAndFetch(1);
+        if (_indexTracksPathLevelMultikeyInfo) {
+            stdx::lock_guard<stdx::mutex> lk(_indexMultikeyPathsMutex);
+            _uncommittedMultikeyPaths.erase(pendingPathsIt);
+        }
+    });
+
     // It's possible that the index type (e.g. ascending/descending index) supports tracking
     // path-level multikey information, but this particular index doesn't.
     // CollectionCatalogEntry::setIndexIsMultikey() requires that we discard the path-level
@@ -312,11 +407,13 @@ void IndexCatalogEntryImpl::setMultikey(OperationContext* opCtx,
     // When the recovery unit commits, update the multikey paths if needed and clear the plan cache
     // if the index metadata has changed.
     opCtx->recoveryUnit()->onCommit(
-        [this, multikeyPaths, indexMetadataHasChanged](boost::optional<Timestamp>) {
+        [this, multikeyPaths, indexMetadataHasChanged, pendingPathsIt](boost::optional<Timestamp>) {
             _isMultikey.store(true);
+            _numUncommittedMultikeyFlips.subtractAndFetch(1);
 
             if (_indexTracksPathLevelMultikeyInfo) {
                 stdx::lock_guard<stdx::mutex> lk(_indexMultikeyPathsMutex);
+                _uncommittedMultikeyPaths.erase(pendingPathsIt);
                 for (size_t i = 0; i < multikeyPaths.size(); ++i) {
                     _indexMultikeyPaths[i].insert(multikeyPaths[i].begin(), multikeyPaths[i].end());
                 }
@@ -31,6 +31,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <list>
 #include <string>
 
 #include "mongo/base/owned_pointer_vector.h"
@@ -41,6 +42,7 @@
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/storage/kv/kv_prefix.h"
+#include "mongo/db/update_index_data.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/mutex.h"
 
@@ -110,6 +112,10 @@ public:
         return _filterExpression.get();
     }
 
+    const UpdateIndexData& getIndexedPaths() const final {
+        return _indexedPaths;
+    }
+
     const CollatorInterface* getCollator() const final {
         return _collator.get();
     }
@@ -188,6 +194,13 @@ private:
     class SetMultikeyChange;
     class SetHeadChange;
 
+    /**
+     * Computes '_indexedPaths' from the descriptor, access method and partial filter expression.
+     * Must be called after '_accessMethod' has been set, since wildcard indexes derive their
+     * indexed paths from the access method's key generation projection.
+     */
+    void _computeIndexedPaths();
+
     bool _catalogIsReady(OperationContext* opCtx) const;
     bool _catalogIsPresent(OperationContext* opCtx) const;
     RecordId _catalogHead(OperationContext* opCtx) const;
@@ -199,6 +212,12 @@ private:
      */
     bool _catalogIsMultikey(OperationContext* opCtx, MultikeyPaths* multikeyPaths) const;
 
+    /**
+     * Returns whether this index is multikey per the committed catalog state or this operation's
+     * own uncommitted writes, ignoring flips still pending in other transactions.
+     */
+    bool _isMultikeyCommitted(OperationContext* opCtx) const;
+
     KVPrefix _catalogGetPrefix(OperationContext* opCtx) const;
 
     // -----
@@ -220,6 +239,10 @@ private:
     std::unique_ptr<CollatorInterface> _collator;
     std::unique_ptr<MatchExpression> _filterExpression;
 
+    // The set of paths which, if modified by an update, may change this index's keys or its
+    // partial filter eligibility. Computed once in init() and immutable thereafter.
+    UpdateIndexData _indexedPaths;
+
     // cached stuff
 
     Ordering _ordering;  // TODO: this might be b-tree specific
@@ -235,6 +258,14 @@ private:
     // stored in the NamespaceDetails or KVCatalog.
     AtomicWord<bool> _isMultikey;
 
+    // Multikey flips performed by transactions that have not yet committed. Planning treats these
+    // as already in effect -- it is always legal, though potentially wasteful, to regard an index
+    // as multikey -- so a flip becomes visible to concurrent readers when the writer performs it
+    // rather than when its transaction commits. The list is guarded by
+    // '_indexMultikeyPathsMutex'; the counter is atomic so isMultikey() can check it cheaply.
+    AtomicWord<int> _numUncommittedMultikeyFlips;
+    std::list<MultikeyPaths> _uncommittedMultikeyPaths;
+
     // Controls concurrent access to '_indexMultikeyPaths'. We acquire this mutex rather than the
     // RESOURCE_METADATA lock as a performance optimization so that it is cheaper to detect whether
     // there is actually any path-level multikey information to update or not.
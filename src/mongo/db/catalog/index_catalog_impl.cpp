@@ -33,6 +33,8 @@
 
 #include "mongo/db/catalog/index_catalog_impl.h"
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "mongo/base/init.h"
@@ -49,6 +51,7 @@
 #include "mongo/db/clientcursor.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/field_ref.h"
+#include "mongo/db/field_ref_set.h"
 #include "mongo/db/index/index_access_method.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/index_legacy.h"
@@ -66,6 +69,7 @@
 #include "mongo/db/server_options.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/storage_engine_init.h"
+#include "mongo/db/update_index_data.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/log.h"
 #include "mongo/util/mongoutils/str.h"
@@ -1013,13 +1017,23 @@ bool IndexCatalogImpl::haveIdIndex(OperationContext* opCtx) const {
 }
 
 const IndexDescriptor* IndexCatalogImpl::findIdIndex(OperationContext* opCtx) const {
-    std::unique_ptr<IndexIterator> ii = getIndexIterator(opCtx, false);
-    while (ii->more()) {
-        const IndexDescriptor* desc = ii->next()->descriptor();
-        if (desc->isIdIndex())
-            return desc;
+    // This is called for every IDHACK plan and every insert, so use the _id index entry the
+    // container tracks instead of allocating an iterator and scanning all ready indexes. The
+    // snapshot visibility check matches the one ReadyIndexesIterator applies.
+    const IndexCatalogEntry* entry = _readyIndexes.idIndex();
+    if (!entry)
+        return nullptr;
+
+    if (auto minSnapshot = entry->getMinimumVisibleSnapshot()) {
+        if (auto mySnapshot = opCtx->recoveryUnit()->getPointInTimeReadTimestamp()) {
+            if (mySnapshot < minSnapshot) {
+                // The index isn't finished in my snapshot.
+                return nullptr;
+            }
+        }
     }
-    return nullptr;
+
+    return entry->descriptor();
 }
 
 const IndexDescriptor* IndexCatalogImpl::findIndexByName(OperationContext* opCtx,
@@ -1177,6 +1191,30 @@ Status IndexCatalogImpl::_indexFilteredRecords(OperationContext* opCtx,
     InsertDeleteOptions options;
     prepareInsertDeleteOptions(opCtx, index->descriptor(), &options);
 
+    // Multi-document batches whose records carry no individual timestamps can be indexed in one
+    // sorted pass per index, which is considerably cheaper than a random-access probe per
+    // document. Batches with timestamps (e.g. oplog application) must keep per-record ordering
+    // so each record's keys are written at its own timestamp.
+    const bool canBatch = bsonRecords.size() > 1 && !index->isBuilding() &&
+        std::all_of(bsonRecords.begin(), bsonRecords.end(), [](const BsonRecord& record) {
+                        return record.ts.isNull();
+                    });
+    if (canBatch) {
+        std::vector<std::pair<const BSONObj*, RecordId>> records;
+        records.reserve(bsonRecords.size());
+        for (const auto& bsonRecord : bsonRecords) {
+            invariant(bsonRecord.id != RecordId());
+            records.emplace_back(bsonRecord.docPtr, bsonRecord.id);
+        }
+
+        InsertResult result;
+        Status status = index->accessMethod()->insertRecords(opCtx, records, options, &result);
+        if (keysInsertedOut) {
+            *keysInsertedOut += result.numInserted;
+        }
+        return status;
+    }
+
     for (auto bsonRecord : bsonRecords) {
         invariant(bsonRecord.id != RecordId());
 
@@ -1298,10 +1336,32 @@ Status IndexCatalogImpl::indexRecords(OperationContext* opCtx,
     return Status::OK();
 }
 
+namespace {
+/**
+ * Returns true if an update which modified only 'modifiedPaths' cannot have changed the keys or
+ * partial filter eligibility of 'entry', meaning index maintenance can be skipped for it. A null
+ * 'modifiedPaths' means the set of modified paths is unknown, so the index must be maintained.
+ */
+bool updateCannotAffectIndex(const IndexCatalogEntry* entry, const FieldRefSet* modifiedPaths) {
+    if (!modifiedPaths) {
+        return false;
+    }
+
+    const UpdateIndexData& indexedPaths = entry->getIndexedPaths();
+    for (auto path : *modifiedPaths) {
+        if (indexedPaths.mightBeIndexed(*path)) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
 Status IndexCatalogImpl::updateRecord(OperationContext* const opCtx,
                                       const BSONObj& oldDoc,
                                       const BSONObj& newDoc,
                                       const RecordId& recordId,
+                                      const FieldRefSet* modifiedPaths,
                                       int64_t* const keysInsertedOut,
                                       int64_t* const keysDeletedOut) {
     *keysInsertedOut = 0;
@@ -1313,6 +1373,10 @@ Status IndexCatalogImpl::updateRecord(OperationContext* const opCtx,
          ++it) {
         IndexCatalogEntry* entry = it->get();
 
+        if (updateCannotAffectIndex(entry, modifiedPaths)) {
+            continue;
+        }
+
         IndexDescriptor* descriptor = entry->descriptor();
         IndexAccessMethod* iam = entry->accessMethod();
 
@@ -1343,6 +1407,10 @@ Status IndexCatalogImpl::updateRecord(OperationContext* const opCtx,
          ++it) {
         IndexCatalogEntry* entry = it->get();
 
+        if (updateCannotAffectIndex(entry, modifiedPaths)) {
+            continue;
+        }
+
         bool logIfError = false;
         invariant(_unindexRecord(opCtx, entry, oldDoc, recordId, logIfError, keysDeletedOut));
 
@@ -34,7 +34,9 @@
 
 #include "mongo/db/catalog/multi_index_block.h"
 
+#include <algorithm>
 #include <ostream>
+#include <utility>
 
 #include "mongo/base/error_codes.h"
 #include "mongo/db/audit.h"
@@ -53,11 +55,13 @@
 #include "mongo/db/server_parameters.h"
 #include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/logger/redaction.h"
+#include "mongo/stdx/memory.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/fail_point_service.h"
 #include "mongo/util/log.h"
 #include "mongo/util/progress_meter.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/quick_exit.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/uuid.h"
@@ -71,6 +75,10 @@ const StringData kBuildingPhaseCompleteFieldName = "buildingPhaseComplete"_sd;
 const StringData kRunTwoPhaseIndexBuildFieldName = "runTwoPhaseIndexBuild"_sd;
 const StringData kCommitReadyMembersFieldName = "commitReadyMembers"_sd;
 
+// Number of documents staged before they are handed to the key generator threads. Large enough
+// to amortize the hand-off, small enough that the owned copies stay cheap.
+const size_t kParallelKeyGenBatchSize = 128;
+
 }  // namespace
 
 MONGO_FAIL_POINT_DEFINE(crashAfterStartingIndexBuild);
@@ -339,6 +347,25 @@ Status MultiIndexBlock::insertAllDocumentsInCollection() {
     bool readOnce = !_buildInBackground && useReadOnceCursorsForIndexBuilds.load();
     _opCtx->recoveryUnit()->setReadOnce(readOnce);
 
+    // When several indexes are built in the foreground they each own an independent bulk
+    // builder, so the expensive key generation can run for every index in parallel over a
+    // staged batch of documents. Background builds are excluded because they interleave real
+    // index writes with the scan.
+    const bool parallelKeyGeneration = !_buildInBackground && _indexes.size() > 1 &&
+        useParallelIndexKeyGeneration.load() &&
+        std::all_of(_indexes.begin(), _indexes.end(), [](const IndexToBuild& index) {
+                                        return static_cast<bool>(index.bulk);
+                                    });
+    std::unique_ptr<ThreadPool> keyGenPool;
+    if (parallelKeyGeneration) {
+        ThreadPool::Options options;
+        options.poolName = "IndexBuildKeyGenerator";
+        options.maxThreads = _indexes.size();
+        keyGenPool = stdx::make_unique<ThreadPool>(options);
+        keyGenPool->startup();
+    }
+    std::vector<std::pair<BSONObj, RecordId>> stagedDocs;
+
     Snapshotted<BSONObj> objToIndex;
     RecordId loc;
     PlanExecutor::ExecState state;
@@ -368,7 +395,18 @@ Status MultiIndexBlock::insertAllDocumentsInCollection() {
             failPointHangDuringBuild(&hangBeforeIndexBuildOf, "before", objToIndex.value());
 
             WriteUnitOfWork wunit(_opCtx);
-            Status ret = insert(objToIndex.value(), loc);
+            Status ret = Status::OK();
+            if (keyGenPool) {
+                // The bulk builders never touch the storage engine, so the document can be
+                // staged and indexed outside this storage transaction.
+                stagedDocs.emplace_back(objToIndex.value().getOwned(), loc);
+                if (stagedDocs.size() >= kParallelKeyGenBatchSize) {
+                    ret = _insertBatchForBulkBuilders(keyGenPool.get(), stagedDocs);
+                    stagedDocs.clear();
+                }
+            } else {
+                ret = insert(objToIndex.value(), loc);
+            }
             if (_buildInBackground)
                 exec->saveState();
             if (!ret.isOK()) {
@@ -412,6 +450,13 @@ Status MultiIndexBlock::insertAllDocumentsInCollection() {
         return exec->getMemberObjectStatus(objToIndex.value());
     }
 
+    if (keyGenPool && !stagedDocs.empty()) {
+        Status ret = _insertBatchForBulkBuilders(keyGenPool.get(), stagedDocs);
+        if (!ret.isOK())
+            return ret;
+        stagedDocs.clear();
+    }
+
     if (MONGO_FAIL_POINT(hangAfterStartingIndexBuildUnlocked)) {
         // Unlock before hanging so replication recognizes we've completed.
         Locker::LockSnapshot lockInfo;
@@ -475,6 +520,62 @@ Status MultiIndexBlock::insert(const BSONObj& doc, const RecordId& loc) {
     return Status::OK();
 }
 
+Status MultiIndexBlock::_insertBatchForBulkBuilders(
+    ThreadPool* pool, const std::vector<std::pair<BSONObj, RecordId>>& batch) {
+    if (State::kAborted == _getState()) {
+        return {ErrorCodes::IndexBuildAborted,
+                str::stream() << "Index build aborted: " << _abortReason
+                              << ". Cannot insert documents into index builder: "
+                              << _collection->ns().ns()
+                              << "("
+                              << *_collection->uuid()
+                              << ")"};
+    }
+
+    // Each task works against a single index's bulk builder, so the tasks share nothing but the
+    // read-only batch. The bulk insert path generates keys from the document alone and feeds
+    // them to the index's private Sorter; it never dereferences the OperationContext, which is
+    // what makes handing it to the pool threads safe.
+    std::vector<Status> results(_indexes.size(), Status::OK());
+    Status scheduleStatus = Status::OK();
+    for (size_t i = 0; i < _indexes.size(); i++) {
+        IndexToBuild* index = &_indexes[i];
+        Status* result = &results[i];
+        scheduleStatus = pool->schedule([ this, index, result, &batch ] {
+            try {
+                for (const auto& docAndLoc : batch) {
+                    if (index->filterExpression &&
+                        !index->filterExpression->matchesBSON(docAndLoc.first)) {
+                        continue;
+                    }
+                    Status status = index->bulk->insert(
+                        _opCtx, docAndLoc.first, docAndLoc.second, index->options);
+                    if (!status.isOK()) {
+                        *result = status;
+                        return;
+                    }
+                }
+            } catch (...) {
+                *result = exceptionToStatus();
+            }
+        });
+        if (!scheduleStatus.isOK())
+            break;
+    }
+
+    // Wait for the tasks that did get scheduled before the stack-allocated batch and result
+    // slots go away.
+    pool->waitForIdle();
+
+    if (!scheduleStatus.isOK())
+        return scheduleStatus;
+    for (const auto& result : results) {
+        if (!result.isOK())
+            return result;
+    }
+    return Status::OK();
+}
+
 Status MultiIndexBlock::dumpInsertsFromBulk() {
     return dumpInsertsFromBulk(nullptr);
 }
@@ -34,6 +34,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "mongo/base/disallow_copying.h"
@@ -49,6 +50,8 @@
 #include "mongo/stdx/mutex.h"
 
 namespace mongo {
+
+class ThreadPool;
 class Collection;
 class MatchExpression;
 class OperationContext;
@@ -261,6 +264,17 @@ private:
     Status _dumpInsertsFromBulk(std::set<RecordId>* dupRecords,
                                 std::vector<BSONObj>* dupKeysInserted);
 
+    /**
+     * Hands a batch of documents to 'pool', with one task per index generating that index's keys
+     * for the whole batch and feeding them to its bulk builder. Blocks until every task has
+     * completed and returns the first error any of them produced.
+     *
+     * May only be used when every index is being built with a bulk builder, since only the bulk
+     * insert path is independent of the operation context and storage transaction.
+     */
+    Status _insertBatchForBulkBuilders(ThreadPool* pool,
+                                       const std::vector<std::pair<BSONObj, RecordId>>& batch);
+
     /**
      * Returns the current state.
      */
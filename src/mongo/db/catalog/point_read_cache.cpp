@@ -0,0 +1,117 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/catalog/point_read_cache.h"
+
+#include "mongo/db/query/query_knobs.h"
+
+namespace mongo {
+
+namespace {
+
+size_t entrySizeBytes(const BSONObj& key, const BSONObj& doc) {
+    return static_cast<size_t>(key.objsize()) + static_cast<size_t>(doc.objsize()) +
+        sizeof(PointReadCache*);  // Rough allowance for per-entry bookkeeping.
+}
+
+}  // namespace
+
+boost::optional<BSONObj> PointReadCache::lookup(const BSONObj& key) {
+    const auto now = Date_t::now();
+    const auto currentGeneration = _generation.load();
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    auto it = _entries.find(key);
+    if (it == _entries.end()) {
+        return boost::none;
+    }
+
+    if (it->second.generation != currentGeneration || now >= it->second.expiration) {
+        _totalSizeBytes -= entrySizeBytes(it->first, it->second.doc);
+        _entries.erase(it);
+        return boost::none;
+    }
+
+    return it->second.doc;
+}
+
+void PointReadCache::insert(const BSONObj& key, const BSONObj& doc, long long generationAtRead) {
+    dassert(key.isOwned());
+    dassert(doc.isOwned());
+
+    const auto ttl = Milliseconds(internalQueryPointReadCacheTTLMillis.load());
+    const auto maxSizeBytes = static_cast<size_t>(internalQueryPointReadCacheMaxSizeBytes.load());
+    const auto newEntrySize = entrySizeBytes(key, doc);
+    if (newEntrySize > maxSizeBytes) {
+        return;
+    }
+
+    const auto now = Date_t::now();
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+
+    // A write may have committed between the storage read and this fill. Caching the result
+    // anyway could serve the pre-write document past the write, so decline instead.
+    if (_generation.load() != generationAtRead) {
+        return;
+    }
+
+    auto it = _entries.find(key);
+    if (it != _entries.end()) {
+        _totalSizeBytes -= entrySizeBytes(it->first, it->second.doc);
+        _entries.erase(it);
+    }
+
+    if (_totalSizeBytes + newEntrySize > maxSizeBytes) {
+        // Evict expired and invalidated entries before giving up on the fill. TTLs for this cache
+        // are expected to be short, so a full sweep generally reclaims most of the budget.
+        const auto currentGeneration = _generation.load();
+        for (auto entryIt = _entries.begin(); entryIt != _entries.end();) {
+            if (entryIt->second.generation != currentGeneration ||
+                now >= entryIt->second.expiration) {
+                _totalSizeBytes -= entrySizeBytes(entryIt->first, entryIt->second.doc);
+                entryIt = _entries.erase(entryIt);
+            } else {
+                ++entryIt;
+            }
+        }
+
+        if (_totalSizeBytes + newEntrySize > maxSizeBytes) {
+            return;
+        }
+    }
+
+    _entries[key] = {doc, generationAtRead, now + ttl};
+    _totalSizeBytes += newEntrySize;
+}
+
+}  // namespace mongo
@@ -0,0 +1,115 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional.hpp>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/bson/simple_bsonobj_comparator.h"
+#include "mongo/db/jsobj.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+/**
+ * A per-collection cache of the results of point reads through the _id index, allowing repeated
+ * lookups of the same document to be answered without touching the storage engine.
+ *
+ * Entries are keyed by the wrapped _id value that the IDHACK fast path seeks on, and carry both a
+ * TTL deadline and the collection write generation that was current when the entry was filled. The
+ * generation is bumped by every document write to the collection, so a cached result is served
+ * only while no write has committed since it was read; the TTL bounds staleness across races that
+ * the generation cannot observe (e.g. a fill that overlaps an uncommitted write).
+ *
+ * The cache is disabled unless internalQueryPointReadCacheTTLMillis is set to a nonzero value.
+ * Callers are expected to check that knob before probing.
+ */
+class PointReadCache {
+    MONGO_DISALLOW_COPYING(PointReadCache);
+
+public:
+    PointReadCache() = default;
+
+    /**
+     * Returns the current write generation. Callers capture this before reading from storage and
+     * pass it back to insert(), which refuses the fill if any write has intervened.
+     */
+    long long getCurrentGeneration() const {
+        return _generation.load();
+    }
+
+    /**
+     * Invalidates all cached results by bumping the write generation. Stale entries are discarded
+     * lazily by lookup() rather than eagerly swept, so this is cheap enough to call from every
+     * document write.
+     */
+    void notifyOfWriteOp() {
+        _generation.fetchAndAdd(1);
+    }
+
+    /**
+     * Returns the cached document for 'key' if there is an entry that is neither expired nor
+     * invalidated by a later write, and boost::none otherwise. The returned object is owned.
+     */
+    boost::optional<BSONObj> lookup(const BSONObj& key);
+
+    /**
+     * Caches 'doc' as the result of a point read on 'key'. 'generationAtRead' must be the value
+     * getCurrentGeneration() returned before the storage read; the fill is discarded if a write
+     * has bumped the generation since then, or if the cache's byte budget cannot accommodate the
+     * entry. 'doc' must be owned.
+     */
+    void insert(const BSONObj& key, const BSONObj& doc, long long generationAtRead);
+
+private:
+    struct CachedEntry {
+        BSONObj doc;
+        long long generation;
+        Date_t expiration;
+    };
+
+    // Incremented by every document write to the collection. Read lock-free on the write path.
+    AtomicWord<long long> _generation{0};
+
+    // Protects the members below.
+    stdx::mutex _mutex;
+
+    BSONObjIndexedUnorderedMap<CachedEntry> _entries =
+        SimpleBSONObjComparator::kInstance.makeBSONObjIndexedUnorderedMap<CachedEntry>();
+
+    // Total size of the keys and documents in '_entries', checked against the
+    // internalQueryPointReadCacheMaxSizeBytes budget on insert.
+    size_t _totalSizeBytes = 0;
+};
+
+}  // namespace mongo
@@ -0,0 +1,144 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/catalog/point_read_cache.h"
+
+#include "mongo/db/query/query_knobs.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Sets the point read cache knobs for the duration of a test and restores them on destruction.
+ */
+class PointReadCacheKnobs {
+public:
+    PointReadCacheKnobs(int ttlMillis, long long maxSizeBytes)
+        : _oldTTLMillis(internalQueryPointReadCacheTTLMillis.swap(ttlMillis)),
+          _oldMaxSizeBytes(internalQueryPointReadCacheMaxSizeBytes.swap(maxSizeBytes)) {}
+
+    ~PointReadCacheKnobs() {
+        internalQueryPointReadCacheTTLMillis.store(_oldTTLMillis);
+        internalQueryPointReadCacheMaxSizeBytes.store(_oldMaxSizeBytes);
+    }
+
+private:
+    int _oldTTLMillis;
+    long long _oldMaxSizeBytes;
+};
+
+TEST(PointReadCacheTest, LookupReturnsInsertedDocumentWithinTTL) {
+    PointReadCacheKnobs knobs(60 * 1000, 10 * 1024 * 1024);
+    PointReadCache cache;
+
+    const BSONObj key = BSON("_id" << 1);
+    const BSONObj doc = BSON("_id" << 1 << "a" << 2);
+
+    ASSERT_FALSE(cache.lookup(key));
+
+    cache.insert(key, doc, cache.getCurrentGeneration());
+    auto cached = cache.lookup(key);
+    ASSERT_TRUE(cached);
+    ASSERT_BSONOBJ_EQ(*cached, doc);
+
+    ASSERT_FALSE(cache.lookup(BSON("_id" << 2)));
+}
+
+TEST(PointReadCacheTest, WriteOpInvalidatesCachedDocument) {
+    PointReadCacheKnobs knobs(60 * 1000, 10 * 1024 * 1024);
+    PointReadCache cache;
+
+    const BSONObj key = BSON("_id" << 1);
+    cache.insert(key, BSON("_id" << 1 << "a" << 2), cache.getCurrentGeneration());
+    ASSERT_TRUE(cache.lookup(key));
+
+    cache.notifyOfWriteOp();
+    ASSERT_FALSE(cache.lookup(key));
+}
+
+TEST(PointReadCacheTest, InsertIsDiscardedWhenAWriteIntervenedSinceTheRead) {
+    PointReadCacheKnobs knobs(60 * 1000, 10 * 1024 * 1024);
+    PointReadCache cache;
+
+    const BSONObj key = BSON("_id" << 1);
+    const auto generationAtRead = cache.getCurrentGeneration();
+    cache.notifyOfWriteOp();
+
+    cache.insert(key, BSON("_id" << 1 << "a" << 2), generationAtRead);
+    ASSERT_FALSE(cache.lookup(key));
+}
+
+TEST(PointReadCacheTest, ExpiredEntryIsNotReturned) {
+    // A zero TTL expires entries as soon as they are inserted.
+    PointReadCacheKnobs knobs(0, 10 * 1024 * 1024);
+    PointReadCache cache;
+
+    const BSONObj key = BSON("_id" << 1);
+    cache.insert(key, BSON("_id" << 1 << "a" << 2), cache.getCurrentGeneration());
+    ASSERT_FALSE(cache.lookup(key));
+}
+
+TEST(PointReadCacheTest, InsertRespectsByteBudget) {
+    PointReadCacheKnobs knobs(60 * 1000, 64);
+    PointReadCache cache;
+
+    const BSONObj key = BSON("_id" << 1);
+    const BSONObj oversized = BSON("_id" << 1 << "padding" << std::string(128, 'x'));
+    cache.insert(key, oversized, cache.getCurrentGeneration());
+    ASSERT_FALSE(cache.lookup(key));
+}
+
+TEST(PointReadCacheTest, InsertEvictsInvalidatedEntriesToMakeRoom) {
+    const BSONObj key1 = BSON("_id" << 1);
+    const BSONObj key2 = BSON("_id" << 2);
+    const BSONObj doc1 = BSON("_id" << 1 << "padding" << std::string(64, 'x'));
+    const BSONObj doc2 = BSON("_id" << 2 << "padding" << std::string(64, 'y'));
+
+    // Size the budget so that only one of the two documents fits at a time.
+    PointReadCacheKnobs knobs(
+        60 * 1000, key1.objsize() + doc1.objsize() + sizeof(PointReadCache*) + 16);
+    PointReadCache cache;
+
+    cache.insert(key1, doc1, cache.getCurrentGeneration());
+    ASSERT_TRUE(cache.lookup(key1));
+
+    // A write invalidates the first entry, which should then be evicted to admit the second.
+    cache.notifyOfWriteOp();
+    cache.insert(key2, doc2, cache.getCurrentGeneration());
+    auto cached = cache.lookup(key2);
+    ASSERT_TRUE(cached);
+    ASSERT_BSONOBJ_EQ(*cached, doc2);
+}
+
+}  // namespace
+}  // namespace mongo
@@ -42,13 +42,26 @@
 #include "mongo/db/index/wildcard_access_method.h"
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/server_parameters.h"
+#include "mongo/db/service_context.h"
 #include "mongo/db/storage/key_string.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/rpc/object_check.h"
+#include "mongo/util/clock_source.h"
 #include "mongo/util/log.h"
 
 namespace mongo {
 
+// Bounds the rate at which a background validation reads collection and index data, in megabytes
+// per second. A value of 0 means the scan is not throttled.
+MONGO_EXPORT_SERVER_PARAMETER(maxValidateMBperSec, int, 0)
+    ->withValidator([](const int& newVal) {
+        if (newVal < 0) {
+            return Status(ErrorCodes::BadValue, "maxValidateMBperSec must be non-negative");
+        }
+        return Status::OK();
+    });
+
 namespace {
 // TODO SERVER-36385: Completely remove the key size check in 4.4
 bool isLargeKeyDisallowed() {
@@ -99,8 +112,9 @@ Status RecordStoreValidateAdaptor::validate(const RecordId& recordId,
             }
         }
 
-        BSONObjSet documentKeySet = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
-        BSONObjSet multikeyMetadataKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+        BSONObjFlatSet documentKeySet = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
+        BSONObjFlatSet multikeyMetadataKeys =
+            SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
         MultikeyPaths multikeyPaths;
         iam->getKeys(recordBson,
                      IndexAccessMethod::GetKeysMode::kEnforceConstraints,
@@ -143,6 +157,38 @@ Status RecordStoreValidateAdaptor::validate(const RecordId& recordId,
     return status;
 }
 
+void RecordStoreValidateAdaptor::_applyScanThrottle(int64_t bytesRead) {
+    if (!_background) {
+        return;
+    }
+
+    const int64_t maxBytesPerSec =
+        static_cast<int64_t>(maxValidateMBperSec.load()) * 1024 * 1024;
+    if (maxBytesPerSec <= 0) {
+        return;
+    }
+
+    auto clockSource = _opCtx->getServiceContext()->getFastClockSource();
+    if (_throttleWindowStart == Date_t()) {
+        _throttleWindowStart = clockSource->now();
+    }
+
+    _throttledBytes += bytesRead;
+    if (_throttledBytes < maxBytesPerSec) {
+        return;
+    }
+
+    // The read budget for the current window has been used up. Sleep out the remainder of the
+    // window before scanning any further.
+    const auto windowEnd = _throttleWindowStart + Seconds(1);
+    if (clockSource->now() < windowEnd) {
+        _opCtx->sleepUntil(windowEnd);
+    }
+
+    _throttleWindowStart = clockSource->now();
+    _throttledBytes = 0;
+}
+
 void RecordStoreValidateAdaptor::traverseIndex(const IndexAccessMethod* iam,
                                                const IndexDescriptor* descriptor,
                                                ValidateResults* results,
@@ -157,10 +203,17 @@ void RecordStoreValidateAdaptor::traverseIndex(const IndexAccessMethod* iam,
     std::unique_ptr<KeyString> prevIndexKeyString = nullptr;
     bool isFirstEntry = true;
 
+    const int interruptInterval = 4096;
+
     std::unique_ptr<SortedDataInterface::Cursor> cursor = iam->newCursor(_opCtx, true);
     // Seeking to BSONObj() is equivalent to seeking to the first entry of an index.
     for (auto indexEntry = cursor->seek(BSONObj(), true); indexEntry; indexEntry = cursor->next()) {
 
+        if (!(numKeys % interruptInterval)) {
+            _opCtx->checkForInterrupt();
+        }
+        _applyScanThrottle(indexEntry->key.objsize());
+
         // We want to use the latest version of KeyString here.
         std::unique_ptr<KeyString> indexKeyString =
             stdx::make_unique<KeyString>(version, indexEntry->key, ord, indexEntry->loc);
@@ -223,6 +276,7 @@ void RecordStoreValidateAdaptor::traverseRecordStore(RecordStore* recordStore,
 
         auto dataSize = record->data.size();
         dataSizeTotal += dataSize;
+        _applyScanThrottle(dataSize);
         size_t validatedSize;
         Status status = validate(record->id, record->data, &validatedSize);
 
@@ -246,7 +300,9 @@ void RecordStoreValidateAdaptor::traverseRecordStore(RecordStore* recordStore,
         prevRecordId = record->id;
     }
 
-    if (results->valid) {
+    // A background validation scans a snapshot of the record store while writes are accepted, so
+    // its counts are stale by the time the scan finishes and must not be written back.
+    if (results->valid && !_background) {
         recordStore->updateStatsAfterRepair(_opCtx, nrecords, dataSizeTotal);
     }
 
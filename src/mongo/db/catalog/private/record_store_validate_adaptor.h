@@ -55,12 +55,14 @@ public:
     RecordStoreValidateAdaptor(OperationContext* opCtx,
                                IndexConsistency* indexConsistency,
                                ValidateCmdLevel level,
+                               bool background,
                                IndexCatalog* ic,
                                ValidateResultsMap* irm)
 
         : _opCtx(opCtx),
           _indexConsistency(indexConsistency),
           _level(level),
+          _background(background),
           _indexCatalog(ic),
           _indexNsResultsMap(irm) {}
 
@@ -96,10 +98,24 @@ public:
                                ValidateResults& results);
 
 private:
+    /**
+     * Charges 'bytesRead' against the rate limit configured by the 'maxValidateMBperSec' server
+     * parameter and sleeps out the remainder of the current one second window once the budget is
+     * exhausted. Only takes effect during background validations; foreground validations hold an
+     * exclusive lock and should finish as quickly as possible.
+     */
+    void _applyScanThrottle(int64_t bytesRead);
+
     OperationContext* _opCtx;             // Not owned.
     IndexConsistency* _indexConsistency;  // Not owned.
     ValidateCmdLevel _level;
+    const bool _background;
     IndexCatalog* _indexCatalog;             // Not owned.
     ValidateResultsMap* _indexNsResultsMap;  // Not owned.
+
+    // Throttling state for background validations. Tracks the bytes scanned in the current one
+    // second window and when that window began.
+    int64_t _throttledBytes = 0;
+    Date_t _throttleWindowStart;
 };
 }  // namespace
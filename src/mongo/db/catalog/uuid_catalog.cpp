@@ -129,14 +129,19 @@ void UUIDCatalog::setCollectionNamespace(OperationContext* opCtx,
     // provide UUID to namespace lookup. In addition, the UUIDCatalog does not require callers to
     // hold locks.
     //
-    // This means that Collection::ns() may be called while only '_catalogLock' (and no lock manager
-    // locks) are held. The purpose of this function is ensure that we write to the Collection's
-    // namespace string under '_catalogLock'.
+    // This means that Collection::ns() may be called while only '_catalogLock' or a partition
+    // mutex (and no lock manager locks) are held. The purpose of this function is to ensure that
+    // we write to the Collection's namespace string under all of them. Renames are rare, so
+    // taking every partition mutex here does not matter for performance.
     invariant(coll);
     stdx::lock_guard<stdx::mutex> lock(_catalogLock);
-    coll->setNs(toCollection);
+    {
+        auto allPartitionLocks = _lockAllPartitions();
+        coll->setNs(toCollection);
+    }
     opCtx->recoveryUnit()->onRollback([this, coll, fromCollection] {
         stdx::lock_guard<stdx::mutex> lock(_catalogLock);
+        auto allPartitionLocks = _lockAllPartitions();
         coll->setNs(std::move(fromCollection));
     });
 }
@@ -156,8 +161,9 @@ void UUIDCatalog::onCloseCatalog(OperationContext* opCtx) {
     stdx::lock_guard<stdx::mutex> lock(_catalogLock);
     invariant(!_shadowCatalog);
     _shadowCatalog.emplace();
-    for (auto entry : _catalog)
-        _shadowCatalog->insert({entry.first, entry.second->ns()});
+    for (const auto& partition : _partitions)
+        for (auto entry : partition.collections)
+            _shadowCatalog->insert({entry.first, entry.second->ns()});
 }
 
 void UUIDCatalog::onOpenCatalog(OperationContext* opCtx) {
@@ -168,20 +174,25 @@ void UUIDCatalog::onOpenCatalog(OperationContext* opCtx) {
 }
 
 Collection* UUIDCatalog::lookupCollectionByUUID(CollectionUUID uuid) const {
-    stdx::lock_guard<stdx::mutex> lock(_catalogLock);
-    auto foundIt = _catalog.find(uuid);
-    return foundIt == _catalog.end() ? nullptr : foundIt->second;
+    auto& partition = _partition(uuid);
+    stdx::lock_guard<stdx::mutex> lock(partition.mutex);
+    auto foundIt = partition.collections.find(uuid);
+    return foundIt == partition.collections.end() ? nullptr : foundIt->second;
 }
 
 NamespaceString UUIDCatalog::lookupNSSByUUID(CollectionUUID uuid) const {
-    stdx::lock_guard<stdx::mutex> lock(_catalogLock);
-    auto foundIt = _catalog.find(uuid);
-    if (foundIt != _catalog.end())
-        return foundIt->second->ns();
+    {
+        auto& partition = _partition(uuid);
+        stdx::lock_guard<stdx::mutex> lock(partition.mutex);
+        auto foundIt = partition.collections.find(uuid);
+        if (foundIt != partition.collections.end())
+            return foundIt->second->ns();
+    }
 
     // Only in the case that the catalog is closed and a UUID is currently unknown, resolve it
     // using the pre-close state. This ensures that any tasks reloading the catalog can see their
     // own updates.
+    stdx::lock_guard<stdx::mutex> lock(_catalogLock);
     if (_shadowCatalog) {
         auto shadowIt = _shadowCatalog->find(uuid);
         if (shadowIt != _shadowCatalog->end())
@@ -242,11 +253,14 @@ const std::vector<CollectionUUID>& UUIDCatalog::_getOrdering_inlock(
         return it->second;
     }
 
-    // Otherwise, get all of the UUIDs for this database,
+    // Otherwise, get all of the UUIDs for this database. All mutations hold '_catalogLock', which
+    // the caller holds, so scanning every partition without the partition mutexes is safe.
     auto& newOrdering = _orderedCollections[db];
-    for (const auto& pair : _catalog) {
-        if (pair.second->ns().db() == db) {
-            newOrdering.push_back(pair.first);
+    for (const auto& partition : _partitions) {
+        for (const auto& pair : partition.collections) {
+            if (pair.second->ns().db() == db) {
+                newOrdering.push_back(pair.first);
+            }
         }
     }
 
@@ -255,19 +269,33 @@ const std::vector<CollectionUUID>& UUIDCatalog::_getOrdering_inlock(
 
     return newOrdering;
 }
+
+std::vector<stdx::unique_lock<stdx::mutex>> UUIDCatalog::_lockAllPartitions() const {
+    std::vector<stdx::unique_lock<stdx::mutex>> locks;
+    locks.reserve(kNumPartitions);
+    for (auto& partition : _partitions) {
+        locks.emplace_back(partition.mutex);
+    }
+    return locks;
+}
+
 void UUIDCatalog::_registerUUIDCatalogEntry_inlock(CollectionUUID uuid, Collection* coll) {
-    if (coll && !_catalog.count(uuid)) {
+    auto& partition = _partition(uuid);
+    stdx::lock_guard<stdx::mutex> partitionLock(partition.mutex);
+    if (coll && !partition.collections.count(uuid)) {
         // Invalidate this database's ordering, since we're adding a new UUID.
         _orderedCollections.erase(coll->ns().db());
 
         std::pair<CollectionUUID, Collection*> entry = std::make_pair(uuid, coll);
         LOG(2) << "registering collection " << coll->ns() << " with UUID " << uuid.toString();
-        invariant(_catalog.insert(entry).second == true);
+        invariant(partition.collections.insert(entry).second == true);
     }
 }
 Collection* UUIDCatalog::_removeUUIDCatalogEntry_inlock(CollectionUUID uuid) {
-    auto foundIt = _catalog.find(uuid);
-    if (foundIt == _catalog.end())
+    auto& partition = _partition(uuid);
+    stdx::lock_guard<stdx::mutex> partitionLock(partition.mutex);
+    auto foundIt = partition.collections.find(uuid);
+    if (foundIt == partition.collections.end())
         return nullptr;
 
     // Invalidate this database's ordering, since we're deleting a UUID.
@@ -275,7 +303,7 @@ Collection* UUIDCatalog::_removeUUIDCatalogEntry_inlock(CollectionUUID uuid) {
 
     auto foundCol = foundIt->second;
     LOG(2) << "unregistering collection " << foundCol->ns() << " with UUID " << uuid.toString();
-    _catalog.erase(foundIt);
+    partition.collections.erase(foundIt);
     return foundCol;
 }
 }  // namespace mongo
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include <array>
 #include <unordered_map>
 
 #include "mongo/base/disallow_copying.h"
@@ -37,6 +38,7 @@
 #include "mongo/db/op_observer.h"
 #include "mongo/db/service_context.h"
 #include "mongo/stdx/functional.h"
+#include "mongo/stdx/mutex.h"
 #include "mongo/util/uuid.h"
 
 namespace mongo {
@@ -242,7 +244,31 @@ private:
     void _registerUUIDCatalogEntry_inlock(CollectionUUID uuid, Collection* coll);
     Collection* _removeUUIDCatalogEntry_inlock(CollectionUUID uuid);
 
+    // The UUID to Collection mapping is partitioned by the hash of the UUID so that lookups,
+    // which run for every operation that addresses its collection by UUID, do not all funnel
+    // through one mutex. All mutations additionally hold '_catalogLock', so a scan of every
+    // partition is safe under '_catalogLock' alone, while a point lookup only needs the owning
+    // partition's mutex. When both are taken, '_catalogLock' is always acquired first.
+    static const size_t kNumPartitions = 64;
+
+    struct Partition {
+        mutable mongo::stdx::mutex mutex;
+        mongo::stdx::unordered_map<CollectionUUID, Collection*, CollectionUUID::Hash> collections;
+    };
+
+    Partition& _partition(CollectionUUID uuid) const {
+        return _partitions[CollectionUUID::Hash{}(uuid) % kNumPartitions];
+    }
+
+    std::vector<stdx::unique_lock<stdx::mutex>> _lockAllPartitions() const;
+
+    mutable std::array<Partition, kNumPartitions> _partitions;
+
+    // Guards the ordering cache and the shadow catalog, and serializes all catalog mutations,
+    // including Collection namespace changes (which additionally hold every partition mutex so
+    // that Collection::ns() may be read under either '_catalogLock' or the partition mutex).
     mutable mongo::stdx::mutex _catalogLock;
+
     /**
      * When present, indicates that the catalog is in closed state, and contains a map from UUID
      * to pre-close NSS. See also onCloseCatalog.
@@ -258,7 +284,6 @@ private:
      * not all databases are guaranteed to have an ordering in it.
      */
     StringMap<std::vector<CollectionUUID>> _orderedCollections;
-    mongo::stdx::unordered_map<CollectionUUID, Collection*, CollectionUUID::Hash> _catalog;
 };
 
 }  // namespace mongo
@@ -93,13 +93,14 @@ ClientCursor::ClientCursor(ClientCursorParams params,
       _originatingCommand(params.originatingCommandObj),
       _queryOptions(params.queryOptions),
       _exec(std::move(params.exec)),
+      _pinState(kPinned),
       _operationUsingCursor(operationUsingCursor),
       _lastUseDate(now),
       _createdDate(now),
       _planSummary(Explain::getPlanSummary(_exec.get())) {
     invariant(_cursorManager);
     invariant(_exec);
-    invariant(_operationUsingCursor);
+    invariant(_operationUsingCursor.load());
 
     cursorStatsOpen.increment();
 
@@ -112,7 +113,7 @@ ClientCursor::ClientCursor(ClientCursorParams params,
 
 ClientCursor::~ClientCursor() {
     // Cursors must be unpinned and deregistered from their cursor manager before being deleted.
-    invariant(!_operationUsingCursor);
+    invariant(!_operationUsingCursor.load());
     invariant(_disposed);
 
     cursorStatsOpen.decrement();
@@ -148,7 +149,7 @@ GenericCursor ClientCursor::toGenericCursor() const {
     gc.setCreatedDate(getCreatedDate());
     gc.setNBatchesReturned(getNBatches());
     gc.setPlanSummary(getPlanSummary());
-    if (auto opCtx = _operationUsingCursor) {
+    if (auto opCtx = _operationUsingCursor.load()) {
         gc.setOperationUsingCursorId(opCtx->getOpID());
     }
     return gc;
@@ -161,7 +162,7 @@ GenericCursor ClientCursor::toGenericCursor() const {
 ClientCursorPin::ClientCursorPin(OperationContext* opCtx, ClientCursor* cursor)
     : _opCtx(opCtx), _cursor(cursor) {
     invariant(_cursor);
-    invariant(_cursor->_operationUsingCursor);
+    invariant(_cursor->_operationUsingCursor.load());
     invariant(_cursor->_cursorManager);
     invariant(!_cursor->_disposed);
 
@@ -177,7 +178,7 @@ ClientCursorPin::ClientCursorPin(ClientCursorPin&& other)
     // The pinned cursor is being transferred to us from another pin. The 'other' pin must have a
     // pinned cursor.
     invariant(other._cursor);
-    invariant(other._cursor->_operationUsingCursor);
+    invariant(other._cursor->_operationUsingCursor.load());
 
     // Be sure to set the 'other' pin's cursor to null in order to transfer ownership to ourself.
     other._cursor = nullptr;
@@ -193,7 +194,7 @@ ClientCursorPin& ClientCursorPin::operator=(ClientCursorPin&& other) {
     // pinned cursor, and we must not have a cursor.
     invariant(!_cursor);
     invariant(other._cursor);
-    invariant(other._cursor->_operationUsingCursor);
+    invariant(other._cursor->_operationUsingCursor.load());
 
     // Copy the cursor pointer to ourselves, but also be sure to set the 'other' pin's cursor to
     // null so that it no longer has the cursor pinned.
@@ -221,7 +222,7 @@ void ClientCursorPin::release() {
     dassert(_opCtx->lockState()->isCollectionLockedForMode(_cursor->_nss.ns(), MODE_IS) ||
             _cursor->_cursorManager->isGlobalManager());
 
-    invariant(_cursor->_operationUsingCursor);
+    invariant(_cursor->_operationUsingCursor.load());
 
     if (_cursor->getExecutor()->isMarkedAsKilled()) {
         // The ClientCursor was killed while we had it.  Therefore, it is our responsibility to
@@ -239,7 +240,7 @@ void ClientCursorPin::release() {
 
 void ClientCursorPin::deleteUnderlying() {
     invariant(_cursor);
-    invariant(_cursor->_operationUsingCursor);
+    invariant(_cursor->_operationUsingCursor.load());
     // Note the following subtleties of this method's implementation:
     // - We must unpin the cursor before destruction, since it is an error to delete a pinned
     //   cursor.
@@ -260,7 +261,7 @@ void ClientCursorPin::deleteUnderlying() {
 
     // Make sure the cursor is disposed and unpinned before being destroyed.
     _cursor->dispose(_opCtx);
-    _cursor->_operationUsingCursor = nullptr;
+    _cursor->_operationUsingCursor.store(nullptr);
     delete _cursor;
 
     cursorStatsOpenPinned.decrement();
@@ -39,6 +39,7 @@
 #include "mongo/db/query/plan_executor.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/repl/read_concern_level.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/functional.h"
 
 namespace mongo {
@@ -207,6 +208,27 @@ public:
         return _lastUseDate;
     }
 
+    /**
+     * Records the size of the batch just returned and when it was handed to the client, for
+     * adaptive sizing of the next batch. See FindCommon::adaptiveBatchByteTarget().
+     */
+    void setLastBatchInfo(long long bytes, Date_t when) {
+        _lastBatchBytes = bytes;
+        _lastBatchReturnedAt = when;
+    }
+
+    /**
+     * Returns the size in bytes of the most recent batch, or zero if no batch has been returned
+     * yet.
+     */
+    long long getLastBatchBytes() const {
+        return _lastBatchBytes;
+    }
+
+    Date_t getLastBatchReturnedAt() const {
+        return _lastBatchReturnedAt;
+    }
+
     Date_t getCreatedDate() const {
         return _createdDate;
     }
@@ -354,37 +376,54 @@ private:
     // The underlying query execution machinery. Must be non-null.
     std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> _exec;
 
-    //
-    // The following fields are used by the CursorManager and the ClientCursorPin. In most
-    // conditions, they can only be used while holding the CursorManager's mutex. Exceptions
-    // include:
-    //   - If the ClientCursor is pinned, the CursorManager will never change '_isPinned' until
-    //     asked to by the ClientCursorPin.
-    //   - It is safe to read '_killed' while holding a collection lock, which must be held when
-    //     interacting with a ClientCursorPin.
-    //   - A ClientCursorPin can access these members after deregistering the cursor from the
-    //     CursorManager, at which point it has sole ownership of the ClientCursor.
-    //
+    // While a cursor is being used by a client, it is marked as "pinned". The pin state is
+    // tracked with an atomic word so that the pin and unpin operations on the getMore hot path
+    // do not have to serialize on a CursorManager partition mutex.
+    enum PinState : unsigned {
+        // Not in use. The CursorManager owns the cursor and may time it out or dispose of it
+        // while holding the appropriate partition lock.
+        kIdle = 0,
+
+        // In use by exactly one operation, recorded in '_operationUsingCursor'. The pinning
+        // operation owns the cursor and is responsible for disposing of it if it is killed.
+        kPinned,
+
+        // A killCursors or killOp has interrupted the pinning operation. The pinning operation
+        // is still responsible for disposal, but must take the partition lock to do so.
+        kKillPending,
+    };
 
-    // While a cursor is being used by a client, it is marked as "pinned" by setting
-    // _operationUsingCursor to the current OperationContext.
+    // Transitions:
+    //   - kIdle -> kPinned happens via compare-and-swap while holding the cursor's partition
+    //     lock in the CursorManager (the lock is needed to find the cursor in the map anyway).
+    //     The pinning OperationContext is published to '_operationUsingCursor' before the
+    //     partition lock is released.
+    //   - kPinned -> kIdle happens via compare-and-swap with no locks held: the unpinning
+    //     operation clears '_operationUsingCursor' and then attempts the transition. Once a
+    //     cursor is observed to be kIdle while holding the partition lock, the unpinning thread
+    //     is guaranteed to no longer touch it.
+    //   - kPinned -> kKillPending happens via compare-and-swap while holding the partition
+    //     lock. Winning this race entitles the killer to dereference '_operationUsingCursor'
+    //     (after a null check, as the unpin may already have cleared it); the unpin
+    //     compare-and-swap then fails and takes a partition-locked cleanup path instead.
     //
-    // Cursors always come into existence in a pinned state (this must be non-null at construction).
-    //
-    // To write to this field one of the following must be true:
-    // 1) You have a lock on the appropriate partition in CursorManager and the cursor is unpinned
-    // (the field is null).
-    // 2) You own the cursor and the cursor manager it was associated with is gone (this can only
-    // happen in ClientCursorPin). In this case, nobody else will try to pin the cursor.
-    //
-    // To read this field one of the following must be true:
-    // 1) You have a lock on the appropriate partition in CursorManager.
-    // 2) You know you have the cursor pinned.
-    OperationContext* _operationUsingCursor;
+    // Cursors always come into existence registered, pinned, and with '_operationUsingCursor'
+    // set to the creating operation.
+    AtomicWord<unsigned> _pinState;
+
+    // The operation currently using the cursor, or nullptr. May only be dereferenced either by
+    // the pinning operation itself, or while holding the cursor's partition lock after loading
+    // a non-null value with '_pinState' not equal to kIdle.
+    AtomicWord<OperationContext*> _operationUsingCursor;
 
     Date_t _lastUseDate;
     Date_t _createdDate;
 
+    // Size of the most recent batch and the time it was handed to the client; drives adaptive
+    // sizing of the next batch when enabled. See FindCommon::adaptiveBatchByteTarget().
+    long long _lastBatchBytes = 0;
+    Date_t _lastBatchReturnedAt;
+
     // A string with the plan summary of the cursor's query.
     std::string _planSummary;
 };
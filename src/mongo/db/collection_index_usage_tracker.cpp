@@ -48,7 +48,9 @@ void CollectionIndexUsageTracker::recordIndexAccess(StringData indexName) {
     invariant(!indexName.empty());
     dassert(_indexUsageMap.find(indexName) != _indexUsageMap.end());
 
-    _indexUsageMap[indexName].accesses.fetchAndAdd(1);
+    auto& stats = _indexUsageMap[indexName];
+    stats.accesses.fetchAndAdd(1);
+    stats.lastAccess.store(_clockSource->now().toMillisSinceEpoch());
 }
 
 void CollectionIndexUsageTracker::registerIndex(StringData indexName, const BSONObj& indexKey) {
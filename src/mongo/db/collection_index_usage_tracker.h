@@ -59,11 +59,13 @@ public:
 
         IndexUsageStats(const IndexUsageStats& other)
             : accesses(other.accesses.load()),
+              lastAccess(other.lastAccess.load()),
               trackerStartTime(other.trackerStartTime),
               indexKey(other.indexKey) {}
 
         IndexUsageStats& operator=(const IndexUsageStats& other) {
             accesses.store(other.accesses.load());
+            lastAccess.store(other.lastAccess.load());
             trackerStartTime = other.trackerStartTime;
             indexKey = other.indexKey;
             return *this;
@@ -72,6 +74,10 @@ public:
         // Number of operations that have used this index.
         AtomicWord<long long> accesses;
 
+        // Time of the most recent access, in milliseconds since the epoch. Zero when the index
+        // has not been used since we started tracking it.
+        AtomicWord<long long> lastAccess;
+
         // Date/Time that we started tracking index usage.
         Date_t trackerStartTime;
 
@@ -85,6 +85,19 @@ TEST_F(CollectionIndexUsageTrackerTest, MultipleHit) {
     ASSERT_EQUALS(2, statsMap["foo"].accesses.loadRelaxed());
 }
 
+// Test that the last access time tracks the clock and starts out unset.
+TEST_F(CollectionIndexUsageTrackerTest, LastAccessTime) {
+    getTracker()->registerIndex("foo", BSON("foo" << 1));
+    CollectionIndexUsageMap statsMap = getTracker()->getUsageStats();
+    ASSERT_EQUALS(0, statsMap["foo"].lastAccess.loadRelaxed());
+
+    getClockSource()->advance(Milliseconds(100));
+    getTracker()->recordIndexAccess("foo");
+    statsMap = getTracker()->getUsageStats();
+    ASSERT_EQUALS(getClockSource()->now().toMillisSinceEpoch(),
+                  statsMap["foo"].lastAccess.loadRelaxed());
+}
+
 TEST_F(CollectionIndexUsageTrackerTest, IndexKey) {
     getTracker()->registerIndex("foo", BSON("foo" << 1));
     CollectionIndexUsageMap statsMap = getTracker()->getUsageStats();
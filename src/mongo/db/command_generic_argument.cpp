@@ -37,6 +37,8 @@
 #include <cstdlib>
 #include <iterator>
 
+#include "mongo/util/string_map.h"
+
 namespace mongo {
 
 namespace {
@@ -84,10 +86,18 @@ static constexpr std::array<SpecialArgRecord, 25> specials{{
 // clang-format on
 
 const SpecialArgRecord* findSpecialArg(StringData arg) {
-    for (const auto& e : specials)
-        if (e.name == arg)
-            return &e;
-    return nullptr;
+    // Every field of every dispatched command is classified against this table, so the repeated
+    // linear scans show up in command parsing profiles. Index the table by name once and answer
+    // each lookup with a single hashed probe.
+    static const StringMap<const SpecialArgRecord*>& index = *[] {
+        auto map = new StringMap<const SpecialArgRecord*>();
+        for (const auto& e : specials)
+            (*map)[e.name] = &e;
+        return map;
+    }();
+
+    auto it = index.find(arg);
+    return it == index.end() ? nullptr : it->second;
 }
 
 }  // namespace
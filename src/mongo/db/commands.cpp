@@ -34,6 +34,7 @@
 
 #include "mongo/db/commands.h"
 
+#include <array>
 #include <string>
 #include <vector>
 
@@ -342,6 +343,36 @@ void CommandHelpers::appendCommandWCStatus(BSONObjBuilder& result,
     }
 }
 
+void CommandHelpers::uassertNoDuplicateFields(const BSONObj& cmdObj) {
+    // Command objects almost always have well under a few dozen top-level fields, so remember the
+    // names already seen in a fixed inline array instead of filling a hash map on every request.
+    // Only absurdly wide objects spill into the map.
+    constexpr size_t kInlineFields = 32;
+    std::array<StringData, kInlineFields> seen;
+    size_t numSeen = 0;
+    StringMap<int> overflow;
+    for (auto&& element : cmdObj) {
+        StringData fieldName = element.fieldNameStringData();
+        bool isDuplicate = false;
+        for (size_t i = 0; i < numSeen; ++i) {
+            if (seen[i] == fieldName) {
+                isDuplicate = true;
+                break;
+            }
+        }
+        if (!isDuplicate && numSeen == kInlineFields) {
+            isDuplicate = overflow[fieldName]++ > 0;
+        }
+        uassert(ErrorCodes::FailedToParse,
+                str::stream() << "Parsed command object contains duplicate top level key: "
+                              << fieldName,
+                !isDuplicate);
+        if (numSeen < kInlineFields) {
+            seen[numSeen++] = fieldName;
+        }
+    }
+}
+
 BSONObj CommandHelpers::appendPassthroughFields(const BSONObj& cmdObjWithPassthroughFields,
                                                 const BSONObj& request) {
     BSONObjBuilder b;
@@ -390,6 +421,20 @@ BSONObj CommandHelpers::appendMajorityWriteConcern(const BSONObj& cmdObj) {
 }
 
 BSONObj CommandHelpers::filterCommandRequestForPassthrough(const BSONObj& cmdObj) {
+    // Most requests carry nothing that needs to be stripped or rewritten, so scan first and hand
+    // back the original object when filtering would be a no-op.
+    bool needsFilter = false;
+    for (const auto& elem : cmdObj) {
+        const auto name = elem.fieldNameStringData();
+        if (name == "$readPreference" || isRequestStripArgument(name)) {
+            needsFilter = true;
+            break;
+        }
+    }
+    if (!needsFilter) {
+        return cmdObj;
+    }
+
     BSONObjIterator cmdIter(cmdObj);
     BSONObjBuilder bob;
     filterCommandRequestForPassthrough(&cmdIter, &bob);
@@ -422,6 +467,18 @@ void CommandHelpers::filterCommandReplyForPassthrough(const BSONObj& cmdObj,
 }
 
 BSONObj CommandHelpers::filterCommandReplyForPassthrough(const BSONObj& cmdObj) {
+    // As above, skip the rebuild when no field needs to be stripped.
+    bool needsFilter = false;
+    for (const auto& elem : cmdObj) {
+        if (isReplyStripArgument(elem.fieldNameStringData())) {
+            needsFilter = true;
+            break;
+        }
+    }
+    if (!needsFilter) {
+        return cmdObj;
+    }
+
     BSONObjBuilder bob;
     filterCommandReplyForPassthrough(cmdObj, &bob);
     return bob.obj();
@@ -137,6 +137,12 @@ struct CommandHelpers {
                                       const Status& awaitReplicationStatus,
                                       const WriteConcernResult& wcResult = WriteConcernResult());
 
+    /**
+     * Uasserts with ErrorCodes::FailedToParse if 'cmdObj' contains more than one top-level field
+     * with the same name. Does not allocate for command objects of typical width.
+     */
+    static void uassertNoDuplicateFields(const BSONObj& cmdObj);
+
     /**
      * Appends passthrough fields from a cmdObj to a given request.
      */
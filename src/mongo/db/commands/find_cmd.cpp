@@ -284,47 +284,68 @@ public:
             const int ntoskip = -1;
             beginQueryOp(opCtx, nss, _request.body, ntoreturn, ntoskip);
 
-            // Finish the parsing step by using the QueryRequest to create a CanonicalQuery.
-            const ExtensionsCallbackReal extensionsCallback(opCtx, &nss);
-            const boost::intrusive_ptr<ExpressionContext> expCtx;
-            auto cq = uassertStatusOK(
-                CanonicalQuery::canonicalize(opCtx,
-                                             std::move(qr),
-                                             expCtx,
-                                             extensionsCallback,
-                                             MatchExpressionParser::kAllowAllSpecialFeatures));
-
-            if (ctx->getView()) {
-                // Relinquish locks. The aggregation command will re-acquire them.
-                ctx.reset();
-
-                // Convert the find command into an aggregation using $match (and other stages, as
-                // necessary), if possible.
-                const auto& qr = cq->getQueryRequest();
-                auto viewAggregationCommand = uassertStatusOK(qr.asAggregationCommand());
+            // A simple _id point query can pick the idhack plan directly off the QueryRequest,
+            // skipping the work of creating a CanonicalQuery and consulting the planner. 'exec'
+            // stays null if the query is not eligible and is created by the regular path below.
+            std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> exec;
+            if (!ctx->getView()) {
+                exec = attemptToGetIdHackExecutor(opCtx, ctx->getCollection(), nss, *qr);
+            }
 
-                BSONObj aggResult = CommandHelpers::runCommandDirectly(
-                    opCtx, OpMsgRequest::fromDBAndBody(_dbName, std::move(viewAggregationCommand)));
-                auto status = getStatusFromCommandResult(aggResult);
-                if (status.code() == ErrorCodes::InvalidPipelineOperator) {
-                    uasserted(ErrorCodes::InvalidPipelineOperator,
-                              str::stream() << "Unsupported in view pipeline: " << status.reason());
+            if (exec) {
+                if (qr->isReadOnce()) {
+                    // The readOnce option causes any storage-layer cursors created during plan
+                    // execution to assume read data will not be needed again and need not be
+                    // cached.
+                    opCtx->recoveryUnit()->setReadOnce(true);
+                }
+            } else {
+                // Finish the parsing step by using the QueryRequest to create a CanonicalQuery.
+                const ExtensionsCallbackReal extensionsCallback(opCtx, &nss);
+                const boost::intrusive_ptr<ExpressionContext> expCtx;
+                auto cq = uassertStatusOK(
+                    CanonicalQuery::canonicalize(opCtx,
+                                                 std::move(qr),
+                                                 expCtx,
+                                                 extensionsCallback,
+                                                 MatchExpressionParser::kAllowAllSpecialFeatures));
+
+                if (ctx->getView()) {
+                    // Relinquish locks. The aggregation command will re-acquire them.
+                    ctx.reset();
+
+                    // Convert the find command into an aggregation using $match (and other
+                    // stages, as necessary), if possible.
+                    const auto& qr = cq->getQueryRequest();
+                    auto viewAggregationCommand = uassertStatusOK(qr.asAggregationCommand());
+
+                    BSONObj aggResult = CommandHelpers::runCommandDirectly(
+                        opCtx,
+                        OpMsgRequest::fromDBAndBody(_dbName, std::move(viewAggregationCommand)));
+                    auto status = getStatusFromCommandResult(aggResult);
+                    if (status.code() == ErrorCodes::InvalidPipelineOperator) {
+                        uasserted(ErrorCodes::InvalidPipelineOperator,
+                                  str::stream() << "Unsupported in view pipeline: "
+                                                << status.reason());
+                    }
+                    uassertStatusOK(status);
+                    result->getBodyBuilder().appendElements(aggResult);
+                    return;
                 }
-                uassertStatusOK(status);
-                result->getBodyBuilder().appendElements(aggResult);
-                return;
-            }
 
-            Collection* const collection = ctx->getCollection();
+                if (cq->getQueryRequest().isReadOnce()) {
+                    // The readOnce option causes any storage-layer cursors created during plan
+                    // execution to assume read data will not be needed again and need not be
+                    // cached.
+                    opCtx->recoveryUnit()->setReadOnce(true);
+                }
 
-            if (cq->getQueryRequest().isReadOnce()) {
-                // The readOnce option causes any storage-layer cursors created during plan
-                // execution to assume read data will not be needed again and need not be cached.
-                opCtx->recoveryUnit()->setReadOnce(true);
+                // Get the execution plan for the query.
+                exec = uassertStatusOK(
+                    getExecutorFind(opCtx, ctx->getCollection(), nss, std::move(cq)));
             }
 
-            // Get the execution plan for the query.
-            auto exec = uassertStatusOK(getExecutorFind(opCtx, collection, nss, std::move(cq)));
+            Collection* const collection = ctx->getCollection();
 
             {
                 stdx::lock_guard<Client> lk(*opCtx->getClient());
@@ -345,7 +366,10 @@ public:
             CurOpFailpointHelpers::waitWhileFailPointEnabled(
                 &waitInFindBeforeMakingBatch, opCtx, "waitInFindBeforeMakingBatch");
 
-            const QueryRequest& originalQR = exec->getCanonicalQuery()->getQueryRequest();
+            // When the idhack fast path was taken, the executor has no CanonicalQuery and the
+            // parsed request is still owned by 'qr'.
+            const QueryRequest& originalQR =
+                exec->getCanonicalQuery() ? exec->getCanonicalQuery()->getQueryRequest() : *qr;
 
             // Stream query results, adding them to a BSONArray as we go.
             CursorResponseBuilder::Options options;
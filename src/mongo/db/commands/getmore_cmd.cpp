@@ -59,6 +59,7 @@
 #include "mongo/db/service_context.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/db/stats/top.h"
+#include "mongo/rpc/protocol.h"
 #include "mongo/s/chunk_version.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/fail_point_service.h"
@@ -217,6 +218,17 @@ public:
                              std::uint64_t* numResults) {
             PlanExecutor* exec = cursor->getExecutor();
 
+            // Byte budget for this batch. When adaptive batch sizing is enabled and we have seen
+            // how fast the client drained the previous batch, aim for the configured drain time
+            // instead of always filling up to the response cap. The first batch of a cursor has
+            // no history and uses the full budget.
+            int batchByteLimit = FindCommon::kMaxBytesToReturnToClientAtOnce;
+            if (FindCommon::adaptiveBatchSizeEnabled() && cursor->getLastBatchBytes() > 0) {
+                const auto now = opCtx->getServiceContext()->getPreciseClockSource()->now();
+                batchByteLimit = FindCommon::adaptiveBatchByteTarget(
+                    cursor->getLastBatchBytes(), now - cursor->getLastBatchReturnedAt());
+            }
+
             // If an awaitData getMore is killed during this process due to our max time expiring at
             // an interrupt point, we just continue as normal and return rather than reporting a
             // timeout to the user.
@@ -226,7 +238,8 @@ public:
                        PlanExecutor::ADVANCED == (*state = exec->getNext(&obj, NULL))) {
                     // If adding this object will cause us to exceed the message size limit, then we
                     // stash it for later.
-                    if (!FindCommon::haveSpaceForNext(obj, *numResults, nextBatch->bytesUsed())) {
+                    if (!FindCommon::haveSpaceForNext(
+                            obj, *numResults, nextBatch->bytesUsed(), batchByteLimit)) {
                         exec->enqueue(obj);
                         break;
                     }
@@ -457,7 +470,15 @@ public:
 
             CursorId respondWithId = 0;
 
-            CursorResponseBuilder nextBatch(reply, CursorResponseBuilder::Options());
+            // When the client has advertised that it can consume document sequences and the
+            // request arrived as OP_MSG, emit the batch as a 'cursor.nextBatch' document
+            // sequence. The documents land in the reply message once, without the array-index
+            // field names and extra copy that building a BSON array in the body costs.
+            CursorResponseBuilder::Options options;
+            options.isInitialResponse = false;
+            options.useDocumentSequences = _request.allowDocumentSequences &&
+                reply->getProtocol() == rpc::Protocol::kOpMsg;
+            CursorResponseBuilder nextBatch(reply, options);
             BSONObj obj;
             PlanExecutor::ExecState state = PlanExecutor::ADVANCED;
             std::uint64_t numResults = 0;
@@ -517,6 +538,9 @@ public:
                 cursor->setLeftoverMaxTimeMicros(opCtx->getRemainingMaxTimeMicros());
                 cursor->incNReturnedSoFar(numResults);
                 cursor->incNBatches();
+                cursor->setLastBatchInfo(
+                    nextBatch.bytesUsed(),
+                    opCtx->getServiceContext()->getPreciseClockSource()->now());
             } else {
                 curOp->debug().cursorExhausted = true;
             }
@@ -41,6 +41,7 @@
 #include "mongo/db/db_raii.h"
 #include "mongo/db/query/internal_plans.h"
 #include "mongo/db/storage/record_store.h"
+#include "mongo/db/storage/storage_engine.h"
 #include "mongo/util/fail_point_service.h"
 #include "mongo/util/log.h"
 #include "mongo/util/scopeguard.h"
@@ -78,7 +79,10 @@ public:
                "Slow.\n"
                "Add full:true option to do a more thorough check\n"
                "Add scandata:false to skip the scan of the collection data without skipping scans "
-               "of any indexes";
+               "of any indexes\n"
+               "Add background:true to validate from a single storage snapshot without blocking "
+               "writes. Incompatible with full:true. The scan rate can be bounded with the "
+               "maxValidateMBperSec server parameter";
     }
 
     virtual bool supportsWriteConcern(const BSONObj& cmd) const override {
@@ -91,7 +95,8 @@ public:
         actions.addAction(ActionType::validate);
         out->push_back(Privilege(parseResourcePattern(dbname, cmdObj), actions));
     }
-    //{ validate: "collectionnamewithoutthedbpart" [, scandata: <bool>] [, full: <bool> } */
+    //{ validate: "collectionnamewithoutthedbpart" [, scandata: <bool>] [, full: <bool>]
+    //  [, background: <bool>] } */
 
     bool run(OperationContext* opCtx,
              const string& dbname,
@@ -106,6 +111,24 @@ public:
 
         const bool full = cmdObj["full"].trueValue();
         const bool scanData = cmdObj["scandata"].trueValue();
+        const bool background = cmdObj["background"].trueValue();
+
+        // Full validation requires exclusive access to the underlying tables, so it cannot run
+        // against a snapshot while writes are accepted.
+        if (background && full) {
+            uasserted(ErrorCodes::CommandFailed,
+                      "Running the validate command with both { background: true } and "
+                      "{ full: true } is not supported");
+        }
+
+        // Background validation reads the collection and its indexes from a single storage
+        // snapshot, which requires a storage engine with document-level concurrency control.
+        if (background &&
+            !opCtx->getServiceContext()->getStorageEngine()->supportsDocLocking()) {
+            uasserted(ErrorCodes::CommandFailed,
+                      "Running the validate command with { background: true } is not supported "
+                      "by the configured storage engine");
+        }
 
         ValidateCmdLevel level = kValidateIndex;
 
@@ -124,8 +147,12 @@ public:
             LOG(0) << "CMD: validate " << nss.ns();
         }
 
+        // A background validation must not block writes, so it only takes an intent lock on the
+        // collection and relies on the storage engine snapshot for a consistent view of the
+        // record store and indexes.
         AutoGetDb ctx(opCtx, nss.db(), MODE_IX);
-        auto collLk = stdx::make_unique<Lock::CollectionLock>(opCtx->lockState(), nss.ns(), MODE_X);
+        auto collLk = stdx::make_unique<Lock::CollectionLock>(
+            opCtx->lockState(), nss.ns(), background ? MODE_IS : MODE_X);
         Collection* collection = ctx.getDb() ? ctx.getDb()->getCollection(opCtx, nss) : NULL;
         if (!collection) {
             if (ctx.getDb() && ctx.getDb()->getViewCatalog()->lookup(opCtx, nss.ns())) {
@@ -161,9 +188,6 @@ public:
             _validationNotifier.notify_all();
         });
 
-        // TODO SERVER-30357: Add support for background validation.
-        const bool background = false;
-
         ValidateResults results;
         Status status =
             collection->validate(opCtx, level, background, std::move(collLk), &results, &result);
@@ -0,0 +1,106 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/committed_statement_map.h"
+
+#include <cstdint>
+
+namespace mongo {
+
+boost::optional<repl::OpTime> CommittedStatementMap::insert(StmtId stmtId,
+                                                            const repl::OpTime& opTime) {
+    auto next = _ranges.upper_bound(stmtId);
+    auto prev = (next == _ranges.begin()) ? _ranges.end() : std::prev(next);
+
+    if (prev != _ranges.end() && stmtId <= prev->second.lastStmtId) {
+        return _opTimes[prev->second.opTimeIndex];
+    }
+
+    const auto opTimeIndex = _opTimeIndexFor(opTime);
+
+    // Widen to int64 so that adjacency checks cannot overflow at the extremes of StmtId.
+    const bool extendsPrev = prev != _ranges.end() && prev->second.opTimeIndex == opTimeIndex &&
+        static_cast<int64_t>(prev->second.lastStmtId) + 1 == stmtId;
+    const bool extendsNext = next != _ranges.end() && next->second.opTimeIndex == opTimeIndex &&
+        static_cast<int64_t>(stmtId) + 1 == next->first;
+
+    if (extendsPrev && extendsNext) {
+        prev->second.lastStmtId = next->second.lastStmtId;
+        _ranges.erase(next);
+    } else if (extendsPrev) {
+        prev->second.lastStmtId = stmtId;
+    } else if (extendsNext) {
+        const auto range = next->second;
+        _ranges.erase(next);
+        _ranges.emplace(stmtId, range);
+    } else {
+        _ranges.emplace(stmtId, Range{stmtId, opTimeIndex});
+    }
+
+    return boost::none;
+}
+
+boost::optional<repl::OpTime> CommittedStatementMap::find(StmtId stmtId) const {
+    const auto it = _findRange(stmtId);
+    if (it == _ranges.end()) {
+        return boost::none;
+    }
+
+    return _opTimes[it->second.opTimeIndex];
+}
+
+void CommittedStatementMap::clear() {
+    _ranges.clear();
+    _opTimes.clear();
+}
+
+CommittedStatementMap::RangeMap::const_iterator CommittedStatementMap::_findRange(
+    StmtId stmtId) const {
+    auto next = _ranges.upper_bound(stmtId);
+    if (next == _ranges.begin()) {
+        return _ranges.end();
+    }
+
+    const auto prev = std::prev(next);
+    return (stmtId <= prev->second.lastStmtId) ? prev : _ranges.end();
+}
+
+size_t CommittedStatementMap::_opTimeIndexFor(const repl::OpTime& opTime) {
+    // Statements are recorded in batches which share the opTime of their oplog entry, so the
+    // opTime being recorded is almost always the most recently appended one.
+    if (_opTimes.empty() || _opTimes.back() != opTime) {
+        _opTimes.push_back(opTime);
+    }
+
+    return _opTimes.size() - 1;
+}
+
+}  // namespace mongo
@@ -0,0 +1,109 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional.hpp>
+#include <map>
+#include <vector>
+
+#include "mongo/db/logical_session_id.h"
+#include "mongo/db/repl/optime.h"
+
+namespace mongo {
+
+/**
+ * Compact index over the statement ids executed under a session's active transaction number,
+ * recording for each statement id the opTime of the oplog entry which executed it.
+ *
+ * Bulk retryable writes commit long runs of consecutive statement ids which all share the opTime
+ * of a single oplog chain link. Rather than holding one hash map node per statement, the index
+ * run-length encodes each maximal range of consecutive statement ids with the same opTime as a
+ * single entry, so a batch of N consecutive statements costs one range and one shared opTime
+ * instead of N map nodes. Sparse statement ids degenerate to one range each, which is no worse
+ * than the per-statement representation this replaces.
+ *
+ * Not thread-safe; the owning TransactionParticipant synchronizes access.
+ */
+class CommittedStatementMap {
+public:
+    /**
+     * Records that 'stmtId' was executed by the write that committed at 'opTime'. If the
+     * statement id is already present the index is left unchanged and the previously recorded
+     * opTime is returned; callers treat that as an illegal repeated execution.
+     */
+    boost::optional<repl::OpTime> insert(StmtId stmtId, const repl::OpTime& opTime);
+
+    /**
+     * Returns the opTime of the write which executed 'stmtId', or boost::none if the statement
+     * id is not present.
+     */
+    boost::optional<repl::OpTime> find(StmtId stmtId) const;
+
+    void clear();
+
+    bool empty() const {
+        return _ranges.empty();
+    }
+
+    /**
+     * Number of run-length encoded ranges currently held. Exposed for testing.
+     */
+    size_t numRanges() const {
+        return _ranges.size();
+    }
+
+private:
+    struct Range {
+        StmtId lastStmtId;
+        size_t opTimeIndex;
+    };
+
+    using RangeMap = std::map<StmtId, Range>;
+
+    /**
+     * Returns an iterator to the range containing 'stmtId', or _ranges.end().
+     */
+    RangeMap::const_iterator _findRange(StmtId stmtId) const;
+
+    /**
+     * Returns the index into _opTimes to use for 'opTime', appending it if it is not the most
+     * recently recorded one.
+     */
+    size_t _opTimeIndexFor(const repl::OpTime& opTime);
+
+    // Distinct opTimes in the order they were recorded. Ranges reference entries by index so
+    // that the statements of a multi-statement batch store their shared opTime once.
+    std::vector<repl::OpTime> _opTimes;
+
+    // Maps the first statement id of each range to its inclusive end and opTime.
+    RangeMap _ranges;
+};
+
+}  // namespace mongo
@@ -0,0 +1,145 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/committed_statement_map.h"
+
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+repl::OpTime makeOpTime(unsigned secs) {
+    return repl::OpTime(Timestamp(secs, 0), 1);
+}
+
+TEST(CommittedStatementMapTest, EmptyMapFindsNothing) {
+    CommittedStatementMap map;
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.find(0));
+    ASSERT_EQ(0U, map.numRanges());
+}
+
+TEST(CommittedStatementMapTest, ConsecutiveStatementsWithSharedOpTimeCoalesce) {
+    CommittedStatementMap map;
+    const auto opTime = makeOpTime(10);
+
+    for (StmtId stmtId = 0; stmtId < 100; ++stmtId) {
+        ASSERT_FALSE(map.insert(stmtId, opTime));
+    }
+
+    ASSERT_EQ(1U, map.numRanges());
+    for (StmtId stmtId = 0; stmtId < 100; ++stmtId) {
+        const auto found = map.find(stmtId);
+        ASSERT_TRUE(found);
+        ASSERT_EQ(opTime, *found);
+    }
+    ASSERT_FALSE(map.find(-1));
+    ASSERT_FALSE(map.find(100));
+}
+
+TEST(CommittedStatementMapTest, ReverseInsertionOrderCoalesces) {
+    CommittedStatementMap map;
+    const auto opTime = makeOpTime(10);
+
+    for (StmtId stmtId = 99; stmtId >= 0; --stmtId) {
+        ASSERT_FALSE(map.insert(stmtId, opTime));
+    }
+
+    ASSERT_EQ(1U, map.numRanges());
+    ASSERT_TRUE(map.find(0));
+    ASSERT_TRUE(map.find(99));
+}
+
+TEST(CommittedStatementMapTest, ConsecutiveStatementsWithDistinctOpTimesDoNotCoalesce) {
+    CommittedStatementMap map;
+
+    ASSERT_FALSE(map.insert(0, makeOpTime(10)));
+    ASSERT_FALSE(map.insert(1, makeOpTime(20)));
+
+    ASSERT_EQ(2U, map.numRanges());
+    ASSERT_EQ(makeOpTime(10), *map.find(0));
+    ASSERT_EQ(makeOpTime(20), *map.find(1));
+}
+
+TEST(CommittedStatementMapTest, FillingGapMergesAdjacentRanges) {
+    CommittedStatementMap map;
+    const auto opTime = makeOpTime(10);
+
+    ASSERT_FALSE(map.insert(0, opTime));
+    ASSERT_FALSE(map.insert(2, opTime));
+    ASSERT_EQ(2U, map.numRanges());
+
+    ASSERT_FALSE(map.insert(1, opTime));
+    ASSERT_EQ(1U, map.numRanges());
+    ASSERT_TRUE(map.find(0));
+    ASSERT_TRUE(map.find(1));
+    ASSERT_TRUE(map.find(2));
+}
+
+TEST(CommittedStatementMapTest, DuplicateInsertReturnsExistingOpTime) {
+    CommittedStatementMap map;
+
+    ASSERT_FALSE(map.insert(3, makeOpTime(10)));
+
+    const auto existing = map.insert(3, makeOpTime(20));
+    ASSERT_TRUE(existing);
+    ASSERT_EQ(makeOpTime(10), *existing);
+    ASSERT_EQ(makeOpTime(10), *map.find(3));
+}
+
+TEST(CommittedStatementMapTest, SparseStatementIdsAreTracked) {
+    CommittedStatementMap map;
+
+    ASSERT_FALSE(map.insert(5, makeOpTime(10)));
+    ASSERT_FALSE(map.insert(1000, makeOpTime(10)));
+    ASSERT_FALSE(map.insert(-7, makeOpTime(20)));
+
+    ASSERT_EQ(3U, map.numRanges());
+    ASSERT_EQ(makeOpTime(10), *map.find(5));
+    ASSERT_EQ(makeOpTime(10), *map.find(1000));
+    ASSERT_EQ(makeOpTime(20), *map.find(-7));
+    ASSERT_FALSE(map.find(6));
+    ASSERT_FALSE(map.find(999));
+}
+
+TEST(CommittedStatementMapTest, ClearEmptiesTheMap) {
+    CommittedStatementMap map;
+
+    ASSERT_FALSE(map.insert(0, makeOpTime(10)));
+    ASSERT_FALSE(map.empty());
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.find(0));
+}
+
+}  // namespace
+}  // namespace mongo
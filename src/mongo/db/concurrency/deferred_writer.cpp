@@ -94,14 +94,12 @@ StatusWith<std::unique_ptr<AutoGetCollection>> DeferredWriter::_getCollection(
     return std::move(agc);
 }
 
-void DeferredWriter::_worker(InsertStatement stmt) {
-    auto uniqueOpCtx = Client::getCurrent()->makeOperationContext();
-    OperationContext* opCtx = uniqueOpCtx.get();
+Status DeferredWriter::_write(OperationContext* opCtx,
+                              const std::vector<InsertStatement>& batch) {
     auto result = _getCollection(opCtx);
 
     if (!result.isOK()) {
-        _logFailure(result.getStatus());
-        return;
+        return result.getStatus();
     }
 
     auto agc = std::move(result.getValue());
@@ -110,7 +108,8 @@ void DeferredWriter::_worker(InsertStatement stmt) {
 
     Status status = writeConflictRetry(opCtx, "deferred insert", _nss.ns(), [&] {
         WriteUnitOfWork wuow(opCtx);
-        Status status = collection.insertDocument(opCtx, stmt, nullptr, false);
+        Status status =
+            collection.insertDocuments(opCtx, batch.begin(), batch.end(), nullptr, false);
         if (!status.isOK()) {
             return status;
         }
@@ -119,13 +118,63 @@ void DeferredWriter::_worker(InsertStatement stmt) {
         return Status::OK();
     });
 
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
+    if (status.isOK()) {
+        return status;
+    }
 
-    _numBytes -= stmt.doc.objsize();
+    // The batched insert failed for a reason other than a write conflict; per the contract of
+    // Collection::insertDocuments, retry the documents one at a time so that a single bad
+    // document doesn't discard the rest of the batch.  Remember the first failure for logging.
+    Status firstFailure = Status::OK();
+    for (auto&& stmt : batch) {
+        Status status = writeConflictRetry(opCtx, "deferred insert", _nss.ns(), [&] {
+            WriteUnitOfWork wuow(opCtx);
+            Status status = collection.insertDocument(opCtx, stmt, nullptr, false);
+            if (!status.isOK()) {
+                return status;
+            }
+
+            wuow.commit();
+            return Status::OK();
+        });
+        if (!status.isOK() && firstFailure.isOK()) {
+            firstFailure = status;
+        }
+    }
+    return firstFailure;
+}
+
+void DeferredWriter::_worker(void) {
+    auto uniqueOpCtx = Client::getCurrent()->makeOperationContext();
+    OperationContext* opCtx = uniqueOpCtx.get();
 
-    // If a write to a deferred collection fails, periodically tell the log.
-    if (!status.isOK()) {
-        _logFailure(status);
+    while (true) {
+        std::vector<InsertStatement> batch;
+        {
+            stdx::lock_guard<stdx::mutex> lock(_mutex);
+            if (_buffer.empty()) {
+                // Nothing left to write; the next insert will schedule a new task.
+                _workerScheduled = false;
+                return;
+            }
+            batch.swap(_buffer);
+        }
+
+        int64_t batchBytes = 0;
+        for (auto&& stmt : batch) {
+            batchBytes += stmt.doc.objsize();
+        }
+
+        Status status = _write(opCtx, batch);
+
+        stdx::lock_guard<stdx::mutex> lock(_mutex);
+
+        _numBytes -= batchBytes;
+
+        // If a write to a deferred collection fails, periodically tell the log.
+        if (!status.isOK()) {
+            _logFailure(status);
+        }
     }
 }
 
@@ -133,6 +182,7 @@ DeferredWriter::DeferredWriter(NamespaceString nss, CollectionOptions opts, int6
     : _collectionOptions(opts),
       _maxNumBytes(maxSize),
       _nss(nss),
+      _workerScheduled(false),
       _numBytes(0),
       _droppedEntries(0),
       _lastLogged(TimePoint::clock::now() - kLogInterval) {}
@@ -177,9 +227,15 @@ bool DeferredWriter::insertDocument(BSONObj obj) {
         return false;
     }
 
-    // Add the object to the buffer.
+    // Add the object to the buffer.  A single worker task drains the whole buffer in batches,
+    // amortizing the collection acquisition and WriteUnitOfWork over many documents; only
+    // schedule a new task if one isn't already pending.
     _numBytes += obj.objsize();
-    fassert(40588, _pool->schedule([this, obj] { _worker(InsertStatement(obj.getOwned())); }));
+    _buffer.push_back(InsertStatement(obj.getOwned()));
+    if (!_workerScheduled) {
+        fassert(40588, _pool->schedule([this] { _worker(); }));
+        _workerScheduled = true;
+    }
     return true;
 }
 
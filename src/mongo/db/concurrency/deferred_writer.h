@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
@@ -133,10 +135,21 @@ private:
      */
     StatusWith<std::unique_ptr<AutoGetCollection>> _getCollection(OperationContext* opCtx);
 
+    /**
+     * Write a batch of buffered documents to the backing collection.
+     *
+     * Attempts one batched insert for the whole vector; if that fails, retries the documents
+     * individually so that one bad document doesn't discard the rest of the batch.
+     */
+    Status _write(OperationContext* opCtx, const std::vector<InsertStatement>& batch);
+
     /**
      * The method that the worker thread will run.
+     *
+     * Repeatedly drains the buffer, writing each drained batch in a single collection
+     * acquisition, until the buffer is observed empty.
      */
-    void _worker(InsertStatement stmt);
+    void _worker(void);
 
     /**
      * The options for the collection, in case we need to create it.
@@ -160,6 +173,19 @@ private:
      */
     stdx::mutex _mutex;
 
+    /**
+     * The documents waiting to be written, in insertion order.
+     */
+    std::vector<InsertStatement> _buffer;
+
+    /**
+     * Whether a worker task is currently scheduled to drain the buffer.
+     *
+     * At most one such task exists at a time; inserts while one is scheduled simply append to
+     * the buffer and get picked up by that task's next drain pass.
+     */
+    bool _workerScheduled;
+
     /**
      * The number of bytes currently in the in-memory buffer.
      */
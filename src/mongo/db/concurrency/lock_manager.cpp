@@ -41,10 +41,13 @@
 #include "mongo/base/static_assert.h"
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/config.h"
+#include <algorithm>
+
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/locker.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/log.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/stringutils.h"
 #include "mongo/util/timer.h"
 
@@ -158,6 +161,8 @@ struct LockHead {
 
         conversionsCount = 0;
         compatibleFirstCount = 0;
+
+        partitions.clear();
     }
 
     /**
@@ -409,14 +414,42 @@ void LockHead::migratePartitionedLockHeads() {
 // LockManager
 //
 
-// Have more buckets than CPUs to reduce contention on lock and caches
-const unsigned LockManager::_numLockBuckets(128);
+namespace {
+
+// Maximum number of retired LockHeads a bucket keeps for reuse. Small enough that an idle
+// system holds onto little memory, large enough to absorb the steady acquire/release churn of
+// short-lived resources that hash to the same bucket.
+const size_t kMaxFreeListSize = 32;
+
+// Round up to the next power of two so the bucket and partition lookups stay cheap modulo
+// operations over a well-distributed space.
+unsigned nextPowerOfTwo(unsigned value) {
+    unsigned result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+// Have more buckets than CPUs to reduce contention on lock and caches. The historical fixed
+// count of 128 is kept as a floor, but on machines with many cores the stripes are scaled with
+// the hardware so the per-bucket mutexes don't become the bottleneck they are sized to avoid.
+unsigned numLockBuckets() {
+    return nextPowerOfTwo(
+        std::max(128U, static_cast<unsigned>(ProcessInfo::getNumAvailableCores()) * 4));
+}
 
-// Balance scalability of intent locks against potential added cost of conflicting locks.
-// The exact value doesn't appear very important, but should be power of two
-const unsigned LockManager::_numPartitions = 32;
+// Balance scalability of intent locks against potential added cost of conflicting locks. The
+// exact value doesn't appear very important, but should be power of two.
+unsigned numPartitions() {
+    return nextPowerOfTwo(
+        std::max(32U, static_cast<unsigned>(ProcessInfo::getNumAvailableCores())));
+}
 
-LockManager::LockManager() {
+}  // namespace
+
+LockManager::LockManager()
+    : _numLockBuckets(numLockBuckets()), _numPartitions(numPartitions()) {
     _lockBuckets = new LockBucket[_numLockBuckets];
     _partitions = new Partition[_numPartitions];
 }
@@ -427,6 +460,10 @@ LockManager::~LockManager() {
     for (unsigned i = 0; i < _numLockBuckets; i++) {
         // TODO: dump more information about the non-empty bucket to see what locks were leaked
         invariant(_lockBuckets[i].data.empty());
+
+        for (LockHead* lock : _lockBuckets[i].freeList) {
+            delete lock;
+        }
     }
 
     delete[] _lockBuckets;
@@ -690,7 +727,11 @@ void LockManager::_cleanupUnusedLocksInBucket(LockBucket* bucket) {
 
             bucket->data.erase(it++);
             deletedLockHeads++;
-            delete lock;
+            if (bucket->freeList.size() < kMaxFreeListSize) {
+                bucket->freeList.push_back(lock);
+            } else {
+                delete lock;
+            }
         } else {
             it++;
         }
@@ -961,7 +1002,12 @@ LockHead* LockManager::LockBucket::findOrInsert(ResourceId resId) {
     LockHead* lock;
     Map::iterator it = data.find(resId);
     if (it == data.end()) {
-        lock = new LockHead();
+        if (!freeList.empty()) {
+            lock = freeList.back();
+            freeList.pop_back();
+        } else {
+            lock = new LockHead();
+        }
         lock->initNew(resId);
 
         data.insert(Map::value_type(resId, lock));
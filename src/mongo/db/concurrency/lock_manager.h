@@ -144,6 +144,11 @@ private:
         typedef stdx::unordered_map<ResourceId, LockHead*> Map;
         Map data;
         LockHead* findOrInsert(ResourceId resId);
+
+        // Recently retired LockHeads, kept around (up to a small cap) so the frequent
+        // acquire/release cycle on short-lived resources does not hit the heap every time.
+        // Protected by 'mutex' like the map itself.
+        std::vector<LockHead*> freeList;
     };
 
     // Each locker maps to a partition that is used for resources acquired in intent modes
@@ -210,10 +215,10 @@ private:
      */
     void _cleanupUnusedLocksInBucket(LockBucket* bucket);
 
-    static const unsigned _numLockBuckets;
+    const unsigned _numLockBuckets;
     LockBucket* _lockBuckets;
 
-    static const unsigned _numPartitions;
+    const unsigned _numPartitions;
     Partition* _partitions;
 };
 }  // namespace mongo
@@ -36,6 +36,7 @@
 #include <vector>
 
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/db/service_context.h"
 #include "mongo/platform/compiler.h"
 #include "mongo/stdx/new.h"
@@ -238,6 +239,23 @@ void CondVarLockGrantNotification::notify(ResourceId resId, LockResult result) {
 
 namespace {
 TicketHolder* ticketHolders[LockModesCount] = {};
+
+// The maximum number of low-priority operations that may compete for global lock tickets at once.
+// Operations past the cap queue in the backlog lane until a slot frees up or the starvation
+// timeout elapses.
+MONGO_EXPORT_STARTUP_SERVER_PARAMETER(lowPriorityAdmissionConcurrency, int, 8);
+
+// How long (in millis) a low-priority operation waits in the backlog lane before it is promoted
+// and allowed to compete for a ticket directly. Prevents a saturated lane from starving
+// maintenance work indefinitely.
+MONGO_EXPORT_SERVER_PARAMETER(lowPriorityAdmissionStarvationTimeoutMs, int, 500);
+
+// The admission gate for the low-priority lane. Constructed on first use so the startup server
+// parameter has been set by then.
+TicketHolder& lowPriorityAdmissionGate() {
+    static TicketHolder gate(std::max(1, lowPriorityAdmissionConcurrency));
+    return gate;
+}
 }  // namespace
 
 
@@ -338,6 +356,22 @@ LockResult LockerImpl::_acquireTicket(OperationContext* opCtx, LockMode mode, Da
         auto restoreStateOnErrorGuard = makeGuard([&] { _clientState.store(kInactive); });
 
         OperationContext* interruptible = _uninterruptibleLocksRequested ? nullptr : opCtx;
+
+        // Low-priority operations are admitted through a capped backlog lane before they may
+        // compete for a ticket, so bulk maintenance cannot crowd out user traffic. The lane slot
+        // is held across the ticket wait and released on every exit from this function. An
+        // operation that cannot enter the lane within the starvation timeout is promoted and
+        // proceeds directly to the ticket wait.
+        TicketHolderReleaser lowPriorityLane;
+        if (interruptible && interruptible->getAdmissionPriority() == AdmissionPriority::kLow) {
+            auto& gate = lowPriorityAdmissionGate();
+            const Date_t promoteAfter =
+                Date_t::now() + Milliseconds(lowPriorityAdmissionStarvationTimeoutMs.load());
+            if (gate.waitForTicketUntil(interruptible, std::min(deadline, promoteAfter))) {
+                lowPriorityLane.reset(&gate);
+            }
+        }
+
         if (deadline == Date_t::max()) {
             holder->waitForTicket(interruptible);
         } else if (!holder->waitForTicketUntil(interruptible, deadline)) {
@@ -32,14 +32,33 @@
 
 #define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kWrite
 
+#include <algorithm>
+
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/server_parameters.h"
+#include "mongo/platform/random.h"
+#include "mongo/util/counter.h"
 #include "mongo/util/log.h"
-#include "mongo/util/log_and_backoff.h"
 #include "mongo/util/stacktrace.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
+namespace {
+
+// Total write conflict retries across all operations, and the total time spent backing off
+// between them. Together with the per-operation writeConflicts figure in the profiler these
+// make conflict storms visible in serverStatus instead of only in debug-level logs.
+Counter64 writeConflictRetries;
+Counter64 writeConflictBackoffMicros;
+ServerStatusMetricField<Counter64> displayWriteConflictRetries("operation.writeConflictRetries",
+                                                               &writeConflictRetries);
+ServerStatusMetricField<Counter64> displayWriteConflictBackoffMicros(
+    "operation.writeConflictBackoffMicros", &writeConflictBackoffMicros);
+
+}  // namespace
+
 AtomicWord<bool> WriteConflictException::trace(false);
 
 WriteConflictException::WriteConflictException()
@@ -50,11 +69,27 @@ WriteConflictException::WriteConflictException()
 }
 
 void WriteConflictException::logAndBackoff(int attempt, StringData operation, StringData ns) {
-    mongo::logAndBackoff(
-        ::mongo::logger::LogComponent::kWrite,
-        logger::LogSeverity::Debug(1),
-        static_cast<size_t>(attempt),
-        str::stream() << "Caught WriteConflictException doing " << operation << " on " << ns);
+    writeConflictRetries.increment();
+    LOG(1) << "Caught WriteConflictException doing " << operation << " on " << ns
+           << ". Retrying, attempt: " << attempt;
+
+    // The first few retries are free: most conflicts resolve on an immediate retry and sleeping
+    // would only add latency. After that, back off with full jitter so writers contending on the
+    // same document spread out instead of retrying in lockstep; the previous fixed sleep ladder
+    // kept colliding writers synchronized. The ceiling doubles per attempt and is capped so a
+    // sustained storm cannot park an operation for more than ~100ms per attempt.
+    if (attempt < 4) {
+        return;
+    }
+    static constexpr int64_t kMaxBackoffMicros = 100 * 1000;
+    const int shift = std::min(attempt - 4, 20);
+    const int64_t ceilingMicros = std::min(int64_t(100) << shift, kMaxBackoffMicros);
+    thread_local PseudoRandom backoffRandom(SecureRandom::create()->nextInt64());
+    const int64_t backoffMicros = backoffRandom.nextInt64(ceilingMicros + 1);
+    if (backoffMicros > 0) {
+        writeConflictBackoffMicros.increment(backoffMicros);
+        sleepmicros(backoffMicros);
+    }
 }
 namespace {
 // for WriteConflictException
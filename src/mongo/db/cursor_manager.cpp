@@ -443,7 +443,7 @@ void CursorManager::invalidateAll(OperationContext* opCtx,
 
                 // If there's an operation actively using the cursor, then that operation is now
                 // responsible for cleaning it up.  Otherwise we can immediately dispose of it.
-                if (cursor->_operationUsingCursor) {
+                if (cursor->_pinState.load() != ClientCursor::kIdle) {
                     partition.erase(it++);
                     continue;
                 }
@@ -468,7 +468,7 @@ void CursorManager::invalidateAll(OperationContext* opCtx,
 }
 
 bool CursorManager::cursorShouldTimeout_inlock(const ClientCursor* cursor, Date_t now) {
-    if (cursor->isNoTimeout() || cursor->_operationUsingCursor) {
+    if (cursor->isNoTimeout() || cursor->_pinState.load() != ClientCursor::kIdle) {
         return false;
     }
     return (now - cursor->_lastUseDate) >= Milliseconds(getCursorTimeoutMillis());
@@ -502,33 +502,42 @@ std::size_t CursorManager::timeoutCursors(OperationContext* opCtx, Date_t now) {
 StatusWith<ClientCursorPin> CursorManager::pinCursor(OperationContext* opCtx,
                                                      CursorId id,
                                                      AuthCheck checkSessionAuth) {
-    auto lockedPartition = _cursorMap->lockOnePartition(id);
-    auto it = lockedPartition->find(id);
-    if (it == lockedPartition->end()) {
-        return {ErrorCodes::CursorNotFound, str::stream() << "cursor id " << id << " not found"};
-    }
+    ClientCursor* cursor;
+    {
+        auto lockedPartition = _cursorMap->lockOnePartition(id);
+        auto it = lockedPartition->find(id);
+        if (it == lockedPartition->end()) {
+            return {ErrorCodes::CursorNotFound,
+                    str::stream() << "cursor id " << id << " not found"};
+        }
 
-    ClientCursor* cursor = it->second;
-    uassert(ErrorCodes::CursorInUse,
-            str::stream() << "cursor id " << id << " is already in use",
-            !cursor->_operationUsingCursor);
-    if (cursor->getExecutor()->isMarkedAsKilled()) {
-        // This cursor was killed while it was idle.
-        Status error = cursor->getExecutor()->getKillStatus();
-        deregisterAndDestroyCursor(std::move(lockedPartition),
-                                   opCtx,
-                                   std::unique_ptr<ClientCursor, ClientCursor::Deleter>(cursor));
-        return error;
-    }
-
-    if (checkSessionAuth == kCheckSession) {
-        auto cursorPrivilegeStatus = checkCursorSessionPrivilege(opCtx, cursor->getSessionId());
-        if (!cursorPrivilegeStatus.isOK()) {
-            return cursorPrivilegeStatus;
+        cursor = it->second;
+        uassert(ErrorCodes::CursorInUse,
+                str::stream() << "cursor id " << id << " is already in use",
+                cursor->_pinState.compareAndSwap(ClientCursor::kIdle, ClientCursor::kPinned) ==
+                    ClientCursor::kIdle);
+        if (cursor->getExecutor()->isMarkedAsKilled()) {
+            // This cursor was killed while it was idle.
+            Status error = cursor->getExecutor()->getKillStatus();
+            deregisterAndDestroyCursor(
+                std::move(lockedPartition),
+                opCtx,
+                std::unique_ptr<ClientCursor, ClientCursor::Deleter>(cursor));
+            return error;
+        }
+
+        if (checkSessionAuth == kCheckSession) {
+            auto cursorPrivilegeStatus = checkCursorSessionPrivilege(opCtx, cursor->getSessionId());
+            if (!cursorPrivilegeStatus.isOK()) {
+                cursor->_pinState.store(ClientCursor::kIdle);
+                return cursorPrivilegeStatus;
+            }
         }
-    }
 
-    cursor->_operationUsingCursor = opCtx;
+        // Publish the pinning operation before releasing the partition lock, so that a killer
+        // holding the lock can find the operation it needs to interrupt.
+        cursor->_operationUsingCursor.store(opCtx);
+    }
 
     // We use pinning of a cursor as a proxy for active, user-initiated use of a cursor.  Therefore,
     // we pass down to the logical session cache and vivify the record (updating last use).
@@ -545,34 +554,44 @@ StatusWith<ClientCursorPin> CursorManager::pinCursor(OperationContext* opCtx,
 
 void CursorManager::unpin(OperationContext* opCtx,
                           std::unique_ptr<ClientCursor, ClientCursor::Deleter> cursor) {
-    // Avoid computing the current time within the critical section.
-    auto now = opCtx->getServiceContext()->getPreciseClockSource()->now();
-
-    auto partition = _cursorMap->lockOnePartition(cursor->cursorid());
-    invariant(cursor->_operationUsingCursor);
+    invariant(cursor->_operationUsingCursor.load() == opCtx);
 
     // We must verify that no interrupts have occurred since we finished building the current
     // batch. Otherwise, the cursor will be checked back in, the interrupted opCtx will be
     // destroyed, and subsequent getMores with a fresh opCtx will succeed.
-    auto interruptStatus = cursor->_operationUsingCursor->checkForInterruptNoAssert();
-    cursor->_operationUsingCursor = nullptr;
-    cursor->_lastUseDate = now;
+    auto interruptStatus = opCtx->checkForInterruptNoAssert();
+    cursor->_lastUseDate = opCtx->getServiceContext()->getPreciseClockSource()->now();
+    cursor->_operationUsingCursor.store(nullptr);
 
     // If someone was trying to kill this cursor with a killOp or a killCursors, they are likely
     // interesting in proactively cleaning up that cursor's resources. In these cases, we
     // proactively delete the cursor. In other cases we preserve the error code so that the client
     // will see the reason the cursor was killed when asking for the next batch.
-    if (interruptStatus == ErrorCodes::Interrupted || interruptStatus == ErrorCodes::CursorKilled) {
-        LOG(0) << "removing cursor " << cursor->cursorid()
-               << " after completing batch: " << interruptStatus;
-        return deregisterAndDestroyCursor(std::move(partition), opCtx, std::move(cursor));
-    } else if (!interruptStatus.isOK()) {
+    const bool proactivelyDelete = interruptStatus == ErrorCodes::Interrupted ||
+        interruptStatus == ErrorCodes::CursorKilled;
+    if (!proactivelyDelete && !interruptStatus.isOK()) {
         cursor->markAsKilled(interruptStatus);
     }
 
-    // The cursor will stay around in '_cursorMap', so release the unique pointer to avoid deleting
-    // it.
-    cursor.release();
+    if (!proactivelyDelete &&
+        cursor->_pinState.compareAndSwap(ClientCursor::kPinned, ClientCursor::kIdle) ==
+            ClientCursor::kPinned) {
+        // Common case: the cursor is checked back in without touching any mutex. It will stay
+        // around in '_cursorMap', so release the unique pointer to avoid deleting it.
+        cursor.release();
+        return;
+    }
+
+    // Either the current batch was interrupted, or a killer transitioned the cursor to
+    // kKillPending and caused the compare-and-swap above to fail. Taking the partition lock
+    // serializes us behind any killer that may still be dereferencing the operation, after which
+    // it is safe to dispose of the cursor.
+    auto partition = _cursorMap->lockOnePartition(cursor->cursorid());
+    if (proactivelyDelete) {
+        LOG(0) << "removing cursor " << cursor->cursorid()
+               << " after completing batch: " << interruptStatus;
+    }
+    deregisterAndDestroyCursor(std::move(partition), opCtx, std::move(cursor));
 }
 
 void CursorManager::appendActiveSessions(LogicalSessionIdSet* lsids) const {
@@ -602,7 +621,7 @@ void CursorManager::appendIdleCursors(AuthorizationSession* ctxAuth,
                 continue;
             }
             // Exclude pinned cursors.
-            if (cursor->_operationUsingCursor) {
+            if (cursor->_pinState.load() != ClientCursor::kIdle) {
                 continue;
             }
             cursors->emplace_back(cursor->toGenericCursor());
@@ -714,21 +733,37 @@ Status CursorManager::killCursor(OperationContext* opCtx, CursorId id, bool shou
     }
     auto cursor = it->second;
 
-    if (cursor->_operationUsingCursor) {
-        // Rather than removing the cursor directly, kill the operation that's currently using the
-        // cursor. It will stop on its own (and remove the cursor) when it sees that it's been
-        // interrupted.
-        {
-            stdx::unique_lock<Client> lk(*cursor->_operationUsingCursor->getClient());
-            cursor->_operationUsingCursor->getServiceContext()->killOperation(
-                cursor->_operationUsingCursor, ErrorCodes::CursorKilled);
+    // Rather than removing an actively-used cursor directly, kill the operation that's currently
+    // using the cursor. It will stop on its own (and remove the cursor) when it sees that it's
+    // been interrupted. Winning the transition to kKillPending entitles us to dereference
+    // '_operationUsingCursor' while we hold the partition lock, since the pinning operation
+    // cannot finish checking the cursor back in without first taking this partition's lock.
+    if (cursor->_pinState.compareAndSwap(ClientCursor::kPinned, ClientCursor::kKillPending) ==
+        ClientCursor::kPinned) {
+        // The operation may have already begun checking the cursor back in, in which case it has
+        // cleared '_operationUsingCursor' and will dispose of the cursor when it observes the
+        // kKillPending transition.
+        if (auto opUsingCursor = cursor->_operationUsingCursor.load()) {
+            stdx::unique_lock<Client> lk(*opUsingCursor->getClient());
+            opUsingCursor->getServiceContext()->killOperation(opUsingCursor,
+                                                              ErrorCodes::CursorKilled);
+        }
+
+        if (shouldAudit) {
+            audit::logKillCursorsAuthzCheck(opCtx->getClient(), _nss, id, ErrorCodes::OK);
         }
+        return Status::OK();
+    }
 
+    if (cursor->_pinState.load() == ClientCursor::kKillPending) {
+        // Another killCursors has already interrupted the operation using this cursor; that
+        // operation remains responsible for cleaning it up.
         if (shouldAudit) {
             audit::logKillCursorsAuthzCheck(opCtx->getClient(), _nss, id, ErrorCodes::OK);
         }
         return Status::OK();
     }
+
     std::unique_ptr<ClientCursor, ClientCursor::Deleter> ownedCursor(cursor);
 
     if (shouldAudit) {
@@ -802,10 +802,13 @@ void setUpCatalog(ServiceContext* serviceContext) {
     DatabaseHolder::set(serviceContext, std::make_unique<DatabaseHolderImpl>());
 }
 
-auto makeReplicationExecutor(ServiceContext* serviceContext) {
+auto makeReplicationExecutor(ServiceContext* serviceContext,
+                             const std::string& poolName,
+                             const std::string& networkInstanceName,
+                             int maxThreads) {
     ThreadPool::Options tpOptions;
-    tpOptions.poolName = "replexec";
-    tpOptions.maxThreads = 50;
+    tpOptions.poolName = poolName;
+    tpOptions.maxThreads = maxThreads;
     tpOptions.onCreateThread = [](const std::string& threadName) {
         Client::initThread(threadName.c_str());
     };
@@ -813,7 +816,7 @@ auto makeReplicationExecutor(ServiceContext* serviceContext) {
     hookList->addHook(stdx::make_unique<rpc::LogicalTimeMetadataHook>(serviceContext));
     return stdx::make_unique<executor::ThreadPoolTaskExecutor>(
         stdx::make_unique<ThreadPool>(tpOptions),
-        executor::makeNetworkInterface("Replication", nullptr, std::move(hookList)));
+        executor::makeNetworkInterface(networkInstanceName, nullptr, std::move(hookList)));
 }
 
 void setUpReplication(ServiceContext* serviceContext) {
@@ -846,7 +849,11 @@ void setUpReplication(ServiceContext* serviceContext) {
         getGlobalReplSettings(),
         stdx::make_unique<repl::ReplicationCoordinatorExternalStateImpl>(
             serviceContext, dropPendingCollectionReaper, storageInterface, replicationProcess),
-        makeReplicationExecutor(serviceContext),
+        makeReplicationExecutor(serviceContext, "replexec", "Replication", 50),
+        // Heartbeats get their own small executor and network interface so that their latency is
+        // not affected by other replication work queued on the main replication executor or its
+        // connections.
+        makeReplicationExecutor(serviceContext, "replexec-hb", "ReplicationHeartbeat", 2),
         stdx::make_unique<repl::TopologyCoordinator>(topoCoordOptions),
         replicationProcess,
         storageInterface,
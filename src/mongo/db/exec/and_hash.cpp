@@ -56,6 +56,33 @@ const size_t AndHashStage::kLookAheadWorks = 10;
 // static
 const char* AndHashStage::kStageType = "AND_HASH";
 
+void AndHashStage::RecordIdFilter::rebuild(const DataMap& table) {
+    // Roughly 16 bits per entry with two probes keeps the false positive rate near 1%.
+    size_t numBits = 1024;
+    while (numBits < table.size() * 16) {
+        numBits <<= 1;
+    }
+    _bits.assign(numBits / 64, 0);
+    _bitMask = numBits - 1;
+    for (const auto& entry : table) {
+        _insert(entry.first);
+    }
+}
+
+void AndHashStage::RecordIdFilter::_insert(const RecordId& recordId) {
+    const size_t h1 = RecordId::Hasher()(recordId);
+    const size_t h2 = h1 * 0x9e3779b97f4a7c15ULL;
+    _bits[(h1 & _bitMask) / 64] |= 1ULL << (h1 & 63);
+    _bits[(h2 & _bitMask) / 64] |= 1ULL << (h2 & 63);
+}
+
+bool AndHashStage::RecordIdFilter::mayContain(const RecordId& recordId) const {
+    const size_t h1 = RecordId::Hasher()(recordId);
+    const size_t h2 = h1 * 0x9e3779b97f4a7c15ULL;
+    return (_bits[(h1 & _bitMask) / 64] & (1ULL << (h1 & 63))) &&
+        (_bits[(h2 & _bitMask) / 64] & (1ULL << (h2 & 63)));
+}
+
 AndHashStage::AndHashStage(OperationContext* opCtx, WorkingSet* ws)
     : PlanStage(kStageType, opCtx),
       _ws(ws),
@@ -209,6 +236,12 @@ PlanStage::StageState AndHashStage::doWork(WorkingSetID* out) {
     // with no record id.
     invariant(member->hasRecordId());
 
+    if (!_recordIdFilter.mayContain(member->recordId)) {
+        // Definitely not in the table; skip the hash lookup entirely.
+        _ws->free(*out);
+        return PlanStage::NEED_TIME;
+    }
+
     DataMap::iterator it = _dataMap.find(member->recordId);
     if (_dataMap.end() == it) {
         // Child's output wasn't in every previous child.  Throw it out.
@@ -217,7 +250,7 @@ PlanStage::StageState AndHashStage::doWork(WorkingSetID* out) {
     } else {
         // Child's output was in every previous child.  Merge any key data in
         // the child's output and free the child's just-outputted WSM.
-        WorkingSetID hashID = it->second;
+        WorkingSetID hashID = it->second.wsid;
         _dataMap.erase(it);
 
         AndCommon::mergeFrom(_ws, hashID, *member);
@@ -252,7 +285,7 @@ PlanStage::StageState AndHashStage::readFirstChild(WorkingSetID* out) {
         // with no record id.
         invariant(member->hasRecordId());
 
-        if (!_dataMap.insert(std::make_pair(member->recordId, id)).second) {
+        if (!_dataMap.insert(std::make_pair(member->recordId, TableEntry{id, 0})).second) {
             // Didn't insert because we already had this RecordId inside the map. This should only
             // happen if we're seeing a newer copy of the same doc in a more recent snapshot.
             // Throw out the newer copy of the doc.
@@ -279,6 +312,8 @@ PlanStage::StageState AndHashStage::readFirstChild(WorkingSetID* out) {
 
         _specificStats.mapAfterChild.push_back(_dataMap.size());
 
+        _recordIdFilter.rebuild(_dataMap);
+
         return PlanStage::NEED_TIME;
     } else if (PlanStage::FAILURE == childStatus || PlanStage::DEAD == childStatus) {
         // The stage which produces a failure is responsible for allocating a working set member
@@ -309,12 +344,15 @@ PlanStage::StageState AndHashStage::hashOtherChildren(WorkingSetID* out) {
         // WSM with no record id.
         invariant(member->hasRecordId());
 
-        if (_dataMap.end() == _dataMap.find(member->recordId)) {
+        DataMap::iterator it = _recordIdFilter.mayContain(member->recordId)
+            ? _dataMap.find(member->recordId)
+            : _dataMap.end();
+        if (_dataMap.end() == it) {
             // Ignore.  It's not in any previous child.
         } else {
             // We have a hit.  Copy data into the WSM we already have.
-            _seenMap.insert(member->recordId);
-            WorkingSetID olderMemberID = _dataMap[member->recordId];
+            it->second.lastMatchingChild = _currentChild;
+            WorkingSetID olderMemberID = it->second.wsid;
             WorkingSetMember* olderMember = _ws->get(olderMemberID);
             size_t memUsageBefore = olderMember->getMemUsage();
 
@@ -326,30 +364,29 @@ PlanStage::StageState AndHashStage::hashOtherChildren(WorkingSetID* out) {
         _ws->free(id);
         return PlanStage::NEED_TIME;
     } else if (PlanStage::IS_EOF == childStatus) {
-        // Finished with a child.
-        ++_currentChild;
-
-        // Keep elements of _dataMap that are in _seenMap.
+        // Finished with a child.  Keep the elements of _dataMap it matched.
         DataMap::iterator it = _dataMap.begin();
         while (it != _dataMap.end()) {
-            if (_seenMap.end() == _seenMap.find(it->first)) {
+            if (it->second.lastMatchingChild != _currentChild) {
                 DataMap::iterator toErase = it;
                 ++it;
 
                 // Update memory stats.
-                WorkingSetMember* member = _ws->get(toErase->second);
+                WorkingSetMember* member = _ws->get(toErase->second.wsid);
                 _memUsage -= member->getMemUsage();
 
-                _ws->free(toErase->second);
+                _ws->free(toErase->second.wsid);
                 _dataMap.erase(toErase);
             } else {
                 ++it;
             }
         }
 
+        ++_currentChild;
+
         _specificStats.mapAfterChild.push_back(_dataMap.size());
 
-        _seenMap.clear();
+        _recordIdFilter.rebuild(_dataMap);
 
         // _dataMap is now the intersection of the first _currentChild nodes.
 
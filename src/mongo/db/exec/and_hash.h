@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "mongo/db/exec/plan_stage.h"
@@ -37,7 +38,6 @@
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/record_id.h"
 #include "mongo/stdx/unordered_map.h"
-#include "mongo/stdx/unordered_set.h"
 
 namespace mongo {
 
@@ -94,13 +94,37 @@ private:
 
     // _dataMap is filled out by the first child and probed by subsequent children.  This is the
     // hash table that we create by intersecting _children and probe with the last child.
-    typedef stdx::unordered_map<RecordId, WorkingSetID, RecordId::Hasher> DataMap;
+    struct TableEntry {
+        WorkingSetID wsid;
+
+        // Index of the most recent child whose output matched this entry. When a child reaches
+        // EOF, every entry it did not match is erased, so the flag doubles as the "seen" set
+        // without a second hash lookup per probe.
+        size_t lastMatchingChild;
+    };
+    typedef stdx::unordered_map<RecordId, TableEntry, RecordId::Hasher> DataMap;
     DataMap _dataMap;
 
-    // Keeps track of what elements from _dataMap subsequent children have seen.
-    // Only used while _hashingChildren.
-    typedef stdx::unordered_set<RecordId, RecordId::Hasher> SeenMap;
-    SeenMap _seenMap;
+    /**
+     * A Bloom-style bit array over the RecordIds currently in '_dataMap'. Probing children
+     * consult it before the hash table; a negative answer is definitive, so misses -- the
+     * common case when a probing child is much larger than the intersection -- are rejected
+     * with a couple of cache line touches instead of a full table lookup. The filter is
+     * rebuilt after each child completes, since the table only ever shrinks.
+     */
+    class RecordIdFilter {
+    public:
+        void rebuild(const DataMap& table);
+
+        bool mayContain(const RecordId& recordId) const;
+
+    private:
+        void _insert(const RecordId& recordId);
+
+        std::vector<uint64_t> _bits;
+        size_t _bitMask = 0;
+    };
+    RecordIdFilter _recordIdFilter;
 
     // True if we're still intersecting _children[0..._children.size()-1].
     bool _hashingChildren;
@@ -62,12 +62,14 @@ CachedPlanStage::CachedPlanStage(OperationContext* opCtx,
                                  CanonicalQuery* cq,
                                  const QueryPlannerParams& params,
                                  size_t decisionWorks,
-                                 PlanStage* root)
+                                 PlanStage* root,
+                                 std::unique_ptr<CachedSolution> cachedSolution)
     : RequiresAllIndicesStage(kStageType, opCtx, collection),
       _ws(ws),
       _canonicalQuery(cq),
       _plannerParams(params),
-      _decisionWorks(decisionWorks) {
+      _decisionWorks(decisionWorks),
+      _cachedSolution(std::move(cachedSolution)) {
     _children.emplace_back(root);
 }
 
@@ -207,6 +209,55 @@ Status CachedPlanStage::replan(PlanYieldPolicy* yieldPolicy, bool shouldCache) {
         cache->deactivate(*_canonicalQuery);
     }
 
+    if (shouldCache && internalQueryCacheIncrementalReplanEnabled.load() && _cachedSolution &&
+        _cachedSolution->plannerData.size() > 1) {
+        // Before replanning from scratch, race the cached plan against the runner-up from the
+        // original plan competition. After a shift in data distribution this usually re-selects
+        // the right plan at a fraction of the cost of regenerating and trialing every candidate.
+        // This cannot select a pair of stale plans indefinitely: the winner of this race is only
+        // activated by the cache if its works value beats the deactivated entry's, so a winner
+        // that is still slow leaves the entry inactive and the next execution of this shape plans
+        // from scratch.
+        auto incumbentStatus = QueryPlanner::planFromCacheData(
+            *_canonicalQuery, _plannerParams, *_cachedSolution->plannerData[0]);
+        auto runnerUpStatus = QueryPlanner::planFromCacheData(
+            *_canonicalQuery, _plannerParams, *_cachedSolution->plannerData[1]);
+
+        // If either plan can no longer be built from its cached data (e.g. it references a
+        // dropped index), fall through and replan from scratch.
+        if (incumbentStatus.isOK() && runnerUpStatus.isOK()) {
+            _children.emplace_back(new MultiPlanStage(getOpCtx(),
+                                                      collection(),
+                                                      _canonicalQuery,
+                                                      MultiPlanStage::CachingMode::AlwaysCache));
+            MultiPlanStage* multiPlanStage = static_cast<MultiPlanStage*>(child().get());
+
+            for (auto* solnStatus : {&incumbentStatus, &runnerUpStatus}) {
+                auto solution = std::move(solnStatus->getValue());
+                if (solution->cacheData.get()) {
+                    solution->cacheData->indexFilterApplied = _plannerParams.indexFiltersApplied;
+                }
+
+                PlanStage* nextPlanRoot;
+                verify(StageBuilder::build(
+                    getOpCtx(), collection(), *_canonicalQuery, *solution, _ws, &nextPlanRoot));
+
+                // Takes ownership of 'nextPlanRoot'.
+                multiPlanStage->addPlan(std::move(solution), nextPlanRoot, _ws);
+            }
+
+            Status pickBestPlanStatus = multiPlanStage->pickBestPlan(yieldPolicy);
+            if (!pickBestPlanStatus.isOK()) {
+                return pickBestPlanStatus;
+            }
+
+            LOG(1) << "Replanning " << redact(_canonicalQuery->toStringShort())
+                   << " against the cached runner-up plan resulted in plan with summary: "
+                   << Explain::getPlanSummary(child().get());
+            return Status::OK();
+        }
+    }
+
     // Use the query planning module to plan the whole query.
     auto statusWithSolutions = QueryPlanner::plan(*_canonicalQuery, _plannerParams);
     if (!statusWithSolutions.isOK()) {
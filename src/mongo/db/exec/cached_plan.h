@@ -37,6 +37,7 @@
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/query/canonical_query.h"
+#include "mongo/db/query/plan_cache.h"
 #include "mongo/db/query/query_planner_params.h"
 #include "mongo/db/query/query_solution.h"
 #include "mongo/db/record_id.h"
@@ -57,13 +58,19 @@ class PlanYieldPolicy;
  */
 class CachedPlanStage final : public RequiresAllIndicesStage {
 public:
+    /**
+     * 'cachedSolution' is the cache entry that 'root' was built from, and may be null. When
+     * provided, its planner data for the losing candidates of the original plan competition
+     * allows replanning to first race the cached plan against the runner-up plan only.
+     */
     CachedPlanStage(OperationContext* opCtx,
                     Collection* collection,
                     WorkingSet* ws,
                     CanonicalQuery* cq,
                     const QueryPlannerParams& params,
                     size_t decisionWorks,
-                    PlanStage* root);
+                    PlanStage* root,
+                    std::unique_ptr<CachedSolution> cachedSolution = nullptr);
 
     bool isEOF() final;
 
@@ -130,6 +137,11 @@ private:
     // cached.
     size_t _decisionWorks;
 
+    // The cache entry this plan was built from, including the planner data for the losing
+    // candidates of the original plan competition. May be null, in which case replanning always
+    // plans from scratch.
+    std::unique_ptr<CachedSolution> _cachedSolution;
+
     // If we fall back to re-planning the query, and there is just one resulting query solution,
     // that solution is owned here.
     std::unique_ptr<QuerySolution> _replannedQs;
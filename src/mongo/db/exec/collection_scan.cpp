@@ -156,6 +156,19 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
     }
 
     _lastSeenId = record->id;
+
+    if (_params.maxRecord) {
+        // The scan is bounded to a record-id range; stop as soon as we pass the bound. The
+        // record with the bound's id itself is still returned.
+        const bool beyondBound = (_params.direction == CollectionScanParams::FORWARD)
+            ? record->id > *_params.maxRecord
+            : record->id < *_params.maxRecord;
+        if (beyondBound) {
+            _commonStats.isEOF = true;
+            return PlanStage::IS_EOF;
+        }
+    }
+
     if (_params.shouldTrackLatestOplogTimestamp) {
         auto status = setLatestOplogEntryTimestamp(*record);
         if (!status.isOK()) {
@@ -46,6 +46,12 @@ struct CollectionScanParams {
     // The RecordId to which we should seek to as the first document of the scan.
     RecordId start;
 
+    // If present, the scan returns EOF upon seeing a record with id beyond this bound: greater
+    // than it for forward scans, less than it for backward scans (the bound itself is returned).
+    // Together with 'start', this lets cooperating operations scan a collection as disjoint
+    // record-id ranges, e.g. to partition an analytical scan across several cursors.
+    boost::optional<RecordId> maxRecord;
+
     // If present, the collection scan will stop and return EOF the first time it sees a document
     // that does not pass the filter and has 'ts' greater than 'maxTs'.
     boost::optional<Timestamp> maxTs;
@@ -32,11 +32,14 @@
 
 #include "mongo/db/exec/fetch.h"
 
+#include <algorithm>
+
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/exec/filter.h"
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/query/query_knobs.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/fail_point_service.h"
 #include "mongo/util/mongoutils/str.h"
@@ -50,15 +53,37 @@ using stdx::make_unique;
 // static
 const char* FetchStage::kStageType = "FETCH";
 
+namespace {
+
+// A fetch directly over an index scan buffers a batch of index entries and reads the records in
+// RecordId order, so a cold-cache scan issues its reads in on-disk order instead of the index's
+// key order. Fetches over other children keep the one-record-at-a-time behavior. The batching is
+// opt-in via the knob because this stage cannot see whether an ancestor (e.g. a LIMIT of 1)
+// will consume only a few results, in which case buffering a full batch reads records that are
+// then thrown away; the knob should stay off by default until the batch size is limit-aware.
+size_t computePrefetchBatchSize(const PlanStage* child) {
+    if (child->stageType() != STAGE_IXSCAN)
+        return 0;
+    auto batchSize = internalQueryFetchPrefetchBatchSize.load();
+    return batchSize > 1 ? static_cast<size_t>(batchSize) : 0;
+}
+
+}  // namespace
+
 FetchStage::FetchStage(OperationContext* opCtx,
                        WorkingSet* ws,
                        PlanStage* child,
                        const MatchExpression* filter,
-                       const Collection* collection)
+                       const Collection* collection,
+                       std::vector<std::string> neededFields)
     : RequiresCollectionStage(kStageType, opCtx, collection),
       _ws(ws),
       _filter(filter),
-      _idRetrying(WorkingSet::INVALID_ID) {
+      _neededFields(std::move(neededFields)),
+      _idRetrying(WorkingSet::INVALID_ID),
+      _prefetchBatchSize(computePrefetchBatchSize(child)) {
+    // A filter must be evaluated against the complete document, so the two are incompatible.
+    invariant(_neededFields.empty() || !_filter);
     _children.emplace_back(child);
 }
 
@@ -70,6 +95,11 @@ bool FetchStage::isEOF() {
         return false;
     }
 
+    if (_drainIdx < _prefetchBuffer.size() || !_fetchOrder.empty()) {
+        // We have buffered members that have not been handed out yet.
+        return false;
+    }
+
     return child()->isEOF();
 }
 
@@ -78,6 +108,10 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
         return PlanStage::IS_EOF;
     }
 
+    if (_prefetchBatchSize > 1) {
+        return doBatchedWork(out);
+    }
+
     // Either retry the last WSM we worked on or get a new one from our child.
     WorkingSetID id;
     StageState status;
@@ -104,7 +138,7 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
                 if (!_cursor)
                     _cursor = collection()->getCursor(getOpCtx());
 
-                if (!WorkingSetCommon::fetch(getOpCtx(), _ws, id, _cursor)) {
+                if (!WorkingSetCommon::fetch(getOpCtx(), _ws, id, _cursor, _neededFields)) {
                     _ws->free(id);
                     return NEED_TIME;
                 }
@@ -132,6 +166,104 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
     return status;
 }
 
+PlanStage::StageState FetchStage::doBatchedWork(WorkingSetID* out) {
+    // Resume a batch fetch that a write conflict interrupted.
+    if (!_fetchOrder.empty()) {
+        return fetchBufferedRecords(out);
+    }
+
+    if (_draining) {
+        while (_drainIdx < _prefetchBuffer.size()) {
+            WorkingSetID id = _prefetchBuffer[_drainIdx++];
+            if (WorkingSet::INVALID_ID == id) {
+                // The document was deleted between the index scan and the fetch.
+                return PlanStage::NEED_TIME;
+            }
+            return returnIfMatches(_ws->get(id), id, out);
+        }
+        _prefetchBuffer.clear();
+        _drainIdx = 0;
+        _draining = false;
+        return PlanStage::NEED_TIME;
+    }
+
+    // Buffer another result from the child.
+    WorkingSetID id;
+    StageState status = child()->work(&id);
+    if (PlanStage::ADVANCED == status) {
+        WorkingSetMember* member = _ws->get(id);
+        if (member->hasObj()) {
+            ++_specificStats.alreadyHasObj;
+        } else {
+            // We need a valid RecordId to fetch from and this is the only state that has one.
+            verify(WorkingSetMember::RID_AND_IDX == member->getState());
+            verify(member->hasRecordId());
+        }
+        _prefetchBuffer.push_back(id);
+        if (_prefetchBuffer.size() < _prefetchBatchSize) {
+            return PlanStage::NEED_TIME;
+        }
+    } else if (PlanStage::IS_EOF == status) {
+        if (_prefetchBuffer.empty()) {
+            return PlanStage::IS_EOF;
+        }
+    } else if (PlanStage::FAILURE == status || PlanStage::DEAD == status) {
+        // The stage which produces a failure is responsible for allocating a working set member
+        // with error details.
+        invariant(WorkingSet::INVALID_ID != id);
+        *out = id;
+        return status;
+    } else {
+        if (PlanStage::NEED_YIELD == status) {
+            *out = id;
+        }
+        return status;
+    }
+
+    // The batch is complete. Fetch the buffered records in RecordId order so the storage engine
+    // sees the reads in on-disk order.
+    for (size_t i = 0; i < _prefetchBuffer.size(); i++) {
+        WorkingSetMember* member = _ws->get(_prefetchBuffer[i]);
+        if (!member->hasObj()) {
+            _fetchOrder.emplace_back(member->recordId, i);
+        }
+    }
+    std::sort(_fetchOrder.begin(), _fetchOrder.end());
+    _fetchIdx = 0;
+    _draining = true;
+    return fetchBufferedRecords(out);
+}
+
+PlanStage::StageState FetchStage::fetchBufferedRecords(WorkingSetID* out) {
+    try {
+        if (!_cursor)
+            _cursor = collection()->getCursor(getOpCtx());
+
+        while (_fetchIdx < _fetchOrder.size()) {
+            const size_t bufferSlot = _fetchOrder[_fetchIdx].second;
+            WorkingSetID id = _prefetchBuffer[bufferSlot];
+            if (!WorkingSetCommon::fetch(getOpCtx(), _ws, id, _cursor, _neededFields)) {
+                // The document was deleted, so don't return it.
+                _ws->free(id);
+                _prefetchBuffer[bufferSlot] = WorkingSet::INVALID_ID;
+            } else {
+                // The member is handed out over later work() calls and the stage may yield in
+                // between, so the object must not point into the storage engine's buffers.
+                _ws->get(id)->makeObjOwnedIfNeeded();
+            }
+            ++_fetchIdx;
+        }
+    } catch (const WriteConflictException&) {
+        // Leave _fetchIdx in place so the next call retries this record.
+        *out = WorkingSet::INVALID_ID;
+        return PlanStage::NEED_YIELD;
+    }
+
+    _fetchOrder.clear();
+    _fetchIdx = 0;
+    return PlanStage::NEED_TIME;
+}
+
 void FetchStage::doSaveStateRequiresCollection() {
     if (_cursor) {
         _cursor->saveUnpositioned();
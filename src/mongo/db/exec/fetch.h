@@ -31,6 +31,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "mongo/db/exec/requires_collection_stage.h"
 #include "mongo/db/jsobj.h"
@@ -51,11 +54,18 @@ class SeekableRecordCursor;
  */
 class FetchStage : public RequiresCollectionStage {
 public:
+    /**
+     * If 'neededFields' is non-empty, the plan above this stage needs only those top-level fields
+     * of the fetched document, and fetched objects are trimmed down to them while the record is
+     * still in the storage engine's cache. May only be used without a filter, since the filter
+     * would otherwise be evaluated against the trimmed document.
+     */
     FetchStage(OperationContext* opCtx,
                WorkingSet* ws,
                PlanStage* child,
                const MatchExpression* filter,
-               const Collection* collection);
+               const Collection* collection,
+               std::vector<std::string> neededFields = {});
 
     ~FetchStage();
 
@@ -87,6 +97,20 @@ private:
      */
     StageState returnIfMatches(WorkingSetMember* member, WorkingSetID memberID, WorkingSetID* out);
 
+    /**
+     * Implements doWork() when fetches are batched: buffers results from the child index scan
+     * until the batch is full, fetches the buffered records in RecordId order, then hands the
+     * members out one at a time in the order the child produced them.
+     */
+    StageState doBatchedWork(WorkingSetID* out);
+
+    /**
+     * Fetches the records listed in _fetchOrder, resuming partway through if the previous
+     * attempt hit a WriteConflictException. Members whose document has been deleted are freed
+     * and their buffer slot invalidated.
+     */
+    StageState fetchBufferedRecords(WorkingSetID* out);
+
     // Used to fetch Records from _collection.
     std::unique_ptr<SeekableRecordCursor> _cursor;
 
@@ -96,9 +120,34 @@ private:
     // The filter is not owned by us.
     const MatchExpression* _filter;
 
+    // If non-empty, the only top-level fields of the fetched document the rest of the plan
+    // needs; fetched objects are trimmed down to this set.
+    const std::vector<std::string> _neededFields;
+
     // If not Null, we use this rather than asking our child what to do next.
     WorkingSetID _idRetrying;
 
+    // Batch size when fetching over an index scan; 0 or 1 means fetch one record per child
+    // result, as soon as the child produces it.
+    const size_t _prefetchBatchSize;
+
+    // Members buffered from the child, in the order the child produced them. Slots whose
+    // document turned out to be deleted hold WorkingSet::INVALID_ID.
+    std::vector<WorkingSetID> _prefetchBuffer;
+
+    // Index of the next _prefetchBuffer entry to hand out; the buffer is being refilled when
+    // this equals the buffer size.
+    size_t _drainIdx = 0;
+
+    // The buffered members that still need their record fetched, sorted by RecordId so the
+    // storage engine sees the reads in on-disk order. Non-empty only while a batch fetch is in
+    // progress; _fetchIdx is the next entry to fetch.
+    std::vector<std::pair<RecordId, size_t>> _fetchOrder;
+    size_t _fetchIdx = 0;
+
+    // True while buffered members are being handed out, false while the buffer is refilling.
+    bool _draining = false;
+
     // Stats
     FetchStats _specificStats;
 };
@@ -55,6 +55,7 @@
 #include "mongo/util/log.h"
 
 #include <algorithm>
+#include <cmath>
 
 namespace mongo {
 
@@ -578,6 +579,41 @@ static double min2DBoundsIncrement(const GeoNearExpression& query,
     return minBoundsIncrement * kMetersPerDegreeAtEquator;
 }
 
+// Each search interval aims to buffer roughly this many candidates - enough to amortize the
+// cost of computing the covering and seeding the index scan, but small enough that the first
+// results are returned quickly.
+static const long long kTargetResultsPerInterval = 300;
+
+/**
+ * Returns the bounds increment to use for the next search interval, adapted from the density
+ * observed over the last interval's annulus.
+ *
+ * When the last annulus buffered no candidates we know nothing about the local density, so the
+ * increment simply doubles.  Otherwise we estimate candidates-per-area from the last annulus and
+ * solve for the outer radius whose annulus would buffer roughly the per-interval target.  The
+ * result is clamped to within a factor of two of the previous increment so that one unusually
+ * dense or sparse ring can't swing the search granularity wildly.
+ */
+static double adaptiveBoundsIncrement(const IntervalStats& lastStats, double lastIncrement) {
+    if (lastStats.numResultsBuffered <= 0) {
+        return 2 * lastIncrement;
+    }
+
+    const double inner = std::max(lastStats.minDistanceAllowed, 0.0);
+    const double outer = lastStats.maxDistanceAllowed;
+    const double lastArea = M_PI * (outer * outer - inner * inner);
+    if (lastArea <= 0.0) {
+        return 2 * lastIncrement;
+    }
+
+    const double density = lastStats.numResultsBuffered / lastArea;
+    const double targetArea = kTargetResultsPerInterval / density;
+    const double targetOuter = std::sqrt(outer * outer + targetArea / M_PI);
+    const double increment = targetOuter - outer;
+
+    return std::min(std::max(increment, 0.5 * lastIncrement), 2 * lastIncrement);
+}
+
 static R2Annulus projectBoundsToTwoDDegrees(R2Annulus sphereBounds) {
     const double outerDegrees = rad2deg(sphereBounds.getOuter() / kRadiusOfEarthInMeters);
     const double innerDegrees = rad2deg(sphereBounds.getInner() / kRadiusOfEarthInMeters);
@@ -601,14 +637,10 @@ StatusWith<NearStage::CoveredInterval*>  //
     // Setup the next interval
     //
 
+    // Generally we want small numbers of results fast, then larger numbers later
     if (!_specificStats.intervalStats.empty()) {
-        const IntervalStats& lastIntervalStats = _specificStats.intervalStats.back();
-
-        // TODO: Generally we want small numbers of results fast, then larger numbers later
-        if (lastIntervalStats.numResultsReturned < 300)
-            _boundsIncrement *= 2;
-        else if (lastIntervalStats.numResultsReturned > 600)
-            _boundsIncrement /= 2;
+        _boundsIncrement =
+            adaptiveBoundsIncrement(_specificStats.intervalStats.back(), _boundsIncrement);
     }
 
     _boundsIncrement =
@@ -715,11 +747,6 @@ StatusWith<NearStage::CoveredInterval*>  //
     IndexBoundsBuilder::intersectize(coveredIntervals,
                                      &scanParams.bounds.fields[twoDFieldPosition]);
 
-    // These parameters are stored by the index, and so must be ok
-    GeoHashConverter::Parameters hashParams;
-    GeoHashConverter::parseParameters(indexDescriptor()->infoObj(), &hashParams)
-        .transitional_ignore();
-
     // 2D indexes support covered search over additional fields they contain
     IndexScan* scan = new IndexScan(opCtx, scanParams, workingSet, _nearParams.filter);
 
@@ -1021,14 +1048,10 @@ StatusWith<NearStage::CoveredInterval*>  //
     // Setup the next interval
     //
 
+    // Generally we want small numbers of results fast, then larger numbers later
     if (!_specificStats.intervalStats.empty()) {
-        const IntervalStats& lastIntervalStats = _specificStats.intervalStats.back();
-
-        // TODO: Generally we want small numbers of results fast, then larger numbers later
-        if (lastIntervalStats.numResultsReturned < 300)
-            _boundsIncrement *= 2;
-        else if (lastIntervalStats.numResultsReturned > 600)
-            _boundsIncrement /= 2;
+        _boundsIncrement =
+            adaptiveBoundsIncrement(_specificStats.intervalStats.back(), _boundsIncrement);
     }
 
     invariant(_boundsIncrement > 0.0);
@@ -32,7 +32,11 @@
 
 #include "mongo/db/exec/idhack.h"
 
+#include <algorithm>
+
+#include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/db/catalog/index_catalog.h"
+#include "mongo/db/catalog/point_read_cache.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/exec/index_scan.h"
 #include "mongo/db/exec/projection.h"
@@ -40,6 +44,8 @@
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/exec/working_set_computed_data.h"
 #include "mongo/db/index/btree_access_method.h"
+#include "mongo/db/query/query_knobs.h"
+#include "mongo/db/repl/read_concern_args.h"
 #include "mongo/stdx/memory.h"
 
 namespace mongo {
@@ -55,13 +61,35 @@ IDHackStage::IDHackStage(OperationContext* opCtx,
                          CanonicalQuery* query,
                          WorkingSet* ws,
                          const IndexDescriptor* descriptor)
-    : RequiresIndexStage(kStageType, opCtx, descriptor),
-      _workingSet(ws),
-      _key(query->getQueryObj()["_id"].wrap()) {
+    : RequiresIndexStage(kStageType, opCtx, descriptor), _workingSet(ws) {
     _specificStats.indexName = descriptor->indexName();
     if (NULL != query->getProj()) {
         _addKeyMetadata = query->getProj()->wantIndexKey();
     }
+
+    const BSONElement idElt = query->getQueryObj()["_id"];
+    if (CanonicalQuery::isSimpleIdInQuery(query->getQueryObj())) {
+        _batched = true;
+        for (auto&& value : idElt.Obj().firstElement().Obj()) {
+            _keys.push_back(value.wrap("_id"));
+        }
+        // Resolve the keys in index order. This is purely a locality optimization; with a
+        // non-simple collation the transformed keys may probe the index in a different order.
+        std::sort(_keys.begin(), _keys.end(), SimpleBSONObjComparator::kInstance.makeLessThan());
+    } else {
+        _key = idElt.wrap();
+    }
+
+    // The point read cache may only answer plain local reads. Reads inside a write unit of work
+    // or at a requested cluster time must see the storage engine's snapshot, and returnKey
+    // queries need the index keys themselves. Batched lookups bypass the cache; they are fetched
+    // in RecordId order, interleaving cached and uncached results would break that.
+    const auto& readConcern = repl::ReadConcernArgs::get(opCtx);
+    _cacheEligible = internalQueryPointReadCacheTTLMillis.load() > 0 && !_addKeyMetadata &&
+        !_batched && !opCtx->lockState()->inAWriteUnitOfWork() &&
+        (readConcern.getLevel() == repl::ReadConcernLevel::kLocalReadConcern ||
+         readConcern.getLevel() == repl::ReadConcernLevel::kAvailableReadConcern) &&
+        !readConcern.getArgsAfterClusterTime() && !readConcern.getArgsAtClusterTime();
 }
 
 IDHackStage::IDHackStage(OperationContext* opCtx,
@@ -83,8 +111,31 @@ PlanStage::StageState IDHackStage::doWork(WorkingSetID* out) {
         return PlanStage::IS_EOF;
     }
 
+    if (_batched) {
+        return doBatchedWork(out);
+    }
+
     WorkingSetID id = WorkingSet::INVALID_ID;
     try {
+        if (_cacheEligible) {
+            auto pointReadCache = collection()->infoCache()->getPointReadCache();
+            if (auto cachedObj = pointReadCache->lookup(_key)) {
+                // Serve the cached result without touching the storage engine.
+                id = _workingSet->allocate();
+                WorkingSetMember* member = _workingSet->get(id);
+                member->obj = Snapshotted<BSONObj>(SnapshotId(), std::move(*cachedObj));
+                member->transitionToOwnedObj();
+
+                _done = true;
+                *out = id;
+                return PlanStage::ADVANCED;
+            }
+
+            // Capture the write generation before reading so that the fill in advance() can be
+            // discarded if a write intervenes.
+            _generationAtRead = pointReadCache->getCurrentGeneration();
+        }
+
         // Look up the key by going directly to the index.
         RecordId recordId = indexAccessMethod()->findSingle(getOpCtx(), _key);
 
@@ -127,6 +178,66 @@ PlanStage::StageState IDHackStage::doWork(WorkingSetID* out) {
     }
 }
 
+PlanStage::StageState IDHackStage::doBatchedWork(WorkingSetID* out) {
+    WorkingSetID id = WorkingSet::INVALID_ID;
+    try {
+        if (!_resolvedKeys) {
+            // Resolve every key to a RecordId before fetching anything, so that the fetches can
+            // be issued in RecordId order.
+            _recordIds.clear();
+            for (const auto& key : _keys) {
+                RecordId recordId = indexAccessMethod()->findSingle(getOpCtx(), key);
+                ++_specificStats.keysExamined;
+                if (!recordId.isNull()) {
+                    _recordIds.push_back(recordId);
+                }
+            }
+            std::sort(_recordIds.begin(), _recordIds.end());
+            // Values which are equal under the collection's collation resolve to the same record;
+            // each matching document may only be returned once.
+            _recordIds.erase(std::unique(_recordIds.begin(), _recordIds.end()), _recordIds.end());
+            _nextRecordId = 0;
+            _resolvedKeys = true;
+        }
+
+        while (_nextRecordId < _recordIds.size()) {
+            id = _workingSet->allocate();
+            WorkingSetMember* member = _workingSet->get(id);
+            member->recordId = _recordIds[_nextRecordId];
+            _workingSet->transitionToRecordIdAndIdx(id);
+
+            if (!_recordCursor)
+                _recordCursor = collection()->getCursor(getOpCtx());
+
+            if (!WorkingSetCommon::fetch(getOpCtx(), _workingSet, id, _recordCursor)) {
+                // The document was deleted after its RecordId was resolved. Unlike the single-key
+                // case there may be further results, so skip it and keep going.
+                _workingSet->free(id);
+                id = WorkingSet::INVALID_ID;
+                ++_nextRecordId;
+                continue;
+            }
+
+            ++_specificStats.docsExamined;
+            if (++_nextRecordId == _recordIds.size()) {
+                _done = true;
+            }
+            *out = id;
+            return PlanStage::ADVANCED;
+        }
+
+        _done = true;
+        return PlanStage::IS_EOF;
+    } catch (const WriteConflictException&) {
+        _recordCursor.reset();
+        if (id != WorkingSet::INVALID_ID)
+            _workingSet->free(id);
+
+        *out = WorkingSet::INVALID_ID;
+        return NEED_YIELD;
+    }
+}
+
 PlanStage::StageState IDHackStage::advance(WorkingSetID id,
                                            WorkingSetMember* member,
                                            WorkingSetID* out) {
@@ -138,6 +249,11 @@ PlanStage::StageState IDHackStage::advance(WorkingSetID id,
             new IndexKeyComputedData(IndexKeyComputedData::rehydrateKey(_key, ownedKeyObj)));
     }
 
+    if (_cacheEligible) {
+        collection()->infoCache()->getPointReadCache()->insert(
+            _key, member->obj.value().getOwned(), _generationAtRead);
+    }
+
     _done = true;
     *out = id;
     return PlanStage::ADVANCED;
@@ -165,10 +281,14 @@ void IDHackStage::doReattachToOperationContext() {
 
 // static
 bool IDHackStage::supportsQuery(Collection* collection, const CanonicalQuery& query) {
-    return !query.getQueryRequest().showRecordId() && query.getQueryRequest().getHint().isEmpty() &&
-        !query.getQueryRequest().getSkip() &&
-        CanonicalQuery::isSimpleIdQuery(query.getQueryRequest().getFilter()) &&
-        !query.getQueryRequest().isTailable() &&
+    const QueryRequest& qr = query.getQueryRequest();
+    const bool simpleEquality = CanonicalQuery::isSimpleIdQuery(qr.getFilter());
+    // A batch of point reads is answered in RecordId order, so nothing which constrains the
+    // result order or needs per-key index metadata may be present.
+    const bool simpleIn = CanonicalQuery::isSimpleIdInQuery(qr.getFilter()) &&
+        qr.getSort().isEmpty() && !qr.returnKey();
+    return (simpleEquality || simpleIn) && !qr.showRecordId() && qr.getHint().isEmpty() &&
+        !qr.getSkip() && !qr.isTailable() &&
         CollatorInterface::collatorsMatch(query.getCollator(), collection->getDefaultCollator());
 }
 
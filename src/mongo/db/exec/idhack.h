@@ -31,6 +31,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "mongo/db/exec/requires_index_stage.h"
 #include "mongo/db/query/canonical_query.h"
@@ -45,6 +46,10 @@ class RecordCursor;
  * A standalone stage implementing the fast path for key-value retrievals via the _id index. Since
  * the _id index always has the collection default collation, the IDHackStage can only be used when
  * the query's collation is equal to the collection default.
+ *
+ * Also serves batches of point reads expressed as {_id: {$in: [...]}}: every value is resolved to
+ * a RecordId through the index up front, and the documents are then fetched in RecordId order so
+ * that reads against the record store are sequential rather than random.
  */
 class IDHackStage final : public RequiresIndexStage {
 public:
@@ -95,6 +100,11 @@ private:
      */
     StageState advance(WorkingSetID id, WorkingSetMember* member, WorkingSetID* out);
 
+    /**
+     * Implements doWork() for the batched {_id: {$in: [...]}} form.
+     */
+    StageState doBatchedWork(WorkingSetID* out);
+
     std::unique_ptr<SeekableRecordCursor> _recordCursor;
 
     // The WorkingSet we annotate with results.  Not owned by us.
@@ -103,12 +113,29 @@ private:
     // The value to match against the _id field.
     BSONObj _key;
 
-    // Have we returned our one document?
+    // Batched mode state. '_keys' holds the values of the $in, sorted for index locality;
+    // '_recordIds' holds the resolved records in fetch order once '_resolvedKeys' is set.
+    bool _batched = false;
+    bool _resolvedKeys = false;
+    std::vector<BSONObj> _keys;
+    std::vector<RecordId> _recordIds;
+    size_t _nextRecordId = 0;
+
+    // Have we returned our one document (or, when batched, our last document)?
     bool _done = false;
 
     // Do we need to add index key metadata for returnKey?
     bool _addKeyMetadata = false;
 
+    // May this lookup be served from, and fill, the collection's point read cache? Decided at
+    // construction time. Only the find path opts in; the other constructor's callers need the
+    // RecordId of the matching document and must always go to the index.
+    bool _cacheEligible = false;
+
+    // The collection write generation observed before reading from storage, used to guard the
+    // cache fill against concurrent writes.
+    long long _generationAtRead = 0;
+
     IDHackStats _specificStats;
 };
 
@@ -74,6 +74,7 @@ IndexScan::IndexScan(OperationContext* opCtx,
       _forward(params.direction == 1),
       _shouldDedup(params.shouldDedup),
       _addKeyMetadata(params.addKeyMetadata),
+      _neededKeyPrefixLength(params.neededKeyPrefixLength),
       _startKeyInclusive(IndexBounds::isStartIncludedInBound(params.bounds.boundInclusion)),
       _endKeyInclusive(IndexBounds::isEndIncludedInBound(params.bounds.boundInclusion)) {
     _specificStats.indexName = params.name;
@@ -89,6 +90,17 @@ IndexScan::IndexScan(OperationContext* opCtx,
                                    .getOwned();
 }
 
+void IndexScan::maybeApplyKeyPrefixHint() {
+    // The bounds checks for this scan are delegated entirely to the index cursor's end position,
+    // so the only remaining full-key consumers are the filter and key metadata.
+    if (_neededKeyPrefixLength < 0 || _filter || _addKeyMetadata) {
+        return;
+    }
+
+    _indexCursor->setKeyPrefixFieldsHint(_neededKeyPrefixLength);
+    _keyPrefixHintApplied = true;
+}
+
 boost::optional<IndexKeyEntry> IndexScan::initIndexScan() {
     // Perform the possibly heavy-duty initialization of the underlying index cursor.
     _indexCursor = indexAccessMethod()->newCursor(getOpCtx(), _forward);
@@ -101,6 +113,7 @@ boost::optional<IndexKeyEntry> IndexScan::initIndexScan() {
         _startKey = _bounds.startKey;
         _endKey = _bounds.endKey;
         _indexCursor->setEndPosition(_endKey, _endKeyInclusive);
+        maybeApplyKeyPrefixHint();
         return _indexCursor->seek(_startKey, _startKeyInclusive);
     } else {
         // For single intervals, we can use an optimized scan which checks against the position
@@ -109,6 +122,7 @@ boost::optional<IndexKeyEntry> IndexScan::initIndexScan() {
         if (IndexBoundsBuilder::isSingleInterval(
                 _bounds, &_startKey, &_startKeyInclusive, &_endKey, &_endKeyInclusive)) {
             _indexCursor->setEndPosition(_endKey, _endKeyInclusive);
+            maybeApplyKeyPrefixHint();
             return _indexCursor->seek(_startKey, _startKeyInclusive);
         } else {
             _checker.reset(new IndexBoundsChecker(&_bounds, _keyPattern, _direction));
@@ -145,8 +159,10 @@ PlanStage::StageState IndexScan::doWork(WorkingSetID* out) {
     }
 
     if (kv) {
-        // In debug mode, check that the cursor isn't lying to us.
-        if (kDebugBuild && !_startKey.isEmpty()) {
+        // In debug mode, check that the cursor isn't lying to us. The check is skipped when the
+        // cursor returns prefix-trimmed keys, since those compare differently than the complete
+        // key the bounds describe.
+        if (kDebugBuild && !_keyPrefixHintApplied && !_startKey.isEmpty()) {
             int cmp = kv->key.woCompare(_startKey,
                                         Ordering::make(_keyPattern),
                                         /*compareFieldNames*/ false);
@@ -155,7 +171,7 @@ PlanStage::StageState IndexScan::doWork(WorkingSetID* out) {
             dassert(_forward ? cmp >= 0 : cmp <= 0);
         }
 
-        if (kDebugBuild && !_endKey.isEmpty()) {
+        if (kDebugBuild && !_keyPrefixHintApplied && !_endKey.isEmpty()) {
             int cmp = kv->key.woCompare(_endKey,
                                         Ordering::make(_keyPattern),
                                         /*compareFieldNames*/ false);
@@ -81,6 +81,12 @@ struct IndexScanParams {
 
     // Do we want to add the key as metadata?
     bool addKeyMetadata{false};
+
+    // If non-negative, the stages above this scan consume only this many leading fields of the
+    // index key, so the scan may return keys trimmed to that prefix. Only honored when the scan
+    // delegates its bounds checks entirely to the index cursor and has no filter, since those
+    // checks require the complete key.
+    int neededKeyPrefixLength{-1};
 };
 
 /**
@@ -140,6 +146,12 @@ private:
      */
     boost::optional<IndexKeyEntry> initIndexScan();
 
+    /**
+     * Hints the index cursor to return keys trimmed to the needed prefix, if this scan is
+     * eligible for it.
+     */
+    void maybeApplyKeyPrefixHint();
+
     // The WorkingSet we fill with results.  Not owned by us.
     WorkingSet* const _workingSet;
 
@@ -161,6 +173,14 @@ private:
     // Do we want to add the key as metadata?
     const bool _addKeyMetadata;
 
+    // See IndexScanParams::neededKeyPrefixLength.
+    const int _neededKeyPrefixLength;
+
+    // Whether the index cursor was hinted to return keys trimmed to the needed prefix. Only set
+    // on the cursor-managed end position paths, where the scan never compares returned keys
+    // against its bounds.
+    bool _keyPrefixHintApplied = false;
+
     // Stats
     IndexScanStats _specificStats;
 
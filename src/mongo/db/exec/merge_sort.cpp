@@ -54,9 +54,11 @@ MergeSortStage::MergeSortStage(OperationContext* opCtx,
     : PlanStage(kStageType, opCtx),
       _ws(ws),
       _pattern(params.pattern),
+      _ordering(Ordering::make(params.pattern)),
       _collator(params.collator),
       _dedup(params.dedup),
-      _merging(StageWithValueComparison(ws, params.pattern, params.collator)) {}
+      _comparator(params.pattern, params.collator),
+      _merging(_comparator) {}
 
 void MergeSortStage::addChild(PlanStage* child) {
     _children.emplace_back(child);
@@ -68,7 +70,7 @@ void MergeSortStage::addChild(PlanStage* child) {
 bool MergeSortStage::isEOF() {
     // If we have no more results to return, and we have no more children that we can call
     // work(...) on to get results, we're done.
-    return _merging.empty() && _noResultToMerge.empty();
+    return _merging.empty() && !_leader && _noResultToMerge.empty();
 }
 
 PlanStage::StageState MergeSortStage::doWork(WorkingSetID* out) {
@@ -120,10 +122,22 @@ PlanStage::StageState MergeSortStage::doWork(WorkingSetID* out) {
             value.stage = child;
             // Ensure that the BSONObj underlying the WorkingSetMember is owned in case we yield.
             member->makeObjOwnedIfNeeded();
-            _mergingData.push_front(value);
-
-            // Insert the result (indirectly) into our priority queue.
-            _merging.push(_mergingData.begin());
+            // Extract the comparison key once, so heap sifts compare cached keys rather than
+            // re-walking the member's dotted paths.
+            extractSortKey(&value);
+            _mergingData.push_front(std::move(value));
+            const MergingRef newEntry = _mergingData.begin();
+
+            // If every other branch already has a buffered result and the branch we just
+            // refilled still compares no greater than the heap's minimum, its result is the
+            // overall minimum. Return it directly on the next call, bypassing the heap.
+            if (_noResultToMerge.empty() &&
+                (_merging.empty() || !_comparator(newEntry, _merging.top()))) {
+                _leader = newEntry;
+            } else {
+                // Insert the result (indirectly) into our priority queue.
+                _merging.push(newEntry);
+            }
 
             return PlanStage::NEED_TIME;
         } else if (PlanStage::IS_EOF == code) {
@@ -146,11 +160,18 @@ PlanStage::StageState MergeSortStage::doWork(WorkingSetID* out) {
     }
 
     // If we're here, for each non-EOF child, we have a valid WSID.
-    verify(!_merging.empty());
-
-    // Get the 'min' WSID.  _merging is a priority queue so its top is the smallest.
-    MergingRef top = _merging.top();
-    _merging.pop();
+    verify(!_merging.empty() || _leader);
+
+    // Get the 'min' WSID.  The leader, if set, is known to be the smallest; otherwise _merging
+    // is a priority queue so its top is the smallest.
+    MergingRef top;
+    if (_leader) {
+        top = *_leader;
+        _leader = boost::none;
+    } else {
+        top = _merging.top();
+        _merging.pop();
+    }
 
     // Since we're returning the WSID that came from top->stage, we need to work(...) it again
     // to get a new result.
@@ -166,26 +187,46 @@ PlanStage::StageState MergeSortStage::doWork(WorkingSetID* out) {
     return PlanStage::ADVANCED;
 }
 
-// Is lhs less than rhs?  Note that priority_queue is a max heap by default so we invert
-// the return from the expected value.
-bool MergeSortStage::StageWithValueComparison::operator()(const MergingRef& lhs,
-                                                          const MergingRef& rhs) {
-    WorkingSetMember* lhsMember = _ws->get(lhs->id);
-    WorkingSetMember* rhsMember = _ws->get(rhs->id);
+void MergeSortStage::extractSortKey(StageWithValue* value) const {
+    WorkingSetMember* member = _ws->get(value->id);
 
+    // Lay the member's sort key fields out flat, in pattern order.
+    BSONObjBuilder bob;
     BSONObjIterator it(_pattern);
     while (it.more()) {
         BSONElement patternElt = it.next();
-        string fn = patternElt.fieldName();
 
-        BSONElement lhsElt;
-        verify(lhsMember->getFieldDotted(fn, &lhsElt));
+        BSONElement elt;
+        verify(member->getFieldDotted(patternElt.fieldName(), &elt));
+        bob.appendAs(elt, "");
+    }
+    value->sortKey = bob.obj();
+
+    // Without a collation the pattern's direction bits can be baked into a KeyString, reducing
+    // each comparison to a memcmp.
+    if (!_collator) {
+        value->sortKeyString =
+            make_unique<KeyString>(KeyString::kLatestVersion, value->sortKey, _ordering);
+    }
+}
+
+// Is lhs less than rhs?  Note that priority_queue is a max heap by default so we invert
+// the return from the expected value.
+bool MergeSortStage::StageWithValueComparison::operator()(const MergingRef& lhs,
+                                                          const MergingRef& rhs) const {
+    if (lhs->sortKeyString && rhs->sortKeyString) {
+        return lhs->sortKeyString->compare(*rhs->sortKeyString) > 0;
+    }
 
-        BSONElement rhsElt;
-        verify(rhsMember->getFieldDotted(fn, &rhsElt));
+    // With a collation the keys cannot be memcmp'd; compare the cached flat keys field by field.
+    BSONObjIterator lhsIt(lhs->sortKey);
+    BSONObjIterator rhsIt(rhs->sortKey);
+    BSONObjIterator patternIt(_pattern);
+    while (patternIt.more()) {
+        BSONElement patternElt = patternIt.next();
 
         // false means don't compare field name.
-        int x = lhsElt.woCompare(rhsElt, false, _collator);
+        int x = lhsIt.next().woCompare(rhsIt.next(), false, _collator);
         if (-1 == patternElt.number()) {
             x = -x;
         }
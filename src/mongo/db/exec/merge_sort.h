@@ -30,14 +30,18 @@
 
 #pragma once
 
+#include <boost/optional.hpp>
 #include <list>
+#include <memory>
 #include <queue>
 #include <vector>
 
+#include "mongo/bson/ordering.h"
 #include "mongo/db/exec/plan_stage.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/record_id.h"
+#include "mongo/db/storage/key_string.h"
 
 namespace mongo {
 
@@ -80,6 +84,14 @@ private:
         StageWithValue() : id(WorkingSet::INVALID_ID), stage(NULL) {}
         WorkingSetID id;
         PlanStage* stage;
+
+        // The member's sort key fields, extracted once when the result is buffered and laid out
+        // flat in pattern order, so comparisons never repeat the dotted-path traversal.
+        BSONObj sortKey;
+
+        // KeyString encoding of 'sortKey', so comparisons are a single memcmp. Only set when
+        // there is no collation, since KeyString cannot encode collation-aware string order.
+        std::unique_ptr<KeyString> sortKeyString;
     };
 
     // This stage maintains a priority queue of results from each child stage so that it can quickly
@@ -87,28 +99,36 @@ private:
     // MergingRef, an iterator which refers to a buffered (WorkingSetMember, child stage) pair.
     typedef std::list<StageWithValue>::iterator MergingRef;
 
-    // The comparison function used in our priority queue.
+    // The comparison function used in our priority queue. Compares the cached sort keys on the
+    // merge entries rather than re-extracting fields from the WorkingSetMembers.
     class StageWithValueComparison {
     public:
-        StageWithValueComparison(WorkingSet* ws, BSONObj pattern, const CollatorInterface* collator)
-            : _ws(ws), _pattern(pattern), _collator(collator) {}
+        StageWithValueComparison(BSONObj pattern, const CollatorInterface* collator)
+            : _pattern(pattern), _collator(collator) {}
 
         // Is lhs less than rhs?  Note that priority_queue is a max heap by default so we invert
         // the return from the expected value.
-        bool operator()(const MergingRef& lhs, const MergingRef& rhs);
+        bool operator()(const MergingRef& lhs, const MergingRef& rhs) const;
 
     private:
-        WorkingSet* _ws;
         BSONObj _pattern;
         const CollatorInterface* _collator;
     };
 
+    /**
+     * Fills in the cached comparison key fields of 'value' from its WorkingSetMember.
+     */
+    void extractSortKey(StageWithValue* value) const;
+
     // Not owned by us.
     WorkingSet* _ws;
 
     // The pattern that we're sorting by.
     BSONObj _pattern;
 
+    // The direction bits of '_pattern', used for the KeyString encoding of cached sort keys.
+    const Ordering _ordering;
+
     // Null if this merge sort stage orders strings according to simple binary compare. If non-null,
     // represents the collator used to compare strings.
     const CollatorInterface* _collator;
@@ -123,12 +143,22 @@ private:
     // a result.  This is the queue of children that haven't given us a result yet.
     std::queue<PlanStage*> _noResultToMerge;
 
+    // The comparator ordering the merge. Also used outside the priority queue for the leader
+    // check below.
+    StageWithValueComparison _comparator;
+
     // The min heap of the results we're returning.
     std::priority_queue<MergingRef, std::vector<MergingRef>, StageWithValueComparison> _merging;
 
     // The data referred to by the _merging queue above.
     std::list<StageWithValue> _mergingData;
 
+    // Set when the most recently refilled branch still leads the merge, i.e. its new result
+    // compares no greater than the heap's top. Such a result is the overall minimum and is
+    // returned directly, bypassing a heap push/pop per document while one branch's run is
+    // contiguous.
+    boost::optional<MergingRef> _leader;
+
     // Stats
     MergeSortStats _specificStats;
 };
@@ -36,6 +36,7 @@
 #include "mongo/db/pipeline/document_source.h"
 #include "mongo/db/pipeline/expression_context.h"
 #include "mongo/db/pipeline/pipeline_d.h"
+#include "mongo/db/query/query_knobs.h"
 #include "mongo/stdx/memory.h"
 
 namespace mongo {
@@ -123,15 +124,25 @@ unique_ptr<PlanStageStats> PipelineProxyStage::getStats() {
 }
 
 boost::optional<BSONObj> PipelineProxyStage::getNextBson() {
-    if (auto next = _pipeline->getNext()) {
-        if (_includeMetaData) {
-            return next->toBsonWithMetaData();
-        } else {
-            return next->toBson();
-        }
+    // Pull a batch of results from the pipeline at once, rather than paying one virtual getNext()
+    // call per document per stage.
+    std::vector<Document> batch;
+    if (!_pipeline->getNextBatch(static_cast<size_t>(internalPipelineStageBatchSize.load()),
+                                 &batch)) {
+        return boost::none;
     }
 
-    return boost::none;
+    auto toBson = [this](const Document& doc) {
+        return _includeMetaData ? doc.toBsonWithMetaData() : doc.toBson();
+    };
+
+    // Return the first result now and stash the remainder in reverse order, since doWork()
+    // consumes the stash back to front.
+    boost::optional<BSONObj> next = toBson(batch.front());
+    for (auto it = batch.rbegin(); it != std::prev(batch.rend()); ++it) {
+        _stash.push_back(toBson(*it));
+    }
+    return next;
 }
 
 std::string PipelineProxyStage::getPlanSummaryStr() const {
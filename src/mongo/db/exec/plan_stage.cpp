@@ -34,19 +34,39 @@
 
 #include "mongo/db/exec/plan_stage.h"
 
+#include <boost/optional.hpp>
+
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/query/query_knobs.h"
 #include "mongo/db/service_context.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
 PlanStage::StageState PlanStage::work(WorkingSetID* out) {
     invariant(_opCtx);
     ScopedTimer timer(getClock(), &_commonStats.executionTimeMillis);
+
+    // The fast clock source read above is cheap but only millisecond-granularity, which cannot
+    // attribute sub-millisecond latency to individual stages. When sampling is enabled, time one
+    // of every 'sampleRate' works with the high-resolution tick source as well.
+    const int sampleRate = internalQueryExecStageTimingSampleRate.load();
+    const bool sampleTiming =
+        sampleRate > 0 && (_commonStats.works % static_cast<size_t>(sampleRate) == 0);
+    boost::optional<Timer> preciseTimer;
+    if (sampleTiming) {
+        preciseTimer.emplace(_opCtx->getServiceContext()->getTickSource());
+    }
     ++_commonStats.works;
 
     StageState workResult = doWork(out);
 
+    if (sampleTiming) {
+        _commonStats.executionTimeMicros += preciseTimer->micros();
+        ++_commonStats.worksSampled;
+    }
+
     if (StageState::ADVANCED == workResult) {
         ++_commonStats.advanced;
     } else if (StageState::NEED_TIME == workResult) {
@@ -66,6 +66,8 @@ struct CommonStats {
           needTime(0),
           needYield(0),
           executionTimeMillis(0),
+          executionTimeMicros(0),
+          worksSampled(0),
           isEOF(false) {}
     // String giving the type of the stage. Not owned.
     const char* stageTypeStr;
@@ -87,6 +89,12 @@ struct CommonStats {
     // Time elapsed while working inside this stage.
     long long executionTimeMillis;
 
+    // Microseconds spent in the 'worksSampled' calls to work() which were timed with the
+    // high-resolution tick source. Only collected when internalQueryExecStageTimingSampleRate
+    // is non-zero; consumers can extrapolate a per-work average from these two fields.
+    long long executionTimeMicros;
+    size_t worksSampled;
+
     // TODO: have some way of tracking WSM sizes (or really any series of #s).  We can measure
     // the size of our inputs and the size of our outputs.  We can do a lot with the WS here.
 
@@ -30,8 +30,11 @@
 
 #pragma once
 
+#include <boost/optional.hpp>
+
 #include "mongo/db/exec/plan_stage.h"
 #include "mongo/db/s/scoped_collection_metadata.h"
+#include "mongo/s/shard_key_pattern.h"
 
 namespace mongo {
 
@@ -100,6 +103,10 @@ private:
     // Note: it is important that this is the metadata from the time this stage is constructed.
     // See class comment for details.
     ScopedCollectionMetadata _metadata;
+
+    // The parsed shard key pattern, set up once at construction when the metadata is sharded, so
+    // the per-document key extraction does not re-parse the key pattern document.
+    boost::optional<ShardKeyPattern> _shardKeyPattern;
 };
 
 }  // namespace mongo
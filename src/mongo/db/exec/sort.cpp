@@ -33,7 +33,9 @@
 #include "mongo/db/exec/sort.h"
 
 #include <algorithm>
+#include <cstring>
 
+#include "mongo/base/compare_numbers.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set_common.h"
@@ -56,12 +58,73 @@ using stdx::make_unique;
 // static
 const char* SortStage::kStageType = "SORT";
 
-SortStage::WorkingSetComparator::WorkingSetComparator(BSONObj p) : pattern(p) {}
+namespace {
+
+// Typed comparison routines for sort key elements. Each must produce exactly the same result as
+// BSONElement::woCompare() does for a pair of elements of its type, so that the typed fast path
+// and the generic fallback always agree on the ordering.
+int compareIntElements(const BSONElement& l, const BSONElement& r) {
+    return compareInts(l._numberInt(), r._numberInt());
+}
+
+int compareLongElements(const BSONElement& l, const BSONElement& r) {
+    return compareLongs(l._numberLong(), r._numberLong());
+}
+
+int compareDoubleElements(const BSONElement& l, const BSONElement& r) {
+    return compareDoubles(l._numberDouble(), r._numberDouble());
+}
+
+int compareDateElements(const BSONElement& l, const BSONElement& r) {
+    const Date_t a = l.date();
+    const Date_t b = r.date();
+    if (a < b)
+        return -1;
+    return a == b ? 0 : 1;
+}
+
+int compareStringElements(const BSONElement& l, const BSONElement& r) {
+    // Sort keys are generated with the collation already applied, so a simple binary compare is
+    // correct here. We use memcmp as we allow zeros in UTF8 strings.
+    const int lsz = l.valuestrsize();
+    const int rsz = r.valuestrsize();
+    if (int res = memcmp(l.valuestr(), r.valuestr(), std::min(lsz, rsz)))
+        return res;
+    // The longer string is the greater one.
+    return lsz - rsz;
+}
+
+int (*typedComparatorFor(BSONType type))(const BSONElement&, const BSONElement&) {
+    switch (type) {
+        case BSONType::NumberInt:
+            return &compareIntElements;
+        case BSONType::NumberLong:
+            return &compareLongElements;
+        case BSONType::NumberDouble:
+            return &compareDoubleElements;
+        case BSONType::Date:
+            return &compareDateElements;
+        case BSONType::String:
+            return &compareStringElements;
+        default:
+            return nullptr;
+    }
+}
+
+}  // namespace
+
+SortStage::WorkingSetComparator::WorkingSetComparator(BSONObj p) {
+    BSONObjIterator it(p);
+    while (it.more()) {
+        TypedSlot slot;
+        slot.descending = it.next().number() < 0;
+        _slots.push_back(slot);
+    }
+}
 
 bool SortStage::WorkingSetComparator::operator()(const SortableDataItem& lhs,
                                                  const SortableDataItem& rhs) const {
-    // False means ignore field names.
-    int result = lhs.sortKey.woCompare(rhs.sortKey, pattern, false);
+    int result = _compareKeys(lhs.sortKey, rhs.sortKey);
     if (0 != result) {
         return result < 0;
     }
@@ -69,6 +132,51 @@ bool SortStage::WorkingSetComparator::operator()(const SortableDataItem& lhs,
     return lhs.recordId < rhs.recordId;
 }
 
+int SortStage::WorkingSetComparator::_compareKeys(const BSONObj& lhs, const BSONObj& rhs) const {
+    if (lhs.isEmpty())
+        return rhs.isEmpty() ? 0 : -1;
+    if (rhs.isEmpty())
+        return 1;
+
+    BSONObjIterator lhsIt(lhs);
+    BSONObjIterator rhsIt(rhs);
+
+    size_t pos = 0;
+    while (true) {
+        BSONElement l = lhsIt.next();
+        BSONElement r = rhsIt.next();
+        if (l.eoo())
+            return r.eoo() ? 0 : -1;
+        if (r.eoo())
+            return 1;
+
+        int x;
+        if (pos < _slots.size()) {
+            TypedSlot& slot = _slots[pos];
+            const BSONType type = l.type();
+            if (type == r.type()) {
+                if (type != slot.observedType) {
+                    // (Re)select the typed routine for the type this position now carries.
+                    slot.observedType = type;
+                    slot.typedCompare = typedComparatorFor(type);
+                }
+                // Field names are ignored, as in woCompare() with considerFieldName false.
+                x = slot.typedCompare ? slot.typedCompare(l, r) : l.woCompare(r, 0, nullptr);
+            } else {
+                x = l.woCompare(r, 0, nullptr);
+            }
+            if (slot.descending)
+                x = -x;
+        } else {
+            x = l.woCompare(r, 0, nullptr);
+        }
+
+        if (x != 0)
+            return x;
+        ++pos;
+    }
+}
+
 SortStage::SortStage(OperationContext* opCtx,
                      const SortStageParams& params,
                      WorkingSet* ws,
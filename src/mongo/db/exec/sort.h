@@ -124,12 +124,30 @@ private:
     //
     // We are comparing keys generated by the SortKeyGenerator, which are already ordered with
     // respect the collation. Therefore, we explicitly avoid comparing using a collator here.
-    struct WorkingSetComparator {
+    //
+    // Since the comparison runs O(n log n) times per sort, each sort key position carries a
+    // typed comparison slot: once a position has observed an element type for which a dedicated
+    // routine exists, pairs of that type dispatch straight to it, bypassing the canonical-type
+    // mapping and type switch in the generic BSONElement comparison. A type mismatch falls back
+    // to the generic comparison, so the result is always identical to woCompare().
+    class WorkingSetComparator {
+    public:
         explicit WorkingSetComparator(BSONObj p);
 
         bool operator()(const SortableDataItem& lhs, const SortableDataItem& rhs) const;
 
-        BSONObj pattern;
+    private:
+        // Replicates lhs.woCompare(rhs, pattern, false), consulting the typed slots.
+        int _compareKeys(const BSONObj& lhs, const BSONObj& rhs) const;
+
+        // One slot per sort key position, in pattern order. Key positions beyond the pattern
+        // compare ascending, as in BSONObj::woCompare().
+        struct TypedSlot {
+            bool descending;
+            BSONType observedType = BSONType::EOO;
+            int (*typedCompare)(const BSONElement&, const BSONElement&) = nullptr;
+        };
+        mutable std::vector<TypedSlot> _slots;
     };
 
     /**
@@ -215,6 +215,25 @@ TEST_F(SortStageTest, SortDescending) {
              "{output: [{a: 3}, {a: 2}, {a: 1}]}");
 }
 
+TEST_F(SortStageTest, SortStableTypeStrings) {
+    // A stable string-typed key exercises the typed memcmp comparison path.
+    testWork("{a: 1}",
+             nullptr,
+             0,
+             "{input: [{a: 'xyz'}, {a: 'abc'}, {a: 'mno'}]}",
+             "{output: [{a: 'abc'}, {a: 'mno'}, {a: 'xyz'}]}");
+}
+
+TEST_F(SortStageTest, SortMixedTypes) {
+    // Mixed int/double/string keys must fall back to the generic comparison, which orders
+    // numbers before strings and compares int and double by numeric value.
+    testWork("{a: 1}",
+             nullptr,
+             0,
+             "{input: [{a: 'xyz'}, {a: 5}, {a: 2.5}, {a: 'abc'}, {a: 10}]}",
+             "{output: [{a: 2.5}, {a: 5}, {a: 10}, {a: 'abc'}, {a: 'xyz'}]}");
+}
+
 TEST_F(SortStageTest, SortIrrelevantSortKey) {
     testWork("{b: 1}",
              nullptr,
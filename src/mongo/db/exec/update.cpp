@@ -44,6 +44,7 @@
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/exec/write_stage_common.h"
+#include "mongo/db/field_ref_set.h"
 #include "mongo/db/op_observer.h"
 #include "mongo/db/query/explain.h"
 #include "mongo/db/repl/replication_coordinator.h"
@@ -194,6 +195,21 @@ UpdateStage::UpdateStage(OperationContext* opCtx,
     // Before we even start executing, we know whether or not this is a replacement
     // style or $mod style update.
     _specificStats.isDocReplacement = params.driver->isDocReplacement();
+
+    // The set of paths the update may not modify is a function of the request and the collection's
+    // sharding state only, so compute it once up front rather than for every matching document.
+    if (opCtx->writesAreReplicated() && !request->isFromMigration()) {
+        auto immutablePathsVector = getImmutableFields(opCtx, request->getNamespaceString());
+        if (immutablePathsVector) {
+            _immutablePathStorage.reserve(immutablePathsVector->size());
+            for (auto&& path : *immutablePathsVector) {
+                _immutablePathStorage.push_back(stdx::make_unique<FieldRef>(path->dottedField()));
+            }
+            _immutablePaths.fillFrom(
+                transitional_tools_do_not_use::unspool_vector(_immutablePathStorage));
+        }
+        _immutablePaths.keepShortest(&idFieldRef);
+    }
 }
 
 BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj, RecordId& recordId) {
@@ -221,19 +237,19 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj, Reco
 
     Status status = Status::OK();
     const bool validateForStorage = getOpCtx()->writesAreReplicated() && _enforceOkForStorage;
-    FieldRefSet immutablePaths;
-    if (getOpCtx()->writesAreReplicated() && !request->isFromMigration()) {
-        auto immutablePathsVector = getImmutableFields(getOpCtx(), request->getNamespaceString());
-        if (immutablePathsVector) {
-            immutablePaths.fillFrom(
-                transitional_tools_do_not_use::unspool_vector(*immutablePathsVector));
-        }
-        immutablePaths.keepShortest(&idFieldRef);
-    }
+    // The paths modified by the update, used to skip maintenance of indexes which the update
+    // cannot affect. Left empty for replacement updates, whose modified paths are unknown.
+    FieldRefSetWithStorage modifiedPaths;
+
     if (!driver->needMatchDetails()) {
         // If we don't need match details, avoid doing the rematch
-        status = driver->update(
-            StringData(), &_doc, validateForStorage, immutablePaths, &logObj, &docWasModified);
+        status = driver->update(StringData(),
+                                &_doc,
+                                validateForStorage,
+                                _immutablePaths,
+                                &logObj,
+                                &docWasModified,
+                                &modifiedPaths);
     } else {
         // If there was a matched field, obtain it.
         MatchDetails matchDetails;
@@ -246,8 +262,13 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj, Reco
         if (matchDetails.hasElemMatchKey())
             matchedField = matchDetails.elemMatchKey();
 
-        status = driver->update(
-            matchedField, &_doc, validateForStorage, immutablePaths, &logObj, &docWasModified);
+        status = driver->update(matchedField,
+                                &_doc,
+                                validateForStorage,
+                                _immutablePaths,
+                                &logObj,
+                                &docWasModified,
+                                &modifiedPaths);
     }
 
     if (!status.isOK()) {
@@ -304,6 +325,11 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj, Reco
             if (args.storeDocOption == CollectionUpdateArgs::StoreDocOption::PreImage) {
                 args.preImageDoc = oldObj.value().getOwned();
             }
+            // Replacement updates do not report their modified paths, so they must maintain all
+            // indexes. 'modifiedPaths' outlives the updateDocument() call below.
+            if (!driver->isDocReplacement() && !modifiedPaths.empty()) {
+                args.modifiedPaths = &modifiedPaths.fieldRefSet();
+            }
         }
 
         if (inPlace) {
@@ -214,6 +214,13 @@ private:
     // True if updated documents should be validated with storage_validation::storageValid().
     bool _enforceOkForStorage;
 
+    // Paths the update is not allowed to modify (the _id and, on a sharded collection, the shard
+    // key fields). These depend only on the request and the collection, not on the individual
+    // document, so they are computed once at construction instead of per updated document.
+    // '_immutablePathStorage' owns the FieldRefs that '_immutablePaths' points into.
+    std::vector<std::unique_ptr<FieldRef>> _immutablePathStorage;
+    FieldRefSet _immutablePaths;
+
     // If the update was in-place, we may see it again.  This only matters if we're doing
     // a multi-update; if we're not doing a multi-update we stop after one update and we
     // won't see any more docs.
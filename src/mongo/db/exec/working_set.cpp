@@ -40,26 +40,18 @@ using std::string;
 
 namespace dps = ::mongo::dotted_path_support;
 
-WorkingSet::MemberHolder::MemberHolder() : member(NULL) {}
-WorkingSet::MemberHolder::~MemberHolder() {}
-
 WorkingSet::WorkingSet() : _freeList(INVALID_ID) {}
 
-WorkingSet::~WorkingSet() {
-    for (size_t i = 0; i < _data.size(); i++) {
-        delete _data[i].member;
-    }
-}
+WorkingSet::~WorkingSet() {}
 
 WorkingSetID WorkingSet::allocate() {
     if (_freeList == INVALID_ID) {
-        // The free list is empty so we need to make a single new WSM to return. This relies on
-        // vector::resize being amortized O(1) for efficient allocation. Note that the free list
-        // remains empty until something is returned by a call to free().
+        // The free list is empty so we need to make a single new WSM to return. The deque
+        // constructs it within a chunk it has already allocated whenever possible. Note that
+        // the free list remains empty until something is returned by a call to free().
         WorkingSetID id = _data.size();
-        _data.resize(_data.size() + 1);
+        _data.emplace_back();
         _data.back().nextFreeOrSelf = id;
-        _data.back().member = new WorkingSetMember();
         return id;
     }
 
@@ -75,16 +67,15 @@ void WorkingSet::free(WorkingSetID i) {
     verify(i < _data.size());            // ID has been allocated.
     verify(holder.nextFreeOrSelf == i);  // ID currently in use.
 
-    // Free resources and push this WSM to the head of the freelist.
-    holder.member->clear();
+    // Free resources and push this WSM to the head of the freelist. clear() releases the
+    // member's object and computed data but retains keyData's capacity for the next user of
+    // this slot.
+    holder.member.clear();
     holder.nextFreeOrSelf = _freeList;
     _freeList = i;
 }
 
 void WorkingSet::clear() {
-    for (size_t i = 0; i < _data.size(); i++) {
-        delete _data[i].member;
-    }
     _data.clear();
 
     // Since working set is now empty, the free list pointer should
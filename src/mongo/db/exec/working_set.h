@@ -31,6 +31,7 @@
 #pragma once
 
 #include "boost/optional.hpp"
+#include <deque>
 #include <vector>
 
 #include "mongo/base/disallow_copying.h"
@@ -73,7 +74,7 @@ public:
     WorkingSetMember* get(WorkingSetID i) const {
         dassert(i < _data.size());              // ID has been allocated.
         dassert(_data[i].nextFreeOrSelf == i);  // ID currently in use.
-        return _data[i].member;
+        return &_data[i].member;
     }
 
     /**
@@ -117,19 +118,25 @@ public:
 
 private:
     struct MemberHolder {
-        MemberHolder();
-        ~MemberHolder();
+        MONGO_DISALLOW_COPYING(MemberHolder);
+
+        MemberHolder() = default;
 
         // Free list link if freed. Points to self if in use.
         WorkingSetID nextFreeOrSelf;
 
-        // Owning pointer
-        WorkingSetMember* member;
+        // Stored in place so that members come out of the deque's chunked allocations rather
+        // than individual heap allocations. Mutable because get() is const but hands out
+        // mutable members, as it did when members were individually heap-allocated.
+        mutable WorkingSetMember member;
     };
 
     // All WorkingSetIDs are indexes into this, except for INVALID_ID.
-    // Elements are added to _freeList rather than removed when freed.
-    std::vector<MemberHolder> _data;
+    // Elements are added to _freeList rather than removed when freed. A deque provides the
+    // reference stability that stages rely on (they hold WorkingSetMember pointers across
+    // allocate() calls) while allocating members a chunk at a time. Freed members keep their
+    // keyData capacity, so slot reuse on the hot path does not return to the allocator.
+    std::deque<MemberHolder> _data;
 
     // Index into _data, forming a linked-list using MemberHolder::nextFreeOrSelf as the next
     // link. INVALID_ID is the list terminator since 0 is a valid index.
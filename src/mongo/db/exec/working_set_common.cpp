@@ -32,6 +32,8 @@
 
 #include "mongo/db/exec/working_set_common.h"
 
+#include <algorithm>
+
 #include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/exec/working_set.h"
@@ -59,7 +61,8 @@ void WorkingSetCommon::prepareForSnapshotChange(WorkingSet* workingSet) {
 bool WorkingSetCommon::fetch(OperationContext* opCtx,
                              WorkingSet* workingSet,
                              WorkingSetID id,
-                             unowned_ptr<SeekableRecordCursor> cursor) {
+                             unowned_ptr<SeekableRecordCursor> cursor,
+                             const std::vector<std::string>& neededFields) {
     WorkingSetMember* member = workingSet->get(id);
 
     // We should have a RecordId but need to retrieve the obj. Get the obj now and reset all WSM
@@ -81,10 +84,10 @@ bool WorkingSetCommon::fetch(OperationContext* opCtx,
         // unneeded due to the structure of the plan.
         invariant(!member->keyData.empty());
         for (size_t i = 0; i < member->keyData.size(); i++) {
-            BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+            BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
             // There's no need to compute the prefixes of the indexed fields that cause the index to
             // be multikey when ensuring the keyData is still valid.
-            BSONObjSet* multikeyMetadataKeys = nullptr;
+            BSONObjFlatSet* multikeyMetadataKeys = nullptr;
             MultikeyPaths* multikeyPaths = nullptr;
             member->keyData[i].index->getKeys(member->obj.value(),
                                               IndexAccessMethod::GetKeysMode::kEnforceConstraints,
@@ -101,6 +104,23 @@ bool WorkingSetCommon::fetch(OperationContext* opCtx,
     }
 
     member->keyData.clear();
+
+    if (!neededFields.empty()) {
+        // The rest of the plan needs only these top-level fields, so build the trimmed document
+        // now, while the record is still an unowned view of the storage engine's buffer. This
+        // avoids ever making an owned copy of the full document.
+        BSONObjBuilder bob;
+        BSONObjIterator it(member->obj.value());
+        while (it.more()) {
+            BSONElement elt = it.next();
+            if (std::find(neededFields.begin(), neededFields.end(), elt.fieldNameStringData()) !=
+                neededFields.end()) {
+                bob.append(elt);
+            }
+        }
+        member->obj.setValue(bob.obj());
+    }
+
     workingSet->transitionToRecordIdAndObj(id);
     return true;
 }
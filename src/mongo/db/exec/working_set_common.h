@@ -30,6 +30,9 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "mongo/db/exec/working_set.h"
 #include "mongo/util/unowned_ptr.h"
 
@@ -61,12 +64,18 @@ public:
      * If false is returned, the document should not be considered for the result set. It is the
      * caller's responsibility to free 'id' in this case.
      *
+     * If 'neededFields' is non-empty, the rest of the plan needs only those top-level fields of
+     * the fetched document, and the member's object is trimmed down to them while the storage
+     * engine's buffer is still in cache. The trimmed object is owned, so making the member owned
+     * later (e.g. before a yield) does not copy the full document.
+     *
      * WriteConflict exceptions may be thrown. When they are, 'member' will be unmodified.
      */
     static bool fetch(OperationContext* opCtx,
                       WorkingSet* workingSet,
                       WorkingSetID id,
-                      unowned_ptr<SeekableRecordCursor> cursor);
+                      unowned_ptr<SeekableRecordCursor> cursor,
+                      const std::vector<std::string>& neededFields = {});
 
     /**
      * Build a BSONObj which represents a Status to return in a WorkingSet.
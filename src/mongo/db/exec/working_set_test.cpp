@@ -156,4 +156,30 @@ TEST_F(WorkingSetFixture, getDottedFieldFromIndex) {
     ASSERT_FALSE(member->getFieldDotted("y", &elt));
 }
 
+TEST_F(WorkingSetFixture, MembersRemainValidAsWorkingSetGrows) {
+    // Stages hold WorkingSetMember pointers across allocate() calls, so growth must not move
+    // existing members.
+    std::vector<std::pair<WorkingSetID, WorkingSetMember*>> members;
+    for (int i = 0; i < 1000; i++) {
+        WorkingSetID id = ws->allocate();
+        members.emplace_back(id, ws->get(id));
+    }
+    for (auto&& idAndMember : members) {
+        ASSERT_EQ(ws->get(idAndMember.first), idAndMember.second);
+    }
+}
+
+TEST_F(WorkingSetFixture, FreedIdsAreRecycled) {
+    WorkingSetID firstId = ws->allocate();
+    WorkingSetMember* firstMember = ws->get(firstId);
+    ws->free(firstId);
+    ASSERT_TRUE(ws->isFree(firstId));
+
+    // The freed slot comes back in the INVALID state, recycling the same member.
+    WorkingSetID secondId = ws->allocate();
+    ASSERT_EQ(secondId, firstId);
+    ASSERT_EQ(ws->get(secondId), firstMember);
+    ASSERT_EQ(ws->get(secondId)->getState(), WorkingSetMember::INVALID);
+}
+
 }  // namespace
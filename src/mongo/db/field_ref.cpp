@@ -35,12 +35,61 @@
 #include <algorithm>
 #include <cctype>
 
+#include "mongo/stdx/mutex.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 
+namespace {
+
+// The process-wide intern table backing FieldRef::getInterned(). Sharded by path hash so that
+// concurrent parses rarely contend on the same mutex. Each shard is bounded so that workloads
+// with unbounded distinct paths (e.g. generated field names) parse but do not grow the table.
+const size_t kNumInternShards = 16;
+const size_t kMaxInternedPathsPerShard = 4 * 1024;
+
+struct InternShard {
+    stdx::mutex mutex;
+    StringMap<std::shared_ptr<const FieldRef>> paths;
+};
+
+InternShard& internShardForHash(size_t hash) {
+    static InternShard* const shards = new InternShard[kNumInternShards];
+    return shards[hash % kNumInternShards];
+}
+
+}  // namespace
+
 const size_t FieldRef::kReserveAhead;
 
+// static
+std::shared_ptr<const FieldRef> FieldRef::getInterned(StringData path) {
+    auto hashedPath = StringMapHasher().hashed_key(path);
+    auto& shard = internShardForHash(hashedPath.hash());
+
+    {
+        stdx::lock_guard<stdx::mutex> lk(shard.mutex);
+        auto it = shard.paths.find(hashedPath);
+        if (it != shard.paths.end()) {
+            return it->second;
+        }
+    }
+
+    // Parse outside the lock; only the table accesses need to be serialized.
+    auto parsed = std::make_shared<const FieldRef>(path);
+
+    stdx::lock_guard<stdx::mutex> lk(shard.mutex);
+    if (shard.paths.size() >= kMaxInternedPathsPerShard) {
+        return parsed;
+    }
+    auto& entry = shard.paths[hashedPath];
+    if (!entry) {
+        entry = std::move(parsed);
+    }
+    return entry;
+}
+
 FieldRef::FieldRef(StringData path) {
     parse(path);
 }
@@ -91,6 +140,10 @@ void FieldRef::parse(StringData path) {
 
         break;
     }
+
+    // Computed eagerly, so that instances shared between threads via getInterned() never write
+    // to the cache after parsing.
+    _hasNumericComponents = _anyNumericPathComponents();
 }
 
 void FieldRef::setPart(size_t i, StringData part) {
@@ -106,6 +159,7 @@ void FieldRef::setPart(size_t i, StringData part) {
     } else {
         _variable[getIndex(i)] = boost::none;
     }
+    _hasNumericComponents = boost::none;
 }
 
 void FieldRef::appendPart(StringData part) {
@@ -121,6 +175,7 @@ void FieldRef::appendPart(StringData part) {
         _variable.push_back(boost::none);
     }
     _size++;
+    _hasNumericComponents = boost::none;
 }
 
 void FieldRef::removeLastPart() {
@@ -138,6 +193,7 @@ void FieldRef::removeLastPart() {
     }
 
     _size--;
+    _hasNumericComponents = boost::none;
 }
 
 size_t FieldRef::appendParsedPart(FieldRef::StringView part) {
@@ -268,6 +324,13 @@ bool FieldRef::isNumericPathComponentStrict(size_t i) const {
 }
 
 bool FieldRef::hasNumericPathComponents() const {
+    if (!_hasNumericComponents) {
+        _hasNumericComponents = _anyNumericPathComponents();
+    }
+    return *_hasNumericComponents;
+}
+
+bool FieldRef::_anyNumericPathComponents() const {
     for (size_t i = 0; i < numParts(); ++i) {
         if (isNumericPathComponentStrict(i))
             return true;
@@ -365,6 +428,7 @@ int FieldRef::compare(const FieldRef& other) const {
 void FieldRef::clear() {
     _size = 0;
     _cachedSize = 0;
+    _hasNumericComponents = boost::none;
     _variable.clear();
     _dotted.clear();
     _replacements.clear();
@@ -32,6 +32,7 @@
 
 #include <boost/optional.hpp>
 #include <iosfwd>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -48,7 +49,8 @@ namespace mongo {
  * Any field part may be replaced, after the "original" field reference was parsed. Any
  * part can be accessed through a StringData object.
  *
- * The class is not thread safe.
+ * The class is not thread safe. However, an instance which is not mutated after parse() -- in
+ * particular, an interned instance returned by getInterned() -- may safely be read concurrently.
  */
 class FieldRef {
 public:
@@ -65,6 +67,15 @@ public:
      */
     static bool isNumericPathComponentLenient(StringData component);
 
+    /**
+     * Returns a shared, immutable FieldRef for 'path', parsing the dotted string only the first
+     * time the path is seen. Instances are hash-consed in a process-wide table, so hot code which
+     * repeatedly constructs FieldRefs for the same small set of paths (update modifiers, query
+     * equalities) pays one parse per distinct path rather than one per construction. The table is
+     * bounded; once a table shard fills up, new paths are still parsed but no longer retained.
+     */
+    static std::shared_ptr<const FieldRef> getInterned(StringData path);
+
     FieldRef() = default;
 
     explicit FieldRef(StringData path);
@@ -126,7 +137,8 @@ public:
     bool isNumericPathComponentStrict(size_t i) const;
 
     /**
-     * Returns true if this FieldRef has any numeric path components.
+     * Returns true if this FieldRef has any numeric path components. The answer is computed during
+     * parse() and cached, so repeated calls do not rescan the parts.
      */
     bool hasNumericPathComponents() const;
 
@@ -213,6 +225,12 @@ private:
      */
     size_t appendParsedPart(StringView part);
 
+    /**
+     * Scans the parts for a strictly numeric component. Used to (re)compute the cached
+     * '_hasNumericComponents' flag.
+     */
+    bool _anyNumericPathComponents() const;
+
     /**
      * Re-assemble _dotted from components, including any replacements in _replacements,
      * and update the StringData components in _fixed and _variable to refer to the parts
@@ -228,6 +246,11 @@ private:
     // Number of field parts in the cached dotted name (_dotted).
     mutable size_t _cachedSize = 0u;
 
+    // Whether any path component is a strictly numeric string. Computed eagerly by parse() so
+    // that interned instances, which are shared across threads, never write to it; mutating
+    // operations reset it to boost::none and it is then recomputed on demand.
+    mutable boost::optional<bool> _hasNumericComponents;
+
     // First 'kReservedAhead' field components. Each component is either a StringView backed by the
     // _dotted string or boost::none to indicate that getPart() should read the string from the
     // _replacements list.
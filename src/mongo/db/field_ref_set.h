@@ -164,6 +164,14 @@ public:
         return _fieldRefSet.empty();
     }
 
+    /**
+     * Returns the underlying set of field refs. The returned reference and the FieldRefs it points
+     * to are invalidated by clear() or by destroying this object.
+     */
+    const FieldRefSet& fieldRefSet() const {
+        return _fieldRefSet;
+    }
+
     void clear() {
         _ownedFieldRefs.clear();
         _fieldRefSet.clear();
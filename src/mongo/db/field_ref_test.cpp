@@ -877,4 +877,39 @@ TEST(NumericPathComponents, FieldsWithLeadingZeroesAreNotConsideredNumeric) {
     ASSERT(numericPathComponents == expectedComponents);
 }
 
+TEST(NumericPathComponents, HasNumericPathComponentsIsCorrectAfterMutation) {
+    FieldRef path("a.b");
+    ASSERT(!path.hasNumericPathComponents());
+    path.appendPart("0");
+    ASSERT(path.hasNumericPathComponents());
+    path.removeLastPart();
+    ASSERT(!path.hasNumericPathComponents());
+    path.setPart(1u, "1");
+    ASSERT(path.hasNumericPathComponents());
+}
+
+TEST(Interning, InterningReturnsTheSameInstanceForTheSamePath) {
+    auto first = FieldRef::getInterned("a.b.c");
+    auto second = FieldRef::getInterned("a.b.c");
+    ASSERT_EQUALS(first.get(), second.get());
+}
+
+TEST(Interning, InternedFieldRefIsParsedCorrectly) {
+    auto path = FieldRef::getInterned("a.0.b");
+    ASSERT_EQUALS(path->numParts(), 3U);
+    ASSERT_EQUALS(path->getPart(0), "a");
+    ASSERT_EQUALS(path->getPart(1), "0");
+    ASSERT_EQUALS(path->getPart(2), "b");
+    ASSERT_EQUALS(path->dottedField(), "a.0.b");
+    ASSERT(path->hasNumericPathComponents());
+    ASSERT_EQUALS(*path, FieldRef("a.0.b"));
+}
+
+TEST(Interning, DistinctPathsInternToDistinctInstances) {
+    auto first = FieldRef::getInterned("a.b");
+    auto second = FieldRef::getInterned("a.c");
+    ASSERT_NOT_EQUALS(first.get(), second.get());
+    ASSERT_NOT_EQUALS(*first, *second);
+}
+
 }  // namespace
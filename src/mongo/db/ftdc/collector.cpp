@@ -28,6 +28,8 @@
  *    it in the license file.
  */
 
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kFTDC
+
 #include "mongo/platform/basic.h"
 
 #include "mongo/db/ftdc/collector.h"
@@ -40,6 +42,7 @@
 #include "mongo/db/ftdc/util.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/util/log.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
@@ -49,7 +52,8 @@ void FTDCCollectorCollection::add(std::unique_ptr<FTDCCollectorInterface> collec
     _collectors.emplace_back(std::move(collector));
 }
 
-std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
+std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client,
+                                                             Milliseconds perCollectorTimeout) {
     // If there are no collectors, just return an empty BSONObj so that that are caller knows we did
     // not collect anything
     if (_collectors.empty()) {
@@ -89,7 +93,24 @@ std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
 
         subObjBuilder.appendDate(kFTDCCollectStartField, now);
 
-        collector->collect(opCtx.get(), subObjBuilder);
+        if (perCollectorTimeout > Milliseconds{0}) {
+            // Run the collector under a deadline so that one which stalls on a lock contended by
+            // user operations gets interrupted, releasing the lock request, instead of holding up
+            // this sample and every later collector.
+            try {
+                opCtx->runWithDeadline(
+                    now + perCollectorTimeout, ErrorCodes::ExceededTimeLimit, [&] {
+                        collector->collect(opCtx.get(), subObjBuilder);
+                    });
+            } catch (const ExceptionForCat<ErrorCategory::ExceededTimeLimitError>&) {
+                warning() << "Diagnostic data collector '" << collector->name()
+                          << "' took longer than " << perCollectorTimeout
+                          << " to collect a sample and was interrupted";
+                subObjBuilder.append(kFTDCCollectTimedOutField, true);
+            }
+        } else {
+            collector->collect(opCtx.get(), subObjBuilder);
+        }
 
         end = client->getServiceContext()->getPreciseClockSource()->now();
         subObjBuilder.appendDate(kFTDCCollectEndField, end);
@@ -35,6 +35,7 @@
 #include <vector>
 
 #include "mongo/base/disallow_copying.h"
+#include "mongo/util/duration.h"
 
 namespace mongo {
 
@@ -95,6 +96,11 @@ public:
      * Collect a sample from all collectors. Called after all adding is complete.
      * Returns a tuple of a sample, and the time at which collecting started.
      *
+     * If 'perCollectorTimeout' is positive, each collector is given at most that much time to
+     * collect its sample. A collector which exceeds its budget is interrupted so that it cannot
+     * stall collection or sit indefinitely on locks contended by user operations, and its
+     * sub-document records the failure instead of its data.
+     *
      * Sample schema:
      * {
      *    "start" : Date_t,    <- Time at which all collecting started
@@ -107,7 +113,8 @@ public:
      *    "end" : Date_t,      <- Time at which all collecting ended
      * }
      */
-    std::tuple<BSONObj, Date_t> collect(Client* client);
+    std::tuple<BSONObj, Date_t> collect(Client* client,
+                                        Milliseconds perCollectorTimeout = Milliseconds{0});
 
 private:
     // collection of collectors
@@ -47,6 +47,7 @@ struct FTDCConfig {
           maxDirectorySizeBytes(kMaxDirectorySizeBytesDefault),
           maxFileSizeBytes(kMaxFileSizeBytesDefault),
           period(kPeriodMillisDefault),
+          collectorTimeout(kCollectorTimeoutMillisDefault),
           maxSamplesPerArchiveMetricChunk(kMaxSamplesPerArchiveMetricChunkDefault),
           maxSamplesPerInterimMetricChunk(kMaxSamplesPerInterimMetricChunkDefault) {}
 
@@ -74,6 +75,13 @@ struct FTDCConfig {
      */
     Milliseconds period;
 
+    /**
+     * Time budget for a single collector to collect a sample. A collector which exceeds the
+     * budget is interrupted so that it releases any locks it is holding or waiting on. Zero
+     * means collectors are not time limited.
+     */
+    Milliseconds collectorTimeout;
+
     /**
      * Maximum number of samples to collect in an archive metric chunk for long term storage.
      */
@@ -88,6 +96,7 @@ struct FTDCConfig {
     static const bool kEnabledDefault = true;
 
     static const std::int64_t kPeriodMillisDefault;
+    static const std::int64_t kCollectorTimeoutMillisDefault;
     static const std::uint64_t kMaxDirectorySizeBytesDefault = 200 * 1024 * 1024;
     static const std::uint64_t kMaxFileSizeBytesDefault = 10 * 1024 * 1024;
 
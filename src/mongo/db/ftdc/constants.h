@@ -47,6 +47,7 @@ extern const char kFTDCDocsField[];
 
 extern const char kFTDCCollectStartField[];
 extern const char kFTDCCollectEndField[];
+extern const char kFTDCCollectTimedOutField[];
 
 constexpr StringData kFTDCDefaultDirectory = "diagnostic.data"_sd;
 
@@ -76,6 +76,11 @@ public:
      */
     void setPeriod(Milliseconds millis);
 
+    /**
+     * Set the time budget each collector is given to collect a sample. Zero disables the budget.
+     */
+    void setCollectorTimeout(Milliseconds millis);
+
     /**
      * Set the maximum directory size in bytes.
      */
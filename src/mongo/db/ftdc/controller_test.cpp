@@ -45,6 +45,7 @@
 #include "mongo/db/ftdc/controller.h"
 #include "mongo/db/ftdc/ftdc_test.h"
 #include "mongo/db/jsobj.h"
+#include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/unittest/temp_dir.h"
@@ -157,6 +158,32 @@ public:
     }
 };
 
+class FTDCMetricsCollectorMockSlow : public FTDCCollectorInterface {
+public:
+    void collect(OperationContext* opCtx, BSONObjBuilder& builder) final {
+        builder.append("key1", 42);
+
+        // Wait until the per-collector time budget interrupts us.
+        opCtx->sleepFor(Hours(1));
+    }
+
+    std::string name() const final {
+        return "slow";
+    }
+};
+
+// Test that a collector which exceeds its time budget is interrupted and marked as timed out
+TEST_F(FTDCControllerTest, TestCollectorTimeout) {
+    FTDCCollectorCollection collectors;
+    collectors.add(stdx::make_unique<FTDCMetricsCollectorMockSlow>());
+
+    auto sample = collectors.collect(getClient(), Milliseconds(50));
+    auto doc = std::get<0>(sample);
+
+    auto subObj = doc["slow"].Obj();
+    ASSERT_TRUE(subObj[kFTDCCollectTimedOutField].trueValue());
+}
+
 // Test a run of the controller and the data it logs to log file
 TEST_F(FTDCControllerTest, TestFull) {
     unittest::TempDir tempdir("metrics_testpath");
@@ -195,7 +195,7 @@ Status FTDCFileManager::openArchiveFile(
     // collect one-time information
     // This is appened after the file is opened to ensure a user can determine which bson objects
     // where collected from which server instance.
-    auto sample = _rotateCollectors->collect(client);
+    auto sample = _rotateCollectors->collect(client, _config->collectorTimeout);
     if (!std::get<0>(sample).isEmpty()) {
         Status s = _writer.writeMetadata(std::get<0>(sample), std::get<1>(sample));
 
@@ -64,8 +64,10 @@ const char kFTDCDocsField[] = "docs";
 
 const char kFTDCCollectStartField[] = "start";
 const char kFTDCCollectEndField[] = "end";
+const char kFTDCCollectTimedOutField[] = "timedOut";
 
 const std::int64_t FTDCConfig::kPeriodMillisDefault = 1000;
+const std::int64_t FTDCConfig::kCollectorTimeoutMillisDefault = 0;
 
 const std::size_t kMaxRecursion = 10;
 
@@ -46,7 +46,7 @@ class FTSSpec;
 
 class FTSIndexFormat {
 public:
-    static void getKeys(const FTSSpec& spec, const BSONObj& document, BSONObjSet* keys);
+    static void getKeys(const FTSSpec& spec, const BSONObj& document, BSONObjFlatSet* keys);
 
     /**
      * Helper method to get return entry from the FTSIndex as a BSONObj
@@ -54,14 +54,14 @@ using unittest::assertGet;
 TEST(FTSIndexFormat, Simple1) {
     FTSSpec spec(assertGet(FTSSpec::fixSpec(BSON("key" << BSON("data"
                                                                << "text")))));
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     FTSIndexFormat::getKeys(spec,
                             BSON("data"
                                  << "cat sat"),
                             &keys);
 
     ASSERT_EQUALS(2U, keys.size());
-    for (BSONObjSet::const_iterator i = keys.begin(); i != keys.end(); ++i) {
+    for (BSONObjFlatSet::const_iterator i = keys.begin(); i != keys.end(); ++i) {
         BSONObj key = *i;
         ASSERT_EQUALS(2, key.nFields());
         ASSERT_EQUALS(String, key.firstElement().type());
@@ -73,7 +73,7 @@ TEST(FTSIndexFormat, ExtraBack1) {
                                                                << "text"
                                                                << "x"
                                                                << 1)))));
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     FTSIndexFormat::getKeys(spec,
                             BSON("data"
                                  << "cat"
@@ -93,7 +93,7 @@ TEST(FTSIndexFormat, ExtraBack1) {
 TEST(FTSIndexFormat, ExtraFront1) {
     FTSSpec spec(assertGet(FTSSpec::fixSpec(BSON("key" << BSON("x" << 1 << "data"
                                                                    << "text")))));
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     FTSIndexFormat::getKeys(spec,
                             BSON("data"
                                  << "cat"
@@ -114,14 +114,14 @@ TEST(FTSIndexFormat, StopWords1) {
     FTSSpec spec(assertGet(FTSSpec::fixSpec(BSON("key" << BSON("data"
                                                                << "text")))));
 
-    BSONObjSet keys1 = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys1 = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     FTSIndexFormat::getKeys(spec,
                             BSON("data"
                                  << "computer"),
                             &keys1);
     ASSERT_EQUALS(1U, keys1.size());
 
-    BSONObjSet keys2 = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys2 = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     FTSIndexFormat::getKeys(spec,
                             BSON("data"
                                  << "any computer"),
@@ -133,9 +133,9 @@ TEST(FTSIndexFormat, StopWords1) {
  * Helper function to compare keys returned in getKeys() result
  * with expected values.
  */
-void assertEqualsIndexKeys(std::set<std::string>& expectedKeys, const BSONObjSet& keys) {
+void assertEqualsIndexKeys(std::set<std::string>& expectedKeys, const BSONObjFlatSet& keys) {
     ASSERT_EQUALS(expectedKeys.size(), keys.size());
-    for (BSONObjSet::const_iterator i = keys.begin(); i != keys.end(); ++i) {
+    for (BSONObjFlatSet::const_iterator i = keys.begin(); i != keys.end(); ++i) {
         BSONObj key = *i;
         ASSERT_EQUALS(2, key.nFields());
         ASSERT_EQUALS(String, key.firstElement().type());
@@ -163,7 +163,7 @@ TEST(FTSIndexFormat, LongWordsTextIndexVersion1) {
                                                                << "text")
                                                        << "textIndexVersion"
                                                        << 1))));
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     string longPrefix(1024U, 'a');
     // "aaa...aaacat"
     string longWordCat = longPrefix + "cat";
@@ -193,7 +193,7 @@ TEST(FTSIndexFormat, LongWordTextIndexVersion2) {
                                                                << "text")
                                                        << "textIndexVersion"
                                                        << 2))));
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     string longPrefix(1024U, 'a');
     // "aaa...aaacat"
     string longWordCat = longPrefix + "cat";
@@ -228,7 +228,7 @@ TEST(FTSIndexFormat, LongWordTextIndexVersion3) {
                                                                << "text")
                                                        << "textIndexVersion"
                                                        << 3))));
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     string longPrefix(1024U, 'a');
     // "aaa...aaacat"
     string longWordCat = longPrefix + "cat";
@@ -256,7 +256,7 @@ TEST(FTSIndexFormat, LongWordTextIndexVersion3) {
 TEST(FTSIndexFormat, GetKeysWithLeadingEmptyArrayThrows) {
     BSONObj keyPattern = fromjson("{'a.b': 1, data: 'text'}");
     FTSSpec spec(assertGet(FTSSpec::fixSpec(BSON("key" << keyPattern << "textIndexVersion" << 3))));
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     BSONObj objToIndex = fromjson("{a: {b: []}, data: 'foo'}");
     ASSERT_THROWS_CODE(FTSIndexFormat::getKeys(spec, objToIndex, &keys),
                        AssertionException,
@@ -266,7 +266,7 @@ TEST(FTSIndexFormat, GetKeysWithLeadingEmptyArrayThrows) {
 TEST(FTSIndexFormat, GetKeysWithTrailingEmptyArrayThrows) {
     BSONObj keyPattern = fromjson("{data: 'text', 'a.b': 1}");
     FTSSpec spec(assertGet(FTSSpec::fixSpec(BSON("key" << keyPattern << "textIndexVersion" << 3))));
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     BSONObj objToIndex = fromjson("{a: {b: []}, data: 'foo'}");
     ASSERT_THROWS_CODE(FTSIndexFormat::getKeys(spec, objToIndex, &keys),
                        AssertionException,
@@ -276,7 +276,7 @@ TEST(FTSIndexFormat, GetKeysWithTrailingEmptyArrayThrows) {
 TEST(FTSIndexFormat, GetKeysWithLeadingSingleElementArrayThrows) {
     BSONObj keyPattern = fromjson("{'a.b': 1, data: 'text'}");
     FTSSpec spec(assertGet(FTSSpec::fixSpec(BSON("key" << keyPattern << "textIndexVersion" << 3))));
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     BSONObj objToIndex = fromjson("{a: [{b: 9}], data: 'foo'}");
     ASSERT_THROWS_CODE(FTSIndexFormat::getKeys(spec, objToIndex, &keys),
                        AssertionException,
@@ -286,7 +286,7 @@ TEST(FTSIndexFormat, GetKeysWithLeadingSingleElementArrayThrows) {
 TEST(FTSIndexFormat, GetKeysWithTrailingSingleElementArrayThrows) {
     BSONObj keyPattern = fromjson("{data: 'text', 'a.b': 1}");
     FTSSpec spec(assertGet(FTSSpec::fixSpec(BSON("key" << keyPattern << "textIndexVersion" << 3))));
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     BSONObj objToIndex = fromjson("{a: [{b: 9}], data: 'foo'}");
     ASSERT_THROWS_CODE(FTSIndexFormat::getKeys(spec, objToIndex, &keys),
                        AssertionException,
@@ -296,7 +296,7 @@ TEST(FTSIndexFormat, GetKeysWithTrailingSingleElementArrayThrows) {
 TEST(FTSIndexFormat, GetKeysWithMultiElementArrayThrows) {
     BSONObj keyPattern = fromjson("{'a.b': 1, 'a.c': 'text'}");
     FTSSpec spec(assertGet(FTSSpec::fixSpec(BSON("key" << keyPattern << "textIndexVersion" << 3))));
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     BSONObj objToIndex = fromjson("{a: [{b: 9, c: 'foo'}, {b: 10, c: 'bar'}]}");
     ASSERT_THROWS_CODE(FTSIndexFormat::getKeys(spec, objToIndex, &keys),
                        AssertionException,
@@ -306,7 +306,7 @@ TEST(FTSIndexFormat, GetKeysWithMultiElementArrayThrows) {
 TEST(FTSIndexFormat, GetKeysWithPositionalPathAllowed) {
     BSONObj keyPattern = fromjson("{'a.0': 1, 'a.b': 'text'}");
     FTSSpec spec(assertGet(FTSSpec::fixSpec(BSON("key" << keyPattern << "textIndexVersion" << 3))));
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     BSONObj objToIndex = fromjson("{a: [{b: 'foo'}, {b: 'bar'}]}");
     FTSIndexFormat::getKeys(spec, objToIndex, &keys);
     ASSERT_EQ(2U, keys.size());
@@ -71,9 +71,18 @@ bool FTSMatcher::matches(const BSONObj& obj) const {
 bool FTSMatcher::hasPositiveTerm(const BSONObj& obj) const {
     FTSElementIterator it(_spec, obj);
 
+    // Tokenizers are expensive to construct, so build one lazily and keep reusing it until a
+    // value in a different language comes along.
+    const FTSLanguage* tokenizerLanguage = nullptr;
+    std::unique_ptr<FTSTokenizer> tokenizer;
+
     while (it.more()) {
         FTSIteratorValue val = it.next();
-        if (_hasPositiveTerm_string(val._language, val._text)) {
+        if (val._language != tokenizerLanguage) {
+            tokenizer = val._language->createTokenizer();
+            tokenizerLanguage = val._language;
+        }
+        if (_hasPositiveTerm_string(tokenizer.get(), val._text)) {
             return true;
         }
     }
@@ -81,8 +90,7 @@ bool FTSMatcher::hasPositiveTerm(const BSONObj& obj) const {
     return false;
 }
 
-bool FTSMatcher::_hasPositiveTerm_string(const FTSLanguage* language, const string& raw) const {
-    std::unique_ptr<FTSTokenizer> tokenizer(language->createTokenizer());
+bool FTSMatcher::_hasPositiveTerm_string(FTSTokenizer* tokenizer, const string& raw) const {
     tokenizer->reset(raw.c_str(), _getTokenizerOptions());
 
     while (tokenizer->moveNext()) {
@@ -101,9 +109,16 @@ bool FTSMatcher::hasNegativeTerm(const BSONObj& obj) const {
 
     FTSElementIterator it(_spec, obj);
 
+    const FTSLanguage* tokenizerLanguage = nullptr;
+    std::unique_ptr<FTSTokenizer> tokenizer;
+
     while (it.more()) {
         FTSIteratorValue val = it.next();
-        if (_hasNegativeTerm_string(val._language, val._text)) {
+        if (val._language != tokenizerLanguage) {
+            tokenizer = val._language->createTokenizer();
+            tokenizerLanguage = val._language;
+        }
+        if (_hasNegativeTerm_string(tokenizer.get(), val._text)) {
             return true;
         }
     }
@@ -111,8 +126,7 @@ bool FTSMatcher::hasNegativeTerm(const BSONObj& obj) const {
     return false;
 }
 
-bool FTSMatcher::_hasNegativeTerm_string(const FTSLanguage* language, const string& raw) const {
-    std::unique_ptr<FTSTokenizer> tokenizer(language->createTokenizer());
+bool FTSMatcher::_hasNegativeTerm_string(FTSTokenizer* tokenizer, const string& raw) const {
     tokenizer->reset(raw.c_str(), _getTokenizerOptions());
 
     while (tokenizer->moveNext()) {
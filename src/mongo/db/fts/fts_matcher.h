@@ -89,15 +89,15 @@ private:
 
     /**
      * Returns whether the string 'raw' contains any positive terms from the query.
-     * 'language' specifies the language for 'raw'.
+     * 'tokenizer' is reset to tokenize 'raw' and must match its language.
      */
-    bool _hasPositiveTerm_string(const FTSLanguage* language, const std::string& raw) const;
+    bool _hasPositiveTerm_string(FTSTokenizer* tokenizer, const std::string& raw) const;
 
     /**
      * Returns whether the string 'raw' contains any negative terms from the query.
-     * 'language' specifies the language for 'raw'.
+     * 'tokenizer' is reset to tokenize 'raw' and must match its language.
      */
-    bool _hasNegativeTerm_string(const FTSLanguage* language, const std::string& raw) const;
+    bool _hasNegativeTerm_string(FTSTokenizer* tokenizer, const std::string& raw) const;
 
     /**
      * Returns whether 'obj' contains the exact string 'phrase' in any indexed fields.
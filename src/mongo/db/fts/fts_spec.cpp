@@ -183,9 +183,17 @@ void FTSSpec::scoreDocument(const BSONObj& obj, TermFrequencyMap* term_freqs) co
 
     FTSElementIterator it(*this, obj);
 
+    // Most documents index all of their text fields in a single language, so reuse one tokenizer
+    // across values and only create a new one when the language actually changes.
+    const FTSLanguage* tokenizerLanguage = nullptr;
+    std::unique_ptr<FTSTokenizer> tokenizer;
+
     while (it.more()) {
         FTSIteratorValue val = it.next();
-        std::unique_ptr<FTSTokenizer> tokenizer(val._language->createTokenizer());
+        if (val._language != tokenizerLanguage) {
+            tokenizer = val._language->createTokenizer();
+            tokenizerLanguage = val._language;
+        }
         _scoreStringV2(tokenizer.get(), val._text, term_freqs, val._weight);
     }
 }
@@ -194,7 +202,10 @@ void FTSSpec::_scoreStringV2(FTSTokenizer* tokenizer,
                              StringData raw,
                              TermFrequencyMap* docScores,
                              double weight) const {
-    ScoreHelperMap terms;
+    // Reused across calls on this thread so that scoring a text field doesn't rebuild the term
+    // map's buckets from scratch; clear() keeps the table's capacity.
+    thread_local ScoreHelperMap terms;
+    terms.clear();
 
     unsigned numTokens = 0;
 
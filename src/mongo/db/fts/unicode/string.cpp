@@ -65,7 +65,6 @@ inline void appendUtf8Codepoint(char32_t codepoint, OutputIterator* outputIt) {
 }
 
 using linenoise_utf8::copyString32to8;
-using linenoise_utf8::copyString8to32;
 
 using std::u32string;
 
@@ -80,26 +79,79 @@ void String::resetData(const StringData utf8_src) {
 }
 
 void String::setData(const StringData utf8_src) {
-    // _data is the target, resize it so that it's guaranteed to fit all of the input characters,
-    // plus a null character if there isn't one.
-    _data.resize(utf8_src.size() + 1);
+    // _data is the target, resize it so that it's guaranteed to fit all of the input characters.
+    // Every UTF-8 byte produces at most one code point, so this can only overestimate.
+    _data.resize(utf8_src.size());
 
-    int result = 0;
-    size_t resultSize = 0;
+    auto outputIt = _data.begin();
+    auto inputIt = utf8_src.begin();
+    const auto endIt = utf8_src.end();
 
-    // Although utf8_src.rawData() is not guaranteed to be null-terminated, copyString8to32 won't
-    // access bad memory because it is limited by the size of its output buffer, which is set to the
-    // size of utf8_src.
-    copyString8to32(&_data[0],
-                    reinterpret_cast<const unsigned char*>(&utf8_src.rawData()[0]),
-                    _data.size(),
-                    resultSize,
-                    result);
+    while (inputIt != endIt) {
+#ifdef MONGO_HAVE_FAST_BYTE_VECTOR
+        if (size_t(endIt - inputIt) >= ByteVector::size) {
+            // Try the fast path for 16 contiguous bytes of ASCII, which only need to be
+            // zero-extended to UTF-32. NUL bytes are excluded from the run so that the scalar
+            // path below can preserve the historical behavior of stopping the conversion at an
+            // embedded NUL.
+            auto word = ByteVector::load(&*inputIt);
+            uint32_t usableBytes = ByteVector::countInitialZeros(word.maskHigh());
+            ByteVector::Mask nulMask = word.compareEQ('\0').maskAny();
+            if (nulMask) {
+                usableBytes = std::min(usableBytes, ByteVector::countInitialZeros(nulMask));
+            }
+
+            for (uint32_t i = 0; i < usableBytes; i++) {
+                *outputIt++ = uint8_t(inputIt[i]);
+            }
+            inputIt += usableBytes;
+            if (usableBytes == ByteVector::size)
+                continue;
+            if (inputIt == endIt)
+                break;
+            // If we get here, inputIt is positioned on a byte that we know is either NUL or the
+            // start of a multi-byte sequence.
+        }
+#endif
+        const uint8_t firstByte = *inputIt++;
+
+        if (firstByte == '\0') {
+            // Stop the conversion at an embedded NUL byte, matching the behavior of the
+            // NUL-terminated conversion this code replaced.
+            break;
+        }
+
+        if (firstByte <= 0x7f) {
+            *outputIt++ = firstByte;
+            continue;
+        }
+
+        const int leadingOnes = countLeadingZeros64(~(uint64_t(firstByte) << (64 - 8)));
+        uassert(28755,
+                "text contains invalid UTF-8",
+                leadingOnes > 1 && leadingOnes <= 4 && endIt - inputIt >= leadingOnes - 1);
+
+        char32_t codepoint = firstByte & (0xff >> leadingOnes);  // mask off the size indicator.
+        for (int subByteIx = 1; subByteIx < leadingOnes; subByteIx++) {
+            const uint8_t subByte = *inputIt++;
+            uassert(28755, "text contains invalid UTF-8", (subByte & 0xc0) == 0x80);
+            codepoint <<= 6;
+            codepoint |= subByte & 0x3f;  // mask off continuation bits.
+        }
 
-    uassert(28755, "text contains invalid UTF-8", result == 0);
+        // Reject overlong encodings, UTF-16 surrogate code points, and values beyond the last
+        // Unicode code point, none of which are valid UTF-8.
+        const char32_t kMinCodepointForLength[] = {0, 0, 0x80, 0x800, 0x10000};
+        uassert(28755,
+                "text contains invalid UTF-8",
+                codepoint >= kMinCodepointForLength[leadingOnes] && codepoint <= 0x10FFFF &&
+                    !(codepoint >= 0xD800 && codepoint <= 0xDFFF));
+
+        *outputIt++ = codepoint;
+    }
 
     // Resize _data so it is only as big as what it contains.
-    _data.resize(resultSize);
+    _data.resize(outputIt - _data.begin());
     _needsOutputConversion = true;
 }
 
@@ -86,6 +86,22 @@ TEST(UnicodeString, SubstrTest) {
     ASSERT_EQ("", indexes.substrToBuf(&buf, 1, 0));   // len == 0.
 }
 
+TEST(UnicodeString, UTF8ToUTF32Conversion) {
+    // Verify round-tripping through both the vectored ASCII path and the scalar multi-byte path,
+    // including input that switches between the two.
+    const std::string ascii = "The quick brown fox jumps over the lazy dog";
+    ASSERT_EQ(ascii, String(ascii).toString());
+
+    const std::string mixed = UTF8("cafétéria") + filler + UTF8("διακριτικός") + filler;
+    ASSERT_EQ(mixed, String(mixed).toString());
+
+    // The conversion stops at an embedded NUL byte.
+    std::string withNul = filler;
+    withNul.push_back('\0');
+    withNul += filler;
+    ASSERT_EQ(filler, String(StringData(withNul.data(), withNul.size())).toString());
+}
+
 TEST(UnicodeString, RemoveDiacritics) {
     // Test all ascii chars.
     for (unsigned char ch = 0; ch <= 0x7F; ch++) {
@@ -218,10 +234,14 @@ TEST(UnicodeString, BadUTF8) {
                              static_cast<char>(0x64),
                              0};
 
+    // Truncated multi-byte sequence at the end of the input.
+    const char invalid5[] = {C(0xE4), C(0xBA), 0};
+
     ASSERT_THROWS(String(invalid1), AssertionException);
     ASSERT_THROWS(String(invalid2), AssertionException);
     ASSERT_THROWS(String(invalid3), AssertionException);
     ASSERT_THROWS(String(invalid4), AssertionException);
+    ASSERT_THROWS(String(invalid5), AssertionException);
 
     StackBufBuilder buf;
 
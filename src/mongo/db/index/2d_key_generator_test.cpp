@@ -48,10 +48,10 @@ using namespace mongo;
 
 namespace {
 
-std::string dumpKeyset(const BSONObjSet& objs) {
+std::string dumpKeyset(const BSONObjFlatSet& objs) {
     std::stringstream ss;
     ss << "[ ";
-    for (BSONObjSet::iterator i = objs.begin(); i != objs.end(); ++i) {
+    for (BSONObjFlatSet::iterator i = objs.begin(); i != objs.end(); ++i) {
         ss << i->toString() << " ";
     }
     ss << "]";
@@ -59,7 +59,7 @@ std::string dumpKeyset(const BSONObjSet& objs) {
     return ss.str();
 }
 
-bool assertKeysetsEqual(const BSONObjSet& expectedKeys, const BSONObjSet& actualKeys) {
+bool assertKeysetsEqual(const BSONObjFlatSet& expectedKeys, const BSONObjFlatSet& actualKeys) {
     if (expectedKeys.size() != actualKeys.size()) {
         log() << "Expected: " << dumpKeyset(expectedKeys) << ", "
               << "Actual: " << dumpKeyset(actualKeys);
@@ -91,10 +91,10 @@ TEST(2dKeyGeneratorTest, TrailingField) {
     BSONObj infoObj = fromjson("{key: {a: '2d', b: 1}}");
     TwoDIndexingParams params;
     ExpressionParams::parseTwoDParams(infoObj, &params);
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     ExpressionKeysPrivate::get2DKeys(obj, params, &actualKeys);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     BSONObj trailingFields = BSON("" << 5);
     expectedKeys.insert(make2DKey(params, 0, 0, trailingFields.firstElement()));
 
@@ -106,10 +106,10 @@ TEST(2dKeyGeneratorTest, ArrayTrailingField) {
     BSONObj infoObj = fromjson("{key: {a: '2d', b: 1}}");
     TwoDIndexingParams params;
     ExpressionParams::parseTwoDParams(infoObj, &params);
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     ExpressionKeysPrivate::get2DKeys(obj, params, &actualKeys);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     BSONObj trailingFields = BSON("" << BSON_ARRAY(5 << 6));
     expectedKeys.insert(make2DKey(params, 0, 0, trailingFields.firstElement()));
 
@@ -121,10 +121,10 @@ TEST(2dKeyGeneratorTest, ArrayOfObjectsTrailingField) {
     BSONObj infoObj = fromjson("{key: {a: '2d', 'b.c': 1}}");
     TwoDIndexingParams params;
     ExpressionParams::parseTwoDParams(infoObj, &params);
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     ExpressionKeysPrivate::get2DKeys(obj, params, &actualKeys);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     BSONObj trailingFields = BSON("" << BSON_ARRAY(5 << 6));
     expectedKeys.insert(make2DKey(params, 0, 0, trailingFields.firstElement()));
 
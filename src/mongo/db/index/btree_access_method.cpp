@@ -61,8 +61,8 @@ BtreeAccessMethod::BtreeAccessMethod(IndexCatalogEntry* btreeState, SortedDataIn
 }
 
 void BtreeAccessMethod::doGetKeys(const BSONObj& obj,
-                                  BSONObjSet* keys,
-                                  BSONObjSet* multikeyMetadataKeys,
+                                  BSONObjFlatSet* keys,
+                                  BSONObjFlatSet* multikeyMetadataKeys,
                                   MultikeyPaths* multikeyPaths) const {
     _keyGenerator->getKeys(obj, keys, multikeyPaths);
 }
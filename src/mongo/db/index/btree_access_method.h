@@ -50,8 +50,8 @@ public:
 
 private:
     void doGetKeys(const BSONObj& obj,
-                   BSONObjSet* keys,
-                   BSONObjSet* multikeyMetadataKeys,
+                   BSONObjFlatSet* keys,
+                   BSONObjFlatSet* multikeyMetadataKeys,
                    MultikeyPaths* multikeyPaths) const final;
 
     // Our keys differ for V0 and V1.
@@ -72,10 +72,14 @@ BtreeKeyGenerator::BtreeKeyGenerator(std::vector<const char*> fieldNames,
     _nullKey = nullKeyBuilder.obj();
 
     _isIdIndex = fieldNames.size() == 1 && std::string("_id") == fieldNames[0];
+    _allPathsSingleComponent = true;
     for (const char* fieldName : fieldNames) {
         size_t pathLength = FieldRef{fieldName}.numParts();
         invariant(pathLength > 0);
         _pathLengths.push_back(pathLength);
+        if (pathLength > 1) {
+            _allPathsSingleComponent = false;
+        }
     }
 }
 
@@ -120,7 +124,7 @@ BSONElement BtreeKeyGenerator::_extractNextElement(const BSONObj& obj,
 void BtreeKeyGenerator::_getKeysArrEltFixed(std::vector<const char*>* fieldNames,
                                             std::vector<BSONElement>* fixed,
                                             const BSONElement& arrEntry,
-                                            BSONObjSet* keys,
+                                            BSONObjFlatSet* keys,
                                             unsigned numNotFound,
                                             const BSONElement& arrObjElt,
                                             const std::set<size_t>& arrIdxs,
@@ -145,7 +149,7 @@ void BtreeKeyGenerator::_getKeysArrEltFixed(std::vector<const char*>* fieldNames
 }
 
 void BtreeKeyGenerator::getKeys(const BSONObj& obj,
-                                BSONObjSet* keys,
+                                BSONObjFlatSet* keys,
                                 MultikeyPaths* multikeyPaths) const {
     if (_isIdIndex) {
         // we special case for speed
@@ -176,19 +180,53 @@ void BtreeKeyGenerator::getKeys(const BSONObj& obj,
             invariant(multikeyPaths->empty());
             multikeyPaths->resize(_fieldNames.size());
         }
-        // '_fieldNames' and '_fixed' are passed by value so that their copies can be mutated as
-        // part of the _getKeysWithArray method.
-        _getKeysWithArray(_fieldNames, _fixed, obj, keys, 0, _emptyPositionalInfo, multikeyPaths);
+        if (_allPathsSingleComponent && _tryGetKeysWithoutArrays(obj, keys)) {
+            // Key generated directly; no array values means no multikey components to record.
+        } else {
+            // '_fieldNames' and '_fixed' are passed by value so that their copies can be mutated
+            // as part of the _getKeysWithArray method.
+            _getKeysWithArray(
+                _fieldNames, _fixed, obj, keys, 0, _emptyPositionalInfo, multikeyPaths);
+        }
     }
     if (keys->empty() && !_isSparse) {
         keys->insert(_nullKey);
     }
 }
 
+bool BtreeKeyGenerator::_tryGetKeysWithoutArrays(const BSONObj& obj, BSONObjFlatSet* keys) const {
+    dassert(_allPathsSingleComponent);
+
+    // With single-component paths and no array values, each indexed field is just a top-level
+    // element of 'obj', so the single key can be built in one pass without copying the field name
+    // and fixed-element vectors or recursing. This mirrors what _getKeysWithArray() produces when
+    // its array-expansion logic never fires: missing fields become null, and a sparse index
+    // generates no key when every field is missing.
+    BSONObjBuilder b(_sizeTracker);
+    unsigned numNotFound = 0;
+    for (const char* fieldName : _fieldNames) {
+        BSONElement e = obj.getField(fieldName);
+        if (e.eoo()) {
+            ++numNotFound;
+            CollationIndexKey::collationAwareIndexKeyAppend(nullElt, _collator, &b);
+        } else if (e.type() == Array) {
+            return false;
+        } else {
+            CollationIndexKey::collationAwareIndexKeyAppend(e, _collator, &b);
+        }
+    }
+
+    if (_isSparse && numNotFound == _fieldNames.size()) {
+        return true;
+    }
+    keys->insert(b.obj());
+    return true;
+}
+
 void BtreeKeyGenerator::_getKeysWithArray(std::vector<const char*> fieldNames,
                                           std::vector<BSONElement> fixed,
                                           const BSONObj& obj,
-                                          BSONObjSet* keys,
+                                          BSONObjFlatSet* keys,
                                           unsigned numNotFound,
                                           const std::vector<PositionalPathInfo>& positionalInfo,
                                           MultikeyPaths* multikeyPaths) const {
@@ -67,13 +67,19 @@ public:
      * element with the prefixes of the indexed field that would cause this index to be multikey as
      * a result of inserting 'keys'.
      */
-    void getKeys(const BSONObj& obj, BSONObjSet* keys, MultikeyPaths* multikeyPaths) const;
+    void getKeys(const BSONObj& obj, BSONObjFlatSet* keys, MultikeyPaths* multikeyPaths) const;
 
 private:
     // These are used by getKeys below.
     std::vector<const char*> _fieldNames;
     bool _isIdIndex;
     bool _isSparse;
+
+    // True when every indexed path consists of a single component, i.e. no field name in the key
+    // pattern is dotted. Such indexes can generate their keys without the generic array-expansion
+    // machinery whenever the indexed values aren't arrays. See _tryGetKeysWithoutArrays().
+    bool _allPathsSingleComponent;
+
     BSONObj _nullKey;  // A full key with all fields null.
     BSONSizeTracker _sizeTracker;
 
@@ -131,13 +137,21 @@ private:
         const char* remainingPath;
     };
 
+    /**
+     * Fast path for key patterns whose paths are all single-component. Extracts each indexed
+     * field from the top level of 'obj' and, provided none of the values are arrays, builds the
+     * single key directly and returns true. Returns false without modifying 'keys' if any indexed
+     * value is an array, in which case the caller must fall back to _getKeysWithArray().
+     */
+    bool _tryGetKeysWithoutArrays(const BSONObj& obj, BSONObjFlatSet* keys) const;
+
     /**
      * This recursive method does the heavy-lifting for getKeys().
      */
     void _getKeysWithArray(std::vector<const char*> fieldNames,
                            std::vector<BSONElement> fixed,
                            const BSONObj& obj,
-                           BSONObjSet* keys,
+                           BSONObjFlatSet* keys,
                            unsigned numNotFound,
                            const std::vector<PositionalPathInfo>& positionalInfo,
                            MultikeyPaths* multikeyPaths) const;
@@ -188,7 +202,7 @@ private:
     void _getKeysArrEltFixed(std::vector<const char*>* fieldNames,
                              std::vector<BSONElement>* fixed,
                              const BSONElement& arrEntry,
-                             BSONObjSet* keys,
+                             BSONObjFlatSet* keys,
                              unsigned numNotFound,
                              const BSONElement& arrObjElt,
                              const std::set<size_t>& arrIdxs,
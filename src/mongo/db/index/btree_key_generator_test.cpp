@@ -55,10 +55,10 @@ namespace {
 // Helper functions
 //
 
-std::string dumpKeyset(const BSONObjSet& objs) {
+std::string dumpKeyset(const BSONObjFlatSet& objs) {
     std::stringstream ss;
     ss << "[ ";
-    for (BSONObjSet::iterator i = objs.begin(); i != objs.end(); ++i) {
+    for (BSONObjFlatSet::iterator i = objs.begin(); i != objs.end(); ++i) {
         ss << i->toString() << " ";
     }
     ss << "]";
@@ -82,7 +82,7 @@ std::string dumpMultikeyPaths(const MultikeyPaths& multikeyPaths) {
     return ss.str();
 }
 
-bool keysetsEqual(const BSONObjSet& expectedKeys, const BSONObjSet& actualKeys) {
+bool keysetsEqual(const BSONObjFlatSet& expectedKeys, const BSONObjFlatSet& actualKeys) {
     if (expectedKeys.size() != actualKeys.size()) {
         return false;
     }
@@ -99,7 +99,7 @@ bool keysetsEqual(const BSONObjSet& expectedKeys, const BSONObjSet& actualKeys)
 
 bool testKeygen(const BSONObj& kp,
                 const BSONObj& obj,
-                const BSONObjSet& expectedKeys,
+                const BSONObjFlatSet& expectedKeys,
                 const MultikeyPaths& expectedMultikeyPaths,
                 bool sparse = false,
                 const CollatorInterface* collator = nullptr) {
@@ -126,7 +126,7 @@ bool testKeygen(const BSONObj& kp,
     // the indexed fields that would cause the index to be multikey as a result of inserting
     // 'actualKeys'.
     //
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     keyGen->getKeys(obj, &actualKeys, &actualMultikeyPaths);
 
@@ -157,7 +157,7 @@ bool testKeygen(const BSONObj& kp,
 TEST(BtreeKeyGeneratorTest, GetIdKeyFromObject) {
     BSONObj keyPattern = fromjson("{_id: 1}");
     BSONObj genKeysFrom = fromjson("{_id: 'foo', b: 4}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 'foo'}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -166,7 +166,7 @@ TEST(BtreeKeyGeneratorTest, GetIdKeyFromObject) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromObjectSimple) {
     BSONObj keyPattern = fromjson("{a: 1}");
     BSONObj genKeysFrom = fromjson("{b: 4, a: 5}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 5}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -175,7 +175,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromObjectSimple) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromObjectDotted) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: {b: 4}, c: 'foo'}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 4}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -184,7 +184,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromObjectDotted) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromArraySimple) {
     BSONObj keyPattern = fromjson("{a: 1}");
     BSONObj genKeysFrom = fromjson("{a: [1, 2, 3]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     expectedKeys.insert(fromjson("{'': 2}"));
     expectedKeys.insert(fromjson("{'': 3}"));
@@ -195,7 +195,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromArraySimple) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromArrayWithIdenticalValues) {
     BSONObj keyPattern = fromjson("{a: 1}");
     BSONObj genKeysFrom = fromjson("{a: [0, 0, 0]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 0}"));
     MultikeyPaths expectedMultikeyPaths{{0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -204,7 +204,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromArrayWithIdenticalValues) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromArrayWithEquivalentValues) {
     BSONObj keyPattern = fromjson("{a: 1}");
     BSONObj genKeysFrom = fromjson("{a: [0, NumberInt(0), NumberLong(0)]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 0}"));
     MultikeyPaths expectedMultikeyPaths{{0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -213,7 +213,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromArrayWithEquivalentValues) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromArrayFirstElement) {
     BSONObj keyPattern = fromjson("{a: 1, b: 1}");
     BSONObj genKeysFrom = fromjson("{a: [1, 2, 3], b: 2}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1, '': 2}"));
     expectedKeys.insert(fromjson("{'': 2, '': 2}"));
     expectedKeys.insert(fromjson("{'': 3, '': 2}"));
@@ -224,7 +224,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromArrayFirstElement) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromArraySecondElement) {
     BSONObj keyPattern = fromjson("{first: 1, a: 1}");
     BSONObj genKeysFrom = fromjson("{first: 5, a: [1, 2, 3]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 5, '': 1}"));
     expectedKeys.insert(fromjson("{'': 5, '': 2}"));
     expectedKeys.insert(fromjson("{'': 5, '': 3}"));
@@ -235,7 +235,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromArraySecondElement) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromSecondLevelArray) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: {b: [1, 2, 3]}}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     expectedKeys.insert(fromjson("{'': 2}"));
     expectedKeys.insert(fromjson("{'': 3}"));
@@ -246,7 +246,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromSecondLevelArray) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromParallelArraysBasic) {
     BSONObj keyPattern = fromjson("{'a': 1, 'b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [1, 2, 3], b: [1, 2, 3]}}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths expectedMultikeyPaths(keyPattern.nFields());
     ASSERT_THROWS(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths),
                   AssertionException);
@@ -255,7 +255,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromParallelArraysBasic) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromArraySubobjectBasic) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [{b:1,c:4}, {b:2,c:4}, {b:3,c:4}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     expectedKeys.insert(fromjson("{'': 2}"));
     expectedKeys.insert(fromjson("{'': 3}"));
@@ -266,7 +266,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromArraySubobjectBasic) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromSubobjectWithArrayOfSubobjects) {
     BSONObj keyPattern = fromjson("{'a.b.c': 1}");
     BSONObj genKeysFrom = fromjson("{a: {b: [{c: 1}, {c: 2}]}}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     expectedKeys.insert(fromjson("{'': 2}"));
     MultikeyPaths expectedMultikeyPaths{{1U}};
@@ -276,7 +276,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromSubobjectWithArrayOfSubobjects) {
 TEST(BtreeKeyGeneratorTest, GetKeysArraySubobjectCompoundIndex) {
     BSONObj keyPattern = fromjson("{'a.b': 1, d: 99}");
     BSONObj genKeysFrom = fromjson("{a: [{b:1,c:4}, {b:2,c:4}, {b:3,c:4}], d: 99}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1, '': 99}"));
     expectedKeys.insert(fromjson("{'': 2, '': 99}"));
     expectedKeys.insert(fromjson("{'': 3, '': 99}"));
@@ -287,7 +287,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysArraySubobjectCompoundIndex) {
 TEST(BtreeKeyGeneratorTest, GetKeysArraySubobjectSingleMissing) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [{foo: 41}, {b:1,c:4}, {b:2,c:4}, {b:3,c:4}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null}"));
     expectedKeys.insert(fromjson("{'': 1}"));
     expectedKeys.insert(fromjson("{'': 2}"));
@@ -299,7 +299,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysArraySubobjectSingleMissing) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromArraySubobjectMissing) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [{foo: 41}, {foo: 41}, {foo: 41}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null}"));
     MultikeyPaths expectedMultikeyPaths{{0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -308,7 +308,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromArraySubobjectMissing) {
 TEST(BtreeKeyGeneratorTest, GetKeysMissingField) {
     BSONObj keyPattern = fromjson("{a: 1}");
     BSONObj genKeysFrom = fromjson("{b: 1}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -317,7 +317,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysMissingField) {
 TEST(BtreeKeyGeneratorTest, GetKeysSubobjectMissing) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [1, 2]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null}"));
     MultikeyPaths expectedMultikeyPaths{{0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -326,7 +326,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysSubobjectMissing) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromCompound) {
     BSONObj keyPattern = fromjson("{x: 1, y: 1}");
     BSONObj genKeysFrom = fromjson("{x: 'a', y: 'b'}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 'a', '': 'b'}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}, std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -335,7 +335,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromCompound) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromCompoundMissing) {
     BSONObj keyPattern = fromjson("{x: 1, y: 1}");
     BSONObj genKeysFrom = fromjson("{x: 'a'}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 'a', '': null}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}, std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -344,7 +344,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromCompoundMissing) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromArraySubelementComplex) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a:[{b:[2]}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 2}"));
     // Both the 'a' and 'a.b' arrays contain a single element, so they are considered multikey.
     MultikeyPaths expectedMultikeyPaths{{0U, 1U}};
@@ -354,7 +354,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromArraySubelementComplex) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromParallelArraysComplex) {
     BSONObj keyPattern = fromjson("{'a.b': 1, 'a.c': 1}");
     BSONObj genKeysFrom = fromjson("{a:[{b:[1],c:[2]}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths expectedMultikeyPaths(keyPattern.nFields());
     ASSERT_THROWS(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths),
                   AssertionException);
@@ -363,7 +363,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromParallelArraysComplex) {
 TEST(BtreeKeyGeneratorTest, GetKeysAlternateMissing) {
     BSONObj keyPattern = fromjson("{'a.b': 1, 'a.c': 1}");
     BSONObj genKeysFrom = fromjson("{a:[{b:1},{c:2}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null, '': 2}"));
     expectedKeys.insert(fromjson("{'': 1, '': null}"));
     MultikeyPaths expectedMultikeyPaths{{0U}, {0U}};
@@ -373,7 +373,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysAlternateMissing) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromMultiComplex) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a:[{b:1},{b:[1,2,3]}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     expectedKeys.insert(fromjson("{'': 2}"));
     expectedKeys.insert(fromjson("{'': 3}"));
@@ -384,7 +384,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromMultiComplex) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromArrayOfSubobjectsWithArrayValues) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [{b: [1, 2]}, {b: [2, 3]}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     expectedKeys.insert(fromjson("{'': 2}"));
     expectedKeys.insert(fromjson("{'': 3}"));
@@ -395,7 +395,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromArrayOfSubobjectsWithArrayValues) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromArrayOfSubobjectsWithNonDistinctArrayValues) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [{b: [1, 2, 3]}, {b: [2]}, {b: [3, 1]}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     expectedKeys.insert(fromjson("{'': 2}"));
     expectedKeys.insert(fromjson("{'': 3}"));
@@ -406,7 +406,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromArrayOfSubobjectsWithNonDistinctArrayValu
 TEST(BtreeKeyGeneratorTest, GetKeysArrayEmpty) {
     BSONObj keyPattern = fromjson("{a: 1}");
     BSONObj genKeysFrom = fromjson("{a:[1,2]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     expectedKeys.insert(fromjson("{'': 2}"));
     MultikeyPaths expectedMultikeyPaths{{0U}};
@@ -432,7 +432,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysArrayEmpty) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromDoubleArray) {
     BSONObj keyPattern = fromjson("{a: 1, a: 1}");
     BSONObj genKeysFrom = fromjson("{a:[1,2]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1, '': 1}"));
     expectedKeys.insert(fromjson("{'': 2, '': 2}"));
     MultikeyPaths expectedMultikeyPaths{{0U}, {0U}};
@@ -442,7 +442,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromDoubleArray) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromDoubleEmptyArray) {
     BSONObj keyPattern = fromjson("{a: 1, a: 1}");
     BSONObj genKeysFrom = fromjson("{a:[]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': undefined, '': undefined}"));
     MultikeyPaths expectedMultikeyPaths{{0U}, {0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -451,7 +451,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromDoubleEmptyArray) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromMultiEmptyArray) {
     BSONObj keyPattern = fromjson("{a: 1, b: 1}");
     BSONObj genKeysFrom = fromjson("{a: 1, b: [1, 2]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1, '': 1}"));
     expectedKeys.insert(fromjson("{'': 1, '': 2}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}, {0U}};
@@ -471,7 +471,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromMultiEmptyArray) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromNestedEmptyArray) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a:[]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null}"));
     MultikeyPaths expectedMultikeyPaths{{0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -480,7 +480,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromNestedEmptyArray) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromMultiNestedEmptyArray) {
     BSONObj keyPattern = fromjson("{'a.b': 1, 'a.c': 1}");
     BSONObj genKeysFrom = fromjson("{a:[]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null, '': null}"));
     MultikeyPaths expectedMultikeyPaths{{0U}, {0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -489,7 +489,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromMultiNestedEmptyArray) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromUnevenNestedEmptyArray) {
     BSONObj keyPattern = fromjson("{'a': 1, 'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a:[]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': undefined, '': null}"));
     MultikeyPaths expectedMultikeyPaths{{0U}, {0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -509,7 +509,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromUnevenNestedEmptyArray) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromReverseUnevenNestedEmptyArray) {
     BSONObj keyPattern = fromjson("{'a.b': 1, 'a': 1}");
     BSONObj genKeysFrom = fromjson("{a:[]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null, '': undefined}"));
     MultikeyPaths expectedMultikeyPaths{{0U}, {0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -519,7 +519,7 @@ TEST(BtreeKeyGeneratorTest, SparseReverseUnevenNestedEmptyArray) {
     const bool sparse = true;
     BSONObj keyPattern = fromjson("{'a.b': 1, 'a': 1}");
     BSONObj genKeysFrom = fromjson("{a:[]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null, '': undefined}"));
     MultikeyPaths expectedMultikeyPaths{{0U}, {0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths, sparse));
@@ -529,7 +529,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromSparseEmptyArray) {
     const bool sparse = true;
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a:1}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths, sparse));
 
@@ -545,7 +545,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromSparseEmptyArraySecond) {
     const bool sparse = true;
     BSONObj keyPattern = fromjson("{z: 1, 'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a:1}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}, std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths, sparse));
 
@@ -561,7 +561,7 @@ TEST(BtreeKeyGeneratorTest, SparseNonObjectMissingNestedField) {
     const bool sparse = true;
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a:[]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths expectedMultikeyPaths{{0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths, sparse));
 
@@ -577,7 +577,7 @@ TEST(BtreeKeyGeneratorTest, SparseNonObjectMissingNestedField) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromIndexedArrayIndex) {
     BSONObj keyPattern = fromjson("{'a.0': 1}");
     BSONObj genKeysFrom = fromjson("{a:[1]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -615,7 +615,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromIndexedArrayIndex) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromDoubleIndexedArrayIndex) {
     BSONObj keyPattern = fromjson("{'a.0.0': 1}");
     BSONObj genKeysFrom = fromjson("{a:[[1]]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -644,7 +644,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromDoubleIndexedArrayIndex) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromObjectWithinArray) {
     BSONObj keyPattern = fromjson("{'a.0.b': 1}");
     BSONObj genKeysFrom = fromjson("{a:[{b:1}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -691,7 +691,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromObjectWithinArray) {
 TEST(BtreeKeyGeneratorTest, GetKeysPositionalElementIsExpandedArray) {
     BSONObj keyPattern = fromjson("{'a.0.b': 1}");
     BSONObj genKeysFrom = fromjson("{a:[[{b:1}, {b:2}]]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     expectedKeys.insert(fromjson("{'': 2}"));
     MultikeyPaths expectedMultikeyPaths{{1U}};
@@ -701,7 +701,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysPositionalElementIsExpandedArray) {
 TEST(BtreeKeyGeneratorTest, GetKeysTrailingPositionalElementIsSingletonArray) {
     BSONObj keyPattern = fromjson("{'a.b.c.3': 1}");
     BSONObj genKeysFrom = fromjson("{a:{b:{c:[0,1,2,[3]]}}}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': [3]}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -710,7 +710,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysTrailingPositionalElementIsSingletonArray) {
 TEST(BtreeKeyGeneratorTest, GetKeysTrailingPositionalElementIsEmptyArray) {
     BSONObj keyPattern = fromjson("{'a.b.c.3': 1}");
     BSONObj genKeysFrom = fromjson("{a:{b:{c:[0,1,2,[]]}}}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': undefined}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -719,7 +719,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysTrailingPositionalElementIsEmptyArray) {
 TEST(BtreeKeyGeneratorTest, GetKeysManyPositionalElementsComplex) {
     BSONObj keyPattern = fromjson("{'a.0.1.2.b.0': 1}");
     BSONObj genKeysFrom = fromjson("{a:[[1, [1, 2, [{b: [[], 2]}]]], 1]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': undefined}"));
     MultikeyPaths expectedMultikeyPaths{{3U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -728,7 +728,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysManyPositionalElementsComplex) {
 TEST(BtreeKeyGeneratorTest, GetKeysFromArrayWithinObjectWithinArray) {
     BSONObj keyPattern = fromjson("{'a.0.b.0': 1}");
     BSONObj genKeysFrom = fromjson("{a:[{b:[1]}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -737,7 +737,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromArrayWithinObjectWithinArray) {
 TEST(BtreeKeyGeneratorTest, ParallelArraysInNestedObjects) {
     BSONObj keyPattern = fromjson("{'a.a': 1, 'b.a': 1}");
     BSONObj genKeysFrom = fromjson("{a:{a:[1]}, b:{a:[1]}}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths expectedMultikeyPaths(keyPattern.nFields());
     ASSERT_THROWS(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths),
                   AssertionException);
@@ -746,7 +746,7 @@ TEST(BtreeKeyGeneratorTest, ParallelArraysInNestedObjects) {
 TEST(BtreeKeyGeneratorTest, ParallelArraysUneven) {
     BSONObj keyPattern = fromjson("{'b.a': 1, 'a': 1}");
     BSONObj genKeysFrom = fromjson("{b:{a:[1]}, a:[1,2]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths expectedMultikeyPaths(keyPattern.nFields());
     ASSERT_THROWS(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths),
                   AssertionException);
@@ -755,7 +755,7 @@ TEST(BtreeKeyGeneratorTest, ParallelArraysUneven) {
 TEST(BtreeKeyGeneratorTest, MultipleArraysNotParallel) {
     BSONObj keyPattern = fromjson("{'a.b.c': 1}");
     BSONObj genKeysFrom = fromjson("{a: [1, 2, {b: {c: [3, 4]}}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null}"));
     expectedKeys.insert(fromjson("{'': 3}"));
     expectedKeys.insert(fromjson("{'': 4}"));
@@ -766,7 +766,7 @@ TEST(BtreeKeyGeneratorTest, MultipleArraysNotParallel) {
 TEST(BtreeKeyGeneratorTest, MultipleArraysNotParallelCompound) {
     BSONObj keyPattern = fromjson("{'a.b.c': 1, 'a.b.d': 1}");
     BSONObj genKeysFrom = fromjson("{a: [1, 2, {b: {c: [3, 4], d: 5}}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null, '': null}"));
     expectedKeys.insert(fromjson("{'': 3, '': 5}"));
     expectedKeys.insert(fromjson("{'': 4, '': 5}"));
@@ -777,7 +777,7 @@ TEST(BtreeKeyGeneratorTest, MultipleArraysNotParallelCompound) {
 TEST(BtreeKeyGeneratorTest, GetKeysComplexNestedArrays) {
     BSONObj keyPattern = fromjson("{'a.b.c.d': 1, 'a.g': 1, 'a.b.f': 1, 'a.b.c': 1, 'a.b.e': 1}");
     BSONObj genKeysFrom = fromjson("{a: [1, {b: [2, {c: [3, {d: 1}], e: 4}, 5, {f: 6}], g: 7}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'':null, '':null, '':null, '':null, '':null}"));
     expectedKeys.insert(fromjson("{'':null, '':7, '':null, '':null, '':null}"));
     expectedKeys.insert(fromjson("{'':null, '':7, '':null, '':3, '':4}"));
@@ -791,7 +791,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysComplexNestedArrays) {
 TEST(BtreeKeyGeneratorTest, GetKeys2DArray) {
     BSONObj keyPattern = fromjson("{a: 1}");
     BSONObj genKeysFrom = fromjson("{a: [[2]]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': [2]}"));
     MultikeyPaths expectedMultikeyPaths{{0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -802,7 +802,7 @@ TEST(BtreeKeyGeneratorTest, GetKeys2DArray) {
 TEST(BtreeKeyGeneratorTest, GetKeysParallelEmptyArrays) {
     BSONObj keyPattern = fromjson("{a: 1, b: 1}");
     BSONObj genKeysFrom = fromjson("{a: [], b: []}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths expectedMultikeyPaths(keyPattern.nFields());
     ASSERT_THROWS(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths),
                   AssertionException);
@@ -811,7 +811,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysParallelEmptyArrays) {
 TEST(BtreeKeyGeneratorTest, GetKeysParallelArraysOneArrayEmpty) {
     BSONObj keyPattern = fromjson("{a: 1, b: 1}");
     BSONObj genKeysFrom = fromjson("{a: [], b: [1, 2, 3]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths expectedMultikeyPaths(keyPattern.nFields());
     ASSERT_THROWS(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths),
                   AssertionException);
@@ -820,7 +820,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysParallelArraysOneArrayEmpty) {
 TEST(BtreeKeyGeneratorTest, GetKeysParallelArraysOneArrayEmptyNested) {
     BSONObj keyPattern = fromjson("{'a.b.c': 1, 'a.b.d': 1}");
     BSONObj genKeysFrom = fromjson("{a: [{b: [{c: [1, 2, 3], d: []}]}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths expectedMultikeyPaths(keyPattern.nFields());
     ASSERT_THROWS(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths),
                   AssertionException);
@@ -830,7 +830,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysParallelArraysOneArrayEmptyNested) {
 TEST(BtreeKeyGeneratorTest, GetKeysPositionalKeyPatternMissingElement) {
     BSONObj keyPattern = fromjson("{'a.2': 1}");
     BSONObj genKeysFrom = fromjson("{a: [{'2': 5}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 5}"));
     MultikeyPaths expectedMultikeyPaths{{0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -840,7 +840,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysPositionalKeyPatternMissingElement) {
 TEST(BtreeKeyGeneratorTest, GetKeysPositionalKeyPatternNestedArray) {
     BSONObj keyPattern = fromjson("{'a.2': 1}");
     BSONObj genKeysFrom = fromjson("{a: [[1, 2, 5]]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null}"));
     MultikeyPaths expectedMultikeyPaths{{0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -850,7 +850,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysPositionalKeyPatternNestedArray) {
 TEST(BtreeKeyGeneratorTest, GetKeysPositionalKeyPatternNestedArray2) {
     BSONObj keyPattern = fromjson("{'a.2': 1}");
     BSONObj genKeysFrom = fromjson("{a: [[1, 2, 5], [3, 4, 6], [0, 1, 2]]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': [0, 1, 2]}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -860,7 +860,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysPositionalKeyPatternNestedArray2) {
 TEST(BtreeKeyGeneratorTest, GetKeysPositionalKeyPatternNestedArray3) {
     BSONObj keyPattern = fromjson("{'a.2': 1}");
     BSONObj genKeysFrom = fromjson("{a: [{'0': 1, '1': 2, '2': 5}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 5}"));
     MultikeyPaths expectedMultikeyPaths{{0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -870,7 +870,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysPositionalKeyPatternNestedArray3) {
 TEST(BtreeKeyGeneratorTest, GetKeysPositionalKeyPatternNestedArray4) {
     BSONObj keyPattern = fromjson("{'a.b.2': 1}");
     BSONObj genKeysFrom = fromjson("{a: [{b: [[1, 2, 5]]}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null}"));
     MultikeyPaths expectedMultikeyPaths{{0U, 1U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -880,7 +880,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysPositionalKeyPatternNestedArray4) {
 TEST(BtreeKeyGeneratorTest, GetKeysPositionalKeyPatternNestedArray5) {
     BSONObj keyPattern = fromjson("{'a.2': 1}");
     BSONObj genKeysFrom = fromjson("{a: [[1, 2, 5], {'2': 6}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null}"));
     expectedKeys.insert(fromjson("{'': 6}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{0U}};
@@ -890,7 +890,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysPositionalKeyPatternNestedArray5) {
 TEST(BtreeKeyGeneratorTest, GetNullKeyNestedArray) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [[1, 2, 5]]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null}"));
     MultikeyPaths expectedMultikeyPaths{{0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -899,7 +899,7 @@ TEST(BtreeKeyGeneratorTest, GetNullKeyNestedArray) {
 TEST(BtreeKeyGeneratorTest, GetKeysUnevenNestedArrays) {
     BSONObj keyPattern = fromjson("{a: 1, 'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [1, {b: [2, 3, 4]}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1, '': null}"));
     expectedKeys.insert(fromjson("{'': {b:[2,3,4]}, '': 2}"));
     expectedKeys.insert(fromjson("{'': {b:[2,3,4]}, '': 3}"));
@@ -913,7 +913,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysUnevenNestedArrays) {
 TEST(BtreeKeyGeneratorTest, GetKeysRepeatedFieldName) {
     BSONObj keyPattern = fromjson("{a: 1}");
     BSONObj genKeysFrom = fromjson("{a: 2, a: 3}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 2}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -924,7 +924,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysRepeatedFieldName) {
 TEST(BtreeKeyGeneratorTest, GetKeysEmptyPathPiece) {
     BSONObj keyPattern = fromjson("{'a..c': 1}");
     BSONObj genKeysFrom = fromjson("{a: {'': [{c: 1}, {c: 2}]}}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     expectedKeys.insert(fromjson("{'': 2}"));
     MultikeyPaths expectedMultikeyPaths{{1U}};
@@ -937,7 +937,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysLastPathPieceEmpty) {
     BSONObj keyPattern = fromjson("{'a.': 1}");
 
     BSONObj genKeysFrom = fromjson("{a: 2}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 2}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -951,7 +951,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysLastPathPieceEmpty) {
 TEST(BtreeKeyGeneratorTest, GetKeysFirstPathPieceEmpty) {
     BSONObj keyPattern = fromjson("{'.a': 1}");
     BSONObj genKeysFrom = fromjson("{a: 2}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -960,7 +960,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFirstPathPieceEmpty) {
 TEST(BtreeKeyGeneratorTest, GetKeysFirstPathPieceEmpty2) {
     BSONObj keyPattern = fromjson("{'.a': 1}");
     BSONObj genKeysFrom = fromjson("{'': [{a: [1, 2, 3]}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     expectedKeys.insert(fromjson("{'': 2}"));
     expectedKeys.insert(fromjson("{'': 3}"));
@@ -971,7 +971,7 @@ TEST(BtreeKeyGeneratorTest, GetKeysFirstPathPieceEmpty2) {
 TEST(BtreeKeyGeneratorTest, PositionalKeyPatternParallelArrays) {
     BSONObj keyPattern = fromjson("{a: 1, 'b.0': 1}");
     BSONObj genKeysFrom = fromjson("{a: [1], b: [2]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths expectedMultikeyPaths(keyPattern.nFields());
     ASSERT_THROWS(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths),
                   AssertionException);
@@ -980,7 +980,7 @@ TEST(BtreeKeyGeneratorTest, PositionalKeyPatternParallelArrays) {
 TEST(BtreeKeyGeneratorTest, KeyPattern_a_0_b_Extracts_b_ElementInsideSingleton2DArray) {
     BSONObj keyPattern = fromjson("{'a.0.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [[{b: 1}]]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     MultikeyPaths expectedMultikeyPaths{{1U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -989,7 +989,7 @@ TEST(BtreeKeyGeneratorTest, KeyPattern_a_0_b_Extracts_b_ElementInsideSingleton2D
 TEST(BtreeKeyGeneratorTest, KeyPattern_a_0_0_b_Extracts_b_ElementInsideSingleton2DArray) {
     BSONObj keyPattern = fromjson("{'a.0.0.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [[{b: 1}]]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -999,7 +999,7 @@ TEST(BtreeKeyGeneratorTest,
      KeyPattern_a_0_0_b_ExtractsEachValueFrom_b_ArrayInsideSingleton2DArray) {
     BSONObj keyPattern = fromjson("{'a.0.0.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [[{b: [1, 2, 3]}]]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     expectedKeys.insert(fromjson("{'': 2}"));
     expectedKeys.insert(fromjson("{'': 3}"));
@@ -1010,7 +1010,7 @@ TEST(BtreeKeyGeneratorTest,
 TEST(BtreeKeyGeneratorTest, KeyPattern_a_0_0_b_Extracts_b_ElementInsideSingleton3DArray) {
     BSONObj keyPattern = fromjson("{'a.0.0.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [[[ {b: 1} ]]]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     MultikeyPaths expectedMultikeyPaths{{2U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -1019,7 +1019,7 @@ TEST(BtreeKeyGeneratorTest, KeyPattern_a_0_0_b_Extracts_b_ElementInsideSingleton
 TEST(BtreeKeyGeneratorTest, KeyPattern_a_0_0_b_ExtractsEach_b_ElementInside3DArray) {
     BSONObj keyPattern = fromjson("{'a.0.0.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [[[{b: 1}, {b: 2}, {b: 3}]]]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 1}"));
     expectedKeys.insert(fromjson("{'': 2}"));
     expectedKeys.insert(fromjson("{'': 3}"));
@@ -1030,7 +1030,7 @@ TEST(BtreeKeyGeneratorTest, KeyPattern_a_0_0_b_ExtractsEach_b_ElementInside3DArr
 TEST(BtreeKeyGeneratorTest, KeyPattern_a_0_0_b_ExtractsNullFrom4DArray) {
     BSONObj keyPattern = fromjson("{'a.0.0.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: [[[[ {b: 1} ]]]]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': null}"));
     MultikeyPaths expectedMultikeyPaths{{2U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -1039,7 +1039,7 @@ TEST(BtreeKeyGeneratorTest, KeyPattern_a_0_0_b_ExtractsNullFrom4DArray) {
 TEST(BtreeKeyGeneratorTest, PositionalKeyPatternNestedArrays5) {
     BSONObj keyPattern = fromjson("{'a.b.1': 1}");
     BSONObj genKeysFrom = fromjson("{a: [{b: [1, 2]}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 2}"));
     MultikeyPaths expectedMultikeyPaths{{0U}};
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
@@ -1049,7 +1049,7 @@ TEST(BtreeKeyGeneratorTest, PositionalKeyPatternNestedArrays5) {
 TEST(BtreeKeyGeneratorTest, PositionalKeyPatternNestedArrays6) {
     BSONObj keyPattern = fromjson("{'a': 1, 'a.b': 1, 'a.0.b':1, 'a.b.0': 1, 'a.0.b.0': 1}");
     BSONObj genKeysFrom = fromjson("{a: [{b: [1,2]}, {b: 3}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': {b:3}, '': 3, '': 1, '': null, '': 1}"));
     expectedKeys.insert(fromjson("{'': {b:3}, '': 3, '': 2, '': null, '': 1}"));
     expectedKeys.insert(fromjson("{'': {b:[1,2]}, '': 1, '': 1, '': 1, '': 1}"));
@@ -1062,7 +1062,7 @@ TEST(BtreeKeyGeneratorTest, PositionalKeyPatternNestedArrays6) {
 TEST(BtreeKeyGeneratorTest, PositionalKeyPatternNestedArrays7) {
     BSONObj keyPattern = fromjson("{'a': 1, 'a.b': 1, 'a.0.b':1, 'a.b.0': 1, 'a.0.b.0': 1}");
     BSONObj genKeysFrom = fromjson("{a: [{b: [1,2]}, {b: {'0': 3}}]}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': {b:{'0':3}}, '': {'0':3}, '': 1, '': 3, '': 1}"));
     expectedKeys.insert(fromjson("{'': {b:{'0':3}}, '': {'0':3}, '': 2, '': 3, '': 1}"));
     expectedKeys.insert(fromjson("{'': {b:[1,2]}, '': 1, '': 1, '': 1, '': 1}"));
@@ -1074,7 +1074,7 @@ TEST(BtreeKeyGeneratorTest, PositionalKeyPatternNestedArrays7) {
 TEST(BtreeKeyGeneratorTest, GetCollationAwareIdKeyFromObject) {
     BSONObj keyPattern = fromjson("{_id: 1}");
     BSONObj genKeysFrom = fromjson("{_id: 'foo', b: 4}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 'oof'}"));
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
@@ -1085,7 +1085,7 @@ TEST(BtreeKeyGeneratorTest, GetCollationAwareIdKeyFromObject) {
 TEST(BtreeKeyGeneratorTest, GetCollationAwareKeysFromObjectSimple) {
     BSONObj keyPattern = fromjson("{a: 1}");
     BSONObj genKeysFrom = fromjson("{b: 4, a: 'foo'}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 'oof'}"));
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
@@ -1096,7 +1096,7 @@ TEST(BtreeKeyGeneratorTest, GetCollationAwareKeysFromObjectSimple) {
 TEST(BtreeKeyGeneratorTest, GetCollationAwareKeysFromObjectDotted) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: {b: 'foo'}, c: 4}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 'oof'}"));
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
@@ -1107,7 +1107,7 @@ TEST(BtreeKeyGeneratorTest, GetCollationAwareKeysFromObjectDotted) {
 TEST(BtreeKeyGeneratorTest, GetCollationAwareKeysFromArraySimple) {
     BSONObj keyPattern = fromjson("{a: 1}");
     BSONObj genKeysFrom = fromjson("{a: ['foo', 'bar', 'baz']}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 'oof'}"));
     expectedKeys.insert(fromjson("{'': 'rab'}"));
     expectedKeys.insert(fromjson("{'': 'zab'}"));
@@ -1120,7 +1120,7 @@ TEST(BtreeKeyGeneratorTest, GetCollationAwareKeysFromArraySimple) {
 TEST(BtreeKeyGeneratorTest, CollatorDoesNotAffectNonStringIdKey) {
     BSONObj keyPattern = fromjson("{_id: 1}");
     BSONObj genKeysFrom = fromjson("{_id: 5, b: 4}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 5}"));
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
@@ -1131,7 +1131,7 @@ TEST(BtreeKeyGeneratorTest, CollatorDoesNotAffectNonStringIdKey) {
 TEST(BtreeKeyGeneratorTest, CollatorDoesNotAffectNonStringKeys) {
     BSONObj keyPattern = fromjson("{a: 1}");
     BSONObj genKeysFrom = fromjson("{b: 4, a: 5}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': 5}"));
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
@@ -1142,7 +1142,7 @@ TEST(BtreeKeyGeneratorTest, CollatorDoesNotAffectNonStringKeys) {
 TEST(BtreeKeyGeneratorTest, GetCollationAwareKeysFromNestedObject) {
     BSONObj keyPattern = fromjson("{a: 1}");
     BSONObj genKeysFrom = fromjson("{b: 4, a: {c: 'foo'}}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': {c: 'oof'}}"));
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
@@ -1153,7 +1153,7 @@ TEST(BtreeKeyGeneratorTest, GetCollationAwareKeysFromNestedObject) {
 TEST(BtreeKeyGeneratorTest, GetCollationAwareKeysFromNestedArray) {
     BSONObj keyPattern = fromjson("{a: 1}");
     BSONObj genKeysFrom = fromjson("{b: 4, a: {c: ['foo', 'bar', 'baz']}}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(fromjson("{'': {c: ['oof', 'rab', 'zab']}}"));
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     MultikeyPaths expectedMultikeyPaths{std::set<size_t>{}};
@@ -68,7 +68,7 @@ namespace dps = ::mongo::dotted_path_support;
  * Insert the BSONObj into keys.
  * Used by getHaystackKeys.
  */
-void addKey(const string& root, const BSONElement& e, BSONObjSet* keys) {
+void addKey(const string& root, const BSONElement& e, BSONObjFlatSet* keys) {
     BSONObjBuilder buf;
     buf.append("", root);
 
@@ -131,7 +131,7 @@ Status S2GetKeysForElement(const BSONElement& element,
 bool getS2GeoKeys(const BSONObj& document,
                   const BSONElementSet& elements,
                   const S2IndexingParams& params,
-                  BSONObjSet* out) {
+                  BSONObjFlatSet* out) {
     bool everGeneratedMultipleCells = false;
     for (BSONElementSet::iterator i = elements.begin(); i != elements.end(); ++i) {
         vector<S2CellId> cells;
@@ -163,7 +163,9 @@ bool getS2GeoKeys(const BSONObj& document,
  * Fills 'out' with the keys that should be generated for an array value 'obj' in a 2dsphere index.
  * A key is generated for each element of the array value 'obj'.
  */
-void getS2LiteralKeysArray(const BSONObj& obj, const CollatorInterface* collator, BSONObjSet* out) {
+void getS2LiteralKeysArray(const BSONObj& obj,
+                           const CollatorInterface* collator,
+                           BSONObjFlatSet* out) {
     BSONObjIterator objIt(obj);
     if (!objIt.more()) {
         // Empty arrays are indexed as undefined.
@@ -188,7 +190,7 @@ void getS2LiteralKeysArray(const BSONObj& obj, const CollatorInterface* collator
  */
 bool getS2OneLiteralKey(const BSONElement& elt,
                         const CollatorInterface* collator,
-                        BSONObjSet* out) {
+                        BSONObjFlatSet* out) {
     if (Array == elt.type()) {
         getS2LiteralKeysArray(elt.Obj(), collator, out);
         return true;
@@ -210,7 +212,7 @@ bool getS2OneLiteralKey(const BSONElement& elt,
  */
 bool getS2LiteralKeys(const BSONElementSet& elements,
                       const CollatorInterface* collator,
-                      BSONObjSet* out) {
+                      BSONObjFlatSet* out) {
     bool foundIndexedArrayValue = false;
     if (0 == elements.size()) {
         // Missing fields are indexed as null.
@@ -237,7 +239,7 @@ using std::vector;
 // static
 void ExpressionKeysPrivate::get2DKeys(const BSONObj& obj,
                                       const TwoDIndexingParams& params,
-                                      BSONObjSet* keys) {
+                                      BSONObjFlatSet* keys) {
     BSONElementMultiSet bSet;
 
     // Get all the nested location fields, but don't return individual elements from
@@ -334,7 +336,7 @@ void ExpressionKeysPrivate::get2DKeys(const BSONObj& obj,
 // static
 void ExpressionKeysPrivate::getFTSKeys(const BSONObj& obj,
                                        const fts::FTSSpec& ftsSpec,
-                                       BSONObjSet* keys) {
+                                       BSONObjFlatSet* keys) {
     fts::FTSIndexFormat::getKeys(ftsSpec, obj, keys);
 }
 
@@ -345,7 +347,7 @@ void ExpressionKeysPrivate::getHashKeys(const BSONObj& obj,
                                         int hashVersion,
                                         bool isSparse,
                                         const CollatorInterface* collator,
-                                        BSONObjSet* keys) {
+                                        BSONObjFlatSet* keys) {
     const char* cstr = hashedField.c_str();
     BSONElement fieldVal = dps::extractElementAtPath(obj, cstr);
 
@@ -382,7 +384,7 @@ void ExpressionKeysPrivate::getHaystackKeys(const BSONObj& obj,
                                             const std::string& geoField,
                                             const std::vector<std::string>& otherFields,
                                             double bucketSize,
-                                            BSONObjSet* keys) {
+                                            BSONObjFlatSet* keys) {
     BSONElement loc = dps::extractElementAtPath(obj, geoField);
 
     if (loc.eoo()) {
@@ -446,9 +448,9 @@ std::string ExpressionKeysPrivate::makeHaystackString(int hashedX, int hashedY)
 void ExpressionKeysPrivate::getS2Keys(const BSONObj& obj,
                                       const BSONObj& keyPattern,
                                       const S2IndexingParams& params,
-                                      BSONObjSet* keys,
+                                      BSONObjFlatSet* keys,
                                       MultikeyPaths* multikeyPaths) {
-    BSONObjSet keysToAdd = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keysToAdd = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
 
     // Does one of our documents have a geo field?
     bool haveGeoField = false;
@@ -478,7 +480,7 @@ void ExpressionKeysPrivate::getS2Keys(const BSONObj& obj,
         //   (b) the last component of the indexed path ever refers to GeoJSON data that requires
         //       multiple cells for its covering.
         bool lastPathComponentCausesIndexToBeMultikey;
-        BSONObjSet keysForThisField = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+        BSONObjFlatSet keysForThisField = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
         if (IndexNames::GEO_2DSPHERE == keyElem.valuestr()) {
             if (params.indexVersion >= S2_INDEX_VERSION_2) {
                 // For >= V2,
@@ -534,9 +536,9 @@ void ExpressionKeysPrivate::getS2Keys(const BSONObj& obj,
             continue;
         }
 
-        BSONObjSet updatedKeysToAdd = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
-        for (BSONObjSet::const_iterator it = keysToAdd.begin(); it != keysToAdd.end(); ++it) {
-            for (BSONObjSet::const_iterator newIt = keysForThisField.begin();
+        BSONObjFlatSet updatedKeysToAdd = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
+        for (BSONObjFlatSet::const_iterator it = keysToAdd.begin(); it != keysToAdd.end(); ++it) {
+            for (BSONObjFlatSet::const_iterator newIt = keysForThisField.begin();
                  newIt != keysForThisField.end();
                  ++newIt) {
                 BSONObjBuilder b;
@@ -60,13 +60,15 @@ public:
     // 2d
     //
 
-    static void get2DKeys(const BSONObj& obj, const TwoDIndexingParams& params, BSONObjSet* keys);
+    static void get2DKeys(const BSONObj& obj,
+                          const TwoDIndexingParams& params,
+                          BSONObjFlatSet* keys);
 
     //
     // FTS
     //
 
-    static void getFTSKeys(const BSONObj& obj, const fts::FTSSpec& ftsSpec, BSONObjSet* keys);
+    static void getFTSKeys(const BSONObj& obj, const fts::FTSSpec& ftsSpec, BSONObjFlatSet* keys);
 
     //
     // Hash
@@ -81,7 +83,7 @@ public:
                             int hashVersion,
                             bool isSparse,
                             const CollatorInterface* collator,
-                            BSONObjSet* keys);
+                            BSONObjFlatSet* keys);
 
     /**
      * Hashing function used by both getHashKeys and the cursors we create.
@@ -101,7 +103,7 @@ public:
                                 const std::string& geoField,
                                 const std::vector<std::string>& otherFields,
                                 double bucketSize,
-                                BSONObjSet* keys);
+                                BSONObjFlatSet* keys);
 
     /**
      * Returns a hash of a BSON element.
@@ -125,7 +127,7 @@ public:
     static void getS2Keys(const BSONObj& obj,
                           const BSONObj& keyPattern,
                           const S2IndexingParams& params,
-                          BSONObjSet* keys,
+                          BSONObjFlatSet* keys,
                           MultikeyPaths* multikeyPaths);
 };
 
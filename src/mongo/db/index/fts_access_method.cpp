@@ -39,8 +39,8 @@ FTSAccessMethod::FTSAccessMethod(IndexCatalogEntry* btreeState, SortedDataInterf
     : AbstractIndexAccessMethod(btreeState, btree), _ftsSpec(btreeState->descriptor()->infoObj()) {}
 
 void FTSAccessMethod::doGetKeys(const BSONObj& obj,
-                                BSONObjSet* keys,
-                                BSONObjSet* multikeyMetadataKeys,
+                                BSONObjFlatSet* keys,
+                                BSONObjFlatSet* multikeyMetadataKeys,
                                 MultikeyPaths* multikeyPaths) const {
     ExpressionKeysPrivate::getFTSKeys(obj, _ftsSpec, keys);
 }
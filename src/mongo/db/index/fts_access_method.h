@@ -54,8 +54,8 @@ private:
      * indexes don't support tracking path-level multikey information.
      */
     void doGetKeys(const BSONObj& obj,
-                   BSONObjSet* keys,
-                   BSONObjSet* multikeyMetadataKeys,
+                   BSONObjFlatSet* keys,
+                   BSONObjFlatSet* multikeyMetadataKeys,
                    MultikeyPaths* multikeyPaths) const final;
 
     fts::FTSSpec _ftsSpec;
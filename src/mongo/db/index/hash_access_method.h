@@ -57,8 +57,8 @@ private:
      * indexes don't support tracking path-level multikey information.
      */
     void doGetKeys(const BSONObj& obj,
-                   BSONObjSet* keys,
-                   BSONObjSet* multikeyMetadataKeys,
+                   BSONObjFlatSet* keys,
+                   BSONObjFlatSet* multikeyMetadataKeys,
                    MultikeyPaths* multikeyPaths) const final;
 
     // Only one of our fields is hashed.  This is the field name for it.
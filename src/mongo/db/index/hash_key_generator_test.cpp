@@ -51,10 +51,10 @@ namespace {
 const HashSeed kHashSeed = 0;
 const int kHashVersion = 0;
 
-std::string dumpKeyset(const BSONObjSet& objs) {
+std::string dumpKeyset(const BSONObjFlatSet& objs) {
     std::stringstream ss;
     ss << "[ ";
-    for (BSONObjSet::iterator i = objs.begin(); i != objs.end(); ++i) {
+    for (BSONObjFlatSet::iterator i = objs.begin(); i != objs.end(); ++i) {
         ss << i->toString() << " ";
     }
     ss << "]";
@@ -62,7 +62,7 @@ std::string dumpKeyset(const BSONObjSet& objs) {
     return ss.str();
 }
 
-bool assertKeysetsEqual(const BSONObjSet& expectedKeys, const BSONObjSet& actualKeys) {
+bool assertKeysetsEqual(const BSONObjFlatSet& expectedKeys, const BSONObjFlatSet& actualKeys) {
     if (expectedKeys.size() != actualKeys.size()) {
         log() << "Expected: " << dumpKeyset(expectedKeys) << ", "
               << "Actual: " << dumpKeyset(actualKeys);
@@ -87,13 +87,13 @@ BSONObj makeHashKey(BSONElement elt) {
 
 TEST(HashKeyGeneratorTest, CollationAppliedBeforeHashing) {
     BSONObj obj = fromjson("{a: 'string'}");
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     ExpressionKeysPrivate::getHashKeys(
         obj, "a", kHashSeed, kHashVersion, false, &collator, &actualKeys);
 
     BSONObj backwardsObj = fromjson("{a: 'gnirts'}");
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(makeHashKey(backwardsObj["a"]));
 
     ASSERT(assertKeysetsEqual(expectedKeys, actualKeys));
@@ -101,12 +101,12 @@ TEST(HashKeyGeneratorTest, CollationAppliedBeforeHashing) {
 
 TEST(HashKeyGeneratorTest, CollationDoesNotAffectNonStringFields) {
     BSONObj obj = fromjson("{a: 5}");
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     ExpressionKeysPrivate::getHashKeys(
         obj, "a", kHashSeed, kHashVersion, false, &collator, &actualKeys);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(makeHashKey(obj["a"]));
 
     ASSERT(assertKeysetsEqual(expectedKeys, actualKeys));
@@ -115,12 +115,12 @@ TEST(HashKeyGeneratorTest, CollationDoesNotAffectNonStringFields) {
 TEST(HashKeyGeneratorTest, CollatorAppliedBeforeHashingNestedObject) {
     BSONObj obj = fromjson("{a: {b: 'string'}}");
     BSONObj backwardsObj = fromjson("{a: {b: 'gnirts'}}");
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     ExpressionKeysPrivate::getHashKeys(
         obj, "a", kHashSeed, kHashVersion, false, &collator, &actualKeys);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(makeHashKey(backwardsObj["a"]));
 
     ASSERT(assertKeysetsEqual(expectedKeys, actualKeys));
@@ -128,11 +128,11 @@ TEST(HashKeyGeneratorTest, CollatorAppliedBeforeHashingNestedObject) {
 
 TEST(HashKeyGeneratorTest, NoCollation) {
     BSONObj obj = fromjson("{a: 'string'}");
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     ExpressionKeysPrivate::getHashKeys(
         obj, "a", kHashSeed, kHashVersion, false, nullptr, &actualKeys);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(makeHashKey(obj["a"]));
 
     ASSERT(assertKeysetsEqual(expectedKeys, actualKeys));
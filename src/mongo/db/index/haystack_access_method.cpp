@@ -66,8 +66,8 @@ HaystackAccessMethod::HaystackAccessMethod(IndexCatalogEntry* btreeState,
 }
 
 void HaystackAccessMethod::doGetKeys(const BSONObj& obj,
-                                     BSONObjSet* keys,
-                                     BSONObjSet* multikeyMetadataKeys,
+                                     BSONObjFlatSet* keys,
+                                     BSONObjFlatSet* multikeyMetadataKeys,
                                      MultikeyPaths* multikeyPaths) const {
     ExpressionKeysPrivate::getHaystackKeys(obj, _geoField, _otherFields, _bucketSize, keys);
 }
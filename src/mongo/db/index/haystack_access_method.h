@@ -78,8 +78,8 @@ private:
      * geoHaystack indexes don't support tracking path-level multikey information.
      */
     void doGetKeys(const BSONObj& obj,
-                   BSONObjSet* keys,
-                   BSONObjSet* multikeyMetadataKeys,
+                   BSONObjFlatSet* keys,
+                   BSONObjFlatSet* multikeyMetadataKeys,
                    MultikeyPaths* multikeyPaths) const final;
 
     std::string _geoField;
@@ -34,6 +34,7 @@
 
 #include "mongo/db/index/btree_access_method.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -82,7 +83,7 @@ bool isMultikeyFromPaths(const MultikeyPaths& multikeyPaths) {
                        [](const std::set<std::size_t>& components) { return !components.empty(); });
 }
 
-std::vector<BSONObj> asVector(const BSONObjSet& objSet) {
+std::vector<BSONObj> asVector(const BSONObjFlatSet& objSet) {
     return {objSet.begin(), objSet.end()};
 }
 
@@ -185,8 +186,8 @@ Status AbstractIndexAccessMethod::insert(OperationContext* opCtx,
                                          InsertResult* result) {
     invariant(options.fromIndexBuilder || !_btreeState->isBuilding());
 
-    BSONObjSet multikeyMetadataKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet multikeyMetadataKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths multikeyPaths;
 
     // Delegate to the subclass.
@@ -196,8 +197,8 @@ Status AbstractIndexAccessMethod::insert(OperationContext* opCtx,
 }
 
 Status AbstractIndexAccessMethod::insertKeys(OperationContext* opCtx,
-                                             const BSONObjSet& keys,
-                                             const BSONObjSet& multikeyMetadataKeys,
+                                             const BSONObjFlatSet& keys,
+                                             const BSONObjFlatSet& multikeyMetadataKeys,
                                              const MultikeyPaths& multikeyPaths,
                                              const RecordId& loc,
                                              const InsertDeleteOptions& options,
@@ -210,32 +211,7 @@ Status AbstractIndexAccessMethod::insertKeys(OperationContext* opCtx,
     for (const auto keySet : {&keys, &multikeyMetadataKeys}) {
         const auto& recordId = (keySet == &keys ? loc : kMultikeyMetadataKeyId);
         for (const auto& key : *keySet) {
-            Status status = checkIndexKeySize ? checkKeySize(key) : Status::OK();
-            if (status.isOK()) {
-                bool unique = _descriptor->unique();
-                StatusWith<SpecialFormatInserted> ret =
-                    _newInterface->insert(opCtx, key, recordId, !unique /* dupsAllowed */);
-                status = ret.getStatus();
-
-                // When duplicates are encountered and allowed, retry with dupsAllowed. Add the
-                // key to the output vector so callers know which duplicate keys were inserted.
-                if (ErrorCodes::DuplicateKey == status.code() && options.dupsAllowed) {
-                    invariant(unique);
-                    ret = _newInterface->insert(opCtx, key, recordId, true /* dupsAllowed */);
-                    status = ret.getStatus();
-
-                    // This is speculative in that the 'dupsInserted' vector is not used by any code
-                    // today. It is currently in place to test detecting duplicate key errors during
-                    // hybrid index builds. Duplicate detection in the future will likely not take
-                    // place in this insert() method.
-                    if (status.isOK() && result) {
-                        result->dupsInserted.push_back(key);
-                    }
-                }
-
-                if (status.isOK() && ret.getValue() == SpecialFormatInserted::LongTypeBitsInserted)
-                    _btreeState->setIndexKeyStringWithLongTypeBitsExistsOnDisk(opCtx);
-            }
+            Status status = insertOneKey(opCtx, key, recordId, options, checkIndexKeySize, result);
             if (isFatalError(opCtx, status, key)) {
                 return status;
             }
@@ -246,12 +222,139 @@ Status AbstractIndexAccessMethod::insertKeys(OperationContext* opCtx,
         result->numInserted += keys.size() + multikeyMetadataKeys.size();
     }
 
+    if (!multikeyMetadataKeys.empty()) {
+        didInsertMultikeyMetadataKeys(opCtx, multikeyMetadataKeys);
+    }
+
     if (shouldMarkIndexAsMultikey(keys, multikeyMetadataKeys, multikeyPaths)) {
         _btreeState->setMultikey(opCtx, multikeyPaths);
     }
     return Status::OK();
 }
 
+Status AbstractIndexAccessMethod::insertOneKey(OperationContext* opCtx,
+                                               const BSONObj& key,
+                                               const RecordId& recordId,
+                                               const InsertDeleteOptions& options,
+                                               bool checkIndexKeySize,
+                                               InsertResult* result) {
+    Status status = checkIndexKeySize ? checkKeySize(key) : Status::OK();
+    if (!status.isOK()) {
+        return status;
+    }
+
+    bool unique = _descriptor->unique();
+    StatusWith<SpecialFormatInserted> ret =
+        _newInterface->insert(opCtx, key, recordId, !unique /* dupsAllowed */);
+    status = ret.getStatus();
+
+    // When duplicates are encountered and allowed, retry with dupsAllowed. Add the
+    // key to the output vector so callers know which duplicate keys were inserted.
+    if (ErrorCodes::DuplicateKey == status.code() && options.dupsAllowed) {
+        invariant(unique);
+        ret = _newInterface->insert(opCtx, key, recordId, true /* dupsAllowed */);
+        status = ret.getStatus();
+
+        // This is speculative in that the 'dupsInserted' vector is not used by any code
+        // today. It is currently in place to test detecting duplicate key errors during
+        // hybrid index builds. Duplicate detection in the future will likely not take
+        // place in this insert() method.
+        if (status.isOK() && result) {
+            result->dupsInserted.push_back(key);
+        }
+    }
+
+    if (status.isOK() && ret.getValue() == SpecialFormatInserted::LongTypeBitsInserted)
+        _btreeState->setIndexKeyStringWithLongTypeBitsExistsOnDisk(opCtx);
+
+    return status;
+}
+
+Status AbstractIndexAccessMethod::insertRecords(
+    OperationContext* opCtx,
+    const std::vector<std::pair<const BSONObj*, RecordId>>& records,
+    const InsertDeleteOptions& options,
+    InsertResult* result) {
+    invariant(options.fromIndexBuilder || !_btreeState->isBuilding());
+
+    // Generate the keys for every document first. Multikey metadata keys are deduplicated across
+    // the batch since they all target the reserved keyspace.
+    std::vector<std::pair<BSONObj, RecordId>> allKeys;
+    allKeys.reserve(records.size());
+    BSONObjFlatSet allMultikeyMetadataKeys =
+        SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
+    bool shouldMarkMultikey = false;
+    MultikeyPaths mergedMultikeyPaths;
+
+    // The per-document containers are hoisted out of the loop so that their storage is reused
+    // across documents; clear() retains the flat sets' capacity.
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
+    BSONObjFlatSet multikeyMetadataKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
+    MultikeyPaths multikeyPaths;
+
+    for (const auto& record : records) {
+        keys.clear();
+        multikeyMetadataKeys.clear();
+        multikeyPaths.clear();
+
+        getKeys(*record.first, options.getKeysMode, &keys, &multikeyMetadataKeys, &multikeyPaths);
+
+        for (const auto& key : keys) {
+            allKeys.emplace_back(key, record.second);
+        }
+        allMultikeyMetadataKeys.insert(multikeyMetadataKeys.begin(), multikeyMetadataKeys.end());
+
+        if (shouldMarkIndexAsMultikey(keys, multikeyMetadataKeys, multikeyPaths)) {
+            shouldMarkMultikey = true;
+            if (mergedMultikeyPaths.empty()) {
+                mergedMultikeyPaths = multikeyPaths;
+            } else {
+                invariant(mergedMultikeyPaths.size() == multikeyPaths.size());
+                for (size_t i = 0; i < multikeyPaths.size(); ++i) {
+                    mergedMultikeyPaths[i].insert(multikeyPaths[i].begin(),
+                                                  multikeyPaths[i].end());
+                }
+            }
+        }
+    }
+
+    // Insert in key order so the index is walked in one ordered pass for the whole batch.
+    std::sort(allKeys.begin(), allKeys.end(), [](const auto& lhs, const auto& rhs) {
+        const int cmp = SimpleBSONObjComparator::kInstance.compare(lhs.first, rhs.first);
+        return cmp < 0 || (cmp == 0 && lhs.second < rhs.second);
+    });
+
+    const bool checkIndexKeySize = shouldCheckIndexKeySize(opCtx);
+
+    for (const auto& keyAndLoc : allKeys) {
+        Status status = insertOneKey(
+            opCtx, keyAndLoc.first, keyAndLoc.second, options, checkIndexKeySize, result);
+        if (isFatalError(opCtx, status, keyAndLoc.first)) {
+            return status;
+        }
+    }
+    for (const auto& key : allMultikeyMetadataKeys) {
+        Status status =
+            insertOneKey(opCtx, key, kMultikeyMetadataKeyId, options, checkIndexKeySize, result);
+        if (isFatalError(opCtx, status, key)) {
+            return status;
+        }
+    }
+
+    if (result) {
+        result->numInserted += allKeys.size() + allMultikeyMetadataKeys.size();
+    }
+
+    if (!allMultikeyMetadataKeys.empty()) {
+        didInsertMultikeyMetadataKeys(opCtx, allMultikeyMetadataKeys);
+    }
+
+    if (shouldMarkMultikey) {
+        _btreeState->setMultikey(opCtx, mergedMultikeyPaths);
+    }
+    return Status::OK();
+}
+
 void AbstractIndexAccessMethod::removeOneKey(OperationContext* opCtx,
                                              const BSONObj& key,
                                              const RecordId& loc,
@@ -287,11 +390,11 @@ Status AbstractIndexAccessMethod::remove(OperationContext* opCtx,
     invariant(numDeleted);
 
     *numDeleted = 0;
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     // There's no need to compute the prefixes of the indexed fields that cause the index to be
     // multikey when removing a document since the index metadata isn't updated when keys are
     // deleted.
-    BSONObjSet* multikeyMetadataKeys = nullptr;
+    BSONObjFlatSet* multikeyMetadataKeys = nullptr;
     MultikeyPaths* multikeyPaths = nullptr;
 
     // Relax key constraints on removal when deleting documents with invalid formats, but only
@@ -303,7 +406,7 @@ Status AbstractIndexAccessMethod::remove(OperationContext* opCtx,
 }
 
 Status AbstractIndexAccessMethod::removeKeys(OperationContext* opCtx,
-                                             const BSONObjSet& keys,
+                                             const BSONObjFlatSet& keys,
                                              const RecordId& loc,
                                              const InsertDeleteOptions& options,
                                              int64_t* numDeleted) {
@@ -321,10 +424,10 @@ Status AbstractIndexAccessMethod::initializeAsEmpty(OperationContext* opCtx) {
 }
 
 Status AbstractIndexAccessMethod::touch(OperationContext* opCtx, const BSONObj& obj) {
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     // There's no need to compute the prefixes of the indexed fields that cause the index to be
     // multikey when paging a document's index entries into memory.
-    BSONObjSet* multikeyMetadataKeys = nullptr;
+    BSONObjFlatSet* multikeyMetadataKeys = nullptr;
     MultikeyPaths* multikeyPaths = nullptr;
     getKeys(obj, GetKeysMode::kEnforceConstraints, &keys, multikeyMetadataKeys, multikeyPaths);
 
@@ -347,8 +450,8 @@ RecordId AbstractIndexAccessMethod::findSingle(OperationContext* opCtx,
     BSONObj actualKey;
     if (_btreeState->getCollator()) {
         // For performance, call get keys only if there is a non-simple collation.
-        BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
-        BSONObjSet* multikeyMetadataKeys = nullptr;
+        BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
+        BSONObjFlatSet* multikeyMetadataKeys = nullptr;
         MultikeyPaths* multikeyPaths = nullptr;
         getKeys(requestedKey,
                 GetKeysMode::kEnforceConstraints,
@@ -395,7 +498,7 @@ long long AbstractIndexAccessMethod::getSpaceUsedBytes(OperationContext* opCtx)
 }
 
 pair<vector<BSONObj>, vector<BSONObj>> AbstractIndexAccessMethod::setDifference(
-    const BSONObjSet& left, const BSONObjSet& right) {
+    const BSONObjFlatSet& left, const BSONObjFlatSet& right) {
     // Two iterators to traverse the two sets in sorted order.
     auto leftIt = left.begin();
     auto rightIt = right.begin();
@@ -441,7 +544,7 @@ Status AbstractIndexAccessMethod::validateUpdate(OperationContext* opCtx,
         // There's no need to compute the prefixes of the indexed fields that possibly caused the
         // index to be multikey when the old version of the document was written since the index
         // metadata isn't updated when keys are deleted.
-        BSONObjSet* multikeyMetadataKeys = nullptr;
+        BSONObjFlatSet* multikeyMetadataKeys = nullptr;
         MultikeyPaths* multikeyPaths = nullptr;
         getKeys(from, options.getKeysMode, &ticket->oldKeys, multikeyMetadataKeys, multikeyPaths);
     }
@@ -508,6 +611,10 @@ Status AbstractIndexAccessMethod::update(OperationContext* opCtx,
         }
     }
 
+    if (!ticket.newMultikeyMetadataKeys.empty()) {
+        didInsertMultikeyMetadataKeys(opCtx, ticket.newMultikeyMetadataKeys);
+    }
+
     if (shouldMarkIndexAsMultikey(
             ticket.newKeys, ticket.newMultikeyMetadataKeys, ticket.newMultikeyPaths)) {
         _btreeState->setMultikey(opCtx, ticket.newMultikeyPaths);
@@ -561,7 +668,11 @@ private:
     // Caches the set of all multikey metadata keys generated during the bulk build process.
     // These are inserted into the sorter after all normal data keys have been added, just
     // before the bulk build is committed.
-    BSONObjSet _multikeyMetadataKeys{SimpleBSONObjComparator::kInstance.makeBSONObjSet()};
+    BSONObjFlatSet _multikeyMetadataKeys{SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet()};
+
+    // Scratch space for the keys of the document currently being inserted. Kept as a member so
+    // that the flat set's storage is reused across documents rather than reallocated per insert.
+    BSONObjFlatSet _keys{SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet()};
 };
 
 std::unique_ptr<IndexAccessMethod::BulkBuilder> AbstractIndexAccessMethod::initiateBulk(
@@ -584,10 +695,10 @@ Status AbstractIndexAccessMethod::BulkBuilderImpl::insert(OperationContext* opCt
                                                           const BSONObj& obj,
                                                           const RecordId& loc,
                                                           const InsertDeleteOptions& options) {
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    _keys.clear();
     MultikeyPaths multikeyPaths;
 
-    _real->getKeys(obj, options.getKeysMode, &keys, &_multikeyMetadataKeys, &multikeyPaths);
+    _real->getKeys(obj, options.getKeysMode, &_keys, &_multikeyMetadataKeys, &multikeyPaths);
 
     if (!multikeyPaths.empty()) {
         if (_indexMultikeyPaths.empty()) {
@@ -600,13 +711,13 @@ Status AbstractIndexAccessMethod::BulkBuilderImpl::insert(OperationContext* opCt
         }
     }
 
-    for (const auto& key : keys) {
+    for (const auto& key : _keys) {
         _sorter->add(key, loc);
         ++_keysInserted;
     }
 
-    _isMultiKey =
-        _isMultiKey || _real->shouldMarkIndexAsMultikey(keys, _multikeyMetadataKeys, multikeyPaths);
+    _isMultiKey = _isMultiKey ||
+        _real->shouldMarkIndexAsMultikey(_keys, _multikeyMetadataKeys, multikeyPaths);
 
     return Status::OK();
 }
@@ -742,8 +853,8 @@ void AbstractIndexAccessMethod::setIndexIsMultikey(OperationContext* opCtx, Mult
 
 void AbstractIndexAccessMethod::getKeys(const BSONObj& obj,
                                         GetKeysMode mode,
-                                        BSONObjSet* keys,
-                                        BSONObjSet* multikeyMetadataKeys,
+                                        BSONObjFlatSet* keys,
+                                        BSONObjFlatSet* multikeyMetadataKeys,
                                         MultikeyPaths* multikeyPaths) const {
     // TODO SERVER-36385: Remove ErrorCodes::KeyTooLong.
     static stdx::unordered_set<int> whiteList{ErrorCodes::CannotBuildIndexKeys,
@@ -801,8 +912,8 @@ void AbstractIndexAccessMethod::getKeys(const BSONObj& obj,
 }
 
 bool AbstractIndexAccessMethod::shouldMarkIndexAsMultikey(
-    const BSONObjSet& keys,
-    const BSONObjSet& multikeyMetadataKeys,
+    const BSONObjFlatSet& keys,
+    const BSONObjFlatSet& multikeyMetadataKeys,
     const MultikeyPaths& multikeyPaths) const {
     return (keys.size() > 1 || isMultikeyFromPaths(multikeyPaths));
 }
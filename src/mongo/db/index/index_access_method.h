@@ -33,6 +33,8 @@
 #include <atomic>
 #include <memory>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include "mongo/base/disallow_copying.h"
 #include "mongo/bson/simple_bsonobj_comparator.h"
@@ -94,13 +96,27 @@ public:
                           InsertResult* result) = 0;
 
     virtual Status insertKeys(OperationContext* opCtx,
-                              const BSONObjSet& keys,
-                              const BSONObjSet& multikeyMetadataKeys,
+                              const BSONObjFlatSet& keys,
+                              const BSONObjFlatSet& multikeyMetadataKeys,
                               const MultikeyPaths& multikeyPaths,
                               const RecordId& loc,
                               const InsertDeleteOptions& options,
                               InsertResult* result) = 0;
 
+    /**
+     * Batch form of insert(). Generates the keys for every (obj, loc) pair up front, then
+     * inserts them in sorted key order so the underlying index sees a single ordered pass
+     * instead of one random-access probe sequence per document. This improves cache locality
+     * when several documents are indexed in one WriteUnitOfWork.
+     *
+     * All inserts share the recovery unit's current timestamp state, so callers must not use
+     * this for batches whose records carry individual timestamps.
+     */
+    virtual Status insertRecords(OperationContext* opCtx,
+                                 const std::vector<std::pair<const BSONObj*, RecordId>>& records,
+                                 const InsertDeleteOptions& options,
+                                 InsertResult* result) = 0;
+
     /**
      * Analogous to above, but remove the records instead of inserting them.
      * 'numDeleted' will be set to the number of keys removed from the index for the document.
@@ -112,7 +128,7 @@ public:
                           int64_t* numDeleted) = 0;
 
     virtual Status removeKeys(OperationContext* opCtx,
-                              const BSONObjSet& keys,
+                              const BSONObjFlatSet& keys,
                               const RecordId& loc,
                               const InsertDeleteOptions& options,
                               int64_t* numDeleted) = 0;
@@ -317,22 +333,25 @@ public:
      * a result of inserting 'keys'.
      *
      * If the 'multikeyMetadataKeys' pointer is non-null, then the function will populate the
-     * BSONObjSet with any multikey metadata keys generated while processing the document. These
+     * BSONObjFlatSet with any multikey metadata keys generated while processing the document. These
      * keys are not associated with the document itself, but instead represent multi-key path
      * information that must be stored in a reserved keyspace within the index.
+     *
+     * Callers which generate keys for many documents should reuse the same containers across
+     * calls, clearing them in between; the flat sets retain their allocated capacity.
      */
     virtual void getKeys(const BSONObj& obj,
                          GetKeysMode mode,
-                         BSONObjSet* keys,
-                         BSONObjSet* multikeyMetadataKeys,
+                         BSONObjFlatSet* keys,
+                         BSONObjFlatSet* multikeyMetadataKeys,
                          MultikeyPaths* multikeyPaths) const = 0;
 
     /**
      * Given the set of keys, multikeyMetadataKeys and multikeyPaths generated by a particular
      * document, return 'true' if the index should be marked as multikey and 'false' otherwise.
      */
-    virtual bool shouldMarkIndexAsMultikey(const BSONObjSet& keys,
-                                           const BSONObjSet& multikeyMetadataKeys,
+    virtual bool shouldMarkIndexAsMultikey(const BSONObjFlatSet& keys,
+                                           const BSONObjFlatSet& multikeyMetadataKeys,
                                            const MultikeyPaths& multikeyPaths) const = 0;
 
     /**
@@ -381,7 +400,7 @@ public:
 class UpdateTicket {
 public:
     UpdateTicket()
-        : oldKeys(SimpleBSONObjComparator::kInstance.makeBSONObjSet()),
+        : oldKeys(SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet()),
           newKeys(oldKeys),
           newMultikeyMetadataKeys(newKeys) {}
 
@@ -390,10 +409,10 @@ private:
 
     bool _isValid{false};
 
-    BSONObjSet oldKeys;
-    BSONObjSet newKeys;
+    BSONObjFlatSet oldKeys;
+    BSONObjFlatSet newKeys;
 
-    BSONObjSet newMultikeyMetadataKeys;
+    BSONObjFlatSet newMultikeyMetadataKeys;
 
     std::vector<BSONObj> removed;
     std::vector<BSONObj> added;
@@ -447,7 +466,7 @@ public:
      * ( {BSON("a" << 0.0)}, {BSON("a" << 0LL)} ).
      */
     static std::pair<std::vector<BSONObj>, std::vector<BSONObj>> setDifference(
-        const BSONObjSet& left, const BSONObjSet& right);
+        const BSONObjFlatSet& left, const BSONObjFlatSet& right);
 
     AbstractIndexAccessMethod(IndexCatalogEntry* btreeState, SortedDataInterface* btree);
 
@@ -458,13 +477,18 @@ public:
                   InsertResult* result) final;
 
     Status insertKeys(OperationContext* opCtx,
-                      const BSONObjSet& keys,
-                      const BSONObjSet& multikeyMetadataKeys,
+                      const BSONObjFlatSet& keys,
+                      const BSONObjFlatSet& multikeyMetadataKeys,
                       const MultikeyPaths& multikeyPaths,
                       const RecordId& loc,
                       const InsertDeleteOptions& options,
                       InsertResult* result) final;
 
+    Status insertRecords(OperationContext* opCtx,
+                         const std::vector<std::pair<const BSONObj*, RecordId>>& records,
+                         const InsertDeleteOptions& options,
+                         InsertResult* result) final;
+
     Status remove(OperationContext* opCtx,
                   const BSONObj& obj,
                   const RecordId& loc,
@@ -472,7 +496,7 @@ public:
                   int64_t* numDeleted) final;
 
     Status removeKeys(OperationContext* opCtx,
-                      const BSONObjSet& keys,
+                      const BSONObjFlatSet& keys,
                       const RecordId& loc,
                       const InsertDeleteOptions& options,
                       int64_t* numDeleted) final;
@@ -527,12 +551,12 @@ public:
 
     void getKeys(const BSONObj& obj,
                  GetKeysMode mode,
-                 BSONObjSet* keys,
-                 BSONObjSet* multikeyMetadataKeys,
+                 BSONObjFlatSet* keys,
+                 BSONObjFlatSet* multikeyMetadataKeys,
                  MultikeyPaths* multikeyPaths) const final;
 
-    bool shouldMarkIndexAsMultikey(const BSONObjSet& keys,
-                                   const BSONObjSet& multikeyMetadataKeys,
+    bool shouldMarkIndexAsMultikey(const BSONObjFlatSet& keys,
+                                   const BSONObjFlatSet& multikeyMetadataKeys,
                                    const MultikeyPaths& multikeyPaths) const override;
 
     SortedDataInterface* getSortedDataInterface() const override final;
@@ -548,15 +572,25 @@ protected:
      * a result of inserting 'keys'.
      *
      * If the 'multikeyMetadataKeys' pointer is non-null, then the function will populate the
-     * BSONObjSet with any multikey metadata keys generated while processing the document. These
+     * BSONObjFlatSet with any multikey metadata keys generated while processing the document. These
      * keys are not associated with the document itself, but instead represent multi-key path
      * information that must be stored in a reserved keyspace within the index.
      */
     virtual void doGetKeys(const BSONObj& obj,
-                           BSONObjSet* keys,
-                           BSONObjSet* multikeyMetadataKeys,
+                           BSONObjFlatSet* keys,
+                           BSONObjFlatSet* multikeyMetadataKeys,
                            MultikeyPaths* multikeyPaths) const = 0;
 
+    /**
+     * Called after the non-empty set 'multikeyMetadataKeys' has been written to the index's
+     * reserved keyspace by an insert or update. The write has not yet committed when this method
+     * is called. Index types which derive in-memory state from the multikey metadata keys may
+     * override this method in order to schedule invalidation of that state. The default
+     * implementation does nothing.
+     */
+    virtual void didInsertMultikeyMetadataKeys(OperationContext* opCtx,
+                                               const BSONObjFlatSet& multikeyMetadataKeys) const {}
+
     IndexCatalogEntry* const _btreeState;  // owned by IndexCatalogEntry
     const IndexDescriptor* const _descriptor;
 
@@ -583,6 +617,19 @@ private:
      */
     bool shouldCheckIndexKeySize(OperationContext* opCtx);
 
+    /**
+     * Inserts a single key into the index, retrying with duplicates allowed where 'options'
+     * permits. Returns the final status; the caller decides fatality via isFatalError().
+     *
+     * Used by insertKeys() and insertRecords().
+     */
+    Status insertOneKey(OperationContext* opCtx,
+                        const BSONObj& key,
+                        const RecordId& recordId,
+                        const InsertDeleteOptions& options,
+                        bool checkIndexKeySize,
+                        InsertResult* result);
+
     /**
      * Removes a single key from the index.
      *
@@ -211,18 +211,19 @@ Status IndexBuildInterceptor::_applyWrite(OperationContext* opCtx,
     const RecordId opRecordId = RecordId(operation["recordId"].Long());
     const Op opType =
         (strcmp(operation.getStringField("op"), "i") == 0) ? Op::kInsert : Op::kDelete;
-    const BSONObjSet keySet = SimpleBSONObjComparator::kInstance.makeBSONObjSet({key});
+    const BSONObjFlatSet keySet = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet({key});
 
     auto accessMethod = _indexCatalogEntry->accessMethod();
     if (opType == Op::kInsert) {
         InsertResult result;
-        auto status = accessMethod->insertKeys(opCtx,
-                                               keySet,
-                                               SimpleBSONObjComparator::kInstance.makeBSONObjSet(),
-                                               MultikeyPaths{},
-                                               opRecordId,
-                                               options,
-                                               &result);
+        auto status =
+            accessMethod->insertKeys(opCtx,
+                                     keySet,
+                                     SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet(),
+                                     MultikeyPaths{},
+                                     opRecordId,
+                                     options,
+                                     &result);
         if (!status.isOK()) {
             return status;
         }
@@ -277,8 +278,8 @@ Status IndexBuildInterceptor::sideWrite(OperationContext* opCtx,
     invariant(opCtx->lockState()->inAWriteUnitOfWork());
 
     *numKeysOut = 0;
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
-    BSONObjSet multikeyMetadataKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
+    BSONObjFlatSet multikeyMetadataKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths multikeyPaths;
 
     indexAccessMethod->getKeys(*obj,
@@ -143,8 +143,8 @@ StatusWith<BSONObj> S2AccessMethod::fixSpec(const BSONObj& specObj) {
 }
 
 void S2AccessMethod::doGetKeys(const BSONObj& obj,
-                               BSONObjSet* keys,
-                               BSONObjSet* multikeyMetadataKeys,
+                               BSONObjFlatSet* keys,
+                               BSONObjFlatSet* multikeyMetadataKeys,
                                MultikeyPaths* multikeyPaths) const {
     ExpressionKeysPrivate::getS2Keys(obj, _descriptor->keyPattern(), _params, keys, multikeyPaths);
 }
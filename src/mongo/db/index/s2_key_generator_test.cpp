@@ -50,10 +50,10 @@ using namespace mongo;
 
 namespace {
 
-std::string dumpKeyset(const BSONObjSet& objs) {
+std::string dumpKeyset(const BSONObjFlatSet& objs) {
     std::stringstream ss;
     ss << "[ ";
-    for (BSONObjSet::iterator i = objs.begin(); i != objs.end(); ++i) {
+    for (BSONObjFlatSet::iterator i = objs.begin(); i != objs.end(); ++i) {
         ss << i->toString() << " ";
     }
     ss << "]";
@@ -77,7 +77,7 @@ std::string dumpMultikeyPaths(const MultikeyPaths& multikeyPaths) {
     return ss.str();
 }
 
-bool assertKeysetsEqual(const BSONObjSet& expectedKeys, const BSONObjSet& actualKeys) {
+bool assertKeysetsEqual(const BSONObjFlatSet& expectedKeys, const BSONObjFlatSet& actualKeys) {
     if (expectedKeys.size() != actualKeys.size()) {
         log() << "Expected: " << dumpKeyset(expectedKeys) << ", "
               << "Actual: " << dumpKeyset(actualKeys);
@@ -124,7 +124,7 @@ long long getCellID(int x, int y, bool multiPoint = false) {
     const CollatorInterface* collator = nullptr;
     ExpressionParams::initialize2dsphereParams(infoObj, collator, &params);
 
-    BSONObjSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet keys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     // There's no need to compute the prefixes of the indexed fields that cause the index to be
     // multikey when computing the cell id of the geo field.
     MultikeyPaths* multikeyPaths = nullptr;
@@ -145,12 +145,12 @@ TEST(S2KeyGeneratorTest, GetS2KeysFromSubobjectWithArrayOfGeoAndNonGeoSubobjects
     CollatorInterfaceMock* collator = nullptr;
     ExpressionParams::initialize2dsphereParams(infoObj, collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(
         genKeysFrom, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON("" << 1 << "" << getCellID(0, 0)));
     expectedKeys.insert(BSON("" << 1 << "" << getCellID(3, 3)));
     expectedKeys.insert(BSON("" << 2 << "" << getCellID(0, 0)));
@@ -171,12 +171,12 @@ TEST(S2KeyGeneratorTest, GetS2KeysFromArrayOfNonGeoSubobjectsWithArrayValues) {
     CollatorInterfaceMock* collator = nullptr;
     ExpressionParams::initialize2dsphereParams(infoObj, collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(
         genKeysFrom, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON("" << 1 << "" << getCellID(0, 0)));
     expectedKeys.insert(BSON("" << 2 << "" << getCellID(0, 0)));
     expectedKeys.insert(BSON("" << 3 << "" << getCellID(0, 0)));
@@ -194,13 +194,13 @@ TEST(S2KeyGeneratorTest, GetS2KeysFromMultiPointInGeoField) {
     CollatorInterfaceMock* collator = nullptr;
     ExpressionParams::initialize2dsphereParams(infoObj, collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(
         genKeysFrom, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
     const bool multiPoint = true;
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON("" << 1 << "" << getCellID(0, 0, multiPoint)));
     expectedKeys.insert(BSON("" << 1 << "" << getCellID(1, 0, multiPoint)));
     expectedKeys.insert(BSON("" << 1 << "" << getCellID(1, 1, multiPoint)));
@@ -217,11 +217,11 @@ TEST(S2KeyGeneratorTest, CollationAppliedToNonGeoStringFieldAfterGeoField) {
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     ExpressionParams::initialize2dsphereParams(infoObj, &collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(obj, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON("" << getCellID(0, 0) << ""
                                 << "gnirts"));
 
@@ -238,11 +238,11 @@ TEST(S2KeyGeneratorTest, CollationAppliedToNonGeoStringFieldBeforeGeoField) {
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     ExpressionParams::initialize2dsphereParams(infoObj, &collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(obj, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON(""
                              << "gnirts"
                              << ""
@@ -261,11 +261,11 @@ TEST(S2KeyGeneratorTest, CollationAppliedToAllNonGeoStringFields) {
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     ExpressionParams::initialize2dsphereParams(infoObj, &collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(obj, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON(""
                              << "gnirts"
                              << ""
@@ -287,11 +287,11 @@ TEST(S2KeyGeneratorTest, CollationAppliedToNonGeoStringFieldWithMultiplePathComp
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     ExpressionParams::initialize2dsphereParams(infoObj, &collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(obj, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON("" << getCellID(0, 0) << ""
                                 << "gnirts"));
 
@@ -308,11 +308,11 @@ TEST(S2KeyGeneratorTest, CollationAppliedToStringsInArray) {
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     ExpressionParams::initialize2dsphereParams(infoObj, &collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(obj, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON("" << getCellID(0, 0) << ""
                                 << "gnirts"));
     expectedKeys.insert(BSON("" << getCellID(0, 0) << ""
@@ -331,11 +331,11 @@ TEST(S2KeyGeneratorTest, CollationAppliedToStringsInAllArrays) {
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     ExpressionParams::initialize2dsphereParams(infoObj, &collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(obj, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON("" << getCellID(0, 0) << ""
                                 << "gnirts"
                                 << ""
@@ -365,11 +365,11 @@ TEST(S2KeyGeneratorTest, CollationDoesNotAffectNonStringFields) {
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     ExpressionParams::initialize2dsphereParams(infoObj, &collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(obj, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON("" << getCellID(0, 0) << "" << 5));
 
     assertKeysetsEqual(expectedKeys, actualKeys);
@@ -385,11 +385,11 @@ TEST(S2KeyGeneratorTest, CollationAppliedToStringsInNestedObjects) {
     CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
     ExpressionParams::initialize2dsphereParams(infoObj, &collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(obj, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON("" << getCellID(0, 0) << "" << BSON("c"
                                                                  << "gnirts")));
 
@@ -406,11 +406,11 @@ TEST(S2KeyGeneratorTest, NoCollation) {
     const CollatorInterface* collator = nullptr;
     ExpressionParams::initialize2dsphereParams(infoObj, collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(obj, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON("" << getCellID(0, 0) << ""
                                 << "string"));
 
@@ -427,11 +427,11 @@ TEST(S2KeyGeneratorTest, EmptyArrayForLeadingFieldIsConsideredMultikey) {
     const CollatorInterface* collator = nullptr;
     ExpressionParams::initialize2dsphereParams(infoObj, collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(obj, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON("" << BSONUndefined << "" << getCellID(0, 0)));
 
     assertKeysetsEqual(expectedKeys, actualKeys);
@@ -446,11 +446,11 @@ TEST(S2KeyGeneratorTest, EmptyArrayForTrailingFieldIsConsideredMultikey) {
     const CollatorInterface* collator = nullptr;
     ExpressionParams::initialize2dsphereParams(infoObj, collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(obj, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON("" << getCellID(0, 0) << "" << BSONUndefined));
 
     assertKeysetsEqual(expectedKeys, actualKeys);
@@ -465,11 +465,11 @@ TEST(S2KeyGeneratorTest, SingleElementTrailingArrayIsConsideredMultikey) {
     const CollatorInterface* collator = nullptr;
     ExpressionParams::initialize2dsphereParams(infoObj, collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(obj, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON("" << 99 << "" << getCellID(0, 0)));
 
     assertKeysetsEqual(expectedKeys, actualKeys);
@@ -484,11 +484,11 @@ TEST(S2KeyGeneratorTest, MidPathSingleElementArrayIsConsideredMultikey) {
     const CollatorInterface* collator = nullptr;
     ExpressionParams::initialize2dsphereParams(infoObj, collator, &params);
 
-    BSONObjSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet actualKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     MultikeyPaths actualMultikeyPaths;
     ExpressionKeysPrivate::getS2Keys(obj, keyPattern, params, &actualKeys, &actualMultikeyPaths);
 
-    BSONObjSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
+    BSONObjFlatSet expectedKeys = SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet();
     expectedKeys.insert(BSON("" << 99 << "" << getCellID(0, 0)));
 
     assertKeysetsEqual(expectedKeys, actualKeys);
@@ -144,7 +144,7 @@ StatusWith<BSONObj> SortKeyGenerator::getIndexKey(const BSONObj& obj) const {
     const StringData::ComparatorInterface* stringComparator = nullptr;
     BSONObjComparator patternCmp(
         _sortSpecWithoutMeta, BSONObjComparator::FieldNamesMode::kConsider, stringComparator);
-    BSONObjSet keys = patternCmp.makeBSONObjSet();
+    BSONObjFlatSet keys = patternCmp.makeBSONObjFlatSet();
 
     try {
         // There's no need to compute the prefixes of the indexed fields that cause the index to be
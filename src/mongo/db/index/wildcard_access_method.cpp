@@ -34,25 +34,38 @@
 
 #include "mongo/db/catalog/index_catalog_entry.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
+#include "mongo/db/operation_context.h"
 #include "mongo/db/query/index_bounds_builder.h"
+#include "mongo/db/server_parameters.h"
 
 namespace mongo {
 
+// The maximum number of per-field entries in the multikey path cache of each $** index. When the
+// cache fills up it is cleared and repopulated on demand. A value of zero disables the cache.
+MONGO_EXPORT_SERVER_PARAMETER(wildcardMultikeyPathCacheMaxEntries, int, 1024)
+    ->withValidator([](const int& newVal) {
+        if (newVal < 0) {
+            return Status(ErrorCodes::BadValue,
+                          "wildcardMultikeyPathCacheMaxEntries must be non-negative");
+        }
+        return Status::OK();
+    });
+
 WildcardAccessMethod::WildcardAccessMethod(IndexCatalogEntry* wildcardState,
                                            SortedDataInterface* btree)
     : AbstractIndexAccessMethod(wildcardState, btree),
       _keyGen(
           _descriptor->keyPattern(), _descriptor->pathProjection(), _btreeState->getCollator()) {}
 
-bool WildcardAccessMethod::shouldMarkIndexAsMultikey(const BSONObjSet& keys,
-                                                     const BSONObjSet& multikeyMetadataKeys,
+bool WildcardAccessMethod::shouldMarkIndexAsMultikey(const BSONObjFlatSet& keys,
+                                                     const BSONObjFlatSet& multikeyMetadataKeys,
                                                      const MultikeyPaths& multikeyPaths) const {
     return !multikeyMetadataKeys.empty();
 }
 
 void WildcardAccessMethod::doGetKeys(const BSONObj& obj,
-                                     BSONObjSet* keys,
-                                     BSONObjSet* multikeyMetadataKeys,
+                                     BSONObjFlatSet* keys,
+                                     BSONObjFlatSet* multikeyMetadataKeys,
                                      MultikeyPaths* multikeyPaths) const {
     _keyGen.generateKeys(obj, keys, multikeyMetadataKeys);
 }
@@ -175,11 +188,8 @@ std::vector<Interval> WildcardAccessMethod::getMultikeyPathIndexIntervalsForFiel
     return intervals;
 }
 
-std::set<FieldRef> WildcardAccessMethod::getMultikeyPathSet(
-    OperationContext* opCtx,
-    const stdx::unordered_set<std::string>& fieldSet,
-    MultikeyMetadataAccessStats* stats) const {
-    invariant(stats);
+std::set<FieldRef> WildcardAccessMethod::_getMultikeyPathsForField(
+    OperationContext* opCtx, const FieldRef& field, MultikeyMetadataAccessStats* stats) const {
     IndexBounds indexBounds;
 
     // Multikey metadata keys are stored with the number "1" in the first position of the index to
@@ -189,13 +199,7 @@ std::set<FieldRef> WildcardAccessMethod::getMultikeyPathSet(
     indexBounds.fields.push_back(std::move(multikeyPathFlagOil));
 
     OrderedIntervalList fieldNameOil;
-
-    for (const auto& field : fieldSet) {
-        auto intervals = getMultikeyPathIndexIntervalsForField(FieldRef(field));
-        fieldNameOil.intervals.insert(fieldNameOil.intervals.end(),
-                                      std::make_move_iterator(intervals.begin()),
-                                      std::make_move_iterator(intervals.end()));
-    }
+    fieldNameOil.intervals = getMultikeyPathIndexIntervalsForField(field);
 
     // IndexBoundsBuilder::unionize() sorts the OrderedIntervalList allowing for in order index
     // traversal.
@@ -205,11 +209,75 @@ std::set<FieldRef> WildcardAccessMethod::getMultikeyPathSet(
     return _getMultikeyPathSet(opCtx, indexBounds, stats);
 }
 
+std::set<FieldRef> WildcardAccessMethod::getMultikeyPathSet(
+    OperationContext* opCtx,
+    const stdx::unordered_set<std::string>& fieldSet,
+    MultikeyMetadataAccessStats* stats) const {
+    invariant(stats);
+    stats->numSeeks = 0;
+    stats->keysExamined = 0;
+
+    const auto cacheMaxEntries = static_cast<size_t>(wildcardMultikeyPathCacheMaxEntries.load());
+
+    // Serve as many fields as possible from the cache, and record the generation so that results
+    // of the index scans below are discarded if the cache is invalidated while we are scanning.
+    std::set<FieldRef> multikeyPaths;
+    std::vector<std::string> uncachedFields;
+    long long cacheGeneration;
+    {
+        stdx::lock_guard<stdx::mutex> lk(_multikeyPathCacheMutex);
+        cacheGeneration = _multikeyPathCacheGeneration;
+        for (const auto& field : fieldSet) {
+            auto it = _perFieldMultikeyPathCache.find(field);
+            if (cacheMaxEntries > 0 && it != _perFieldMultikeyPathCache.end()) {
+                multikeyPaths.insert(it->second.begin(), it->second.end());
+            } else {
+                uncachedFields.push_back(field);
+            }
+        }
+    }
+
+    for (const auto& field : uncachedFields) {
+        MultikeyMetadataAccessStats fieldStats;
+        auto fieldPaths = _getMultikeyPathsForField(opCtx, FieldRef(field), &fieldStats);
+        stats->numSeeks += fieldStats.numSeeks;
+        stats->keysExamined += fieldStats.keysExamined;
+        multikeyPaths.insert(fieldPaths.begin(), fieldPaths.end());
+
+        if (cacheMaxEntries == 0) {
+            continue;
+        }
+
+        stdx::lock_guard<stdx::mutex> lk(_multikeyPathCacheMutex);
+        if (_multikeyPathCacheGeneration != cacheGeneration) {
+            continue;
+        }
+        if (_perFieldMultikeyPathCache.size() >= cacheMaxEntries) {
+            _perFieldMultikeyPathCache.clear();
+        }
+        _perFieldMultikeyPathCache[field] = std::move(fieldPaths);
+    }
+
+    return multikeyPaths;
+}
+
 std::set<FieldRef> WildcardAccessMethod::getMultikeyPathSet(
     OperationContext* opCtx, MultikeyMetadataAccessStats* stats) const {
-    return writeConflictRetry(
+    invariant(stats);
+    const bool cacheEnabled = wildcardMultikeyPathCacheMaxEntries.load() > 0;
+    long long cacheGeneration = 0;
+    if (cacheEnabled) {
+        stdx::lock_guard<stdx::mutex> lk(_multikeyPathCacheMutex);
+        if (_cachedAllMultikeyPaths) {
+            stats->numSeeks = 0;
+            stats->keysExamined = 0;
+            return *_cachedAllMultikeyPaths;
+        }
+        cacheGeneration = _multikeyPathCacheGeneration;
+    }
+
+    auto multikeyPaths = writeConflictRetry(
         opCtx, "wildcard multikey path retrieval", _descriptor->parentNS(), [&]() {
-            invariant(stats);
             stats->numSeeks = 0;
             stats->keysExamined = 0;
 
@@ -237,5 +305,49 @@ std::set<FieldRef> WildcardAccessMethod::getMultikeyPathSet(
 
             return multikeyPaths;
         });
+
+    if (cacheEnabled) {
+        stdx::lock_guard<stdx::mutex> lk(_multikeyPathCacheMutex);
+        if (_multikeyPathCacheGeneration == cacheGeneration) {
+            _cachedAllMultikeyPaths = multikeyPaths;
+        }
+    }
+
+    return multikeyPaths;
+}
+
+void WildcardAccessMethod::didInsertMultikeyMetadataKeys(
+    OperationContext* opCtx, const BSONObjFlatSet& multikeyMetadataKeys) const {
+    // Collect the paths in this write which have not previously been observed in a committed
+    // multikey metadata key. Writes along already-known multikey paths are the steady state for a
+    // collection whose array schema is no longer growing, and must not pay for invalidation.
+    std::vector<std::string> newPaths;
+    {
+        stdx::lock_guard<stdx::mutex> lk(_multikeyPathCacheMutex);
+        for (const auto& metadataKey : multikeyMetadataKeys) {
+            // Metadata keys are of the form {'': 1, '': 'path.to.array'}.
+            BSONObjIterator iter(metadataKey);
+            iter.next();
+            const auto path = iter.next().valueStringData();
+            if (_knownMultikeyPaths.find(path) == _knownMultikeyPaths.end()) {
+                newPaths.push_back(path.toString());
+            }
+        }
+    }
+
+    if (newPaths.empty()) {
+        return;
+    }
+
+    // Invalidate the cache only if the write commits. A rolled-back write leaves no metadata key
+    // behind, and recording its paths as known would suppress the invalidation owed by a later
+    // write which successfully commits metadata keys for the same paths.
+    opCtx->recoveryUnit()->onCommit([this, newPaths](boost::optional<Timestamp>) {
+        stdx::lock_guard<stdx::mutex> lk(_multikeyPathCacheMutex);
+        ++_multikeyPathCacheGeneration;
+        _perFieldMultikeyPathCache.clear();
+        _cachedAllMultikeyPaths = boost::none;
+        _knownMultikeyPaths.insert(newPaths.begin(), newPaths.end());
+    });
 }
 }  // namespace mongo
@@ -30,10 +30,14 @@
 
 #pragma once
 
+#include <boost/optional.hpp>
+
 #include "mongo/db/index/index_access_method.h"
 #include "mongo/db/index/wildcard_key_generator.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/query/index_bounds.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 
@@ -42,7 +46,9 @@ namespace mongo {
  * created with { "$**": ±1 } or { "path.$**": ±1 } uses this class.
  *
  * $** indexes store a special metadata key for each path in the index that is multikey. This class
- * provides an interface to access the multikey metadata: see getMultikeyPaths().
+ * provides an interface to access the multikey metadata: see getMultikeyPaths(). Because the
+ * metadata is consulted on every planning pass over a multikey $** index, the results of metadata
+ * index scans are memoized here and invalidated when new metadata keys are committed.
  */
 class WildcardAccessMethod final : public AbstractIndexAccessMethod {
 public:
@@ -64,10 +70,10 @@ public:
      * Because it is possible for a $** index to generate multiple keys per document without any of
      * them lying along a multikey (i.e. array) path, this method will only return 'true' if one or
      * more multikey metadata keys have been generated; that is, if the 'multikeyMetadataKeys'
-     * BSONObjSet is non-empty.
+     * BSONObjFlatSet is non-empty.
      */
-    bool shouldMarkIndexAsMultikey(const BSONObjSet& keys,
-                                   const BSONObjSet& multikeyMetadataKeys,
+    bool shouldMarkIndexAsMultikey(const BSONObjFlatSet& keys,
+                                   const BSONObjFlatSet& multikeyMetadataKeys,
                                    const MultikeyPaths& multikeyPaths) const final;
 
     /**
@@ -79,7 +85,8 @@ public:
 
     /**
      * Returns the intersection of 'fieldSet' and the set of paths for which the $** has multikey
-     * metadata keys.
+     * metadata keys. Results are served from the per-field cache where possible; fields which
+     * miss the cache are retrieved from the index and memoized.
      */
     std::set<FieldRef> getMultikeyPathSet(OperationContext*,
                                           const stdx::unordered_set<std::string>& fieldSet,
@@ -87,21 +94,62 @@ public:
 
 
     /**
-     * Returns the entire set of paths for which the $** has multikey metadata keys.
+     * Returns the entire set of paths for which the $** has multikey metadata keys. The result is
+     * memoized, and subsequent calls are served from the cache until it is invalidated.
      */
     std::set<FieldRef> getMultikeyPathSet(OperationContext* opCtx,
                                           MultikeyMetadataAccessStats* stats) const final;
 
+protected:
+    /**
+     * Schedules invalidation of the multikey path cache when a write which introduces multikey
+     * metadata keys for previously-unseen paths commits.
+     */
+    void didInsertMultikeyMetadataKeys(OperationContext* opCtx,
+                                       const BSONObjFlatSet& multikeyMetadataKeys) const final;
+
 private:
     void doGetKeys(const BSONObj& obj,
-                   BSONObjSet* keys,
-                   BSONObjSet* multikeyMetadataKeys,
+                   BSONObjFlatSet* keys,
+                   BSONObjFlatSet* multikeyMetadataKeys,
                    MultikeyPaths* multikeyPaths) const final;
 
     std::set<FieldRef> _getMultikeyPathSet(OperationContext* opCtx,
                                            const IndexBounds& indexBounds,
                                            MultikeyMetadataAccessStats* stats) const;
 
+    /**
+     * Retrieves from the index the set of multikey path metadata keys relevant to 'field',
+     * bypassing the cache.
+     */
+    std::set<FieldRef> _getMultikeyPathsForField(OperationContext* opCtx,
+                                                 const FieldRef& field,
+                                                 MultikeyMetadataAccessStats* stats) const;
+
     const WildcardKeyGenerator _keyGen;
+
+    // Protects the multikey path cache state below. Multikey metadata keys are never removed from
+    // the index, so a cached result can only become stale by failing to include a newly-added
+    // path; didInsertMultikeyMetadataKeys() invalidates the cache when such a write commits.
+    mutable stdx::mutex _multikeyPathCacheMutex;
+
+    // Incremented on each cache invalidation. Cache fills capture the generation before scanning
+    // the index and discard their result if it has changed by the time it would be stored, so a
+    // scan which raced with a concurrent commit cannot be memoized.
+    mutable long long _multikeyPathCacheGeneration = 0;
+
+    // Memoized results of per-field multikey metadata index scans, keyed by the queried field's
+    // dotted path.
+    mutable StringMap<std::set<FieldRef>> _perFieldMultikeyPathCache;
+
+    // Memoized result of a full scan of the multikey metadata keyspace.
+    mutable boost::optional<std::set<FieldRef>> _cachedAllMultikeyPaths;
+
+    // The set of multikey paths for which metadata keys are known to have been committed to the
+    // index since this access method was constructed. Because metadata keys are never removed,
+    // membership in this set is stable, and inserts of metadata keys for known paths - the steady
+    // state for a collection whose array schema is no longer growing - do not invalidate the
+    // cache.
+    mutable StringSet _knownMultikeyPaths;
 };
 }  // namespace mongo
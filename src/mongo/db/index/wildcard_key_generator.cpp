@@ -100,8 +100,8 @@ WildcardKeyGenerator::WildcardKeyGenerator(BSONObj keyPattern,
 }
 
 void WildcardKeyGenerator::generateKeys(BSONObj inputDoc,
-                                        BSONObjSet* keys,
-                                        BSONObjSet* multikeyPaths) const {
+                                        BSONObjFlatSet* keys,
+                                        BSONObjFlatSet* multikeyPaths) const {
     FieldRef rootPath;
     _traverseWildcard(_projExec->applyProjection(inputDoc), false, &rootPath, keys, multikeyPaths);
 }
@@ -109,8 +109,8 @@ void WildcardKeyGenerator::generateKeys(BSONObj inputDoc,
 void WildcardKeyGenerator::_traverseWildcard(BSONObj obj,
                                              bool objIsArray,
                                              FieldRef* path,
-                                             BSONObjSet* keys,
-                                             BSONObjSet* multikeyPaths) const {
+                                             BSONObjFlatSet* keys,
+                                             BSONObjFlatSet* multikeyPaths) const {
     for (const auto elem : obj) {
         // If the element's fieldName contains a ".", fast-path skip it because it's not queryable.
         if (elem.fieldNameStringData().find('.', 0) != std::string::npos)
@@ -148,7 +148,7 @@ void WildcardKeyGenerator::_traverseWildcard(BSONObj obj,
 bool WildcardKeyGenerator::_addKeyForNestedArray(BSONElement elem,
                                                  const FieldRef& fullPath,
                                                  bool enclosingObjIsArray,
-                                                 BSONObjSet* keys) const {
+                                                 BSONObjFlatSet* keys) const {
     // If this element is an array whose parent is also an array, index it as a value.
     if (enclosingObjIsArray && elem.type() == BSONType::Array) {
         _addKey(elem, fullPath, keys);
@@ -159,7 +159,7 @@ bool WildcardKeyGenerator::_addKeyForNestedArray(BSONElement elem,
 
 bool WildcardKeyGenerator::_addKeyForEmptyLeaf(BSONElement elem,
                                                const FieldRef& fullPath,
-                                               BSONObjSet* keys) const {
+                                               BSONObjFlatSet* keys) const {
     invariant(elem.isABSONObj());
     if (elem.embeddedObject().isEmpty()) {
         // In keeping with the behaviour of regular indexes, an empty object is indexed as-is while
@@ -172,7 +172,7 @@ bool WildcardKeyGenerator::_addKeyForEmptyLeaf(BSONElement elem,
 
 void WildcardKeyGenerator::_addKey(BSONElement elem,
                                    const FieldRef& fullPath,
-                                   BSONObjSet* keys) const {
+                                   BSONObjFlatSet* keys) const {
     // Wildcard keys are of the form { "": "path.to.field", "": <collation-aware value> }.
     BSONObjBuilder bob;
     bob.append("", fullPath.dottedField());
@@ -184,7 +184,8 @@ void WildcardKeyGenerator::_addKey(BSONElement elem,
     keys->insert(bob.obj());
 }
 
-void WildcardKeyGenerator::_addMultiKey(const FieldRef& fullPath, BSONObjSet* multikeyPaths) const {
+void WildcardKeyGenerator::_addMultiKey(const FieldRef& fullPath,
+                                        BSONObjFlatSet* multikeyPaths) const {
     // Multikey paths are denoted by a key of the form { "": 1, "": "path.to.array" }. The argument
     // 'multikeyPaths' may be nullptr if the access method is being used in an operation which does
     // not require multikey path generation.
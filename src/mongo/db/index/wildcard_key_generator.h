@@ -66,32 +66,34 @@ public:
 
     /**
      * Applies the appropriate Wildcard projection to the input doc, and then adds one key-value
-     * pair to the BSONObjSet 'keys' for each leaf node in the post-projection document:
+     * pair to the BSONObjFlatSet 'keys' for each leaf node in the post-projection document:
      *      { '': 'path.to.field', '': <collation-aware-field-value> }
      * Also adds one entry to 'multikeyPaths' for each array encountered in the post-projection
      * document, in the following format:
      *      { '': 1, '': 'path.to.array' }
      */
-    void generateKeys(BSONObj inputDoc, BSONObjSet* keys, BSONObjSet* multikeyPaths) const;
+    void generateKeys(BSONObj inputDoc, BSONObjFlatSet* keys, BSONObjFlatSet* multikeyPaths) const;
 
 private:
     // Traverses every path of the post-projection document, adding keys to the set as it goes.
     void _traverseWildcard(BSONObj obj,
                            bool objIsArray,
                            FieldRef* path,
-                           BSONObjSet* keys,
-                           BSONObjSet* multikeyPaths) const;
+                           BSONObjFlatSet* keys,
+                           BSONObjFlatSet* multikeyPaths) const;
 
     // Helper functions to format the entry appropriately before adding it to the key/path tracker.
-    void _addMultiKey(const FieldRef& fullPath, BSONObjSet* multikeyPaths) const;
-    void _addKey(BSONElement elem, const FieldRef& fullPath, BSONObjSet* keys) const;
+    void _addMultiKey(const FieldRef& fullPath, BSONObjFlatSet* multikeyPaths) const;
+    void _addKey(BSONElement elem, const FieldRef& fullPath, BSONObjFlatSet* keys) const;
 
     // Helper to check whether the element is a nested array, and conditionally add it to 'keys'.
     bool _addKeyForNestedArray(BSONElement elem,
                                const FieldRef& fullPath,
                                bool enclosingObjIsArray,
-                               BSONObjSet* keys) const;
-    bool _addKeyForEmptyLeaf(BSONElement elem, const FieldRef& fullPath, BSONObjSet* keys) const;
+                               BSONObjFlatSet* keys) const;
+    bool _addKeyForEmptyLeaf(BSONElement elem,
+                             const FieldRef& fullPath,
+                             BSONObjFlatSet* keys) const;
 
     std::unique_ptr<ProjectionExecAgg> _projExec;
     const CollatorInterface* _collator;
@@ -41,14 +41,14 @@
 namespace mongo {
 namespace {
 
-BSONObjSet makeKeySet(std::initializer_list<BSONObj> init = {}) {
-    return SimpleBSONObjComparator::kInstance.makeBSONObjSet(std::move(init));
+BSONObjFlatSet makeKeySet(std::initializer_list<BSONObj> init = {}) {
+    return SimpleBSONObjComparator::kInstance.makeBSONObjFlatSet(std::move(init));
 }
 
-std::string dumpKeyset(const BSONObjSet& objs) {
+std::string dumpKeyset(const BSONObjFlatSet& objs) {
     std::stringstream ss;
     ss << "[ ";
-    for (BSONObjSet::iterator i = objs.begin(); i != objs.end(); ++i) {
+    for (BSONObjFlatSet::iterator i = objs.begin(); i != objs.end(); ++i) {
         ss << i->toString() << " ";
     }
     ss << "]";
@@ -56,7 +56,7 @@ std::string dumpKeyset(const BSONObjSet& objs) {
     return ss.str();
 }
 
-bool assertKeysetsEqual(const BSONObjSet& expectedKeys, const BSONObjSet& actualKeys) {
+bool assertKeysetsEqual(const BSONObjFlatSet& expectedKeys, const BSONObjFlatSet& actualKeys) {
     if (expectedKeys.size() != actualKeys.size()) {
         log() << "Expected: " << dumpKeyset(expectedKeys) << ", "
               << "Actual: " << dumpKeyset(actualKeys);
@@ -92,20 +92,25 @@ void LogicalClock::set(ServiceContext* service, std::unique_ptr<LogicalClock> cl
 LogicalClock::LogicalClock(ServiceContext* service) : _service(service) {}
 
 LogicalTime LogicalClock::getClusterTime() {
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
-    return _clusterTime;
+    return LogicalTime(Timestamp(_clusterTime.load()));
 }
 
 Status LogicalClock::advanceClusterTime(const LogicalTime newTime) {
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
-
-    auto rateLimitStatus = _passesRateLimiter_inlock(newTime);
+    auto rateLimitStatus = _passesRateLimiter(newTime);
     if (!rateLimitStatus.isOK()) {
         return rateLimitStatus;
     }
 
-    if (newTime > _clusterTime) {
-        _clusterTime = newTime;
+    // Lock-free max: only ever move the clock forward. If another thread advances the clock
+    // concurrently, re-check whether newTime still lies ahead of it.
+    auto newTimeValue = newTime.asTimestamp().asULL();
+    auto currentValue = _clusterTime.load();
+    while (newTimeValue > currentValue) {
+        auto original = _clusterTime.compareAndSwap(currentValue, newTimeValue);
+        if (original == currentValue) {
+            break;
+        }
+        currentValue = original;
     }
 
     return Status::OK();
@@ -115,50 +120,55 @@ LogicalTime LogicalClock::reserveTicks(uint64_t nTicks) {
 
     invariant(nTicks > 0 && nTicks <= kMaxSignedInt);
 
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
+    while (true) {
+        const auto currentValue = _clusterTime.load();
+        LogicalTime clusterTime = LogicalTime(Timestamp(currentValue));
 
-    LogicalTime clusterTime = _clusterTime;
+        const unsigned wallClockSecs =
+            durationCount<Seconds>(_service->getFastClockSource()->now().toDurationSinceEpoch());
+        unsigned clusterTimeSecs = clusterTime.asTimestamp().getSecs();
 
-    const unsigned wallClockSecs =
-        durationCount<Seconds>(_service->getFastClockSource()->now().toDurationSinceEpoch());
-    unsigned clusterTimeSecs = clusterTime.asTimestamp().getSecs();
+        // Synchronize clusterTime with wall clock time, if clusterTime was behind in seconds.
+        if (clusterTimeSecs < wallClockSecs) {
+            clusterTime = LogicalTime(Timestamp(wallClockSecs, 0));
+        }
+        // If reserving 'nTicks' would force the cluster timestamp's increment field to exceed
+        // (2^31-1), overflow by moving to the next second. We use the signed integer maximum as an
+        // overflow point in order to preserve compatibility with potentially signed or unsigned
+        // integral Timestamp increment types. It is also unlikely to apply more than 2^31 oplog
+        // entries in the span of one second.
+        else if (clusterTime.asTimestamp().getInc() > (kMaxSignedInt - nTicks)) {
+
+            log() << "Exceeded maximum allowable increment value within one second. Moving "
+                     "clusterTime forward to the next second.";
+
+            // Move time forward to the next second
+            clusterTime = LogicalTime(Timestamp(clusterTime.asTimestamp().getSecs() + 1, 0));
+        }
 
-    // Synchronize clusterTime with wall clock time, if clusterTime was behind in seconds.
-    if (clusterTimeSecs < wallClockSecs) {
-        clusterTime = LogicalTime(Timestamp(wallClockSecs, 0));
-    }
-    // If reserving 'nTicks' would force the cluster timestamp's increment field to exceed (2^31-1),
-    // overflow by moving to the next second. We use the signed integer maximum as an overflow point
-    // in order to preserve compatibility with potentially signed or unsigned integral Timestamp
-    // increment types. It is also unlikely to apply more than 2^31 oplog entries in the span of one
-    // second.
-    else if (clusterTime.asTimestamp().getInc() > (kMaxSignedInt - nTicks)) {
-
-        log() << "Exceeded maximum allowable increment value within one second. Moving clusterTime "
-                 "forward to the next second.";
-
-        // Move time forward to the next second
-        clusterTime = LogicalTime(Timestamp(clusterTime.asTimestamp().getSecs() + 1, 0));
-    }
+        uassert(40482,
+                "cluster time cannot be advanced beyond its maximum value",
+                lessThanOrEqualToMaxPossibleTime(clusterTime, nTicks));
 
-    uassert(40482,
-            "cluster time cannot be advanced beyond its maximum value",
-            lessThanOrEqualToMaxPossibleTime(clusterTime, nTicks));
+        // The first reserved tick.
+        clusterTime.addTicks(1);
 
-    // Save the next cluster time.
-    clusterTime.addTicks(1);
-    _clusterTime = clusterTime;
+        // The clock advances past all the reserved ticks; if no other thread advanced it in the
+        // meantime, the range [clusterTime, clusterTime + nTicks - 1] belongs to this caller.
+        LogicalTime reservedEnd = clusterTime;
+        if (nTicks > 1) {
+            reservedEnd.addTicks(nTicks - 1);
+        }
 
-    // Add the rest of the requested ticks if needed.
-    if (nTicks > 1) {
-        _clusterTime.addTicks(nTicks - 1);
+        if (_clusterTime.compareAndSwap(currentValue, reservedEnd.asTimestamp().asULL()) ==
+            currentValue) {
+            return clusterTime;
+        }
+        // Lost the race with a concurrent advance; recompute against the new clock value.
     }
-
-    return clusterTime;
 }
 
 void LogicalClock::setClusterTimeFromTrustedSource(LogicalTime newTime) {
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
     // Rate limit checks are skipped here so a server with no activity for longer than
     // maxAcceptableLogicalClockDriftSecs seconds can still have its cluster time initialized.
 
@@ -166,12 +176,18 @@ void LogicalClock::setClusterTimeFromTrustedSource(LogicalTime newTime) {
             "cluster time cannot be advanced beyond its maximum value",
             lessThanOrEqualToMaxPossibleTime(newTime, 0));
 
-    if (newTime > _clusterTime) {
-        _clusterTime = newTime;
+    auto newTimeValue = newTime.asTimestamp().asULL();
+    auto currentValue = _clusterTime.load();
+    while (newTimeValue > currentValue) {
+        auto original = _clusterTime.compareAndSwap(currentValue, newTimeValue);
+        if (original == currentValue) {
+            break;
+        }
+        currentValue = original;
     }
 }
 
-Status LogicalClock::_passesRateLimiter_inlock(LogicalTime newTime) {
+Status LogicalClock::_passesRateLimiter(LogicalTime newTime) {
     const unsigned wallClockSecs =
         durationCount<Seconds>(_service->getFastClockSource()->now().toDurationSinceEpoch());
     auto maxAcceptableDriftSecs = static_cast<const unsigned>(maxAcceptableLogicalClockDriftSecs);
@@ -194,13 +210,11 @@ Status LogicalClock::_passesRateLimiter_inlock(LogicalTime newTime) {
 }
 
 bool LogicalClock::isEnabled() const {
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
-    return _isEnabled;
+    return _isEnabled.load();
 }
 
 void LogicalClock::disable() {
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
-    _isEnabled = false;
+    _isEnabled.store(false);
 }
 
 }  // namespace mongo
@@ -31,7 +31,7 @@
 #pragma once
 
 #include "mongo/db/logical_time.h"
-#include "mongo/stdx/mutex.h"
+#include "mongo/platform/atomic_word.h"
 
 namespace mongo {
 class ServiceContext;
@@ -106,14 +106,15 @@ private:
      * Rate limiter for advancing cluster time. Rejects newTime if its seconds value is more than
      * kMaxAcceptableLogicalClockDriftSecs seconds ahead of this node's wall clock.
      */
-    Status _passesRateLimiter_inlock(LogicalTime newTime);
+    Status _passesRateLimiter(LogicalTime newTime);
 
     ServiceContext* const _service;
 
-    // The mutex protects _clusterTime and _isEnabled.
-    mutable stdx::mutex _mutex;
-    LogicalTime _clusterTime;
-    bool _isEnabled{true};
+    // The cluster time is gossiped on essentially every command, so it is kept as the 64-bit
+    // representation of its Timestamp and advanced with lock-free compare-and-swap loops that
+    // only ever move it forward.
+    AtomicWord<unsigned long long> _clusterTime{0};
+    AtomicWord<bool> _isEnabled{true};
 };
 
 }  // namespace mongo
@@ -106,9 +106,9 @@ LogicalSessionCacheImpl::~LogicalSessionCacheImpl() {
 }
 
 Status LogicalSessionCacheImpl::promote(LogicalSessionId lsid) {
-    stdx::lock_guard<stdx::mutex> lk(_cacheMutex);
-    auto it = _activeSessions.find(lsid);
-    if (it == _activeSessions.end()) {
+    auto& partition = _partition(lsid);
+    stdx::lock_guard<stdx::mutex> lk(partition.mutex);
+    if (partition.sessions.find(lsid) == partition.sessions.end()) {
         return {ErrorCodes::NoSuchSession, "no matching session record found in the cache"};
     }
 
@@ -181,8 +181,12 @@ Date_t LogicalSessionCacheImpl::now() {
 }
 
 size_t LogicalSessionCacheImpl::size() {
-    stdx::lock_guard<stdx::mutex> lock(_cacheMutex);
-    return _activeSessions.size();
+    size_t size = 0;
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lk(partition.mutex);
+        size += partition.sessions.size();
+    }
+    return size;
 }
 
 void LogicalSessionCacheImpl::_periodicRefresh(Client* client) {
@@ -324,23 +328,29 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
         using std::swap;
         stdx::lock_guard<stdx::mutex> lk(_cacheMutex);
         swap(explicitlyEndingSessions, _endingSessions);
-        swap(activeSessions, _activeSessions);
+    }
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lk(partition.mutex);
+        for (auto& it : partition.sessions) {
+            activeSessions.emplace(it.first, std::move(it.second));
+        }
+        partition.sessions.clear();
     }
 
     // Create guards that in the case of a exception replace the ending or active sessions that
-    // swapped out of LogicalSessionCache, and merges in any records that had been added since we
-    // swapped them out.
-    auto backSwap = [this](auto& member, auto& temp) {
-        stdx::lock_guard<stdx::mutex> lk(_cacheMutex);
-        using std::swap;
-        swap(member, temp);
-        for (const auto& it : temp) {
-            member.emplace(it);
+    // swapped out of LogicalSessionCache, without overwriting any records that had been added
+    // since we swapped them out.
+    auto activeSessionsBackSwapper = makeGuard([&] {
+        for (const auto& it : activeSessions) {
+            auto& partition = _partition(it.first);
+            stdx::lock_guard<stdx::mutex> lk(partition.mutex);
+            partition.sessions.emplace(it.first, it.second);
         }
-    };
-    auto activeSessionsBackSwapper = makeGuard([&] { backSwap(_activeSessions, activeSessions); });
-    auto explicitlyEndingBackSwaper =
-        makeGuard([&] { backSwap(_endingSessions, explicitlyEndingSessions); });
+    });
+    auto explicitlyEndingBackSwaper = makeGuard([&] {
+        stdx::lock_guard<stdx::mutex> lk(_cacheMutex);
+        _endingSessions.insert(explicitlyEndingSessions.begin(), explicitlyEndingSessions.end());
+    });
 
     // remove all explicitlyEndingSessions from activeSessions
     for (const auto& lsid : explicitlyEndingSessions) {
@@ -386,16 +396,12 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
     KillAllSessionsByPatternSet patterns;
 
     auto openCursorSessions = _service->getOpenCursorSessions();
-    // Exclude sessions added to _activeSessions from the openCursorSession to avoid race between
-    // killing cursors on the removed sessions and creating sessions.
-    {
-        stdx::lock_guard<stdx::mutex> lk(_cacheMutex);
-
-        for (const auto& it : _activeSessions) {
-            auto newSessionIt = openCursorSessions.find(it.first);
-            if (newSessionIt != openCursorSessions.end()) {
-                openCursorSessions.erase(newSessionIt);
-            }
+    // Exclude sessions added to the cache since the swap above from the openCursorSessions to
+    // avoid race between killing cursors on the removed sessions and creating sessions.
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lk(partition.mutex);
+        for (const auto& it : partition.sessions) {
+            openCursorSessions.erase(it.first);
         }
     }
 
@@ -430,38 +436,46 @@ void LogicalSessionCacheImpl::endSessions(const LogicalSessionIdSet& sessions) {
 }
 
 LogicalSessionCacheStats LogicalSessionCacheImpl::getStats() {
+    const auto activeSessionsCount = size();
     stdx::lock_guard<stdx::mutex> lk(_cacheMutex);
-    _stats.setActiveSessionsCount(_activeSessions.size());
+    _stats.setActiveSessionsCount(activeSessionsCount);
     return _stats;
 }
 
 Status LogicalSessionCacheImpl::_addToCache(LogicalSessionRecord record) {
-    stdx::lock_guard<stdx::mutex> lk(_cacheMutex);
-    if (_activeSessions.size() >= static_cast<size_t>(maxSessions)) {
+    // The bound is checked against the sum of the partition sizes before inserting, so
+    // concurrent inserts may transiently overshoot it by a handful of records; the limit is a
+    // safety valve, not an exact quota.
+    if (size() >= static_cast<size_t>(maxSessions)) {
         return {ErrorCodes::TooManyLogicalSessions, "cannot add session into the cache"};
     }
-    _activeSessions.insert(std::make_pair(record.getId(), record));
+    auto& partition = _partition(record.getId());
+    stdx::lock_guard<stdx::mutex> lk(partition.mutex);
+    partition.sessions.insert(std::make_pair(record.getId(), record));
     return Status::OK();
 }
 
 std::vector<LogicalSessionId> LogicalSessionCacheImpl::listIds() const {
-    stdx::lock_guard<stdx::mutex> lk(_cacheMutex);
     std::vector<LogicalSessionId> ret;
-    ret.reserve(_activeSessions.size());
-    for (const auto& id : _activeSessions) {
-        ret.push_back(id.first);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lk(partition.mutex);
+        for (const auto& id : partition.sessions) {
+            ret.push_back(id.first);
+        }
     }
     return ret;
 }
 
 std::vector<LogicalSessionId> LogicalSessionCacheImpl::listIds(
     const std::vector<SHA256Block>& userDigests) const {
-    stdx::lock_guard<stdx::mutex> lk(_cacheMutex);
     std::vector<LogicalSessionId> ret;
-    for (const auto& it : _activeSessions) {
-        if (std::find(userDigests.cbegin(), userDigests.cend(), it.first.getUid()) !=
-            userDigests.cend()) {
-            ret.push_back(it.first);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lk(partition.mutex);
+        for (const auto& it : partition.sessions) {
+            if (std::find(userDigests.cbegin(), userDigests.cend(), it.first.getUid()) !=
+                userDigests.cend()) {
+                ret.push_back(it.first);
+            }
         }
     }
     return ret;
@@ -469,9 +483,10 @@ std::vector<LogicalSessionId> LogicalSessionCacheImpl::listIds(
 
 boost::optional<LogicalSessionRecord> LogicalSessionCacheImpl::peekCached(
     const LogicalSessionId& id) const {
-    stdx::lock_guard<stdx::mutex> lk(_cacheMutex);
-    const auto it = _activeSessions.find(id);
-    if (it == _activeSessions.end()) {
+    auto& partition = _partition(id);
+    stdx::lock_guard<stdx::mutex> lk(partition.mutex);
+    const auto it = partition.sessions.find(id);
+    if (it == partition.sessions.end()) {
         return boost::none;
     }
     return it->second;
@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include <array>
+
 #include "mongo/db/logical_session_cache.h"
 #include "mongo/db/logical_session_id.h"
 #include "mongo/db/refresh_sessions_gen.h"
@@ -38,6 +40,7 @@
 #include "mongo/db/time_proof_service.h"
 #include "mongo/db/transaction_reaper.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/new.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/util/lru_cache.h"
 
@@ -163,9 +166,27 @@ private:
     mutable stdx::mutex _reaperMutex;
     std::shared_ptr<TransactionReaper> _transactionReaper;
 
+    // Protects '_stats' and '_endingSessions'. The active session records live in the
+    // partitions below.
     mutable stdx::mutex _cacheMutex;
 
-    LogicalSessionIdMap<LogicalSessionRecord> _activeSessions;
+    // The active session records are partitioned by the hash of the logical session id, each
+    // partition with its own mutex, so that the per-operation vivify of different sessions does
+    // not funnel through a single lock. A record lives in exactly one partition. This mirrors
+    // the partitioning of the SessionCatalog.
+    static const size_t kNumCachePartitions = 64;
+
+    // Padded to a cache line so adjacent partitions in the array do not falsely share one.
+    struct alignas(stdx::hardware_destructive_interference_size) CachePartition {
+        mutable stdx::mutex mutex;
+        LogicalSessionIdMap<LogicalSessionRecord> sessions;
+    };
+
+    CachePartition& _partition(const LogicalSessionId& lsid) const {
+        return _partitions[LogicalSessionIdHash{}(lsid) % kNumCachePartitions];
+    }
+
+    mutable std::array<CachePartition, kNumCachePartitions> _partitions;
 
     LogicalSessionIdSet _endingSessions;
 
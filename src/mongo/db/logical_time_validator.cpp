@@ -103,6 +103,7 @@ SignedLogicalTime LogicalTimeValidator::_getProof(const KeysCollectionDocument&
 
     if (newTime > _lastSeenValidTime.getTime() || !_lastSeenValidTime.getProof()) {
         _lastSeenValidTime = newSignedTime;
+        _lastSeenValidTimeValue.store(newTime.asTimestamp().asULL());
     }
 
     return newSignedTime;
@@ -143,11 +144,11 @@ SignedLogicalTime LogicalTimeValidator::signLogicalTime(OperationContext* opCtx,
 }
 
 Status LogicalTimeValidator::validate(OperationContext* opCtx, const SignedLogicalTime& newTime) {
-    {
-        stdx::lock_guard<stdx::mutex> lk(_mutex);
-        if (newTime.getTime() <= _lastSeenValidTime.getTime()) {
-            return Status::OK();
-        }
+    // Gossiped times rarely run ahead of the last time this node signed or validated, so the
+    // common case is an atomic load rather than a mutex acquisition. A stale read here is safe:
+    // it can only send us into the full proof check below.
+    if (newTime.getTime().asTimestamp().asULL() <= _lastSeenValidTimeValue.load()) {
+        return Status::OK();
     }
 
     auto keyStatus =
@@ -205,6 +206,7 @@ void LogicalTimeValidator::resetKeyManagerCache() {
     }
     stdx::lock_guard<stdx::mutex> lk(_mutex);
     _lastSeenValidTime = SignedLogicalTime();
+    _lastSeenValidTimeValue.store(0);
     _timeProofService.resetCache();
 }
 
@@ -217,6 +219,7 @@ void LogicalTimeValidator::stopKeyManager() {
 
         stdx::lock_guard<stdx::mutex> lk(_mutex);
         _lastSeenValidTime = SignedLogicalTime();
+        _lastSeenValidTimeValue.store(0);
         _timeProofService.resetCache();
     } else {
         log() << "Stopping key manager: no key manager exists.";
@@ -224,7 +227,10 @@ void LogicalTimeValidator::stopKeyManager() {
 }
 
 std::shared_ptr<KeysCollectionManager> LogicalTimeValidator::_getKeyManagerCopy() {
-    stdx::lock_guard<stdx::mutex> lk(_mutexKeyManager);
+    // '_keyManager' is set once at construction and never reassigned; all mutable state lives
+    // behind the pointer in the manager itself. Copying the pointer therefore needs no lock,
+    // keeping the per-message sign and validate paths off '_mutexKeyManager', which now only
+    // serializes stop/clearCache state changes against each other.
     invariant(_keyManager);
     return _keyManager;
 }
@@ -34,6 +34,7 @@
 
 #include "mongo/db/signed_logical_time.h"
 #include "mongo/db/time_proof_service.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/mutex.h"
 
 namespace mongo {
@@ -116,7 +117,8 @@ public:
 
 private:
     /**
-     *  Returns the copy of the _keyManager to work when its reset by resetKeyManager call.
+     * Returns the key manager. The pointer is assigned at construction and never reassigned,
+     * so this takes no lock; see the implementation for the reasoning.
      */
     std::shared_ptr<KeysCollectionManager> _getKeyManagerCopy();
 
@@ -124,8 +126,14 @@ private:
     SignedLogicalTime _getProof(const KeysCollectionDocument& keyDoc, LogicalTime newTime);
 
     stdx::mutex _mutex;            // protects _lastSeenValidTime
-    stdx::mutex _mutexKeyManager;  // protects _keyManager
+    stdx::mutex _mutexKeyManager;  // serializes key manager state changes (stop, cache resets)
     SignedLogicalTime _lastSeenValidTime;
+
+    // The 64-bit Timestamp representation of _lastSeenValidTime's time, mirrored outside _mutex so
+    // validate() can check its fast path, a time at or below the last validated one, with a plain
+    // atomic load. Guarded by _mutex for writes.
+    AtomicWord<unsigned long long> _lastSeenValidTimeValue{0};
+
     TimeProofService _timeProofService;
     std::shared_ptr<KeysCollectionManager> _keyManager;
 };
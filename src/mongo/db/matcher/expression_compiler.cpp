@@ -0,0 +1,200 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/matcher/expression_compiler.h"
+
+#include "mongo/db/matcher/expression.h"
+#include "mongo/db/matcher/expression_leaf.h"
+
+namespace mongo {
+
+namespace {
+
+// Predicates are tracked in a fixed-width bitmask while scanning the document.
+constexpr size_t kMaxPredicates = 32;
+
+bool isSupportedOperand(const BSONElement& rhs) {
+    switch (rhs.type()) {
+        case NumberInt:
+        case NumberLong:
+        case NumberDouble:
+        case NumberDecimal:
+        case String:
+        case Bool:
+        case jstOID:
+        case Date:
+        case bsonTimestamp:
+            return true;
+        default:
+            // Arrays, objects, null, regexes, and the extremal types all carry match semantics
+            // beyond plain value comparison; leave them to the interpreted matcher.
+            return false;
+    }
+}
+
+bool isSupportedPath(StringData path) {
+    // Dotted paths require the full ElementPath array-traversal semantics.
+    return !path.empty() && path.find('.') == std::string::npos;
+}
+
+}  // namespace
+
+std::unique_ptr<CompiledMatchExpression> CompiledMatchExpression::compile(
+    const MatchExpression* expr) {
+    std::vector<const MatchExpression*> leaves;
+    if (expr->matchType() == MatchExpression::AND) {
+        for (size_t i = 0; i < expr->numChildren(); ++i) {
+            leaves.push_back(expr->getChild(i));
+        }
+    } else {
+        leaves.push_back(expr);
+    }
+
+    if (leaves.empty() || leaves.size() > kMaxPredicates) {
+        return nullptr;
+    }
+
+    std::unique_ptr<CompiledMatchExpression> compiled(new CompiledMatchExpression());
+    for (const auto* leaf : leaves) {
+        Predicate pred;
+        switch (leaf->matchType()) {
+            case MatchExpression::EQ:
+                pred.op = Op::kEq;
+                break;
+            case MatchExpression::LT:
+                pred.op = Op::kLt;
+                break;
+            case MatchExpression::LTE:
+                pred.op = Op::kLte;
+                break;
+            case MatchExpression::GT:
+                pred.op = Op::kGt;
+                break;
+            case MatchExpression::GTE:
+                pred.op = Op::kGte;
+                break;
+            case MatchExpression::EXISTS:
+                pred.op = Op::kExists;
+                break;
+            default:
+                return nullptr;
+        }
+
+        if (pred.op == Op::kExists) {
+            pred.path = static_cast<const ExistsMatchExpression*>(leaf)->path();
+        } else {
+            const auto* comparison = static_cast<const ComparisonMatchExpression*>(leaf);
+            if (comparison->getCollator() || !isSupportedOperand(comparison->getData())) {
+                return nullptr;
+            }
+            pred.path = comparison->path();
+            pred.rhs = comparison->getData();
+        }
+
+        if (!isSupportedPath(pred.path)) {
+            return nullptr;
+        }
+        compiled->_predicates.push_back(pred);
+    }
+
+    return compiled;
+}
+
+bool CompiledMatchExpression::_elementSatisfies(const BSONElement& el, const Predicate& pred) {
+    if (pred.op == Op::kExists) {
+        return true;
+    }
+
+    // Comparisons only apply within a canonical type class (with all numeric types sharing
+    // one), mirroring the type bracketing of the interpreted matcher.
+    auto satisfiesScalar = [&](const BSONElement& value) {
+        if (value.canonicalType() != pred.rhs.canonicalType()) {
+            return false;
+        }
+        const int cmp = value.woCompare(pred.rhs, /*considerFieldName*/ false);
+        switch (pred.op) {
+            case Op::kEq:
+                return cmp == 0;
+            case Op::kLt:
+                return cmp < 0;
+            case Op::kLte:
+                return cmp <= 0;
+            case Op::kGt:
+                return cmp > 0;
+            case Op::kGte:
+                return cmp >= 0;
+            case Op::kExists:
+                MONGO_UNREACHABLE;
+        }
+        MONGO_UNREACHABLE;
+    };
+
+    if (el.type() == Array) {
+        // A leaf comparison against an array field matches if any array element matches.
+        for (auto&& arrayElement : el.embeddedObject()) {
+            if (satisfiesScalar(arrayElement)) {
+                return true;
+            }
+        }
+        return false;
+    }
+    return satisfiesScalar(el);
+}
+
+bool CompiledMatchExpression::matches(const BSONObj& obj) const {
+    const uint32_t allSatisfied = (_predicates.size() == kMaxPredicates)
+        ? ~uint32_t(0)
+        : ((uint32_t(1) << _predicates.size()) - 1);
+    uint32_t satisfied = 0;
+    uint32_t visited = 0;
+
+    for (auto&& el : obj) {
+        const StringData fieldName = el.fieldNameStringData();
+        for (size_t i = 0; i < _predicates.size(); ++i) {
+            const uint32_t bit = uint32_t(1) << i;
+            // Only the first occurrence of a field participates, matching the interpreted
+            // matcher's path resolution over documents with duplicate field names.
+            if ((visited & bit) || _predicates[i].path != fieldName) {
+                continue;
+            }
+            visited |= bit;
+            if (_elementSatisfies(el, _predicates[i])) {
+                satisfied |= bit;
+            }
+        }
+        if (satisfied == allSatisfied) {
+            return true;
+        }
+    }
+    return satisfied == allSatisfied;
+}
+
+}  // namespace mongo
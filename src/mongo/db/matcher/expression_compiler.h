@@ -0,0 +1,85 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
+
+namespace mongo {
+
+class MatchExpression;
+
+/**
+ * A linearized evaluator for the conjunctions of simple predicates that dominate hot filters: an
+ * $and (or single leaf) of {$eq, $lt, $lte, $gt, $gte, $exists} over non-dotted paths, with
+ * simple collation and scalar operands. Evaluation is a single pass over the document's fields
+ * with no virtual dispatch and no per-predicate re-traversal, short-circuiting as soon as all
+ * predicates are satisfied.
+ *
+ * compile() returns nullptr for expressions outside this subset; callers keep the original
+ * MatchExpression and must fall back to matchesBSON(). The compiled matcher holds BSONElement
+ * views into the expression's backing BSON, so the source MatchExpression must outlive it.
+ */
+class CompiledMatchExpression {
+public:
+    /**
+     * Attempts to compile 'expr'. Returns nullptr if the expression shape is unsupported.
+     */
+    static std::unique_ptr<CompiledMatchExpression> compile(const MatchExpression* expr);
+
+    /**
+     * Equivalent to expr->matchesBSON(obj) for the supported subset.
+     */
+    bool matches(const BSONObj& obj) const;
+
+    size_t numPredicates() const {
+        return _predicates.size();
+    }
+
+private:
+    enum class Op { kEq, kLt, kLte, kGt, kGte, kExists };
+
+    struct Predicate {
+        StringData path;
+        Op op;
+        BSONElement rhs;  // eoo for kExists.
+    };
+
+    CompiledMatchExpression() = default;
+
+    static bool _elementSatisfies(const BSONElement& el, const Predicate& pred);
+
+    std::vector<Predicate> _predicates;
+};
+
+}  // namespace mongo
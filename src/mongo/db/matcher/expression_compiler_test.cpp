@@ -0,0 +1,130 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/matcher/expression_compiler.h"
+
+#include "mongo/bson/json.h"
+#include "mongo/db/matcher/expression_parser.h"
+#include "mongo/db/pipeline/expression_context_for_test.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+std::unique_ptr<MatchExpression> parse(const BSONObj& query) {
+    boost::intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    return uassertStatusOK(MatchExpressionParser::parse(query, expCtx));
+}
+
+void assertAgreement(const MatchExpression* expr,
+                     const CompiledMatchExpression* compiled,
+                     const BSONObj& doc) {
+    ASSERT_EQ(expr->matchesBSON(doc), compiled->matches(doc)) << "doc: " << doc;
+}
+
+TEST(ExpressionCompiler, CompilesConjunctionOfComparisons) {
+    auto query = fromjson("{a: 1, b: {$gt: 5}, c: {$lte: 'mongo'}}");
+    auto expr = parse(query);
+    auto compiled = CompiledMatchExpression::compile(expr.get());
+    ASSERT(compiled);
+    ASSERT_EQ(compiled->numPredicates(), 3u);
+
+    const BSONObj docs[] = {
+        fromjson("{a: 1, b: 6, c: 'abc'}"),
+        fromjson("{a: 1, b: 6, c: 'zebra'}"),
+        fromjson("{a: 1, b: 5, c: 'abc'}"),
+        fromjson("{a: 2, b: 6, c: 'abc'}"),
+        fromjson("{b: 6, c: 'abc'}"),
+        fromjson("{a: 1.0, b: NumberLong(100), c: 'abc'}"),
+        fromjson("{a: '1', b: 6, c: 'abc'}"),
+        fromjson("{c: 'abc', b: 6, a: 1}"),
+        fromjson("{a: 1, b: 6, c: 'abc', extra: true}"),
+    };
+    for (auto&& doc : docs) {
+        assertAgreement(expr.get(), compiled.get(), doc);
+    }
+}
+
+TEST(ExpressionCompiler, CompilesSingleLeafAndExists) {
+    auto query = fromjson("{a: {$exists: true}}");
+    auto expr = parse(query);
+    auto compiled = CompiledMatchExpression::compile(expr.get());
+    ASSERT(compiled);
+
+    assertAgreement(expr.get(), compiled.get(), fromjson("{a: 1}"));
+    assertAgreement(expr.get(), compiled.get(), fromjson("{a: null}"));
+    assertAgreement(expr.get(), compiled.get(), fromjson("{b: 1}"));
+}
+
+TEST(ExpressionCompiler, MatchesAnyArrayElement) {
+    auto query = fromjson("{a: {$gt: 5}}");
+    auto expr = parse(query);
+    auto compiled = CompiledMatchExpression::compile(expr.get());
+    ASSERT(compiled);
+
+    assertAgreement(expr.get(), compiled.get(), fromjson("{a: [1, 10]}"));
+    assertAgreement(expr.get(), compiled.get(), fromjson("{a: [1, 2]}"));
+    assertAgreement(expr.get(), compiled.get(), fromjson("{a: []}"));
+    assertAgreement(expr.get(), compiled.get(), fromjson("{a: ['x']}"));
+}
+
+TEST(ExpressionCompiler, RejectsUnsupportedShapes) {
+    const BSONObj unsupported[] = {
+        fromjson("{$or: [{a: 1}, {b: 1}]}"),
+        fromjson("{'a.b': 1}"),
+        fromjson("{a: null}"),
+        fromjson("{a: {$in: [1, 2]}}"),
+        fromjson("{a: {$regex: 'abc'}}"),
+        fromjson("{a: [1, 2]}"),
+        fromjson("{a: {b: 1}}"),
+        fromjson("{a: {$size: 2}}"),
+    };
+    for (auto&& query : unsupported) {
+        auto expr = parse(query);
+        ASSERT_FALSE(CompiledMatchExpression::compile(expr.get())) << "query: " << query;
+    }
+}
+
+TEST(ExpressionCompiler, HonorsFirstOccurrenceOfDuplicateFieldNames) {
+    auto query = fromjson("{a: 2}");
+    auto expr = parse(query);
+    auto compiled = CompiledMatchExpression::compile(expr.get());
+    ASSERT(compiled);
+
+    BSONObjBuilder bob;
+    bob.append("a", 1);
+    bob.append("a", 2);
+    const BSONObj doc = bob.obj();
+    assertAgreement(expr.get(), compiled.get(), doc);
+}
+
+}  // namespace
+}  // namespace mongo
@@ -34,6 +34,7 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/matcher/path_internal.h"
 #include "mongo/platform/basic.h"
+#include "mongo/stdx/memory.h"
 
 namespace mongo {
 
@@ -109,8 +110,10 @@ void BSONElementIterator::reset(const ElementPath* path,
     _state = BEGIN;
     _next.reset();
 
-    _subCursor.reset();
-    _subCursorPath.reset();
+    // Retire any active subcursor into the cache and keep '_subCursorPath' alive:
+    // _startSubCursor() and _initSubCursorPath() reuse them when this iterator is reset to
+    // traverse another document along the same path.
+    _subCursorCache = std::move(_subCursor);
 }
 
 void BSONElementIterator::reset(const ElementPath* path, const BSONObj& objectToIterate) {
@@ -121,8 +124,10 @@ void BSONElementIterator::reset(const ElementPath* path, const BSONObj& objectTo
     _state = BEGIN;
     _next.reset();
 
-    _subCursor.reset();
-    _subCursorPath.reset();
+    // Retire any active subcursor into the cache and keep '_subCursorPath' alive:
+    // _startSubCursor() and _initSubCursorPath() reuse them when this iterator is reset to
+    // traverse another document along the same path.
+    _subCursorCache = std::move(_subCursor);
 }
 
 void BSONElementIterator::_setTraversalStart(size_t suffixIndex, BSONElement elementToIterate) {
@@ -140,6 +145,25 @@ void BSONElementIterator::_setTraversalStart(size_t suffixIndex, BSONElement ele
     }
 }
 
+void BSONElementIterator::_initSubCursorPath(StringData subPath) {
+    if (!_subCursorPath || _subCursorPath->fieldRef().dottedField() != subPath) {
+        if (!_subCursorPath) {
+            _subCursorPath = stdx::make_unique<ElementPath>();
+        }
+        _subCursorPath->init(subPath);
+    }
+    _subCursorPath->setLeafArrayBehavior(_path->leafArrayBehavior());
+}
+
+void BSONElementIterator::_startSubCursor(const BSONObj& objectToIterate) {
+    if (_subCursorCache) {
+        _subCursor = std::move(_subCursorCache);
+        _subCursor->reset(_subCursorPath.get(), objectToIterate);
+    } else {
+        _subCursor = stdx::make_unique<BSONElementIterator>(_subCursorPath.get(), objectToIterate);
+    }
+}
+
 void BSONElementIterator::ArrayIterationState::reset(const FieldRef& ref, int start) {
     restOfPath = ref.dottedField(start).toString();
     hasMore = restOfPath.size() > 0;
@@ -160,7 +184,7 @@ bool BSONElementIterator::ArrayIterationState::isArrayOffsetMatch(StringData fie
 
 void BSONElementIterator::ArrayIterationState::startIterator(BSONElement e) {
     _theArray = e;
-    _iterator.reset(new BSONObjIterator(_theArray.Obj()));
+    _iterator.emplace(_theArray.Obj());
 }
 
 bool BSONElementIterator::ArrayIterationState::more() {
@@ -179,7 +203,7 @@ bool BSONElementIterator::subCursorHasMore() {
         if (_subCursor->more()) {
             return true;
         }
-        _subCursor.reset();
+        _subCursorCache = std::move(_subCursor);
 
         // If the subcursor doesn't have more, see if the current element is an array offset
         // match (see comment in BSONElementIterator::more() for an example).  If it is indeed
@@ -194,18 +218,15 @@ bool BSONElementIterator::subCursorHasMore() {
                 return true;
             }
 
-            _subCursorPath.reset(new ElementPath());
-            _subCursorPath->init(_arrayIterationState.restOfPath.substr(
-                _arrayIterationState.nextPieceOfPath.size() + 1));
-            _subCursorPath->setLeafArrayBehavior(_path->leafArrayBehavior());
+            _initSubCursorPath(StringData(_arrayIterationState.restOfPath)
+                                   .substr(_arrayIterationState.nextPieceOfPath.size() + 1));
 
             // If we're here, we must be able to traverse nonleaf arrays.
             dassert(_path->nonLeafArrayBehavior() == ElementPath::NonLeafArrayBehavior::kTraverse);
             dassert(_subCursorPath->nonLeafArrayBehavior() ==
                     ElementPath::NonLeafArrayBehavior::kTraverse);
 
-            _subCursor.reset(
-                new BSONElementIterator(_subCursorPath.get(), _arrayIterationState._current.Obj()));
+            _startSubCursor(_arrayIterationState._current.Obj());
 
             // Set _arrayIterationState._current to EOO. This is not an implicit array traversal, so
             // we should not override the array offset of the subcursor with the current array
@@ -284,11 +305,9 @@ bool BSONElementIterator::more() {
             if (eltInArray.type() == Object) {
                 // The current array element is a subdocument.  See if the subdocument generates
                 // any elements matching the remaining subpath.
-                _subCursorPath.reset(new ElementPath());
-                _subCursorPath->init(_arrayIterationState.restOfPath);
-                _subCursorPath->setLeafArrayBehavior(_path->leafArrayBehavior());
+                _initSubCursorPath(_arrayIterationState.restOfPath);
 
-                _subCursor.reset(new BSONElementIterator(_subCursorPath.get(), eltInArray.Obj()));
+                _startSubCursor(eltInArray.Obj());
                 if (subCursorHasMore()) {
                     return true;
                 }
@@ -310,16 +329,13 @@ bool BSONElementIterator::more() {
                 if (eltInArray.type() == Array) {
                     // The current array element is itself an array.  See if the nested array
                     // has any elements matching the remainihng.
-                    _subCursorPath.reset(new ElementPath());
-                    _subCursorPath->init(_arrayIterationState.restOfPath.substr(
-                        _arrayIterationState.nextPieceOfPath.size() + 1));
-                    _subCursorPath->setLeafArrayBehavior(_path->leafArrayBehavior());
-                    BSONElementIterator* real = new BSONElementIterator(
-                        _subCursorPath.get(), _arrayIterationState._current.Obj());
-                    _subCursor.reset(real);
-                    real->_arrayIterationState.reset(_subCursorPath->fieldRef(), 0);
-                    real->_arrayIterationState.startIterator(eltInArray);
-                    real->_state = IN_ARRAY;
+                    _initSubCursorPath(
+                        StringData(_arrayIterationState.restOfPath)
+                            .substr(_arrayIterationState.nextPieceOfPath.size() + 1));
+                    _startSubCursor(_arrayIterationState._current.Obj());
+                    _subCursor->_arrayIterationState.reset(_subCursorPath->fieldRef(), 0);
+                    _subCursor->_arrayIterationState.startIterator(eltInArray);
+                    _subCursor->_state = IN_ARRAY;
 
                     // Set _arrayIterationState._current to EOO. This is not an implicit array
                     // traversal, so we should not override the array offset of the subcursor with
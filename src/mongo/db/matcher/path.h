@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <boost/optional.hpp>
 
 #include "mongo/base/status.h"
 #include "mongo/base/string_data.h"
@@ -222,6 +223,19 @@ private:
      */
     void _setTraversalStart(size_t suffixIndex, BSONElement elementToIterate);
 
+    /**
+     * Points '_subCursorPath' at 'subPath', reusing the previously parsed ElementPath if it
+     * already holds that path. All elements of an array share the same remaining subpath, so this
+     * avoids re-parsing it for every element traversed.
+     */
+    void _initSubCursorPath(StringData subPath);
+
+    /**
+     * Makes '_subCursor' iterate 'objectToIterate' along '_subCursorPath', recycling the
+     * iterator retired into '_subCursorCache' instead of allocating when possible.
+     */
+    void _startSubCursor(const BSONObj& objectToIterate);
+
     const ElementPath* _path;
 
     // The element where we begin our iteration. This is either:
@@ -255,12 +269,16 @@ private:
 
         BSONElement _theArray;
         BSONElement _current;
-        std::unique_ptr<BSONObjIterator> _iterator;
+        boost::optional<BSONObjIterator> _iterator;
     };
 
     ArrayIterationState _arrayIterationState;
 
-    std::unique_ptr<ElementIterator> _subCursor;
+    std::unique_ptr<BSONElementIterator> _subCursor;
     std::unique_ptr<ElementPath> _subCursorPath;
+
+    // The most recently exhausted subcursor, kept so _startSubCursor() can reset() it for the
+    // next array element rather than allocating a new iterator per element.
+    std::unique_ptr<BSONElementIterator> _subCursorCache;
 };
 }
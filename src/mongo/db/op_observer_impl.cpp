@@ -397,13 +397,17 @@ void OpObserverImpl::onInserts(OperationContext* opCtx,
         using std::end;
         times.insert(end(times), begin(opTimeList), end(opTimeList));
 
-        std::vector<StmtId> stmtIdsWritten;
-        std::transform(first,
-                       last,
-                       std::back_inserter(stmtIdsWritten),
-                       [](const InsertStatement& stmt) { return stmt.stmtId; });
-
-        onWriteOpCompleted(opCtx, nss, stmtIdsWritten, lastOpTime, lastWriteDate, boost::none);
+        // Only writes in a session need to record their statement ids; skip assembling the
+        // vector for the common sessionless case.
+        if (txnParticipant) {
+            std::vector<StmtId> stmtIdsWritten;
+            std::transform(first,
+                           last,
+                           std::back_inserter(stmtIdsWritten),
+                           [](const InsertStatement& stmt) { return stmt.stmtId; });
+
+            onWriteOpCompleted(opCtx, nss, stmtIdsWritten, lastOpTime, lastWriteDate, boost::none);
+        }
     }
 
     size_t index = 0;
@@ -460,12 +464,14 @@ void OpObserverImpl::onUpdate(OperationContext* opCtx, const OplogUpdateEntryArg
         txnParticipant->addTransactionOperation(opCtx, operation);
     } else {
         opTime = replLogUpdate(opCtx, args);
-        onWriteOpCompleted(opCtx,
-                           args.nss,
-                           std::vector<StmtId>{args.updateArgs.stmtId},
-                           opTime.writeOpTime,
-                           opTime.wallClockTime,
-                           boost::none);
+        if (txnParticipant) {
+            onWriteOpCompleted(opCtx,
+                               args.nss,
+                               std::vector<StmtId>{args.updateArgs.stmtId},
+                               opTime.writeOpTime,
+                               opTime.wallClockTime,
+                               boost::none);
+        }
     }
 
     if (args.nss != NamespaceString::kSessionTransactionsTableNamespace) {
@@ -521,12 +527,14 @@ void OpObserverImpl::onDelete(OperationContext* opCtx,
         txnParticipant->addTransactionOperation(opCtx, operation);
     } else {
         opTime = replLogDelete(opCtx, nss, uuid, stmtId, fromMigrate, deletedDoc);
-        onWriteOpCompleted(opCtx,
-                           nss,
-                           std::vector<StmtId>{stmtId},
-                           opTime.writeOpTime,
-                           opTime.wallClockTime,
-                           boost::none);
+        if (txnParticipant) {
+            onWriteOpCompleted(opCtx,
+                               nss,
+                               std::vector<StmtId>{stmtId},
+                               opTime.writeOpTime,
+                               opTime.wallClockTime,
+                               boost::none);
+        }
     }
 
     if (nss != NamespaceString::kSessionTransactionsTableNamespace) {
@@ -193,10 +193,11 @@ bool opShouldFail(Client* client, const BSONObj& failPointInfo) {
 }  // namespace
 
 Status OperationContext::checkForInterruptNoAssert() noexcept {
-    // TODO: Remove the MONGO_likely(getClient()) once all operation contexts are constructed with
-    // clients.
-    if (MONGO_likely(getClient() && getServiceContext()) &&
-        getServiceContext()->getKillAllOperations()) {
+    // TODO: Remove the null check once all operation contexts are constructed with clients.  The
+    // service context is fetched once here rather than per condition; this method runs on the
+    // per-document hot path of every operation.
+    auto serviceContext = getServiceContext();
+    if (MONGO_likely(serviceContext != nullptr) && serviceContext->getKillAllOperations()) {
         return Status(ErrorCodes::InterruptedAtShutdown, "interrupted at shutdown");
     }
 
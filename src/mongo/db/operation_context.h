@@ -63,6 +63,13 @@ namespace repl {
 class UnreplicatedWritesBlock;
 }  // namespace repl
 
+/**
+ * The admission lane an operation competes in when acquiring a global lock ticket. Low-priority
+ * (bulk maintenance) operations are admitted through a capped backlog lane so they cannot crowd
+ * out user traffic; see LockerImpl::_acquireTicket for the enforcement.
+ */
+enum class AdmissionPriority { kNormal, kLow };
+
 /**
  * This class encompasses the state required by an operation and lives from the time a network
  * operation is dispatched until its execution is finished. Note that each "getmore" on a cursor
@@ -237,6 +244,21 @@ public:
         return _writesAreReplicated;
     }
 
+    /**
+     * Returns the admission lane this operation competes in when acquiring a global lock ticket.
+     */
+    AdmissionPriority getAdmissionPriority() const {
+        return _admissionPriority;
+    }
+
+    /**
+     * Sets the admission lane for this operation. Prefer ScopedAdmissionPriority, which restores
+     * the previous lane when the maintenance work is done.
+     */
+    void setAdmissionPriority(AdmissionPriority admissionPriority) {
+        _admissionPriority = admissionPriority;
+    }
+
     /**
      * Marks this operation as killed so that subsequent calls to checkForInterrupt and
      * checkForInterruptNoAssert by the thread executing the operation will start returning the
@@ -466,6 +488,8 @@ private:
     Timer _elapsedTime;
 
     bool _writesAreReplicated = true;
+
+    AdmissionPriority _admissionPriority = AdmissionPriority::kNormal;
 };
 
 /**
@@ -497,6 +521,30 @@ private:
     ServiceContext::UniqueOperationContext _alternateOpCtx;
 };
 
+/**
+ * RAII-style class to run an operation in a different global lock admission lane. Bulk maintenance
+ * (TTL deletes, index builds, migration cloners) should declare itself low-priority with this
+ * class so that it queues behind user traffic for global lock tickets while the object is in
+ * scope.
+ */
+class ScopedAdmissionPriority {
+    MONGO_DISALLOW_COPYING(ScopedAdmissionPriority);
+
+public:
+    ScopedAdmissionPriority(OperationContext* opCtx, AdmissionPriority admissionPriority)
+        : _opCtx(opCtx), _previousPriority(opCtx->getAdmissionPriority()) {
+        _opCtx->setAdmissionPriority(admissionPriority);
+    }
+
+    ~ScopedAdmissionPriority() {
+        _opCtx->setAdmissionPriority(_previousPriority);
+    }
+
+private:
+    OperationContext* _opCtx;
+    const AdmissionPriority _previousPriority;
+};
+
 namespace repl {
 /**
  * RAII-style class to turn off replicated writes. Writes do not create oplog entries while the
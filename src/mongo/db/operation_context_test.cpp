@@ -221,6 +221,24 @@ TEST(OperationContextTest, IgnoreInterruptsWorks) {
     ASSERT_EQUALS(opCtx->getKillStatus(), ErrorCodes::BadValue);
 }
 
+TEST(OperationContextTest, ScopedAdmissionPriorityRestoresPreviousPriority) {
+    auto serviceCtx = ServiceContext::make();
+    auto client = serviceCtx->makeClient("OperationContextTest");
+    auto opCtx = client->makeOperationContext();
+
+    ASSERT(opCtx->getAdmissionPriority() == AdmissionPriority::kNormal);
+    {
+        ScopedAdmissionPriority admissionPriority(opCtx.get(), AdmissionPriority::kLow);
+        ASSERT(opCtx->getAdmissionPriority() == AdmissionPriority::kLow);
+        {
+            ScopedAdmissionPriority innerPriority(opCtx.get(), AdmissionPriority::kNormal);
+            ASSERT(opCtx->getAdmissionPriority() == AdmissionPriority::kNormal);
+        }
+        ASSERT(opCtx->getAdmissionPriority() == AdmissionPriority::kLow);
+    }
+    ASSERT(opCtx->getAdmissionPriority() == AdmissionPriority::kNormal);
+}
+
 class OperationDeadlineTests : public unittest::Test {
 public:
     void setUp() {
@@ -52,7 +52,10 @@ namespace {
  * Validates the nesting depth of 'obj', returning a non-OK status if it exceeds the limit.
  */
 Status validateDepth(const BSONObj& obj) {
-    std::vector<BSONObjIterator> frames;
+    // Reused across calls on this thread so that validating every inserted document does not
+    // come with a heap allocation; the capacity settles at the deepest document seen.
+    thread_local std::vector<BSONObjIterator> frames;
+    frames.clear();
     frames.reserve(16);
     frames.emplace_back(obj);
 
@@ -53,13 +53,21 @@ const char* AccumulatorMinMax::getOpName() const {
 
 void AccumulatorMinMax::processInternal(const Value& input, bool merging) {
     // nullish values should have no impact on result
-    if (!input.nullish()) {
-        /* compare with the current value; swap if appropriate */
-        int cmp = getExpressionContext()->getValueComparator().compare(_val, input) * _sense;
-        if (cmp > 0 || _val.missing()) {  // missing is lower than all other values
-            _val = input;
-            _memUsageBytes = sizeof(*this) + input.getApproximateSize() - sizeof(Value);
-        }
+    if (input.nullish()) {
+        return;
+    }
+
+    if (_val.missing()) {  // missing is lower than all other values
+        _val = input;
+        _memUsageBytes = sizeof(*this) + input.getApproximateSize() - sizeof(Value);
+        return;
+    }
+
+    /* compare with the current value; swap if appropriate */
+    const int cmp = getExpressionContext()->getValueComparator().compare(_val, input) * _sense;
+    if (cmp > 0) {
+        _val = input;
+        _memUsageBytes = sizeof(*this) + input.getApproximateSize() - sizeof(Value);
     }
 }
 
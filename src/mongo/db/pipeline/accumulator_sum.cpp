@@ -58,31 +58,38 @@ const char subTotalErrorName[] = "subTotalError";  // Used for extra precision.
 
 
 void AccumulatorSum::processInternal(const Value& input, bool merging) {
-    if (!input.numeric()) {
-        if (merging && input.getType() == Object) {
-            // Process merge document, see getValue() below.
-            nonDecimalTotal.addDouble(
-                input[subTotalName].getDouble());              // Sum without adjusting type.
-            processInternal(input[subTotalErrorName], false);  // Sum adjusting for type of error.
-        }
-        return;
-    }
-
-    // Upgrade to the widest type required to hold the result.
-    totalType = Value::getWidestNumeric(totalType, input.getType());
+    // This runs for every value flowing into a $sum or $avg, so a single dispatch on the value's
+    // type covers the numeric check, the widest-type upgrade and the arithmetic, rather than
+    // interrogating the type once for each of them.
     switch (input.getType()) {
         case NumberInt:
+            totalType = Value::getWidestNumeric(totalType, NumberInt);
+            nonDecimalTotal.addInt(input.getInt());
+            return;
         case NumberLong:
-            nonDecimalTotal.addLong(input.coerceToLong());
-            break;
+            totalType = Value::getWidestNumeric(totalType, NumberLong);
+            nonDecimalTotal.addLong(input.getLong());
+            return;
         case NumberDouble:
+            totalType = Value::getWidestNumeric(totalType, NumberDouble);
             nonDecimalTotal.addDouble(input.getDouble());
-            break;
+            return;
         case NumberDecimal:
+            totalType = Value::getWidestNumeric(totalType, NumberDecimal);
             decimalTotal = decimalTotal.add(input.coerceToDecimal());
-            break;
+            return;
+        case Object:
+            if (merging) {
+                // Process merge document, see getValue() below.
+                nonDecimalTotal.addDouble(
+                    input[subTotalName].getDouble());              // Sum without adjusting type.
+                processInternal(input[subTotalErrorName], false);  // Sum adjusting for type of
+                                                                   // error.
+            }
+            return;
         default:
-            MONGO_UNREACHABLE;
+            // Non-numeric types have no impact on the sum.
+            return;
     }
 }
 
@@ -32,7 +32,9 @@
 
 #include "mongo/db/pipeline/document.h"
 
+#include <boost/align/aligned_alloc.hpp>
 #include <boost/functional/hash.hpp>
+#include <new>
 
 #include "mongo/bson/bson_depth.h"
 #include "mongo/db/jsobj.h"
@@ -53,9 +55,34 @@ const std::vector<StringData> Document::allMetadataFieldNames = {Document::metaF
                                                                  Document::metaFieldGeoNearDistance,
                                                                  Document::metaFieldGeoNearPoint};
 
+char* DocumentStorage::allocBuffer(size_t bytes) {
+    void* buffer =
+        boost::alignment::aligned_alloc(stdx::hardware_destructive_interference_size, bytes);
+    if (!buffer)
+        throw std::bad_alloc();
+    return static_cast<char*>(buffer);
+}
+
+void DocumentStorage::freeBuffer(char* buffer) {
+    boost::alignment::aligned_free(buffer);
+}
+
 Position DocumentStorage::findField(StringData requested) const {
     int reqSize = requested.size();  // get size calculation out of the way if needed
 
+    // Pipeline stages overwhelmingly request fields in insertion order, so before any bucket
+    // probing try the element one past the previous hit. For an in-order walk that's a single
+    // compare against a cache line the walk has already pulled in; a wrong guess falls through
+    // to the normal lookup.
+    if (_seqHint < _usedBytes) {
+        const ValueElement& elem = *_firstElement->plusBytes(_seqHint);
+        if (elem.nameLen == reqSize && memcmp(requested.rawData(), elem._name, reqSize) == 0) {
+            const Position pos(_seqHint);
+            updateSeqHint(elem);
+            return pos;
+        }
+    }
+
     if (_numFields >= HASH_TAB_MIN) {  // hash lookup
         const unsigned bucket = bucketForKey(requested);
 
@@ -63,6 +90,7 @@ Position DocumentStorage::findField(StringData requested) const {
         while (pos.found()) {
             const ValueElement& elem = getField(pos);
             if (elem.nameLen == reqSize && memcmp(requested.rawData(), elem._name, reqSize) == 0) {
+                updateSeqHint(elem);
                 return pos;
             }
 
@@ -72,6 +100,7 @@ Position DocumentStorage::findField(StringData requested) const {
     } else {  // linear scan
         for (DocumentStorageIterator it = iteratorAll(); !it.atEnd(); it.advance()) {
             if (it->nameLen == reqSize && memcmp(requested.rawData(), it->_name, reqSize) == 0) {
+                updateSeqHint(*it);
                 return it.position();
             }
         }
@@ -153,21 +182,28 @@ void DocumentStorage::alloc(unsigned newSize) {
 
     uassert(16490, "Tried to make oversized document", capacity <= size_t(BufferMaxSize));
 
-    std::unique_ptr<char[]> oldBuf(_buffer);
-    _buffer = new char[capacity];
+    char* const oldBuffer = _buffer;
+    std::unique_ptr<char, void (*)(char*)> deleteOldBufferAtScopeEnd(
+        usingInlineBuffer() ? nullptr : oldBuffer, &DocumentStorage::freeBuffer);
+
+    // Small documents live inside the DocumentStorage object itself and don't pay for a
+    // separate allocation.
+    _buffer = capacity <= kInlineBufferSize ? _inlineBuffer : allocBuffer(capacity);
     _bufferEnd = _buffer + capacity - hashTabBytes();
 
     if (!firstAlloc) {
-        // This just copies the elements
-        memcpy(_buffer, oldBuf.get(), _usedBytes);
+        // This just copies the elements. Growing within the inline buffer leaves them in place.
+        if (_buffer != oldBuffer)
+            memcpy(_buffer, oldBuffer, _usedBytes);
 
         if (_numFields >= HASH_TAB_MIN) {
             // if we were hashing, deal with the hash table
             if (doingRehash) {
                 rehash();
             } else {
-                // no rehash needed so just slide table down to new position
-                memcpy(_hashTab, oldBuf.get() + oldCapacity, hashTabBytes());
+                // no rehash needed so just slide table down to new position; the regions can
+                // overlap when growing in place within the inline buffer
+                memmove(_hashTab, oldBuffer + oldCapacity, hashTabBytes());
             }
         }
     }
@@ -186,7 +222,8 @@ void DocumentStorage::reserveFields(size_t expectedFields) {
 
     uassert(16491, "Tried to make oversized document", newSize <= size_t(BufferMaxSize));
 
-    _buffer = new char[newSize + hashTabBytes()];
+    const size_t totalSize = newSize + hashTabBytes();
+    _buffer = totalSize <= kInlineBufferSize ? _inlineBuffer : allocBuffer(totalSize);
     _bufferEnd = _buffer + newSize;
 }
 
@@ -195,11 +232,22 @@ intrusive_ptr<DocumentStorage> DocumentStorage::clone() const {
 
     // Make a copy of the buffer.
     // It is very important that the positions of each field are the same after cloning.
-    const size_t bufferBytes = allocatedBytes();
-    out->_buffer = new char[bufferBytes];
-    out->_bufferEnd = out->_buffer + (_bufferEnd - _buffer);
-    if (bufferBytes > 0) {
-        memcpy(out->_buffer, _buffer, bufferBytes);
+    // Positions are offsets from the front of the buffer, so only the occupied prefix of the
+    // element region carries information; free space that accumulated in our buffer through
+    // growth doubling is not copied, and the hash table is placed directly after the last
+    // element.  Clones are typically taken to overwrite a field in place (e.g. $unwind emits
+    // one clone per array element), so right-sizing them saves the dead memcpy bytes and lets
+    // more of them fit in the inline buffer.
+    const size_t elementBytes = _buffer ? _usedBytes : 0;
+    const size_t tableBytes = _buffer ? hashTabBytes() : 0;
+    const size_t bufferBytes = elementBytes + tableBytes;
+    out->_buffer = bufferBytes <= kInlineBufferSize ? out->_inlineBuffer : allocBuffer(bufferBytes);
+    out->_bufferEnd = out->_buffer + elementBytes;
+    if (elementBytes > 0) {
+        memcpy(out->_buffer, _buffer, elementBytes);
+    }
+    if (tableBytes > 0) {
+        memcpy(out->_bufferEnd, _hashTab, tableBytes);
     }
 
     // Copy remaining fields
@@ -222,7 +270,8 @@ intrusive_ptr<DocumentStorage> DocumentStorage::clone() const {
 }
 
 DocumentStorage::~DocumentStorage() {
-    std::unique_ptr<char[]> deleteBufferAtScopeEnd(_buffer);
+    std::unique_ptr<char, void (*)(char*)> deleteBufferAtScopeEnd(
+        usingInlineBuffer() ? nullptr : _buffer, &DocumentStorage::freeBuffer);
 
     for (DocumentStorageIterator it = iteratorAll(); !it.atEnd(); it.advance()) {
         it->val.~Value();  // explicit destructor call
@@ -239,6 +288,14 @@ Document::Document(const BSONObj& bson) {
     }
 
     *this = md.freeze();
+
+    // The storage is an exact field-by-field image of 'bson', so remember it and let toBson()
+    // hand it back without re-serializing. An unowned object may not outlive this document, so
+    // only owned buffers qualify. We are the sole owner of the freshly built storage here, which
+    // makes the const_cast safe.
+    if (_storage && bson.isOwned()) {
+        const_cast<DocumentStorage&>(storage()).setBsonBacking(bson);
+    }
 }
 
 Document::Document(std::initializer_list<std::pair<StringData, ImplicitValue>> initializerList) {
@@ -271,6 +328,10 @@ void Document::toBson(BSONObjBuilder* builder, size_t recursionLevel) const {
 }
 
 BSONObj Document::toBson() const {
+    if (storage().hasBsonBacking()) {
+        return storage().bsonBacking();
+    }
+
     BSONObjBuilder bb;
     toBson(&bb);
     return bb.obj();
@@ -283,6 +344,10 @@ constexpr StringData Document::metaFieldGeoNearDistance;
 constexpr StringData Document::metaFieldGeoNearPoint;
 
 BSONObj Document::toBsonWithMetaData() const {
+    if (!storage().hasAnyMetaFields()) {
+        return toBson();
+    }
+
     BSONObjBuilder bb;
     toBson(&bb);
     if (hasTextScore())
@@ -336,7 +401,14 @@ Document Document::fromBsonWithMetaData(const BSONObj& bson) {
         md.addField(fieldName, Value(elem));
     }
 
-    return md.freeze();
+    auto doc = md.freeze();
+
+    // If no metadata fields were stripped out above (none were set, so the meta bitset is still
+    // empty), the storage is an exact image of 'bson' and toBson() can return it as is.
+    if (doc._storage && !doc.storage().hasAnyMetaFields() && bson.isOwned()) {
+        const_cast<DocumentStorage&>(doc.storage()).setBsonBacking(bson);
+    }
+    return doc;
 }
 
 MutableDocument::MutableDocument(size_t expectedFields)
@@ -407,14 +479,26 @@ size_t Document::getApproximateSize() const {
     if (!_storage)
         return 0;  // we've allocated no memory
 
+    // Memory-bounded stages each ask for the size of documents that are often passed along
+    // unchanged, so memoize the walk. Mutable access to the storage resets the cache.
+    if (size_t cached = storage().cachedApproximateSize())
+        return cached;
+
     size_t size = sizeof(DocumentStorage);
     size += storage().allocatedBytes();
 
+    // A cached BSON image keeps its buffer alive for as long as this document, so memory-bounded
+    // consumers like $sort and $group must see it reflected here.
+    if (storage().hasBsonBacking()) {
+        size += storage().bsonBacking().objsize();
+    }
+
     for (DocumentStorageIterator it = storage().iterator(); !it.atEnd(); it.advance()) {
         size += it->val.getApproximateSize();
         size -= sizeof(Value);  // already accounted for above
     }
 
+    storage().setCachedApproximateSize(size);
     return size;
 }
 
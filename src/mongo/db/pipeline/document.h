@@ -595,7 +595,14 @@ private:
             return clonedStorage();
 
         // This function exists to ensure this is safe
-        return const_cast<DocumentStorage&>(*storagePtr());
+        auto& writable = const_cast<DocumentStorage&>(*storagePtr());
+
+        // Whatever the caller is about to do with the storage could make the cached BSON image
+        // and the memoized approximate size stale, so drop them. Clones and fresh storages never
+        // carry either.
+        writable.clearBsonBacking();
+        writable.clearCachedApproximateSize();
+        return writable;
     }
     DocumentStorage& newStorage() {
         reset(new DocumentStorage);
@@ -37,6 +37,7 @@
 
 #include "mongo/base/static_assert.h"
 #include "mongo/db/pipeline/value.h"
+#include "mongo/stdx/new.h"
 #include "mongo/util/intrusive_counter.h"
 
 namespace mongo {
@@ -276,6 +277,51 @@ public:
         return !_buffer ? 0 : (_bufferEnd - _buffer + hashTabBytes());
     }
 
+    /**
+     * Records the BSON object this storage was built from, so Document::toBson() can return it
+     * without re-serializing. Callers must only set a backing object whose fields are an exact
+     * image of this storage's fields, and which owns its buffer.
+     */
+    void setBsonBacking(const BSONObj& bson) {
+        dassert(bson.isOwned());
+        _bsonBacking = bson;
+    }
+
+    /// Drops the cached backing object. Called before any mutable access is handed out.
+    void clearBsonBacking() {
+        if (hasBsonBacking()) {
+            _bsonBacking = BSONObj();
+        }
+    }
+
+    bool hasBsonBacking() const {
+        // An empty object is indistinguishable from "no backing", but serializing an empty
+        // storage produces an empty object anyway, so treating it as absent is harmless.
+        return !_bsonBacking.isEmpty();
+    }
+
+    /**
+     * Memoized result of Document::getApproximateSize(). Zero means "not yet computed"; a real
+     * document can never approximate to zero bytes since the storage itself is counted.
+     */
+    size_t cachedApproximateSize() const {
+        return _cachedApproximateSize;
+    }
+    void setCachedApproximateSize(size_t size) const {
+        _cachedApproximateSize = size;
+    }
+    void clearCachedApproximateSize() {
+        _cachedApproximateSize = 0;
+    }
+
+    const BSONObj& bsonBacking() const {
+        return _bsonBacking;
+    }
+
+    bool hasAnyMetaFields() const {
+        return _metaFields.any();
+    }
+
     /**
      * Copies all metadata from source if it has any.
      * Note: does not clear metadata from this.
@@ -362,6 +408,20 @@ private:
     /// Allocates space in _buffer. Copies existing data if there is any.
     void alloc(unsigned newSize);
 
+    /**
+     * Allocates/frees the out-of-line buffer. Buffers start on a cache-line boundary so the
+     * sequential element walks done by iteration and serialization touch as few lines as
+     * possible.
+     */
+    static char* allocBuffer(size_t bytes);
+    static void freeBuffer(char* buffer);
+
+    /// Points '_seqHint' at the element following 'elem', wrapping to the front at the end.
+    void updateSeqHint(const ValueElement& elem) const {
+        const unsigned nextOffset = elem.next()->ptr() - _buffer;
+        _seqHint = nextOffset < _usedBytes ? nextOffset : 0;
+    }
+
     /// Call after adding field to _buffer and increasing _numFields
     void addFieldToHashTable(Position pos);
 
@@ -407,6 +467,18 @@ private:
                                  // set to 1 to always hash
     };
 
+    enum {
+        // Documents whose field storage (including the hash table) fits in this many bytes keep
+        // it inside the DocumentStorage object itself rather than in a separately allocated
+        // buffer. Small documents dominate most pipelines, and this spares them one heap
+        // allocation per storage instance.
+        kInlineBufferSize = 256,
+    };
+
+    bool usingInlineBuffer() const {
+        return _buffer == _inlineBuffer;
+    }
+
     // _buffer layout:
     // -------------------------------------------------------------------------------
     // | ValueElement1 Name1 | ValueElement2 Name2 | ... FREE SPACE ... | Hash Table |
@@ -431,6 +503,25 @@ private:
     unsigned _numFields;    // this includes removed fields
     unsigned _hashTabMask;  // equal to hashTabBuckets()-1 but used more often
 
+    // In-situ storage for small documents; _buffer points at it while the document fits.
+    // Cache-line-aligned like the out-of-line buffer, so sequential walks of a small document
+    // span the fewest lines possible.
+    alignas(stdx::hardware_destructive_interference_size) char _inlineBuffer[kInlineBufferSize];
+
+    // Byte offset of the element findField() predicts will be requested next; see there. Only
+    // ever holds zero or the offset of an element start, so a stale value can at worst cost a
+    // failed name compare. Advisory state updated during const lookups, like
+    // '_cachedApproximateSize', and deliberately not copied by clone(): a clone re-learns the
+    // access pattern.
+    mutable unsigned _seqHint = 0;
+
+    // The owned BSON object this storage is an exact image of, if any. See setBsonBacking().
+    // Deliberately not copied by clone(), since clones are only taken in order to mutate.
+    BSONObj _bsonBacking;
+
+    // See cachedApproximateSize(). Like '_bsonBacking', not copied by clone().
+    mutable size_t _cachedApproximateSize = 0;
+
     std::bitset<MetaType::NUM_FIELDS> _metaFields;
     double _textScore;
     double _randVal;
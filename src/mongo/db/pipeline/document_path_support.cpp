@@ -30,6 +30,7 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "mongo/db/pipeline/document_path_support.h"
@@ -138,20 +139,31 @@ StatusWith<Value> extractElementAlongNonArrayPath(const Document& doc, const Fie
     return curValue;
 }
 
-BSONObj documentToBsonWithPaths(const Document& input, const std::set<std::string>& paths) {
-    BSONObjBuilder outputBuilder;
+std::vector<std::string> extractUniqueTopLevelFields(const std::set<std::string>& paths) {
+    std::vector<std::string> fields;
     for (auto&& path : paths) {
         // getNestedField does not handle dotted paths correctly, so instead of retrieving the
         // entire path, we just extract the first element of the path.
         const auto prefix = FieldPath::extractFirstFieldFromDottedPath(path);
-        if (!outputBuilder.hasField(prefix)) {
-            // Avoid adding the same prefix twice.
-            input.getField(prefix).addToBsonObj(&outputBuilder, prefix);
+        if (std::find(fields.begin(), fields.end(), prefix) == fields.end()) {
+            fields.push_back(prefix.toString());
         }
     }
+    return fields;
+}
 
+BSONObj documentToBsonWithTopLevelFields(const Document& input,
+                                         const std::vector<std::string>& topLevelFields) {
+    BSONObjBuilder outputBuilder;
+    for (auto&& field : topLevelFields) {
+        input.getField(field).addToBsonObj(&outputBuilder, field);
+    }
     return outputBuilder.obj();
 }
 
+BSONObj documentToBsonWithPaths(const Document& input, const std::set<std::string>& paths) {
+    return documentToBsonWithTopLevelFields(input, extractUniqueTopLevelFields(paths));
+}
+
 }  // namespace document_path_support
 }  // namespace mongo
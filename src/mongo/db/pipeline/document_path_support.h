@@ -61,6 +61,19 @@ void visitAllValuesAtPath(const Document& doc,
  */
 StatusWith<Value> extractElementAlongNonArrayPath(const Document& doc, const FieldPath& path);
 
+/**
+ * Returns the unique first components of 'paths', in the order the paths are iterated. Useful for
+ * computing the argument to documentToBsonWithTopLevelFields() once when the paths are fixed.
+ */
+std::vector<std::string> extractUniqueTopLevelFields(const std::set<std::string>& paths);
+
+/**
+ * Returns a BSON object containing only the given top-level fields of 'input'. The field names
+ * must be unique, as produced by extractUniqueTopLevelFields().
+ */
+BSONObj documentToBsonWithTopLevelFields(const Document& input,
+                                         const std::vector<std::string>& topLevelFields);
+
 /**
  * Extracts 'paths' from the input document and returns a BSON object containing only those paths.
  */
@@ -83,6 +83,20 @@ list<intrusive_ptr<DocumentSource>> DocumentSource::parse(
     return it->second(stageSpec, expCtx);
 }
 
+DocumentSource::GetNextResult::ReturnStatus DocumentSource::getNextBatch(
+    size_t maxDocs, std::vector<Document>* batch) {
+    invariant(maxDocs > 0);
+
+    while (batch->size() < maxDocs) {
+        auto next = getNext();
+        if (!next.isAdvanced()) {
+            return next.getStatus();
+        }
+        batch->push_back(next.releaseDocument());
+    }
+    return GetNextResult::ReturnStatus::kAdvanced;
+}
+
 const char* DocumentSource::getSourceName() const {
     static const char unknown[] = "[UNKNOWN]";
     return unknown;
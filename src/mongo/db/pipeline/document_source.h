@@ -231,6 +231,22 @@ public:
      */
     virtual GetNextResult getNext() = 0;
 
+    /**
+     * Batched variant of getNext(). Appends results to 'batch' until it holds 'maxDocs' documents
+     * or a non-advanced status is encountered, and returns the status which ended the batch:
+     * kAdvanced if the stage may produce further results, or kEOF/kPauseExecution as soon as
+     * either is encountered. GetNextResult semantics are preserved at batch boundaries: documents
+     * appended before a kEOF or kPauseExecution are valid results and must be consumed before
+     * acting on the returned status, and a kPauseExecution must be propagated without further
+     * work. A return of kAdvanced does not guarantee that any documents were appended.
+     *
+     * The default implementation makes one virtual getNext() call per document. Stages which can
+     * produce or consume documents more cheaply in bulk should override this method, and
+     * streaming stages which override it should pull from their child with pSource->getNextBatch()
+     * so that batches propagate down the pipeline.
+     */
+    virtual GetNextResult::ReturnStatus getNextBatch(size_t maxDocs, std::vector<Document>* batch);
+
     /**
      * Returns a struct containing information about any special constraints imposed on using this
      * stage. Input parameter Pipeline::SplitState is used by stages whose requirements change
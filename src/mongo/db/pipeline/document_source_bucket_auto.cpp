@@ -92,13 +92,18 @@ DocumentSource::GetNextResult DocumentSourceBucketAuto::getNext() {
     pExpCtx->checkForInterrupt();
 
     if (!_populated) {
-        const auto populationResult = populateSorter();
+        const auto populationResult =
+            _approximate ? populateApproximateHistogram() : populateSorter();
         if (populationResult.isPaused()) {
             return populationResult;
         }
         invariant(populationResult.isEOF());
 
-        populateBuckets();
+        if (_approximate) {
+            populateApproximateBuckets();
+        } else {
+            populateBuckets();
+        }
 
         _populated = true;
         _bucketsIterator = _buckets.begin();
@@ -153,6 +158,120 @@ DocumentSource::GetNextResult DocumentSourceBucketAuto::populateSorter() {
     return next;
 }
 
+DocumentSource::GetNextResult DocumentSourceBucketAuto::populateApproximateHistogram() {
+    auto next = pSource->getNext();
+    for (; next.isAdvanced(); next = pSource->getNext()) {
+        auto nextDoc = next.releaseDocument();
+        addDocumentToHistogram(extractKey(nextDoc), nextDoc);
+        _nDocuments++;
+    }
+    return next;
+}
+
+void DocumentSourceBucketAuto::addDocumentToHistogram(const Value& key, const Document& doc) {
+    const auto& valueCmp = pExpCtx->getValueComparator();
+
+    // Find the strip whose range contains 'key': the last strip whose minimum is not greater than
+    // 'key', provided 'key' does not exceed its maximum. Since strips never overlap, keys which
+    // fall in the gap between two strips (or outside all of them) open a new single-point strip.
+    auto it = _strips.upper_bound(key);
+    if (it != _strips.begin()) {
+        auto candidate = std::prev(it);
+        if (valueCmp.evaluate(key <= candidate->second._max)) {
+            it = candidate;
+        } else {
+            it = _strips.end();
+        }
+    } else {
+        it = _strips.end();
+    }
+
+    if (it == _strips.end()) {
+        it = _strips.emplace(key, Strip(pExpCtx, key, _accumulatedFields)).first;
+    }
+
+    Strip& strip = it->second;
+    strip._count++;
+    for (size_t k = 0; k < _accumulatedFields.size(); k++) {
+        strip._accums[k]->process(_accumulatedFields[k].expression->evaluate(doc), false);
+    }
+
+    // Let the histogram grow to twice its target size before compacting, so the O(strips)
+    // compaction cost is amortized over many insertions.
+    const size_t targetStrips = kApproxStripsPerBucket * static_cast<size_t>(_nBuckets);
+    if (_strips.size() > 2 * targetStrips) {
+        compactStrips();
+    }
+}
+
+void DocumentSourceBucketAuto::compactStrips() {
+    const size_t targetStrips = kApproxStripsPerBucket * static_cast<size_t>(_nBuckets);
+    const long long targetWeight =
+        std::max(1LL, (_nDocuments + 1) / static_cast<long long>(targetStrips) + 1);
+
+    auto it = _strips.begin();
+    while (it != _strips.end() && _strips.size() > targetStrips) {
+        auto next = std::next(it);
+        if (next == _strips.end()) {
+            break;
+        }
+
+        if (it->second._count + next->second._count > targetWeight) {
+            it = next;
+            continue;
+        }
+
+        // Absorb 'next' into 'it'. The merged strip keeps 'it's minimum (its map key), so the
+        // ordering of '_strips' is unaffected.
+        Strip& strip = it->second;
+        strip._max = next->second._max;
+        strip._count += next->second._count;
+        for (size_t k = 0; k < _accumulatedFields.size(); k++) {
+            strip._accums[k]->process(next->second._accums[k]->getValue(true), true);
+        }
+        _strips.erase(next);
+    }
+}
+
+void DocumentSourceBucketAuto::populateApproximateBuckets() {
+    if (_nBuckets == 0 || _strips.empty()) {
+        return;
+    }
+
+    // Shrink the histogram to its target size before cutting it into buckets, so the error bound
+    // documented on kApproxStripsPerBucket holds.
+    compactStrips();
+
+    // As in the exact computation, we attempt to fill each bucket with this many documents.
+    long long approxBucketSize = std::round(double(_nDocuments) / double(_nBuckets));
+    if (approxBucketSize < 1) {
+        approxBucketSize = 1;
+    }
+
+    auto it = _strips.begin();
+    for (int i = 0; i < _nBuckets && it != _strips.end(); i++) {
+        const bool isLastBucket = (i == _nBuckets - 1);
+
+        Bucket currentBucket(pExpCtx, it->first, it->second._max, _accumulatedFields);
+        long long bucketCount = 0;
+
+        // Consume whole strips until the bucket has its share of the input. The last bucket takes
+        // everything that remains.
+        while (it != _strips.end() && (isLastBucket || bucketCount < approxBucketSize)) {
+            currentBucket._max = it->second._max;
+            bucketCount += it->second._count;
+            for (size_t k = 0; k < _accumulatedFields.size(); k++) {
+                currentBucket._accums[k]->process(it->second._accums[k]->getValue(true), true);
+            }
+            ++it;
+        }
+
+        addBucket(currentBucket);
+    }
+
+    _strips.clear();
+}
+
 Value DocumentSourceBucketAuto::extractKey(const Document& doc) {
     if (!_groupByExpression) {
         return Value(BSONNULL);
@@ -317,6 +436,16 @@ DocumentSourceBucketAuto::Bucket::Bucket(
     }
 }
 
+DocumentSourceBucketAuto::Strip::Strip(const boost::intrusive_ptr<ExpressionContext>& expCtx,
+                                       Value max,
+                                       const vector<AccumulationStatement>& accumulationStatements)
+    : _max(std::move(max)) {
+    _accums.reserve(accumulationStatements.size());
+    for (auto&& accumulationStatement : accumulationStatements) {
+        _accums.push_back(accumulationStatement.makeAccumulator(expCtx));
+    }
+}
+
 void DocumentSourceBucketAuto::addBucket(Bucket& newBucket) {
     if (!_buckets.empty()) {
         Bucket& previous = _buckets.back();
@@ -368,6 +497,7 @@ Document DocumentSourceBucketAuto::makeDocument(const Bucket& bucket) {
 
 void DocumentSourceBucketAuto::doDispose() {
     _sortedInput.reset();
+    _strips.clear();
     _bucketsIterator = _buckets.end();
 }
 
@@ -382,6 +512,10 @@ Value DocumentSourceBucketAuto::serialize(
         insides["granularity"] = Value(_granularityRounder->getName());
     }
 
+    if (_approximate) {
+        insides["method"] = Value("approximate"_sd);
+    }
+
     MutableDocument outputSpec(_accumulatedFields.size());
     for (auto&& accumulatedField : _accumulatedFields) {
         intrusive_ptr<Accumulator> accum = accumulatedField.makeAccumulator(pExpCtx);
@@ -400,11 +534,16 @@ intrusive_ptr<DocumentSourceBucketAuto> DocumentSourceBucketAuto::create(
     int numBuckets,
     std::vector<AccumulationStatement> accumulationStatements,
     const boost::intrusive_ptr<GranularityRounder>& granularityRounder,
-    uint64_t maxMemoryUsageBytes) {
+    uint64_t maxMemoryUsageBytes,
+    bool useApproximateMethod) {
     uassert(40243,
             str::stream() << "The $bucketAuto 'buckets' field must be greater than 0, but found: "
                           << numBuckets,
             numBuckets > 0);
+    uassert(51202,
+            "The $bucketAuto 'method: \"approximate\"' option cannot be combined with "
+            "'granularity'",
+            !(useApproximateMethod && granularityRounder));
     // If there is no output field specified, then add the default one.
     if (accumulationStatements.empty()) {
         accumulationStatements.emplace_back("count",
@@ -416,7 +555,8 @@ intrusive_ptr<DocumentSourceBucketAuto> DocumentSourceBucketAuto::create(
                                         numBuckets,
                                         accumulationStatements,
                                         granularityRounder,
-                                        maxMemoryUsageBytes);
+                                        maxMemoryUsageBytes,
+                                        useApproximateMethod);
 }
 
 DocumentSourceBucketAuto::DocumentSourceBucketAuto(
@@ -425,12 +565,15 @@ DocumentSourceBucketAuto::DocumentSourceBucketAuto(
     int numBuckets,
     std::vector<AccumulationStatement> accumulationStatements,
     const boost::intrusive_ptr<GranularityRounder>& granularityRounder,
-    uint64_t maxMemoryUsageBytes)
+    uint64_t maxMemoryUsageBytes,
+    bool useApproximateMethod)
     : DocumentSource(pExpCtx),
       _nBuckets(numBuckets),
       _maxMemoryUsageBytes(maxMemoryUsageBytes),
       _groupByExpression(groupByExpression),
-      _granularityRounder(granularityRounder) {
+      _granularityRounder(granularityRounder),
+      _approximate(useApproximateMethod),
+      _strips(pExpCtx->getValueComparator().makeOrderedValueMap<Strip>()) {
 
     invariant(!accumulationStatements.empty());
     for (auto&& accumulationStatement : accumulationStatements) {
@@ -450,6 +593,7 @@ intrusive_ptr<DocumentSource> DocumentSourceBucketAuto::createFromBson(
     boost::intrusive_ptr<Expression> groupByExpression;
     boost::optional<int> numBuckets;
     boost::intrusive_ptr<GranularityRounder> granularityRounder;
+    bool useApproximateMethod = false;
 
     for (auto&& argument : elem.Obj()) {
         const auto argName = argument.fieldNameStringData();
@@ -490,6 +634,19 @@ intrusive_ptr<DocumentSource> DocumentSourceBucketAuto::createFromBson(
                         << typeName(argument.type()),
                     argument.type() == BSONType::String);
             granularityRounder = GranularityRounder::getGranularityRounder(pExpCtx, argument.str());
+        } else if ("method" == argName) {
+            uassert(51200,
+                    str::stream()
+                        << "The $bucketAuto 'method' field must be a string, but found type: "
+                        << typeName(argument.type()),
+                    argument.type() == BSONType::String);
+            const auto method = argument.valueStringData();
+            uassert(51201,
+                    str::stream() << "The $bucketAuto 'method' field must be either 'exact' or "
+                                     "'approximate', but found: "
+                                  << method,
+                    method == "exact" || method == "approximate");
+            useApproximateMethod = (method == "approximate");
         } else {
             uasserted(40245, str::stream() << "Unrecognized option to $bucketAuto: " << argName);
         }
@@ -499,8 +656,13 @@ intrusive_ptr<DocumentSource> DocumentSourceBucketAuto::createFromBson(
             "$bucketAuto requires 'groupBy' and 'buckets' to be specified",
             groupByExpression && numBuckets);
 
-    return DocumentSourceBucketAuto::create(
-        pExpCtx, groupByExpression, numBuckets.get(), accumulationStatements, granularityRounder);
+    return DocumentSourceBucketAuto::create(pExpCtx,
+                                            groupByExpression,
+                                            numBuckets.get(),
+                                            accumulationStatements,
+                                            granularityRounder,
+                                            kDefaultMaxMemoryUsageBytes,
+                                            useApproximateMethod);
 }
 
 }  // namespace mongo
@@ -35,6 +35,7 @@
 #include "mongo/db/pipeline/document_source.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/granularity_rounder.h"
+#include "mongo/db/pipeline/value_comparator.h"
 #include "mongo/db/sorter/sorter.h"
 
 namespace mongo {
@@ -42,6 +43,14 @@ namespace mongo {
 /**
  * The $bucketAuto stage takes a user-specified number of buckets and automatically determines
  * boundaries such that the values are approximately equally distributed between those buckets.
+ *
+ * By default the boundaries are computed exactly, by sorting the entire input (spilling to disk
+ * when allowed). Specifying {method: "approximate"} selects a single-pass streaming computation
+ * instead: the stage maintains a bounded histogram of contiguous strips of the key space,
+ * compacting adjacent strips t-digest style whenever the histogram grows past its size limit, and
+ * forms the final buckets from whole strips. This never buffers more than
+ * kApproxStripsPerBucket * buckets strips regardless of input size, in exchange for approximate
+ * boundaries; see the comment on kApproxStripsPerBucket for the error bound.
  */
 class DocumentSourceBucketAuto final : public DocumentSource, public NeedsMergerDocumentSource {
 public:
@@ -71,6 +80,14 @@ public:
 
     static const uint64_t kDefaultMaxMemoryUsageBytes = 100 * 1024 * 1024;
 
+    // The number of histogram strips maintained per requested bucket in approximate mode. Strips
+    // are atomic: compaction and the final bucket assembly only ever combine whole strips, so a
+    // bucket's document count can deviate from the ideal (input size / buckets) by at most the
+    // weight of one strip. Compaction keeps strip weights near (input size / total strips), so
+    // the deviation is bounded by roughly 2 / kApproxStripsPerBucket (about 3%) of a bucket for
+    // streams without heavy key repetition.
+    static const size_t kApproxStripsPerBucket = 64;
+
     /**
      * Convenience method to create a $bucketAuto stage.
      *
@@ -83,7 +100,8 @@ public:
         int numBuckets,
         std::vector<AccumulationStatement> accumulationStatements = {},
         const boost::intrusive_ptr<GranularityRounder>& granularityRounder = nullptr,
-        uint64_t maxMemoryUsageBytes = kDefaultMaxMemoryUsageBytes);
+        uint64_t maxMemoryUsageBytes = kDefaultMaxMemoryUsageBytes,
+        bool useApproximateMethod = false);
 
     /**
      * Parses a $bucketAuto stage from the user-supplied BSON.
@@ -100,7 +118,8 @@ private:
                              int numBuckets,
                              std::vector<AccumulationStatement> accumulationStatements,
                              const boost::intrusive_ptr<GranularityRounder>& granularityRounder,
-                             uint64_t maxMemoryUsageBytes);
+                             uint64_t maxMemoryUsageBytes,
+                             bool useApproximateMethod);
 
     // struct for holding information about a bucket.
     struct Bucket {
@@ -147,6 +166,44 @@ private:
      */
     Document makeDocument(const Bucket& bucket);
 
+    // A contiguous strip of the key space maintained by the streaming histogram in approximate
+    // mode. The strip's minimum is its key in '_strips'; strips never overlap, and all documents
+    // with equal 'groupBy' values always land in the same strip.
+    struct Strip {
+        Strip(const boost::intrusive_ptr<ExpressionContext>& expCtx,
+              Value max,
+              const std::vector<AccumulationStatement>& accumulationStatements);
+        Value _max;
+        long long _count = 0;
+        std::vector<boost::intrusive_ptr<Accumulator>> _accums;
+    };
+
+    /**
+     * Consumes all of the documents from the source in the pipeline into the streaming histogram.
+     * As populateSorter(), returns the last GetNextResult encountered, which may be either kEOF
+     * or kPauseExecution.
+     */
+    GetNextResult populateApproximateHistogram();
+
+    /**
+     * Adds the document with the given 'groupBy' key to the histogram, extending an existing
+     * strip when the key falls inside one and opening a new strip otherwise. Compacts the
+     * histogram when it outgrows twice its target size.
+     */
+    void addDocumentToHistogram(const Value& key, const Document& doc);
+
+    /**
+     * Merges adjacent strips until the histogram is back to its target size, aiming for strips of
+     * equal weight. Only whole strips are ever combined, so equal keys stay together.
+     */
+    void compactStrips();
+
+    /**
+     * Assembles '_buckets' from consecutive runs of whole strips, targeting an equal share of the
+     * input per bucket.
+     */
+    void populateApproximateBuckets();
+
     std::unique_ptr<Sorter<Value, Document>> _sorter;
     std::unique_ptr<Sorter<Value, Document>::Iterator> _sortedInput;
 
@@ -160,6 +217,10 @@ private:
     boost::intrusive_ptr<Expression> _groupByExpression;
     boost::intrusive_ptr<GranularityRounder> _granularityRounder;
     long long _nDocuments = 0;
+
+    // Approximate-mode state; _strips is unused when _approximate is false.
+    bool _approximate;
+    ValueMap<Strip> _strips;
 };
 
 }  // namespace mongo
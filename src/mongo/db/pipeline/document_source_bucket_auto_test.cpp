@@ -804,5 +804,109 @@ TEST_F(BucketAutoTests, ShouldFailOnNegativeNumbersWhenGranularitySpecified) {
         AssertionException,
         40260);
 }
+
+TEST_F(BucketAutoTests, ApproximateMethodReturnsSameBucketsAsExactForSmallInputs) {
+    // With fewer distinct values than histogram strips, no strips are ever merged, so the
+    // approximate computation degenerates to the exact one.
+    auto bucketAutoSpec =
+        fromjson("{$bucketAuto : {groupBy : '$x', buckets : 2, method : 'approximate'}}");
+
+    // Values are 0, 1, 2, 3
+    auto results = getResults(
+        bucketAutoSpec,
+        {Document{{"x", 3}}, Document{{"x", 0}}, Document{{"x", 2}}, Document{{"x", 1}}});
+    ASSERT_EQUALS(results.size(), 2UL);
+    ASSERT_DOCUMENT_EQ(results[0], Document(fromjson("{_id : {min : 0, max : 2}, count : 2}")));
+    ASSERT_DOCUMENT_EQ(results[1], Document(fromjson("{_id : {min : 2, max : 3}, count : 2}")));
+}
+
+TEST_F(BucketAutoTests, ApproximateMethodKeepsEqualValuesInSameBucket) {
+    auto bucketAutoSpec =
+        fromjson("{$bucketAuto : {groupBy : '$x', buckets : 2, method : 'approximate'}}");
+
+    // Values are 1, 1, 1, 1, 2
+    auto results = getResults(bucketAutoSpec,
+                              {Document{{"x", 1}},
+                               Document{{"x", 1}},
+                               Document{{"x", 1}},
+                               Document{{"x", 2}},
+                               Document{{"x", 1}}});
+    ASSERT_EQUALS(results.size(), 2UL);
+    ASSERT_DOCUMENT_EQ(results[0], Document(fromjson("{_id : {min : 1, max : 2}, count : 4}")));
+    ASSERT_DOCUMENT_EQ(results[1], Document(fromjson("{_id : {min : 2, max : 2}, count : 1}")));
+}
+
+TEST_F(BucketAutoTests, ApproximateMethodEvaluatesAccumulators) {
+    auto bucketAutoSpec = fromjson(
+        "{$bucketAuto : {groupBy : '$x', buckets : 2, method : 'approximate', output : {avg : "
+        "{$avg : '$x'}}}}");
+
+    // Values are 0, 2, 4, 6
+    auto results = getResults(
+        bucketAutoSpec,
+        {Document{{"x", 6}}, Document{{"x", 0}}, Document{{"x", 4}}, Document{{"x", 2}}});
+    ASSERT_EQUALS(results.size(), 2UL);
+    ASSERT_DOCUMENT_EQ(results[0], Document(fromjson("{_id : {min : 0, max : 4}, avg : 1}")));
+    ASSERT_DOCUMENT_EQ(results[1], Document(fromjson("{_id : {min : 4, max : 6}, avg : 5}")));
+}
+
+TEST_F(BucketAutoTests, ApproximateMethodProducesRequestedBucketsOnLargeInput) {
+    auto bucketAutoSpec =
+        fromjson("{$bucketAuto : {groupBy : '$x', buckets : 4, method : 'approximate'}}");
+
+    // Enough distinct values to force histogram compaction (4 buckets * 64 strips * 2).
+    const int nDocs = 1000;
+    std::deque<Document> inputs;
+    for (int i = 0; i < nDocs; i++) {
+        inputs.push_back(Document{{"x", i}});
+    }
+    auto results = getResults(bucketAutoSpec, std::move(inputs));
+
+    ASSERT_EQUALS(results.size(), 4UL);
+
+    // The buckets must cover the input contiguously, and each bucket's document count may deviate
+    // from the ideal share by no more than a few histogram strips' worth of documents.
+    const long long idealCount = nDocs / 4;
+    const long long maxStripWeight = 3 * (nDocs / (4 * 64) + 1);
+    long long totalCount = 0;
+    for (size_t i = 0; i < results.size(); i++) {
+        const long long count = results[i]["count"].coerceToLong();
+        const long long deviation = count > idealCount ? count - idealCount : idealCount - count;
+        ASSERT_LTE(deviation, maxStripWeight);
+        totalCount += count;
+        if (i > 0) {
+            ASSERT_VALUE_EQ(results[i]["_id"]["min"], results[i - 1]["_id"]["max"]);
+        }
+    }
+    ASSERT_EQUALS(totalCount, nDocs);
+    ASSERT_VALUE_EQ(results.front()["_id"]["min"], Value(0));
+    ASSERT_VALUE_EQ(results.back()["_id"]["max"], Value(nDocs - 1));
+}
+
+TEST_F(BucketAutoTests, ApproximateMethodSerializesMethodField) {
+    auto bucketAutoSpec =
+        fromjson("{$bucketAuto : {groupBy : '$x', buckets : 2, method : 'approximate'}}");
+    auto expectedObj = fromjson(
+        "{groupBy : '$x', buckets : 2, method : 'approximate', output : {count : {$sum : "
+        "{$const : 1}}}}");
+    testSerialize(bucketAutoSpec, expectedObj);
+}
+
+TEST_F(BucketAutoTests, FailsWithNonStringMethod) {
+    auto spec = fromjson("{$bucketAuto : {groupBy : '$x', buckets : 1, method : 1}}");
+    ASSERT_THROWS_CODE(createBucketAuto(spec), AssertionException, 51200);
+}
+
+TEST_F(BucketAutoTests, FailsWithUnknownMethod) {
+    auto spec = fromjson("{$bucketAuto : {groupBy : '$x', buckets : 1, method : 'test'}}");
+    ASSERT_THROWS_CODE(createBucketAuto(spec), AssertionException, 51201);
+}
+
+TEST_F(BucketAutoTests, FailsWhenApproximateMethodCombinedWithGranularity) {
+    auto spec = fromjson(
+        "{$bucketAuto : {groupBy : '$x', buckets : 1, granularity : 'R5', method : "
+        "'approximate'}}");
+    ASSERT_THROWS_CODE(createBucketAuto(spec), AssertionException, 51202);
+}
 }  // namespace
 }  // namespace mongo
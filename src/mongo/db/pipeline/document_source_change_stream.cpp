@@ -265,8 +265,14 @@ BSONObj DocumentSourceChangeStream::buildMatchFilter(
                                    << "o2.type"
                                    << "migrateChunkToNewShard");
 
-    // 2) Supported operations on the target namespace.
-    BSONObj nsMatch = BSON("ns" << BSONRegEx(getNsRegexForChangeStream(nss)));
+    // 2) Supported operations on the target namespace. A stream on a single collection matches
+    // the namespace by string equality: the oplog scan evaluates this filter against every
+    // entry after the resume point, and an equality comparison is far cheaper than the
+    // equivalent anchored regex when skipping the entries of all other collections. Database
+    // and cluster streams still need the regex to cover many namespaces.
+    BSONObj nsMatch = (sourceType == ChangeStreamType::kSingleCollection)
+        ? BSON("ns" << nss.ns())
+        : BSON("ns" << BSONRegEx(getNsRegexForChangeStream(nss)));
     auto opMatch = BSON(nsMatch["ns"] << OR(normalOpTypeMatch, chunkMigratedMatch));
 
     // 3) Look for 'applyOps' which were created as part of a transaction.
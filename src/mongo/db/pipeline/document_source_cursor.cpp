@@ -71,6 +71,28 @@ DocumentSource::GetNextResult DocumentSourceCursor::getNext() {
     return std::move(out);
 }
 
+DocumentSource::GetNextResult::ReturnStatus DocumentSourceCursor::getNextBatch(
+    size_t maxDocs, std::vector<Document>* batch) {
+    pExpCtx->checkForInterrupt();
+
+    if (_currentBatch.empty()) {
+        loadBatch();
+
+        if (_currentBatch.empty())
+            return GetNextResult::ReturnStatus::kEOF;
+    }
+
+    // Serve documents out of the batch which has already been loaded from the executor without
+    // forcing another load, so that memory consumption remains bounded by
+    // 'internalDocumentSourceCursorBatchSizeBytes' regardless of 'maxDocs'. Returning a partial
+    // batch is permitted; the caller will ask again.
+    while (batch->size() < maxDocs && !_currentBatch.empty()) {
+        batch->push_back(std::move(_currentBatch.front()));
+        _currentBatch.pop_front();
+    }
+    return GetNextResult::ReturnStatus::kAdvanced;
+}
+
 Document DocumentSourceCursor::transformBSONObjToDocument(const BSONObj& obj) const {
     return _dependencies ? _dependencies->extractFields(obj) : Document::fromBsonWithMetaData(obj);
 }
@@ -50,6 +50,8 @@ public:
     // virtuals from DocumentSource
     GetNextResult getNext() final;
 
+    GetNextResult::ReturnStatus getNextBatch(size_t maxDocs, std::vector<Document>* batch) final;
+
     const char* getSourceName() const override;
 
     BSONObjSet getOutputSorts() override {
@@ -0,0 +1,248 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kQuery
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/pipeline/document_source_exchange_merge.h"
+
+#include "mongo/db/client.h"
+#include "mongo/util/log.h"
+#include "mongo/util/mongoutils/str.h"
+
+namespace mongo {
+
+constexpr size_t DocumentSourceExchangeMerge::kMaxMergeBufferBytes;
+
+const char* DocumentSourceExchangeMerge::getSourceName() const {
+    return "$_internalExchangeMerge";
+}
+
+Value DocumentSourceExchangeMerge::serialize(
+    boost::optional<ExplainOptions::Verbosity> explain) const {
+    std::vector<Value> segment;
+    segment.reserve(_segment.size());
+    for (auto&& stage : _segment) {
+        segment.push_back(Value(stage));
+    }
+
+    return Value(DOC(getSourceName() << DOC("exchange" << Value(_exchange->getSpec().toBSON())
+                                                       << "pipeline"
+                                                       << Value(segment))));
+}
+
+boost::intrusive_ptr<DocumentSourceExchangeMerge> DocumentSourceExchangeMerge::create(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx,
+    ExchangeSpec spec,
+    std::unique_ptr<Pipeline, PipelineDeleter> inputPipeline,
+    std::vector<BSONObj> segment) {
+    const auto nConsumers = static_cast<size_t>(spec.getConsumers());
+
+    boost::intrusive_ptr<Exchange> exchange =
+        new Exchange(std::move(spec), std::move(inputPipeline));
+
+    std::vector<std::unique_ptr<Pipeline, PipelineDeleter>> pipelines;
+    pipelines.reserve(nConsumers);
+
+    for (size_t idx = 0; idx < nConsumers; ++idx) {
+        // Every replica gets its own ExpressionContext so the consumer threads can attach their
+        // own OperationContexts without interfering with each other.
+        auto replicaExpCtx = expCtx->copyWith(expCtx->ns);
+        auto pipeline = uassertStatusOK(Pipeline::parse(segment, replicaExpCtx));
+        pipeline->addInitialSource(
+            new DocumentSourceExchange(replicaExpCtx, exchange, idx, nullptr));
+
+        // The consumer threads reattach before running; the pipelines start out detached.
+        pipeline->detachFromOperationContext();
+        pipelines.push_back(std::move(pipeline));
+    }
+
+    return new DocumentSourceExchangeMerge(
+        expCtx, std::move(exchange), std::move(pipelines), std::move(segment));
+}
+
+DocumentSourceExchangeMerge::DocumentSourceExchangeMerge(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx,
+    boost::intrusive_ptr<Exchange> exchange,
+    std::vector<std::unique_ptr<Pipeline, PipelineDeleter>> pipelines,
+    std::vector<BSONObj> segment)
+    : DocumentSource(expCtx),
+      _exchange(std::move(exchange)),
+      _consumerPipelines(std::move(pipelines)),
+      _segment(std::move(segment)) {}
+
+DocumentSourceExchangeMerge::~DocumentSourceExchangeMerge() {
+    // doDispose() normally joins the consumers; close the buffer and join here as well in case
+    // the stage is destroyed on an error path without having been disposed.
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _closed = true;
+    }
+    _bufferNotFull.notify_all();
+    _joinConsumers();
+}
+
+DocumentSource::GetNextResult DocumentSourceExchangeMerge::getNext() {
+    if (!_started) {
+        _startConsumers();
+    }
+
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    pExpCtx->opCtx->waitForConditionOrInterrupt(_bufferNotEmpty, lk, [this] {
+        return !_buffer.empty() || _activeConsumers == 0 || !_mergeStatus.isOK();
+    });
+
+    if (!_mergeStatus.isOK()) {
+        auto status = _mergeStatus;
+        lk.unlock();
+        _joinConsumers();
+        uassertStatusOK(status);
+    }
+
+    if (!_buffer.empty()) {
+        auto result = std::move(_buffer.front());
+        _buffer.pop_front();
+        if (result.isAdvanced()) {
+            _bytesInBuffer -= result.getDocument().getApproximateSize();
+        }
+        lk.unlock();
+        _bufferNotFull.notify_one();
+        return result;
+    }
+
+    // The buffer is empty and every consumer has reached end of stream.
+    lk.unlock();
+    _joinConsumers();
+    return GetNextResult::makeEOF();
+}
+
+void DocumentSourceExchangeMerge::doDispose() {
+    if (!_started) {
+        // The consumers never ran; dispose of their pipelines here so the Exchange's dispose
+        // rundown completes and the inner pipeline is freed.
+        for (auto&& pipeline : _consumerPipelines) {
+            pipeline->reattachToOperationContext(pExpCtx->opCtx);
+            pipeline->dispose(pExpCtx->opCtx);
+        }
+        return;
+    }
+
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _closed = true;
+        _buffer.clear();
+        _bytesInBuffer = 0;
+    }
+    _bufferNotFull.notify_all();
+    _joinConsumers();
+}
+
+void DocumentSourceExchangeMerge::_startConsumers() {
+    invariant(!_started);
+    _started = true;
+    _activeConsumers = _consumerPipelines.size();
+
+    _threads.reserve(_consumerPipelines.size());
+    for (size_t idx = 0; idx < _consumerPipelines.size(); ++idx) {
+        _threads.emplace_back([this, idx] { _runConsumer(idx); });
+    }
+}
+
+void DocumentSourceExchangeMerge::_runConsumer(size_t index) {
+    Client::initThread(str::stream() << "ExchangeMergeConsumer-" << index);
+    auto opCtx = cc().makeOperationContext();
+
+    auto& pipeline = _consumerPipelines[index];
+    pipeline->reattachToOperationContext(opCtx.get());
+
+    try {
+        const auto& source = pipeline->getSources().back();
+        for (auto result = source->getNext(); !result.isEOF(); result = source->getNext()) {
+            if (!_pushResult(std::move(result))) {
+                // The merge buffer was closed by dispose(); stop producing.
+                break;
+            }
+        }
+    } catch (const DBException& ex) {
+        _abortMerge(ex.toStatus());
+    }
+
+    // Disposing the replica runs the Exchange's dispose rundown for this consumer id, which
+    // also unblocks any sibling consumer waiting on this one.
+    pipeline->dispose(opCtx.get());
+
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        invariant(_activeConsumers > 0);
+        --_activeConsumers;
+    }
+    _bufferNotEmpty.notify_all();
+}
+
+bool DocumentSourceExchangeMerge::_pushResult(GetNextResult result) {
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    _bufferNotFull.wait(lk, [this] { return _bytesInBuffer < kMaxMergeBufferBytes || _closed; });
+
+    if (_closed) {
+        return false;
+    }
+
+    if (result.isAdvanced()) {
+        _bytesInBuffer += result.getDocument().getApproximateSize();
+    }
+    _buffer.push_back(std::move(result));
+
+    lk.unlock();
+    _bufferNotEmpty.notify_one();
+    return true;
+}
+
+void DocumentSourceExchangeMerge::_abortMerge(Status status) {
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        if (_mergeStatus.isOK()) {
+            _mergeStatus = std::move(status);
+        }
+        // Closing the buffer makes the surviving consumers drain and stop early.
+        _closed = true;
+    }
+    _bufferNotFull.notify_all();
+    _bufferNotEmpty.notify_all();
+}
+
+void DocumentSourceExchangeMerge::_joinConsumers() {
+    for (auto&& thread : _threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+}  // namespace mongo
@@ -0,0 +1,169 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "mongo/db/pipeline/document_source.h"
+#include "mongo/db/pipeline/document_source_exchange.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
+
+namespace mongo {
+
+/**
+ * Merging consumer for an intra-node Exchange. The stage owns an Exchange over an input pipeline
+ * together with one consumer pipeline per consumer id, where each consumer pipeline is a
+ * DocumentSourceExchange followed by a replica of a caller-provided pipeline segment. On the
+ * first getNext() call it spawns a thread per consumer; each thread drives its replica to
+ * completion under its own Client and OperationContext and funnels the results into a bounded
+ * merge buffer which this stage drains on the caller's thread:
+ *
+ *   input pipeline -> Exchange -+-> $_internalExchange(0) -> segment replica -+
+ *                               +-> $_internalExchange(1) -> segment replica -+-> merge buffer
+ *                               +-> ...                                       +
+ *
+ * This is the building block for running $match/$project/$group segments in parallel across
+ * cores without bespoke threading in each stage. The merge does not preserve input order across
+ * consumers; segments whose semantics depend on global document order must not be replicated.
+ */
+class DocumentSourceExchangeMerge final : public DocumentSource {
+public:
+    /**
+     * Creates the exchange over 'inputPipeline' and spec.getConsumers() replicas of 'segment'
+     * (each replica is re-parsed against its own ExpressionContext). 'segment' may be empty, in
+     * which case the stage is a pure repartition-merge and acts as an unordered passthrough.
+     */
+    static boost::intrusive_ptr<DocumentSourceExchangeMerge> create(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx,
+        ExchangeSpec spec,
+        std::unique_ptr<Pipeline, PipelineDeleter> inputPipeline,
+        std::vector<BSONObj> segment);
+
+    ~DocumentSourceExchangeMerge();
+
+    GetNextResult getNext() final;
+
+    StageConstraints constraints(Pipeline::SplitState pipeState) const final {
+        return {StreamType::kStreaming,
+                PositionRequirement::kNone,
+                HostTypeRequirement::kNone,
+                DiskUseRequirement::kNoDiskUse,
+                FacetRequirement::kAllowed,
+                // The consumer threads run under their own OperationContexts, which cannot
+                // participate in the caller's transaction.
+                TransactionRequirement::kNotAllowed};
+    }
+
+    const char* getSourceName() const final;
+
+    Value serialize(boost::optional<ExplainOptions::Verbosity> explain = boost::none) const final;
+
+    /**
+     * Like DocumentSourceExchange, this stage has no direct source; it reads through the
+     * consumer pipelines feeding the merge buffer.
+     */
+    void setSource(DocumentSource* source) final {
+        invariant(!source);
+    }
+
+    void doDispose() final;
+
+    size_t getConsumers() const {
+        return _consumerPipelines.size();
+    }
+
+private:
+    DocumentSourceExchangeMerge(const boost::intrusive_ptr<ExpressionContext>& expCtx,
+                                boost::intrusive_ptr<Exchange> exchange,
+                                std::vector<std::unique_ptr<Pipeline, PipelineDeleter>> pipelines,
+                                std::vector<BSONObj> segment);
+
+    /**
+     * Spawns the consumer threads. Called once, from the first getNext().
+     */
+    void _startConsumers();
+
+    /**
+     * Body of a consumer thread; drives consumer pipeline 'index' to completion.
+     */
+    void _runConsumer(size_t index);
+
+    /**
+     * Appends 'result' to the merge buffer, blocking while the buffer is full. Returns false if
+     * the buffer has been closed by dispose(), which tells the consumer to stop early.
+     */
+    bool _pushResult(GetNextResult result);
+
+    /**
+     * Records the first error encountered by a consumer and wakes everybody up.
+     */
+    void _abortMerge(Status status);
+
+    // The stage must survive until all consumer threads have exited; getNext() and doDispose()
+    // join them before returning control to a caller that could destroy the stage.
+    void _joinConsumers();
+
+    static constexpr size_t kMaxMergeBufferBytes = 16 * 1024 * 1024;
+
+    const boost::intrusive_ptr<Exchange> _exchange;
+
+    // One consumer pipeline per consumer id; element i starts with a DocumentSourceExchange for
+    // consumer i. Workers reattach these to their own OperationContexts.
+    std::vector<std::unique_ptr<Pipeline, PipelineDeleter>> _consumerPipelines;
+
+    // Kept only for serialization purposes.
+    const std::vector<BSONObj> _segment;
+
+    std::vector<stdx::thread> _threads;
+
+    // Synchronization of the merge buffer.
+    stdx::mutex _mutex;
+    stdx::condition_variable _bufferNotFull;
+    stdx::condition_variable _bufferNotEmpty;
+
+    std::deque<GetNextResult> _buffer;
+    size_t _bytesInBuffer{0};
+
+    // Number of consumer threads which have not reached end of stream yet.
+    size_t _activeConsumers{0};
+
+    // Set by dispose(); consumers stop producing once the buffer is closed.
+    bool _closed{false};
+
+    bool _started{false};
+
+    // First error raised by any consumer; reported to the caller by getNext().
+    Status _mergeStatus = Status::OK();
+};
+
+}  // namespace mongo
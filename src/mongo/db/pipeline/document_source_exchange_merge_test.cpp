@@ -0,0 +1,167 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/pipeline/aggregation_context_fixture.h"
+#include "mongo/db/pipeline/document_source_exchange_merge.h"
+#include "mongo/db/pipeline/document_source_mock.h"
+#include "mongo/db/pipeline/stub_mongo_process_interface.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/fail_point_service.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * An implementation of the MongoProcessInterface that is okay with changing the
+ * OperationContext, but has no other parts of the interface implemented. The consumer threads
+ * reattach their pipelines to their own OperationContexts.
+ */
+class StubMongoProcessOkWithOpCtxChanges : public StubMongoProcessInterface {
+public:
+    void setOperationContext(OperationContext* opCtx) final {
+        return;
+    }
+};
+
+class DocumentSourceExchangeMergeTest : public AggregationContextFixture {
+protected:
+    void setUp() override {
+        getExpCtx()->mongoProcessInterface = std::make_shared<StubMongoProcessOkWithOpCtxChanges>();
+    }
+
+    boost::intrusive_ptr<DocumentSourceMock> getMockSource(int cnt) {
+        auto source = DocumentSourceMock::create();
+
+        for (int i = 0; i < cnt; ++i)
+            source->queue.emplace_back(Document{{"a", i}});
+
+        return source;
+    }
+
+    ExchangeSpec makeRoundRobinSpec(int nConsumers) {
+        ExchangeSpec spec;
+        spec.setPolicy(ExchangePolicyEnum::kRoundRobin);
+        spec.setConsumers(nConsumers);
+        spec.setBufferSize(1024);
+        return spec;
+    }
+
+    boost::intrusive_ptr<DocumentSourceExchangeMerge> makeMergeStage(
+        int nDocs, int nConsumers, std::vector<BSONObj> segment) {
+        auto source = getMockSource(nDocs);
+        auto inputPipeline = unittest::assertGet(Pipeline::create({source}, getExpCtx()));
+        return DocumentSourceExchangeMerge::create(getExpCtx(),
+                                                   makeRoundRobinSpec(nConsumers),
+                                                   std::move(inputPipeline),
+                                                   std::move(segment));
+    }
+};
+
+TEST_F(DocumentSourceExchangeMergeTest, EmptySegmentMergesAllDocuments) {
+    const int nDocs = 500;
+    auto merge = makeMergeStage(nDocs, 5, {});
+
+    int docs = 0;
+    long long sum = 0;
+    for (auto input = merge->getNext(); input.isAdvanced(); input = merge->getNext()) {
+        sum += input.getDocument()["a"].getInt();
+        ++docs;
+    }
+
+    ASSERT_EQ(docs, nDocs);
+    // The merge does not preserve order, so compare the content by its sum.
+    ASSERT_EQ(sum, static_cast<long long>(nDocs) * (nDocs - 1) / 2);
+
+    merge->dispose();
+}
+
+TEST_F(DocumentSourceExchangeMergeTest, SingleConsumerActsAsPassthrough) {
+    const int nDocs = 100;
+    auto merge = makeMergeStage(nDocs, 1, {});
+
+    int docs = 0;
+    for (auto input = merge->getNext(); input.isAdvanced(); input = merge->getNext()) {
+        ++docs;
+    }
+
+    ASSERT_EQ(docs, nDocs);
+    merge->dispose();
+}
+
+TEST_F(DocumentSourceExchangeMergeTest, SegmentRunsOnEveryConsumer) {
+    const int nDocs = 500;
+    auto merge = makeMergeStage(nDocs, 5, {BSON("$match" << BSON("a" << BSON("$lt" << 250)))});
+
+    int docs = 0;
+    for (auto input = merge->getNext(); input.isAdvanced(); input = merge->getNext()) {
+        ASSERT_LT(input.getDocument()["a"].getInt(), 250);
+        ++docs;
+    }
+
+    ASSERT_EQ(docs, 250);
+    merge->dispose();
+}
+
+TEST_F(DocumentSourceExchangeMergeTest, EarlyDisposeStopsConsumers) {
+    const int nDocs = 10000;
+    auto merge = makeMergeStage(nDocs, 4, {});
+
+    // Pull a handful of documents and abandon the rest; dispose() must stop the consumer
+    // threads and run the Exchange's dispose rundown without deadlocking.
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(merge->getNext().isAdvanced());
+    }
+
+    merge->dispose();
+}
+
+TEST_F(DocumentSourceExchangeMergeTest, DisposeWithoutGetNextReleasesPipelines) {
+    auto merge = makeMergeStage(100, 3, {});
+    merge->dispose();
+}
+
+TEST_F(DocumentSourceExchangeMergeTest, PropagatesErrorFromLoading) {
+    FailPointEnableBlock fp("exchangeFailLoadNextBatch");
+
+    auto merge = makeMergeStage(500, 5, {});
+
+    ASSERT_THROWS(
+        [&] {
+            for (auto input = merge->getNext(); input.isAdvanced(); input = merge->getNext()) {
+            }
+        }(),
+        AssertionException);
+
+    merge->dispose();
+}
+
+}  // namespace
+}  // namespace mongo
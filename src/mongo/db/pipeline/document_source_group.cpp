@@ -42,6 +42,7 @@
 #include "mongo/db/pipeline/lite_parsed_document_source.h"
 #include "mongo/db/pipeline/value.h"
 #include "mongo/db/pipeline/value_comparator.h"
+#include "mongo/db/query/query_knobs.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/destructor_guard.h"
 
@@ -254,9 +255,6 @@ void DocumentSourceGroup::doDispose() {
 }
 
 intrusive_ptr<DocumentSource> DocumentSourceGroup::optimize() {
-    // TODO: If all _idExpressions are ExpressionConstants after optimization, then we know there
-    // will be only one group. We should take advantage of that to avoid going through the hash
-    // table.
     for (size_t i = 0; i < _idExpressions.size(); i++) {
         _idExpressions[i] = _idExpressions[i]->optimize();
     }
@@ -589,73 +587,105 @@ DocumentSource::GetNextResult DocumentSourceGroup::initialize() {
     }
 
 
-    // Barring any pausing, this loop exhausts 'pSource' and populates '_groups'.
-    GetNextResult input = pSource->getNext();
-    for (; input.isAdvanced(); input = pSource->getNext()) {
-        if (_memoryUsageBytes > _maxMemoryUsageBytes) {
-            uassert(16945,
-                    "Exceeded memory limit for $group, but didn't allow external sort."
-                    " Pass allowDiskUse:true to opt in.",
-                    _allowDiskUse);
-            _sortedFiles.push_back(spill());
-            _memoryUsageBytes = 0;
-        }
+    // If every part of the _id is a constant, then every input document belongs to the same
+    // group, so the group key can be computed once up front and the per-document hash lookup in
+    // '_groups' can be bypassed. 'constantIdGroup' caches the accumulators of that single group;
+    // it must be re-resolved whenever spill() clears '_groups'.
+    const bool constantId =
+        std::all_of(_idExpressions.begin(), _idExpressions.end(), [](const auto& exp) {
+            return dynamic_cast<ExpressionConstant*>(exp.get()) != nullptr;
+        });
+    const Value constantIdValue = constantId ? computeId(Document()) : Value();
+    Accumulators* constantIdGroup = nullptr;
+
+    // Barring any pausing, this loop exhausts 'pSource' and populates '_groups'. Input documents
+    // are pulled in batches so that the stages upstream are traversed once per batch rather than
+    // once per document.
+    const auto batchSize = static_cast<size_t>(internalPipelineStageBatchSize.load());
+    std::vector<Document> inputBatch;
+    auto inputStatus = GetNextResult::ReturnStatus::kAdvanced;
+    while (inputStatus == GetNextResult::ReturnStatus::kAdvanced) {
+        inputBatch.clear();
+        inputStatus = pSource->getNextBatch(batchSize, &inputBatch);
+        for (auto&& rootDocument : inputBatch) {
+            if (_memoryUsageBytes > _maxMemoryUsageBytes) {
+                uassert(16945,
+                        "Exceeded memory limit for $group, but didn't allow external sort."
+                        " Pass allowDiskUse:true to opt in.",
+                        _allowDiskUse);
+                _sortedFiles.push_back(spill());
+                _memoryUsageBytes = 0;
+                constantIdGroup = nullptr;
+            }
 
-        // We release the result document here so that it does not outlive the end of this loop
-        // iteration. Not releasing could lead to an array copy when this group follows an unwind.
-        auto rootDocument = input.releaseDocument();
-        Value id = computeId(rootDocument);
-
-        // Look for the _id value in the map. If it's not there, add a new entry with a blank
-        // accumulator. This is done in a somewhat odd way in order to avoid hashing 'id' and
-        // looking it up in '_groups' multiple times.
-        const size_t oldSize = _groups->size();
-        vector<intrusive_ptr<Accumulator>>& group = (*_groups)[id];
-        const bool inserted = _groups->size() != oldSize;
-
-        if (inserted) {
-            _memoryUsageBytes += id.getApproximateSize();
-
-            // Add the accumulators
-            group.reserve(numAccumulators);
-            for (auto&& accumulatedField : _accumulatedFields) {
-                group.push_back(accumulatedField.makeAccumulator(pExpCtx));
+            Accumulators* groupPtr = constantIdGroup;
+            bool inserted = false;
+            if (!groupPtr) {
+                Value id = constantId ? constantIdValue : computeId(rootDocument);
+
+                // Look for the _id value in the map. If it's not there, add a new entry with a
+                // blank accumulator. This is done in a somewhat odd way in order to avoid hashing
+                // 'id' and looking it up in '_groups' multiple times.
+                const size_t oldSize = _groups->size();
+                groupPtr = &(*_groups)[id];
+                inserted = _groups->size() != oldSize;
+                if (inserted) {
+                    _memoryUsageBytes += id.getApproximateSize();
+                }
+                if (constantId) {
+                    constantIdGroup = groupPtr;
+                }
             }
-        } else {
-            for (auto&& groupObj : group) {
-                // subtract old mem usage. New usage added back after processing.
-                _memoryUsageBytes -= groupObj->memUsageForSorter();
+            vector<intrusive_ptr<Accumulator>>& group = *groupPtr;
+
+            if (inserted) {
+                // Add the accumulators
+                group.reserve(numAccumulators);
+                for (auto&& accumulatedField : _accumulatedFields) {
+                    group.push_back(accumulatedField.makeAccumulator(pExpCtx));
+                }
+            } else {
+                for (auto&& groupObj : group) {
+                    // subtract old mem usage. New usage added back after processing.
+                    _memoryUsageBytes -= groupObj->memUsageForSorter();
+                }
             }
-        }
 
-        /* tickle all the accumulators for the group we found */
-        dassert(numAccumulators == group.size());
+            /* tickle all the accumulators for the group we found */
+            dassert(numAccumulators == group.size());
 
-        for (size_t i = 0; i < numAccumulators; i++) {
-            group[i]->process(_accumulatedFields[i].expression->evaluate(rootDocument),
-                              _doingMerge);
+            for (size_t i = 0; i < numAccumulators; i++) {
+                group[i]->process(_accumulatedFields[i].expression->evaluate(rootDocument),
+                                  _doingMerge);
 
-            _memoryUsageBytes += group[i]->memUsageForSorter();
-        }
+                _memoryUsageBytes += group[i]->memUsageForSorter();
+            }
 
-        if (kDebugBuild && !storageGlobalParams.readOnly) {
-            // In debug mode, spill every time we have a duplicate id to stress merge logic.
-            if (!inserted &&                 // is a dup
-                !pExpCtx->inMongos &&        // can't spill to disk in mongos
-                !_allowDiskUse &&            // don't change behavior when testing external sort
-                _sortedFiles.size() < 20) {  // don't open too many FDs
+            // Release the document so it does not outlive this iteration. Holding on to it could
+            // lead to an array copy when this group follows an unwind.
+            rootDocument = Document();
 
-                _sortedFiles.push_back(spill());
+            if (kDebugBuild && !storageGlobalParams.readOnly) {
+                // In debug mode, spill every time we have a duplicate id to stress merge logic.
+                if (!inserted &&                 // is a dup
+                    !pExpCtx->inMongos &&        // can't spill to disk in mongos
+                    !_allowDiskUse &&            // don't change behavior when testing external
+                                                 // sort
+                    _sortedFiles.size() < 20) {  // don't open too many FDs
+
+                    _sortedFiles.push_back(spill());
+                    constantIdGroup = nullptr;
+                }
             }
         }
     }
 
-    switch (input.getStatus()) {
+    switch (inputStatus) {
         case DocumentSource::GetNextResult::ReturnStatus::kAdvanced: {
             MONGO_UNREACHABLE;  // We consumed all advances above.
         }
         case DocumentSource::GetNextResult::ReturnStatus::kPauseExecution: {
-            return input;  // Propagate pause.
+            return GetNextResult::makePauseExecution();  // Propagate pause.
         }
         case DocumentSource::GetNextResult::ReturnStatus::kEOF: {
             // Do any final steps necessary to prepare to output results.
@@ -691,7 +721,7 @@ DocumentSource::GetNextResult DocumentSourceGroup::initialize() {
             // This must happen last so that, unless control gets here, we will re-enter
             // initialization after getting a GetNextResult::ResultState::kPauseExecution.
             _initialized = true;
-            return input;
+            return GetNextResult::makeEOF();
         }
     }
     MONGO_UNREACHABLE;
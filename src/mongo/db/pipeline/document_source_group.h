@@ -87,6 +87,18 @@ private:
     std::string _groupId;
 };
 
+/**
+ * Accumulates documents into groups keyed by the evaluated _id expression, either in memory or,
+ * with allowDiskUse, spilling sorted runs that are merged when results are requested.
+ *
+ * Accumulation is deliberately single-threaded. Expressions and accumulators evaluate against a
+ * shared ExpressionContext (with its Variables), and input Documents may lazily materialize
+ * fields from BSON owned by the storage layer under the source's collection locks, so neither
+ * can be handed to worker threads as-is. Scaling a hot $group is instead achieved by splitting
+ * the stage across shards: getShardSource() runs partial aggregation in parallel close to the
+ * data and mergingLogic() combines the partial results, which is the same partition-then-merge
+ * structure an in-process parallel mode would need.
+ */
 class DocumentSourceGroup final : public DocumentSource, public NeedsMergerDocumentSource {
 public:
     using Accumulators = std::vector<boost::intrusive_ptr<Accumulator>>;
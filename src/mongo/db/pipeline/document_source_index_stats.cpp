@@ -64,6 +64,9 @@ DocumentSource::GetNextResult DocumentSourceIndexStats::getNext() {
         doc["host"] = Value(_processName);
         doc["accesses"]["ops"] = Value(stats.accesses.loadRelaxed());
         doc["accesses"]["since"] = Value(stats.trackerStartTime);
+        if (auto lastAccess = stats.lastAccess.loadRelaxed()) {
+            doc["accesses"]["last"] = Value(Date_t::fromMillisSinceEpoch(lastAccess));
+        }
         ++_indexStatsIter;
         return doc.freeze();
     }
@@ -85,6 +85,26 @@ DocumentSource::GetNextResult DocumentSourceLimit::getNext() {
     return nextInput;
 }
 
+DocumentSource::GetNextResult::ReturnStatus DocumentSourceLimit::getNextBatch(
+    size_t maxDocs, std::vector<Document>* batch) {
+    pExpCtx->checkForInterrupt();
+
+    if (_nReturned >= _limit) {
+        return GetNextResult::ReturnStatus::kEOF;
+    }
+
+    // Clamp the request so the child appends no more documents than the limit allows.
+    const size_t sizeBefore = batch->size();
+    auto status = pSource->getNextBatch(
+        std::min(maxDocs, sizeBefore + static_cast<size_t>(_limit - _nReturned)), batch);
+    _nReturned += batch->size() - sizeBefore;
+    if (_nReturned >= _limit) {
+        dispose();
+        return GetNextResult::ReturnStatus::kEOF;
+    }
+    return status;
+}
+
 Value DocumentSourceLimit::serialize(boost::optional<ExplainOptions::Verbosity> explain) const {
     return Value(Document{{getSourceName(), _limit}});
 }
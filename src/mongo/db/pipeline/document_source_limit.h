@@ -60,6 +60,7 @@ public:
     }
 
     GetNextResult getNext() final;
+    GetNextResult::ReturnStatus getNextBatch(size_t maxDocs, std::vector<Document>* batch) final;
     const char* getSourceName() const final {
         return kStageName.rawData();
     }
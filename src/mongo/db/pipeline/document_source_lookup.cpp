@@ -32,9 +32,12 @@
 
 #include "mongo/db/pipeline/document_source_lookup.h"
 
+#include <algorithm>
+
 #include "mongo/base/init.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/matcher/expression_algo.h"
+#include "mongo/db/matcher/path.h"
 #include "mongo/db/pipeline/document.h"
 #include "mongo/db/pipeline/document_path_support.h"
 #include "mongo/db/pipeline/expression.h"
@@ -255,6 +258,23 @@ DocumentSource::GetNextResult DocumentSourceLookUp::getNext() {
     // '_unwindSrc' would be non-null, and we would not have made it here.
     invariant(!_matchSrc);
 
+    // If hash-join execution is enabled, load the foreign collection into a hash table when the
+    // first input document arrives and answer subsequent lookups by probing it.
+    if (_hashJoinState == HashJoinState::kNotAttempted) {
+        _hashJoinState = canUseHashJoin() && buildHashJoinTable() ? HashJoinState::kServing
+                                                                  : HashJoinState::kAbandoned;
+    }
+
+    if (_hashJoinState == HashJoinState::kServing) {
+        if (auto results = probeHashJoinTable(inputDoc)) {
+            MutableDocument output(std::move(inputDoc));
+            output.setNestedField(_as, Value(std::move(*results)));
+            return output.freeze();
+        }
+        // The probe could not reproduce the sub-pipeline's semantics for this particular document;
+        // fall through and query the foreign collection for it.
+    }
+
     if (!wasConstructedWithPipelineSyntax()) {
         auto matchStage =
             makeMatchStageFromInput(inputDoc, *_localField, _foreignField->fullPath(), BSONObj());
@@ -288,6 +308,133 @@ DocumentSource::GetNextResult DocumentSourceLookUp::getNext() {
     return output.freeze();
 }
 
+bool DocumentSourceLookUp::canUseHashJoin() const {
+    if (internalDocumentSourceLookupHashJoinMaxBytes.load() <= 0) {
+        return false;
+    }
+
+    // Only the localField/foreignField form performs a pure equality join; a pipeline may be
+    // correlated with the input document through 'let' variables.
+    if (wasConstructedWithPipelineSyntax()) {
+        return false;
+    }
+
+    // An absorbed $unwind streams each sub-pipeline's results incrementally, and an absorbed
+    // $match filters the foreign documents per input document.
+    if (_unwindSrc || _matchSrc || _additionalFilter) {
+        return false;
+    }
+
+    return true;
+}
+
+bool DocumentSourceLookUp::buildHashJoinTable() {
+    // Scan the entire foreign collection by filling the placeholder $match slot with an
+    // always-true predicate.
+    _resolvedPipeline.back() = BSON("$match" << BSONObj());
+    auto pipeline = buildPipeline(Document());
+
+    const auto maxBytes = internalDocumentSourceLookupHashJoinMaxBytes.load();
+    std::vector<Document> foreignDocs;
+    long long bytes = 0;
+    bool withinBudget = true;
+    while (auto result = pipeline->getNext()) {
+        bytes += result->getApproximateSize();
+        if (bytes > maxBytes) {
+            withinBudget = false;
+            break;
+        }
+        foreignDocs.push_back(std::move(*result));
+    }
+    for (auto&& source : pipeline->getSources()) {
+        if (source->usedDisk())
+            _usedDisk = true;
+    }
+
+    if (!withinBudget) {
+        return false;
+    }
+
+    _hashJoinTable.emplace(
+        _fromExpCtx->getValueComparator().makeUnorderedValueMap<std::vector<size_t>>());
+
+    // Index each foreign document under every value that an equality match on '_foreignField'
+    // would consider, using the same path iteration as the match machinery: implicit traversal of
+    // non-leaf arrays, and both the elements of a leaf array and the array as a whole.
+    ElementPath foreignFieldPath{_foreignField->fullPath()};
+    for (size_t i = 0; i < foreignDocs.size(); ++i) {
+        BSONObj foreignObj = foreignDocs[i].toBson();
+        BSONElementIterator it(&foreignFieldPath, foreignObj);
+        while (it.more()) {
+            BSONElement elem = it.next().element();
+            // An equality match on null also matches missing and undefined values.
+            Value key = (elem.eoo() || elem.type() == BSONType::jstNULL ||
+                         elem.type() == BSONType::Undefined)
+                ? Value(BSONNULL)
+                : Value(elem);
+            auto& entry = (*_hashJoinTable)[std::move(key)];
+            if (entry.empty() || entry.back() != i) {
+                entry.push_back(i);
+            }
+        }
+    }
+
+    _hashJoinDocs = std::move(foreignDocs);
+    return true;
+}
+
+boost::optional<std::vector<Value>> DocumentSourceLookUp::probeHashJoinTable(
+    const Document& input) const {
+    std::vector<Value> probeKeys;
+    bool sawUndefined = false;
+    document_path_support::visitAllValuesAtPath(input, *_localField, [&](const Value& nextValue) {
+        if (nextValue.getType() == BSONType::Undefined) {
+            sawUndefined = true;
+        }
+        probeKeys.push_back(nextValue);
+    });
+
+    if (sawUndefined) {
+        // Defer to the sub-pipeline, which reports an undefined local value the same way the
+        // equivalent query would.
+        return boost::none;
+    }
+
+    if (probeKeys.empty()) {
+        // Missing values are treated as null.
+        probeKeys.push_back(Value(BSONNULL));
+    }
+
+    std::vector<size_t> matches;
+    for (auto&& key : probeKeys) {
+        auto it = _hashJoinTable->find(key);
+        if (it != _hashJoinTable->end()) {
+            matches.insert(matches.end(), it->second.begin(), it->second.end());
+        }
+    }
+
+    // Return each matching document once, in foreign collection scan order.
+    std::sort(matches.begin(), matches.end());
+    matches.erase(std::unique(matches.begin(), matches.end()), matches.end());
+
+    std::vector<Value> results;
+    int objsize = 0;
+    const auto maxBytes = internalLookupStageIntermediateDocumentMaxSizeBytes.load();
+    for (size_t matchIndex : matches) {
+        const Document& foreignDoc = _hashJoinDocs[matchIndex];
+        objsize += foreignDoc.getApproximateSize();
+        uassert(4568,
+                str::stream() << "Total size of documents in " << _fromNs.coll()
+                              << " matching pipeline's $lookup stage exceeds "
+                              << maxBytes
+                              << " bytes",
+
+                objsize <= maxBytes);
+        results.emplace_back(foreignDoc);
+    }
+    return {std::move(results)};
+}
+
 std::unique_ptr<Pipeline, PipelineDeleter> DocumentSourceLookUp::buildPipeline(
     const Document& inputDoc) {
     // Copy all 'let' variables into the foreign pipeline's expression context.
@@ -478,6 +625,9 @@ void DocumentSourceLookUp::doDispose() {
         _pipeline->dispose(pExpCtx->opCtx);
         _pipeline.reset();
     }
+
+    _hashJoinDocs.clear();
+    _hashJoinTable = boost::none;
 }
 
 BSONObj DocumentSourceLookUp::makeMatchStageFromInput(const Document& input,
@@ -233,6 +233,28 @@ private:
 
     GetNextResult unwindResult();
 
+    /**
+     * Returns true if this $lookup is eligible for hash-join execution: the stage was specified
+     * with localField/foreignField syntax, hash joins are enabled, and no $unwind or $match has
+     * been absorbed.
+     */
+    bool canUseHashJoin() const;
+
+    /**
+     * Loads the entire foreign collection and indexes it by join key. Returns false, leaving this
+     * stage in query-per-input-document mode, if the foreign collection exceeds the hash-join
+     * memory budget.
+     */
+    bool buildHashJoinTable();
+
+    /**
+     * Looks up 'input' in the hash-join table, returning the matching foreign documents in
+     * foreign collection scan order. Returns boost::none if the probe cannot reproduce the
+     * sub-pipeline's semantics for this document, in which case the caller should fall back to
+     * querying the foreign collection.
+     */
+    boost::optional<std::vector<Value>> probeHashJoinTable(const Document& input) const;
+
     /**
      * Copies 'vars' and 'vps' to the Variables and VariablesParseState objects in 'expCtx'. These
      * copies provide access to 'let' defined variables in sub-pipeline execution.
@@ -290,6 +312,15 @@ private:
     Variables _variables;
     VariablesParseState _variablesParseState;
 
+    // When hash-join execution is enabled and the foreign collection fits the memory budget, the
+    // foreign documents are loaded once into '_hashJoinDocs' and indexed by join key in
+    // '_hashJoinTable'. Each input document then probes the table rather than running a
+    // sub-pipeline against the foreign collection.
+    enum class HashJoinState { kNotAttempted, kServing, kAbandoned };
+    HashJoinState _hashJoinState = HashJoinState::kNotAttempted;
+    std::vector<Document> _hashJoinDocs;
+    boost::optional<ValueUnorderedMap<std::vector<size_t>>> _hashJoinTable;
+
     // Caches documents returned by the non-correlated prefix of the $lookup pipeline during the
     // first iteration, up to a specified size limit in bytes. If this limit is not exceeded by the
     // time we hit EOF, subsequent iterations of the pipeline will draw from the cache rather than
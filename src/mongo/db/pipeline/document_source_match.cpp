@@ -92,8 +92,8 @@ DocumentSource::GetNextResult DocumentSourceMatch::getNext() {
         // only serialize the fields we need to do the match.
         BSONObj toMatch = _dependencies.needWholeDocument
             ? nextInput.getDocument().toBson()
-            : document_path_support::documentToBsonWithPaths(nextInput.getDocument(),
-                                                             _dependencies.fields);
+            : document_path_support::documentToBsonWithTopLevelFields(nextInput.getDocument(),
+                                                                      _topLevelDepFields);
 
         if (_expression->matchesBSON(toMatch)) {
             return nextInput;
@@ -110,6 +110,37 @@ DocumentSource::GetNextResult DocumentSourceMatch::getNext() {
     return nextInput;
 }
 
+DocumentSource::GetNextResult::ReturnStatus DocumentSourceMatch::getNextBatch(
+    size_t maxDocs, std::vector<Document>* batch) {
+    pExpCtx->checkForInterrupt();
+
+    // The user facing error should have been generated earlier.
+    massert(17309, "Should never call getNext on a $match stage with $text clause", !_isTextQuery);
+
+    auto status = GetNextResult::ReturnStatus::kAdvanced;
+    while (batch->size() < maxDocs && status == GetNextResult::ReturnStatus::kAdvanced) {
+        _inputBatch.clear();
+        status = pSource->getNextBatch(maxDocs - batch->size(), &_inputBatch);
+
+        for (auto&& input : _inputBatch) {
+            // MatchExpression only takes BSON documents, so we have to make one. As an
+            // optimization, only serialize the fields we need to do the match.
+            BSONObj toMatch = _dependencies.needWholeDocument
+                ? input.toBson()
+                : document_path_support::documentToBsonWithTopLevelFields(input,
+                                                                          _topLevelDepFields);
+
+            if (_expression->matchesBSON(toMatch)) {
+                batch->push_back(std::move(input));
+            }
+        }
+    }
+
+    // Release any non-matching documents so that no references are held across calls.
+    _inputBatch.clear();
+    return status;
+}
+
 Pipeline::SourceContainer::iterator DocumentSourceMatch::doOptimizeAt(
     Pipeline::SourceContainer::iterator itr, Pipeline::SourceContainer* container) {
     invariant(*itr == this);
@@ -382,6 +413,7 @@ void DocumentSourceMatch::joinMatchWith(intrusive_ptr<DocumentSourceMatch> other
     _expression = std::move(status.getValue());
     _dependencies = DepsTracker(_dependencies.getMetadataAvailable());
     getDependencies(&_dependencies);
+    _topLevelDepFields = document_path_support::extractUniqueTopLevelFields(_dependencies.fields);
 }
 
 pair<intrusive_ptr<DocumentSourceMatch>, intrusive_ptr<DocumentSourceMatch>>
@@ -506,6 +538,7 @@ DocumentSourceMatch::DocumentSourceMatch(const BSONObj& query,
         _predicate, expCtx, ExtensionsCallbackNoop(), Pipeline::kAllowedMatcherFeatures));
     _expression = std::move(status.getValue());
     getDependencies(&_dependencies);
+    _topLevelDepFields = document_path_support::extractUniqueTopLevelFields(_dependencies.fields);
 }
 
 }  // namespace mongo
@@ -44,6 +44,7 @@ public:
     virtual ~DocumentSourceMatch() = default;
 
     GetNextResult getNext() override;
+    GetNextResult::ReturnStatus getNextBatch(size_t maxDocs, std::vector<Document>* batch) override;
     boost::intrusive_ptr<DocumentSource> optimize() final;
     BSONObjSet getOutputSorts() final {
         return pSource ? pSource->getOutputSorts()
@@ -175,6 +176,14 @@ private:
 
     // Cache the dependencies so that we know what fields we need to serialize to BSON for matching.
     DepsTracker _dependencies;
+
+    // The unique top-level fields of '_dependencies.fields', precomputed so that serializing each
+    // input document for matching doesn't re-derive them.
+    std::vector<std::string> _topLevelDepFields;
+
+    // Scratch space for getNextBatch(), retained across calls to reuse its allocation. Always
+    // empty between calls.
+    std::vector<Document> _inputBatch;
 };
 
 }  // namespace mongo
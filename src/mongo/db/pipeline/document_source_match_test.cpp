@@ -499,6 +499,36 @@ TEST_F(DocumentSourceMatchTest, ShouldPropagatePauses) {
     ASSERT_TRUE(match->getNext().isEOF());
 }
 
+TEST_F(DocumentSourceMatchTest, BatchedGetNextShouldFilterMatchingDocuments) {
+    auto match = DocumentSourceMatch::create(BSON("a" << 1), getExpCtx());
+    auto mock = DocumentSourceMock::create(
+        {Document{{"a", 1}, {"b", 1}}, Document{{"a", 2}}, Document{{"a", 1}, {"b", 2}}});
+    match->setSource(mock.get());
+
+    std::vector<Document> batch;
+    ASSERT(match->getNextBatch(16, &batch) == DocumentSource::GetNextResult::ReturnStatus::kEOF);
+    ASSERT_EQUALS(2U, batch.size());
+    ASSERT_DOCUMENT_EQ(batch[0], (Document{{"a", 1}, {"b", 1}}));
+    ASSERT_DOCUMENT_EQ(batch[1], (Document{{"a", 1}, {"b", 2}}));
+}
+
+TEST_F(DocumentSourceMatchTest, BatchedGetNextShouldStopAtPause) {
+    auto match = DocumentSourceMatch::create(BSON("a" << 1), getExpCtx());
+    auto mock = DocumentSourceMock::create({Document{{"a", 1}},
+                                            DocumentSource::GetNextResult::makePauseExecution(),
+                                            Document{{"a", 1}}});
+    match->setSource(mock.get());
+
+    std::vector<Document> batch;
+    ASSERT(match->getNextBatch(16, &batch) ==
+           DocumentSource::GetNextResult::ReturnStatus::kPauseExecution);
+    ASSERT_EQUALS(1U, batch.size());
+
+    batch.clear();
+    ASSERT(match->getNextBatch(16, &batch) == DocumentSource::GetNextResult::ReturnStatus::kEOF);
+    ASSERT_EQUALS(1U, batch.size());
+}
+
 TEST_F(DocumentSourceMatchTest, ShouldCorrectlyJoinWithSubsequentMatch) {
     const auto match = DocumentSourceMatch::create(BSON("a" << 1), getExpCtx());
     const auto secondMatch = DocumentSourceMatch::create(BSON("b" << 1), getExpCtx());
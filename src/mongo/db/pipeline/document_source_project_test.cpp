@@ -140,6 +140,20 @@ TEST_F(ProjectStageTest, ExclusionShouldBeAbleToProcessMultipleDocuments) {
     ASSERT(project->getNext().isEOF());
 }
 
+TEST_F(ProjectStageTest, InclusionShouldBeAbleToProcessDocumentsInBatches) {
+    auto project = DocumentSourceProject::create(BSON("a" << true), getExpCtx());
+    auto source = DocumentSourceMock::create({"{a: 1, b: 2}", "{a: 3, b: 4}"});
+    project->setSource(source.get());
+
+    std::vector<Document> batch;
+    ASSERT(project->getNextBatch(4, &batch) == DocumentSource::GetNextResult::ReturnStatus::kEOF);
+    ASSERT_EQUALS(2U, batch.size());
+    ASSERT_EQUALS(1, batch[0].getField("a").getInt());
+    ASSERT(batch[0].getField("b").missing());
+    ASSERT_EQUALS(3, batch[1].getField("a").getInt());
+    ASSERT(batch[1].getField("b").missing());
+}
+
 TEST_F(ProjectStageTest, ShouldPropagatePauses) {
     auto project = DocumentSourceProject::create(BSON("a" << false), getExpCtx());
     auto source = DocumentSourceMock::create({Document(),
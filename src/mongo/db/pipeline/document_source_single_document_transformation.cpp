@@ -71,6 +71,22 @@ DocumentSource::GetNextResult DocumentSourceSingleDocumentTransformation::getNex
     return _parsedTransform->applyTransformation(input.releaseDocument());
 }
 
+DocumentSource::GetNextResult::ReturnStatus DocumentSourceSingleDocumentTransformation::getNextBatch(
+    size_t maxDocs, std::vector<Document>* batch) {
+    pExpCtx->checkForInterrupt();
+
+    // Get the next batch of input documents and transform each one.
+    _inputBatch.clear();
+    auto status = pSource->getNextBatch(maxDocs - batch->size(), &_inputBatch);
+    for (auto&& input : _inputBatch) {
+        batch->push_back(_parsedTransform->applyTransformation(input));
+    }
+
+    // Release the input documents so that no references are held across calls.
+    _inputBatch.clear();
+    return status;
+}
+
 intrusive_ptr<DocumentSource> DocumentSourceSingleDocumentTransformation::optimize() {
     _parsedTransform->optimize();
     return this;
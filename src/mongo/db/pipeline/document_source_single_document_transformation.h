@@ -52,6 +52,7 @@ public:
     // virtuals from DocumentSource
     const char* getSourceName() const final;
     GetNextResult getNext() final;
+    GetNextResult::ReturnStatus getNextBatch(size_t maxDocs, std::vector<Document>* batch) final;
     boost::intrusive_ptr<DocumentSource> optimize() final;
     Value serialize(boost::optional<ExplainOptions::Verbosity> explain = boost::none) const final;
     DepsTracker::State getDependencies(DepsTracker* deps) const final;
@@ -99,6 +100,10 @@ private:
     // Cached stage options in case this DocumentSource is disposed before serialized (e.g. explain
     // with a sort which will auto-dispose of the pipeline).
     Document _cachedStageOptions;
+
+    // Scratch space for getNextBatch(), retained across calls to reuse its allocation. Always
+    // empty between calls.
+    std::vector<Document> _inputBatch;
 };
 
 }  // namespace mongo
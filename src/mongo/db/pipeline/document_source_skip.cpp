@@ -32,6 +32,8 @@
 
 #include "mongo/db/pipeline/document_source_skip.h"
 
+#include <algorithm>
+
 #include "mongo/db/jsobj.h"
 #include "mongo/db/pipeline/document.h"
 #include "mongo/db/pipeline/document_source_limit.h"
@@ -73,6 +75,26 @@ DocumentSource::GetNextResult DocumentSourceSkip::getNext() {
     return pSource->getNext();
 }
 
+DocumentSource::GetNextResult::ReturnStatus DocumentSourceSkip::getNextBatch(
+    size_t maxDocs, std::vector<Document>* batch) {
+    pExpCtx->checkForInterrupt();
+
+    // Discard batches of input until the skip is exhausted. The skipped documents are released
+    // together when 'discarded' is cleared, and the scratch vector only lives for the skip phase.
+    std::vector<Document> discarded;
+    while (_nSkippedSoFar < _nToSkip) {
+        const auto remaining = static_cast<size_t>(_nToSkip - _nSkippedSoFar);
+        auto status = pSource->getNextBatch(std::min(remaining, maxDocs), &discarded);
+        _nSkippedSoFar += discarded.size();
+        discarded.clear();
+        if (status != GetNextResult::ReturnStatus::kAdvanced) {
+            return status;
+        }
+    }
+
+    return pSource->getNextBatch(maxDocs, batch);
+}
+
 Value DocumentSourceSkip::serialize(boost::optional<ExplainOptions::Verbosity> explain) const {
     return Value(DOC(getSourceName() << _nToSkip));
 }
@@ -62,6 +62,7 @@ public:
     }
 
     GetNextResult getNext() final;
+    GetNextResult::ReturnStatus getNextBatch(size_t maxDocs, std::vector<Document>* batch) final;
 
     const char* getSourceName() const final {
         return kStageName.rawData();
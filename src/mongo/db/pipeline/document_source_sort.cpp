@@ -32,6 +32,7 @@
 
 #include "mongo/db/pipeline/document_source_sort.h"
 
+#include "mongo/base/compare_numbers.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/pipeline/document.h"
 #include "mongo/db/pipeline/document_path_support.h"
@@ -41,6 +42,7 @@
 #include "mongo/db/pipeline/lite_parsed_document_source.h"
 #include "mongo/db/pipeline/value.h"
 #include "mongo/db/query/collation/collation_index_key.h"
+#include "mongo/db/query/query_knobs.h"
 #include "mongo/s/query/document_source_merge_cursors.h"
 
 namespace mongo {
@@ -335,14 +337,23 @@ SortOptions DocumentSourceSort::makeSortOptions() const {
 }
 
 DocumentSource::GetNextResult DocumentSourceSort::populate() {
-    auto nextInput = pSource->getNext();
-    for (; nextInput.isAdvanced(); nextInput = pSource->getNext()) {
-        loadDocument(nextInput.releaseDocument());
+    // Pull the input in batches so that the stages upstream are traversed once per batch rather
+    // than once per document.
+    const auto batchSize = static_cast<size_t>(internalPipelineStageBatchSize.load());
+    std::vector<Document> inputBatch;
+    auto inputStatus = GetNextResult::ReturnStatus::kAdvanced;
+    while (inputStatus == GetNextResult::ReturnStatus::kAdvanced) {
+        inputBatch.clear();
+        inputStatus = pSource->getNextBatch(batchSize, &inputBatch);
+        for (auto&& input : inputBatch) {
+            loadDocument(std::move(input));
+        }
     }
-    if (nextInput.isEOF()) {
+    if (inputStatus == GetNextResult::ReturnStatus::kEOF) {
         loadingDone();
+        return GetNextResult::makeEOF();
     }
-    return nextInput;
+    return GetNextResult::makePauseExecution();
 }
 
 void DocumentSourceSort::loadDocument(Document&& doc) {
@@ -489,6 +500,51 @@ std::pair<Value, Document> DocumentSourceSort::extractSortKey(Document&& doc) co
     return {inMemorySortKey, toBeSorted.freeze()};
 }
 
+namespace {
+
+// Typed comparison routines for sort key values. Each must produce exactly the same result as
+// Value::compare() does for a pair of values of its type, so that the typed fast path and the
+// generic fallback always agree on the ordering.
+int compareIntValues(const Value& l, const Value& r) {
+    return compareInts(l.getInt(), r.getInt());
+}
+
+int compareLongValues(const Value& l, const Value& r) {
+    return compareLongs(l.getLong(), r.getLong());
+}
+
+int compareDoubleValues(const Value& l, const Value& r) {
+    return compareDoubles(l.getDouble(), r.getDouble());
+}
+
+int compareDateValues(const Value& l, const Value& r) {
+    return compareLongs(l.getDate().toMillisSinceEpoch(), r.getDate().toMillisSinceEpoch());
+}
+
+int compareStringValues(const Value& l, const Value& r) {
+    // Sort keys are collation comparison keys, so a binary compare is correct here.
+    return l.getStringData().compare(r.getStringData());
+}
+
+int (*typedComparatorFor(BSONType type))(const Value&, const Value&) {
+    switch (type) {
+        case BSONType::NumberInt:
+            return &compareIntValues;
+        case BSONType::NumberLong:
+            return &compareLongValues;
+        case BSONType::NumberDouble:
+            return &compareDoubleValues;
+        case BSONType::Date:
+            return &compareDateValues;
+        case BSONType::String:
+            return &compareStringValues;
+        default:
+            return nullptr;
+    }
+}
+
+}  // namespace
+
 int DocumentSourceSort::compare(const Value& lhs, const Value& rhs) const {
     // DocumentSourceSort::populate() has already guaranteed that the sort key is non-empty.
     // However, the tricky part is deciding what to do if none of the sort keys are present. In that
@@ -498,16 +554,38 @@ int DocumentSourceSort::compare(const Value& lhs, const Value& rhs) const {
     // collation comparison keys.
     ValueComparator comparator;
     const size_t n = _sortPattern.size();
+    if (_typedSlots.size() != n) {
+        _typedSlots.resize(n);
+    }
+
+    // Consults the typed comparison slot for position 'i': while both sides keep carrying the
+    // type the slot has observed, comparison dispatches straight to the slot's routine; any
+    // mismatch takes the generic Value comparison instead.
+    auto compareValues = [&](const Value& l, const Value& r, TypedComparisonSlot& slot) {
+        const BSONType type = l.getType();
+        if (type == r.getType()) {
+            if (type != slot.observedType) {
+                // (Re)select the typed routine for the type this position now carries.
+                slot.observedType = type;
+                slot.typedCompare = typedComparatorFor(type);
+            }
+            if (slot.typedCompare) {
+                return slot.typedCompare(l, r);
+            }
+        }
+        return comparator.compare(l, r);
+    };
+
     if (n == 1) {  // simple fast case
         if (_sortPattern[0].isAscending)
-            return comparator.compare(lhs, rhs);
+            return compareValues(lhs, rhs, _typedSlots[0]);
         else
-            return -comparator.compare(lhs, rhs);
+            return -compareValues(lhs, rhs, _typedSlots[0]);
     }
 
     // compound sort
     for (size_t i = 0; i < n; i++) {
-        int cmp = comparator.compare(lhs[i], rhs[i]);
+        int cmp = compareValues(lhs[i], rhs[i], _typedSlots[i]);
         if (cmp) {
             /* if necessary, adjust the return value by the key ordering */
             if (!_sortPattern[i].isAscending)
@@ -236,6 +236,17 @@ private:
 
     int compare(const Value& lhs, const Value& rhs) const;
 
+    // Typed comparison slot for one sort pattern position. Once a position has observed a value
+    // type for which a dedicated comparison routine exists, pairs of that type dispatch straight
+    // to the routine, bypassing the type switch in the generic Value comparison; a mismatch
+    // falls back to the generic comparison, so the result always matches ValueComparator. The
+    // slots are mutated from compare(), which only ever runs on the thread populating the
+    // sorter.
+    struct TypedComparisonSlot {
+        BSONType observedType = BSONType::EOO;
+        int (*typedCompare)(const Value&, const Value&) = nullptr;
+    };
+
     /**
      * Absorbs 'limit', enabling a top-k sort. It is safe to call this multiple times, it will keep
      * the smallest limit.
@@ -254,6 +265,9 @@ private:
 
     SortPattern _sortPattern;
 
+    // One typed comparison slot per sort pattern position; lazily sized by compare().
+    mutable std::vector<TypedComparisonSlot> _typedSlots;
+
     // The set of paths on which we're sorting.
     std::set<std::string> _paths;
 
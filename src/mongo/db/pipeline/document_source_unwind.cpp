@@ -208,6 +208,38 @@ DocumentSource::GetNextResult DocumentSourceUnwind::getNext() {
     return nextOut;
 }
 
+DocumentSource::GetNextResult::ReturnStatus DocumentSourceUnwind::getNextBatch(
+    size_t maxDocs, std::vector<Document>* batch) {
+    pExpCtx->checkForInterrupt();
+
+    while (batch->size() < maxDocs) {
+        auto nextOut = _unwinder->getNext();
+        if (nextOut.isAdvanced()) {
+            batch->push_back(nextOut.releaseDocument());
+            continue;
+        }
+
+        // No more elements in the array currently being unwound; feed the unwinder the next
+        // buffered input document, refilling the buffer from the source when it runs dry.
+        if (_inputBatchPos == _inputBatch.size()) {
+            _inputBatch.clear();
+            _inputBatchPos = 0;
+            auto status = pSource->getNextBatch(maxDocs - batch->size(), &_inputBatch);
+            if (_inputBatch.empty()) {
+                return status;
+            }
+        }
+
+        // Release our reference to the input document as it is handed over, so that the unwinder
+        // does not have to copy-on-write against it.
+        _unwinder->resetDocument(_inputBatch[_inputBatchPos]);
+        _inputBatch[_inputBatchPos] = Document();
+        ++_inputBatchPos;
+    }
+
+    return GetNextResult::ReturnStatus::kAdvanced;
+}
+
 BSONObjSet DocumentSourceUnwind::getOutputSorts() {
     BSONObjSet out = SimpleBSONObjComparator::kInstance.makeBSONObjSet();
     std::string unwoundPath = getUnwindPath();
@@ -39,6 +39,7 @@ class DocumentSourceUnwind final : public DocumentSource {
 public:
     // virtuals from DocumentSource
     GetNextResult getNext() final;
+    GetNextResult::ReturnStatus getNextBatch(size_t maxDocs, std::vector<Document>* batch) final;
     const char* getSourceName() const final;
     Value serialize(boost::optional<ExplainOptions::Verbosity> explain = boost::none) const final;
     BSONObjSet getOutputSorts() final;
@@ -104,6 +105,12 @@ private:
     // Iteration state.
     class Unwinder;
     std::unique_ptr<Unwinder> _unwinder;
+
+    // Input documents buffered by getNextBatch(). Unlike a streaming stage's scratch space, this
+    // may carry unconsumed documents across calls when the unwound output fills a batch before
+    // the input is drained; '_inputBatchPos' marks the next document to feed to the unwinder.
+    std::vector<Document> _inputBatch;
+    size_t _inputBatchPos = 0;
 };
 
 }  // namespace mongo
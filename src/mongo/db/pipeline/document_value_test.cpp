@@ -113,6 +113,29 @@ TEST(DocumentConstruction, FromEmptyDocumentClone) {
     ASSERT_DOCUMENT_EQ(document, documentClone);
 }
 
+// Exercises the sequential lookup hint in DocumentStorage::findField: in-order walks hit the
+// hint, out-of-order and missing lookups must fall back to the regular lookup.
+TEST(DocumentFieldLookup, FieldsAreFoundInAnyAccessOrder) {
+    Document document =
+        fromBson(BSON("a" << 1 << "b" << 2 << "c" << 3 << "d" << 4 << "e" << 5 << "f" << 6));
+
+    // In insertion order.
+    ASSERT_EQUALS(1, document["a"].getInt());
+    ASSERT_EQUALS(2, document["b"].getInt());
+    ASSERT_EQUALS(3, document["c"].getInt());
+
+    // Out of order, repeated, and wrapping back to the front.
+    ASSERT_EQUALS(6, document["f"].getInt());
+    ASSERT_EQUALS(4, document["d"].getInt());
+    ASSERT_EQUALS(4, document["d"].getInt());
+    ASSERT_EQUALS(1, document["a"].getInt());
+
+    // Missing fields stay missing whatever the previous access was.
+    ASSERT(document["g"].missing());
+    ASSERT_EQUALS(5, document["e"].getInt());
+    ASSERT(document["g"].missing());
+}
+
 /**
  * Appends to 'builder' an object nested 'depth' levels deep.
  */
@@ -265,7 +265,14 @@ const char* ExpressionAbs::getOpName() const {
 
 /* ------------------------- ExpressionAdd ----------------------------- */
 
-Value ExpressionAdd::evaluate(const Document& root) const {
+namespace {
+/**
+ * Shared implementation of $add, used by both ExpressionAdd::evaluate() and the
+ * compiled-expression evaluator. 'getOperand(i)' returns the value of the i'th of 'n' operands,
+ * and is invoked at most once per operand, in order.
+ */
+template <typename OperandGetter>
+Value evaluateAdd(size_t n, const OperandGetter& getOperand) {
     // We'll try to return the narrowest possible result value while avoiding overflow, loss
     // of precision due to intermediate rounding or implicit use of decimal types. To do that,
     // compute a compensated sum for non-decimal values and a separate decimal sum for decimal
@@ -275,9 +282,8 @@ Value ExpressionAdd::evaluate(const Document& root) const {
     BSONType totalType = NumberInt;
     bool haveDate = false;
 
-    const size_t n = vpOperand.size();
     for (size_t i = 0; i < n; ++i) {
-        Value val = vpOperand[i]->evaluate(root);
+        Value val = getOperand(i);
 
         switch (val.getType()) {
             case NumberDecimal:
@@ -339,6 +345,11 @@ Value ExpressionAdd::evaluate(const Document& root) const {
             massert(16417, "$add resulted in a non-numeric type", false);
     }
 }
+}  // namespace
+
+Value ExpressionAdd::evaluate(const Document& root) const {
+    return evaluateAdd(vpOperand.size(), [&](size_t i) { return vpOperand[i]->evaluate(root); });
+}
 
 REGISTER_EXPRESSION(add, ExpressionAdd::parse);
 const char* ExpressionAdd::getOpName() const {
@@ -1010,6 +1021,27 @@ boost::optional<TimeZone> makeTimeZone(const TimeZoneDatabase* tzdb,
     return tzdb->getTimeZone(timeZoneId.getString());
 }
 
+/**
+ * If 'timeZone' is a constant expression which evaluates to a string, returns the corresponding
+ * TimeZone, so that optimize() can resolve it against the time zone database once rather than once
+ * per document. Returns boost::none for non-constant expressions and for constants whose nullish
+ * or ill-typed values must keep their per-document behavior in evaluate().
+ */
+boost::optional<TimeZone> resolveConstantTimeZone(
+    const TimeZoneDatabase* tzdb, const boost::intrusive_ptr<Expression>& timeZone) {
+    if (!timeZone || !ExpressionConstant::isNullOrConstant(timeZone)) {
+        return boost::none;
+    }
+
+    auto timeZoneId = timeZone->evaluate(Document{});
+    if (timeZoneId.getType() != BSONType::String) {
+        return boost::none;
+    }
+
+    invariant(tzdb);
+    return tzdb->getTimeZone(timeZoneId.getString());
+}
+
 }  // namespace
 
 
@@ -1171,6 +1203,9 @@ intrusive_ptr<Expression> ExpressionDateFromParts::optimize() {
         return ExpressionConstant::create(getExpressionContext(), evaluate(Document{}));
     }
 
+    _parsedTimeZone =
+        resolveConstantTimeZone(getExpressionContext()->timeZoneDatabase, _timeZone);
+
     return this;
 }
 
@@ -1229,7 +1264,10 @@ Value ExpressionDateFromParts::evaluate(const Document& root) const {
         return Value(BSONNULL);
     }
 
-    auto timeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
+    boost::optional<TimeZone> timeZone = _parsedTimeZone;
+    if (!timeZone) {
+        timeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
+    }
 
     if (!timeZone) {
         return Value(BSONNULL);
@@ -1393,6 +1431,10 @@ intrusive_ptr<Expression> ExpressionDateFromString::optimize() {
         // Everything is a constant, so we can turn into a constant.
         return ExpressionConstant::create(getExpressionContext(), evaluate(Document{}));
     }
+
+    _parsedTimeZone =
+        resolveConstantTimeZone(getExpressionContext()->timeZoneDatabase, _timeZone);
+
     return this;
 }
 
@@ -1428,7 +1470,10 @@ Value ExpressionDateFromString::evaluate(const Document& root) const {
 
     // Evaluate the timezone parameter before checking for nullish input, as this will throw an
     // exception for an invalid timezone string.
-    auto timeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
+    boost::optional<TimeZone> timeZone = _parsedTimeZone;
+    if (!timeZone) {
+        timeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
+    }
 
     // Behavior for nullish input takes precedence over other nullish elements.
     if (dateString.nullish()) {
@@ -1552,6 +1597,9 @@ intrusive_ptr<Expression> ExpressionDateToParts::optimize() {
         return ExpressionConstant::create(getExpressionContext(), evaluate(Document{}));
     }
 
+    _parsedTimeZone =
+        resolveConstantTimeZone(getExpressionContext()->timeZoneDatabase, _timeZone);
+
     return this;
 }
 
@@ -1585,7 +1633,10 @@ boost::optional<int> ExpressionDateToParts::evaluateIso8601Flag(const Document&
 Value ExpressionDateToParts::evaluate(const Document& root) const {
     const Value date = _date->evaluate(root);
 
-    auto timeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
+    boost::optional<TimeZone> timeZone = _parsedTimeZone;
+    if (!timeZone) {
+        timeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
+    }
     if (!timeZone) {
         return Value(BSONNULL);
     }
@@ -1706,6 +1757,9 @@ intrusive_ptr<Expression> ExpressionDateToString::optimize() {
         return ExpressionConstant::create(getExpressionContext(), evaluate(Document{}));
     }
 
+    _parsedTimeZone =
+        resolveConstantTimeZone(getExpressionContext()->timeZoneDatabase, _timeZone);
+
     return this;
 }
 
@@ -1740,7 +1794,10 @@ Value ExpressionDateToString::evaluate(const Document& root) const {
 
     // Evaluate the timezone parameter before checking for nullish input, as this will throw an
     // exception for an invalid timezone string.
-    auto timeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
+    boost::optional<TimeZone> timeZone = _parsedTimeZone;
+    if (!timeZone) {
+        timeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get());
+    }
 
     if (date.nullish()) {
         return _onNull ? _onNull->evaluate(root) : Value(BSONNULL);
@@ -2559,7 +2616,14 @@ const char* ExpressionMod::getOpName() const {
 
 /* ------------------------- ExpressionMultiply ----------------------------- */
 
-Value ExpressionMultiply::evaluate(const Document& root) const {
+namespace {
+/**
+ * Shared implementation of $multiply, used by both ExpressionMultiply::evaluate() and the
+ * compiled-expression evaluator. 'getOperand(i)' returns the value of the i'th of 'n' operands,
+ * and is invoked at most once per operand, in order.
+ */
+template <typename OperandGetter>
+Value evaluateMultiply(size_t n, const OperandGetter& getOperand) {
     /*
       We'll try to return the narrowest possible result value.  To do that
       without creating intermediate Values, do the arithmetic for double
@@ -2572,9 +2636,8 @@ Value ExpressionMultiply::evaluate(const Document& root) const {
 
     BSONType productType = NumberInt;
 
-    const size_t n = vpOperand.size();
     for (size_t i = 0; i < n; ++i) {
-        Value val = vpOperand[i]->evaluate(root);
+        Value val = getOperand(i);
 
         if (val.numeric()) {
             BSONType oldProductType = productType;
@@ -2614,6 +2677,12 @@ Value ExpressionMultiply::evaluate(const Document& root) const {
     else
         massert(16418, "$multiply resulted in a non-numeric type", false);
 }
+}  // namespace
+
+Value ExpressionMultiply::evaluate(const Document& root) const {
+    return evaluateMultiply(vpOperand.size(),
+                            [&](size_t i) { return vpOperand[i]->evaluate(root); });
+}
 
 REGISTER_EXPRESSION(multiply, ExpressionMultiply::parse);
 const char* ExpressionMultiply::getOpName() const {
@@ -4317,10 +4386,12 @@ const char* ExpressionStrLenCP::getOpName() const {
 
 /* ----------------------- ExpressionSubtract ---------------------------- */
 
-Value ExpressionSubtract::evaluate(const Document& root) const {
-    Value lhs = vpOperand[0]->evaluate(root);
-    Value rhs = vpOperand[1]->evaluate(root);
-
+namespace {
+/**
+ * Shared implementation of $subtract, used by both ExpressionSubtract::evaluate() and the
+ * compiled-expression evaluator.
+ */
+Value evaluateSubtract(Value lhs, Value rhs) {
     BSONType diffType = Value::getWidestNumeric(rhs.getType(), lhs.getType());
 
     if (diffType == NumberDecimal) {
@@ -4357,6 +4428,11 @@ Value ExpressionSubtract::evaluate(const Document& root) const {
                                 << typeName(lhs.getType()));
     }
 }
+}  // namespace
+
+Value ExpressionSubtract::evaluate(const Document& root) const {
+    return evaluateSubtract(vpOperand[0]->evaluate(root), vpOperand[1]->evaluate(root));
+}
 
 REGISTER_EXPRESSION(subtract, ExpressionSubtract::parse);
 const char* ExpressionSubtract::getOpName() const {
@@ -5559,4 +5635,254 @@ Value ExpressionConvert::performConversion(BSONType targetType, Value inputValue
     return table.findConversionFunc(inputType, targetType)(getExpressionContext(), inputValue);
 }
 
+/* ----------------------- CompiledExpression ---------------------------- */
+
+CompiledExpression CompiledExpression::compile(const boost::intrusive_ptr<Expression>& expression) {
+    CompiledExpression compiled;
+    compiled._expCtx = expression->getExpressionContext();
+    compiled._compileNode(expression.get());
+    dassert(compiled._stackDepth == 1);
+    return compiled;
+}
+
+size_t CompiledExpression::_emit(OpCode op, size_t arg) {
+    _instructions.push_back({op, arg});
+    return _instructions.size() - 1;
+}
+
+void CompiledExpression::_pushed() {
+    if (++_stackDepth > _maxStackDepth) {
+        _maxStackDepth = _stackDepth;
+    }
+}
+
+void CompiledExpression::_popped(size_t n) {
+    dassert(_stackDepth >= n);
+    _stackDepth -= n;
+}
+
+void CompiledExpression::_compileNode(Expression* expr) {
+    if (auto constant = dynamic_cast<ExpressionConstant*>(expr)) {
+        _constants.push_back(constant->getValue());
+        _emit(OpCode::kPushConstant, _constants.size() - 1);
+        _pushed();
+        return;
+    }
+
+    if (auto fieldPath = dynamic_cast<ExpressionFieldPath*>(expr)) {
+        _fieldPaths.emplace_back(fieldPath);
+        _emit(OpCode::kPushFieldPath, _fieldPaths.size() - 1);
+        _pushed();
+        return;
+    }
+
+    if (auto andExpr = dynamic_cast<ExpressionAnd*>(expr)) {
+        // Each operand is followed by a check which short-circuits to the end of the expression,
+        // with a 'false' result, as soon as an operand evaluates falsy.
+        std::vector<size_t> checks;
+        for (auto&& operand : andExpr->getOperandList()) {
+            _compileNode(operand.get());
+            checks.push_back(_emit(OpCode::kAndCheck));
+            _popped();
+        }
+        _constants.push_back(Value(true));
+        _emit(OpCode::kPushConstant, _constants.size() - 1);
+        _pushed();
+        for (auto check : checks) {
+            _instructions[check].arg = _instructions.size();
+        }
+        return;
+    }
+
+    if (auto orExpr = dynamic_cast<ExpressionOr*>(expr)) {
+        std::vector<size_t> checks;
+        for (auto&& operand : orExpr->getOperandList()) {
+            _compileNode(operand.get());
+            checks.push_back(_emit(OpCode::kOrCheck));
+            _popped();
+        }
+        _constants.push_back(Value(false));
+        _emit(OpCode::kPushConstant, _constants.size() - 1);
+        _pushed();
+        for (auto check : checks) {
+            _instructions[check].arg = _instructions.size();
+        }
+        return;
+    }
+
+    if (auto notExpr = dynamic_cast<ExpressionNot*>(expr)) {
+        _compileNode(notExpr->getOperandList()[0].get());
+        _emit(OpCode::kNot);
+        return;
+    }
+
+    if (auto cmpExpr = dynamic_cast<ExpressionCompare*>(expr)) {
+        _compileNode(cmpExpr->getOperandList()[0].get());
+        _compileNode(cmpExpr->getOperandList()[1].get());
+        _emit(OpCode::kCompare, cmpExpr->getOp());
+        _popped();
+        return;
+    }
+
+    if (auto condExpr = dynamic_cast<ExpressionCond*>(expr)) {
+        auto&& operands = condExpr->getOperandList();
+        _compileNode(operands[0].get());
+        const size_t jumpToElse = _emit(OpCode::kJumpIfFalse);
+        _popped();
+
+        // The two branches start from the same stack depth; only one of them executes.
+        const size_t depthAtBranch = _stackDepth;
+        _compileNode(operands[1].get());
+        const size_t jumpToEnd = _emit(OpCode::kJump);
+
+        _instructions[jumpToElse].arg = _instructions.size();
+        _stackDepth = depthAtBranch;
+        _compileNode(operands[2].get());
+        _instructions[jumpToEnd].arg = _instructions.size();
+        return;
+    }
+
+    if (auto ifNullExpr = dynamic_cast<ExpressionIfNull*>(expr)) {
+        auto&& operands = ifNullExpr->getOperandList();
+        _compileNode(operands[0].get());
+        const size_t jumpToEnd = _emit(OpCode::kJumpIfNotNullish);
+        _popped();
+        _compileNode(operands[1].get());
+        _instructions[jumpToEnd].arg = _instructions.size();
+        return;
+    }
+
+    if (auto addExpr = dynamic_cast<ExpressionAdd*>(expr)) {
+        auto&& operands = addExpr->getOperandList();
+        for (auto&& operand : operands) {
+            _compileNode(operand.get());
+        }
+        _emit(OpCode::kAdd, operands.size());
+        _popped(operands.size());
+        _pushed();
+        return;
+    }
+
+    if (auto subtractExpr = dynamic_cast<ExpressionSubtract*>(expr)) {
+        _compileNode(subtractExpr->getOperandList()[0].get());
+        _compileNode(subtractExpr->getOperandList()[1].get());
+        _emit(OpCode::kSubtract);
+        _popped();
+        return;
+    }
+
+    if (auto multiplyExpr = dynamic_cast<ExpressionMultiply*>(expr)) {
+        auto&& operands = multiplyExpr->getOperandList();
+        for (auto&& operand : operands) {
+            _compileNode(operand.get());
+        }
+        _emit(OpCode::kMultiply, operands.size());
+        _popped(operands.size());
+        _pushed();
+        return;
+    }
+
+    // Anything else is retained in tree form and evaluated through the regular virtual interface
+    // when reached.
+    _subtrees.emplace_back(expr);
+    _emit(OpCode::kPushSubtree, _subtrees.size() - 1);
+    _pushed();
+}
+
+Value CompiledExpression::evaluate(const Document& root) const {
+    std::vector<Value> stack;
+    stack.reserve(_maxStackDepth);
+
+    const size_t numInstructions = _instructions.size();
+    size_t ip = 0;
+    while (ip < numInstructions) {
+        const Instruction& insn = _instructions[ip];
+        ++ip;
+
+        switch (insn.op) {
+            case OpCode::kPushConstant:
+                stack.push_back(_constants[insn.arg]);
+                break;
+            case OpCode::kPushFieldPath:
+                // The call target is known at compile time, so dispatch is non-virtual.
+                stack.push_back(_fieldPaths[insn.arg]->ExpressionFieldPath::evaluate(root));
+                break;
+            case OpCode::kPushSubtree:
+                stack.push_back(_subtrees[insn.arg]->evaluate(root));
+                break;
+            case OpCode::kAndCheck:
+            case OpCode::kOrCheck: {
+                const bool stopValue = (insn.op == OpCode::kOrCheck);
+                const bool operand = stack.back().coerceToBool();
+                stack.pop_back();
+                if (operand == stopValue) {
+                    stack.push_back(Value(stopValue));
+                    ip = insn.arg;
+                }
+                break;
+            }
+            case OpCode::kNot:
+                stack.back() = Value(!stack.back().coerceToBool());
+                break;
+            case OpCode::kCompare: {
+                Value right = std::move(stack.back());
+                stack.pop_back();
+                int cmp = _expCtx->getValueComparator().compare(stack.back(), right);
+
+                // Make cmp one of 1, 0, or -1.
+                cmp = cmp < 0 ? -1 : (cmp > 0 ? 1 : 0);
+
+                if (insn.arg == ExpressionCompare::CMP) {
+                    stack.back() = Value(cmp);
+                } else {
+                    stack.back() = Value(cmpLookup[insn.arg].truthValue[cmp + 1]);
+                }
+                break;
+            }
+            case OpCode::kJump:
+                ip = insn.arg;
+                break;
+            case OpCode::kJumpIfFalse: {
+                const bool condition = stack.back().coerceToBool();
+                stack.pop_back();
+                if (!condition) {
+                    ip = insn.arg;
+                }
+                break;
+            }
+            case OpCode::kJumpIfNotNullish:
+                if (!stack.back().nullish()) {
+                    ip = insn.arg;
+                } else {
+                    stack.pop_back();
+                }
+                break;
+            case OpCode::kAdd: {
+                const size_t operandBase = stack.size() - insn.arg;
+                Value sum = evaluateAdd(insn.arg, [&](size_t i) { return stack[operandBase + i]; });
+                stack.resize(operandBase);
+                stack.push_back(std::move(sum));
+                break;
+            }
+            case OpCode::kSubtract: {
+                Value right = std::move(stack.back());
+                stack.pop_back();
+                stack.back() = evaluateSubtract(std::move(stack.back()), std::move(right));
+                break;
+            }
+            case OpCode::kMultiply: {
+                const size_t operandBase = stack.size() - insn.arg;
+                Value product =
+                    evaluateMultiply(insn.arg, [&](size_t i) { return stack[operandBase + i]; });
+                stack.resize(operandBase);
+                stack.push_back(std::move(product));
+                break;
+            }
+        }
+    }
+
+    dassert(stack.size() == 1);
+    return std::move(stack.back());
+}
+
 }  // namespace mongo
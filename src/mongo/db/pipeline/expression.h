@@ -222,6 +222,10 @@ public:
      */
     static std::string removeFieldPrefix(const std::string& prefixedField);
 
+    const boost::intrusive_ptr<ExpressionContext>& getExpressionContext() const {
+        return _expCtx;
+    }
+
     /**
      * Registers an Parser so it can be called from parseExpression.
      *
@@ -243,10 +247,6 @@ protected:
 
     typedef std::vector<boost::intrusive_ptr<Expression>> ExpressionVector;
 
-    const boost::intrusive_ptr<ExpressionContext>& getExpressionContext() const {
-        return _expCtx;
-    }
-
     virtual void _doAddDependencies(DepsTracker* deps) const = 0;
 
 private:
@@ -572,6 +572,9 @@ public:
         if (!_timeZone) {
             return evaluateDate(date, TimeZoneDatabase::utcZone());
         }
+        if (_parsedTimeZone) {
+            return evaluateDate(date, *_parsedTimeZone);
+        }
         auto timeZoneId = _timeZone->evaluate(root);
         if (timeZoneId.nullish()) {
             return Value(BSONNULL);
@@ -612,6 +615,17 @@ public:
             // Everything is a constant, so we can turn into a constant.
             return ExpressionConstant::create(getExpressionContext(), evaluate(Document{}));
         }
+        if (_timeZone && ExpressionConstant::isNullOrConstant(_timeZone)) {
+            // The timezone is a constant, so look it up in the time zone database once here
+            // rather than once per document. Nullish and non-string constants are left for
+            // evaluate(), which preserves their per-document null and error behavior.
+            auto timeZoneId = _timeZone->evaluate(Document{});
+            if (timeZoneId.getType() == BSONType::String) {
+                invariant(getExpressionContext()->timeZoneDatabase);
+                _parsedTimeZone =
+                    getExpressionContext()->timeZoneDatabase->getTimeZone(timeZoneId.getString());
+            }
+        }
         return this;
     }
 
@@ -697,6 +711,8 @@ private:
     boost::intrusive_ptr<Expression> _date;
     // The expression representing the timezone argument, nullptr if not specified.
     boost::intrusive_ptr<Expression> _timeZone = nullptr;
+    // Pre-resolved timezone, set by optimize() when the timezone argument is a string constant.
+    boost::optional<TimeZone> _parsedTimeZone;
 };
 
 class ExpressionAbs final : public ExpressionSingleNumericArg<ExpressionAbs> {
@@ -949,6 +965,9 @@ private:
     boost::intrusive_ptr<Expression> _format;
     boost::intrusive_ptr<Expression> _onNull;
     boost::intrusive_ptr<Expression> _onError;
+
+    // Pre-resolved timezone, set by optimize() when the timezone argument is a string constant.
+    boost::optional<TimeZone> _parsedTimeZone;
 };
 
 class ExpressionDateFromParts final : public Expression {
@@ -1008,6 +1027,9 @@ private:
     boost::intrusive_ptr<Expression> _isoWeek;
     boost::intrusive_ptr<Expression> _isoDayOfWeek;
     boost::intrusive_ptr<Expression> _timeZone;
+
+    // Pre-resolved timezone, set by optimize() when the timezone argument is a string constant.
+    boost::optional<TimeZone> _parsedTimeZone;
 };
 
 class ExpressionDateToParts final : public Expression {
@@ -1038,6 +1060,9 @@ private:
     boost::intrusive_ptr<Expression> _date;
     boost::intrusive_ptr<Expression> _timeZone;
     boost::intrusive_ptr<Expression> _iso8601;
+
+    // Pre-resolved timezone, set by optimize() when the timezone argument is a string constant.
+    boost::optional<TimeZone> _parsedTimeZone;
 };
 
 class ExpressionDateToString final : public Expression {
@@ -1065,6 +1090,9 @@ private:
     boost::intrusive_ptr<Expression> _date;
     boost::intrusive_ptr<Expression> _timeZone;
     boost::intrusive_ptr<Expression> _onNull;
+
+    // Pre-resolved timezone, set by optimize() when the timezone argument is a string constant.
+    boost::optional<TimeZone> _parsedTimeZone;
 };
 
 class ExpressionDayOfMonth final : public DateExpressionAcceptingTimeZone<ExpressionDayOfMonth> {
@@ -2085,4 +2113,77 @@ private:
     boost::intrusive_ptr<Expression> _onError;
     boost::intrusive_ptr<Expression> _onNull;
 };
+
+/**
+ * An aggregation expression lowered into a flat instruction stream, which is evaluated iteratively
+ * over an explicit value stack rather than by recursive virtual Expression::evaluate() calls.
+ *
+ * The compiler understands constants, field paths, boolean logic ($and, $or, $not), the comparison
+ * operators, $cond, $ifNull and the basic arithmetic operators ($add, $subtract and $multiply).
+ * Any subtree it does not understand is retained in tree form and entered through a single virtual
+ * call when reached, so a compiled expression always produces exactly the same result, and raises
+ * exactly the same errors, as the tree it was compiled from. In particular, operands of $and, $or,
+ * $cond and $ifNull which tree-walking evaluation would not have evaluated are skipped by the
+ * compiled form as well.
+ */
+class CompiledExpression {
+public:
+    /**
+     * Lowers 'expression' into compiled form. Compilation never fails; unsupported constructs
+     * simply remain in tree form. The expression should already have been optimized so that
+     * constant subtrees are folded before being lowered.
+     */
+    static CompiledExpression compile(const boost::intrusive_ptr<Expression>& expression);
+
+    /**
+     * Evaluates the compiled expression with respect to the Document given by 'root' and returns
+     * the result. Equivalent to calling evaluate() on the Expression this was compiled from.
+     */
+    Value evaluate(const Document& root) const;
+
+private:
+    // The meaning of 'arg' depends on the opcode: an index into one of the tables below, a jump
+    // target, an operand count, or a comparison operator.
+    enum class OpCode : unsigned char {
+        kPushConstant,       // Push _constants[arg].
+        kPushFieldPath,      // Push the result of evaluating _fieldPaths[arg].
+        kPushSubtree,        // Push the result of evaluating the retained subtree _subtrees[arg].
+        kAndCheck,           // Pop; if falsy, push false and jump to arg.
+        kOrCheck,            // Pop; if truthy, push true and jump to arg.
+        kNot,                // Pop; push the boolean negation of the popped value.
+        kCompare,            // Pop rhs, then lhs; push the result of the CmpOp given by arg.
+        kJump,               // Jump to arg.
+        kJumpIfFalse,        // Pop; if falsy, jump to arg.
+        kJumpIfNotNullish,   // If the top of the stack is not nullish jump to arg, else pop.
+        kAdd,                // Pop arg operands and push their sum.
+        kSubtract,           // Pop rhs, then lhs; push their difference.
+        kMultiply,           // Pop arg operands and push their product.
+    };
+
+    struct Instruction {
+        OpCode op;
+        size_t arg;
+    };
+
+    CompiledExpression() = default;
+
+    void _compileNode(Expression* expr);
+    size_t _emit(OpCode op, size_t arg = 0);
+
+    // Track the stack depth of the program point being compiled so that evaluation can reserve the
+    // value stack up front.
+    void _pushed();
+    void _popped(size_t n = 1);
+
+    std::vector<Instruction> _instructions;
+    std::vector<Value> _constants;
+    std::vector<boost::intrusive_ptr<ExpressionFieldPath>> _fieldPaths;
+    std::vector<boost::intrusive_ptr<Expression>> _subtrees;
+
+    // Needed by kCompare so that compiled comparisons respect the collation.
+    boost::intrusive_ptr<ExpressionContext> _expCtx;
+
+    size_t _stackDepth = 0;
+    size_t _maxStackDepth = 0;
+};
 }
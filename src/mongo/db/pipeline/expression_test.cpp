@@ -2167,6 +2167,102 @@ TEST(ExpressionConstantTest, ConstantOfValueMissingSerializesToRemoveSystemVar)
 
 }  // namespace Constant
 
+namespace Compiled {
+
+/**
+ * Parses and optimizes the expression given by the sole element of 'specObj', compiles it, and
+ * asserts that the compiled form evaluates over 'input' to the same result as tree-walking
+ * evaluation. Returns the compiled result.
+ */
+static Value evaluateCompiled(const BSONObj& specObj, const Document& input) {
+    intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    auto expression =
+        Expression::parseOperand(expCtx, specObj.firstElement(), expCtx->variablesParseState)
+            ->optimize();
+    Value compiledResult = CompiledExpression::compile(expression).evaluate(input);
+    ASSERT_VALUE_EQ(expression->evaluate(input), compiledResult);
+    return compiledResult;
+}
+
+TEST(CompiledExpressionTest, EvaluatesLogicArithmeticAndComparisonsLikeTreeEvaluation) {
+    const BSONObj spec = BSON(
+        "" << BSON("$cond" << BSON_ARRAY(
+                       BSON("$and" << BSON_ARRAY(BSON("$gte" << BSON_ARRAY("$a" << 0))
+                                                 << BSON("$lt" << BSON_ARRAY("$a" << 10))))
+                       << BSON("$add" << BSON_ARRAY("$a"
+                                                    << "$b"
+                                                    << 1))
+                       << BSON("$multiply" << BSON_ARRAY(
+                                   "$a" << BSON("$subtract" << BSON_ARRAY("$b" << 2)))))));
+
+    Value result = evaluateCompiled(spec, Document{{"a", 5}, {"b", 2}});
+    ASSERT_VALUE_EQ(Value(8), result);
+    ASSERT_EQUALS(NumberInt, result.getType());
+
+    result = evaluateCompiled(spec, Document{{"a", -3}, {"b", 5}});
+    ASSERT_VALUE_EQ(Value(-9), result);
+
+    // The arithmetic kernels are shared with the tree-walking evaluator, so the same numeric
+    // narrowing rules apply.
+    result = evaluateCompiled(spec, Document{{"a", 5.5}, {"b", 2}});
+    ASSERT_VALUE_EQ(Value(8.5), result);
+    ASSERT_EQUALS(NumberDouble, result.getType());
+}
+
+TEST(CompiledExpressionTest, ShortCircuitsOperandsTheTreeWouldNotEvaluate) {
+    // $divide is not understood by the compiler and would throw on a zero divisor, but none of
+    // these expressions may reach it.
+    ASSERT_VALUE_EQ(
+        Value(false),
+        evaluateCompiled(
+            BSON("" << BSON("$and" << BSON_ARRAY("$f" << BSON("$divide" << BSON_ARRAY(1
+                                                                                      << "$z"))))),
+            Document{{"f", false}, {"z", 0}}));
+    ASSERT_VALUE_EQ(
+        Value(true),
+        evaluateCompiled(
+            BSON("" << BSON("$or" << BSON_ARRAY("$t" << BSON("$divide" << BSON_ARRAY(1
+                                                                                     << "$z"))))),
+            Document{{"t", true}, {"z", 0}}));
+    ASSERT_VALUE_EQ(
+        Value(42),
+        evaluateCompiled(BSON("" << BSON("$cond" << BSON_ARRAY(
+                                             "$c" << 42 << BSON("$divide" << BSON_ARRAY(
+                                                                    1 << "$z"))))),
+                         Document{{"c", true}, {"z", 0}}));
+}
+
+TEST(CompiledExpressionTest, EvaluatesIfNullWithoutTouchingTheFallbackWhenNotNeeded) {
+    const BSONObj spec =
+        BSON("" << BSON("$ifNull" << BSON_ARRAY("$maybe" << BSON("$divide" << BSON_ARRAY(
+                                                                     1 << "$z")))));
+    ASSERT_VALUE_EQ(Value(7), evaluateCompiled(spec, Document{{"maybe", 7}, {"z", 0}}));
+    ASSERT_VALUE_EQ(Value(5),
+                    evaluateCompiled(BSON("" << BSON("$ifNull" << BSON_ARRAY("$maybe" << 5))),
+                                     Document{}));
+}
+
+TEST(CompiledExpressionTest, FallsBackToTreeEvaluationForUnsupportedOperators) {
+    const BSONObj spec = BSON(
+        "" << BSON("$cond" << BSON_ARRAY(BSON("$gt" << BSON_ARRAY("$a" << 0))
+                                         << BSON("$concat" << BSON_ARRAY("pos-"
+                                                                         << "$s"))
+                                         << "neg")));
+    ASSERT_VALUE_EQ(Value("pos-x"_sd), evaluateCompiled(spec, Document{{"a", 1}, {"s", "x"_sd}}));
+    ASSERT_VALUE_EQ(Value("neg"_sd), evaluateCompiled(spec, Document{{"a", -1}, {"s", "x"_sd}}));
+}
+
+TEST(CompiledExpressionTest, FieldPathsTraverseArraysLikeTreeEvaluation) {
+    const Document input{
+        BSON("a" << BSON_ARRAY(BSON("b" << 1) << BSON("b" << 2) << BSONObj()))};
+    ASSERT_VALUE_EQ(Value(BSON_ARRAY(1 << 2)),
+                    evaluateCompiled(BSON(""
+                                          << "$a.b"),
+                                     input));
+}
+
+}  // namespace Compiled
+
 TEST(ExpressionFromAccumulators, Avg) {
     assertExpectedResults("$avg",
                           {// $avg ignores non-numeric inputs.
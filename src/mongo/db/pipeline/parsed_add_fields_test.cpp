@@ -268,6 +268,20 @@ TEST(ParsedAddFieldsOptimize, ShouldOptimizeNestedExpressions) {
                        addition.serializeTransformation(ExplainOptions::Verbosity::kExecAllPlans));
 }
 
+// Verify that computed fields evaluate identically after optimize(), which switches evaluation
+// over to the compiled form of each expression.
+TEST(ParsedAddFieldsOptimize, ShouldApplyComputedFieldsAfterOptimize) {
+    boost::intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    ParsedAddFields addition(expCtx);
+    addition.parse(BSON("c" << BSON("$add" << BSON_ARRAY("$a"
+                                                         << "$b"))));
+    addition.optimize();
+
+    auto result = addition.applyProjection(Document{{"a", 1}, {"b", 2}});
+    auto expectedResult = Document{{"a", 1}, {"b", 2}, {"c", 3}};
+    ASSERT_DOCUMENT_EQ(result, expectedResult);
+}
+
 //
 // Top-level only.
 //
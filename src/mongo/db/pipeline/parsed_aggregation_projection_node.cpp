@@ -98,7 +98,9 @@ void ProjectionNode::applyProjections(const Document& inputDoc, MutableDocument*
     auto it = inputDoc.fieldIterator();
     while (it.more()) {
         auto fieldPair = it.next();
-        auto fieldName = fieldPair.first.toString();
+        // Both containers support heterogeneous lookup, so the field name never needs to be
+        // copied into a std::string here.
+        auto fieldName = fieldPair.first;
         if (_projectedFields.count(fieldName)) {
             outputProjectedField(
                 fieldName, applyLeafProjectionToValue(fieldPair.second), outputDoc);
@@ -157,9 +159,14 @@ void ProjectionNode::applyExpressions(const Document& root, MutableDocument* out
             outputDoc->setField(
                 field, childIt->second->applyExpressionsToValue(root, outputDoc->peek()[field]));
         } else {
-            auto expressionIt = _expressions.find(field);
-            invariant(expressionIt != _expressions.end());
-            outputDoc->setField(field, expressionIt->second->evaluate(root));
+            auto compiledIt = _compiledExpressions.find(field);
+            if (compiledIt != _compiledExpressions.end()) {
+                outputDoc->setField(field, compiledIt->second.evaluate(root));
+            } else {
+                auto expressionIt = _expressions.find(field);
+                invariant(expressionIt != _expressions.end());
+                outputDoc->setField(field, expressionIt->second->evaluate(root));
+            }
         }
     }
 }
@@ -228,6 +235,15 @@ void ProjectionNode::optimize() {
     for (auto&& expressionIt : _expressions) {
         _expressions[expressionIt.first] = expressionIt.second->optimize();
     }
+
+    // Lower each optimized expression into a compiled form, which evaluates iteratively instead of
+    // recursing through the Expression tree.
+    _compiledExpressions.clear();
+    for (auto&& expressionIt : _expressions) {
+        _compiledExpressions.emplace(expressionIt.first,
+                                     CompiledExpression::compile(expressionIt.second));
+    }
+
     for (auto&& childPair : _children) {
         childPair.second->optimize();
     }
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/parsed_aggregation_projection.h"
 
 namespace mongo {
@@ -141,12 +142,16 @@ protected:
     // Writes the given value to the output doc, replacing the existing value of 'field' if present.
     virtual void outputProjectedField(StringData field, Value val, MutableDocument* outDoc) const;
 
-    // TODO use StringMap once SERVER-23700 is resolved.
-    stdx::unordered_map<std::string, std::unique_ptr<ProjectionNode>> _children;
+    StringMap<std::unique_ptr<ProjectionNode>> _children;
     stdx::unordered_map<size_t, std::unique_ptr<ProjectionNode>> _arrayBranches;
 
     StringMap<boost::intrusive_ptr<Expression>> _expressions;
-    stdx::unordered_set<std::string> _projectedFields;
+
+    // Compiled forms of the entries in '_expressions', produced by optimize(). When a compiled
+    // form exists for a field it is preferred over walking the Expression tree.
+    StringMap<CompiledExpression> _compiledExpressions;
+
+    StringSet _projectedFields;
 
     ProjectionPolicies _policies;
 
@@ -462,6 +462,16 @@ boost::optional<Document> Pipeline::getNext() {
                               : boost::optional<Document>{nextResult.releaseDocument()};
 }
 
+bool Pipeline::getNextBatch(size_t maxDocs, std::vector<Document>* batch) {
+    invariant(!_sources.empty());
+    invariant(batch->empty());
+    auto status = DocumentSource::GetNextResult::ReturnStatus::kAdvanced;
+    while (batch->empty() && status != DocumentSource::GetNextResult::ReturnStatus::kEOF) {
+        status = _sources.back()->getNextBatch(maxDocs, batch);
+    }
+    return !batch->empty();
+}
+
 vector<Value> Pipeline::writeExplainOps(ExplainOptions::Verbosity verbosity) const {
     vector<Value> array;
     for (SourceContainer::const_iterator it = _sources.begin(); it != _sources.end(); ++it) {
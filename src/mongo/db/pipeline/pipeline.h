@@ -253,6 +253,13 @@ public:
      */
     boost::optional<Document> getNext();
 
+    /**
+     * Batched variant of getNext(). Fills 'batch', which must be empty, with up to 'maxDocs'
+     * results, blocking past any pauses in execution as getNext() does. Returns false if the
+     * pipeline is exhausted, in which case 'batch' is left empty.
+     */
+    bool getNextBatch(size_t maxDocs, std::vector<Document>* batch);
+
     /**
      * Write the pipeline's operators to a std::vector<Value>, providing the level of detail
      * specified by 'verbosity'.
@@ -83,13 +83,13 @@ void ValueStorage::verifyRefCountingIfShould() const {
         case RegEx:
         case Code:
         case Symbol:
+        case BinData:
             // the above types reference data when not using short-string optimization
             verify(refCounter == !shortStr);
             break;
 
         case NumberDecimal:
-        case BinData:  // TODO this should probably support short-string optimization
-        case Array:    // TODO this should probably support empty-is-NULL optimization
+        case Array:  // TODO this should probably support empty-is-NULL optimization
         case DBRef:
         case CodeWScope:
             // the above types always reference external data.
@@ -797,7 +797,8 @@ int Value::compare(const Value& rL,
                 return ret;
 
             // Need to compare as an unsigned char rather than enum since BSON uses memcmp
-            ret = cmp(rL._storage.binSubType, rR._storage.binSubType);
+            ret = cmp(static_cast<unsigned char>(rL._storage.binDataType()),
+                      static_cast<unsigned char>(rR._storage.binDataType()));
             if (ret)
                 return ret;
 
@@ -225,8 +225,18 @@ public:
     void putDocument(const Document& d);
     void putRegEx(const BSONRegEx& re);
     void putBinData(const BSONBinData& bd) {
-        putRefCountable(RCString::create(StringData(static_cast<const char*>(bd.data), bd.length)));
-        binSubType = bd.type;
+        if (static_cast<size_t>(bd.length) < sizeof(shortStrStorage)) {
+            // Small payloads are stored inline like short strings: the subtype byte followed by
+            // the data. BinData doesn't need a NUL terminator.
+            shortStr = true;
+            shortStrSize = bd.length;
+            shortStrStorage[0] = static_cast<char>(bd.type);
+            memcpy(shortStrStorage + 1, bd.data, bd.length);
+        } else {
+            putRefCountable(
+                RCString::create(StringData(static_cast<const char*>(bd.data), bd.length)));
+            binSubType = bd.type;
+        }
     }
 
     void putDBRef(const BSONDBRef& dbref) {
@@ -253,6 +263,10 @@ public:
 
     StringData getString() const {
         if (shortStr) {
+            if (bsonType() == BinData) {
+                // Inline BinData keeps its subtype byte in front of the data.
+                return StringData(shortStrStorage + 1, shortStrSize);
+            }
             return StringData(shortStrStorage, shortStrSize);
         } else {
             dassert(typeid(*genericRCPtr) == typeid(const RCString));
@@ -292,6 +306,8 @@ public:
 
     BinDataType binDataType() const {
         dassert(type == BinData);
+        if (shortStr)
+            return BinDataType(static_cast<unsigned char>(shortStrStorage[0]));
         return BinDataType(binSubType);
     }
 
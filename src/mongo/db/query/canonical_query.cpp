@@ -289,6 +289,42 @@ bool CanonicalQuery::isSimpleIdQuery(const BSONObj& query) {
     return hasID;
 }
 
+// static
+bool CanonicalQuery::isSimpleIdInQuery(const BSONObj& query) {
+    if (query.nFields() != 1) {
+        return false;
+    }
+
+    BSONElement elt = query.firstElement();
+    if (!str::equals("_id", elt.fieldName()) || elt.type() != Object) {
+        return false;
+    }
+
+    const BSONObj idPred = elt.Obj();
+    if (idPred.nFields() != 1 || !str::equals("$in", idPred.firstElementFieldName())) {
+        return false;
+    }
+
+    BSONElement inElt = idPred.firstElement();
+    if (inElt.type() != Array) {
+        return false;
+    }
+
+    // Every value must be usable as an exact index key, mirroring the per-value restrictions of
+    // isSimpleIdQuery().
+    for (auto&& value : inElt.Obj()) {
+        if (value.type() == Object) {
+            if (value.Obj().firstElementFieldName()[0] == '$') {
+                return false;
+            }
+        } else if (!Indexability::isExactBoundsGenerating(value)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 // static
 void CanonicalQuery::sortTree(MatchExpression* tree) {
     for (size_t i = 0; i < tree->numChildren(); ++i) {
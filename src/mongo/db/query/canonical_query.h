@@ -102,6 +102,12 @@ public:
      */
     static bool isSimpleIdQuery(const BSONObj& query);
 
+    /**
+     * Returns true if "query" is a $in on _id whose values are all exact-match, i.e. a batch of
+     * point reads.
+     */
+    static bool isSimpleIdInQuery(const BSONObj& query);
+
     const NamespaceString& nss() const {
         return _qr->nss();
     }
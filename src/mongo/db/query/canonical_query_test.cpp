@@ -391,5 +391,24 @@ TEST(CanonicalQueryTest, NorWithOneChildNormalizedAfterNormalizingChild) {
     ASSERT_EQ(MatchExpression::EQ, root->getChild(0)->matchType());
 }
 
+TEST(CanonicalQueryTest, IsSimpleIdInQueryAcceptsExactMatchValues) {
+    ASSERT_TRUE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: [1, 2, 3]}}")));
+    ASSERT_TRUE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: ['a', {b: 1}]}}")));
+    ASSERT_TRUE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: []}}")));
+}
+
+TEST(CanonicalQueryTest, IsSimpleIdInQueryRejectsNonPointReads) {
+    // Not a lone $in on _id.
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: 1}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{a: {$in: [1]}}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: [1]}, a: 1}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: [1], $gt: 0}}")));
+    // Values which do not generate exact index bounds.
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: [1, null]}}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: [[1, 2]]}}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: [1, {$gt: 0}]}}")));
+    ASSERT_FALSE(CanonicalQuery::isSimpleIdInQuery(fromjson("{_id: {$in: [/a/]}}")));
+}
+
 }  // namespace
 }  // namespace mongo
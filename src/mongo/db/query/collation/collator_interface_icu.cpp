@@ -33,7 +33,6 @@
 #include "mongo/db/query/collation/collator_interface_icu.h"
 
 #include <unicode/coll.h>
-#include <unicode/sortkey.h>
 
 #include "mongo/stdx/memory.h"
 #include "mongo/util/assert_util.h"
@@ -77,20 +76,28 @@ CollatorInterface::ComparisonKey CollatorInterfaceICU::getComparisonKey(
     StringData stringData) const {
     // A StringPiece is ICU's StringData. They are logically the same abstraction.
     const icu::StringPiece stringPiece(stringData.rawData(), stringData.size());
-
-    UErrorCode status = U_ZERO_ERROR;
-    icu::CollationKey icuKey;
-    _collator->getCollationKey(icu::UnicodeString::fromUTF8(stringPiece), icuKey, status);
-
-    // Any sequence of bytes, even invalid UTF-8, has defined comparison behavior in ICU (invalid
-    // subsequences are weighted as the replacement character, U+FFFD). A non-ok error code is only
-    // expected when a memory allocation fails inside ICU, which we consider fatal to the process.
-    fassert(34439, U_SUCCESS(status));
-
-    int32_t keyLength;
-    const uint8_t* keyBuffer = icuKey.getByteArray(keyLength);
-    invariant(keyLength > 0);
-    invariant(keyBuffer);
+    const icu::UnicodeString icuString = icu::UnicodeString::fromUTF8(stringPiece);
+
+    // Generate the sort key directly into a stack buffer rather than through icu::CollationKey,
+    // which heap-allocates its byte array. This is a hot path for index maintenance and sorts on
+    // collated collections, where a comparison key is generated once per indexed string. Sort keys
+    // are typically within a small constant factor of the input size, so most keys fit on the
+    // stack; getSortKey() reports the required length, and we retry on the heap for the rest.
+    uint8_t stackBuffer[256];
+    int32_t keyLength = _collator->getSortKey(icuString, stackBuffer, sizeof(stackBuffer));
+
+    // A zero length indicates an internal error in ICU, which should only be possible when a
+    // memory allocation fails inside ICU. We consider that fatal to the process.
+    fassert(34439, keyLength > 0);
+
+    const uint8_t* keyBuffer = stackBuffer;
+    std::unique_ptr<uint8_t[]> heapBuffer;
+    if (static_cast<size_t>(keyLength) > sizeof(stackBuffer)) {
+        heapBuffer = stdx::make_unique<uint8_t[]>(keyLength);
+        const int32_t retryLength = _collator->getSortKey(icuString, heapBuffer.get(), keyLength);
+        invariant(retryLength == keyLength);
+        keyBuffer = heapBuffer.get();
+    }
 
     // The last byte of the sort key should always be null. When we construct the comparison key, we
     // omit the trailing null byte.
@@ -288,6 +288,29 @@ TEST(CollatorInterfaceICUTest, LengthOneStringWithNullByteComparesCorrectlyUsing
     ASSERT_GT(comparisonKeyABC.getKeyData().compare(nullByteKey.getKeyData()), 0);
 }
 
+TEST(CollatorInterfaceICUTest, LongStringsCompareCorrectlyUsingComparisonKeys) {
+    CollationSpec collationSpec;
+    collationSpec.localeID = "en_US";
+
+    UErrorCode status = U_ZERO_ERROR;
+    std::unique_ptr<icu::Collator> coll(
+        icu::Collator::createInstance(icu::Locale("en", "US"), status));
+    ASSERT(U_SUCCESS(status));
+
+    // Use strings long enough that their sort keys cannot fit in the stack buffer used by
+    // getComparisonKey(), exercising the heap-allocated retry path.
+    const std::string longA(4096, 'a');
+    const std::string longB = longA.substr(0, longA.size() - 1u) + "b";
+
+    CollatorInterfaceICU icuCollator(collationSpec, std::move(coll));
+    auto keyA = icuCollator.getComparisonKey(longA);
+    auto keyB = icuCollator.getComparisonKey(longB);
+    ASSERT_GT(keyA.getKeyData().size(), 1024u);
+    ASSERT_EQ(keyA.getKeyData().compare(keyA.getKeyData()), 0);
+    ASSERT_LT(keyA.getKeyData().compare(keyB.getKeyData()), 0);
+    ASSERT_GT(keyB.getKeyData().compare(keyA.getKeyData()), 0);
+}
+
 TEST(CollatorInterfaceICUTest, StringsWithEmbeddedNullByteCompareCorrectly) {
     CollationSpec collationSpec;
     collationSpec.localeID = "en_US";
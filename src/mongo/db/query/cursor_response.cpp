@@ -96,6 +96,7 @@ void CursorResponseBuilder::abandon() {
     _batch.reset();
     _cursorObject.reset();
     _bodyBuilder.reset();
+    _docSeqBuilder.reset();  // Must be destroyed before the reply builder is reset.
     _replyBuilder->reset();
     _numDocs = 0;
     _active = false;
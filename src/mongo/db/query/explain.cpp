@@ -327,6 +327,10 @@ void Explain::statsToBSON(const PlanStageStats& stats,
     if (verbosity >= ExplainOptions::Verbosity::kExecStats) {
         bob->appendNumber("nReturned", stats.common.advanced);
         bob->appendNumber("executionTimeMillisEstimate", stats.common.executionTimeMillis);
+        if (stats.common.worksSampled > 0) {
+            bob->appendNumber("executionTimeMicrosSampled", stats.common.executionTimeMicros);
+            bob->appendNumber("worksSampled", stats.common.worksSampled);
+        }
         bob->appendNumber("works", stats.common.works);
         bob->appendNumber("advanced", stats.common.advanced);
         bob->appendNumber("needTime", stats.common.needTime);
@@ -87,6 +87,13 @@ bool shouldSaveCursor(OperationContext* opCtx,
         return false;
     }
 
+    // An executor built by the idhack fast path has no CanonicalQuery. Such an executor returns
+    // at most one document, never admits a tailable request and always reaches EOF within the
+    // first batch, so there is never a cursor to save.
+    if (!exec->getCanonicalQuery()) {
+        return !exec->isEOF();
+    }
+
     const QueryRequest& qr = exec->getCanonicalQuery()->getQueryRequest();
     if (!qr.wantMore()) {
         return false;
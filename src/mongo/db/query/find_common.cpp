@@ -32,13 +32,25 @@
 
 #include "mongo/db/query/find_common.h"
 
+#include <algorithm>
+
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/query/query_request.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/util/assert_util.h"
 
 namespace mongo {
 
+// When enabled, getMore sizes each batch from the rate at which the client drained the previous
+// one, instead of always filling up to the response cap. See
+// FindCommon::adaptiveBatchByteTarget().
+MONGO_EXPORT_SERVER_PARAMETER(adaptiveGetMoreBatchSize, bool, false);
+
+// The time, in milliseconds, a client should take to drain an adaptively sized batch and come
+// back for the next one.
+MONGO_EXPORT_SERVER_PARAMETER(adaptiveGetMoreTargetMillis, int, 100);
+
 MONGO_FAIL_POINT_DEFINE(waitInFindBeforeMakingBatch);
 
 MONGO_FAIL_POINT_DEFINE(disableAwaitDataForGetMoreCmd);
@@ -59,7 +71,10 @@ bool FindCommon::enoughForFirstBatch(const QueryRequest& qr, long long numDocs)
     return numDocs >= qr.getEffectiveBatchSize().value();
 }
 
-bool FindCommon::haveSpaceForNext(const BSONObj& nextDoc, long long numDocs, int bytesBuffered) {
+bool FindCommon::haveSpaceForNext(const BSONObj& nextDoc,
+                                  long long numDocs,
+                                  int bytesBuffered,
+                                  int byteLimit) {
     invariant(numDocs >= 0);
     if (!numDocs) {
         // Allow the first output document to exceed the limit to ensure we can always make
@@ -67,7 +82,24 @@ bool FindCommon::haveSpaceForNext(const BSONObj& nextDoc, long long numDocs, int
         return true;
     }
 
-    return (bytesBuffered + nextDoc.objsize()) <= kMaxBytesToReturnToClientAtOnce;
+    return (bytesBuffered + nextDoc.objsize()) <= byteLimit;
+}
+
+bool FindCommon::adaptiveBatchSizeEnabled() {
+    return adaptiveGetMoreBatchSize.load();
+}
+
+int FindCommon::adaptiveBatchByteTarget(long long prevBatchBytes, Milliseconds drainInterval) {
+    // The client drained the previous batch at roughly prevBatchBytes / drainInterval. Size the
+    // next batch so draining it takes about the target time: fast consumers on fast links get
+    // bigger batches and fewer round trips, while slow consumers get batches that don't sit in
+    // socket buffers. The interval observed by the server includes the network round trip, so
+    // high-latency links converge to larger batches automatically.
+    const long long targetMillis = std::max(1, adaptiveGetMoreTargetMillis.load());
+    const long long intervalMillis = std::max(1LL, durationCount<Milliseconds>(drainInterval));
+    const long long target = prevBatchBytes * targetMillis / intervalMillis;
+    return static_cast<int>(std::max<long long>(
+        kInitReplyBufferSize, std::min<long long>(target, kMaxBytesToReturnToClientAtOnce)));
 }
 
 BSONObj FindCommon::transformSortSpec(const BSONObj& sortSpec) {
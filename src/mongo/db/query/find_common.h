@@ -108,9 +108,28 @@ public:
     /**
      * Given the number of docs ('numDocs') and bytes ('bytesBuffered') currently buffered as a
      * response to a cursor-generating command, returns true if there are enough remaining bytes in
-     * our budget to fit 'nextDoc'.
+     * our budget to fit 'nextDoc'. The budget defaults to the 16MB response cap but may be lowered
+     * by adaptive batch sizing; see adaptiveBatchByteTarget().
      */
-    static bool haveSpaceForNext(const BSONObj& nextDoc, long long numDocs, int bytesBuffered);
+    static bool haveSpaceForNext(const BSONObj& nextDoc,
+                                 long long numDocs,
+                                 int bytesBuffered,
+                                 int byteLimit = kMaxBytesToReturnToClientAtOnce);
+
+    /**
+     * Returns true if the 'adaptiveGetMoreBatchSize' server parameter is set, i.e. getMore should
+     * size batches from the observed client drain rate rather than always filling up to the
+     * response cap.
+     */
+    static bool adaptiveBatchSizeEnabled();
+
+    /**
+     * Returns the byte budget for a cursor's next getMore batch, given the size of the previous
+     * batch and how long the client took to drain it and come back (which includes the network
+     * round trip). The budget aims for the previous drain rate sustained over the configured
+     * target drain time and is clamped to [kInitReplyBufferSize, kMaxBytesToReturnToClientAtOnce].
+     */
+    static int adaptiveBatchByteTarget(long long prevBatchBytes, Milliseconds drainInterval);
 
     /**
      * Transforms the raw sort spec into one suitable for use as the ordering specification in
@@ -448,14 +448,18 @@ StatusWith<PrepareExecutionResult> prepareExecution(OperationContext* opCtx,
                 // Add a CachedPlanStage on top of the previous root.
                 //
                 // 'decisionWorks' is used to determine whether the existing cache entry should
-                // be evicted, and the query replanned.
+                // be evicted, and the query replanned. The CachedSolution is handed over so that
+                // replanning can first race the cached plan against the runner-up candidate
+                // recorded in the cache entry.
+                const size_t decisionWorks = cs->decisionWorks;
                 root = make_unique<CachedPlanStage>(opCtx,
                                                     collection,
                                                     ws,
                                                     canonicalQuery.get(),
                                                     plannerParams,
-                                                    cs->decisionWorks,
-                                                    rawRoot);
+                                                    decisionWorks,
+                                                    rawRoot,
+                                                    std::move(cs));
                 return PrepareExecutionResult(
                     std::move(canonicalQuery), std::move(querySolution), std::move(root));
             }
@@ -736,6 +740,70 @@ StatusWith<unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutorFind(
         opCtx, collection, nss, std::move(canonicalQuery), yieldPolicy, plannerOptions);
 }
 
+std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> attemptToGetIdHackExecutor(
+    OperationContext* opCtx,
+    Collection* collection,
+    const NamespaceString& nss,
+    const QueryRequest& queryRequest) {
+    if (!collection) {
+        return nullptr;
+    }
+
+    // The fast path produces a bare IDHACK plan, so any option which would demand another stage
+    // or change the result set sends the query down the regular path. A batchSize of zero asks
+    // for an empty first batch and a saved cursor, so such requests stay on the regular path as
+    // well and the executor built here always reaches EOF within the first batch.
+    if (!CanonicalQuery::isSimpleIdQuery(queryRequest.getFilter()) ||
+        !queryRequest.getProj().isEmpty() || !queryRequest.getSort().isEmpty() ||
+        !queryRequest.getHint().isEmpty() || !queryRequest.getMin().isEmpty() ||
+        !queryRequest.getMax().isEmpty() || queryRequest.getSkip() ||
+        queryRequest.getNToReturn() || queryRequest.returnKey() || queryRequest.showRecordId() ||
+        queryRequest.isTailable() || queryRequest.isOplogReplay() ||
+        (queryRequest.getBatchSize() && *queryRequest.getBatchSize() == 0)) {
+        return nullptr;
+    }
+
+    const IndexDescriptor* descriptor = collection->getIndexCatalog()->findIdIndex(opCtx);
+    if (!descriptor) {
+        return nullptr;
+    }
+
+    // Without a CanonicalQuery there is nothing to attach a collator to, so the query must use
+    // the collection default collation.
+    if (!queryRequest.getCollation().isEmpty()) {
+        auto statusWithCollator = CollatorFactoryInterface::get(opCtx->getServiceContext())
+                                      ->makeFromBSON(queryRequest.getCollation());
+        if (!statusWithCollator.isOK() ||
+            !CollatorInterface::collatorsMatch(statusWithCollator.getValue().get(),
+                                               collection->getDefaultCollator())) {
+            return nullptr;
+        }
+    }
+
+    LOG(2) << "Using idhack: " << redact(queryRequest.getFilter());
+
+    auto ws = make_unique<WorkingSet>();
+    std::unique_ptr<PlanStage> root = make_unique<IDHackStage>(
+        opCtx, queryRequest.getFilter()["_id"].wrap(), ws.get(), descriptor);
+
+    // Might have to filter out orphaned docs.
+    if (ShardingState::get(opCtx)->needCollectionMetadata(opCtx, nss.ns())) {
+        root = make_unique<ShardFilterStage>(
+            opCtx,
+            CollectionShardingState::get(opCtx, nss)->getMetadataForOperation(opCtx),
+            ws.get(),
+            root.release());
+    }
+
+    auto readConcernArgs = repl::ReadConcernArgs::get(opCtx);
+    const auto yieldPolicy =
+        readConcernArgs.getLevel() == repl::ReadConcernLevel::kSnapshotReadConcern
+        ? PlanExecutor::INTERRUPT_ONLY
+        : PlanExecutor::YIELD_AUTO;
+    return uassertStatusOK(
+        PlanExecutor::make(opCtx, std::move(ws), std::move(root), collection, yieldPolicy));
+}
+
 StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutorLegacyFind(
     OperationContext* opCtx,
     Collection* collection,
@@ -124,6 +124,26 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutorFind
     std::unique_ptr<CanonicalQuery> canonicalQuery,
     size_t plannerOptions = QueryPlannerParams::DEFAULT);
 
+/**
+ * Attempts to build an IDHACK plan executor for a find described by 'queryRequest' straight from
+ * the unparsed request, skipping the work of creating a CanonicalQuery and consulting the
+ * planner. This is the find analogue of the idhack fast paths in getExecutorDelete() and
+ * getExecutorUpdate().
+ *
+ * Returns nullptr if the request is not eligible (not a simple _id equality, or it carries any
+ * option which would require another stage or a different result set); the caller then proceeds
+ * with canonicalization and getExecutorFind(). Throws on unexpected errors such as failure to
+ * register the executor.
+ *
+ * Note that the resulting executor has no CanonicalQuery, so callers that save it in a
+ * ClientCursor must not rely on PlanExecutor::getCanonicalQuery().
+ */
+std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> attemptToGetIdHackExecutor(
+    OperationContext* opCtx,
+    Collection* collection,
+    const NamespaceString& nss,
+    const QueryRequest& queryRequest);
+
 /**
  * Returns a plan executor for a legacy OP_QUERY find.
  */
@@ -52,25 +52,28 @@ const char kBatchSizeField[] = "batchSize";
 const char kAwaitDataTimeoutField[] = "maxTimeMS";
 const char kTermField[] = "term";
 const char kLastKnownCommittedOpTimeField[] = "lastKnownCommittedOpTime";
+const char kAllowDocumentSequencesField[] = "allowDocumentSequences";
 
 }  // namespace
 
 const char GetMoreRequest::kGetMoreCommandName[] = "getMore";
 
-GetMoreRequest::GetMoreRequest() : cursorid(0), batchSize(0) {}
+GetMoreRequest::GetMoreRequest() : cursorid(0), batchSize(0), allowDocumentSequences(false) {}
 
 GetMoreRequest::GetMoreRequest(NamespaceString namespaceString,
                                CursorId id,
                                boost::optional<std::int64_t> sizeOfBatch,
                                boost::optional<Milliseconds> awaitDataTimeout,
                                boost::optional<long long> term,
-                               boost::optional<repl::OpTime> lastKnownCommittedOpTime)
+                               boost::optional<repl::OpTime> lastKnownCommittedOpTime,
+                               bool allowDocumentSequences)
     : nss(std::move(namespaceString)),
       cursorid(id),
       batchSize(sizeOfBatch),
       awaitDataTimeout(awaitDataTimeout),
       term(term),
-      lastKnownCommittedOpTime(lastKnownCommittedOpTime) {}
+      lastKnownCommittedOpTime(lastKnownCommittedOpTime),
+      allowDocumentSequences(allowDocumentSequences) {}
 
 Status GetMoreRequest::isValid() const {
     if (!nss.isValid()) {
@@ -104,6 +107,7 @@ StatusWith<GetMoreRequest> GetMoreRequest::parseFromBSON(const std::string& dbna
     boost::optional<Milliseconds> awaitDataTimeout;
     boost::optional<long long> term;
     boost::optional<repl::OpTime> lastKnownCommittedOpTime;
+    bool allowDocumentSequences = false;
 
     for (BSONElement el : cmdObj) {
         const auto fieldName = el.fieldNameStringData();
@@ -146,6 +150,13 @@ StatusWith<GetMoreRequest> GetMoreRequest::parseFromBSON(const std::string& dbna
                         str::stream() << "Field 'term' must be of type NumberLong in: " << cmdObj};
             }
             term = el.Long();
+        } else if (fieldName == kAllowDocumentSequencesField) {
+            if (el.type() != BSONType::Bool) {
+                return {ErrorCodes::TypeMismatch,
+                        str::stream() << "Field 'allowDocumentSequences' must be of type bool in: "
+                                      << cmdObj};
+            }
+            allowDocumentSequences = el.Bool();
         } else if (fieldName == kLastKnownCommittedOpTimeField) {
             repl::OpTime ot;
             Status status = bsonExtractOpTimeField(el.wrap(), kLastKnownCommittedOpTimeField, &ot);
@@ -172,8 +183,13 @@ StatusWith<GetMoreRequest> GetMoreRequest::parseFromBSON(const std::string& dbna
                 str::stream() << "Field 'collection' missing in: " << cmdObj};
     }
 
-    GetMoreRequest request(
-        std::move(*nss), *cursorid, batchSize, awaitDataTimeout, term, lastKnownCommittedOpTime);
+    GetMoreRequest request(std::move(*nss),
+                           *cursorid,
+                           batchSize,
+                           awaitDataTimeout,
+                           term,
+                           lastKnownCommittedOpTime,
+                           allowDocumentSequences);
     Status validStatus = request.isValid();
     if (!validStatus.isOK()) {
         return validStatus;
@@ -204,6 +220,10 @@ BSONObj GetMoreRequest::toBSON() const {
         lastKnownCommittedOpTime->append(&builder, kLastKnownCommittedOpTimeField);
     }
 
+    if (allowDocumentSequences) {
+        builder.append(kAllowDocumentSequencesField, true);
+    }
+
     return builder.obj();
 }
 
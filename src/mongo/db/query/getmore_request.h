@@ -57,7 +57,8 @@ struct GetMoreRequest {
                    boost::optional<std::int64_t> sizeOfBatch,
                    boost::optional<Milliseconds> awaitDataTimeout,
                    boost::optional<long long> term,
-                   boost::optional<repl::OpTime> lastKnownCommittedOpTime);
+                   boost::optional<repl::OpTime> lastKnownCommittedOpTime,
+                   bool allowDocumentSequences = false);
 
     /**
      * Construct a GetMoreRequest from the command specification and db name.
@@ -87,6 +88,10 @@ struct GetMoreRequest {
     // Only internal queries from replication will have a last known committed optime.
     const boost::optional<repl::OpTime> lastKnownCommittedOpTime;
 
+    // True if the client has advertised that it can consume the result batch as an OP_MSG
+    // document sequence instead of a BSON array embedded in the reply body.
+    const bool allowDocumentSequences;
+
 private:
     /**
      * Returns a non-OK status if there are semantic errors in the parsed request
@@ -211,6 +211,29 @@ TEST(GetMoreRequestTest, parseFromBSONHasMaxTimeMSOfZero) {
     ASSERT(!result.getValue().awaitDataTimeout);
 }
 
+TEST(GetMoreRequestTest, parseFromBSONHasAllowDocumentSequences) {
+    StatusWith<GetMoreRequest> result =
+        GetMoreRequest::parseFromBSON("db",
+                                      BSON("getMore" << CursorId(123) << "collection"
+                                                     << "coll"
+                                                     << "allowDocumentSequences"
+                                                     << true));
+    ASSERT_OK(result.getStatus());
+    ASSERT_EQUALS(CursorId(123), result.getValue().cursorid);
+    ASSERT_TRUE(result.getValue().allowDocumentSequences);
+}
+
+TEST(GetMoreRequestTest, parseFromBSONAllowDocumentSequencesWrongType) {
+    StatusWith<GetMoreRequest> result =
+        GetMoreRequest::parseFromBSON("db",
+                                      BSON("getMore" << CursorId(123) << "collection"
+                                                     << "coll"
+                                                     << "allowDocumentSequences"
+                                                     << 1));
+    ASSERT_NOT_OK(result.getStatus());
+    ASSERT_EQUALS(ErrorCodes::TypeMismatch, result.getStatus().code());
+}
+
 TEST(GetMoreRequestTest, toBSONHasBatchSize) {
     GetMoreRequest request(
         NamespaceString("testdb.testcoll"), 123, 99, boost::none, boost::none, boost::none);
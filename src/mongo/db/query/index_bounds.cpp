@@ -579,20 +579,19 @@ IndexBoundsChecker::KeyState IndexBoundsChecker::checkKey(const BSONObj& key, In
     out->keySuffix.resize(_curInterval.size());
     out->suffixInclusive.resize(_curInterval.size());
 
-    // It's useful later to go from a field number to the value for that field.  Store these.
-    // TODO: on optimization pass, populate the vector as-needed and keep the vector around as a
-    // member variable
-    vector<BSONElement> keyValues;
+    // It's useful later to go from a field number to the value for that field.  Store these in a
+    // member vector so checking a key doesn't allocate.
+    _keyValues.clear();
     BSONObjIterator keyIt(key);
     while (keyIt.more()) {
-        keyValues.push_back(keyIt.next());
+        _keyValues.push_back(keyIt.next());
     }
-    verify(keyValues.size() == _curInterval.size());
+    verify(_keyValues.size() == _curInterval.size());
 
     size_t firstNonContainedField;
     Location orientation;
 
-    if (!findLeftmostProblem(keyValues, &firstNonContainedField, &orientation)) {
+    if (!findLeftmostProblem(_keyValues, &firstNonContainedField, &orientation)) {
         // All fields in the index are within the current interval.  Caller can use the key.
         return VALID;
     }
@@ -608,7 +607,7 @@ IndexBoundsChecker::KeyState IndexBoundsChecker::checkKey(const BSONObj& key, In
         // ...and try again.  This call modifies 'orientation', so we may check its value again
         // in the clause below if field number 'firstNonContainedField' isn't in its first
         // interval.
-        if (!findLeftmostProblem(keyValues, &firstNonContainedField, &orientation)) {
+        if (!findLeftmostProblem(_keyValues, &firstNonContainedField, &orientation)) {
             return VALID;
         }
     }
@@ -638,7 +637,7 @@ IndexBoundsChecker::KeyState IndexBoundsChecker::checkKey(const BSONObj& key, In
         // Find the interval that contains our field.
         size_t newIntervalForField;
 
-        Location where = findIntervalForField(keyValues[firstNonContainedField],
+        Location where = findIntervalForField(_keyValues[firstNonContainedField],
                                               _bounds->fields[firstNonContainedField],
                                               _expectedDirection[firstNonContainedField],
                                               &newIntervalForField);
@@ -678,7 +677,7 @@ IndexBoundsChecker::KeyState IndexBoundsChecker::checkKey(const BSONObj& key, In
 
             // If all fields to the left have hit the end of their intervals, we can't ask them
             // to move forward and we should stop iterating.
-            if (!spaceLeftToAdvance(firstNonContainedField, keyValues)) {
+            if (!spaceLeftToAdvance(firstNonContainedField, _keyValues)) {
                 return DONE;
             }
 
@@ -293,6 +293,10 @@ private:
     // For each field, which interval are we currently in?
     std::vector<size_t> _curInterval;
 
+    // Scratch space for checkKey(), kept as a member so the per-key checks don't allocate.
+    // Holds the elements of the key most recently checked.
+    std::vector<BSONElement> _keyValues;
+
     // Direction of scan * direction of indexing.
     std::vector<int> _expectedDirection;
 };
@@ -37,6 +37,7 @@
 #include <boost/iterator/transform_iterator.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <math.h>
 #include <memory>
 #include <vector>
@@ -237,10 +238,28 @@ PlanCacheEntry* PlanCacheEntry::clone() const {
 
     // Copy performance stats.
     entry->feedback = feedback;
+    entry->estimatedEntrySizeBytes = estimatedEntrySizeBytes;
 
     return entry;
 }
 
+size_t PlanCacheEntry::estimateObjectSizeInBytes() const {
+    size_t size = sizeof(*this);
+    for (size_t i = 0; i < plannerData.size(); ++i) {
+        size += plannerData[i]->estimateObjectSizeInBytes();
+    }
+    size += static_cast<size_t>(query.objsize()) + static_cast<size_t>(sort.objsize()) +
+        static_cast<size_t>(projection.objsize()) + static_cast<size_t>(collation.objsize());
+    // The ranking decision's per-candidate stats trees are not walked; the cached index trees and
+    // the example query shape above dominate the footprint of an entry.
+    if (decision) {
+        size += sizeof(PlanRankingDecision) + decision->scores.size() * sizeof(double) +
+            decision->candidateOrder.size() * sizeof(size_t);
+    }
+    size += feedback.capacity() * sizeof(double);
+    return size;
+}
+
 std::string PlanCacheEntry::toString() const {
     return str::stream() << "(query: " << query.toString() << ";sort: " << sort.toString()
                          << ";projection: " << projection.toString()
@@ -279,6 +298,23 @@ PlanCacheIndexTree* PlanCacheIndexTree::clone() const {
     return root;
 }
 
+size_t PlanCacheIndexTree::estimateObjectSizeInBytes() const {
+    size_t size = sizeof(*this);
+    if (entry) {
+        size += sizeof(IndexEntry) + static_cast<size_t>(entry->keyPattern.objsize()) +
+            static_cast<size_t>(entry->infoObj.objsize());
+    }
+    for (const auto& orPushdown : orPushdowns) {
+        size += sizeof(OrPushdown) + orPushdown.route.size() * sizeof(size_t);
+    }
+    for (std::vector<PlanCacheIndexTree*>::const_iterator it = children.begin();
+         it != children.end();
+         ++it) {
+        size += (*it)->estimateObjectSizeInBytes();
+    }
+    return size;
+}
+
 std::string PlanCacheIndexTree::toString(int indents) const {
     StringBuilder result;
     if (!children.empty()) {
@@ -348,6 +384,250 @@ std::string SolutionCacheData::toString() const {
     MONGO_UNREACHABLE;
 }
 
+size_t SolutionCacheData::estimateObjectSizeInBytes() const {
+    size_t size = sizeof(*this);
+    if (tree) {
+        size += tree->estimateObjectSizeInBytes();
+    }
+    return size;
+}
+
+//
+// SolutionCacheData serialization
+//
+
+namespace {
+
+constexpr char kScdSolnTypeCollscan[] = "collscan";
+constexpr char kScdSolnTypeWholeIxscan[] = "wholeIxscan";
+constexpr char kScdSolnTypeIndexTags[] = "indexTags";
+
+void indexTreeToBSON(const PlanCacheIndexTree& tree, BSONObjBuilder* bob) {
+    if (tree.entry) {
+        bob->append("indexName", tree.entry->identifier.catalogName);
+        bob->append("indexDisambiguator", tree.entry->identifier.disambiguator);
+        bob->appendNumber("indexPos", static_cast<long long>(tree.index_pos));
+    }
+    bob->appendBool("canCombineBounds", tree.canCombineBounds);
+
+    if (!tree.orPushdowns.empty()) {
+        BSONArrayBuilder orPushdownsBab(bob->subarrayStart("orPushdowns"));
+        for (const auto& orPushdown : tree.orPushdowns) {
+            BSONObjBuilder orPushdownBob(orPushdownsBab.subobjStart());
+            orPushdownBob.append("indexName", orPushdown.indexEntryId.catalogName);
+            orPushdownBob.append("indexDisambiguator", orPushdown.indexEntryId.disambiguator);
+            orPushdownBob.appendNumber("position", static_cast<long long>(orPushdown.position));
+            orPushdownBob.appendBool("canCombineBounds", orPushdown.canCombineBounds);
+            BSONArrayBuilder routeBab(orPushdownBob.subarrayStart("route"));
+            for (auto step : orPushdown.route) {
+                routeBab.append(static_cast<long long>(step));
+            }
+        }
+    }
+
+    if (!tree.children.empty()) {
+        BSONArrayBuilder childrenBab(bob->subarrayStart("children"));
+        for (const auto* child : tree.children) {
+            BSONObjBuilder childBob(childrenBab.subobjStart());
+            indexTreeToBSON(*child, &childBob);
+        }
+    }
+}
+
+/**
+ * Finds the entry in 'indexes' matching the identifier stored in 'obj' under 'nameField' and
+ * 'disambiguatorField'. Returns NoSuchKey if the index no longer exists, which callers must
+ * treat as a stale cache entry.
+ */
+StatusWith<const IndexEntry*> resolveIndexEntry(const BSONObj& obj,
+                                                StringData nameField,
+                                                StringData disambiguatorField,
+                                                const std::vector<IndexEntry>& indexes) {
+    BSONElement nameElt = obj[nameField];
+    BSONElement disambiguatorElt = obj[disambiguatorField];
+    if (nameElt.type() != String || disambiguatorElt.type() != String) {
+        return Status(ErrorCodes::BadValue,
+                      str::stream() << "malformed index identifier in cached plan: " << obj);
+    }
+
+    IndexEntry::Identifier identifier(nameElt.str(), disambiguatorElt.str());
+    for (const auto& index : indexes) {
+        if (index.identifier == identifier) {
+            return &index;
+        }
+    }
+    return Status(ErrorCodes::NoSuchKey,
+                  str::stream() << "index " << identifier.toString()
+                                << " referenced by cached plan no longer exists");
+}
+
+StatusWith<std::unique_ptr<PlanCacheIndexTree>> indexTreeFromBSON(
+    const BSONObj& obj, const std::vector<IndexEntry>& indexes) {
+    auto tree = stdx::make_unique<PlanCacheIndexTree>();
+
+    if (obj.hasField("indexName")) {
+        auto entryRes = resolveIndexEntry(obj, "indexName", "indexDisambiguator", indexes);
+        if (!entryRes.isOK()) {
+            return entryRes.getStatus();
+        }
+        tree->setIndexEntry(*entryRes.getValue());
+
+        BSONElement posElt = obj["indexPos"];
+        if (!posElt.isNumber() || posElt.numberLong() < 0) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream() << "malformed index position in cached plan: " << obj);
+        }
+        tree->index_pos = static_cast<size_t>(posElt.numberLong());
+    }
+
+    BSONElement canCombineElt = obj["canCombineBounds"];
+    if (canCombineElt.type() != Bool) {
+        return Status(ErrorCodes::BadValue,
+                      str::stream() << "malformed cached index tree node: " << obj);
+    }
+    tree->canCombineBounds = canCombineElt.boolean();
+
+    if (BSONElement orPushdownsElt = obj["orPushdowns"]) {
+        if (orPushdownsElt.type() != Array) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream() << "malformed orPushdowns in cached plan: " << obj);
+        }
+        for (auto&& orPushdownElt : orPushdownsElt.Obj()) {
+            if (orPushdownElt.type() != Object) {
+                return Status(ErrorCodes::BadValue,
+                              str::stream() << "malformed orPushdowns in cached plan: " << obj);
+            }
+            BSONObj orPushdownObj = orPushdownElt.Obj();
+
+            PlanCacheIndexTree::OrPushdown orPushdown;
+            BSONElement nameElt = orPushdownObj["indexName"];
+            BSONElement disambiguatorElt = orPushdownObj["indexDisambiguator"];
+            BSONElement positionElt = orPushdownObj["position"];
+            BSONElement combineElt = orPushdownObj["canCombineBounds"];
+            BSONElement routeElt = orPushdownObj["route"];
+            if (nameElt.type() != String || disambiguatorElt.type() != String ||
+                !positionElt.isNumber() || combineElt.type() != Bool ||
+                routeElt.type() != Array) {
+                return Status(ErrorCodes::BadValue,
+                              str::stream() << "malformed orPushdown in cached plan: "
+                                            << orPushdownObj);
+            }
+            orPushdown.indexEntryId =
+                IndexEntry::Identifier(nameElt.str(), disambiguatorElt.str());
+            orPushdown.position = static_cast<size_t>(positionElt.numberLong());
+            orPushdown.canCombineBounds = combineElt.boolean();
+            for (auto&& routeStepElt : routeElt.Obj()) {
+                if (!routeStepElt.isNumber()) {
+                    return Status(ErrorCodes::BadValue,
+                                  str::stream() << "malformed orPushdown route in cached plan: "
+                                                << orPushdownObj);
+                }
+                orPushdown.route.push_back(static_cast<size_t>(routeStepElt.numberLong()));
+            }
+            tree->orPushdowns.push_back(std::move(orPushdown));
+        }
+    }
+
+    if (BSONElement childrenElt = obj["children"]) {
+        if (childrenElt.type() != Array) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream() << "malformed children in cached plan: " << obj);
+        }
+        for (auto&& childElt : childrenElt.Obj()) {
+            if (childElt.type() != Object) {
+                return Status(ErrorCodes::BadValue,
+                              str::stream() << "malformed children in cached plan: " << obj);
+            }
+            auto childRes = indexTreeFromBSON(childElt.Obj(), indexes);
+            if (!childRes.isOK()) {
+                return childRes.getStatus();
+            }
+            tree->children.push_back(childRes.getValue().release());
+        }
+    }
+
+    return std::move(tree);
+}
+
+}  // namespace
+
+BSONObj solutionCacheDataToBSON(const SolutionCacheData& solnCacheData) {
+    BSONObjBuilder bob;
+    switch (solnCacheData.solnType) {
+        case SolutionCacheData::COLLSCAN_SOLN:
+            bob.append("solnType", kScdSolnTypeCollscan);
+            break;
+        case SolutionCacheData::WHOLE_IXSCAN_SOLN:
+            bob.append("solnType", kScdSolnTypeWholeIxscan);
+            bob.append("wholeIXSolnDir", solnCacheData.wholeIXSolnDir);
+            break;
+        case SolutionCacheData::USE_INDEX_TAGS_SOLN:
+            bob.append("solnType", kScdSolnTypeIndexTags);
+            break;
+    }
+    bob.appendBool("indexFilterApplied", solnCacheData.indexFilterApplied);
+    if (solnCacheData.tree) {
+        BSONObjBuilder treeBob(bob.subobjStart("tree"));
+        indexTreeToBSON(*solnCacheData.tree, &treeBob);
+    }
+    return bob.obj();
+}
+
+StatusWith<std::unique_ptr<SolutionCacheData>> solutionCacheDataFromBSON(
+    const BSONObj& obj, const std::vector<IndexEntry>& indexes) {
+    auto solnCacheData = stdx::make_unique<SolutionCacheData>();
+
+    BSONElement solnTypeElt = obj["solnType"];
+    if (solnTypeElt.type() != String) {
+        return Status(ErrorCodes::BadValue,
+                      str::stream() << "malformed cached plan solution type: " << obj);
+    }
+    const auto solnTypeName = solnTypeElt.valueStringData();
+    if (solnTypeName == kScdSolnTypeCollscan) {
+        solnCacheData->solnType = SolutionCacheData::COLLSCAN_SOLN;
+    } else if (solnTypeName == kScdSolnTypeWholeIxscan) {
+        solnCacheData->solnType = SolutionCacheData::WHOLE_IXSCAN_SOLN;
+        BSONElement dirElt = obj["wholeIXSolnDir"];
+        if (!dirElt.isNumber() || (dirElt.numberInt() != 1 && dirElt.numberInt() != -1)) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream() << "malformed cached plan scan direction: " << obj);
+        }
+        solnCacheData->wholeIXSolnDir = dirElt.numberInt();
+    } else if (solnTypeName == kScdSolnTypeIndexTags) {
+        solnCacheData->solnType = SolutionCacheData::USE_INDEX_TAGS_SOLN;
+    } else {
+        return Status(ErrorCodes::BadValue,
+                      str::stream() << "unknown cached plan solution type: " << obj);
+    }
+
+    BSONElement filterAppliedElt = obj["indexFilterApplied"];
+    if (filterAppliedElt.type() != Bool) {
+        return Status(ErrorCodes::BadValue,
+                      str::stream() << "malformed cached plan: " << obj);
+    }
+    solnCacheData->indexFilterApplied = filterAppliedElt.boolean();
+
+    BSONElement treeElt = obj["tree"];
+    if (treeElt.eoo()) {
+        if (solnCacheData->solnType != SolutionCacheData::COLLSCAN_SOLN) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream() << "cached plan is missing its index tree: " << obj);
+        }
+    } else {
+        if (treeElt.type() != Object) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream() << "malformed cached plan index tree: " << obj);
+        }
+        auto treeRes = indexTreeFromBSON(treeElt.Obj(), indexes);
+        if (!treeRes.isOK()) {
+            return treeRes.getStatus();
+        }
+        solnCacheData->tree = std::move(treeRes.getValue());
+    }
+
+    return std::move(solnCacheData);
+}
+
 //
 // PlanCache
 //
@@ -533,14 +813,37 @@ Status PlanCache::set(const CanonicalQuery& query,
         projBuilder.append(elem);
     }
     newEntry->projection = projBuilder.obj();
+    newEntry->estimatedEntrySizeBytes = newEntry->estimateObjectSizeInBytes();
+
+    // If 'add' replaces an existing entry for this key below, stop accounting for that entry now.
+    PlanCacheEntry* replacedEntry = nullptr;
+    if (_cache.get(key, &replacedEntry).isOK()) {
+        invariant(replacedEntry);
+        _cacheSizeBytes -= replacedEntry->estimatedEntrySizeBytes;
+    }
+    _cacheSizeBytes += newEntry->estimatedEntrySizeBytes;
 
     std::unique_ptr<PlanCacheEntry> evictedEntry = _cache.add(key, newEntry.release());
 
     if (NULL != evictedEntry.get()) {
+        _cacheSizeBytes -= evictedEntry->estimatedEntrySizeBytes;
         LOG(1) << _ns << ": plan cache maximum size exceeded - "
                << "removed least recently used entry " << redact(evictedEntry->toString());
     }
 
+    // The entry count limit alone does not bound memory: a few entries with large index trees can
+    // outweigh thousands of small ones. Enforce the byte budget by evicting from the LRU end. The
+    // entry just added sits at the MRU end and is never evicted here.
+    const size_t maxSizeBytes = static_cast<size_t>(internalQueryCacheMaxSizeBytes.load());
+    while (maxSizeBytes > 0 && _cacheSizeBytes > maxSizeBytes && _cache.size() > 1) {
+        auto lruIt = std::prev(_cache.end());
+        const PlanCacheKey lruKey = lruIt->first;
+        _cacheSizeBytes -= lruIt->second->estimatedEntrySizeBytes;
+        LOG(1) << _ns << ": plan cache byte budget exceeded - "
+               << "removed least recently used entry " << redact(lruIt->second->toString());
+        invariant(_cache.remove(lruKey).isOK());
+    }
+
     return Status::OK();
 }
 
@@ -602,13 +905,20 @@ Status PlanCache::feedback(const CanonicalQuery& cq, double score) {
 }
 
 Status PlanCache::remove(const CanonicalQuery& canonicalQuery) {
+    const PlanCacheKey key = computeKey(canonicalQuery);
     stdx::lock_guard<stdx::mutex> cacheLock(_cacheMutex);
-    return _cache.remove(computeKey(canonicalQuery));
+    PlanCacheEntry* entry = nullptr;
+    if (_cache.get(key, &entry).isOK()) {
+        invariant(entry);
+        _cacheSizeBytes -= entry->estimatedEntrySizeBytes;
+    }
+    return _cache.remove(key);
 }
 
 void PlanCache::clear() {
     stdx::lock_guard<stdx::mutex> cacheLock(_cacheMutex);
     _cache.clear();
+    _cacheSizeBytes = 0;
 }
 
 PlanCacheKey PlanCache::computeKey(const CanonicalQuery& cq) const {
@@ -650,6 +960,11 @@ size_t PlanCache::size() const {
     return _cache.size();
 }
 
+size_t PlanCache::sizeInBytes() const {
+    stdx::lock_guard<stdx::mutex> cacheLock(_cacheMutex);
+    return _cacheSizeBytes;
+}
+
 void PlanCache::notifyOfIndexUpdates(const std::vector<CoreIndexInfo>& indexCores) {
     _indexabilityState.updateDiscriminators(indexCores);
 }
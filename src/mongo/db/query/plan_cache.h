@@ -33,6 +33,7 @@
 #include <boost/optional/optional.hpp>
 #include <set>
 
+#include "mongo/base/status_with.h"
 #include "mongo/db/exec/plan_stats.h"
 #include "mongo/db/query/canonical_query.h"
 #include "mongo/db/query/index_tag.h"
@@ -171,6 +172,11 @@ struct PlanCacheIndexTree {
      */
     std::string toString(int indents = 0) const;
 
+    /**
+     * Estimate of the tree's in-memory footprint, including its index entries and children.
+     */
+    size_t estimateObjectSizeInBytes() const;
+
     // Children owned here.
     std::vector<PlanCacheIndexTree*> children;
 
@@ -206,6 +212,9 @@ struct SolutionCacheData {
     // For debugging.
     std::string toString() const;
 
+    // Estimate of the in-memory footprint, including the owned index tree.
+    size_t estimateObjectSizeInBytes() const;
+
     // Owned here. If 'wholeIXSoln' is false, then 'tree'
     // can be used to tag an isomorphic match expression. If 'wholeIXSoln'
     // is true, then 'tree' is used to store the relevant IndexEntry.
@@ -235,6 +244,22 @@ struct SolutionCacheData {
     bool indexFilterApplied;
 };
 
+/**
+ * Serializes 'solnCacheData' to BSON so that a winning plan can be persisted and later
+ * reconstructed by solutionCacheDataFromBSON(). Index entries are stored by identifier only;
+ * reconstruction resolves them against the index catalog of that moment.
+ */
+BSONObj solutionCacheDataToBSON(const SolutionCacheData& solnCacheData);
+
+/**
+ * Reconstructs a SolutionCacheData from 'obj', resolving stored index identifiers against
+ * 'indexes' (the planner's view of the current index catalog). Returns an error if the encoding
+ * is not understood or if a referenced index no longer exists; in either case the persisted
+ * entry is stale and must be discarded rather than used for planning.
+ */
+StatusWith<std::unique_ptr<SolutionCacheData>> solutionCacheDataFromBSON(
+    const BSONObj& obj, const std::vector<IndexEntry>& indexes);
+
 class PlanCacheEntry;
 
 /**
@@ -299,6 +324,13 @@ public:
     // For debugging.
     std::string toString() const;
 
+    /**
+     * Estimate of this entry's in-memory footprint. The estimate walks the cached index trees and
+     * the example query shape, which dominate the cost of an entry, but does not walk the plan
+     * ranking decision's stage stats trees.
+     */
+    size_t estimateObjectSizeInBytes() const;
+
     //
     // Planner data
     //
@@ -346,6 +378,11 @@ public:
     // trigger a replan. Running a query of the same shape while this cache entry is inactive may
     // cause this value to be increased.
     size_t works = 0;
+
+    // The result of estimateObjectSizeInBytes(), computed once when the entry is added to the
+    // cache and used for byte-budgeted eviction. Growth after creation (e.g. from feedback) is
+    // not tracked.
+    size_t estimatedEntrySizeBytes = 0;
 };
 
 /**
@@ -511,6 +548,12 @@ public:
      */
     size_t size() const;
 
+    /**
+     * Returns the sum of the size estimates of all entries in the cache.
+     * Used for testing.
+     */
+    size_t sizeInBytes() const;
+
     /**
      * Updates internal state kept about the collection's indexes.  Must be called when the set
      * of indexes on the associated collection have changed.
@@ -546,7 +589,10 @@ private:
 
     LRUKeyValue<PlanCacheKey, PlanCacheEntry, PlanCacheKeyHasher> _cache;
 
-    // Protects _cache.
+    // Sum of the size estimates of the entries in '_cache'.
+    size_t _cacheSizeBytes = 0;
+
+    // Protects _cache and _cacheSizeBytes.
     mutable stdx::mutex _cacheMutex;
 
     // Full namespace of collection.
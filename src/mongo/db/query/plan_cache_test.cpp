@@ -566,6 +566,65 @@ TEST(PlanCacheTest, PlanCacheLRUPolicyRemovesInactiveEntries) {
     ASSERT_EQ(planCache.get(*cqC).state, PlanCache::CacheEntryState::kPresentInactive);
 }
 
+TEST(PlanCacheTest, PlanCacheByteBudgetEvictsLeastRecentlyUsedEntries) {
+    const auto previousBudget = internalQueryCacheMaxSizeBytes.load();
+    ON_BLOCK_EXIT([previousBudget] { internalQueryCacheMaxSizeBytes.store(previousBudget); });
+
+    PlanCache planCache;
+    QueryTestServiceContext serviceContext;
+
+    // Add one entry with the budget disabled, and use its size estimate to pick a budget which
+    // holds exactly two entries of this shape.
+    internalQueryCacheMaxSizeBytes.store(0);
+    unique_ptr<CanonicalQuery> cqA(canonicalize("{a: 1}"));
+    addCacheEntryForShape(*cqA.get(), &planCache);
+    const size_t bytesPerEntry = planCache.sizeInBytes();
+    ASSERT_GT(bytesPerEntry, 0U);
+    internalQueryCacheMaxSizeBytes.store(2 * bytesPerEntry);
+
+    unique_ptr<CanonicalQuery> cqB(canonicalize("{b: 1}"));
+    addCacheEntryForShape(*cqB.get(), &planCache);
+    ASSERT_EQ(planCache.size(), 2U);
+
+    // Access the cached solution for the {a: 1} shape. Now the entry for {b: 1} will be the least
+    // recently used.
+    ASSERT_EQ(planCache.get(*cqA).state, PlanCache::CacheEntryState::kPresentInactive);
+
+    // Adding a third entry exceeds the byte budget, which should eject the {b: 1} entry even
+    // though the entry count limit has not been reached.
+    unique_ptr<CanonicalQuery> cqC(canonicalize("{c: 1}"));
+    addCacheEntryForShape(*cqC.get(), &planCache);
+
+    ASSERT_EQ(planCache.get(*cqB).state, PlanCache::CacheEntryState::kNotPresent);
+    ASSERT_EQ(planCache.get(*cqA).state, PlanCache::CacheEntryState::kPresentInactive);
+    ASSERT_EQ(planCache.get(*cqC).state, PlanCache::CacheEntryState::kPresentInactive);
+    ASSERT_LTE(planCache.sizeInBytes(), 2 * bytesPerEntry);
+}
+
+TEST(PlanCacheTest, PlanCacheByteAccountingTracksReplaceRemoveAndClear) {
+    PlanCache planCache;
+    QueryTestServiceContext serviceContext;
+
+    unique_ptr<CanonicalQuery> cq(canonicalize("{a: 1}"));
+    addCacheEntryForShape(*cq.get(), &planCache);
+    const size_t bytesPerEntry = planCache.sizeInBytes();
+    ASSERT_GT(bytesPerEntry, 0U);
+
+    // Replacing the entry for the same shape must not double-count it.
+    auto qs = getQuerySolutionForCaching();
+    std::vector<QuerySolution*> solns = {qs.get()};
+    ASSERT_OK(planCache.set(*cq, solns, createDecision(1U), Date_t{}));
+    ASSERT_EQ(planCache.sizeInBytes(), bytesPerEntry);
+
+    ASSERT_OK(planCache.remove(*cq));
+    ASSERT_EQ(planCache.sizeInBytes(), 0U);
+
+    addCacheEntryForShape(*cq.get(), &planCache);
+    ASSERT_EQ(planCache.sizeInBytes(), bytesPerEntry);
+    planCache.clear();
+    ASSERT_EQ(planCache.sizeInBytes(), 0U);
+}
+
 TEST(PlanCacheTest, PlanCacheRemoveDeletesInactiveEntries) {
     PlanCache planCache;
     unique_ptr<CanonicalQuery> cq(canonicalize("{a: 1}"));
@@ -2029,4 +2088,91 @@ TEST(PlanCacheTest, StableKeyDoesNotChangeAcrossIndexCreation) {
     ASSERT_EQ(postIndexKey.getUnstablePart(), "<1>");
 }
 
+IndexEntry makeBtreeEntry(BSONObj keyPattern, const std::string& name) {
+    return IndexEntry(keyPattern,
+                      IndexNames::nameToType(IndexNames::findPluginName(keyPattern)),
+                      false,  // multikey
+                      {},
+                      {},
+                      false,  // sparse
+                      false,  // unique
+                      IndexEntry::Identifier{name},
+                      nullptr,
+                      BSONObj(),
+                      nullptr,
+                      nullptr);
+}
+
+TEST(SolutionCacheDataSerializationTest, RoundTripsIndexTagsSolution) {
+    std::vector<IndexEntry> indexes = {makeBtreeEntry(BSON("a" << 1), "a_1"),
+                                       makeBtreeEntry(BSON("b" << 1), "b_1")};
+
+    SolutionCacheData scd;
+    scd.solnType = SolutionCacheData::USE_INDEX_TAGS_SOLN;
+    scd.indexFilterApplied = true;
+    scd.tree = stdx::make_unique<PlanCacheIndexTree>();
+    scd.tree->canCombineBounds = false;
+
+    auto firstChild = stdx::make_unique<PlanCacheIndexTree>();
+    firstChild->setIndexEntry(indexes[0]);
+    firstChild->index_pos = 0;
+    scd.tree->children.push_back(firstChild.release());
+
+    auto secondChild = stdx::make_unique<PlanCacheIndexTree>();
+    secondChild->setIndexEntry(indexes[1]);
+    secondChild->index_pos = 1;
+    PlanCacheIndexTree::OrPushdown orPushdown;
+    orPushdown.indexEntryId = IndexEntry::Identifier{"a_1"};
+    orPushdown.position = 2;
+    orPushdown.canCombineBounds = true;
+    orPushdown.route = {0, 1};
+    secondChild->orPushdowns.push_back(std::move(orPushdown));
+    scd.tree->children.push_back(secondChild.release());
+
+    auto roundTripped = solutionCacheDataFromBSON(solutionCacheDataToBSON(scd), indexes);
+    ASSERT_OK(roundTripped.getStatus());
+    ASSERT_EQ(roundTripped.getValue()->toString(), scd.toString());
+}
+
+TEST(SolutionCacheDataSerializationTest, RoundTripsCollscanAndWholeIxscanSolutions) {
+    std::vector<IndexEntry> indexes = {makeBtreeEntry(BSON("a" << 1), "a_1")};
+
+    SolutionCacheData collscan;
+    collscan.solnType = SolutionCacheData::COLLSCAN_SOLN;
+    auto roundTrippedCollscan =
+        solutionCacheDataFromBSON(solutionCacheDataToBSON(collscan), indexes);
+    ASSERT_OK(roundTrippedCollscan.getStatus());
+    ASSERT_EQ(roundTrippedCollscan.getValue()->toString(), collscan.toString());
+
+    SolutionCacheData wholeIxscan;
+    wholeIxscan.solnType = SolutionCacheData::WHOLE_IXSCAN_SOLN;
+    wholeIxscan.wholeIXSolnDir = -1;
+    wholeIxscan.tree = stdx::make_unique<PlanCacheIndexTree>();
+    wholeIxscan.tree->setIndexEntry(indexes[0]);
+    auto roundTrippedWholeIxscan =
+        solutionCacheDataFromBSON(solutionCacheDataToBSON(wholeIxscan), indexes);
+    ASSERT_OK(roundTrippedWholeIxscan.getStatus());
+    ASSERT_EQ(roundTrippedWholeIxscan.getValue()->toString(), wholeIxscan.toString());
+}
+
+TEST(SolutionCacheDataSerializationTest, FailsWhenReferencedIndexNoLongerExists) {
+    SolutionCacheData scd;
+    scd.solnType = SolutionCacheData::USE_INDEX_TAGS_SOLN;
+    scd.tree = stdx::make_unique<PlanCacheIndexTree>();
+    scd.tree->setIndexEntry(makeBtreeEntry(BSON("a" << 1), "a_1"));
+
+    auto res = solutionCacheDataFromBSON(solutionCacheDataToBSON(scd), {});
+    ASSERT_EQ(res.getStatus(), ErrorCodes::NoSuchKey);
+}
+
+TEST(SolutionCacheDataSerializationTest, FailsOnMalformedInput) {
+    ASSERT_EQ(solutionCacheDataFromBSON(BSONObj(), {}).getStatus(), ErrorCodes::BadValue);
+    ASSERT_EQ(solutionCacheDataFromBSON(fromjson("{solnType: 'bogus'}"), {}).getStatus(),
+              ErrorCodes::BadValue);
+    ASSERT_EQ(solutionCacheDataFromBSON(
+                  fromjson("{solnType: 'indexTags', indexFilterApplied: false}"), {})
+                  .getStatus(),
+              ErrorCodes::BadValue);
+}
+
 }  // namespace
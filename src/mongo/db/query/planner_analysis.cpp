@@ -32,6 +32,7 @@
 
 #include "mongo/db/query/planner_analysis.h"
 
+#include <algorithm>
 #include <set>
 #include <vector>
 
@@ -755,6 +756,42 @@ std::unique_ptr<QuerySolution> QueryPlannerAnalysis::analyzeDataAccess(
             if (query.getProj()->wantSortKey() || query.getProj()->hasDottedFieldPath()) {
                 projType = ProjectionNode::DEFAULT;
             }
+
+            // A simple inclusion projection directly over a filterless fetch consumes only the
+            // projected top-level fields of the fetched document. Record those fields on the
+            // fetch so that it can return a trimmed document instead of materializing the full
+            // one.
+            if (ProjectionNode::SIMPLE_DOC == projType && STAGE_FETCH == solnRoot->getType()) {
+                FetchNode* fetchNode = static_cast<FetchNode*>(solnRoot.get());
+                if (!fetchNode->filter) {
+                    for (auto&& field : query.getProj()->getRequiredFields()) {
+                        fetchNode->neededFields.push_back(field.toString());
+                    }
+                }
+            }
+
+            // Similarly, a covered projection directly over a filterless index scan consumes only
+            // the projected fields of the index key. If those fields all fall within a strict
+            // prefix of the key pattern, record the prefix length so that the scan can decode
+            // just that many fields of each KeyString.
+            if (ProjectionNode::COVERED_ONE_INDEX == projType &&
+                STAGE_IXSCAN == solnRoot->getType()) {
+                IndexScanNode* ixn = static_cast<IndexScanNode*>(solnRoot.get());
+                if (!ixn->filter) {
+                    int numKeyFields = 0;
+                    int lastNeededPos = -1;
+                    for (auto&& keyElt : ixn->index.keyPattern) {
+                        if (std::find(fields.begin(), fields.end(), keyElt.fieldNameStringData()) !=
+                            fields.end()) {
+                            lastNeededPos = numKeyFields;
+                        }
+                        ++numKeyFields;
+                    }
+                    if (lastNeededPos >= 0 && lastNeededPos + 1 < numKeyFields) {
+                        ixn->neededKeyPrefixLength = lastNeededPos + 1;
+                    }
+                }
+            }
         }
         // If we don't have a covered project, and we're not allowed to put an uncovered one in,
         // bail out.
@@ -47,8 +47,11 @@
 #include "mongo/db/query/index_tag.h"
 #include "mongo/db/query/indexability.h"
 #include "mongo/db/query/planner_wildcard_helpers.h"
+#include "mongo/db/query/query_knobs.h"
 #include "mongo/db/query/query_planner_common.h"
+#include "mongo/stdx/mutex.h"
 #include "mongo/util/log.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 
@@ -703,7 +706,8 @@ void QueryPlannerIXSelect::_rateIndices(MatchExpression* node,
 
 // static
 void QueryPlannerIXSelect::stripInvalidAssignments(MatchExpression* node,
-                                                   const vector<IndexEntry>& indices) {
+                                                   const vector<IndexEntry>& indices,
+                                                   const CollatorInterface* queryCollator) {
     stripInvalidAssignmentsToWildcardIndexes(node, indices);
     stripInvalidAssignmentsToTextIndexes(node, indices);
 
@@ -712,7 +716,7 @@ void QueryPlannerIXSelect::stripInvalidAssignments(MatchExpression* node,
         stripInvalidAssignmentsTo2dsphereIndices(node, indices);
     }
 
-    stripInvalidAssignmentsToPartialIndices(node, indices);
+    stripInvalidAssignmentsToPartialIndices(node, indices, queryCollator);
 }
 
 namespace {
@@ -828,6 +832,15 @@ static void removeIndexRelevantTag(MatchExpression* node, size_t idx) {
 
 namespace {
 
+// The process-wide memo table for isQuerySubsetOfPartialIndexFilter(). Maps the concatenated
+// serializations of a partial index filter and a query expression to the subset verdict. Keys are
+// self-describing (BSON is length-prefixed), so entries never go stale: an index dropped and
+// rebuilt with the same filter produces the same verdicts. When the table reaches the configured
+// size it is emptied wholesale and re-warmed, which is cheap relative to tracking LRU order on
+// every planning pass.
+stdx::mutex partialIndexSubsetCacheMutex;
+StringMap<bool> partialIndexSubsetCache;
+
 bool nodeIsNegationOrElemMatchObj(const MatchExpression* node) {
     return (node->matchType() == MatchExpression::NOT ||
             node->matchType() == MatchExpression::NOR ||
@@ -837,6 +850,7 @@ bool nodeIsNegationOrElemMatchObj(const MatchExpression* node) {
 void stripInvalidAssignmentsToPartialIndexNode(MatchExpression* node,
                                                size_t idxNo,
                                                const IndexEntry& idxEntry,
+                                               const CollatorInterface* queryCollator,
                                                bool inNegationOrElemMatchObj) {
     if (node->getTag()) {
         removeIndexRelevantTag(node, idxNo);
@@ -863,31 +877,82 @@ void stripInvalidAssignmentsToPartialIndexNode(MatchExpression* node,
         //   "a.f" while the latter is referring to field "f", so the clause does not actually
         //   satisfy the filter expression and should not be spared.
         if (!inNegationOrElemMatchObj && node->matchType() == MatchExpression::OR &&
-            expression::isSubsetOf(node->getChild(i), idxEntry.filterExpr)) {
+            QueryPlannerIXSelect::isQuerySubsetOfPartialIndexFilter(
+                node->getChild(i), queryCollator, idxEntry)) {
             continue;
         }
         stripInvalidAssignmentsToPartialIndexNode(
-            node->getChild(i), idxNo, idxEntry, inNegationOrElemMatchObj);
+            node->getChild(i), idxNo, idxEntry, queryCollator, inNegationOrElemMatchObj);
     }
 }
 
 void stripInvalidAssignmentsToPartialIndexRoot(MatchExpression* root,
                                                size_t idxNo,
-                                               const IndexEntry& idxEntry) {
-    if (expression::isSubsetOf(root, idxEntry.filterExpr)) {
+                                               const IndexEntry& idxEntry,
+                                               const CollatorInterface* queryCollator) {
+    if (QueryPlannerIXSelect::isQuerySubsetOfPartialIndexFilter(root, queryCollator, idxEntry)) {
         return;
     }
     const bool inNegationOrElemMatchObj = nodeIsNegationOrElemMatchObj(root);
-    stripInvalidAssignmentsToPartialIndexNode(root, idxNo, idxEntry, inNegationOrElemMatchObj);
+    stripInvalidAssignmentsToPartialIndexNode(
+        root, idxNo, idxEntry, queryCollator, inNegationOrElemMatchObj);
 }
 
 }  // namespace
 
+// static
+bool QueryPlannerIXSelect::isQuerySubsetOfPartialIndexFilter(const MatchExpression* queryExpr,
+                                                             const CollatorInterface* queryCollator,
+                                                             const IndexEntry& index) {
+    invariant(index.filterExpr);
+
+    // Collators are attached to the individual leaf expressions and are not captured by the
+    // serializations used as memo keys, so collation-aware analyses are always performed directly.
+    const int maxCacheSize = internalQueryPartialIndexSubsetCacheSize.load();
+    if (queryCollator || index.collator || maxCacheSize <= 0) {
+        return expression::isSubsetOf(queryExpr, index.filterExpr);
+    }
+
+    BSONObjBuilder filterBob;
+    index.filterExpr->serialize(&filterBob);
+    const BSONObj filterObj = filterBob.obj();
+
+    BSONObjBuilder queryBob;
+    queryExpr->serialize(&queryBob);
+    const BSONObj queryObj = queryBob.obj();
+
+    std::string key;
+    key.reserve(filterObj.objsize() + queryObj.objsize());
+    key.append(filterObj.objdata(), filterObj.objsize());
+    key.append(queryObj.objdata(), queryObj.objsize());
+
+    {
+        stdx::lock_guard<stdx::mutex> lk(partialIndexSubsetCacheMutex);
+        auto it = partialIndexSubsetCache.find(key);
+        if (it != partialIndexSubsetCache.end()) {
+            return it->second;
+        }
+    }
+
+    // The subset analysis is performed outside the lock; only the memo table accesses need to be
+    // serialized.
+    const bool verdict = expression::isSubsetOf(queryExpr, index.filterExpr);
+
+    stdx::lock_guard<stdx::mutex> lk(partialIndexSubsetCacheMutex);
+    if (partialIndexSubsetCache.size() >= static_cast<size_t>(maxCacheSize)) {
+        partialIndexSubsetCache.clear();
+    }
+    partialIndexSubsetCache[std::move(key)] = verdict;
+    return verdict;
+}
+
 void QueryPlannerIXSelect::stripInvalidAssignmentsToPartialIndices(
-    MatchExpression* node, const vector<IndexEntry>& indices) {
+    MatchExpression* node,
+    const vector<IndexEntry>& indices,
+    const CollatorInterface* queryCollator) {
     for (size_t i = 0; i < indices.size(); ++i) {
         if (indices[i].filterExpr) {
-            stripInvalidAssignmentsToPartialIndexRoot(node, i, indices[i]);
+            stripInvalidAssignmentsToPartialIndexRoot(node, i, indices[i], queryCollator);
         }
     }
 }
@@ -100,7 +100,21 @@ public:
      * See the body of this function and the specific stripInvalidAssignments functions for details.
      */
     static void stripInvalidAssignments(MatchExpression* node,
-                                        const std::vector<IndexEntry>& indices);
+                                        const std::vector<IndexEntry>& indices,
+                                        const CollatorInterface* queryCollator);
+
+    /**
+     * Returns true if the documents matched by 'queryExpr' are a subset of the documents matched
+     * by the filter of the partial index 'index'. Equivalent to expression::isSubsetOf(), but
+     * memoizes verdicts in a process-wide table, since the subset analysis walks both expression
+     * trees and is repeated for every (query, partial index) combination the planner considers.
+     * Verdicts are keyed by the serializations of both expressions, so they remain correct across
+     * index drops and rebuilds; when either side uses a collation the memo table is bypassed,
+     * because collators are not captured by the serialized form.
+     */
+    static bool isQuerySubsetOfPartialIndexFilter(const MatchExpression* queryExpr,
+                                                  const CollatorInterface* queryCollator,
+                                                  const IndexEntry& index);
 
     /**
      * In some special cases, we can strip most of the index assignments from the tree early
@@ -281,7 +295,8 @@ private:
      * contained within the OR.
      */
     static void stripInvalidAssignmentsToPartialIndices(MatchExpression* node,
-                                                        const std::vector<IndexEntry>& indices);
+                                                        const std::vector<IndexEntry>& indices,
+                                                        const CollatorInterface* queryCollator);
 
     static bool notEqualsNullCanUseIndex(const IndexEntry& index,
                                          const BSONElement& keyPatternElt,
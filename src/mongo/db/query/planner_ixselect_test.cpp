@@ -1593,6 +1593,23 @@ TEST(QueryPlannerIXSelectTest, SparseIndexSupported) {
     ASSERT_TRUE(QueryPlannerIXSelect::nodeIsSupportedBySparseIndex(queryB.get(), true));
 }
 
+TEST(QueryPlannerIXSelectTest, PartialIndexSubsetVerdictStableAcrossRepeatedCalls) {
+    auto filter = parseMatchExpression(fromjson("{a: {$gt: 0}}"));
+    auto entry = buildSimpleIndexEntry(BSON("a" << 1));
+    entry.filterExpr = filter.get();
+
+    auto coveredQuery = parseMatchExpression(fromjson("{a: 5}"));
+    auto uncoveredQuery = parseMatchExpression(fromjson("{a: -5}"));
+
+    // The second iteration is answered from the memo table and must agree with the first.
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_TRUE(QueryPlannerIXSelect::isQuerySubsetOfPartialIndexFilter(
+            coveredQuery.get(), nullptr, entry));
+        ASSERT_FALSE(QueryPlannerIXSelect::isQuerySubsetOfPartialIndexFilter(
+            uncoveredQuery.get(), nullptr, entry));
+    }
+}
+
 TEST(QueryPlannerIXSelectTest, SparseIndexSupportedDoesNotTraverse) {
     // The function will not traverse a node's children.
     const bool inElemMatch = false;
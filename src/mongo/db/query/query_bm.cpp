@@ -0,0 +1,136 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/json.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/query/canonical_query.h"
+#include "mongo/db/query/query_request.h"
+#include "mongo/db/query/query_test_service_context.h"
+#include "mongo/stdx/memory.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+namespace {
+
+const NamespaceString kNss("bench.query_bm");
+
+/**
+ * Filter shapes exercised by the benchmarks, ordered roughly by parse and match complexity.
+ * Index 0 is the _id point read that dominates most workloads; the others add range
+ * predicates, $or/$in/$regex, and $elemMatch with dotted paths.
+ */
+BSONObj filterForShape(int shape) {
+    switch (shape) {
+        case 0:
+            return fromjson("{_id: 42}");
+        case 1:
+            return fromjson("{a: {$gte: 10, $lt: 100}, b: 'needle'}");
+        case 2:
+            return fromjson(
+                "{$or: [{a: {$in: [1, 2, 3, 4, 5]}}, {b: {$regex: '^needle'}}],"
+                " c: {$exists: true}}");
+        case 3:
+            return fromjson(
+                "{arr: {$elemMatch: {x: {$gt: 5}, y: {$lt: 10}}},"
+                " 'nested.field.path': {$ne: null}}");
+    }
+    MONGO_UNREACHABLE;
+}
+
+/**
+ * Documents with fields touched by every filter shape; roughly half of them satisfy each
+ * shape so both the accepting and rejecting match paths are measured.
+ */
+std::vector<BSONObj> makeDocuments(int count) {
+    std::vector<BSONObj> docs;
+    docs.reserve(count);
+    for (int i = 0; i < count; i++) {
+        docs.push_back(BSON("_id" << i << "a" << i % 200 << "b"
+                                  << ((i % 2) ? "needle" : "haystack") << "c" << i << "arr"
+                                  << BSON_ARRAY(BSON("x" << i % 20 << "y" << i % 15)) << "nested"
+                                  << BSON("field" << BSON("path" << i))));
+    }
+    return docs;
+}
+
+/**
+ * Measures find canonicalization: QueryRequest construction, MatchExpression parse, and
+ * CanonicalQuery normalization/sort analysis, per query shape.
+ */
+void BM_canonicalizeFind(benchmark::State& state) {
+    QueryTestServiceContext serviceContext;
+    auto opCtx = serviceContext.makeOperationContext();
+    const BSONObj filter = filterForShape(state.range(0));
+
+    for (auto keepRunning : state) {
+        auto qr = stdx::make_unique<QueryRequest>(kNss);
+        qr->setFilter(filter);
+        auto statusWithCQ = CanonicalQuery::canonicalize(opCtx.get(), std::move(qr));
+        invariant(statusWithCQ.isOK());
+        benchmark::DoNotOptimize(statusWithCQ.getValue());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Measures MatchExpression evaluation of an already-canonicalized filter over documents of a
+ * fixed shape. Reported items are documents matched, not iterations.
+ */
+void BM_matchExpressionEvaluate(benchmark::State& state) {
+    QueryTestServiceContext serviceContext;
+    auto opCtx = serviceContext.makeOperationContext();
+
+    auto qr = stdx::make_unique<QueryRequest>(kNss);
+    qr->setFilter(filterForShape(state.range(0)));
+    auto statusWithCQ = CanonicalQuery::canonicalize(opCtx.get(), std::move(qr));
+    invariant(statusWithCQ.isOK());
+    auto cq = std::move(statusWithCQ.getValue());
+
+    const auto docs = makeDocuments(1000);
+    for (auto keepRunning : state) {
+        for (const auto& doc : docs) {
+            benchmark::DoNotOptimize(cq->root()->matchesBSON(doc));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * docs.size());
+}
+
+BENCHMARK(BM_canonicalizeFind)->Arg(0)->Arg(1)->Arg(2)->Arg(3);
+BENCHMARK(BM_matchExpressionEvaluate)->Arg(0)->Arg(1)->Arg(2)->Arg(3);
+
+}  // namespace
+}  // namespace mongo
@@ -59,6 +59,11 @@ extern AtomicWord<bool> internalQueryPlannerEnableIndexIntersection;
 // Do we use hash-based intersection for rooted $and queries?
 extern AtomicWord<bool> internalQueryPlannerEnableHashIntersection;
 
+// How many memoized partial index subset verdicts do we retain? The planner caches the result of
+// the expression subset analysis performed for each (query, partial index filter) combination.
+// A value of 0 disables the memo table.
+extern AtomicWord<int> internalQueryPartialIndexSubsetCacheSize;
+
 //
 // plan cache
 //
@@ -66,6 +71,11 @@ extern AtomicWord<bool> internalQueryPlannerEnableHashIntersection;
 // How many entries in the cache?
 extern AtomicWord<int> internalQueryCacheSize;
 
+// Limit on the total estimated in-memory footprint, in bytes, of a collection's plan cache.
+// Entries are evicted in LRU order until the cache fits within the budget, independently of the
+// entry count limit above. A value of 0 disables the byte budget.
+extern AtomicWord<long long> internalQueryCacheMaxSizeBytes;
+
 // How many feedback entries do we collect before possibly evicting from the cache based on bad
 // performance?
 extern AtomicWord<int> internalQueryCacheFeedbacksStored;
@@ -81,6 +91,10 @@ extern AtomicDouble internalQueryCacheWorksGrowthCoefficient;
 // Whether or not cache entries can be marked as "inactive."
 extern AtomicWord<bool> internalQueryCacheDisableInactiveEntries;
 
+// Whether replanning first races the cached plan against the runner-up plan recorded in the cache
+// entry, rather than immediately regenerating and trialing every candidate plan from scratch.
+extern AtomicWord<bool> internalQueryCacheIncrementalReplanEnabled;
+
 // Whether or not planCacheListPlans uses the new output format.
 extern AtomicWord<bool> internalQueryCacheListPlansNewOutput;
 
@@ -122,6 +136,18 @@ extern AtomicWord<int> internalQueryExecYieldIterations;
 // Yield if it's been at least this many milliseconds since we last yielded.
 extern AtomicWord<int> internalQueryExecYieldPeriodMS;
 
+// The number of index entries FETCH buffers from its child index scan so that the records can be
+// read in RecordId order. Values of 0 or 1 disable the batching. Off by default: the batch size
+// is not yet limit-aware, so plans consumed incrementally (e.g. LIMIT over FETCH over IXSCAN)
+// would fetch up to a full batch to answer for one result.
+extern AtomicWord<int> internalQueryFetchPrefetchBatchSize;
+
+// Sample one of every N calls to PlanStage::work() with the high-resolution tick source,
+// accumulating a microsecond-granularity execution time estimate into the stage's CommonStats.
+// The default of 0 disables sampling, in which case only the millisecond-granularity timing
+// taken from the fast clock source is collected.
+extern AtomicWord<int> internalQueryExecStageTimingSampleRate;
+
 // Limit the size that we write without yielding to 16MB / 64 (max expected number of indexes)
 const int64_t insertVectorMaxBytes = 256 * 1024;
 
@@ -138,7 +164,26 @@ extern AtomicWord<int> internalInsertMaxBatchSize;
 
 extern AtomicWord<int> internalDocumentSourceCursorBatchSizeBytes;
 
+// The maximum number of documents exchanged per getNextBatch() call between stages of an
+// aggregation pipeline which support batched execution.
+extern AtomicWord<int> internalPipelineStageBatchSize;
+
 extern AtomicWord<int> internalDocumentSourceLookupCacheSizeBytes;
 
+// The number of bytes of foreign collection documents that a $lookup specified with
+// localField/foreignField syntax may load into an in-memory hash table, rather than issuing one
+// query against the foreign collection per input document. A value of 0 disables hash-join
+// execution.
+extern AtomicWord<long long> internalDocumentSourceLookupHashJoinMaxBytes;
+
 extern AtomicWord<bool> internalQueryProhibitBlockingMergeOnMongoS;
+
+// The number of milliseconds for which the result of a point read through the _id index may be
+// served from the per-collection point read cache rather than from the storage engine. Cached
+// results are additionally invalidated by any write to the collection. A value of 0 disables the
+// cache.
+extern AtomicWord<int> internalQueryPointReadCacheTTLMillis;
+
+// The maximum number of bytes of cached point read results per collection.
+extern AtomicWord<long long> internalQueryPointReadCacheMaxSizeBytes;
 }  // namespace mongo
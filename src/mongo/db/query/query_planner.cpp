@@ -443,23 +443,28 @@ StatusWith<std::unique_ptr<QuerySolution>> QueryPlanner::planFromCache(
     const CachedSolution& cachedSoln) {
     invariant(!cachedSoln.plannerData.empty());
 
+    // Look up winning solution in cached solution's array.
+    return planFromCacheData(query, params, *cachedSoln.plannerData[0]);
+}
+
+StatusWith<std::unique_ptr<QuerySolution>> QueryPlanner::planFromCacheData(
+    const CanonicalQuery& query,
+    const QueryPlannerParams& params,
+    const SolutionCacheData& cacheData) {
     // A query not suitable for caching should not have made its way into the cache.
     invariant(PlanCache::shouldCacheQuery(query));
 
-    // Look up winning solution in cached solution's array.
-    const SolutionCacheData& winnerCacheData = *cachedSoln.plannerData[0];
-
-    if (SolutionCacheData::WHOLE_IXSCAN_SOLN == winnerCacheData.solnType) {
+    if (SolutionCacheData::WHOLE_IXSCAN_SOLN == cacheData.solnType) {
         // The solution can be constructed by a scan over the entire index.
-        auto soln = buildWholeIXSoln(
-            *winnerCacheData.tree->entry, query, params, winnerCacheData.wholeIXSolnDir);
+        auto soln =
+            buildWholeIXSoln(*cacheData.tree->entry, query, params, cacheData.wholeIXSolnDir);
         if (!soln) {
             return Status(ErrorCodes::BadValue,
                           "plan cache error: soln that uses index to provide sort");
         } else {
             return {std::move(soln)};
         }
-    } else if (SolutionCacheData::COLLSCAN_SOLN == winnerCacheData.solnType) {
+    } else if (SolutionCacheData::COLLSCAN_SOLN == cacheData.solnType) {
         // The cached solution is a collection scan. We don't cache collscans
         // with tailable==true, hence the false below.
         auto soln = buildCollscanSoln(query, false, params);
@@ -474,13 +479,13 @@ StatusWith<std::unique_ptr<QuerySolution>> QueryPlanner::planFromCache(
     // If we're here then this is neither the whole index scan or collection scan
     // cases, and we proceed by using the PlanCacheIndexTree to tag the query tree.
 
-    // Create a copy of the expression tree.  We use cachedSoln to annotate this with indices.
+    // Create a copy of the expression tree.  We use cacheData to annotate this with indices.
     unique_ptr<MatchExpression> clone = query.root()->shallowClone();
 
     LOG(5) << "Tagging the match expression according to cache data: " << endl
            << "Filter:" << endl
            << redact(clone->toString()) << "Cache data:" << endl
-           << redact(winnerCacheData.toString());
+           << redact(cacheData.toString());
 
     stdx::unordered_set<string> fields;
     QueryPlannerIXSelect::getFields(query.root(), &fields);
@@ -497,7 +502,7 @@ StatusWith<std::unique_ptr<QuerySolution>> QueryPlanner::planFromCache(
         LOG(5) << "Index " << i << ": " << ie.identifier;
     }
 
-    Status s = tagAccordingToCache(clone.get(), winnerCacheData.tree.get(), indexMap);
+    Status s = tagAccordingToCache(clone.get(), cacheData.tree.get(), indexMap);
     if (!s.isOK()) {
         return s;
     }
@@ -710,7 +715,8 @@ StatusWith<std::vector<std::unique_ptr<QuerySolution>>> QueryPlanner::plan(
 
     // Figure out how useful each index is to each predicate.
     QueryPlannerIXSelect::rateIndices(query.root(), "", relevantIndices, query.getCollator());
-    QueryPlannerIXSelect::stripInvalidAssignments(query.root(), relevantIndices);
+    QueryPlannerIXSelect::stripInvalidAssignments(
+        query.root(), relevantIndices, query.getCollator());
 
     // Unless we have GEO_NEAR, TEXT, or a projection, we may be able to apply an optimization
     // in which we strip unnecessary index assignments.
@@ -798,10 +804,11 @@ StatusWith<std::vector<std::unique_ptr<QuerySolution>>> QueryPlanner::plan(
 
             // Store the plan cache index tree before calling prepareForAccessingPlanning(), so that
             // the PlanCacheIndexTree has the same sort as the MatchExpression used to generate the
-            // plan cache key.
-            std::unique_ptr<MatchExpression> clone(nextTaggedTree->shallowClone());
+            // plan cache key.  Extracting the cache data only reads the tagged tree, so it can be
+            // done in place without cloning the tree for each enumerated candidate.
             std::unique_ptr<PlanCacheIndexTree> cacheData;
-            auto statusWithCacheData = cacheDataFromTaggedTree(clone.get(), relevantIndices);
+            auto statusWithCacheData =
+                cacheDataFromTaggedTree(nextTaggedTree.get(), relevantIndices);
             if (!statusWithCacheData.isOK()) {
                 LOG(5) << "Query is not cachable: "
                        << redact(statusWithCacheData.getStatus().reason());
@@ -919,7 +926,9 @@ StatusWith<std::vector<std::unique_ptr<QuerySolution>>> QueryPlanner::plan(
 
                 // Partial indexes can only be used to provide a sort only if the query predicate is
                 // compatible.
-                if (index.filterExpr && !expression::isSubsetOf(query.root(), index.filterExpr)) {
+                if (index.filterExpr &&
+                    !QueryPlannerIXSelect::isQuerySubsetOfPartialIndexFilter(
+                        query.root(), query.getCollator(), index)) {
                     continue;
                 }
 
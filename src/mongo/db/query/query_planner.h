@@ -39,6 +39,7 @@ namespace mongo {
 
 class CachedSolution;
 class Collection;
+struct SolutionCacheData;
 
 /**
  * QueryPlanner's job is to provide an entry point to the query planning and optimization
@@ -68,6 +69,16 @@ public:
         const QueryPlannerParams& params,
         const CachedSolution& cachedSoln);
 
+    /**
+     * Generates and returns a query solution from a single piece of cached planner data. Used to
+     * rebuild a specific cached candidate, such as the runner-up plan during replanning, rather
+     * than the winning plan.
+     */
+    static StatusWith<std::unique_ptr<QuerySolution>> planFromCacheData(
+        const CanonicalQuery& query,
+        const QueryPlannerParams& params,
+        const SolutionCacheData& cacheData);
+
     /**
      * Generates and returns the index tag tree that will be inserted into the plan cache. This data
      * gets stashed inside a QuerySolution until it can be inserted into the cache proper.
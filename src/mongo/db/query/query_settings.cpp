@@ -79,6 +79,13 @@ AllowedIndexEntry::AllowedIndexEntry(const BSONObj& query,
 
 boost::optional<AllowedIndicesFilter> QuerySettings::getAllowedIndicesFilter(
     const CanonicalQuery::QueryShapeString& key) const {
+    // Most deployments never set index filters, so skip the mutex when the map is known to be
+    // empty. A racy read is fine: a query racing with the very first filter insertion may plan
+    // without the filter, which is indistinguishable from it arriving a moment earlier.
+    if (!_hasAllowedIndexEntries.load()) {
+        return {};
+    }
+
     stdx::lock_guard<stdx::mutex> cacheLock(_mutex);
     AllowedIndexEntryMap::const_iterator cacheIter = _allowedIndexEntryMap.find(key);
 
@@ -116,6 +123,7 @@ void QuerySettings::setAllowedIndices(const CanonicalQuery& canonicalQuery,
         std::piecewise_construct,
         std::forward_as_tuple(key),
         std::forward_as_tuple(query, sort, projection, collation, indexKeyPatterns, indexNames));
+    _hasAllowedIndexEntries.store(true);
 }
 
 void QuerySettings::removeAllowedIndices(const CanonicalQuery::QueryShapeString& key) {
@@ -128,11 +136,13 @@ void QuerySettings::removeAllowedIndices(const CanonicalQuery::QueryShapeString&
     }
 
     _allowedIndexEntryMap.erase(i);
+    _hasAllowedIndexEntries.store(!_allowedIndexEntryMap.empty());
 }
 
 void QuerySettings::clearAllowedIndices() {
     stdx::lock_guard<stdx::mutex> cacheLock(_mutex);
     _allowedIndexEntryMap.clear();
+    _hasAllowedIndexEntries.store(false);
 }
 
 }  // namespace mongo
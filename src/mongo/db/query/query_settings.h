@@ -39,6 +39,7 @@
 #include "mongo/db/query/canonical_query.h"
 #include "mongo/db/query/index_entry.h"
 #include "mongo/db/query/plan_cache.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/mutex.h"
 #include "mongo/stdx/unordered_map.h"
 
@@ -149,6 +150,11 @@ private:
         stdx::unordered_map<CanonicalQuery::QueryShapeString, AllowedIndexEntry>;
     AllowedIndexEntryMap _allowedIndexEntryMap;
 
+    // True whenever '_allowedIndexEntryMap' is non-empty. Index filters are consulted during
+    // every plan enumeration but are almost never set, so this lets getAllowedIndicesFilter()
+    // skip the mutex entirely in the common case. Only written while holding '_mutex'.
+    AtomicWord<bool> _hasAllowedIndexEntries{false};
+
     /**
      * Protects data in query settings.
      */
@@ -497,6 +497,17 @@ void FetchNode::appendToString(mongoutils::str::stream* ss, int indent) const {
         filter->debugString(sb, indent + 2);
         *ss << sb.str();
     }
+    if (!neededFields.empty()) {
+        addIndent(ss, indent + 1);
+        *ss << "neededFields = [";
+        for (size_t i = 0; i < neededFields.size(); ++i) {
+            if (i > 0) {
+                *ss << ", ";
+            }
+            *ss << neededFields[i];
+        }
+        *ss << "]\n";
+    }
     addCommon(ss, indent);
     addIndent(ss, indent + 1);
     *ss << "Child:" << '\n';
@@ -508,6 +519,7 @@ QuerySolutionNode* FetchNode::clone() const {
     cloneBaseData(copy);
 
     copy->_sorts = this->_sorts;
+    copy->neededFields = this->neededFields;
 
     return copy;
 }
@@ -536,6 +548,10 @@ void IndexScanNode::appendToString(mongoutils::str::stream* ss, int indent) cons
     }
     addIndent(ss, indent + 1);
     *ss << "direction = " << direction << '\n';
+    if (neededKeyPrefixLength >= 0) {
+        addIndent(ss, indent + 1);
+        *ss << "neededKeyPrefixLength = " << neededKeyPrefixLength << '\n';
+    }
     addIndent(ss, indent + 1);
     *ss << "bounds = " << bounds.toString() << '\n';
     addCommon(ss, indent);
@@ -822,6 +838,7 @@ QuerySolutionNode* IndexScanNode::clone() const {
     copy->_sorts = this->_sorts;
     copy->direction = this->direction;
     copy->addKeyMetadata = this->addKeyMetadata;
+    copy->neededKeyPrefixLength = this->neededKeyPrefixLength;
     copy->bounds = this->bounds;
     copy->queryCollator = this->queryCollator;
 
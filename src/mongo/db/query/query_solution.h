@@ -463,6 +463,11 @@ struct FetchNode : public QuerySolutionNode {
     QuerySolutionNode* clone() const;
 
     BSONObjSet _sorts;
+
+    // If non-empty, the plan above this fetch needs only these top-level fields of the fetched
+    // document, so the fetch may return a document trimmed down to them. Set by projection
+    // analysis when a simple inclusion projection sits directly over a filterless fetch.
+    std::vector<std::string> neededFields;
 };
 
 struct IndexScanNode : public QuerySolutionNode {
@@ -507,6 +512,11 @@ struct IndexScanNode : public QuerySolutionNode {
     // If there's a 'returnKey' projection we add key metadata.
     bool addKeyMetadata;
 
+    // If non-negative, set by projection analysis when a covered projection sits directly over
+    // this scan and consumes only this many leading fields of the index key. Allows the scan to
+    // return keys decoded to just that prefix.
+    int neededKeyPrefixLength = -1;
+
     bool shouldDedup = false;
 
     IndexBounds bounds;
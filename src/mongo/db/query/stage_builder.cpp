@@ -107,6 +107,7 @@ PlanStage* buildStages(OperationContext* opCtx,
             params.direction = ixn->direction;
             params.addKeyMetadata = ixn->addKeyMetadata;
             params.shouldDedup = ixn->shouldDedup;
+            params.neededKeyPrefixLength = ixn->neededKeyPrefixLength;
             return new IndexScan(opCtx, std::move(params), ws, ixn->filter.get());
         }
         case STAGE_FETCH: {
@@ -115,7 +116,8 @@ PlanStage* buildStages(OperationContext* opCtx,
             if (nullptr == childStage) {
                 return nullptr;
             }
-            return new FetchStage(opCtx, ws, childStage, fn->filter.get(), collection);
+            return new FetchStage(
+                opCtx, ws, childStage, fn->filter.get(), collection, fn->neededFields);
         }
         case STAGE_SORT: {
             const SortNode* sn = static_cast<const SortNode*>(root);
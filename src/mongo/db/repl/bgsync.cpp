@@ -61,6 +61,7 @@
 #include "mongo/stdx/memory.h"
 #include "mongo/util/log.h"
 #include "mongo/util/mongoutils/str.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
@@ -80,6 +81,13 @@ const auto defaultBatchSize = (16 * 1024 * 1024) / 12 * 10;
 // The batchSize to use for the find/getMore queries called by the OplogFetcher
 MONGO_EXPORT_STARTUP_SERVER_PARAMETER(bgSyncOplogFetcherBatchSize, int, defaultBatchSize);
 
+// The number of fetched oplog batches that may be buffered between the oplog fetcher and the
+// oplog buffer. When greater than zero, the fetcher issues its next getMore while previously
+// fetched batches are still being pushed into the oplog buffer by a dedicated thread, hiding the
+// sync source round trip behind buffer insertion. Zero (the default) retains the synchronous
+// behavior of enqueueing each batch before requesting the next one.
+MONGO_EXPORT_STARTUP_SERVER_PARAMETER(bgSyncOplogFetcherPipelineDepth, int, 0);
+
 // The batchSize to use for the find/getMore queries called by the rollback common point resolver.
 // A batchSize of 0 means that the 'find' and 'getMore' commands will be given no batchSize.
 // We set the default to 2000 to prevent the sync source from having to read too much data at once,
@@ -464,6 +472,31 @@ void BackgroundSync::_produce() {
         fassertFailedWithStatus(34440, exceptionToStatus());
     }
 
+    // When pipelining is enabled, fetched batches are pushed into the oplog buffer by a dedicated
+    // thread so that the fetcher can keep the next getMore in flight. The thread lives for the
+    // duration of this fetcher run and drains any parked batches before exiting.
+    stdx::thread batchEnqueuer;
+    if (bgSyncOplogFetcherPipelineDepth > 0) {
+        {
+            stdx::lock_guard<stdx::mutex> lock(_batchQueueMutex);
+            invariant(_batchQueue.empty());
+            _batchQueueDraining = false;
+            _batchEnqueueStatus = Status::OK();
+        }
+        batchEnqueuer = stdx::thread([this] { _drainBatchQueue(); });
+    }
+    ON_BLOCK_EXIT([&] {
+        if (batchEnqueuer.joinable()) {
+            {
+                stdx::lock_guard<stdx::mutex> lock(_batchQueueMutex);
+                _batchQueueDraining = true;
+            }
+            _batchQueueDataCV.notify_all();
+            _batchQueueSpaceCV.notify_all();
+            batchEnqueuer.join();
+        }
+    });
+
     const auto logLevel = getTestCommandsEnabled() ? 0 : 1;
     LOG(logLevel) << "scheduling fetcher to read remote oplog on " << source << " starting at "
                   << oplogFetcher->getFindQuery_forTest()["filter"];
@@ -513,6 +546,73 @@ void BackgroundSync::_produce() {
 Status BackgroundSync::_enqueueDocuments(Fetcher::Documents::const_iterator begin,
                                          Fetcher::Documents::const_iterator end,
                                          const OplogFetcher::DocumentsInfo& info) {
+    if (bgSyncOplogFetcherPipelineDepth <= 0) {
+        return _enqueueDocumentsBlocking(begin, end, info);
+    }
+
+    // Park the batch for the drain thread so that the fetcher can issue the next getMore
+    // immediately. The documents must be owned copies because the fetcher's response buffer dies
+    // when this callback returns.
+    FetchedBatch batch;
+    batch.info = info;
+    batch.docs.reserve(std::distance(begin, end));
+    for (auto it = begin; it != end; ++it) {
+        batch.docs.push_back(it->getOwned());
+    }
+
+    stdx::unique_lock<stdx::mutex> lock(_batchQueueMutex);
+    _batchQueueSpaceCV.wait(lock, [&] {
+        return !_batchEnqueueStatus.isOK() || _batchQueueDraining ||
+            _batchQueue.size() < static_cast<size_t>(bgSyncOplogFetcherPipelineDepth);
+    });
+    if (!_batchEnqueueStatus.isOK()) {
+        // A previously parked batch failed to enqueue; report that failure to the fetcher.
+        return _batchEnqueueStatus;
+    }
+    if (_batchQueueDraining) {
+        // The fetcher is shutting down and about to be joined; drop the batch as the
+        // synchronous path does when the producer has stopped.
+        return Status::OK();
+    }
+    _batchQueue.push_back(std::move(batch));
+    _batchQueueDataCV.notify_one();
+    return Status::OK();
+}
+
+void BackgroundSync::_drainBatchQueue() {
+    Client::initThread("rsBackgroundSyncEnqueuer");
+
+    while (true) {
+        FetchedBatch batch;
+        {
+            stdx::unique_lock<stdx::mutex> lock(_batchQueueMutex);
+            _batchQueueDataCV.wait(
+                lock, [&] { return _batchQueueDraining || !_batchQueue.empty(); });
+            if (_batchQueue.empty()) {
+                invariant(_batchQueueDraining);
+                return;
+            }
+            batch = std::move(_batchQueue.front());
+            _batchQueue.pop_front();
+        }
+
+        auto status = _enqueueDocumentsBlocking(batch.docs.cbegin(), batch.docs.cend(), batch.info);
+
+        stdx::lock_guard<stdx::mutex> lock(_batchQueueMutex);
+        if (!status.isOK()) {
+            // Remember the failure so the fetcher sees it on its next batch, and stop draining.
+            _batchEnqueueStatus = status;
+            _batchQueue.clear();
+            _batchQueueSpaceCV.notify_all();
+            return;
+        }
+        _batchQueueSpaceCV.notify_all();
+    }
+}
+
+Status BackgroundSync::_enqueueDocumentsBlocking(Fetcher::Documents::const_iterator begin,
+                                                 Fetcher::Documents::const_iterator end,
+                                                 const OplogFetcher::DocumentsInfo& info) {
     // If this is the first batch of operations returned from the query, "toApplyDocumentCount" will
     // be one fewer than "networkDocumentCount" because the first document (which was applied
     // previously) is skipped.
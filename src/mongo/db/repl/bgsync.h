@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
 
 #include "mongo/base/disallow_copying.h"
@@ -164,6 +165,22 @@ private:
                              Fetcher::Documents::const_iterator end,
                              const OplogFetcher::DocumentsInfo& info);
 
+    /**
+     * Waits for buffer space and pushes the batch into the oplog buffer. Called directly by
+     * _enqueueDocuments when pipelining is disabled, and by the batch queue drain thread
+     * otherwise.
+     */
+    Status _enqueueDocumentsBlocking(Fetcher::Documents::const_iterator begin,
+                                     Fetcher::Documents::const_iterator end,
+                                     const OplogFetcher::DocumentsInfo& info);
+
+    /**
+     * Body of the batch queue drain thread started by _produce when
+     * bgSyncOplogFetcherPipelineDepth > 0. Pushes pending batches into the oplog buffer until
+     * _batchQueueDraining is set and the queue is empty, or an enqueue fails.
+     */
+    void _drainBatchQueue();
+
     /**
      * Executes a rollback.
      */
@@ -260,6 +277,24 @@ private:
     // Current oplog fetcher tailing the oplog on the sync source.
     std::unique_ptr<OplogFetcher> _oplogFetcher;
 
+    // A fetched batch parked between the oplog fetcher and the oplog buffer while the next
+    // getMore is already in flight.
+    struct FetchedBatch {
+        Fetcher::Documents docs;
+        OplogFetcher::DocumentsInfo info;
+    };
+
+    // Pipeline between the oplog fetcher and the oplog buffer, used when
+    // bgSyncOplogFetcherPipelineDepth > 0. All of the following are guarded by _batchQueueMutex,
+    // which is never held together with _mutex. The queue and flags are reset by _produce before
+    // each fetcher run.
+    stdx::mutex _batchQueueMutex;
+    stdx::condition_variable _batchQueueSpaceCV;
+    stdx::condition_variable _batchQueueDataCV;
+    std::deque<FetchedBatch> _batchQueue;
+    bool _batchQueueDraining = false;
+    Status _batchEnqueueStatus = Status::OK();
+
     // Current rollback process. If this component is active, we are currently reverting local
     // operations in the local oplog in order to bring this server to a consistent state relative
     // to the sync source.
@@ -34,6 +34,7 @@
 
 #include "mongo/db/repl/collection_cloner.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "mongo/base/string_data.h"
@@ -73,6 +74,10 @@ MONGO_EXPORT_SERVER_PARAMETER(numInitialSyncCollectionCountAttempts, int, 3);
 MONGO_EXPORT_SERVER_PARAMETER(numInitialSyncListIndexesAttempts, int, 3);
 // The number of attempts for the find command, which gets the data.
 MONGO_EXPORT_SERVER_PARAMETER(numInitialSyncCollectionFindAttempts, int, 3);
+// The number of fetched batches which may be buffered ahead of the storage inserts. This is what
+// allows the network stream to keep flowing while a batch is being inserted and its index keys
+// generated, while still bounding memory if storage falls behind.
+MONGO_EXPORT_SERVER_PARAMETER(collectionClonerMaxPendingInsertBatches, int, 2);
 // Whether to use the "exhaust cursor" feature when retrieving collection data.
 MONGO_EXPORT_STARTUP_SERVER_PARAMETER(collectionClonerUsesExhaust, bool, true);
 }  // namespace
@@ -270,6 +275,8 @@ void CollectionCloner::_cancelRemainingWork_inlock() {
     } else {
         _queryState = QueryState::kFinished;
     }
+    // Wake the query thread if it is waiting for the insert pipeline to drain.
+    _condition.notify_all();
     _dbWorkTaskRunner.cancel();
 }
 
@@ -596,7 +603,14 @@ void CollectionCloner::_handleNextBatch(std::shared_ptr<OnCompletionGuard> onCom
                                         DBClientCursorBatchIterator& iter) {
     _stats.receivedBatches++;
     {
-        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        // If storage has fallen behind, wait for the insert pipeline to drain before buffering
+        // more documents.
+        const int maxPendingBatches = std::max(1, collectionClonerMaxPendingInsertBatches.load());
+        while (_pendingInsertBatches >= maxPendingBatches &&
+               _queryState != QueryState::kCanceling) {
+            _condition.wait(lk);
+        }
         uassert(ErrorCodes::CallbackCanceled,
                 "Collection cloning cancelled.",
                 _queryState != QueryState::kCanceling);
@@ -604,6 +618,8 @@ void CollectionCloner::_handleNextBatch(std::shared_ptr<OnCompletionGuard> onCom
             BSONObj o = iter.nextSafe();
             _documentsToInsert.emplace_back(std::move(o));
         }
+        // Account for the insert task scheduled below.
+        ++_pendingInsertBatches;
     }
 
     // Schedule the next document batch insertion.
@@ -697,6 +713,14 @@ void CollectionCloner::_verifyCollectionWasDropped(
 void CollectionCloner::_insertDocumentsCallback(
     const executor::TaskExecutor::CallbackArgs& cbd,
     std::shared_ptr<OnCompletionGuard> onCompletionGuard) {
+    // Wake the query thread if it is waiting for the insert pipeline to drain, whichever way
+    // this callback exits.
+    ON_BLOCK_EXIT([this] {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        --_pendingInsertBatches;
+        _condition.notify_all();
+    });
+
     if (!cbd.status.isOK()) {
         stdx::lock_guard<stdx::mutex> lock(_mutex);
         onCompletionGuard->setResultAndCancelRemainingWork_inlock(lock, cbd.status);
@@ -714,7 +738,15 @@ void CollectionCloner::_insertDocumentsCallback(
     ++_stats.fetchedBatches;
     _progressMeter.hit(int(docs.size()));
     invariant(_collLoader);
+
+    // Insert the documents and generate their index keys with the mutex released, so the query
+    // thread can keep receiving and buffering batches from the network instead of blocking in
+    // _handleNextBatch until storage catches up. Access to '_collLoader' itself is serialized by
+    // the db work task runner, not by '_mutex'; _finishCallback likewise commits it outside the
+    // lock once all insert tasks have drained.
+    lk.unlock();
     const auto status = _collLoader->insertDocuments(docs.cbegin(), docs.cend());
+    lk.lock();
     if (!status.isOK()) {
         onCompletionGuard->setResultAndCancelRemainingWork_inlock(lk, status);
         return;
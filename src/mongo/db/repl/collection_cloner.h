@@ -275,6 +275,8 @@ private:
     std::vector<BSONObj> _indexSpecs;             // (M)
     BSONObj _idIndexSpec;                         // (M)
     std::vector<BSONObj> _documentsToInsert;      // (M) Documents read from source to insert.
+    int _pendingInsertBatches = 0;  // (M) Insert batches scheduled but not yet completed. Bounds
+                                    // how far the network stream may run ahead of storage.
     TaskRunner _dbWorkTaskRunner;                 // (R)
     ScheduleDbWorkFn
         _scheduleDbWorkFn;  // (RT) Function for scheduling database work using the executor.
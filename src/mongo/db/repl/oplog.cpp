@@ -130,11 +130,16 @@ struct LocalOplogInfo {
     // Synchronizes the section where a new Timestamp is generated and when it is registered in the
     // storage engine.
     stdx::mutex newOpMutex;
-
-    // Used to generate "h" fields in pv0. Synchronized by newOpMutex.
-    PseudoRandom hashGenerator{std::unique_ptr<SecureRandom>(SecureRandom::create())->nextInt64()};
 };
 
+// Used to generate "h" fields. Each thread seeds its own generator so hashes can be produced
+// outside the timestamp-allocation critical section.
+int64_t generateOplogEntryHash() {
+    static thread_local PseudoRandom hashGenerator(
+        std::unique_ptr<SecureRandom>(SecureRandom::create())->nextInt64());
+    return hashGenerator.nextInt64();
+}
+
 const auto localOplogInfo = ServiceContext::declareDecoration<LocalOplogInfo>();
 
 // so we can fail the same way
@@ -159,18 +164,24 @@ void _getNextOpTimes(OperationContext* opCtx,
 
     // Allow the storage engine to start the transaction outside the critical section.
     opCtx->recoveryUnit()->preallocateSnapshot();
-    stdx::lock_guard<stdx::mutex> lk(oplogInfo.newOpMutex);
+    Timestamp ts;
+    {
+        stdx::lock_guard<stdx::mutex> lk(oplogInfo.newOpMutex);
 
-    auto ts = LogicalClock::get(opCtx)->reserveTicks(count).asTimestamp();
-    const bool orderedCommit = false;
+        ts = LogicalClock::get(opCtx)->reserveTicks(count).asTimestamp();
+        const bool orderedCommit = false;
 
-    if (persist) {
-        fassert(28560, oplog->getRecordStore()->oplogDiskLocRegister(opCtx, ts, orderedCommit));
+        if (persist) {
+            fassert(28560,
+                    oplog->getRecordStore()->oplogDiskLocRegister(opCtx, ts, orderedCommit));
+        }
     }
 
+    // Filling out the slots only uses thread-local state, so keep it out of the critical section
+    // that all oplog writers serialize on.
     for (std::size_t i = 0; i < count; i++) {
         slotsOut[i].opTime = {Timestamp(ts.asULL() + i), term};
-        slotsOut[i].hash = oplogInfo.hashGenerator.nextInt64();
+        slotsOut[i].hash = generateOplogEntryHash();
     }
 }
 
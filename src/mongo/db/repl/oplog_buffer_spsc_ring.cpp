@@ -0,0 +1,320 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/repl/oplog_buffer_spsc_ring.h"
+
+#include "mongo/platform/pause.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+namespace repl {
+
+namespace {
+
+// Limit buffer to 256MB, matching OplogBufferBlockingQueue.
+const size_t kOplogBufferSize = 256 * 1024 * 1024;
+
+// Number of slots in the ring; must be a power of two. The slot count additionally bounds the
+// number of buffered entries: for entries smaller than kOplogBufferSize / kRingSlots bytes (~2KB)
+// it becomes the binding constraint, which still leaves over a hundred thousand entries of slack
+// ahead of the applier.
+const size_t kRingSlots = 128 * 1024;
+
+// Iterations of the spin phase before the kHybrid wait strategy parks.
+const size_t kSpinLimit = 1000;
+
+size_t getDocumentSize(const BSONObj& o) {
+    // SERVER-9808 Avoid Fortify complaint about implicit signed->unsigned conversion
+    return static_cast<size_t>(o.objsize());
+}
+
+}  // namespace
+
+OplogBufferSpscRing::OplogBufferSpscRing() : OplogBufferSpscRing(nullptr) {}
+OplogBufferSpscRing::OplogBufferSpscRing(Counters* counters, WaitStrategy waitStrategy)
+    : _counters(counters), _waitStrategy(waitStrategy), _ring(kRingSlots) {}
+
+void OplogBufferSpscRing::startup(OperationContext*) {
+    // Update server status metric to reflect the current oplog buffer's max size.
+    if (_counters) {
+        _counters->setMaxSize(getMaxSize());
+    }
+}
+
+void OplogBufferSpscRing::shutdown(OperationContext* opCtx) {
+    clear(opCtx);
+}
+
+void OplogBufferSpscRing::pushEvenIfFull(OperationContext*, const Value& value) {
+    // Per the interface contract this ignores the byte budget. A free slot is still required, but
+    // the ring is sized so that the byte budget is exhausted long before the slots are for any
+    // realistic entry mix; a full ring here would require pacing failures well beyond what
+    // waitForSpace() permits.
+    _waitUntil([&] { return _tail.load() - _head.load() < kRingSlots; },
+               &_producerWaiting,
+               &_notFullCV,
+               Date_t::max());
+    _emplace(value);
+}
+
+void OplogBufferSpscRing::push(OperationContext*, const Value& value) {
+    const auto size = getDocumentSize(value);
+    _waitUntil(
+        [&] {
+            return _tail.load() - _head.load() < kRingSlots &&
+                _size.load() + size <= kOplogBufferSize;
+        },
+        &_producerWaiting,
+        &_notFullCV,
+        Date_t::max());
+    _emplace(value);
+}
+
+void OplogBufferSpscRing::pushAllNonBlocking(OperationContext*,
+                                             Batch::const_iterator begin,
+                                             Batch::const_iterator end) {
+    if (begin == end) {
+        return;
+    }
+
+    auto tail = _tail.load();
+    std::size_t bytes = 0;
+    for (auto i = begin; i != end; ++i) {
+        if (tail - _head.load() >= kRingSlots) {
+            // Publish what we have so far so the consumer can drain slots while we wait for one.
+            // Callers pace themselves with waitForSpace(), which tracks the byte budget, so this
+            // can only trigger for entry mixes far below the budget-to-slot ratio.
+            _tail.store(tail);
+            _size.fetchAndAdd(bytes);
+            bytes = 0;
+            _wakeConsumerIfWaiting();
+            _waitUntil([&] { return tail - _head.load() < kRingSlots; },
+                       &_producerWaiting,
+                       &_notFullCV,
+                       Date_t::max());
+        }
+
+        _ring[tail % kRingSlots] = *i;
+        bytes += getDocumentSize(*i);
+        ++tail;
+    }
+
+    {
+        stdx::lock_guard<stdx::mutex> lk(_lastPushedMutex);
+        _lastPushed = *(end - 1);
+    }
+
+    // A single store publishes the whole batch to the consumer.
+    _tail.store(tail);
+    _size.fetchAndAdd(bytes);
+    if (_counters) {
+        for (auto i = begin; i != end; ++i) {
+            _counters->increment(*i);
+        }
+    }
+    _wakeConsumerIfWaiting();
+}
+
+void OplogBufferSpscRing::waitForSpace(OperationContext*, std::size_t size) {
+    _waitUntil([&] { return _size.load() + size <= kOplogBufferSize; },
+               &_producerWaiting,
+               &_notFullCV,
+               Date_t::max());
+}
+
+bool OplogBufferSpscRing::isEmpty() const {
+    return _head.load() == _tail.load();
+}
+
+std::size_t OplogBufferSpscRing::getMaxSize() const {
+    return kOplogBufferSize;
+}
+
+std::size_t OplogBufferSpscRing::getSize() const {
+    return _size.load();
+}
+
+std::size_t OplogBufferSpscRing::getCount() const {
+    return _tail.load() - _head.load();
+}
+
+void OplogBufferSpscRing::clear(OperationContext*) {
+    // Acts as the consumer: drains every entry published at the time of the call. The producer
+    // must be quiescent, see the class comment.
+    auto head = _head.load();
+    const auto tail = _tail.load();
+    std::size_t bytes = 0;
+    while (head != tail) {
+        auto& slot = _ring[head % kRingSlots];
+        bytes += getDocumentSize(slot);
+        slot = Value();
+        ++head;
+    }
+    _head.store(head);
+    _size.fetchAndSubtract(bytes);
+
+    {
+        stdx::lock_guard<stdx::mutex> lk(_lastPushedMutex);
+        _lastPushed = Value();
+    }
+
+    if (_counters) {
+        _counters->clear();
+    }
+    _wakeProducerIfWaiting();
+}
+
+bool OplogBufferSpscRing::tryPop(OperationContext*, Value* value) {
+    const auto head = _head.load();
+    if (head == _tail.load()) {
+        return false;
+    }
+
+    auto& slot = _ring[head % kRingSlots];
+    *value = std::move(slot);
+    // Release the slot's buffer before handing it back to the producer.
+    slot = Value();
+    _head.store(head + 1);
+    _size.fetchAndSubtract(getDocumentSize(*value));
+    if (_counters) {
+        _counters->decrement(*value);
+    }
+    _wakeProducerIfWaiting();
+    return true;
+}
+
+bool OplogBufferSpscRing::waitForData(Seconds waitDuration) {
+    return _waitUntil([&] { return _head.load() != _tail.load(); },
+                      &_consumerWaiting,
+                      &_notEmptyCV,
+                      Date_t::now() + waitDuration);
+}
+
+bool OplogBufferSpscRing::peek(OperationContext*, Value* value) {
+    const auto head = _head.load();
+    if (head == _tail.load()) {
+        return false;
+    }
+
+    *value = _ring[head % kRingSlots];
+    return true;
+}
+
+boost::optional<OplogBuffer::Value> OplogBufferSpscRing::lastObjectPushed(
+    OperationContext*) const {
+    stdx::lock_guard<stdx::mutex> lk(_lastPushedMutex);
+    if (_head.load() == _tail.load()) {
+        return {};
+    }
+
+    // Entries pop in FIFO order, so if the buffer is non-empty the most recently pushed entry is
+    // still in it.
+    return {_lastPushed};
+}
+
+void OplogBufferSpscRing::_emplace(const Value& value) {
+    const auto tail = _tail.load();
+    invariant(tail - _head.load() < kRingSlots);
+    _ring[tail % kRingSlots] = value;
+
+    {
+        stdx::lock_guard<stdx::mutex> lk(_lastPushedMutex);
+        _lastPushed = value;
+    }
+
+    _tail.store(tail + 1);
+    _size.fetchAndAdd(getDocumentSize(value));
+    if (_counters) {
+        _counters->increment(value);
+    }
+    _wakeConsumerIfWaiting();
+}
+
+template <typename Pred>
+bool OplogBufferSpscRing::_waitUntil(Pred pred,
+                                     AtomicWord<bool>* waiting,
+                                     stdx::condition_variable* cv,
+                                     Date_t deadline) {
+    if (pred()) {
+        return true;
+    }
+
+    if (_waitStrategy != WaitStrategy::kPark) {
+        for (std::size_t i = 0; i < kSpinLimit; ++i) {
+            MONGO_YIELD_CORE_FOR_SMT();
+            if (pred()) {
+                return true;
+            }
+        }
+
+        if (_waitStrategy == WaitStrategy::kSpin) {
+            // Only consult the clock once per spin round to keep the loop cheap.
+            while (deadline == Date_t::max() || Date_t::now() < deadline) {
+                for (std::size_t i = 0; i < kSpinLimit; ++i) {
+                    MONGO_YIELD_CORE_FOR_SMT();
+                    if (pred()) {
+                        return true;
+                    }
+                }
+            }
+            return pred();
+        }
+    }
+
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    waiting->store(true);
+    bool result = true;
+    if (deadline == Date_t::max()) {
+        cv->wait(lk, pred);
+    } else {
+        result = cv->wait_until(lk, deadline.toSystemTimePoint(), pred);
+    }
+    waiting->store(false);
+    return result;
+}
+
+void OplogBufferSpscRing::_wakeConsumerIfWaiting() {
+    if (MONGO_unlikely(_consumerWaiting.load())) {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _notEmptyCV.notify_one();
+    }
+}
+
+void OplogBufferSpscRing::_wakeProducerIfWaiting() {
+    if (MONGO_unlikely(_producerWaiting.load())) {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _notFullCV.notify_one();
+    }
+}
+
+}  // namespace repl
+}  // namespace mongo
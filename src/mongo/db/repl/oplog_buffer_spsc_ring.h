@@ -0,0 +1,149 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "mongo/db/repl/oplog_buffer.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/new.h"
+
+namespace mongo {
+namespace repl {
+
+/**
+ * Oplog buffer backed by a fixed-capacity lock-free single-producer/single-consumer ring of
+ * BSONObj.
+ *
+ * The oplog fetcher (producer) and the applier batcher (consumer) communicate only through the
+ * producer-owned tail index and the consumer-owned head index, so steady-state pushes and pops
+ * never take a lock. The indices live on separate cache lines to avoid false sharing between the
+ * two threads. The mutex/condition-variable pair is only touched when a side actually has to
+ * wait, according to the configured wait strategy.
+ *
+ * Like all OplogBuffer implementations, this supports exactly one pushing thread and one popping
+ * thread. clear() (and therefore shutdown()) must only be called once the producer is quiescent.
+ */
+class OplogBufferSpscRing final : public OplogBuffer {
+public:
+    enum class WaitStrategy {
+        // Busy-wait with processor pause hints until the awaited condition holds.
+        kSpin,
+
+        // Park on a condition variable right away.
+        kPark,
+
+        // Spin briefly to catch the common case where the other side is actively making
+        // progress, then park. This is the default.
+        kHybrid,
+    };
+
+    OplogBufferSpscRing();
+    explicit OplogBufferSpscRing(Counters* counters,
+                                 WaitStrategy waitStrategy = WaitStrategy::kHybrid);
+
+    void startup(OperationContext* opCtx) override;
+    void shutdown(OperationContext* opCtx) override;
+    void pushEvenIfFull(OperationContext* opCtx, const Value& value) override;
+    void push(OperationContext* opCtx, const Value& value) override;
+    void pushAllNonBlocking(OperationContext* opCtx,
+                            Batch::const_iterator begin,
+                            Batch::const_iterator end) override;
+    void waitForSpace(OperationContext* opCtx, std::size_t size) override;
+    bool isEmpty() const override;
+    std::size_t getMaxSize() const override;
+    std::size_t getSize() const override;
+    std::size_t getCount() const override;
+    void clear(OperationContext* opCtx) override;
+    bool tryPop(OperationContext* opCtx, Value* value) override;
+    bool waitForData(Seconds waitDuration) override;
+    bool peek(OperationContext* opCtx, Value* value) override;
+    boost::optional<Value> lastObjectPushed(OperationContext* opCtx) const override;
+
+private:
+    /**
+     * Writes 'value' into the next free slot and publishes it to the consumer. The caller must
+     * have established that a free slot exists.
+     */
+    void _emplace(const Value& value);
+
+    /**
+     * Waits until pred() holds or 'deadline' passes, per the configured wait strategy. 'waiting'
+     * is the flag the opposite side checks after publishing to decide whether it must notify
+     * 'cv'. Returns the final value of pred().
+     */
+    template <typename Pred>
+    bool _waitUntil(Pred pred,
+                    AtomicWord<bool>* waiting,
+                    stdx::condition_variable* cv,
+                    Date_t deadline);
+
+    void _wakeConsumerIfWaiting();
+    void _wakeProducerIfWaiting();
+
+    Counters* const _counters;
+    const WaitStrategy _waitStrategy;
+
+    std::vector<Value> _ring;
+
+    // Monotonically increasing indices; the slot for index i is i modulo the ring capacity. Each
+    // lives on its own cache line so the producer and consumer don't false-share, as does the
+    // byte-size counter both sides update.
+    alignas(stdx::hardware_destructive_interference_size) AtomicWord<std::size_t> _tail{0};
+    alignas(stdx::hardware_destructive_interference_size) AtomicWord<std::size_t> _head{0};
+    alignas(stdx::hardware_destructive_interference_size) AtomicWord<std::size_t> _size{0};
+
+    // Set while the respective side is parked on its condition variable. The opposite side checks
+    // the flag after publishing an index update to decide whether it must take _mutex and notify.
+    // Both the flag accesses and the index publishes use AtomicWord's sequentially consistent
+    // defaults, which makes the store/load pairs on the two threads a valid Dekker-style
+    // handshake: either the publisher sees the flag and notifies under the mutex, or its update
+    // is visible to the waiter's final predicate check before parking.
+    AtomicWord<bool> _producerWaiting{false};
+    AtomicWord<bool> _consumerWaiting{false};
+
+    // Only taken when a side parks or wakes the other; never on the push/pop fast paths.
+    stdx::mutex _mutex;
+    stdx::condition_variable _notEmptyCV;
+    stdx::condition_variable _notFullCV;
+
+    // Copy of the most recently pushed entry for lastObjectPushed(). The guarding mutex is only
+    // taken by the producer and by lastObjectPushed() callers, never by the popper, so it is
+    // uncontended in steady state.
+    mutable stdx::mutex _lastPushedMutex;
+    Value _lastPushed;
+};
+
+}  // namespace repl
+}  // namespace mongo
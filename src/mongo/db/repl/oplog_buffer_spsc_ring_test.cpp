@@ -0,0 +1,186 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <boost/optional/optional_io.hpp>
+
+#include "mongo/db/jsobj.h"
+#include "mongo/db/repl/oplog_buffer_spsc_ring.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/unittest.h"
+
+namespace {
+
+using namespace mongo;
+using namespace mongo::repl;
+
+class OplogBufferSpscRingTest : public unittest::Test {
+protected:
+    OplogBufferSpscRing _buffer;
+    OperationContext* _opCtx = nullptr;
+};
+
+TEST_F(OplogBufferSpscRingTest, StartsEmpty) {
+    ASSERT_TRUE(_buffer.isEmpty());
+    ASSERT_EQUALS(0U, _buffer.getCount());
+    ASSERT_EQUALS(0U, _buffer.getSize());
+
+    OplogBuffer::Value value;
+    ASSERT_FALSE(_buffer.tryPop(_opCtx, &value));
+    ASSERT_FALSE(_buffer.peek(_opCtx, &value));
+    ASSERT_EQUALS(boost::none, _buffer.lastObjectPushed(_opCtx));
+}
+
+TEST_F(OplogBufferSpscRingTest, PushAndPopPreserveFifoOrder) {
+    auto first = BSON("x" << 1);
+    auto second = BSON("x" << 2);
+    _buffer.push(_opCtx, first);
+    _buffer.push(_opCtx, second);
+    ASSERT_EQUALS(2U, _buffer.getCount());
+    ASSERT_EQUALS(std::size_t(first.objsize() + second.objsize()), _buffer.getSize());
+
+    OplogBuffer::Value value;
+    ASSERT_TRUE(_buffer.tryPop(_opCtx, &value));
+    ASSERT_BSONOBJ_EQ(first, value);
+    ASSERT_TRUE(_buffer.tryPop(_opCtx, &value));
+    ASSERT_BSONOBJ_EQ(second, value);
+    ASSERT_TRUE(_buffer.isEmpty());
+    ASSERT_EQUALS(0U, _buffer.getSize());
+}
+
+TEST_F(OplogBufferSpscRingTest, PeekReturnsFrontWithoutRemoving) {
+    auto pushValue = BSON("x" << 1);
+    _buffer.push(_opCtx, pushValue);
+
+    OplogBuffer::Value peekValue;
+    ASSERT_TRUE(_buffer.peek(_opCtx, &peekValue));
+    ASSERT_BSONOBJ_EQ(pushValue, peekValue);
+    ASSERT_EQUALS(1U, _buffer.getCount());
+}
+
+TEST_F(OplogBufferSpscRingTest, LastObjectPushedReturnsNewestEntry) {
+    OplogBuffer::Batch values = {BSON("x" << 1), BSON("x" << 2), BSON("x" << 3)};
+    _buffer.pushAllNonBlocking(_opCtx, values.cbegin(), values.cend());
+
+    auto lastObjPushed = _buffer.lastObjectPushed(_opCtx);
+    ASSERT_NOT_EQUALS(boost::none, lastObjPushed);
+    ASSERT_BSONOBJ_EQ(values.back(), *lastObjPushed);
+
+    // Draining the buffer makes lastObjectPushed() return none again.
+    OplogBuffer::Value value;
+    while (_buffer.tryPop(_opCtx, &value)) {
+    }
+    ASSERT_EQUALS(boost::none, _buffer.lastObjectPushed(_opCtx));
+}
+
+TEST_F(OplogBufferSpscRingTest, PushAllNonBlockingPushesInOrder) {
+    OplogBuffer::Batch values = {BSON("x" << 1), BSON("x" << 2), BSON("x" << 3)};
+    _buffer.pushAllNonBlocking(_opCtx, values.cbegin(), values.cend());
+    ASSERT_EQUALS(values.size(), _buffer.getCount());
+
+    for (auto&& expected : values) {
+        OplogBuffer::Value value;
+        ASSERT_TRUE(_buffer.tryPop(_opCtx, &value));
+        ASSERT_BSONOBJ_EQ(expected, value);
+    }
+}
+
+TEST_F(OplogBufferSpscRingTest, ClearEmptiesBuffer) {
+    OplogBuffer::Batch values = {BSON("x" << 1), BSON("x" << 2)};
+    _buffer.pushAllNonBlocking(_opCtx, values.cbegin(), values.cend());
+    ASSERT_FALSE(_buffer.isEmpty());
+
+    _buffer.clear(_opCtx);
+    ASSERT_TRUE(_buffer.isEmpty());
+    ASSERT_EQUALS(0U, _buffer.getCount());
+    ASSERT_EQUALS(0U, _buffer.getSize());
+    ASSERT_EQUALS(boost::none, _buffer.lastObjectPushed(_opCtx));
+}
+
+TEST_F(OplogBufferSpscRingTest, WaitForDataTimesOutWhenEmpty) {
+    ASSERT_FALSE(_buffer.waitForData(Seconds(0)));
+}
+
+TEST_F(OplogBufferSpscRingTest, WaitForDataReturnsTrueWhenDataAvailable) {
+    _buffer.push(_opCtx, BSON("x" << 1));
+    ASSERT_TRUE(_buffer.waitForData(Seconds(10)));
+}
+
+TEST_F(OplogBufferSpscRingTest, ConcurrentProducerAndConsumerSeeAllEntriesInOrder) {
+    const int kNumEntries = 50000;
+
+    stdx::thread producer([&] {
+        for (int i = 0; i < kNumEntries; ++i) {
+            _buffer.push(nullptr, BSON("x" << i));
+        }
+    });
+
+    for (int i = 0; i < kNumEntries; ++i) {
+        OplogBuffer::Value value;
+        while (!_buffer.tryPop(nullptr, &value)) {
+            _buffer.waitForData(Seconds(10));
+        }
+        ASSERT_BSONOBJ_EQ(BSON("x" << i), value);
+    }
+
+    producer.join();
+    ASSERT_TRUE(_buffer.isEmpty());
+    ASSERT_EQUALS(0U, _buffer.getSize());
+}
+
+TEST_F(OplogBufferSpscRingTest, ConcurrentBatchProducerAndConsumer) {
+    const int kNumBatches = 500;
+    const int kBatchSize = 100;
+
+    stdx::thread producer([&] {
+        for (int batch = 0; batch < kNumBatches; ++batch) {
+            OplogBuffer::Batch values;
+            for (int i = 0; i < kBatchSize; ++i) {
+                values.push_back(BSON("x" << (batch * kBatchSize + i)));
+            }
+            _buffer.waitForSpace(nullptr, std::size_t(values.front().objsize()) * values.size());
+            _buffer.pushAllNonBlocking(nullptr, values.cbegin(), values.cend());
+        }
+    });
+
+    for (int i = 0; i < kNumBatches * kBatchSize; ++i) {
+        OplogBuffer::Value value;
+        while (!_buffer.tryPop(nullptr, &value)) {
+            _buffer.waitForData(Seconds(10));
+        }
+        ASSERT_BSONOBJ_EQ(BSON("x" << i), value);
+    }
+
+    producer.join();
+    ASSERT_TRUE(_buffer.isEmpty());
+}
+
+}  // namespace
@@ -65,6 +65,7 @@
 #include "mongo/db/repl/oplog.h"
 #include "mongo/db/repl/oplog_applier_impl.h"
 #include "mongo/db/repl/oplog_buffer_blocking_queue.h"
+#include "mongo/db/repl/oplog_buffer_spsc_ring.h"
 #include "mongo/db/repl/repl_settings.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/replication_process.h"
@@ -147,6 +148,11 @@ MONGO_EXPORT_SERVER_PARAMETER(oplogFetcherInitialSyncMaxFetcherRestarts, int, 10
         return Status::OK();
     });
 
+// Set this to buffer oplog entries between the fetcher and the applier in a lock-free
+// single-producer/single-consumer ring instead of the mutex-based blocking queue. The queue mutex
+// can become heavily contended at peak replication rates.
+MONGO_EXPORT_STARTUP_SERVER_PARAMETER(useSpscRingOplogBuffer, bool, false);
+
 // The count of items in the buffer
 OplogBuffer::Counters bufferGauge;
 ServerStatusMetricField<Counter64> displayBufferCount("repl.buffer.count", &bufferGauge.count);
@@ -240,7 +246,11 @@ void ReplicationCoordinatorExternalStateImpl::startSteadyStateReplication(
         return;
 
     invariant(replCoord);
-    _oplogBuffer = std::make_unique<OplogBufferBlockingQueue>(&bufferGauge);
+    if (useSpscRingOplogBuffer) {
+        _oplogBuffer = std::make_unique<OplogBufferSpscRing>(&bufferGauge);
+    } else {
+        _oplogBuffer = std::make_unique<OplogBufferBlockingQueue>(&bufferGauge);
+    }
 
     // No need to log OplogBuffer::startup because the blocking queue implementation
     // does not start any threads or access the storage layer.
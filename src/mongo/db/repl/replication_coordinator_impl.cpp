@@ -262,40 +262,34 @@ private:
 };
 
 void ReplicationCoordinatorImpl::WaiterList::add_inlock(WaiterType waiter) {
-    _list.push_back(waiter);
+    _waiters.emplace(waiter->opTime, waiter);
 }
 
-void ReplicationCoordinatorImpl::WaiterList::signalIf_inlock(
-    stdx::function<bool(WaiterType)> func) {
-    for (auto it = _list.begin(); it != _list.end();) {
-        if (!func(*it)) {
+void ReplicationCoordinatorImpl::WaiterList::signalIf_inlock(stdx::function<bool(WaiterType)> func,
+                                                             boost::optional<OpTime> opTimeBound) {
+    // The bound is re-checked on every iteration rather than cached as an end iterator, since
+    // notify() on a waiter may remove arbitrary other waiters from the list.
+    for (auto it = _waiters.begin();
+         it != _waiters.end() && (!opTimeBound || it->first <= *opTimeBound);) {
+        WaiterType waiter = it->second;
+        if (!func(waiter)) {
             // This element doesn't match, so we advance the iterator to the next one.
             ++it;
             continue;
         }
 
-        if (!(*it)->runs_once()) {
-            (*it)->notify_inlock();
+        if (!waiter->runs_once()) {
+            waiter->notify_inlock();
             // Keep the waiter on the list and let the guard remove it instead. Advance the
             // iterator since we are skipping the removal.
             ++it;
             continue;
         }
 
-        // Remove the waiter from the list if it was only meant to be notified once.
-        WaiterType waiter = std::move(*it);
-
-        if (it == std::prev(_list.end())) {
-            // Iterator will be invalid after erasing the last element, so set it to the
-            // next one (i.e. end()).
-            it = _list.erase(it);
-        } else {
-            // Iterator is still valid after pop_back().
-            std::swap(*it, _list.back());
-            _list.pop_back();
-        }
-        // It's important to call notify() after the waiter has been removed from the list
-        // since notify() might remove the waiter itself.
+        // Remove the waiter from the list if it was only meant to be notified once. It's
+        // important to call notify() after the waiter has been removed from the list since
+        // notify() might remove the waiter itself.
+        it = _waiters.erase(it);
         waiter->notify_inlock();
     }
 }
@@ -306,13 +300,14 @@ void ReplicationCoordinatorImpl::WaiterList::signalAll_inlock() {
 }
 
 bool ReplicationCoordinatorImpl::WaiterList::remove_inlock(WaiterType waiter) {
-    auto it = std::find(_list.begin(), _list.end(), waiter);
-    if (it == _list.end()) {
-        return false;
+    auto range = _waiters.equal_range(waiter->opTime);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == waiter) {
+            _waiters.erase(it);
+            return true;
+        }
     }
-    std::swap(*it, _list.back());
-    _list.pop_back();
-    return true;
+    return false;
 }
 
 namespace {
@@ -345,6 +340,7 @@ ReplicationCoordinatorImpl::ReplicationCoordinatorImpl(
     const ReplSettings& settings,
     std::unique_ptr<ReplicationCoordinatorExternalState> externalState,
     std::unique_ptr<executor::TaskExecutor> executor,
+    std::unique_ptr<executor::TaskExecutor> heartbeatExecutor,
     std::unique_ptr<TopologyCoordinator> topCoord,
     ReplicationProcess* replicationProcess,
     StorageInterface* storage,
@@ -354,6 +350,7 @@ ReplicationCoordinatorImpl::ReplicationCoordinatorImpl(
       _replMode(getReplicationModeFromSettings(settings)),
       _topCoord(std::move(topCoord)),
       _replExecutor(std::move(executor)),
+      _hbExecutor(std::move(heartbeatExecutor)),
       _externalState(std::move(externalState)),
       _inShutdown(false),
       _memberState(MemberState::RS_STARTUP),
@@ -458,6 +455,13 @@ void ReplicationCoordinatorImpl::appendDiagnosticBSON(mongo::BSONObjBuilder* bob
 
 void ReplicationCoordinatorImpl::appendConnectionStats(executor::ConnectionPoolStats* stats) const {
     _replExecutor->appendConnectionStats(stats);
+    if (_hbExecutor) {
+        _hbExecutor->appendConnectionStats(stats);
+    }
+}
+
+executor::TaskExecutor* ReplicationCoordinatorImpl::_heartbeatExecutor() const {
+    return _hbExecutor ? _hbExecutor.get() : _replExecutor.get();
 }
 
 bool ReplicationCoordinatorImpl::_startLoadLocalConfig(OperationContext* opCtx) {
@@ -808,6 +812,9 @@ void ReplicationCoordinatorImpl::startup(OperationContext* opCtx) {
     }
 
     _replExecutor->startup();
+    if (_hbExecutor) {
+        _hbExecutor->startup();
+    }
 
     bool doneLoadingConfig = _startLoadLocalConfig(opCtx);
     if (doneLoadingConfig) {
@@ -868,6 +875,10 @@ void ReplicationCoordinatorImpl::shutdown(OperationContext* opCtx) {
         initialSyncerCopy.reset();
     }
     _externalState->shutdown(opCtx);
+    if (_hbExecutor) {
+        _hbExecutor->shutdown();
+        _hbExecutor->join();
+    }
     _replExecutor->shutdown();
     _replExecutor->join();
 }
@@ -1159,9 +1170,10 @@ void ReplicationCoordinatorImpl::_setMyLastAppliedOpTime(WithLock lk,
         _updateLastCommittedOpTime(lk);
     }
 
-    // Signal anyone waiting on optime changes.
-    _opTimeWaiterList.signalIf_inlock(
-        [opTime](Waiter* waiter) { return waiter->opTime <= opTime; });
+    // Signal anyone waiting on optime changes. The waiter list is ordered by opTime, so this
+    // only examines the waiters whose target opTime has actually been reached instead of
+    // evaluating every waiter on each batch boundary.
+    _opTimeWaiterList.signalIf_inlock([](Waiter* waiter) { return true; }, opTime);
 
     if (opTime.isNull()) {
         return;
@@ -2925,13 +2937,20 @@ ReplicationCoordinatorImpl::_setCurrentRSConfig(WithLock lk,
     }
     _updateLastCommittedOpTime(lk);
 
+    // The new config may have made some waiters' write concerns unsatisfiable, which completes
+    // them with an error no matter how far their optimes are ahead of the set. Examine the full
+    // list; the bounded wakeup inside _updateLastCommittedOpTime() does not reach such waiters.
+    _wakeReadyWaiters_inlock();
+
     return action;
 }
 
-void ReplicationCoordinatorImpl::_wakeReadyWaiters_inlock() {
-    _replicationWaiterList.signalIf_inlock([this](Waiter* waiter) {
-        return _doneWaitingForReplication_inlock(waiter->opTime, *waiter->writeConcern);
-    });
+void ReplicationCoordinatorImpl::_wakeReadyWaiters_inlock(boost::optional<OpTime> opTimeBound) {
+    _replicationWaiterList.signalIf_inlock(
+        [this](Waiter* waiter) {
+            return _doneWaitingForReplication_inlock(waiter->opTime, *waiter->writeConcern);
+        },
+        opTimeBound);
 }
 
 Status ReplicationCoordinatorImpl::processReplSetUpdatePosition(const UpdatePositionArgs& updates,
@@ -3110,8 +3129,11 @@ void ReplicationCoordinatorImpl::_updateLastCommittedOpTime(WithLock lk) {
     // Wake up any threads waiting for replication that now have their replication
     // check satisfied.  We must do this regardless of whether we updated the lastCommittedOpTime,
     // as lastCommittedOpTime may be based on durable optimes whereas some waiters may be
-    // waiting on applied (but not necessarily durable) optimes.
-    _wakeReadyWaiters_inlock();
+    // waiting on applied (but not necessarily durable) optimes. This runs on every replication
+    // progress update, so bound the scan: no waiter past the latest optime any member has
+    // applied can be satisfied by progress alone, and the events that complete such waiters
+    // regardless of progress (reconfig, stepdown) signal the full list themselves.
+    _wakeReadyWaiters_inlock(_topCoord->latestKnownAppliedOpTime());
 }
 
 boost::optional<OpTime> ReplicationCoordinatorImpl::_calculateStableOpTime(
@@ -3552,8 +3574,10 @@ bool ReplicationCoordinatorImpl::_updateCommittedSnapshot_inlock(
 
     _externalState->updateCommittedSnapshot(newCommittedSnapshot);
 
-    // Wake up any threads waiting for read concern or write concern.
-    _wakeReadyWaiters_inlock();
+    // Wake up any threads waiting for read concern or write concern. Like the wakeup on
+    // replication progress, this one is bounded: the committed snapshot can never be ahead of
+    // the latest applied optime in the set.
+    _wakeReadyWaiters_inlock(_topCoord->latestKnownAppliedOpTime());
     return true;
 }
 
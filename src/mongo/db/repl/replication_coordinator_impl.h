@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -86,10 +87,16 @@ class ReplicationCoordinatorImpl : public ReplicationCoordinator {
     MONGO_DISALLOW_COPYING(ReplicationCoordinatorImpl);
 
 public:
+    /**
+     * 'heartbeatExecutor' may be null, in which case heartbeats are scheduled on 'executor'. When
+     * provided, it must have its own network interface so that heartbeat traffic does not queue
+     * behind other replication work under load.
+     */
     ReplicationCoordinatorImpl(ServiceContext* serviceContext,
                                const ReplSettings& settings,
                                std::unique_ptr<ReplicationCoordinatorExternalState> externalState,
                                std::unique_ptr<executor::TaskExecutor> executor,
+                               std::unique_ptr<executor::TaskExecutor> heartbeatExecutor,
                                std::unique_ptr<TopologyCoordinator> topoCoord,
                                ReplicationProcess* replicationProcess,
                                StorageInterface* storage,
@@ -505,13 +512,19 @@ private:
         void add_inlock(WaiterType waiter);
         // Returns whether waiter is found and removed.
         bool remove_inlock(WaiterType waiter);
-        // Signals all waiters that satisfy the condition.
-        void signalIf_inlock(stdx::function<bool(WaiterType)> fun);
+        // Signals all waiters that satisfy the condition. If "opTimeBound" is given, only the
+        // waiters whose target opTime is at or below the bound are examined; since the list is
+        // ordered by opTime, the scan stops at the first waiter past the bound instead of
+        // visiting every waiter.
+        void signalIf_inlock(stdx::function<bool(WaiterType)> fun,
+                             boost::optional<OpTime> opTimeBound = boost::none);
         // Signals all waiters from the list.
         void signalAll_inlock();
 
     private:
-        std::vector<WaiterType> _list;
+        // Waiters ordered by the opTime they are waiting on, so that opTime-driven wakeups only
+        // touch the prefix of the list that could have become satisfied.
+        std::multimap<OpTime, WaiterType> _waiters;
     };
 
     typedef std::vector<executor::TaskExecutor::CallbackHandle> HeartbeatHandles;
@@ -631,9 +644,15 @@ private:
                                                     int myIndex);
 
     /**
-     * Helper to wake waiters in _replicationWaiterList that are doneWaitingForReplication.
+     * Helper to wake waiters in _replicationWaiterList that are doneWaitingForReplication. If
+     * "opTimeBound" is given, only waiters at or below the bound are examined; callers on the
+     * replication progress path pass the latest optime any member is known to have applied, so
+     * that each progress update touches only the prefix of the list that could have become
+     * satisfied rather than every waiter. Callers reacting to events that can complete a waiter
+     * regardless of its optime (e.g. a reconfig making its write concern unsatisfiable) must
+     * leave the bound unset.
      */
-    void _wakeReadyWaiters_inlock();
+    void _wakeReadyWaiters_inlock(boost::optional<OpTime> opTimeBound = boost::none);
 
     /**
      * Scheduled to cause the ReplicationCoordinator to reconsider any state that might
@@ -728,6 +747,13 @@ private:
 
     void _untrackHeartbeatHandle_inlock(const executor::TaskExecutor::CallbackHandle& handle);
 
+    /**
+     * Returns the executor on which heartbeats are scheduled, sent and responded to: the dedicated
+     * heartbeat executor when one was provided at construction, and '_replExecutor' otherwise. All
+     * handles in '_heartbeatHandles' belong to this executor.
+     */
+    executor::TaskExecutor* _heartbeatExecutor() const;
+
     /*
      * Return a randomized offset amount that is scaled in proportion to the size of the
      * _electionTimeoutPeriod. Used to add randomization to an election timeout.
@@ -1202,6 +1228,12 @@ private:
     // Executor that drives the topology coordinator.
     std::unique_ptr<executor::TaskExecutor> _replExecutor;  // (S)
 
+    // Optional executor dedicated to sending heartbeats and processing their responses. It has its
+    // own network interface, and therefore its own connections to the other members, so heartbeat
+    // latency is isolated from the queuing of other replication work on '_replExecutor'. May be
+    // null, in which case heartbeats share '_replExecutor'.
+    std::unique_ptr<executor::TaskExecutor> _hbExecutor;  // (S)
+
     // Pointer to the ReplicationCoordinatorExternalState owned by this ReplicationCoordinator.
     std::unique_ptr<ReplicationCoordinatorExternalState> _externalState;  // (PS)
 
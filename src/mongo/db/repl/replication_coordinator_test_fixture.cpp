@@ -149,14 +149,16 @@ void ReplCoordTest::init() {
     auto replExec =
         stdx::make_unique<executor::ThreadPoolTaskExecutor>(std::move(pool), std::move(net));
     _replExec = replExec.get();
-    _repl = stdx::make_unique<ReplicationCoordinatorImpl>(service,
-                                                          _settings,
-                                                          std::move(externalState),
-                                                          std::move(replExec),
-                                                          std::move(topo),
-                                                          replicationProcess,
-                                                          _storageInterface,
-                                                          seed);
+    _repl = stdx::make_unique<ReplicationCoordinatorImpl>(
+        service,
+        _settings,
+        std::move(externalState),
+        std::move(replExec),
+        nullptr,  // Heartbeats share the executor so tests can drive them via the mock network.
+        std::move(topo),
+        replicationProcess,
+        _storageInterface,
+        seed);
     service->setFastClockSource(stdx::make_unique<executor::NetworkInterfaceMockClockSource>(_net));
     service->setPreciseClockSource(
         stdx::make_unique<executor::NetworkInterfaceMockClockSource>(_net));
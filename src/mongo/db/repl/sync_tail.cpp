@@ -35,8 +35,10 @@
 #include "mongo/db/repl/sync_tail.h"
 
 #include "third_party/murmurhash3/MurmurHash3.h"
+#include <algorithm>
 #include <boost/functional/hash.hpp>
 #include <memory>
+#include <numeric>
 
 #include "mongo/base/counter.h"
 #include "mongo/bson/bsonelement_comparator.h"
@@ -45,6 +47,7 @@
 #include "mongo/db/catalog/database.h"
 #include "mongo/db/catalog/database_holder.h"
 #include "mongo/db/catalog/document_validation.h"
+#include "mongo/db/catalog/index_catalog.h"
 #include "mongo/db/catalog/uuid_catalog.h"
 #include "mongo/db/catalog_raii.h"
 #include "mongo/db/client.h"
@@ -56,6 +59,7 @@
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/db_raii.h"
+#include "mongo/db/index/index_access_method.h"
 #include "mongo/db/logical_session_id.h"
 #include "mongo/db/multi_key_path_tracker.h"
 #include "mongo/db/namespace_string.h"
@@ -70,6 +74,7 @@
 #include "mongo/db/repl/repl_set_config.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/session_update_tracker.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/session.h"
 #include "mongo/db/session_txn_record_gen.h"
@@ -90,6 +95,11 @@ namespace {
 MONGO_FAIL_POINT_DEFINE(pauseBatchApplicationBeforeCompletion);
 MONGO_FAIL_POINT_DEFINE(hangAfterRecordingOpApplicationStartTime);
 
+// Set this to warm the storage engine's cache with the documents a batch is about to update or
+// delete before the writer threads apply it. Update-heavy workloads whose working set does not fit
+// in cache are otherwise bound by the cold reads the appliers do to find each target document.
+MONGO_EXPORT_SERVER_PARAMETER(replBatchPrefetch, bool, false);
+
 // The oplog entries applied
 Counter64 opsAppliedStats;
 ServerStatusMetricField<Counter64> displayOpsApplied("repl.apply.ops", &opsAppliedStats);
@@ -496,6 +506,88 @@ void scheduleWritesToOplog(OperationContext* opCtx,
     }
 }
 
+// Warms the cache for a single operation before it is applied: probes the _id index for the
+// document the operation targets, then reads that document so its record page is resident by the
+// time a writer thread needs it. Prefetching is purely advisory, so all errors are swallowed.
+void prefetchOp(OperationContext* opCtx, const OplogEntry& oplogEntry) {
+    // Only updates and deletes read a pre-existing document during apply. An update carries the
+    // target's _id in the o2 field; a delete carries it in the o field.
+    BSONObj query;
+    if (oplogEntry.getOpType() == OpTypeEnum::kUpdate) {
+        auto object2 = oplogEntry.getObject2();
+        if (!object2) {
+            return;
+        }
+        query = *object2;
+    } else if (oplogEntry.getOpType() == OpTypeEnum::kDelete) {
+        query = oplogEntry.getObject();
+    } else {
+        return;
+    }
+
+    if (query["_id"].eoo()) {
+        return;
+    }
+
+    try {
+        AutoGetCollectionForRead autoColl(opCtx, oplogEntry.getNss());
+        Collection* collection = autoColl.getCollection();
+        if (!collection) {
+            return;
+        }
+
+        IndexCatalog* catalog = collection->getIndexCatalog();
+        const IndexDescriptor* desc = catalog->findIdIndex(opCtx);
+        if (!desc) {
+            return;
+        }
+
+        // The probe pulls the _id index pages into cache; reading the document it points at pulls
+        // in the record's page.
+        RecordId loc =
+            catalog->getEntry(desc)->accessMethod()->findSingle(opCtx, query["_id"].wrap());
+        if (loc.isNull()) {
+            return;
+        }
+        Snapshotted<BSONObj> doc;
+        collection->findDoc(opCtx, loc, &doc);
+    } catch (const DBException& ex) {
+        LOG(2) << "ignoring exception in replication batch prefetch: " << redact(ex);
+    }
+}
+
+// Schedules cache-warming reads for the updates and deletes in 'ops' into threadPool, splitting the
+// batch into contiguous ranges like scheduleWritesToOplog does. The caller must guarantee that
+// 'ops' stays valid until all scheduled work in the thread pool completes.
+void scheduleBatchPrefetch(ThreadPool* threadPool, const MultiApplier::Operations& ops) {
+    auto makePrefetcherForRange = [&ops](size_t begin, size_t end) {
+        // The returned function will be run in a separate thread after this returns. Therefore all
+        // captures other than 'ops' must be by value since they will not be available.
+        return [&ops, begin, end] {
+            auto opCtx = cc().makeOperationContext();
+            // Prefetch reads must not conflict with the PBWM lock held for the whole batch.
+            ShouldNotConflictWithSecondaryBatchApplicationBlock shouldNotConflictBlock(
+                opCtx->lockState());
+            for (size_t i = begin; i < end; i++) {
+                prefetchOp(opCtx.get(), ops[i]);
+            }
+        };
+    };
+
+    const size_t numPrefetchThreads = threadPool->getStats().numThreads;
+    const size_t numOpsPerThread = ops.size() / numPrefetchThreads;
+    if (numOpsPerThread == 0) {
+        invariant(threadPool->schedule(makePrefetcherForRange(0, ops.size())));
+        return;
+    }
+
+    for (size_t thread = 0; thread < numPrefetchThreads; thread++) {
+        size_t begin = thread * numOpsPerThread;
+        size_t end = (thread == numPrefetchThreads - 1) ? ops.size() : begin + numOpsPerThread;
+        invariant(threadPool->schedule(makePrefetcherForRange(begin, end)));
+    }
+}
+
 /**
  * Caches per-collection properties which are relevant for oplog application, so that they don't
  * have to be retrieved repeatedly for each op.
@@ -543,24 +635,30 @@ private:
     StringMap<CollectionProperties> _cache;
 };
 
+// Each batch is partitioned into ordered groups of ops that a single writer must apply in
+// order: ops land in the same group exactly when they may not be reordered relative to each
+// other. Using several groups per writer lets the groups be packed onto writers by size, so a
+// few hot groups do not leave the remaining writers idle.
+constexpr size_t kNumWriterGroupsPerThread = 8;
+
 /**
  * ops - This only modifies the isForCappedCollection field on each op. It does not alter the ops
  *      vector in any other way.
- * writerVectors - Set of operations for each worker thread to apply.
+ * writerGroups - Ordered groups of operations; each group is applied in order by one writer.
  * derivedOps - If provided, this function inserts a decomposition of applyOps operations
  *      and instructions for updating the transactions table.
  * sessionUpdateTracker - if provided, keeps track of session info from ops.
  */
-void fillWriterVectors(OperationContext* opCtx,
-                       MultiApplier::Operations* ops,
-                       std::vector<MultiApplier::OperationPtrs>* writerVectors,
-                       std::vector<MultiApplier::Operations>* derivedOps,
-                       SessionUpdateTracker* sessionUpdateTracker) {
+void fillWriterGroups(OperationContext* opCtx,
+                      MultiApplier::Operations* ops,
+                      std::vector<MultiApplier::OperationPtrs>* writerGroups,
+                      std::vector<MultiApplier::Operations>* derivedOps,
+                      SessionUpdateTracker* sessionUpdateTracker) {
     const auto serviceContext = opCtx->getServiceContext();
     const auto storageEngine = serviceContext->getStorageEngine();
 
     const bool supportsDocLocking = storageEngine->supportsDocLocking();
-    const uint32_t numWriters = writerVectors->size();
+    const uint32_t numGroups = writerGroups->size();
 
     CachedCollectionProperties collPropertiesCache;
 
@@ -576,7 +674,7 @@ void fillWriterVectors(OperationContext* opCtx,
         if (sessionUpdateTracker) {
             if (auto newOplogWrites = sessionUpdateTracker->updateOrFlush(op)) {
                 derivedOps->emplace_back(std::move(*newOplogWrites));
-                fillWriterVectors(opCtx, &derivedOps->back(), writerVectors, derivedOps, nullptr);
+                fillWriterGroups(opCtx, &derivedOps->back(), writerGroups, derivedOps, nullptr);
             }
         }
 
@@ -610,7 +708,7 @@ void fillWriterVectors(OperationContext* opCtx,
                 derivedOps->emplace_back(ApplyOps::extractOperations(op));
 
                 // Nested entries cannot have different session updates.
-                fillWriterVectors(opCtx, &derivedOps->back(), writerVectors, derivedOps, nullptr);
+                fillWriterGroups(opCtx, &derivedOps->back(), writerGroups, derivedOps, nullptr);
             } catch (...) {
                 fassertFailedWithStatusNoTrace(
                     50711,
@@ -621,11 +719,11 @@ void fillWriterVectors(OperationContext* opCtx,
             continue;
         }
 
-        auto& writer = (*writerVectors)[hash % numWriters];
-        if (writer.empty()) {
-            writer.reserve(8);  // Skip a few growth rounds
+        auto& group = (*writerGroups)[hash % numGroups];
+        if (group.empty()) {
+            group.reserve(8);  // Skip a few growth rounds
         }
-        writer.push_back(&op);
+        group.push_back(&op);
     }
 }
 
@@ -634,12 +732,40 @@ void fillWriterVectors(OperationContext* opCtx,
                        std::vector<MultiApplier::OperationPtrs>* writerVectors,
                        std::vector<MultiApplier::Operations>* derivedOps) {
     SessionUpdateTracker sessionUpdateTracker;
-    fillWriterVectors(opCtx, ops, writerVectors, derivedOps, &sessionUpdateTracker);
+
+    std::vector<MultiApplier::OperationPtrs> writerGroups(writerVectors->size() *
+                                                          kNumWriterGroupsPerThread);
+    fillWriterGroups(opCtx, ops, &writerGroups, derivedOps, &sessionUpdateTracker);
 
     auto newOplogWrites = sessionUpdateTracker.flushAll();
     if (!newOplogWrites.empty()) {
         derivedOps->emplace_back(std::move(newOplogWrites));
-        fillWriterVectors(opCtx, &derivedOps->back(), writerVectors, derivedOps, nullptr);
+        fillWriterGroups(opCtx, &derivedOps->back(), &writerGroups, derivedOps, nullptr);
+    }
+
+    // Pack groups onto writers from largest to smallest, always onto the least loaded writer.
+    // Groups are independent of each other by construction, so any assignment preserves the
+    // required ordering; balancing by op count keeps a few hot groups from pinning one writer
+    // while the rest idle.
+    std::vector<size_t> groupOrder(writerGroups.size());
+    std::iota(groupOrder.begin(), groupOrder.end(), 0);
+    std::sort(groupOrder.begin(), groupOrder.end(), [&writerGroups](size_t lhs, size_t rhs) {
+        return writerGroups[lhs].size() > writerGroups[rhs].size();
+    });
+
+    for (auto groupIdx : groupOrder) {
+        auto& group = writerGroups[groupIdx];
+        if (group.empty()) {
+            break;  // All remaining groups are empty as well.
+        }
+
+        auto& writer = *std::min_element(
+            writerVectors->begin(),
+            writerVectors->end(),
+            [](const MultiApplier::OperationPtrs& lhs, const MultiApplier::OperationPtrs& rhs) {
+                return lhs.size() < rhs.size();
+            });
+        writer.insert(writer.end(), group.begin(), group.end());
     }
 }
 
@@ -1325,6 +1451,14 @@ StatusWith<OpTime> SyncTail::multiApply(OperationContext* opCtx, MultiApplier::O
             scheduleWritesToOplog(opCtx, _storageInterface, _writerPool, ops);
         }
 
+        // Warm the cache with the documents this batch will update or delete so the writer threads
+        // don't stall on cold reads while applying it. These tasks share the writer pool with the
+        // oplog writes scheduled above; both finish at the waitForIdle() below, before the apply
+        // phase begins.
+        if (replBatchPrefetch.load()) {
+            scheduleBatchPrefetch(_writerPool, ops);
+        }
+
         // Holds 'pseudo operations' generated by secondaries to aid in replication.
         // Keep in scope until all operations in 'ops' and 'derivedOps' have been applied.
         // Pseudo operations include:
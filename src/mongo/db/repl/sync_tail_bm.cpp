@@ -0,0 +1,266 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kReplication
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/catalog/collection_options.h"
+#include "mongo/db/repl/idempotency_test_fixture.h"
+#include "mongo/db/repl/oplog_applier.h"
+#include "mongo/db/repl/storage_interface.h"
+#include "mongo/db/repl/sync_tail.h"
+#include "mongo/db/repl/sync_tail_test_fixture.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/storage/storage_engine_init.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+namespace repl {
+namespace {
+
+/**
+ * Reuses the SyncTail unit test fixture to stand up a mongod-like service context (storage
+ * engine, mock replication coordinator, oplog) for driving batches through multiApply()
+ * outside the unit test framework.
+ */
+class ApplyBenchmarkEnv : public SyncTailTest {
+public:
+    explicit ApplyBenchmarkEnv(std::string storageEngine)
+        : SyncTailTest(std::move(storageEngine)) {}
+
+    void setUp() override {
+        SyncTailTest::setUp();
+    }
+
+    void tearDown() override {
+        SyncTailTest::tearDown();
+    }
+
+    OperationContext* opCtx() {
+        return _opCtx.get();
+    }
+
+    using SyncTailTest::getConsistencyMarkers;
+    using SyncTailTest::getStorageInterface;
+    using SyncTailTest::nextOpTime;
+};
+
+/**
+ * Shape of a synthetic batch: number of operations, approximate document size, number of
+ * target collections the operations are spread across and size of the writer pool.
+ */
+struct BatchSpec {
+    int ops;
+    int docBytes;
+    int collections;
+    int writerThreads;
+
+    static BatchSpec fromState(const benchmark::State& state) {
+        return {static_cast<int>(state.range(0)),
+                static_cast<int>(state.range(1)),
+                static_cast<int>(state.range(2)),
+                static_cast<int>(state.range(3))};
+    }
+};
+
+enum class OpMix {
+    kInserts,    // insert-only batches
+    kUpdates,    // update-only batches against pre-seeded documents
+    kCrudMixed,  // 2:1:1 insert/update/delete, updates and deletes target same-batch inserts
+};
+
+NamespaceString collectionFor(int index) {
+    return NamespaceString(std::string("bench.apply_bm_coll") + std::to_string(index));
+}
+
+BSONObj makeDocument(long long id, int docBytes) {
+    return BSON("_id" << id << "padding" << std::string(docBytes, 'x'));
+}
+
+/**
+ * Builds one synthetic batch. 'idCounter' advances across calls so that insert-only workloads
+ * never collide with documents from earlier iterations.
+ */
+MultiApplier::Operations makeBatch(ApplyBenchmarkEnv* env,
+                                   OpMix mix,
+                                   const BatchSpec& spec,
+                                   long long* idCounter) {
+    MultiApplier::Operations ops;
+    ops.reserve(spec.ops);
+
+    for (int i = 0; i < spec.ops; ++i) {
+        const auto nss = collectionFor(i % spec.collections);
+        switch (mix) {
+            case OpMix::kInserts:
+                ops.push_back(makeInsertDocumentOplogEntry(
+                    env->nextOpTime(), nss, makeDocument((*idCounter)++, spec.docBytes)));
+                break;
+            case OpMix::kUpdates:
+                // Target the documents seeded before the benchmark loop started; seed id 'i'
+                // lives in collection 'i % collections', which is exactly 'nss'.
+                ops.push_back(makeUpdateDocumentOplogEntry(
+                    env->nextOpTime(),
+                    nss,
+                    BSON("_id" << static_cast<long long>(i)),
+                    BSON("$set" << BSON("padding" << std::string(spec.docBytes, 'y')))));
+                break;
+            case OpMix::kCrudMixed:
+                // Pattern of four: two inserts, then an update of the first and a delete of the
+                // second. Operations on the same document hash to the same writer thread, which
+                // preserves their order within the batch.
+                switch (i % 4) {
+                    case 0:
+                    case 1:
+                        ops.push_back(makeInsertDocumentOplogEntry(
+                            env->nextOpTime(), nss, makeDocument(*idCounter + i, spec.docBytes)));
+                        break;
+                    case 2:
+                        ops.push_back(makeUpdateDocumentOplogEntry(
+                            env->nextOpTime(),
+                            collectionFor((i - 2) % spec.collections),
+                            BSON("_id" << *idCounter + i - 2),
+                            BSON("$set" << BSON("padding" << std::string(spec.docBytes, 'y')))));
+                        break;
+                    case 3:
+                        ops.push_back(makeDeleteDocumentOplogEntry(
+                            env->nextOpTime(),
+                            collectionFor((i - 2) % spec.collections),
+                            BSON("_id" << *idCounter + i - 2)));
+                        break;
+                }
+                break;
+        }
+    }
+
+    if (mix != OpMix::kUpdates) {
+        *idCounter += spec.ops;
+    }
+
+    return ops;
+}
+
+void runApplyBenchmark(benchmark::State& state, const std::string& storageEngine, OpMix mix) {
+    if (!isRegisteredStorageEngine(getGlobalServiceContext(), storageEngine)) {
+        state.SkipWithError(
+            (storageEngine + " storage engine is not linked into this binary").c_str());
+        return;
+    }
+
+    const auto spec = BatchSpec::fromState(state);
+
+    ApplyBenchmarkEnv env(storageEngine);
+    env.setUp();
+
+    auto writerPool = OplogApplier::makeWriterPool(spec.writerThreads);
+    SyncTail syncTail(nullptr,
+                      env.getConsistencyMarkers(),
+                      env.getStorageInterface(),
+                      multiSyncApply,
+                      writerPool.get());
+
+    for (int i = 0; i < spec.collections; ++i) {
+        invariant(env.getStorageInterface()
+                      ->createCollection(env.opCtx(), collectionFor(i), CollectionOptions())
+                      .isOK());
+    }
+
+    if (mix == OpMix::kUpdates) {
+        // Seed the documents the update batches will target.
+        long long seedCounter = 0;
+        auto seedOps = makeBatch(&env, OpMix::kInserts, spec, &seedCounter);
+        invariant(syncTail.multiApply(env.opCtx(), std::move(seedOps)).getStatus().isOK());
+    }
+
+    long long idCounter = 0;
+    for (auto keepRunning : state) {
+        state.PauseTiming();
+        auto ops = makeBatch(&env, mix, spec, &idCounter);
+        state.ResumeTiming();
+
+        // One iteration is one replication batch, so per-iteration time is batch latency.
+        auto result = syncTail.multiApply(env.opCtx(), std::move(ops));
+        invariant(result.getStatus().isOK(), result.getStatus().toString());
+    }
+
+    state.SetItemsProcessed(state.iterations() * spec.ops);
+    state.SetBytesProcessed(state.iterations() * spec.ops * spec.docBytes);
+    state.counters["writers"] = spec.writerThreads;
+    state.counters["ops_per_writer"] =
+        benchmark::Counter(static_cast<double>(state.iterations() * spec.ops) / spec.writerThreads,
+                           benchmark::Counter::kIsRate);
+
+    env.tearDown();
+}
+
+void BM_SyncTailApplyInserts(benchmark::State& state) {
+    runApplyBenchmark(state, "ephemeralForTest", OpMix::kInserts);
+}
+
+void BM_SyncTailApplyUpdates(benchmark::State& state) {
+    runApplyBenchmark(state, "ephemeralForTest", OpMix::kUpdates);
+}
+
+void BM_SyncTailApplyCrudMix(benchmark::State& state) {
+    runApplyBenchmark(state, "ephemeralForTest", OpMix::kCrudMixed);
+}
+
+void BM_SyncTailApplyInsertsWiredTiger(benchmark::State& state) {
+    runApplyBenchmark(state, "wiredTiger", OpMix::kInserts);
+}
+
+void BM_SyncTailApplyCrudMixWiredTiger(benchmark::State& state) {
+    runApplyBenchmark(state, "wiredTiger", OpMix::kCrudMixed);
+}
+
+// Arguments: {operations per batch, document bytes, collections, writer threads}.
+void applyBenchmarkArguments(benchmark::internal::Benchmark* bm) {
+    bm->Args({512, 128, 1, 4})
+        ->Args({512, 128, 8, 4})
+        ->Args({4096, 128, 8, 4})
+        ->Args({4096, 128, 8, 16})
+        ->Args({4096, 4096, 8, 16})
+        ->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(BM_SyncTailApplyInserts)->Apply(applyBenchmarkArguments);
+BENCHMARK(BM_SyncTailApplyUpdates)->Apply(applyBenchmarkArguments);
+BENCHMARK(BM_SyncTailApplyCrudMix)->Apply(applyBenchmarkArguments);
+BENCHMARK(BM_SyncTailApplyInsertsWiredTiger)->Apply(applyBenchmarkArguments);
+BENCHMARK(BM_SyncTailApplyCrudMixWiredTiger)->Apply(applyBenchmarkArguments);
+
+}  // namespace
+}  // namespace repl
+}  // namespace mongo
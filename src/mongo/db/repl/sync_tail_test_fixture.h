@@ -108,6 +108,15 @@ public:
     static OplogApplier::Options makeInitialSyncOptions();
 
 protected:
+    SyncTailTest() = default;
+
+    /**
+     * Builds the fixture against the named storage engine instead of the default
+     * "ephemeralForTest". The engine must be linked into the binary.
+     */
+    explicit SyncTailTest(std::string storageEngine)
+        : ServiceContextMongoDTest(std::move(storageEngine)) {}
+
     void _testSyncApplyCrudOperation(ErrorCodes::Error expectedError,
                                      const BSONObj& op,
                                      bool expectedApplyOpCalled);
@@ -2783,5 +2783,18 @@ TopologyCoordinator::latestKnownOpTimeSinceHeartbeatRestartPerMember() const {
     return opTimesPerMember;
 }
 
+OpTime TopologyCoordinator::latestKnownAppliedOpTime() const {
+    // Unlike _latestKnownOpTime(), this includes members that are down: their recorded progress
+    // still counts towards write concern satisfaction, so it must count towards the bound too.
+    OpTime latest;
+    for (auto&& memberData : _memberData) {
+        const OpTime& memberOpTime = memberData.getLastAppliedOpTime();
+        if (memberOpTime > latest) {
+            latest = memberOpTime;
+        }
+    }
+    return latest;
+}
+
 }  // namespace repl
 }  // namespace mongo
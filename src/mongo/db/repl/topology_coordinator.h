@@ -659,6 +659,14 @@ public:
      */
     std::map<int, boost::optional<OpTime>> latestKnownOpTimeSinceHeartbeatRestartPerMember() const;
 
+    /**
+     * Returns the latest applied optime that any member of the current config is known to have
+     * reached, whether or not that member is currently up. Write concern satisfaction is judged
+     * from the same per-member progress, so no optime past the returned value can have its write
+     * concern satisfied yet; callers use this to bound scans of replication waiters.
+     */
+    OpTime latestKnownAppliedOpTime() const;
+
     ////////////////////////////////////////////////////////////
     //
     // Test support methods
@@ -363,6 +363,46 @@ TEST_F(TopoCoordTest, NodeReturnsSecondaryWithMostRecentDataAsSyncSource) {
     ASSERT_EQUALS(HostAndPort("h3"), getTopoCoord().getSyncSourceAddress());
 }
 
+TEST_F(TopoCoordTest, LatestKnownAppliedOpTimeIsMaxAcrossMembers) {
+    updateConfig(BSON("_id"
+                      << "rs0"
+                      << "version"
+                      << 1
+                      << "members"
+                      << BSON_ARRAY(BSON("_id" << 10 << "host"
+                                               << "hself")
+                                    << BSON("_id" << 20 << "host"
+                                                  << "h2")
+                                    << BSON("_id" << 30 << "host"
+                                                  << "h3"))),
+                 0);
+    setSelfMemberState(MemberState::RS_SECONDARY);
+
+    // No progress has been recorded for any member yet.
+    ASSERT_EQUALS(OpTime(), getTopoCoord().latestKnownAppliedOpTime());
+
+    // Our own applied optime counts.
+    setMyOpTime(OpTime(Timestamp(3, 0), 0));
+    ASSERT_EQUALS(OpTime(Timestamp(3, 0), 0), getTopoCoord().latestKnownAppliedOpTime());
+
+    // The maximum over all members is returned, even when we are behind.
+    heartbeatFromMember(
+        HostAndPort("h2"), "rs0", MemberState::RS_SECONDARY, OpTime(Timestamp(5, 0), 0));
+    heartbeatFromMember(
+        HostAndPort("h3"), "rs0", MemberState::RS_SECONDARY, OpTime(Timestamp(1, 0), 0));
+    ASSERT_EQUALS(OpTime(Timestamp(5, 0), 0), getTopoCoord().latestKnownAppliedOpTime());
+
+    // A member's recorded progress never moves backwards.
+    heartbeatFromMember(
+        HostAndPort("h2"), "rs0", MemberState::RS_SECONDARY, OpTime(Timestamp(4, 0), 0));
+    ASSERT_EQUALS(OpTime(Timestamp(5, 0), 0), getTopoCoord().latestKnownAppliedOpTime());
+
+    // A member going down does not erase its recorded progress; it still counts towards write
+    // concern satisfaction, so it must still count towards the bound.
+    receiveDownHeartbeat(HostAndPort("h2"), "rs0");
+    ASSERT_EQUALS(OpTime(Timestamp(5, 0), 0), getTopoCoord().latestKnownAppliedOpTime());
+}
+
 TEST_F(TopoCoordTest, NodeReturnsClosestValidSyncSourceAsSyncSource) {
     updateConfig(BSON("_id"
                       << "rs0"
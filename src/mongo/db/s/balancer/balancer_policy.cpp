@@ -150,14 +150,14 @@ Status DistributionStatus::addRangeToZone(const ZoneRange& range) {
 }
 
 string DistributionStatus::getTagForChunk(const ChunkType& chunk) const {
+    // The ranges are disjoint and keyed by their max, so the only range which can contain the
+    // chunk is the first one whose max is past the chunk's min.  The containment check below
+    // also covers partial overlap (which should never happen, and is treated as if the chunk
+    // doesn't belong to a tag): any range boundary strictly inside the chunk would itself be
+    // that first key and would fail the check.  This keeps the per-chunk cost at a single
+    // ordered map lookup, which matters since the balancer calls this for every chunk of the
+    // collection on every round.
     const auto minIntersect = _zoneRanges.upper_bound(chunk.getMin());
-    const auto maxIntersect = _zoneRanges.lower_bound(chunk.getMax());
-
-    // We should never have a partial overlap with a chunk range. If it happens, treat it as if this
-    // chunk doesn't belong to a tag
-    if (minIntersect != maxIntersect) {
-        return "";
-    }
 
     if (minIntersect == _zoneRanges.end()) {
         return "";
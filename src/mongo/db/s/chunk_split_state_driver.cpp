@@ -63,7 +63,8 @@ ChunkSplitStateDriver::~ChunkSplitStateDriver() {
         auto wt = _writesTracker.lock();
         if (wt) {
             wt->releaseSplitLock();
-            wt->addBytesWritten(_stashedBytesWritten);
+            // Restores previously-tracked bytes, so no write operation is counted.
+            wt->addBytesWritten(_stashedBytesWritten, 0);
         }
     }
 }
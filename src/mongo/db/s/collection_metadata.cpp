@@ -34,6 +34,8 @@
 
 #include "mongo/db/s/collection_metadata.h"
 
+#include <algorithm>
+
 #include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/bson/dotted_path_support.h"
@@ -45,7 +47,27 @@
 namespace mongo {
 
 CollectionMetadata::CollectionMetadata(std::shared_ptr<ChunkManager> cm, const ShardId& thisShardId)
-    : _cm(std::move(cm)), _thisShardId(thisShardId) {}
+    : _cm(std::move(cm)), _thisShardId(thisShardId) {
+    if (_cm) {
+        _ownedRangeBounds = _cm->getOwnedRangeBoundsForShard(_thisShardId);
+    }
+}
+
+bool CollectionMetadata::keyBelongsToMe(const BSONObj& key) const {
+    invariant(isSharded());
+
+    if (key.isEmpty()) {
+        return false;
+    }
+
+    // The boundaries are strictly increasing and alternate range start and range end, so 'key'
+    // falls inside an owned [start, end) range exactly when an odd number of boundaries sorts at
+    // or before it.
+    const std::string keyString = _cm->extractShardKeyString(key);
+    const auto firstGreater =
+        std::upper_bound(_ownedRangeBounds.begin(), _ownedRangeBounds.end(), keyString);
+    return (firstGreater - _ownedRangeBounds.begin()) % 2 == 1;
+}
 
 RangeMap CollectionMetadata::getChunks() const {
     invariant(isSharded());
@@ -125,11 +125,12 @@ public:
     /**
      * Returns true if the document with the given key belongs to this chunkset. If the key is empty
      * returns false. If key is not a valid shard key, the behaviour is undefined.
+     *
+     * The test is a binary search over the owned-range boundaries compiled at construction, so
+     * the per-document cost is KeyString encoding plus byte comparisons rather than BSON range
+     * comparisons against the chunk map.
      */
-    bool keyBelongsToMe(const BSONObj& key) const {
-        invariant(isSharded());
-        return _cm->keyBelongsToShard(key, _thisShardId);
-    }
+    bool keyBelongsToMe(const BSONObj& key) const;
 
     /**
      * Given a key 'lookupKey' in the shard key range, get the next chunk which overlaps or is
@@ -214,6 +215,11 @@ private:
 
     // The identity of this shard, for the purpose of answering "key belongs to me" queries.
     ShardId _thisShardId;
+
+    // KeyString-encoded boundaries of the ranges owned by this shard, alternating range start and
+    // range end, with contiguous chunks merged. Compiled once at construction (i.e. at metadata
+    // refresh) so that keyBelongsToMe() is a binary search over flat bytes.
+    std::vector<std::string> _ownedRangeBounds;
 };
 
 }  // namespace mongo
@@ -34,9 +34,15 @@
 
 #include "mongo/db/s/collection_sharding_state.h"
 
+#include <algorithm>
+#include <array>
+#include <tuple>
+
 #include "mongo/db/repl/read_concern_args.h"
 #include "mongo/db/s/operation_sharding_state.h"
 #include "mongo/db/s/sharded_connection_info.h"
+#include "mongo/s/chunk_manager.h"
+#include "mongo/s/chunk_writes_tracker.h"
 #include "mongo/s/stale_exception.h"
 #include "mongo/util/log.h"
 #include "mongo/util/string_map.h"
@@ -54,11 +60,12 @@ public:
         : _factory(std::move(factory)) {}
 
     CollectionShardingState& getOrCreate(const NamespaceString& nss) {
-        stdx::lock_guard<stdx::mutex> lg(_mutex);
+        auto& partition = _partition(nss.ns());
+        stdx::lock_guard<stdx::mutex> lg(partition.mutex);
 
-        auto it = _collections.find(nss.ns());
-        if (it == _collections.end()) {
-            auto inserted = _collections.try_emplace(nss.ns(), _factory->make(nss));
+        auto it = partition.collections.find(nss.ns());
+        if (it == partition.collections.end()) {
+            auto inserted = partition.collections.try_emplace(nss.ns(), _factory->make(nss));
             invariant(inserted.second);
             it = std::move(inserted.first);
         }
@@ -69,10 +76,10 @@ public:
     void report(OperationContext* opCtx, BSONObjBuilder* builder) {
         BSONObjBuilder versionB(builder->subobjStart("versions"));
 
-        {
-            stdx::lock_guard<stdx::mutex> lg(_mutex);
+        for (auto& partition : _partitions) {
+            stdx::lock_guard<stdx::mutex> lg(partition.mutex);
 
-            for (auto& coll : _collections) {
+            for (auto& coll : partition.collections) {
                 const auto optMetadata = coll.second->getCurrentMetadataIfKnown();
                 if (optMetadata) {
                     const auto& metadata = *optMetadata;
@@ -84,13 +91,90 @@ public:
         versionB.done();
     }
 
+    void reportHottestChunks(OperationContext* opCtx, BSONObjBuilder* builder) {
+        // The number of chunks reported, which keeps the serverStatus section small even when
+        // the cached routing tables contain hundreds of thousands of chunks.
+        static constexpr size_t kMaxReportedChunks = 10;
+
+        struct HotChunk {
+            std::string ns;
+            BSONObj min;
+            BSONObj max;
+            uint64_t bytesWritten;
+            uint64_t numWrites;
+        };
+        std::vector<HotChunk> hotChunks;
+
+        for (auto& partition : _partitions) {
+            stdx::lock_guard<stdx::mutex> lg(partition.mutex);
+
+            for (auto& coll : partition.collections) {
+                const auto optMetadata = coll.second->getCurrentMetadataIfKnown();
+                if (!optMetadata || !(*optMetadata)->isSharded()) {
+                    continue;
+                }
+
+                for (const auto& chunk : (*optMetadata)->getChunkManager()->chunks()) {
+                    auto writesTracker = chunk.getWritesTracker();
+                    const auto bytesWritten = writesTracker->getBytesWritten();
+                    const auto numWrites = writesTracker->getNumWrites();
+                    if (numWrites == 0 && bytesWritten == 0) {
+                        continue;
+                    }
+
+                    // The chunk bounds are owned by the routing table, which may be replaced by
+                    // a refresh once the mutex is released.
+                    hotChunks.push_back({coll.first,
+                                         chunk.getMin().getOwned(),
+                                         chunk.getMax().getOwned(),
+                                         bytesWritten,
+                                         numWrites});
+                }
+            }
+        }
+
+        const auto numToReport = std::min(hotChunks.size(), kMaxReportedChunks);
+        std::partial_sort(hotChunks.begin(),
+                          hotChunks.begin() + numToReport,
+                          hotChunks.end(),
+                          [](const HotChunk& lhs, const HotChunk& rhs) {
+                              return std::tie(rhs.bytesWritten, rhs.numWrites) <
+                                  std::tie(lhs.bytesWritten, lhs.numWrites);
+                          });
+
+        BSONArrayBuilder arr(builder->subarrayStart("hottestChunks"));
+        for (size_t i = 0; i < numToReport; ++i) {
+            const auto& chunk = hotChunks[i];
+            BSONObjBuilder chunkB(arr.subobjStart());
+            chunkB.append("ns", chunk.ns);
+            chunkB.append("min", chunk.min);
+            chunkB.append("max", chunk.max);
+            chunkB.appendNumber("bytesWritten", static_cast<long long>(chunk.bytesWritten));
+            chunkB.appendNumber("writes", static_cast<long long>(chunk.numWrites));
+        }
+        arr.done();
+    }
+
 private:
     using CollectionsMap = StringMap<std::shared_ptr<CollectionShardingState>>;
 
+    // The map is partitioned by the hash of the namespace, each partition guarded by its own
+    // mutex, so that operations on different collections do not serialize on a single lock.
+    // A collection's sharding state lives in exactly one partition.
+    static const size_t kNumPartitions = 64;
+
+    struct Partition {
+        stdx::mutex mutex;
+        CollectionsMap collections;
+    };
+
+    Partition& _partition(StringData ns) {
+        return _partitions[StringMapHasher{}(ns) % kNumPartitions];
+    }
+
     std::unique_ptr<CollectionShardingStateFactory> _factory;
 
-    stdx::mutex _mutex;
-    CollectionsMap _collections;
+    std::array<Partition, kNumPartitions> _partitions;
 };
 
 const ServiceContext::Decoration<boost::optional<CollectionShardingStateMap>>
@@ -151,6 +235,12 @@ void CollectionShardingState::report(OperationContext* opCtx, BSONObjBuilder* bu
     collectionsMap->report(opCtx, builder);
 }
 
+void CollectionShardingState::reportHottestChunks(OperationContext* opCtx,
+                                                  BSONObjBuilder* builder) {
+    auto& collectionsMap = CollectionShardingStateMap::get(opCtx->getServiceContext());
+    collectionsMap->reportHottestChunks(opCtx, builder);
+}
+
 ScopedCollectionMetadata CollectionShardingState::getMetadataForOperation(OperationContext* opCtx) {
     const auto receivedShardVersion = getOperationReceivedVersion(opCtx, _nss);
 
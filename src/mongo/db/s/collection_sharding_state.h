@@ -72,6 +72,13 @@ public:
      */
     static void report(OperationContext* opCtx, BSONObjBuilder* builder);
 
+    /**
+     * Reports the chunks which have observed the most write traffic, across all collections with
+     * filtering information associated, as a 'hottestChunks' array sorted by bytes written in
+     * descending order.
+     */
+    static void reportHottestChunks(OperationContext* opCtx, BSONObjBuilder* builder);
+
     /**
      * Returns the chunk filtering metadata that the current operation should be using for that
      * collection or otherwise throws if it has not been loaded yet. If the operation does not
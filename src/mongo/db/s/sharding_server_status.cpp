@@ -32,6 +32,7 @@
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/commands/server_status.h"
 #include "mongo/db/s/active_migrations_registry.h"
+#include "mongo/db/s/collection_sharding_state.h"
 #include "mongo/db/s/sharding_state.h"
 #include "mongo/db/s/sharding_statistics.h"
 #include "mongo/db/server_options.h"
@@ -115,6 +116,7 @@ public:
         BSONObjBuilder result;
         ShardingStatistics::get(opCtx).report(&result);
         catalogCache->report(&result);
+        CollectionShardingState::reportHottestChunks(opCtx, &result);
         return result.obj();
     }
 
@@ -86,6 +86,7 @@
 #include "mongo/rpc/metadata/repl_set_metadata.h"
 #include "mongo/rpc/metadata/tracking_metadata.h"
 #include "mongo/rpc/op_msg.h"
+#include "mongo/rpc/reply_buffer_size_hint.h"
 #include "mongo/rpc/reply_builder_interface.h"
 #include "mongo/util/fail_point_service.h"
 #include "mongo/util/log.h"
@@ -441,6 +442,13 @@ bool runCommandImpl(OperationContext* opCtx,
                     const OperationSessionInfoFromClient& sessionOptions) {
     const Command* command = invocation->definition();
     auto bytesToReserve = command->reserveBytesForReply();
+
+    // Prefer the session's own reply-size history over the command's static estimate when it is
+    // larger; per-session sizes are far more stable than per-command ones.
+    if (auto session = opCtx->getClient()->session()) {
+        bytesToReserve =
+            std::max(bytesToReserve, rpc::ReplyBufferSizeHint::get(session).recommended());
+    }
 // SERVER-22100: In Windows DEBUG builds, the CRT heap debugging overhead, in conjunction with the
 // additional memory pressure introduced by reply buffer pre-allocation, causes the concurrency
 // suite to run extremely slowly. As a workaround we do not pre-allocate in Windows DEBUG builds.
@@ -598,7 +606,8 @@ void execCommandDatabase(OperationContext* opCtx,
         BSONElement allowImplicitCollectionCreationField;
         BSONElement helpField;
 
-        StringMap<int> topLevelFields;
+        CommandHelpers::uassertNoDuplicateFields(request.body);
+
         for (auto&& element : request.body) {
             StringData fieldName = element.fieldNameStringData();
             if (fieldName == QueryRequest::cmdOptionMaxTimeMS) {
@@ -611,11 +620,6 @@ void execCommandDatabase(OperationContext* opCtx,
                 uasserted(ErrorCodes::InvalidOptions,
                           "no such command option $maxTimeMs; use maxTimeMS instead");
             }
-
-            uassert(ErrorCodes::FailedToParse,
-                    str::stream() << "Parsed command object contains duplicate top level key: "
-                                  << fieldName,
-                    topLevelFields[fieldName]++ == 0);
         }
 
         if (CommandHelpers::isHelpRequest(helpField)) {
@@ -41,6 +41,7 @@
 #include "mongo/db/session_killer.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/mutex.h"
+#include "mongo/stdx/new.h"
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/util/concurrency/with_lock.h"
 
@@ -91,10 +92,10 @@ public:
     SessionToKill checkOutSessionForKill(OperationContext* opCtx, KillToken killToken);
 
     /**
-     * Iterates through the SessionCatalog under the SessionCatalog mutex and applies 'workerFn' to
-     * each Session which matches the specified 'matcher'.
+     * Iterates through the SessionCatalog one partition at a time, under that partition's mutex,
+     * and applies 'workerFn' to each Session which matches the specified 'matcher'.
      *
-     * NOTE: Since this method runs with the session catalog mutex, the work done by 'workerFn' is
+     * NOTE: Since this method runs with a partition mutex held, the work done by 'workerFn' is
      * not allowed to block, perform I/O or acquire any lock manager locks.
      * Iterates through the SessionCatalog and applies 'workerFn' to each Session. This locks the
      * SessionCatalog.
@@ -106,7 +107,7 @@ public:
                       const ScanSessionsCallbackFn& workerFn);
 
     /**
-     * Shortcut to invoke 'kill' on the specified session under the SessionCatalog mutex. Throws a
+     * Shortcut to invoke 'kill' on the specified session under its partition's mutex. Throws a
      * NoSuchSession exception if the session doesn't exist.
      */
     KillToken killSession(const LogicalSessionId& lsid);
@@ -119,20 +120,38 @@ private:
         // currently has it checked out
         Session session;
 
-        // Signaled when the state becomes available. Uses the transaction table's mutex to protect
-        // the state transitions.
+        // Signaled when the state becomes available. Uses the mutex of the partition which owns
+        // this session to protect the state transitions.
         stdx::condition_variable availableCondVar;
     };
 
+    // The session map is partitioned by the hash of the logical session id so that operations
+    // carrying different lsids do not all funnel through a single mutex. A session lives in exactly
+    // one partition, whose mutex protects its runtime state transitions and kill flags.
+    static const size_t kNumSessionPartitions = 64;
+
+    // Padded to a cache line so that one partition's mutex traffic does not falsely share a line
+    // with its neighbours in the _partitions array.
+    struct alignas(stdx::hardware_destructive_interference_size) SessionPartition {
+        stdx::mutex mutex;
+
+        // Owns the Session objects for all current Sessions which hash to this partition.
+        LogicalSessionIdMap<std::shared_ptr<SessionRuntimeInfo>> sessions;
+    };
+
+    SessionPartition& _partition(const LogicalSessionId& lsid) {
+        return _partitions[LogicalSessionIdHash{}(lsid) % kNumSessionPartitions];
+    }
+
     ScopedCheckedOutSession _checkOutSession(OperationContext* opCtx);
 
     /**
      * May release and re-acquire it zero or more times before returning. The returned
-     * 'SessionRuntimeInfo' is guaranteed to be linked on the catalog's _txnTable as long as the
+     * 'SessionRuntimeInfo' is guaranteed to be linked on 'partition' as long as the partition's
      * lock is held.
      */
     std::shared_ptr<SessionRuntimeInfo> _getOrCreateSessionRuntimeInfo(
-        WithLock, OperationContext* opCtx, const LogicalSessionId& lsid);
+        WithLock, SessionPartition& partition, const LogicalSessionId& lsid);
 
     /**
      * Makes a session, previously checked out through 'checkoutSession', available again.
@@ -140,10 +159,7 @@ private:
     void _releaseSession(std::shared_ptr<SessionRuntimeInfo> sri,
                          boost::optional<KillToken> killToken);
 
-    stdx::mutex _mutex;
-
-    // Owns the Session objects for all current Sessions.
-    LogicalSessionIdMap<std::shared_ptr<SessionRuntimeInfo>> _sessions;
+    SessionPartition _partitions[kNumSessionPartitions];
 };
 
 /**
@@ -223,8 +239,8 @@ using SessionToKill = SessionCatalog::SessionToKill;
 /**
  * This type represents access to a session inside of a scanSessions loop.
  * If you have one of these, you're in a scanSessions callback context, and so
- * have locked the whole catalog and, if the observed session is bound to an operation context,
- * you hold that operation context's client's mutex, as well.
+ * have locked the catalog partition which owns the observed session and, if the session is bound
+ * to an operation context, you hold that operation context's client's mutex, as well.
  */
 class ObservableSession {
 public:
@@ -50,9 +50,17 @@
 #include "mongo/db/sorter/sorter.h"
 
 #include <boost/filesystem/operations.hpp>
+#include <cstring>
 #include <snappy.h>
 #include <vector>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "mongo/base/string_data.h"
 #include "mongo/config.h"
 #include "mongo/db/jsobj.h"
@@ -65,6 +73,7 @@
 #include "mongo/util/bufreader.h"
 #include "mongo/util/destructor_guard.h"
 #include "mongo/util/mongoutils/str.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/unowned_ptr.h"
 
 namespace mongo {
@@ -171,6 +180,27 @@ public:
     }
 
     void openSource() {
+#ifndef _WIN32
+        // Prefer reading the spill file through a read-only mapping: the merge phase then pulls
+        // blocks straight out of the page cache without a read() syscall and stream-buffer copy
+        // per block, and consumed pages can be given back to the OS as the iterator advances.
+        // Any failure falls back to the buffered stream path below.
+        _fd = ::open(_fileName.c_str(), O_RDONLY);
+        if (_fd >= 0) {
+            const size_t fileLength = boost::filesystem::file_size(_fileName);
+            void* map = ::mmap(nullptr, fileLength, PROT_READ, MAP_SHARED, _fd, 0);
+            if (map != MAP_FAILED) {
+                _map = static_cast<const char*>(map);
+                _mapLength = fileLength;
+                _mapOffset = _fileStartOffset;
+                _mapEvictedBytes = _fileStartOffset;
+                ::madvise(map, fileLength, MADV_SEQUENTIAL);
+                return;
+            }
+            ::close(_fd);
+            _fd = -1;
+        }
+#endif
         _file.open(_fileName.c_str(), std::ios::in | std::ios::binary);
         uassert(16814,
                 str::stream() << "error opening file \"" << _fileName << "\": "
@@ -187,6 +217,15 @@ public:
     }
 
     void closeSource() {
+#ifndef _WIN32
+        if (_map) {
+            ::munmap(const_cast<char*>(_map), _mapLength);
+            ::close(_fd);
+            _map = nullptr;
+            _fd = -1;
+            return;
+        }
+#endif
         _file.close();
         uassert(50969,
                 str::stream() << "error closing file \"" << _fileName << "\": "
@@ -238,12 +277,31 @@ private:
         const bool compressed = rawSize < 0;
         int32_t blockSize = std::abs(rawSize);
 
-        _buffer.reset(new char[blockSize]);
-        read(_buffer.get(), blockSize);
-        uassert(16816, "file too short?", !_done);
+        // When the file is memory mapped the block is consumed in place from the page cache;
+        // otherwise it is read into _buffer. Every path below that hands the data to the
+        // BufReader without transforming it must copy mapped data only if it has to.
+        const char* blockData;
+#ifndef _WIN32
+        if (_map) {
+            blockData = mapConsume(blockSize);
+            uassert(16816, "file too short?", !_done);
+            evictConsumedPages();
+        } else
+#endif
+        {
+            _buffer.reset(new char[blockSize]);
+            read(_buffer.get(), blockSize);
+            uassert(16816, "file too short?", !_done);
+            blockData = _buffer.get();
+        }
 
         auto encryptionHooks = EncryptionHooks::get(getGlobalServiceContext());
         if (encryptionHooks->enabled()) {
+            if (blockData != _buffer.get()) {
+                // The decryption hook takes a mutable input buffer.
+                _buffer.reset(new char[blockSize]);
+                memcpy(_buffer.get(), blockData, blockSize);
+            }
             std::unique_ptr<char[]> out(new char[blockSize]);
             size_t outLen;
             Status status =
@@ -257,24 +315,27 @@ private:
                     status.isOK());
             blockSize = outLen;
             _buffer.swap(out);
+            blockData = _buffer.get();
         }
 
         if (!compressed) {
-            _bufferReader.reset(new BufReader(_buffer.get(), blockSize));
+            // For a mapped, unencrypted block this reads directly out of the page cache; the
+            // mapping stays valid until closeSource().
+            _bufferReader.reset(new BufReader(blockData, blockSize));
             return;
         }
 
-        dassert(snappy::IsValidCompressedBuffer(_buffer.get(), blockSize));
+        dassert(snappy::IsValidCompressedBuffer(blockData, blockSize));
 
         size_t uncompressedSize;
         uassert(17061,
                 "couldn't get uncompressed length",
-                snappy::GetUncompressedLength(_buffer.get(), blockSize, &uncompressedSize));
+                snappy::GetUncompressedLength(blockData, blockSize, &uncompressedSize));
 
         std::unique_ptr<char[]> decompressionBuffer(new char[uncompressedSize]);
         uassert(17062,
                 "decompression failed",
-                snappy::RawUncompress(_buffer.get(), blockSize, decompressionBuffer.get()));
+                snappy::RawUncompress(blockData, blockSize, decompressionBuffer.get()));
 
         // hold on to decompressed data and throw out compressed data at block exit
         _buffer.swap(decompressionBuffer);
@@ -287,6 +348,14 @@ private:
      * Masserts on any file errors
      */
     void read(void* out, size_t size) {
+#ifndef _WIN32
+        if (_map) {
+            const char* in = mapConsume(size);
+            if (!_done)
+                memcpy(out, in, size);
+            return;
+        }
+#endif
         invariant(_file.is_open());
 
         if (static_cast<unsigned int>(_file.tellg()) >= _fileEndOffset) {
@@ -303,6 +372,49 @@ private:
         verify(_file.gcount() == static_cast<std::streamsize>(size));
     }
 
+#ifndef _WIN32
+    /**
+     * Returns a pointer to the next 'size' unread bytes of the mapping and advances past them.
+     * Sets _done when the iterator's range of the file is exhausted.
+     */
+    const char* mapConsume(size_t size) {
+        if (_mapOffset >= _fileEndOffset) {
+            invariant(_mapOffset == _fileEndOffset);
+            _done = true;
+            return nullptr;
+        }
+
+        uassert(51059,
+                str::stream() << "file \"" << _fileName << "\" is shorter than expected",
+                _mapOffset + size <= _fileEndOffset);
+
+        const char* data = _map + _mapOffset;
+        _mapOffset += size;
+        return data;
+    }
+
+    /**
+     * Advises the OS that the pages before the block about to be consumed are no longer needed,
+     * so a large merge does not hold the whole spill file in the page cache. Runs at a coarse
+     * granularity to keep the madvise() calls rare.
+     */
+    void evictConsumedPages() {
+        const size_t kEvictChunkBytes = 16 * 1024 * 1024;
+        if (_mapOffset - _mapEvictedBytes < kEvictChunkBytes)
+            return;
+
+        const size_t pageSize = ProcessInfo::getPageSize();
+        const size_t evictEnd = (_mapOffset / pageSize) * pageSize;
+        if (evictEnd > _mapEvictedBytes) {
+            const size_t evictBegin = (_mapEvictedBytes + pageSize - 1) / pageSize * pageSize;
+            if (evictEnd > evictBegin) {
+                ::madvise(const_cast<char*>(_map) + evictBegin, evictEnd - evictBegin, MADV_DONTNEED);
+            }
+            _mapEvictedBytes = evictEnd;
+        }
+    }
+#endif
+
     const Settings _settings;
     bool _done;
     std::unique_ptr<char[]> _buffer;
@@ -311,6 +423,15 @@ private:
     unsigned int _fileStartOffset;  // File offset at which the sorted data range starts.
     unsigned int _fileEndOffset;    // File offset at which the sorted data range ends.
     std::ifstream _file;
+
+#ifndef _WIN32
+    // State for the memory-mapped read path; _map is null when falling back to _file.
+    int _fd = -1;
+    const char* _map = nullptr;
+    size_t _mapLength = 0;
+    size_t _mapOffset = 0;        // Next unread byte.
+    size_t _mapEvictedBytes = 0;  // Prefix of the mapping already advised away.
+#endif
 };
 
 /**
@@ -928,6 +1049,18 @@ SortedFileWriter<Key, Value>::SortedFileWriter(const SortOptions& opts,
     _file.exceptions(std::ios::failbit | std::ios::badbit | std::ios::eofbit);
 }
 
+template <typename Key, typename Value>
+SortedFileWriter<Key, Value>::~SortedFileWriter() {
+    if (_writerThread.joinable()) {
+        {
+            stdx::lock_guard<stdx::mutex> lk(_writerMutex);
+            _writerShutdown = true;
+        }
+        _chunkReadyCV.notify_one();
+        _writerThread.join();
+    }
+}
+
 template <typename Key, typename Value>
 void SortedFileWriter<Key, Value>::addAlreadySorted(const Key& key, const Value& val) {
     key.serializeForSorter(_buffer);
@@ -939,22 +1072,69 @@ void SortedFileWriter<Key, Value>::addAlreadySorted(const Key& key, const Value&
 
 template <typename Key, typename Value>
 void SortedFileWriter<Key, Value>::spill() {
-    namespace str = mongoutils::str;
+    if (_buffer.len() == 0)
+        return;
 
-    int32_t size = _buffer.len();
-    char* outBuffer = _buffer.buf();
+    if (!_writerThread.joinable()) {
+        // First full chunk: start the background writer so that compression and file I/O of
+        // this chunk overlap with serialization of the next one.
+        _writerThread = stdx::thread([this] { _writerThreadLoop(); });
+    }
 
-    if (size == 0)
-        return;
+    stdx::unique_lock<stdx::mutex> lk(_writerMutex);
+    _chunkWrittenCV.wait(lk, [&] { return !_chunkPending; });
+    if (_writerException) {
+        std::rethrow_exception(_writerException);
+    }
+    _pendingChunk.assign(_buffer.buf(), _buffer.len());
+    _chunkPending = true;
+    _chunkReadyCV.notify_one();
+    _buffer.reset();
+}
+
+template <typename Key, typename Value>
+void SortedFileWriter<Key, Value>::_writerThreadLoop() {
+    stdx::unique_lock<stdx::mutex> lk(_writerMutex);
+    while (true) {
+        _chunkReadyCV.wait(lk, [&] { return _chunkPending || _writerShutdown; });
+        if (!_chunkPending) {
+            return;
+        }
+        std::string chunk;
+        chunk.swap(_pendingChunk);
+        lk.unlock();
+
+        try {
+            _writeChunk(chunk.data(), static_cast<int32_t>(chunk.size()));
+        } catch (...) {
+            // Surface the failure on the producer's next spill() or done() call.
+            lk.lock();
+            _writerException = std::current_exception();
+            _chunkPending = false;
+            _chunkWrittenCV.notify_all();
+            return;
+        }
+
+        lk.lock();
+        _chunkPending = false;
+        _chunkWrittenCV.notify_all();
+    }
+}
+
+template <typename Key, typename Value>
+void SortedFileWriter<Key, Value>::_writeChunk(const char* data, int32_t size) {
+    namespace str = mongoutils::str;
+
+    const char* outBuffer = data;
 
     std::string compressed;
     snappy::Compress(outBuffer, size, &compressed);
     verify(compressed.size() <= size_t(std::numeric_limits<int32_t>::max()));
 
-    const bool shouldCompress = compressed.size() < size_t(_buffer.len() / 10 * 9);
+    const bool shouldCompress = compressed.size() < size_t(size / 10 * 9);
     if (shouldCompress) {
         size = compressed.size();
-        outBuffer = const_cast<char*>(compressed.data());
+        outBuffer = compressed.data();
     }
 
     std::unique_ptr<char[]> out;
@@ -985,13 +1165,33 @@ void SortedFileWriter<Key, Value>::spill() {
                     str::stream() << "error writing to file \"" << _fileName << "\": "
                                   << sorter::myErrnoWithDescription());
     }
-
-    _buffer.reset();
 }
 
 template <typename Key, typename Value>
 SortIteratorInterface<Key, Value>* SortedFileWriter<Key, Value>::done() {
-    spill();
+    namespace str = mongoutils::str;
+
+    if (_writerThread.joinable()) {
+        // Queue any remaining data as a final chunk, then stop the background writer and take
+        // back ownership of _file.
+        spill();
+        {
+            stdx::unique_lock<stdx::mutex> lk(_writerMutex);
+            _chunkWrittenCV.wait(lk, [&] { return !_chunkPending; });
+            _writerShutdown = true;
+        }
+        _chunkReadyCV.notify_one();
+        _writerThread.join();
+
+        if (_writerException) {
+            std::rethrow_exception(_writerException);
+        }
+    } else if (_buffer.len() > 0) {
+        // Nothing ever filled a whole chunk; write the remainder directly.
+        _writeChunk(_buffer.buf(), _buffer.len());
+        _buffer.reset();
+    }
+
     long currentFileOffset = _file.tellp();
     uassert(50980,
             str::stream() << "error fetching current file descriptor offset in file \"" << _fileName
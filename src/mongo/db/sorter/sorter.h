@@ -31,6 +31,7 @@
 #pragma once
 
 #include <deque>
+#include <exception>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -39,6 +40,9 @@
 
 #include "mongo/base/disallow_copying.h"
 #include "mongo/bson/util/builder.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
 
 /**
  * This is the public API for the Sorter (both in-memory and external)
@@ -233,6 +237,8 @@ public:
                               const unsigned int fileStartOffset,
                               const Settings& settings = Settings());
 
+    ~SortedFileWriter();
+
     void addAlreadySorted(const Key&, const Value&);
 
     /**
@@ -254,11 +260,33 @@ public:
 private:
     void spill();
 
+    /**
+     * Compresses, optionally encrypts, and appends one chunk to the file. Once the background
+     * writer thread has started, only that thread may call this (and thus touch _file) until it
+     * is joined.
+     */
+    void _writeChunk(const char* data, int32_t size);
+
+    void _writerThreadLoop();
+
     const Settings _settings;
     std::string _fileName;
     std::ofstream _file;
     BufBuilder _buffer;
 
+    // Background chunk writer, started on the first full chunk. spill() hands the chunk over
+    // and returns so that serialization of the next chunk overlaps with compression and file
+    // I/O of the previous one. All of the following except the thread itself are guarded by
+    // _writerMutex.
+    stdx::thread _writerThread;
+    stdx::mutex _writerMutex;
+    stdx::condition_variable _chunkReadyCV;
+    stdx::condition_variable _chunkWrittenCV;
+    std::string _pendingChunk;
+    bool _chunkPending = false;
+    bool _writerShutdown = false;
+    std::exception_ptr _writerException;
+
     // Tracks where in the file we started and finished writing the sorted data range so that the
     // information can be given to the Iterator in done(), and to the user via getFileEndOffset()
     // for the next SortedFileWriter instance using the same file.
@@ -37,13 +37,16 @@
 #include "mongo/rpc/message.h"
 #include "mongo/util/concurrency/spin_lock.h"
 #include "mongo/util/processinfo.h"
+#include "mongo/util/sharded_counter.h"
 #include "mongo/util/with_alignment.h"
 
 namespace mongo {
 
 /**
  * for storing operation counters
- * note: not thread safe.  ok with that for speed
+ *
+ * The counters are sharded per thread so that every operation in the system does not hammer
+ * the same cache lines; reads aggregate the shards.
  */
 class OpCounters {
 public:
@@ -75,36 +78,37 @@ public:
 
     BSONObj getObj() const;
 
-    // thse are used by snmp, and other things, do not remove
-    const AtomicWord<long long>* getInsert() const {
-        return &_insert;
+    // these are used by snmp, and other things, do not remove
+    long long getInsert() const {
+        return _insert.get();
     }
-    const AtomicWord<long long>* getQuery() const {
-        return &_query;
+    long long getQuery() const {
+        return _query.get();
     }
-    const AtomicWord<long long>* getUpdate() const {
-        return &_update;
+    long long getUpdate() const {
+        return _update.get();
     }
-    const AtomicWord<long long>* getDelete() const {
-        return &_delete;
+    long long getDelete() const {
+        return _delete.get();
     }
-    const AtomicWord<long long>* getGetMore() const {
-        return &_getmore;
+    long long getGetMore() const {
+        return _getmore.get();
     }
-    const AtomicWord<long long>* getCommand() const {
-        return &_command;
+    long long getCommand() const {
+        return _command.get();
     }
 
 private:
-    // Increment member `counter` by `n`, resetting all counters if it was > 2^60.
-    void _checkWrap(CacheAligned<AtomicWord<long long>> OpCounters::*counter, int n);
-
-    CacheAligned<AtomicWord<long long>> _insert;
-    CacheAligned<AtomicWord<long long>> _query;
-    CacheAligned<AtomicWord<long long>> _update;
-    CacheAligned<AtomicWord<long long>> _delete;
-    CacheAligned<AtomicWord<long long>> _getmore;
-    CacheAligned<AtomicWord<long long>> _command;
+    // Increment member `counter` by `n`, resetting all counters if the aggregated value could
+    // have passed 2^60.
+    void _checkWrap(ShardedCounter OpCounters::*counter, int n);
+
+    ShardedCounter _insert;
+    ShardedCounter _query;
+    ShardedCounter _update;
+    ShardedCounter _delete;
+    ShardedCounter _getmore;
+    ShardedCounter _command;
 };
 
 extern OpCounters globalOpCounters;
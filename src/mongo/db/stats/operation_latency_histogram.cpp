@@ -176,4 +176,65 @@ void OperationLatencyHistogram::increment(uint64_t latency, Command::ReadWriteTy
     }
 }
 
+void AtomicOperationLatencyHistogram::_append(const HistogramData& data,
+                                              const char* key,
+                                              bool includeHistograms,
+                                              BSONObjBuilder* builder) const {
+
+    BSONObjBuilder histogramBuilder(builder->subobjStart(key));
+    if (includeHistograms) {
+        BSONArrayBuilder arrayBuilder(histogramBuilder.subarrayStart("histogram"));
+        for (int i = 0; i < OperationLatencyHistogram::kMaxBuckets; i++) {
+            auto count = data.buckets[i].loadRelaxed();
+            if (count == 0)
+                continue;
+            BSONObjBuilder entryBuilder(arrayBuilder.subobjStart());
+            entryBuilder.append(
+                "micros", static_cast<long long>(OperationLatencyHistogram::kLowerBounds[i]));
+            entryBuilder.append("count", static_cast<long long>(count));
+            entryBuilder.doneFast();
+        }
+        arrayBuilder.doneFast();
+    }
+    histogramBuilder.append("latency", static_cast<long long>(data.sum.loadRelaxed()));
+    histogramBuilder.append("ops", static_cast<long long>(data.entryCount.loadRelaxed()));
+    histogramBuilder.doneFast();
+}
+
+void AtomicOperationLatencyHistogram::append(bool includeHistograms,
+                                             BSONObjBuilder* builder) const {
+    _append(_reads, "reads", includeHistograms, builder);
+    _append(_writes, "writes", includeHistograms, builder);
+    _append(_commands, "commands", includeHistograms, builder);
+    _append(_transactions, "transactions", includeHistograms, builder);
+}
+
+void AtomicOperationLatencyHistogram::_incrementData(uint64_t latency,
+                                                     int bucket,
+                                                     HistogramData* data) {
+    data->buckets[bucket].fetchAndAddRelaxed(1);
+    data->entryCount.fetchAndAddRelaxed(1);
+    data->sum.fetchAndAddRelaxed(latency);
+}
+
+void AtomicOperationLatencyHistogram::increment(uint64_t latency, Command::ReadWriteType type) {
+    int bucket = OperationLatencyHistogram::_getBucket(latency);
+    switch (type) {
+        case Command::ReadWriteType::kRead:
+            _incrementData(latency, bucket, &_reads);
+            break;
+        case Command::ReadWriteType::kWrite:
+            _incrementData(latency, bucket, &_writes);
+            break;
+        case Command::ReadWriteType::kCommand:
+            _incrementData(latency, bucket, &_commands);
+            break;
+        case Command::ReadWriteType::kTransaction:
+            _incrementData(latency, bucket, &_transactions);
+            break;
+        default:
+            MONGO_UNREACHABLE;
+    }
+}
+
 }  // namespace mongo
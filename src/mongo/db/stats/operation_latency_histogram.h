@@ -32,6 +32,7 @@
 #include <array>
 
 #include "mongo/db/commands.h"
+#include "mongo/platform/atomic_word.h"
 
 namespace mongo {
 
@@ -79,5 +80,43 @@ private:
     void _incrementData(uint64_t latency, int bucket, HistogramData* data);
 
     HistogramData _reads, _writes, _commands, _transactions;
+
+    friend class AtomicOperationLatencyHistogram;
+};
+
+/**
+ * Thread-safe variant of OperationLatencyHistogram used for the server-wide latency totals,
+ * which every user operation updates. Increments are relaxed atomic adds rather than updates
+ * under a mutex, so concurrent operations never serialize on this histogram. A reader may
+ * observe a bucket count without the matching sum, which is acceptable for monitoring output.
+ */
+class AtomicOperationLatencyHistogram {
+public:
+    /**
+     * Increments the bucket of the histogram based on the operation type.
+     */
+    void increment(uint64_t latency, Command::ReadWriteType type);
+
+    /**
+     * Appends the four histograms with latency totals and operation counts.
+     */
+    void append(bool includeHistograms, BSONObjBuilder* builder) const;
+
+private:
+    struct HistogramData {
+        std::array<AtomicWord<unsigned long long>, OperationLatencyHistogram::kMaxBuckets>
+            buckets{};
+        AtomicWord<unsigned long long> entryCount{0};
+        AtomicWord<unsigned long long> sum{0};
+    };
+
+    void _append(const HistogramData& data,
+                 const char* key,
+                 bool includeHistograms,
+                 BSONObjBuilder* builder) const;
+
+    static void _incrementData(uint64_t latency, int bucket, HistogramData* data);
+
+    HistogramData _reads, _writes, _commands, _transactions;
 };
 }  // namespace mongo
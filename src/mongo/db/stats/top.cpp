@@ -85,15 +85,20 @@ void Top::record(OperationContext* opCtx,
         return;
 
     auto hashedNs = UsageMap::hasher().hashed_key(ns);
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-
-    if ((command || logicalOp == LogicalOp::opQuery) &&
-        _collDropNs.find(ns.toString()) != _collDropNs.end()) {
-        _collDropNs.erase(ns.toString());
-        return;
+    auto& shard = _shardForHash(hashedNs.hash());
+    stdx::lock_guard<SimpleMutex> lk(shard.lock);
+
+    // The drop-pending set is empty except in the window right after a collection drop, so check
+    // that before materializing a std::string from the namespace for the lookup.
+    if (!shard.collDropNs.empty() && (command || logicalOp == LogicalOp::opQuery)) {
+        auto dropNsIt = shard.collDropNs.find(ns.toString());
+        if (dropNsIt != shard.collDropNs.end()) {
+            shard.collDropNs.erase(dropNsIt);
+            return;
+        }
     }
 
-    CollectionData& coll = _usage[hashedNs];
+    CollectionData& coll = shard.usage[hashedNs];
     _record(opCtx, coll, logicalOp, lockType, micros, readWriteType);
 }
 
@@ -143,24 +148,33 @@ void Top::_record(OperationContext* opCtx,
 }
 
 void Top::collectionDropped(StringData ns, bool databaseDropped) {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    _usage.erase(ns);
+    auto hashedNs = UsageMap::hasher().hashed_key(ns);
+    auto& shard = _shardForHash(hashedNs.hash());
+    stdx::lock_guard<SimpleMutex> lk(shard.lock);
+    shard.usage.erase(ns);
 
     if (!databaseDropped) {
         // If a collection drop occurred, there will be a subsequent call to record for this
         // collection namespace which must be ignored. This does not apply to a database drop.
-        _collDropNs.insert(ns.toString());
+        shard.collDropNs.insert(ns.toString());
     }
 }
 
 void Top::cloneMap(Top::UsageMap& out) const {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    out = _usage;
+    out.clear();
+    for (size_t i = 0; i < kNumUsageShards; i++) {
+        const auto& shard = _shards[i];
+        stdx::lock_guard<SimpleMutex> lk(shard.lock);
+        for (const auto& entry : shard.usage) {
+            out[entry.first] = entry.second;
+        }
+    }
 }
 
 void Top::append(BSONObjBuilder& b) {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    _appendToUsageMap(b, _usage);
+    UsageMap combined;
+    cloneMap(combined);
+    _appendToUsageMap(b, combined);
 }
 
 void Top::_appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const {
@@ -203,9 +217,10 @@ void Top::_appendStatsEntry(BSONObjBuilder& b, const char* statsName, const Usag
 
 void Top::appendLatencyStats(StringData ns, bool includeHistograms, BSONObjBuilder* builder) {
     auto hashedNs = UsageMap::hasher().hashed_key(ns);
-    stdx::lock_guard<SimpleMutex> lk(_lock);
+    auto& shard = _shardForHash(hashedNs.hash());
+    stdx::lock_guard<SimpleMutex> lk(shard.lock);
     BSONObjBuilder latencyStatsBuilder;
-    _usage[hashedNs].opLatencyHistogram.append(includeHistograms, &latencyStatsBuilder);
+    shard.usage[hashedNs].opLatencyHistogram.append(includeHistograms, &latencyStatsBuilder);
     builder->append("ns", ns);
     builder->append("latencyStats", latencyStatsBuilder.obj());
 }
@@ -213,23 +228,21 @@ void Top::appendLatencyStats(StringData ns, bool includeHistograms, BSONObjBuild
 void Top::incrementGlobalLatencyStats(OperationContext* opCtx,
                                       uint64_t latency,
                                       Command::ReadWriteType readWriteType) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
     _incrementHistogram(opCtx, latency, &_globalHistogramStats, readWriteType);
 }
 
 void Top::appendGlobalLatencyStats(bool includeHistograms, BSONObjBuilder* builder) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
     _globalHistogramStats.append(includeHistograms, builder);
 }
 
 void Top::incrementGlobalTransactionLatencyStats(uint64_t latency) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
     _globalHistogramStats.increment(latency, Command::ReadWriteType::kTransaction);
 }
 
+template <typename Histogram>
 void Top::_incrementHistogram(OperationContext* opCtx,
                               long long latency,
-                              OperationLatencyHistogram* histogram,
+                              Histogram* histogram,
                               Command::ReadWriteType readWriteType) {
     // Only update histogram if operation came from a user.
     Client* client = opCtx->getClient();
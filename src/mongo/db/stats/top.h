@@ -37,6 +37,7 @@
 #include "mongo/db/commands.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/stats/operation_latency_histogram.h"
+#include "mongo/stdx/new.h"
 #include "mongo/util/concurrency/mutex.h"
 #include "mongo/util/string_map.h"
 
@@ -143,15 +144,35 @@ private:
                  long long micros,
                  Command::ReadWriteType readWriteType);
 
+    template <typename Histogram>
     void _incrementHistogram(OperationContext* opCtx,
                              long long latency,
-                             OperationLatencyHistogram* histogram,
+                             Histogram* histogram,
                              Command::ReadWriteType readWriteType);
 
-    mutable SimpleMutex _lock;
-    OperationLatencyHistogram _globalHistogramStats;
-    UsageMap _usage;
-    std::set<std::string> _collDropNs;
+    // The usage map is sharded by namespace hash so that record(), which runs at the end of
+    // every operation, does not funnel every thread through a single mutex. A namespace lives
+    // in exactly one shard, so readers combine the shard maps without any merging of entries.
+    static const size_t kNumUsageShards = 16;
+
+    // Aligned so that neighbouring shards never share a cache line; without this, updates to one
+    // shard's mutex would invalidate the line holding its neighbours and reintroduce contention
+    // between operations the sharding is meant to keep independent.
+    struct alignas(stdx::hardware_destructive_interference_size) UsageShard {
+        mutable SimpleMutex lock;
+        UsageMap usage;
+        std::set<std::string> collDropNs;
+    };
+
+    UsageShard& _shardForHash(size_t hash) {
+        return _shards[hash % kNumUsageShards];
+    }
+
+    UsageShard _shards[kNumUsageShards];
+
+    // The global histogram is updated at the end of every user operation, so it uses atomic
+    // counters rather than a mutex. See AtomicOperationLatencyHistogram.
+    AtomicOperationLatencyHistogram _globalHistogramStats;
 };
 
 }  // namespace mongo
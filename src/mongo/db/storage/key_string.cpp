@@ -2038,14 +2038,12 @@ size_t KeyString::getKeySize(const char* buffer,
     return (len - (remainingBytes - 1));
 }
 
-BSONObj KeyString::toBsonSafe(const char* buffer,
-                              size_t len,
-                              Ordering ord,
-                              const TypeBits& typeBits) {
+BSONObj KeyString::toBsonSafe(
+    const char* buffer, size_t len, Ordering ord, const TypeBits& typeBits, int numFields) {
     BSONObjBuilder builder;
     BufReader reader(buffer, len);
     TypeBits::Reader typeBitsReader(typeBits);
-    for (int i = 0; reader.remaining(); i++) {
+    for (int i = 0; reader.remaining() && (numFields < 0 || i < numFields); i++) {
         const bool invert = (ord.get(i) == -1);
         uint8_t ctype = readType<uint8_t>(&reader, invert);
         if (ctype == kLess || ctype == kGreater) {
@@ -2066,8 +2064,9 @@ BSONObj KeyString::toBsonSafe(const char* buffer,
 BSONObj KeyString::toBson(const char* buffer,
                           size_t len,
                           Ordering ord,
-                          const TypeBits& typeBits) noexcept {
-    return toBsonSafe(buffer, len, ord, typeBits);
+                          const TypeBits& typeBits,
+                          int numFields) noexcept {
+    return toBsonSafe(buffer, len, ord, typeBits, numFields);
 }
 
 BSONObj KeyString::toBson(StringData data, Ordering ord, const TypeBits& typeBits) {
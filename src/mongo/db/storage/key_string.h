@@ -34,6 +34,7 @@
 
 #include <limits>
 
+#include "mongo/base/disallow_copying.h"
 #include "mongo/base/static_assert.h"
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobj.h"
@@ -336,13 +337,19 @@ public:
      * noexcept since the assumption is that 'buffer' is a valid KeyString buffer and this method
      * is not expected to throw.
      *
+     * If 'numFields' is non-negative, only the first 'numFields' fields of the key are decoded
+     * and the rest of the buffer is ignored. Since the encoding is sequential, decoding a prefix
+     * costs proportionally less than decoding the complete key.
+     *
      * If the buffer provided may not be valid, use the 'safe' version instead.
      */
     static BSONObj toBson(const char* buffer,
                           size_t len,
                           Ordering ord,
-                          const TypeBits& types) noexcept;
-    static BSONObj toBsonSafe(const char* buffer, size_t len, Ordering ord, const TypeBits& types);
+                          const TypeBits& types,
+                          int numFields = -1) noexcept;
+    static BSONObj toBsonSafe(
+        const char* buffer, size_t len, Ordering ord, const TypeBits& types, int numFields = -1);
 
     /**
      * Decodes a RecordId from the end of a buffer.
@@ -482,4 +489,33 @@ inline std::ostream& operator<<(std::ostream& stream, const KeyString& value) {
     return stream << value.toString();
 }
 
+/**
+ * Encodes a column of index keys sharing one Ordering while reusing a single KeyString's buffer
+ * and TypeBits allocations across the whole batch. Each key's encoding is identical to
+ * KeyString(version, key, ord, loc), but a key that grows the buffer past the stack-allocated
+ * portion pays for the heap allocation once per batch rather than once per key. Consumers must
+ * copy out or finish using each key's buffer and TypeBits before the next call to encode().
+ */
+class KeyStringBatchEncoder {
+    MONGO_DISALLOW_COPYING(KeyStringBatchEncoder);
+
+public:
+    KeyStringBatchEncoder(KeyString::Version version, Ordering ord)
+        : _ord(ord), _keyString(version) {}
+
+    const KeyString& encode(const BSONObj& key, RecordId loc) {
+        _keyString.resetToKey(key, _ord, loc);
+        return _keyString;
+    }
+
+    const KeyString& encode(const BSONObj& key) {
+        _keyString.resetToKey(key, _ord);
+        return _keyString;
+    }
+
+private:
+    const Ordering _ord;
+    KeyString _keyString;
+};
+
 }  // namespace mongo
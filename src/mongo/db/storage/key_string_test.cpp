@@ -215,6 +215,27 @@ TEST_F(KeyStringTest, Simple1) {
                      KeyString(version, b, ALL_ASCENDING, RecordId()));
 }
 
+TEST_F(KeyStringTest, BatchEncoderMatchesPerKeyEncoding) {
+    const BSONObj keys[] = {
+        BSON("" << 5),
+        BSON("" << 6.0),
+        BSON("" << "mixed types in one batch"),
+        BSON("" << std::string(1000, 'x')),  // Grows past the stack-allocated buffer.
+        BSON("" << BSON_ARRAY(1 << 2 << 3)),
+    };
+
+    KeyStringBatchEncoder encoder(version, ALL_ASCENDING);
+    for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); i++) {
+        const KeyString expected(version, keys[i], ALL_ASCENDING, RecordId(i + 1));
+        const KeyString& actual = encoder.encode(keys[i], RecordId(i + 1));
+        ASSERT_EQUALS(expected, actual);
+        ASSERT_EQUALS(expected.getTypeBits().getSize(), actual.getTypeBits().getSize());
+        ASSERT(memcmp(expected.getTypeBits().getBuffer(),
+                      actual.getTypeBits().getBuffer(),
+                      expected.getTypeBits().getSize()) == 0);
+    }
+}
+
 #define ROUNDTRIP_ORDER(version, x, order)                            \
     do {                                                              \
         const BSONObj _orig = x;                                      \
@@ -372,6 +393,27 @@ TEST_F(KeyStringTest, Undef1) {
     ROUNDTRIP(version, BSON("" << BSONUndefined));
 }
 
+TEST_F(KeyStringTest, DecodePrefixOfCompoundKey) {
+    const BSONObj obj = BSON("" << 1 << ""
+                                << "abc"
+                                << "" << 2.5);
+    const KeyString ks(version, obj, ALL_ASCENDING);
+
+    ASSERT_BSONOBJ_EQ(
+        BSON("" << 1),
+        KeyString::toBson(ks.getBuffer(), ks.getSize(), ALL_ASCENDING, ks.getTypeBits(), 1));
+    ASSERT_BSONOBJ_EQ(
+        BSON("" << 1 << ""
+                << "abc"),
+        KeyString::toBson(ks.getBuffer(), ks.getSize(), ALL_ASCENDING, ks.getTypeBits(), 2));
+
+    // Requesting at least as many fields as the key has, or a negative count, decodes everything.
+    ASSERT_BSONOBJ_EQ(
+        obj, KeyString::toBson(ks.getBuffer(), ks.getSize(), ALL_ASCENDING, ks.getTypeBits(), 5));
+    ASSERT_BSONOBJ_EQ(
+        obj, KeyString::toBson(ks.getBuffer(), ks.getSize(), ALL_ASCENDING, ks.getTypeBits(), -1));
+}
+
 TEST_F(KeyStringTest, NumberLong0) {
     double d = (1ll << 52) - 1;
     long long ll = static_cast<long long>(d);
@@ -40,6 +40,7 @@
 
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/index/index_descriptor.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/db/storage/mobile/mobile_index.h"
 #include "mongo/db/storage/mobile/mobile_kv_engine.h"
 #include "mongo/db/storage/mobile/mobile_record_store.h"
@@ -56,6 +57,28 @@ namespace mongo {
 class MobileSession;
 class SqliteStatement;
 
+namespace {
+
+// SQLite "synchronous" levels.
+constexpr int kSynchronousNormal = 1;
+constexpr int kSynchronousExtra = 3;
+constexpr int kSynchronousFull = 2;
+
+// The "synchronous" level the engine's connections run with.  FULL (the default) fsyncs the WAL
+// on every commit.  NORMAL defers the fsync to WAL checkpoints, letting many commits share a
+// single sync at the cost of possibly losing the most recent commits on power failure; on
+// fsync-bound flash storage this is the difference between per-write and per-batch sync cost.
+MONGO_EXPORT_STARTUP_SERVER_PARAMETER(mobileDurabilityLevel, int, kSynchronousFull)
+    ->withValidator([](const int& newVal) {
+        if (newVal < kSynchronousNormal || newVal > kSynchronousExtra) {
+            return Status(ErrorCodes::BadValue,
+                          "mobileDurabilityLevel must be between 1 (NORMAL) and 3 (EXTRA)");
+        }
+        return Status::OK();
+    });
+
+}  // namespace
+
 MobileKVEngine::MobileKVEngine(const std::string& path) {
     _initDBPath(path);
 
@@ -86,9 +109,16 @@ MobileKVEngine::MobileKVEngine(const std::string& path) {
         LOG(MOBILE_LOG_LEVEL_LOW) << "MobileSE: Confirmed SQLite database opened in WAL mode";
     }
 
-    // Ensure SQLite is operating with "synchronous" flag set to FULL.
+    // Set and ensure SQLite is operating with the configured "synchronous" durability level.
     {
-#define PRAGMA_SYNC_FULL 2
+        _durabilityLevel = mobileDurabilityLevel;
+
+        std::string syncPragma =
+            "PRAGMA main.synchronous = " + std::to_string(_durabilityLevel) + ";";
+        char* errMsg = NULL;
+        status = sqlite3_exec(initSession, syncPragma.c_str(), NULL, NULL, &errMsg);
+        checkStatus(status, SQLITE_OK, "sqlite3_exec", errMsg);
+        sqlite3_free(errMsg);
 
         sqlite3_stmt* stmt;
         status = sqlite3_prepare_v2(initSession, "PRAGMA main.synchronous;", -1, &stmt, NULL);
@@ -97,14 +127,14 @@ MobileKVEngine::MobileKVEngine(const std::string& path) {
         status = sqlite3_step(stmt);
         checkStatus(status, SQLITE_ROW, "sqlite3_step");
 
-        // Pragma returns current "synchronous" setting, ensure it is FULL.
+        // Pragma returns current "synchronous" setting, ensure it took hold.
         int sync_val = sqlite3_column_int(stmt, 0);
-        fassert(50869, sync_val == PRAGMA_SYNC_FULL);
+        fassert(50869, sync_val == _durabilityLevel);
         status = sqlite3_finalize(stmt);
         checkStatus(status, SQLITE_OK, "sqlite3_finalize");
 
         LOG(MOBILE_LOG_LEVEL_LOW) << "MobileSE: Confirmed SQLite database has synchronous "
-                                  << "set to FULL";
+                                  << "set to " << sync_val;
     }
 
     // Set and ensure SQLite is operating with F_FULLFSYNC if the platform permits.
@@ -136,7 +166,21 @@ MobileKVEngine::MobileKVEngine(const std::string& path) {
                                   << ". Val: " << fullfsync_val;
     }
 
-    _sessionPool.reset(new MobileSessionPool(_path));
+    _sessionPool.reset(new MobileSessionPool(_path, _durabilityLevel));
+}
+
+int MobileKVEngine::flushAllFiles(OperationContext* opCtx, bool sync) {
+    // At FULL durability every commit already fsyncs the WAL, so there is nothing to flush.  At
+    // NORMAL, commits ride on the WAL without a sync of their own and only become durable when
+    // the WAL is checkpointed; force such a checkpoint here so that an explicit flush still
+    // provides a durability barrier.
+    if (!sync || _durabilityLevel >= kSynchronousFull) {
+        return 0;
+    }
+
+    auto session = _sessionPool->getSession(opCtx);
+    SqliteStatement::execQuery(session.get(), "PRAGMA main.wal_checkpoint(FULL);");
+    return 1;
 }
 
 void MobileKVEngine::_initDBPath(const std::string& path) {
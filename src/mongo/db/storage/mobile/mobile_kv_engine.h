@@ -98,11 +98,10 @@ public:
     }
 
     /**
-     * Flush is a no-op since SQLite transactions are durable by default after each commit.
+     * Flush is a no-op at FULL durability since SQLite transactions are then durable after each
+     * commit; at lower durability levels it forces a WAL checkpoint as a durability barrier.
      */
-    int flushAllFiles(OperationContext* opCtx, bool sync) override {
-        return 0;
-    }
+    int flushAllFiles(OperationContext* opCtx, bool sync) override;
 
     bool isEphemeral() const override {
         return false;
@@ -139,6 +138,9 @@ private:
 
     std::unique_ptr<MobileSessionPool> _sessionPool;
 
+    // The SQLite "synchronous" level the engine was started with.
+    int _durabilityLevel;
+
     // Notified when we write as everything is considered "journalled" since repl depends on it.
     JournalListener* _journalListener = &NoOpJournalListener::instance;
 
@@ -96,8 +96,10 @@ bool MobileDelayedOpQueue::isEmpty() {
     return (_isEmpty.load());
 }
 
-MobileSessionPool::MobileSessionPool(const std::string& path, std::uint64_t maxPoolSize)
-    : _path(path), _maxPoolSize(maxPoolSize) {}
+MobileSessionPool::MobileSessionPool(const std::string& path,
+                                     int durabilityLevel,
+                                     std::uint64_t maxPoolSize)
+    : _path(path), _durabilityLevel(durabilityLevel), _maxPoolSize(maxPoolSize) {}
 
 MobileSessionPool::~MobileSessionPool() {
     shutDown();
@@ -121,6 +123,16 @@ std::unique_ptr<MobileSession> MobileSessionPool::getSession(OperationContext* o
         sqlite3* session;
         int status = sqlite3_open(_path.c_str(), &session);
         checkStatus(status, SQLITE_OK, "sqlite3_open");
+
+        // The "synchronous" setting is per-connection, so each new connection has to be
+        // configured with the engine's durability level.
+        std::string syncPragma =
+            "PRAGMA synchronous = " + std::to_string(_durabilityLevel) + ";";
+        char* errMsg = NULL;
+        status = sqlite3_exec(session, syncPragma.c_str(), NULL, NULL, &errMsg);
+        checkStatus(status, SQLITE_OK, "sqlite3_exec", errMsg);
+        sqlite3_free(errMsg);
+
         _curPoolSize++;
         return stdx::make_unique<MobileSession>(session, this);
     }
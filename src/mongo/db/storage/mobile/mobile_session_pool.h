@@ -69,7 +69,13 @@ class MobileSessionPool final {
     MONGO_DISALLOW_COPYING(MobileSessionPool);
 
 public:
-    MobileSessionPool(const std::string& path, std::uint64_t maxPoolSize = 80);
+    /**
+     * 'durabilityLevel' is the SQLite "synchronous" setting applied to every connection the pool
+     * opens; see the mobileDurabilityLevel server parameter.
+     */
+    MobileSessionPool(const std::string& path,
+                      int durabilityLevel = 2,
+                      std::uint64_t maxPoolSize = 80);
 
     ~MobileSessionPool();
 
@@ -104,6 +110,9 @@ private:
 
     std::string _path;
 
+    // The "synchronous" pragma value each new connection is configured with.
+    const int _durabilityLevel;
+
     /**
      * PoolSize is the number of open sessions associated with the session pool.
      */
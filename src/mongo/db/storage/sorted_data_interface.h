@@ -253,6 +253,17 @@ public:
          */
         virtual void setEndPosition(const BSONObj& key, bool inclusive) = 0;
 
+        /**
+         * Hints to the cursor that the caller will only inspect the first 'numFields' fields of
+         * any returned key, so the cursor may return keys containing just that prefix.
+         * Implementations are free to ignore the hint and return complete keys. A negative value
+         * clears the hint.
+         *
+         * Must not be set by callers which compare returned keys against full-length bounds,
+         * since a prefix compares differently than the complete key.
+         */
+        virtual void setKeyPrefixFieldsHint(int numFields) {}
+
         /**
          * Moves forward and returns the new data or boost::none if there is no more data.
          * If not positioned, returns boost::none.
@@ -839,6 +839,10 @@ public:
         _endPosition->resetToKey(stripFieldNames(key), _idx.ordering(), discriminator);
     }
 
+    void setKeyPrefixFieldsHint(int numFields) override {
+        _keyPrefixFieldsHint = numFields;
+    }
+
     boost::optional<IndexKeyEntry> seek(const BSONObj& key,
                                         bool inclusive,
                                         RequestedInfo parts) override {
@@ -974,7 +978,8 @@ protected:
 
         BSONObj bson;
         if (TRACING_ENABLED || (parts & kWantKey)) {
-            bson = KeyString::toBson(_key.getBuffer(), _key.getSize(), _idx.ordering(), _typeBits);
+            bson = KeyString::toBson(
+                _key.getBuffer(), _key.getSize(), _idx.ordering(), _typeBits, _keyPrefixFieldsHint);
 
             TRACE_CURSOR << " returning " << bson << ' ' << _id;
         }
@@ -1132,6 +1137,10 @@ protected:
     KVPrefix _prefix;
 
     std::unique_ptr<KeyString> _endPosition;
+
+    // If non-negative, only this many leading fields of the key are decoded to BSON when
+    // returning entries. Positioning and end-point checks always use the complete KeyString.
+    int _keyPrefixFieldsHint = -1;
 };
 
 // The Standard Cursor doesn't need anything more than the base has.
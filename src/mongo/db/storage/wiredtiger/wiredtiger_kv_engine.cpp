@@ -464,8 +464,168 @@ constexpr bool takeUnstableCheckpointOnShutdownDefault = false;
 MONGO_EXPORT_STARTUP_SERVER_PARAMETER(takeUnstableCheckpointOnShutdown,
                                       bool,
                                       takeUnstableCheckpointOnShutdownDefault);
+
+// How often, in milliseconds, the cache pressure monitor samples WiredTiger cache statistics and
+// adjusts write ticket admission. The default of 0 disables both sampling and throttling.
+MONGO_EXPORT_SERVER_PARAMETER(wiredTigerCachePressureMonitorPeriodMS, int, 0)
+    ->withValidator([](const int& newVal) {
+        if (newVal < 0) {
+            return Status(ErrorCodes::BadValue,
+                          "wiredTigerCachePressureMonitorPeriodMS must be >= 0");
+        }
+        return Status::OK();
+    });
+
+// Percentage of the cache which may be dirty before the monitor begins throttling write ticket
+// admission. The default sits just below WiredTiger's eviction_dirty_trigger (20%), at which
+// point application threads are drafted into eviction.
+MONGO_EXPORT_SERVER_PARAMETER(wiredTigerCachePressureDirtyTriggerPct, int, 15)
+    ->withValidator([](const int& newVal) {
+        if (newVal < 1 || newVal > 99) {
+            return Status(ErrorCodes::BadValue,
+                          "wiredTigerCachePressureDirtyTriggerPct must be between 1 and 99");
+        }
+        return Status::OK();
+    });
 }  // namespace
 
+/**
+ * Samples WiredTiger cache statistics at high frequency and throttles write ticket admission
+ * before eviction stalls occur. serverStatus only surfaces engine statistics when polled, which is
+ * too coarse to react to an eviction-server saturation cliff; by the time an operator sees the
+ * dirty ratio spike, application threads are already being drafted into eviction. When the dirty
+ * ratio crosses the configured trigger, the monitor halves the number of concurrent write
+ * transactions (down to a floor), and doubles it back up to the operator-configured value once the
+ * cache recovers.
+ */
+class WiredTigerKVEngine::WiredTigerCachePressureMonitor : public BackgroundJob {
+public:
+    explicit WiredTigerCachePressureMonitor(WiredTigerSessionCache* sessionCache)
+        : BackgroundJob(false /* deleteSelf */), _sessionCache(sessionCache) {}
+
+    virtual string name() const {
+        return "WTCachePressureMonitor";
+    }
+
+    virtual void run() {
+        ThreadClient tc(name(), getGlobalServiceContext());
+        LOG(1) << "starting " << name() << " thread";
+
+        while (!_shuttingDown.load()) {
+            const int periodMS = wiredTigerCachePressureMonitorPeriodMS.load();
+            if (periodMS > 0) {
+                try {
+                    _sampleAndThrottle();
+                } catch (const AssertionException& exc) {
+                    invariant(ErrorCodes::isShutdownError(exc.code()), exc.what());
+                }
+            }
+
+            MONGO_IDLE_THREAD_BLOCK;
+            // When the monitor is disabled we still poll the period parameter so that enabling
+            // it at runtime takes effect without a restart.
+            sleepmillis(periodMS > 0 ? periodMS : kDisabledPollPeriodMS);
+        }
+        LOG(1) << "stopping " << name() << " thread";
+    }
+
+    void shutdown() {
+        _shuttingDown.store(true);
+        wait();
+    }
+
+    /**
+     * Appends the most recent cache statistics sample. Only valid to call while the monitor is
+     * enabled; the sample is stale once it is disabled.
+     */
+    void appendStats(BSONObjBuilder& bb) const {
+        bb.append("bytesDirty", _bytesDirty.load());
+        bb.append("bytesInCache", _bytesInCache.load());
+        bb.append("maxBytes", _bytesMax.load());
+        bb.append("writeTicketsThrottled", _throttled.load());
+    }
+
+private:
+    static constexpr int kDisabledPollPeriodMS = 1000;
+
+    // Never throttle the write tickets below this. Eviction progress requires that operations
+    // continue to complete and release their dirty content.
+    static constexpr int kMinWriteTransactions = 8;
+
+    int64_t _getStat(WT_SESSION* s, int statisticsKey) {
+        return uassertStatusOK(WiredTigerUtil::getStatisticsValueAs<int64_t>(
+            s, "statistics:", "", statisticsKey));
+    }
+
+    void _sampleAndThrottle() {
+        int64_t bytesDirty, bytesInCache, bytesMax;
+        {
+            UniqueWiredTigerSession session = _sessionCache->getSession();
+            WT_SESSION* s = session->getSession();
+            bytesDirty = _getStat(s, WT_STAT_CONN_CACHE_BYTES_DIRTY);
+            bytesInCache = _getStat(s, WT_STAT_CONN_CACHE_BYTES_INUSE);
+            bytesMax = _getStat(s, WT_STAT_CONN_CACHE_BYTES_MAX);
+        }
+
+        _bytesDirty.store(bytesDirty);
+        _bytesInCache.store(bytesInCache);
+        _bytesMax.store(bytesMax);
+
+        if (bytesMax == 0) {
+            return;
+        }
+        const double dirtyPct = bytesDirty * 100.0 / bytesMax;
+        const int triggerPct = wiredTigerCachePressureDirtyTriggerPct.load();
+
+        const int current = openWriteTransaction.outof();
+        if (_throttled.load() && current != _lastSetTickets) {
+            // The operator changed wiredTigerConcurrentWriteTransactions while we were
+            // throttling. Treat the new value as the baseline rather than fighting it.
+            _throttled.store(false);
+        }
+
+        if (dirtyPct >= triggerPct) {
+            const int newSize = std::max(kMinWriteTransactions, current / 2);
+            if (newSize < current) {
+                if (!_throttled.load()) {
+                    _unthrottledTickets = current;
+                    _throttled.store(true);
+                }
+                // Shrinking the pool waits for outstanding tickets to be returned, which is
+                // exactly the desired admission behavior under pressure.
+                fassert(51810, openWriteTransaction.resize(newSize));
+                _lastSetTickets = newSize;
+                log() << "WiredTiger cache pressure: " << static_cast<int>(dirtyPct)
+                      << "% dirty, reducing concurrent write transactions to " << newSize;
+            }
+        } else if (_throttled.load() && dirtyPct < triggerPct * 0.75) {
+            // Recover with hysteresis so the ticket count does not flap around the trigger.
+            const int newSize = std::min(_unthrottledTickets, std::max(current * 2, current + 1));
+            fassert(51811, openWriteTransaction.resize(newSize));
+            _lastSetTickets = newSize;
+            log() << "WiredTiger cache pressure receded, restoring concurrent write transactions "
+                     "to "
+                  << newSize;
+            if (newSize >= _unthrottledTickets) {
+                _throttled.store(false);
+            }
+        }
+    }
+
+    WiredTigerSessionCache* _sessionCache;
+    AtomicWord<bool> _shuttingDown{false};
+
+    // Latest sample, published for serverStatus.
+    AtomicWord<long long> _bytesDirty{0};
+    AtomicWord<long long> _bytesInCache{0};
+    AtomicWord<long long> _bytesMax{0};
+    AtomicWord<bool> _throttled{false};
+
+    // Only accessed by the monitor thread.
+    int _unthrottledTickets = 0;
+    int _lastSetTickets = 0;
+};
+
 StringData WiredTigerKVEngine::kTableUriPrefix = "table:"_sd;
 
 WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
@@ -602,6 +762,12 @@ WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
         _checkpointThread->go();
     }
 
+    if (!_readOnly) {
+        _cachePressureMonitor =
+            stdx::make_unique<WiredTigerCachePressureMonitor>(_sessionCache.get());
+        _cachePressureMonitor->go();
+    }
+
     _sizeStorerUri = _uri("sizeStorer");
     WiredTigerSession session(_conn);
     if (!_readOnly && repair && _hasUri(session.getSession(), _sizeStorerUri)) {
@@ -633,6 +799,7 @@ void WiredTigerKVEngine::appendGlobalStats(BSONObjBuilder& b) {
         bbb.append("out", openWriteTransaction.used());
         bbb.append("available", openWriteTransaction.available());
         bbb.append("totalTickets", openWriteTransaction.outof());
+        bbb.append("totalTimeQueuedMicros", openWriteTransaction.queuedTimeMicros());
         bbb.done();
     }
     {
@@ -640,6 +807,12 @@ void WiredTigerKVEngine::appendGlobalStats(BSONObjBuilder& b) {
         bbb.append("out", openReadTransaction.used());
         bbb.append("available", openReadTransaction.available());
         bbb.append("totalTickets", openReadTransaction.outof());
+        bbb.append("totalTimeQueuedMicros", openReadTransaction.queuedTimeMicros());
+        bbb.done();
+    }
+    if (_cachePressureMonitor && wiredTigerCachePressureMonitorPeriodMS.load() > 0) {
+        BSONObjBuilder bbb(bb.subobjStart("cachePressureMonitor"));
+        _cachePressureMonitor->appendStats(bbb);
         bbb.done();
     }
     bb.done();
@@ -716,6 +889,11 @@ void WiredTigerKVEngine::cleanShutdown() {
     }
 
     // these must be the last things we do before _conn->close();
+    if (_cachePressureMonitor) {
+        log() << "Shutting down cache pressure monitor thread";
+        _cachePressureMonitor->shutdown();
+        log() << "Finished shutting down cache pressure monitor thread";
+    }
     if (_journalFlusher) {
         log() << "Shutting down journal flusher thread";
         _journalFlusher->shutdown();
@@ -1281,9 +1459,9 @@ Status WiredTigerKVEngine::dropIdent(OperationContext* opCtx, StringData ident)
     return Status::OK();
 }
 
-std::list<WiredTigerCachedCursor> WiredTigerKVEngine::filterCursorsWithQueuedDrops(
-    std::list<WiredTigerCachedCursor>* cache) {
-    std::list<WiredTigerCachedCursor> toDrop;
+std::vector<WiredTigerCachedCursor> WiredTigerKVEngine::filterCursorsWithQueuedDrops(
+    std::vector<WiredTigerCachedCursor>* cache) {
+    std::vector<WiredTigerCachedCursor> toDrop;
 
     stdx::lock_guard<stdx::mutex> lk(_identToDropMutex);
     if (_identToDrop.empty())
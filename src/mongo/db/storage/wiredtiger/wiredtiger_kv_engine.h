@@ -35,6 +35,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <boost/filesystem/path.hpp>
 #include <wiredtiger.h>
@@ -256,8 +257,8 @@ public:
         return _conn;
     }
     void dropSomeQueuedIdents();
-    std::list<WiredTigerCachedCursor> filterCursorsWithQueuedDrops(
-        std::list<WiredTigerCachedCursor>* cache);
+    std::vector<WiredTigerCachedCursor> filterCursorsWithQueuedDrops(
+        std::vector<WiredTigerCachedCursor>* cache);
     bool haveDropsQueued() const;
 
     void syncSizeInfo(bool sync) const;
@@ -350,6 +351,7 @@ public:
 private:
     class WiredTigerJournalFlusher;
     class WiredTigerCheckpointThread;
+    class WiredTigerCachePressureMonitor;
 
     /**
      * Opens a connection on the WiredTiger database 'path' with the configuration 'wtOpenConfig'.
@@ -434,6 +436,7 @@ private:
 
     std::unique_ptr<WiredTigerJournalFlusher> _journalFlusher;  // Depends on _sizeStorer
     std::unique_ptr<WiredTigerCheckpointThread> _checkpointThread;
+    std::unique_ptr<WiredTigerCachePressureMonitor> _cachePressureMonitor;
 
     std::string _rsOptions;
     std::string _indexOptions;
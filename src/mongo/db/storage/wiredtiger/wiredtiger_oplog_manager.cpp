@@ -148,9 +148,16 @@ void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
 }
 
 void WiredTigerOplogManager::triggerJournalFlush() {
+    // If a flush is already pending the journal thread is guaranteed to act on it, so there is
+    // nothing to signal and we can skip the mutex. This is the common case when oplog writes
+    // commit faster than the journal thread drains them.
+    if (_opsWaitingForJournal.load()) {
+        return;
+    }
+
     stdx::lock_guard<stdx::mutex> lk(_oplogVisibilityStateMutex);
-    if (!_opsWaitingForJournal) {
-        _opsWaitingForJournal = true;
+    if (!_opsWaitingForJournal.load()) {
+        _opsWaitingForJournal.store(true);
         _opsWaitingForJournalCV.notify_one();
     }
 }
@@ -166,8 +173,8 @@ void WiredTigerOplogManager::_oplogJournalThreadLoop(WiredTigerSessionCache* ses
         stdx::unique_lock<stdx::mutex> lk(_oplogVisibilityStateMutex);
         {
             MONGO_IDLE_THREAD_BLOCK;
-            _opsWaitingForJournalCV.wait(lk,
-                                         [&] { return _shuttingDown || _opsWaitingForJournal; });
+            _opsWaitingForJournalCV.wait(
+                lk, [&] { return _shuttingDown || _opsWaitingForJournal.load(); });
 
             // If we're not shutting down and nobody is actively waiting for the oplog to become
             // durable, delay journaling a bit to reduce the sync rate.
@@ -207,8 +214,8 @@ void WiredTigerOplogManager::_oplogJournalThreadLoop(WiredTigerSessionCache* ses
             log() << "Oplog journal thread loop shutting down";
             return;
         }
-        invariant(_opsWaitingForJournal);
-        _opsWaitingForJournal = false;
+        invariant(_opsWaitingForJournal.load());
+        _opsWaitingForJournal.store(false);
         lk.unlock();
 
         const uint64_t newTimestamp = fetchAllCommittedValue(sessionCache->conn());
@@ -96,9 +96,14 @@ private:
     mutable stdx::condition_variable
         _opsBecameVisibleCV;  // Signaled when a journal flush is complete.
 
-    bool _isRunning = false;             // Guarded by oplogVisibilityStateMutex.
-    bool _shuttingDown = false;          // Guarded by oplogVisibilityStateMutex.
-    bool _opsWaitingForJournal = false;  // Guarded by oplogVisibilityStateMutex.
+    bool _isRunning = false;     // Guarded by oplogVisibilityStateMutex.
+    bool _shuttingDown = false;  // Guarded by oplogVisibilityStateMutex.
+
+    // Whether a journal flush has been requested but not yet acted upon by the journal thread.
+    // False-to-true transitions only happen with oplogVisibilityStateMutex held, so the journal
+    // thread cannot miss a wakeup; triggerJournalFlush() may read it without the mutex to skip
+    // locking when a flush is already pending.
+    AtomicWord<bool> _opsWaitingForJournal{false};
 
     // When greater than 0, indicates that there are operations waiting for oplog visibility, and
     // journal flushing should not be delayed.
@@ -156,6 +156,28 @@ private:
     OplogStones* _oplogStones;
 };
 
+namespace {
+
+// The oplog is logically divided into fixed-size segments (stones) that are each retired with a
+// single ranged truncate once the collection exceeds its maximum size. Sizing a stone purely as
+// a fraction of the oplog makes one truncation cover many gigabytes on large oplogs, and
+// concurrent writers stall behind the delete for its whole duration. Capping the segment size
+// bounds the work an individual truncation does no matter how large the oplog is.
+const unsigned long long kMinOplogStonesToKeep = 10ULL;
+const unsigned long long kMaxOplogStonesToKeep = 100ULL;
+const unsigned long long kMaxBytesPerOplogStone = 256ULL * 1024 * 1024;
+
+size_t numOplogStonesToKeep(unsigned long long maxSize) {
+    unsigned long long numStones = maxSize / BSONObjMaxInternalSize;
+    numStones = std::min(kMaxOplogStonesToKeep, std::max(kMinOplogStonesToKeep, numStones));
+    if (maxSize / numStones > kMaxBytesPerOplogStone) {
+        numStones = maxSize / kMaxBytesPerOplogStone;
+    }
+    return numStones;
+}
+
+}  // namespace
+
 WiredTigerRecordStore::OplogStones::OplogStones(OperationContext* opCtx, WiredTigerRecordStore* rs)
     : _rs(rs) {
     stdx::lock_guard<stdx::mutex> lk(_mutex);
@@ -164,11 +186,7 @@ WiredTigerRecordStore::OplogStones::OplogStones(OperationContext* opCtx, WiredTi
     invariant(rs->cappedMaxSize() > 0);
     unsigned long long maxSize = rs->cappedMaxSize();
 
-    const unsigned long long kMinStonesToKeep = 10ULL;
-    const unsigned long long kMaxStonesToKeep = 100ULL;
-
-    unsigned long long numStones = maxSize / BSONObjMaxInternalSize;
-    size_t numStonesToKeep = std::min(kMaxStonesToKeep, std::max(kMinStonesToKeep, numStones));
+    const size_t numStonesToKeep = numOplogStonesToKeep(maxSize);
     _minBytesPerStone = maxSize / numStonesToKeep;
     invariant(_minBytesPerStone > 0);
 
@@ -457,12 +475,7 @@ void WiredTigerRecordStore::OplogStones::_pokeReclaimThreadIfNeeded() {
 
 void WiredTigerRecordStore::OplogStones::adjust(int64_t maxSize) {
     stdx::lock_guard<stdx::mutex> lk(_mutex);
-    const unsigned long long kMinStonesToKeep = 10ULL;
-    const unsigned long long kMaxStonesToKeep = 100ULL;
-
-    unsigned long long numStones = maxSize / BSONObjMaxInternalSize;
-    size_t numStonesToKeep = std::min(kMaxStonesToKeep, std::max(kMinStonesToKeep, numStones));
-    _minBytesPerStone = maxSize / numStonesToKeep;
+    _minBytesPerStone = maxSize / numOplogStonesToKeep(maxSize);
     invariant(_minBytesPerStone > 0);
     _pokeReclaimThreadIfNeeded();
 }
@@ -1688,7 +1701,7 @@ public:
     virtual void commit(boost::optional<Timestamp>) {}
     virtual void rollback() {
         LOG(3) << "WiredTigerRecordStore: rolling back NumRecordsChange" << -_diff;
-        _rs->_sizeInfo->numRecords.fetchAndAdd(-_diff);
+        _rs->_sizeInfo->numRecords.add(-_diff);
     }
 
 private:
@@ -1702,8 +1715,9 @@ void WiredTigerRecordStore::_changeNumRecords(OperationContext* opCtx, int64_t d
     }
 
     opCtx->recoveryUnit()->registerChange(new NumRecordsChange(this, diff));
-    if (_sizeInfo->numRecords.fetchAndAdd(diff) < 0)
-        _sizeInfo->numRecords.store(std::max(diff, int64_t(0)));
+    // Negative totals (e.g. deltas applied on top of sizes lost in a crash) clamp to zero when
+    // the counter is read.
+    _sizeInfo->numRecords.add(diff);
 }
 
 class WiredTigerRecordStore::DataSizeChange : public RecoveryUnit::Change {
@@ -1727,8 +1741,7 @@ void WiredTigerRecordStore::_increaseDataSize(OperationContext* opCtx, int64_t a
     if (opCtx)
         opCtx->recoveryUnit()->registerChange(new DataSizeChange(this, amount));
 
-    if (_sizeInfo->dataSize.fetchAndAdd(amount) < 0)
-        _sizeInfo->dataSize.store(std::max(amount, int64_t(0)));
+    _sizeInfo->dataSize.add(amount);
 
     if (_sizeStorer)
         _sizeStorer->store(_uri, _sizeInfo);
@@ -34,6 +34,8 @@
 
 #include "mongo/platform/basic.h"
 
+#include <cstdio>
+
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
 
 #include "mongo/bson/bsonobjbuilder.h"
@@ -43,7 +45,6 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_prepare_conflict.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
-#include "mongo/util/hex.h"
 #include "mongo/util/log.h"
 
 namespace mongo {
@@ -83,6 +84,26 @@ std::string toString(WiredTigerRecoveryUnit::State state) {
     MONGO_UNREACHABLE;
 }
 
+/**
+ * Formats a WiredTiger "<setting>=<hex timestamp>" configuration string into a stack buffer, so
+ * that the per-transaction timestamping calls do not allocate.
+ */
+class TimestampConfigString {
+public:
+    TimestampConfigString(const char* setting, Timestamp timestamp) {
+        auto size = std::snprintf(_buf, sizeof(_buf), "%s=%llx", setting, timestamp.asULL());
+        invariant(size >= 0 && static_cast<std::size_t>(size) < sizeof(_buf));
+    }
+
+    const char* c_str() const {
+        return _buf;
+    }
+
+private:
+    // Longest setting name ("prepare_timestamp") + '=' + 16 hex digits + trailing null.
+    char _buf[17 + 1 + 16 + 1];
+};
+
 }  // namespace
 
 using Section = WiredTigerOperationStats::Section;
@@ -282,9 +303,9 @@ void WiredTigerRecoveryUnit::prepareUnitOfWork() {
 
     LOG(1) << "preparing transaction at time: " << _prepareTimestamp;
 
-    const std::string conf = "prepare_timestamp=" + integerToHex(_prepareTimestamp.asULL());
     // Prepare the transaction.
-    invariantWTOK(s->prepare_transaction(s, conf.c_str()));
+    invariantWTOK(s->prepare_transaction(
+        s, TimestampConfigString("prepare_timestamp", _prepareTimestamp).c_str()));
 }
 
 void WiredTigerRecoveryUnit::commitUnitOfWork() {
@@ -383,8 +404,8 @@ void WiredTigerRecoveryUnit::_txnClose(bool commit) {
     int wtRet;
     if (commit) {
         if (!_commitTimestamp.isNull()) {
-            const std::string conf = "commit_timestamp=" + integerToHex(_commitTimestamp.asULL());
-            invariantWTOK(s->timestamp_transaction(s, conf.c_str()));
+            invariantWTOK(s->timestamp_transaction(
+                s, TimestampConfigString("commit_timestamp", _commitTimestamp).c_str()));
             _isTimestamped = true;
         }
 
@@ -497,9 +518,11 @@ void WiredTigerRecoveryUnit::_txnOpen() {
             break;
         }
         case ReadSource::kLastApplied: {
-            if (_sessionCache->snapshotManager().getLocalSnapshot()) {
-                _readAtTimestamp = _sessionCache->snapshotManager().beginTransactionOnLocalSnapshot(
-                    session, _ignorePrepared);
+            // Acquire the refcounted snapshot once so checking for its existence and attaching
+            // to it don't each take the snapshot manager's mutex.
+            if (auto snapshot = _sessionCache->snapshotManager().getSharedLocalSnapshot()) {
+                _readAtTimestamp = WiredTigerSnapshotManager::beginTransactionOnSharedSnapshot(
+                    session, *snapshot, _ignorePrepared);
             } else {
                 WiredTigerBeginTxnBlock(session, _ignorePrepared).done();
             }
@@ -575,8 +598,8 @@ Status WiredTigerRecoveryUnit::setTimestamp(Timestamp timestamp) {
     // Starts the WT transaction associated with this session.
     getSession();
 
-    const std::string conf = "commit_timestamp=" + integerToHex(timestamp.asULL());
-    auto rc = session->timestamp_transaction(session, conf.c_str());
+    auto rc = session->timestamp_transaction(
+        session, TimestampConfigString("commit_timestamp", timestamp).c_str());
     if (rc == 0) {
         _isTimestamped = true;
     }
@@ -36,6 +36,8 @@
 
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 
+#include <algorithm>
+
 #include "mongo/base/error_codes.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/global_settings.h"
@@ -78,6 +80,12 @@ namespace mongo {
 // is a good compromise for most workloads.
 AtomicWord<int> kWiredTigerCursorCacheSize(-100);
 
+// When set to a positive number of microseconds, the thread about to flush the journal on behalf
+// of a waitUntilDurable batch first dwells for that long, so that concurrently committing threads
+// join its batch instead of lining up behind it for a flush of their own. The default of 0
+// flushes immediately.
+AtomicWord<int> kWiredTigerJournalFlushWindowMicros(0);
+
 const std::string kWTRepairMsg =
     "Please read the documentation for starting MongoDB with --repair here: "
     "http://dochub.mongodb.org/core/repair";
@@ -87,6 +95,11 @@ ExportedServerParameter<std::int32_t, ServerParameterType::kStartupAndRuntime>
                                      "wiredTigerCursorCacheSize",
                                      &kWiredTigerCursorCacheSize);
 
+ExportedServerParameter<std::int32_t, ServerParameterType::kStartupAndRuntime>
+    WiredTigerJournalFlushWindowMicrosSetting(ServerParameterSet::getGlobal(),
+                                              "wiredTigerJournalFlushWindowMicros",
+                                              &kWiredTigerJournalFlushWindowMicros);
+
 WiredTigerSession::WiredTigerSession(WT_CONNECTION* conn, uint64_t epoch, uint64_t cursorEpoch)
     : _epoch(epoch), _cursorEpoch(cursorEpoch), _session(NULL), _cursorGen(0), _cursorsOut(0) {
     invariantWTOK(conn->open_session(conn, NULL, "isolation=snapshot", &_session));
@@ -134,11 +147,13 @@ void _openCursor(WT_SESSION* session,
 
 
 WT_CURSOR* WiredTigerSession::getCursor(const std::string& uri, uint64_t id, bool allowOverwrite) {
-    // Find the most recently used cursor
+    // Find a cached cursor for this table. The cache is unordered, so take any match and fill
+    // the hole with the back entry.
     for (CursorCache::iterator i = _cursors.begin(); i != _cursors.end(); ++i) {
         if (i->_id == id) {
             WT_CURSOR* c = i->_cursor;
-            _cursors.erase(i);
+            *i = _cursors.back();
+            _cursors.pop_back();
             _cursorsOut++;
             return c;
         }
@@ -166,14 +181,26 @@ void WiredTigerSession::releaseCursor(uint64_t id, WT_CURSOR* cursor) {
 
     invariantWTOK(cursor->reset(cursor));
 
-    // Cursors are pushed to the front of the list and removed from the back
-    _cursors.push_front(WiredTigerCachedCursor(id, _cursorGen++, cursor));
+    _cursors.push_back(WiredTigerCachedCursor(id, _cursorGen++, cursor));
 
     // A negative value for wiredTigercursorCacheSize means to use hybrid caching.
     std::uint32_t cacheSize = abs(kWiredTigerCursorCacheSize.load());
 
-    while (!_cursors.empty() && _cursorGen - _cursors.back()._gen > cacheSize) {
-        cursor = _cursors.back()._cursor;
+    // The vector is unordered, so evict by repeatedly closing the entry with the oldest
+    // generation until everything left is within the generation window. The scan is over a
+    // small contiguous array, which is cheaper than the per-entry allocation the previous
+    // list-based cache paid on every release.
+    while (!_cursors.empty()) {
+        auto oldest = std::min_element(
+            _cursors.begin(),
+            _cursors.end(),
+            [](const WiredTigerCachedCursor& a, const WiredTigerCachedCursor& b) {
+                return a._gen < b._gen;
+            });
+        if (_cursorGen - oldest->_gen <= cacheSize)
+            break;
+        cursor = oldest->_cursor;
+        *oldest = _cursors.back();
         _cursors.pop_back();
         invariantWTOK(cursor->close(cursor));
     }
@@ -294,39 +321,58 @@ void WiredTigerSessionCache::waitUntilDurable(bool forceCheckpoint, bool stableC
         return;
     }
 
-    uint32_t start = _lastSyncTime.load();
-    // Do the remainder in a critical section that ensures only a single thread at a time
-    // will attempt to synchronize.
+    // Group commit: waiters are batched per flush. A thread arriving while no flush is in
+    // flight needs the next flush to complete; one arriving mid-flush needs one more after
+    // that, since the in-flight flush may predate its writes. Within a batch a single thread
+    // performs the flush while the rest park on the condition variable.
     stdx::unique_lock<stdx::mutex> lk(_lastSyncMutex);
-    uint32_t current = _lastSyncTime.loadRelaxed();  // synchronized with writes through mutex
-    if (current != start) {
-        // Someone else synced already since we read lastSyncTime, so we're done!
-        return;
-    }
-    _lastSyncTime.store(current + 1);
+    const std::uint64_t target = _journalFlushCount + (_journalFlushInProgress ? 2 : 1);
+    while (_journalFlushCount < target) {
+        if (_journalFlushInProgress) {
+            _journalFlushDone.wait(lk);
+            continue;
+        }
+
+        // We're the flusher for this batch. Only one thread can be here at a time, so
+        // _waitUntilDurableSession needs no further synchronization.
+        _journalFlushInProgress = true;
+        lk.unlock();
 
-    // Nobody has synched yet, so we have to sync ourselves.
+        // Optionally dwell before flushing so concurrent committers accrete onto this batch.
+        const auto windowMicros = kWiredTigerJournalFlushWindowMicros.load();
+        if (windowMicros > 0) {
+            sleepmicros(windowMicros);
+        }
 
-    // This gets the token (OpTime) from the last write, before flushing (either the journal, or a
-    // checkpoint), and then reports that token (OpTime) as a durable write.
-    stdx::unique_lock<stdx::mutex> jlk(_journalListenerMutex);
-    JournalListener::Token token = _journalListener->getToken();
+        {
+            // This gets the token (OpTime) from the last write, before flushing (either the
+            // journal, or a checkpoint), and then reports that token (OpTime) as a durable write.
+            stdx::unique_lock<stdx::mutex> jlk(_journalListenerMutex);
+            JournalListener::Token token = _journalListener->getToken();
 
-    // Initialize on first use.
-    if (!_waitUntilDurableSession) {
-        invariantWTOK(
-            _conn->open_session(_conn, NULL, "isolation=snapshot", &_waitUntilDurableSession));
-    }
+            // Initialize on first use.
+            if (!_waitUntilDurableSession) {
+                invariantWTOK(_conn->open_session(
+                    _conn, NULL, "isolation=snapshot", &_waitUntilDurableSession));
+            }
+
+            // Use the journal when available, or a checkpoint otherwise.
+            if (_engine && _engine->isDurable()) {
+                invariantWTOK(
+                    _waitUntilDurableSession->log_flush(_waitUntilDurableSession, "sync=on"));
+                LOG(4) << "flushed journal";
+            } else {
+                invariantWTOK(_waitUntilDurableSession->checkpoint(_waitUntilDurableSession, NULL));
+                LOG(4) << "created checkpoint";
+            }
+            _journalListener->onDurable(token);
+        }
 
-    // Use the journal when available, or a checkpoint otherwise.
-    if (_engine && _engine->isDurable()) {
-        invariantWTOK(_waitUntilDurableSession->log_flush(_waitUntilDurableSession, "sync=on"));
-        LOG(4) << "flushed journal";
-    } else {
-        invariantWTOK(_waitUntilDurableSession->checkpoint(_waitUntilDurableSession, NULL));
-        LOG(4) << "created checkpoint";
+        lk.lock();
+        _journalFlushInProgress = false;
+        ++_journalFlushCount;
+        _journalFlushDone.notify_all();
     }
-    _journalListener->onDurable(token);
 }
 
 void WiredTigerSessionCache::waitUntilPreparedUnitOfWorkCommitsOrAborts(OperationContext* opCtx) {
@@ -349,9 +395,11 @@ void WiredTigerSessionCache::notifyPreparedUnitOfWorkHasCommittedOrAborted() {
 
 
 void WiredTigerSessionCache::closeAllCursors(const std::string& uri) {
-    stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeAllCursors(uri);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lock(partition.mutex);
+        for (auto session : partition.sessions) {
+            session->closeAllCursors(uri);
+        }
     }
 }
 
@@ -359,24 +407,32 @@ void WiredTigerSessionCache::closeCursorsForQueuedDrops() {
     // Increment the cursor epoch so that all cursors from this epoch are closed.
     _cursorEpoch.fetchAndAdd(1);
 
-    stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeCursorsForQueuedDrops(_engine);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lock(partition.mutex);
+        for (auto session : partition.sessions) {
+            session->closeCursorsForQueuedDrops(_engine);
+        }
     }
 }
 
 void WiredTigerSessionCache::closeAll() {
-    // Increment the epoch as we are now closing all sessions with this epoch.
-    SessionCache swap;
+    // Increment the epoch as we are now closing all sessions with this epoch. The epoch must be
+    // bumped before any partition is visited: a releaseSession which observes the old epoch while
+    // holding its partition's mutex is guaranteed to have linked the session before we swap that
+    // partition out below.
+    _epoch.fetchAndAdd(1);
 
-    {
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-        _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
-    }
+    for (auto& partition : _partitions) {
+        SessionCache swap;
+
+        {
+            stdx::lock_guard<stdx::mutex> lock(partition.mutex);
+            partition.sessions.swap(swap);
+        }
 
-    for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
-        delete (*i);
+        for (auto session : swap) {
+            delete session;
+        }
     }
 }
 
@@ -384,18 +440,43 @@ bool WiredTigerSessionCache::isEphemeral() {
     return _engine && _engine->isEphemeral();
 }
 
+WiredTigerSessionCache::SessionCachePartition& WiredTigerSessionCache::_getPartition() {
+    // Threads are assigned home partitions round-robin as they first touch the cache.
+    static AtomicWord<unsigned> nextPartition;
+    static thread_local const size_t partitionId =
+        nextPartition.fetchAndAdd(1) % kNumSessionCachePartitions;
+    return _partitions[partitionId];
+}
+
 UniqueWiredTigerSession WiredTigerSessionCache::getSession() {
     // We should never be able to get here after _shuttingDown is set, because no new
     // operations should be allowed to start.
     invariant(!(_shuttingDown.loadRelaxed() & kShuttingDownMask));
 
+    auto& homePartition = _getPartition();
+
     {
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-        if (!_sessions.empty()) {
+        stdx::lock_guard<stdx::mutex> lock(homePartition.mutex);
+        if (!homePartition.sessions.empty()) {
             // Get the most recently used session so that if we discard sessions, we're
             // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
+            WiredTigerSession* cachedSession = homePartition.sessions.back();
+            homePartition.sessions.pop_back();
+            return UniqueWiredTigerSession(cachedSession);
+        }
+    }
+
+    // The home partition is empty, so steal an idle session from another partition before paying
+    // for the creation of a new one.
+    for (auto& partition : _partitions) {
+        if (&partition == &homePartition) {
+            continue;
+        }
+
+        stdx::lock_guard<stdx::mutex> lock(partition.mutex);
+        if (!partition.sessions.empty()) {
+            WiredTigerSession* cachedSession = partition.sessions.back();
+            partition.sessions.pop_back();
             return UniqueWiredTigerSession(cachedSession);
         }
     }
@@ -454,10 +535,11 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     session->dropQueuedIdentsAtSessionEndAllowed(true);
 
     if (session->_getEpoch() == currentEpoch) {  // check outside of lock to reduce contention
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
+        auto& partition = _getPartition();
+        stdx::lock_guard<stdx::mutex> lock(partition.mutex);
         if (session->_getEpoch() == _epoch.load()) {  // recheck inside the lock for correctness
             returnedToCache = true;
-            _sessions.push_back(session);
+            partition.sessions.push_back(session);
         }
     } else
         invariant(session->_getEpoch() < currentEpoch);
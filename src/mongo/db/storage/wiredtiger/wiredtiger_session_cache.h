@@ -32,8 +32,8 @@
 
 #pragma once
 
-#include <list>
 #include <string>
+#include <vector>
 
 #include <wiredtiger.h>
 
@@ -159,8 +159,10 @@ public:
 private:
     friend class WiredTigerSessionCache;
 
-    // The cursor cache is a list of pairs that contain an ID and cursor
-    typedef std::list<WiredTigerCachedCursor> CursorCache;
+    // The cursor cache holds pairs that contain an ID and cursor. It is kept in a contiguous
+    // vector so lookups scan memory linearly and insertion/removal do not allocate; entries
+    // are removed by swapping with the back, so the vector is unordered.
+    typedef std::vector<WiredTigerCachedCursor> CursorCache;
 
     // Used internally by WiredTigerSessionCache
     uint64_t _getEpoch() const {
@@ -296,9 +298,25 @@ private:
     AtomicWord<unsigned> _shuttingDown;
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    stdx::mutex _cacheLock;
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    // The cache of idle sessions is partitioned so that concurrent getSession/releaseSession
+    // calls do not all funnel through a single mutex. Each thread has a fixed home partition, so
+    // a thread tends to reacquire the session it just released while still being able to steal
+    // idle sessions from the other partitions.
+    static const size_t kNumSessionCachePartitions = 16;
+
+    struct SessionCachePartition {
+        stdx::mutex mutex;
+        SessionCache sessions;
+    };
+
+    /**
+     * Returns the calling thread's home partition.
+     */
+    SessionCachePartition& _getPartition();
+
+    SessionCachePartition _partitions[kNumSessionCachePartitions];
 
     // Bumped when all open sessions need to be closed
     AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the lock
@@ -306,8 +324,13 @@ private:
     // Bumped when all open cursors need to be closed
     AtomicWord<unsigned long long> _cursorEpoch;  // atomic so we can check it outside of the lock
 
-    // Counter and critical section mutex for waitUntilDurable
-    AtomicWord<unsigned> _lastSyncTime;
+    // Group-commit state for waitUntilDurable, guarded by _lastSyncMutex. A flush only covers
+    // writes that completed before it started, so threads arriving while a flush is in flight
+    // form the next batch: they park on _journalFlushDone until one of them performs a single
+    // flush on the whole batch's behalf.
+    std::uint64_t _journalFlushCount = 0;
+    bool _journalFlushInProgress = false;
+    stdx::condition_variable _journalFlushDone;
     stdx::mutex _lastSyncMutex;
 
     // Mutex and cond var for waiting on prepare commit or abort.
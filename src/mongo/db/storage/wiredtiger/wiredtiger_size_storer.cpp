@@ -50,6 +50,14 @@
 
 namespace mongo {
 
+size_t WiredTigerSizeStorer::SizeInfo::Counter::_stripeForCurrentThread() {
+    // Spread threads round-robin over the stripes; each thread keeps its stripe for its lifetime
+    // so its updates stay on one cache line across all counters.
+    static AtomicWord<unsigned> nextStripe;
+    thread_local const unsigned ourStripe = nextStripe.fetchAndAdd(1) % kNumStripes;
+    return ourStripe;
+}
+
 WiredTigerSizeStorer::WiredTigerSizeStorer(WT_CONNECTION* conn,
                                            const std::string& storageUri,
                                            bool readOnly)
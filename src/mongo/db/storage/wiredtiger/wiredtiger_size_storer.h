@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <string>
 
 #include <wiredtiger.h>
@@ -40,6 +41,7 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/mutex.h"
+#include "mongo/stdx/new.h"
 #include "mongo/util/string_map.h"
 
 namespace mongo {
@@ -65,11 +67,55 @@ public:
      * SizeInfo.
      */
     struct SizeInfo {
+        /**
+         * A size counter split across cache-line-aligned stripes. Writers accumulate deltas into
+         * a stripe chosen by their thread, so concurrent updates of the same collection do not
+         * all contend on a single cache line; readers fold the stripes into a total. The folded
+         * total is clamped to be non-negative, as lost size storer flushes (e.g. after a crash)
+         * can leave the deltas driving the sum below zero.
+         */
+        class Counter {
+        public:
+            long long load() const {
+                long long total = 0;
+                for (size_t i = 0; i < kNumStripes; i++)
+                    total += _stripes[i].value.load();
+                return std::max(total, 0LL);
+            }
+
+            /**
+             * Replaces the folded total with 'value'. Deltas added concurrently by other threads
+             * may be lost, consistent with the approximate nature of the stored sizes.
+             */
+            void store(long long value) {
+                _stripes[0].value.store(value);
+                for (size_t i = 1; i < kNumStripes; i++)
+                    _stripes[i].value.store(0);
+            }
+
+            void add(long long delta) {
+                _stripes[_stripeForCurrentThread()].value.fetchAndAdd(delta);
+            }
+
+        private:
+            enum { kNumStripes = 8 };
+
+            // This alignment is a best effort approach to place each stripe on a separate cache
+            // line in order to avoid false sharing.
+            struct alignas(stdx::hardware_destructive_interference_size) Stripe {
+                AtomicWord<long long> value;
+            };
+
+            static size_t _stripeForCurrentThread();
+
+            Stripe _stripes[kNumStripes];
+        };
+
         ~SizeInfo() {
             invariant(!_dirty.load());
         }
-        AtomicWord<long long> numRecords;
-        AtomicWord<long long> dataSize;
+        Counter numRecords;
+        Counter dataSize;
 
     private:
         friend WiredTigerSizeStorer;
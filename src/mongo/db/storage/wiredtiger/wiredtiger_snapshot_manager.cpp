@@ -38,9 +38,28 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_begin_transaction_block.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_oplog_manager.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/util/hex.h"
 #include "mongo/util/log.h"
+#include "mongo/util/mongoutils/str.h"
 
 namespace mongo {
+namespace {
+
+std::string beginTxnConfigString(Timestamp timestamp, bool ignorePrepared) {
+    str::stream config;
+    if (ignorePrepared) {
+        config << "ignore_prepare=true,";
+    }
+    config << "read_timestamp=" << integerToHex(timestamp.asULL());
+    return config;
+}
+
+}  // namespace
+
+WiredTigerSnapshotManager::SharedLocalSnapshot::SharedLocalSnapshot(Timestamp ts)
+    : timestamp(ts),
+      beginTxnConfig(beginTxnConfigString(ts, false)),
+      beginTxnConfigIgnorePrepared(beginTxnConfigString(ts, true)) {}
 
 void WiredTigerSnapshotManager::setCommittedSnapshot(const Timestamp& timestamp) {
     stdx::lock_guard<stdx::mutex> lock(_committedSnapshotMutex);
@@ -50,11 +69,24 @@ void WiredTigerSnapshotManager::setCommittedSnapshot(const Timestamp& timestamp)
 }
 
 void WiredTigerSnapshotManager::setLocalSnapshot(const Timestamp& timestamp) {
+    // Build the shared snapshot (and its config strings) outside the lock; concurrent readers
+    // keep using the previous snapshot until the pointer is swapped.
+    auto snapshot = std::make_shared<const SharedLocalSnapshot>(timestamp);
+
     stdx::lock_guard<stdx::mutex> lock(_localSnapshotMutex);
-    _localSnapshot = timestamp;
+    _localSnapshot = std::move(snapshot);
 }
 
 boost::optional<Timestamp> WiredTigerSnapshotManager::getLocalSnapshot() {
+    stdx::lock_guard<stdx::mutex> lock(_localSnapshotMutex);
+    if (!_localSnapshot) {
+        return boost::none;
+    }
+    return _localSnapshot->timestamp;
+}
+
+std::shared_ptr<const WiredTigerSnapshotManager::SharedLocalSnapshot>
+WiredTigerSnapshotManager::getSharedLocalSnapshot() const {
     stdx::lock_guard<stdx::mutex> lock(_localSnapshotMutex);
     return _localSnapshot;
 }
@@ -91,16 +123,26 @@ Timestamp WiredTigerSnapshotManager::beginTransactionOnCommittedSnapshot(
 
 Timestamp WiredTigerSnapshotManager::beginTransactionOnLocalSnapshot(
     WT_SESSION* session, WiredTigerBeginTxnBlock::IgnorePrepared ignorePrepared) const {
-    WiredTigerBeginTxnBlock txnOpen(session, ignorePrepared);
-
-    stdx::lock_guard<stdx::mutex> lock(_localSnapshotMutex);
-    invariant(_localSnapshot);
-    LOG(3) << "begin_transaction on local snapshot " << _localSnapshot.get().toString();
-    auto status = txnOpen.setTimestamp(_localSnapshot.get());
-    fassert(50775, status);
+    auto snapshot = getSharedLocalSnapshot();
+    invariant(snapshot);
+    return beginTransactionOnSharedSnapshot(session, *snapshot, ignorePrepared);
+}
 
+Timestamp WiredTigerSnapshotManager::beginTransactionOnSharedSnapshot(
+    WT_SESSION* session,
+    const SharedLocalSnapshot& snapshot,
+    WiredTigerBeginTxnBlock::IgnorePrepared ignorePrepared) {
+    LOG(3) << "begin_transaction on local snapshot " << snapshot.timestamp.toString();
+
+    // The shared snapshot carries a prebuilt configuration, so attaching to it is a single
+    // WiredTiger call and no lock is held while making it.
+    const auto& config = (ignorePrepared == WiredTigerBeginTxnBlock::IgnorePrepared::kIgnore)
+        ? snapshot.beginTxnConfigIgnorePrepared
+        : snapshot.beginTxnConfig;
+    WiredTigerBeginTxnBlock txnOpen(session, config.c_str());
     txnOpen.done();
-    return *_localSnapshot;
+
+    return snapshot.timestamp;
 }
 
 }  // namespace mongo
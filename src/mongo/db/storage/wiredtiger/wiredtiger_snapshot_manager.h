@@ -31,6 +31,8 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <memory>
+#include <string>
 #include <wiredtiger.h>
 
 #include "mongo/base/disallow_copying.h"
@@ -47,6 +49,21 @@ class WiredTigerSnapshotManager final : public SnapshotManager {
     MONGO_DISALLOW_COPYING(WiredTigerSnapshotManager);
 
 public:
+    /**
+     * One local (lastApplied) snapshot, shared by every read operation that attaches to it.
+     * Holds the timestamp and complete begin_transaction configuration strings built once at
+     * setLocalSnapshot() time, so attaching costs a single WiredTiger call with no per-operation
+     * formatting. The shared_ptr refcount tracks how many operations are reading at this
+     * timestamp.
+     */
+    struct SharedLocalSnapshot {
+        explicit SharedLocalSnapshot(Timestamp ts);
+
+        const Timestamp timestamp;
+        const std::string beginTxnConfig;                // Shows prepared data conflicts.
+        const std::string beginTxnConfigIgnorePrepared;  // "ignore_prepare=true" variant.
+    };
+
     WiredTigerSnapshotManager() = default;
 
     void setCommittedSnapshot(const Timestamp& timestamp) final;
@@ -74,6 +91,22 @@ public:
     Timestamp beginTransactionOnLocalSnapshot(
         WT_SESSION* session, WiredTigerBeginTxnBlock::IgnorePrepared ignorePrepared) const;
 
+    /**
+     * Starts a transaction reading at an already-acquired shared snapshot. Callers opening many
+     * transactions at the same timestamp should acquire the snapshot once via
+     * getSharedLocalSnapshot() and attach through this method.
+     */
+    static Timestamp beginTransactionOnSharedSnapshot(
+        WT_SESSION* session,
+        const SharedLocalSnapshot& snapshot,
+        WiredTigerBeginTxnBlock::IgnorePrepared ignorePrepared);
+
+    /**
+     * Returns the current shared local snapshot, or nullptr if none has been set. The caller
+     * keeps the snapshot (and its config strings) alive for as long as it holds the pointer.
+     */
+    std::shared_ptr<const SharedLocalSnapshot> getSharedLocalSnapshot() const;
+
     /**
      * Returns lowest SnapshotName that could possibly be used by a future call to
      * beginTransactionOnCommittedSnapshot, or boost::none if there is currently no committed
@@ -89,8 +122,9 @@ private:
     mutable stdx::mutex _committedSnapshotMutex;  // Guards _committedSnapshot.
     boost::optional<Timestamp> _committedSnapshot;
 
-    // Snapshot to use for reads at a local stable timestamp.
+    // Snapshot to use for reads at a local stable timestamp. The mutex only guards swapping the
+    // pointer; readers copy it out and then work off their reference without holding any lock.
     mutable stdx::mutex _localSnapshotMutex;  // Guards _localSnapshot.
-    boost::optional<Timestamp> _localSnapshot;
+    std::shared_ptr<const SharedLocalSnapshot> _localSnapshot;
 };
 }
@@ -164,14 +164,12 @@ ActiveTransactionHistory fetchActiveTransactionHistory(OperationContext* opCtx,
                 continue;
             }
 
-            const auto insertRes =
-                result.committedStatements.emplace(*entry.getStatementId(), entry.getOpTime());
-            if (!insertRes.second) {
-                const auto& existingOpTime = insertRes.first->second;
+            if (const auto existingOpTime = result.committedStatements.insert(
+                    *entry.getStatementId(), entry.getOpTime())) {
                 fassertOnRepeatedExecution(lsid,
                                            result.lastTxnRecord->getTxnNum(),
                                            *entry.getStatementId(),
-                                           existingOpTime,
+                                           *existingOpTime,
                                            entry.getOpTime());
             }
 
@@ -537,14 +535,23 @@ TransactionParticipant::OplogSlotReserver::~OplogSlotReserver() {
     }
 }
 
-TransactionParticipant::TxnResources::TxnResources(OperationContext* opCtx, StashStyle stashStyle) {
+TransactionParticipant::TxnResources::TxnResources(
+    OperationContext* opCtx,
+    StashStyle stashStyle,
+    std::unique_ptr<Locker> replacementLocker,
+    std::unique_ptr<RecoveryUnit> replacementRecoveryUnit) {
     // We must lock the Client to change the Locker on the OperationContext.
     stdx::lock_guard<Client> lk(*opCtx->getClient());
 
     _ruState = opCtx->getWriteUnitOfWork()->release();
     opCtx->setWriteUnitOfWork(nullptr);
 
-    _locker = opCtx->swapLockState(stdx::make_unique<LockerImpl>());
+    if (!replacementLocker) {
+        replacementLocker = stdx::make_unique<LockerImpl>();
+    }
+    invariant(!replacementLocker->isLocked());
+    _locker = opCtx->swapLockState(std::move(replacementLocker));
+    opCtx->lockState()->updateThreadIdToCurrentThread();
     // Inherit the locking setting from the original one.
     opCtx->lockState()->setShouldConflictWithSecondaryBatchApplication(
         _locker->shouldConflictWithSecondaryBatchApplication());
@@ -569,9 +576,12 @@ TransactionParticipant::TxnResources::TxnResources(OperationContext* opCtx, Stas
     // On secondaries, max lock timeout must not be set.
     invariant(stashStyle != StashStyle::kSecondary || !opCtx->lockState()->hasMaxLockTimeout());
 
+    if (!replacementRecoveryUnit) {
+        replacementRecoveryUnit = std::unique_ptr<RecoveryUnit>(
+            opCtx->getServiceContext()->getStorageEngine()->newRecoveryUnit());
+    }
     _recoveryUnit = opCtx->releaseRecoveryUnit();
-    opCtx->setRecoveryUnit(std::unique_ptr<RecoveryUnit>(
-                               opCtx->getServiceContext()->getStorageEngine()->newRecoveryUnit()),
+    opCtx->setRecoveryUnit(std::move(replacementRecoveryUnit),
                            WriteUnitOfWork::RecoveryUnitState::kNotInUnitOfWork);
 
     _readConcernArgs = repl::ReadConcernArgs::get(opCtx);
@@ -609,12 +619,16 @@ void TransactionParticipant::TxnResources::release(OperationContext* opCtx) {
     // It is necessary to lock the client to change the Locker on the OperationContext.
     stdx::lock_guard<Client> lk(*opCtx->getClient());
     invariant(opCtx->lockState()->getClientState() == Locker::ClientState::kInactive);
-    // We intentionally do not capture the return value of swapLockState(), which is just an empty
-    // locker. At the end of the operation, if the transaction is not complete, we will stash the
-    // operation context's locker and replace it with a new empty locker.
-    opCtx->swapLockState(std::move(_locker));
+    // The locker displaced by swapLockState() is just an empty locker. We keep it so that, at the
+    // end of the operation, a stash can reinstall it on the operation context instead of
+    // allocating a new empty locker.
+    _displacedLocker = opCtx->swapLockState(std::move(_locker));
     opCtx->lockState()->updateThreadIdToCurrentThread();
 
+    _displacedRecoveryUnit = opCtx->releaseRecoveryUnit();
+    if (_displacedRecoveryUnit) {
+        _displacedRecoveryUnit->abandonSnapshot();
+    }
     auto oldState = opCtx->setRecoveryUnit(std::move(_recoveryUnit),
                                            WriteUnitOfWork::RecoveryUnitState::kNotInUnitOfWork);
     invariant(oldState == WriteUnitOfWork::RecoveryUnitState::kNotInUnitOfWork,
@@ -659,7 +673,8 @@ void TransactionParticipant::_stashActiveTransaction(WithLock, OperationContext*
     invariant(!_txnResourceStash);
     auto stashStyle = opCtx->writesAreReplicated() ? TxnResources::StashStyle::kPrimary
                                                    : TxnResources::StashStyle::kSecondary;
-    _txnResourceStash = TxnResources(opCtx, stashStyle);
+    _txnResourceStash = TxnResources(
+        opCtx, stashStyle, std::move(_displacedLocker), std::move(_displacedRecoveryUnit));
 }
 
 
@@ -707,6 +722,11 @@ void TransactionParticipant::unstashTransactionResources(OperationContext* opCtx
             // Transaction resources already exist for this transaction.  Transfer them from the
             // stash to the operation context.
             _txnResourceStash->release(opCtx);
+            // Keep what the unstash displaced from the operation context, so the stash at the end
+            // of this statement can reinstall it rather than allocating a new Locker and
+            // RecoveryUnit.
+            _displacedLocker = _txnResourceStash->takeDisplacedLocker();
+            _displacedRecoveryUnit = _txnResourceStash->takeDisplacedRecoveryUnit();
             _txnResourceStash = boost::none;
             stdx::lock_guard<stdx::mutex> lm(_metricsMutex);
             _transactionMetricsObserver.onUnstash(ServerTransactionsMetrics::get(opCtx),
@@ -814,12 +834,16 @@ void TransactionParticipant::refreshLocksForPreparedTransaction(OperationContext
 
     // Transfer the txn resource from the stash to the operation context.
     _txnResourceStash->release(opCtx);
+    auto displacedLocker = _txnResourceStash->takeDisplacedLocker();
+    auto displacedRecoveryUnit = _txnResourceStash->takeDisplacedRecoveryUnit();
     _txnResourceStash = boost::none;
 
-    // Transfer the txn resource back from the operation context to the stash.
+    // Transfer the txn resource back from the operation context to the stash, reinstalling the
+    // displaced resources on the operation context.
     auto stashStyle =
         yieldLocks ? TxnResources::StashStyle::kSecondary : TxnResources::StashStyle::kPrimary;
-    _txnResourceStash = TxnResources(opCtx, stashStyle);
+    _txnResourceStash = TxnResources(
+        opCtx, stashStyle, std::move(displacedLocker), std::move(displacedRecoveryUnit));
 }
 
 Timestamp TransactionParticipant::prepareTransaction(OperationContext* opCtx,
@@ -1810,6 +1834,11 @@ void TransactionParticipant::_resetTransactionState(WithLock wl,
 
     // Release any locks held by this participant and abort the storage transaction.
     _txnResourceStash = boost::none;
+
+    // Free the displaced resources kept for statement-to-statement reuse; the transaction they
+    // belonged to is over.
+    _displacedLocker.reset();
+    _displacedRecoveryUnit.reset();
 }
 
 void TransactionParticipant::invalidate() {
@@ -1895,8 +1924,8 @@ void TransactionParticipant::_checkIsActiveTransaction(WithLock, TxnNumber txnNu
 boost::optional<repl::OpTime> TransactionParticipant::_checkStatementExecuted(StmtId stmtId) const {
     invariant(_isValid);
 
-    const auto it = _activeTxnCommittedStatements.find(stmtId);
-    if (it == _activeTxnCommittedStatements.end()) {
+    const auto opTime = _activeTxnCommittedStatements.find(stmtId);
+    if (!opTime) {
         uassert(ErrorCodes::IncompleteTransactionHistory,
                 str::stream() << "Incomplete history detected for transaction " << _activeTxnNumber
                               << " on session "
@@ -1906,7 +1935,7 @@ boost::optional<repl::OpTime> TransactionParticipant::_checkStatementExecuted(St
         return boost::none;
     }
 
-    return it->second;
+    return opTime;
 }
 
 UpdateRequest TransactionParticipant::_makeUpdateRequest(
@@ -1953,14 +1982,12 @@ void TransactionParticipant::_registerUpdateCacheOnCommit(
                     continue;
                 }
 
-                const auto insertRes =
-                    _activeTxnCommittedStatements.emplace(stmtId, lastStmtIdWriteOpTime);
-                if (!insertRes.second) {
-                    const auto& existingOpTime = insertRes.first->second;
+                if (const auto existingOpTime =
+                        _activeTxnCommittedStatements.insert(stmtId, lastStmtIdWriteOpTime)) {
                     fassertOnRepeatedExecution(_sessionId(),
                                                _activeTxnNumber,
                                                stmtId,
-                                               existingOpTime,
+                                               *existingOpTime,
                                                lastStmtIdWriteOpTime);
                 }
             }
@@ -35,6 +35,7 @@
 #include <map>
 
 #include "mongo/base/disallow_copying.h"
+#include "mongo/db/committed_statement_map.h"
 #include "mongo/db/concurrency/locker.h"
 #include "mongo/db/logical_session_id.h"
 #include "mongo/db/multi_key_path_tracker.h"
@@ -100,8 +101,16 @@ public:
         /**
          * Stashes transaction state from 'opCtx' in the newly constructed TxnResources.
          * Ephemerally holds the Client lock associated with opCtx.
+         *
+         * If 'replacementLocker'/'replacementRecoveryUnit' are provided they are installed on
+         * 'opCtx' in place of the stashed resources; otherwise new ones are allocated. Callers
+         * which stash and unstash once per statement pass back the resources displaced by the
+         * previous unstash to avoid the per-statement allocations.
          */
-        TxnResources(OperationContext* opCtx, StashStyle stashStyle);
+        TxnResources(OperationContext* opCtx,
+                     StashStyle stashStyle,
+                     std::unique_ptr<Locker> replacementLocker = nullptr,
+                     std::unique_ptr<RecoveryUnit> replacementRecoveryUnit = nullptr);
         ~TxnResources();
 
         // Rule of 5: because we have a class-defined destructor, we need to explictly specify
@@ -122,6 +131,20 @@ public:
          */
         void release(OperationContext* opCtx);
 
+        /**
+         * Surrenders the Locker/RecoveryUnit that 'release' displaced from the operation context,
+         * so they may be reinstalled by a subsequent stash. May only be called after 'release'.
+         */
+        std::unique_ptr<Locker> takeDisplacedLocker() {
+            invariant(_released);
+            return std::move(_displacedLocker);
+        }
+
+        std::unique_ptr<RecoveryUnit> takeDisplacedRecoveryUnit() {
+            invariant(_released);
+            return std::move(_displacedRecoveryUnit);
+        }
+
         /**
          * Returns the read concern arguments.
          */
@@ -136,6 +159,11 @@ public:
         std::unique_ptr<RecoveryUnit> _recoveryUnit;
         repl::ReadConcernArgs _readConcernArgs;
         WriteUnitOfWork::RecoveryUnitState _ruState;
+
+        // The Locker and RecoveryUnit which 'release' displaced from the operation context when
+        // restoring the stashed resources. Held here so the caller may reuse them.
+        std::unique_ptr<Locker> _displacedLocker;
+        std::unique_ptr<RecoveryUnit> _displacedRecoveryUnit;
     };
 
     /**
@@ -157,7 +185,9 @@ public:
         OperationContext* _opCtx;
     };
 
-    using CommittedStatementTimestampMap = stdx::unordered_map<StmtId, repl::OpTime>;
+    // Run-length encoded index from statement id to the opTime of the write which executed it,
+    // sized for bulk retryable writes with large contiguous stmtId ranges.
+    using CommittedStatementTimestampMap = CommittedStatementMap;
 
     static const BSONObj kDeadEndSentinel;
 
@@ -774,6 +804,13 @@ private:
     // Holds transaction resources between network operations.
     boost::optional<TxnResources> _txnResourceStash;
 
+    // The Locker and RecoveryUnit most recently displaced from the operation context by an
+    // unstash. The stash at the end of the statement reinstalls them on the operation context, so
+    // that consecutive statements of a multi-statement transaction do not allocate a fresh Locker
+    // and RecoveryUnit each. Retained only while a transaction is in progress.
+    std::unique_ptr<Locker> _displacedLocker;
+    std::unique_ptr<RecoveryUnit> _displacedRecoveryUnit;
+
     // Maintains the transaction state and the transition table for legal state transitions.
     TransactionState _txnState;
 
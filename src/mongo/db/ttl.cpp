@@ -52,6 +52,7 @@
 #include "mongo/db/exec/delete.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/operation_context.h"
 #include "mongo/db/ops/insert.h"
 #include "mongo/db/query/internal_plans.h"
 #include "mongo/db/repl/replication_coordinator.h"
@@ -79,6 +80,24 @@ MONGO_EXPORT_SERVER_PARAMETER(ttlMonitorSleepSecs, int, 60)
         return Status::OK();
     });  // used for testing
 
+// The maximum number of expired documents deleted in a single batch per TTL index. When non-zero,
+// the monitor releases the collection lock and sleeps for ttlMonitorBatchDelayMS between batches
+// so that large expirations are spread out instead of running as one long delete. A value of 0
+// deletes all expired documents in a single pass.
+MONGO_EXPORT_SERVER_PARAMETER(ttlMonitorBatchSize, int, 0)->withValidator([](const int& newVal) {
+    if (newVal < 0)
+        return Status(ErrorCodes::BadValue, "ttlMonitorBatchSize cannot be negative");
+    return Status::OK();
+});
+
+// The delay between TTL deletion batches when ttlMonitorBatchSize is non-zero.
+MONGO_EXPORT_SERVER_PARAMETER(ttlMonitorBatchDelayMS, int, 10)
+    ->withValidator([](const int& newVal) {
+        if (newVal < 0)
+            return Status(ErrorCodes::BadValue, "ttlMonitorBatchDelayMS cannot be negative");
+        return Status::OK();
+    });
+
 class TTLMonitor : public BackgroundJob {
 public:
     TTLMonitor() {}
@@ -127,6 +146,10 @@ private:
         const ServiceContext::UniqueOperationContext opCtxPtr = cc().makeOperationContext();
         OperationContext& opCtx = *opCtxPtr;
 
+        // TTL deletes are background maintenance and should queue behind user operations for
+        // global lock tickets.
+        ScopedAdmissionPriority admissionPriority(&opCtx, AdmissionPriority::kLow);
+
         // If part of replSet but not in a readable state (e.g. during initial sync), skip.
         if (repl::ReplicationCoordinator::get(&opCtx)->getReplicationMode() ==
                 repl::ReplicationCoordinator::modeReplSet &&
@@ -175,6 +198,10 @@ private:
     /**
      * Remove documents from the collection using the specified TTL index after a sufficient amount
      * of time has passed according to its expiry specification.
+     *
+     * When ttlMonitorBatchSize is non-zero, documents are removed in batches of at most that many
+     * documents, releasing the collection lock and sleeping for ttlMonitorBatchDelayMS between
+     * batches so that large expirations don't run as one long delete.
      */
     void doTTLForIndex(OperationContext* opCtx, BSONObj idx) {
         const NamespaceString collectionNSS(idx["ns"].String());
@@ -196,22 +223,46 @@ private:
 
         LOG(1) << "ns: " << collectionNSS << " key: " << key << " name: " << name;
 
+        const long long batchSize = ttlMonitorBatchSize.load();
+        bool moreExpired = true;
+        while (moreExpired && !globalInShutdownDeprecated()) {
+            moreExpired = doTTLDeleteBatch(opCtx, idx, collectionNSS, name, key, batchSize);
+
+            // The collection lock is released between batches, so writes queued behind the TTL
+            // deletes get a chance to run before the next batch starts.
+            if (moreExpired) {
+                sleepmillis(ttlMonitorBatchDelayMS.load());
+            }
+        }
+    }
+
+    /**
+     * Deletes up to 'batchSize' expired documents using the TTL index 'idx' (all of them when
+     * 'batchSize' is zero). Returns true if the batch limit was reached and more expired documents
+     * may remain.
+     */
+    bool doTTLDeleteBatch(OperationContext* opCtx,
+                          BSONObj idx,
+                          const NamespaceString& collectionNSS,
+                          StringData name,
+                          const BSONObj& key,
+                          long long batchSize) {
         AutoGetCollection autoGetCollection(opCtx, collectionNSS, MODE_IX);
         Collection* collection = autoGetCollection.getCollection();
         if (!collection) {
             // Collection was dropped.
-            return;
+            return false;
         }
 
         if (!repl::ReplicationCoordinator::get(opCtx)->canAcceptWritesFor(opCtx, collectionNSS)) {
-            return;
+            return false;
         }
 
         const IndexDescriptor* desc = collection->getIndexCatalog()->findIndexByName(opCtx, name);
         if (!desc) {
             LOG(1) << "index not found (index build in progress? index dropped?), skipping "
                    << "ttl job for: " << idx;
-            return;
+            return false;
         }
 
         // Re-read 'idx' from the descriptor, in case the collection or index definition changed
@@ -220,7 +271,7 @@ private:
 
         if (IndexType::INDEX_BTREE != IndexNames::nameToType(desc->getAccessMethodName())) {
             error() << "special index can't be used as a ttl index, skipping ttl job for: " << idx;
-            return;
+            return false;
         }
 
         BSONElement secondsExpireElt = idx[secondsExpireField];
@@ -228,7 +279,7 @@ private:
             error() << "ttl indexes require the " << secondsExpireField << " field to be "
                     << "numeric but received a type of " << typeName(secondsExpireElt.type())
                     << ", skipping ttl job for: " << idx;
-            return;
+            return false;
         }
 
         const Date_t kDawnOfTime =
@@ -256,6 +307,9 @@ private:
         auto params = std::make_unique<DeleteStageParams>();
         params->isMulti = true;
         params->canonicalQuery = canonicalQuery.getValue().get();
+        // In batched mode the deleted documents are returned through the executor so the number of
+        // deletes per batch can be counted and bounded.
+        params->returnDeleted = (batchSize > 0);
 
         auto exec =
             InternalPlanner::deleteWithIndexScan(opCtx,
@@ -268,16 +322,38 @@ private:
                                                  PlanExecutor::YIELD_AUTO,
                                                  direction);
 
-        Status result = exec->executePlan();
-        if (!result.isOK()) {
-            error() << "ttl query execution for index " << idx
-                    << " failed with status: " << redact(result);
-            return;
+        long long numDeleted = 0;
+        bool hitBatchLimit = false;
+
+        if (batchSize > 0) {
+            BSONObj deletedObj;
+            PlanExecutor::ExecState state;
+            while ((state = exec->getNext(&deletedObj, nullptr)) == PlanExecutor::ADVANCED) {
+                if (++numDeleted >= batchSize) {
+                    hitBatchLimit = true;
+                    break;
+                }
+            }
+
+            if (!hitBatchLimit && state != PlanExecutor::IS_EOF) {
+                error() << "ttl query execution for index " << idx
+                        << " failed with state: " << PlanExecutor::statestr(state);
+                return false;
+            }
+        } else {
+            Status result = exec->executePlan();
+            if (!result.isOK()) {
+                error() << "ttl query execution for index " << idx
+                        << " failed with status: " << redact(result);
+                return false;
+            }
+
+            numDeleted = DeleteStage::getNumDeleted(*exec);
         }
 
-        const long long numDeleted = DeleteStage::getNumDeleted(*exec);
         ttlDeletedDocuments.increment(numDeleted);
         LOG(1) << "deleted: " << numDeleted;
+        return hitBatchLimit;
     }
 };
 
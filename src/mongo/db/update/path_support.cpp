@@ -383,7 +383,10 @@ static Status _extractFullEqualityMatches(const MatchExpression& root,
         // Extract equality matches
         const EqualityMatchExpression& eqChild = static_cast<const EqualityMatchExpression&>(root);
 
-        FieldRef path(eqChild.path());
+        // Equality paths recur across otherwise-identical queries, so fetch the parsed path from
+        // the process-wide intern table rather than re-parsing the dotted string.
+        std::shared_ptr<const FieldRef> pathPtr = FieldRef::getInterned(eqChild.path());
+        const FieldRef& path = *pathPtr;
 
         if (fullPathsToExtract) {
             FieldRefSet conflictPaths;
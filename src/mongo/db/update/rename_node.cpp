@@ -147,10 +147,13 @@ Status RenameNode::init(BSONElement modExpr,
 }
 
 UpdateNode::ApplyResult RenameNode::apply(ApplyParams applyParams) const {
-    // It would make sense to store fromFieldRef and toFieldRef as members during
-    // RenameNode::init(), but FieldRef is not copyable.
-    auto fromFieldRef = std::make_shared<FieldRef>(_val.fieldName());
-    FieldRef toFieldRef(_val.valueStringData());
+    // The paths are fixed at init() time but apply() runs once per document, so fetch them from
+    // the process-wide intern table instead of re-parsing the dotted strings on every apply.
+    // 'fromFieldRef' is copied from the interned instance because it is handed to 'pathTaken'
+    // below, which must remain mutable.
+    auto fromFieldRef = std::make_shared<FieldRef>(*FieldRef::getInterned(_val.fieldName()));
+    std::shared_ptr<const FieldRef> toFieldRefPtr = FieldRef::getInterned(_val.valueStringData());
+    const FieldRef& toFieldRef = *toFieldRefPtr;
 
     mutablebson::Document& document = applyParams.element.getDocument();
 
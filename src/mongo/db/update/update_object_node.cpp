@@ -192,11 +192,13 @@ StatusWith<bool> UpdateObjectNode::parseAndMerge(
     const boost::intrusive_ptr<ExpressionContext>& expCtx,
     const std::map<StringData, std::unique_ptr<ExpressionWithPlaceholder>>& arrayFilters,
     std::set<std::string>& foundIdentifiers) {
-    FieldRef fieldRef;
+    // Modifier paths repeat across otherwise-identical update expressions, so they are fetched
+    // from the process-wide intern table rather than re-parsed for every operation.
+    std::shared_ptr<const FieldRef> parsedPath;
     if (type != modifiertable::ModifierType::MOD_RENAME) {
         // General case: Create a path in the tree according to the path specified in the field name
         // of the "modExpr" element.
-        fieldRef.parse(modExpr.fieldNameStringData());
+        parsedPath = FieldRef::getInterned(modExpr.fieldNameStringData());
     } else {
         // Special case: For $rename modifiers, we add two nodes to the tree:
         // 1) a ConflictPlaceholderNode at the path specified in the field name of the "modExpr"
@@ -219,8 +221,9 @@ StatusWith<bool> UpdateObjectNode::parseAndMerge(
                                         << modExpr);
         }
 
-        fieldRef.parse(modExpr.valueStringData());
+        parsedPath = FieldRef::getInterned(modExpr.valueStringData());
     }
+    const FieldRef& fieldRef = *parsedPath;
 
     // Check that the path is updatable.
     auto status = fieldchecker::isUpdatable(fieldRef);
@@ -30,6 +30,8 @@
  *    it in the license file.
  */
 
+#include <boost/optional.hpp>
+
 #include "mongo/db/update_index_data.h"
 #include "mongo/bson/util/builder.h"
 
@@ -60,7 +62,13 @@ bool UpdateIndexData::mightBeIndexed(const FieldRef& path) const {
         return true;
     }
 
-    FieldRef canonicalPath = getCanonicalIndexField(path);
+    // Most updated paths contain no '$' or numeric components, in which case 'path' already is
+    // its own canonical index form and there is no need to materialize a copy of it.
+    boost::optional<FieldRef> canonicalStorage;
+    if (!_isCanonical(path)) {
+        canonicalStorage.emplace(getCanonicalIndexField(path));
+    }
+    const FieldRef& canonicalPath = canonicalStorage ? *canonicalStorage : path;
 
     for (const auto& idx : _canonicalPaths) {
         if (_startsWith(canonicalPath, idx) || _startsWith(idx, canonicalPath))
@@ -82,6 +90,16 @@ bool UpdateIndexData::_startsWith(const FieldRef& a, const FieldRef& b) const {
     return (a == b) || (b.isPrefixOf(a));
 }
 
+bool UpdateIndexData::_isCanonical(const FieldRef& path) {
+    for (size_t i = 1; i < path.numParts(); ++i) {
+        auto pathComponent = path.getPart(i);
+        if (pathComponent == "$"_sd || FieldRef::isNumericPathComponentLenient(pathComponent)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 FieldRef UpdateIndexData::getCanonicalIndexField(const FieldRef& path) {
     if (path.numParts() <= 1)
         return path;
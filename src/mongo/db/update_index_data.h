@@ -81,6 +81,12 @@ private:
      */
     bool _startsWith(const FieldRef& a, const FieldRef& b) const;
 
+    /**
+     * Returns true if 'path' is already in canonical index form, i.e. it contains no '$' or
+     * numeric path components past the first component.
+     */
+    static bool _isCanonical(const FieldRef& path);
+
     std::set<FieldRef> _canonicalPaths;
     std::set<std::string> _pathComponents;
 
@@ -86,6 +86,7 @@ Status ViewCatalog::_reloadIfNeeded(WithLock lk, OperationContext* opCtx) {
 
     // Need to reload, first clear our cache.
     _viewMap.clear();
+    _resolvedViewCache.clear();
 
     Status status = _durable->iterate(opCtx, [&](const BSONObj& view) -> Status {
         BSONObj collationSpec = view.hasField("collation") ? view["collation"].Obj() : BSONObj();
@@ -114,6 +115,7 @@ Status ViewCatalog::_reloadIfNeeded(WithLock lk, OperationContext* opCtx) {
                                                                    std::move(collator.getValue()));
         return Status::OK();
     });
+    _viewMapEmpty.store(_viewMap.empty());
     _valid.store(status.isOK());
 
     if (!status.isOK()) {
@@ -161,9 +163,13 @@ Status ViewCatalog::_createOrUpdateView(WithLock lk,
     }
 
     _durable->upsert(opCtx, viewName, viewDefBuilder.obj());
+    _viewMapEmpty.store(false);
     _viewMap[viewName.ns()] = view;
+    _resolvedViewCache.clear();
     opCtx->recoveryUnit()->onRollback([this, viewName]() {
+        // Leave '_viewMapEmpty' conservatively false; lookups just fall back to the locked path.
         this->_viewMap.erase(viewName.ns());
+        this->_resolvedViewCache.clear();
         this->_viewGraphNeedsRefresh = true;
     });
 
@@ -368,7 +374,9 @@ Status ViewCatalog::modifyView(OperationContext* opCtx,
 
     ViewDefinition savedDefinition = *viewPtr;
     opCtx->recoveryUnit()->onRollback([this, viewName, savedDefinition]() {
+        this->_viewMapEmpty.store(false);
         this->_viewMap[viewName.ns()] = std::make_shared<ViewDefinition>(savedDefinition);
+        this->_resolvedViewCache.clear();
     });
 
     return _createOrUpdateView(lk,
@@ -396,9 +404,13 @@ Status ViewCatalog::dropView(OperationContext* opCtx, const NamespaceString& vie
     _durable->remove(opCtx, viewName);
     _viewGraph.remove(savedDefinition.name());
     _viewMap.erase(viewName.ns());
+    _resolvedViewCache.clear();
+    _viewMapEmpty.store(_viewMap.empty());
     opCtx->recoveryUnit()->onRollback([this, viewName, savedDefinition]() {
         this->_viewGraphNeedsRefresh = true;
+        this->_viewMapEmpty.store(false);
         this->_viewMap[viewName.ns()] = std::make_shared<ViewDefinition>(savedDefinition);
+        this->_resolvedViewCache.clear();
     });
 
     // We may get invalidated, but we're exclusively locked, so the change must be ours.
@@ -433,6 +445,15 @@ std::shared_ptr<ViewDefinition> ViewCatalog::_lookup(WithLock lk,
 }
 
 std::shared_ptr<ViewDefinition> ViewCatalog::lookup(OperationContext* opCtx, StringData ns) {
+    // Most databases have no views at all, yet this is called on hot collection access paths.
+    // '_viewMapEmpty' is cleared before any view becomes visible in the map, so when the catalog
+    // is valid and the flag is still set, the lookup can miss without touching the mutex. A
+    // concurrent view creation may race with the flag check, but such a lookup would also have
+    // raced with the creation on the locked path.
+    if (_valid.load() && _viewMapEmpty.load()) {
+        return nullptr;
+    }
+
     stdx::lock_guard<stdx::mutex> lk(_mutex);
     return _lookup(lk, opCtx, ns);
 }
@@ -444,6 +465,15 @@ StatusWith<ResolvedView> ViewCatalog::resolveView(OperationContext* opCtx,
     // Keep looping until the resolution completes. If the catalog is invalidated during the
     // resolution, we start over from the beginning.
     while (true) {
+        // The cache only ever holds resolutions computed against the current catalog contents, so
+        // when the catalog is valid a hit can be returned as-is.
+        if (_valid.load()) {
+            auto cached = _resolvedViewCache.find(nss.ns());
+            if (cached != _resolvedViewCache.end()) {
+                return cached->second;
+            }
+        }
+
         // Points to the name of the most resolved namespace.
         const NamespaceString* resolvedNss = &nss;
 
@@ -485,8 +515,15 @@ StatusWith<ResolvedView> ViewCatalog::resolveView(OperationContext* opCtx,
                             str::stream() << "View pipeline exceeds maximum size; maximum size is "
                                           << ViewGraph::kMaxViewPipelineSizeBytes};
                 }
-                return StatusWith<ResolvedView>(
-                    {*resolvedNss, std::move(resolvedPipeline), std::move(collation.get())});
+                ResolvedView resolved(
+                    *resolvedNss, std::move(resolvedPipeline), std::move(collation.get()));
+                if (depth > 0) {
+                    // Only memoize namespaces that resolved through at least one view; a
+                    // depth-zero miss just means 'nss' is not a view, and caching those would let
+                    // arbitrary lookups grow the map without bound.
+                    _resolvedViewCache.insert({nss.ns(), resolved});
+                }
+                return std::move(resolved);
             }
 
             resolvedNss = &view->viewOn();
@@ -501,8 +538,10 @@ StatusWith<ResolvedView> ViewCatalog::resolveView(OperationContext* opCtx,
 
             // If the first stage is a $collStats, then we return early with the viewOn namespace.
             if (toPrepend.size() > 0 && !toPrepend[0]["$collStats"].eoo()) {
-                return StatusWith<ResolvedView>(
-                    {*resolvedNss, std::move(resolvedPipeline), std::move(collation.get())});
+                ResolvedView resolved(
+                    *resolvedNss, std::move(resolvedPipeline), std::move(collation.get()));
+                _resolvedViewCache.insert({nss.ns(), resolved});
+                return std::move(resolved);
             }
         }
 
@@ -44,6 +44,7 @@
 #include "mongo/db/views/resolved_view.h"
 #include "mongo/db/views/view.h"
 #include "mongo/db/views/view_graph.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/functional.h"
 #include "mongo/stdx/mutex.h"
 #include "mongo/util/concurrency/with_lock.h"
@@ -175,8 +176,22 @@ private:
         invariant(_valid.load());
     }
 
-    stdx::mutex _mutex;  // Protects all members, except for _valid.
+    stdx::mutex _mutex;  // Protects all members, except for _valid and _viewMapEmpty.
+
+    // True only when '_viewMap' is known to be empty. Cleared before any insertion into the map
+    // becomes visible, so lookup() may consult it without the mutex: most databases have no views,
+    // and this keeps their collection accesses from serializing on '_mutex'. Kept conservatively
+    // false when emptiness cannot be re-established cheaply (e.g. on rollback).
+    AtomicWord<bool> _viewMapEmpty{true};
+
     ViewMap _viewMap;
+
+    // Memoizes successful view resolutions keyed by the namespace being resolved. Resolution
+    // walks the view graph and copies every pipeline stage along the way, which is pure
+    // recomputation while definitions are unchanged. Guarded by '_mutex' and cleared whenever
+    // '_viewMap' changes, including on reload and on rollback restores.
+    StringMap<ResolvedView> _resolvedViewCache;
+
     DurableViewCatalog* _durable;
     AtomicWord<bool> _valid;
     ViewGraph _viewGraph;
@@ -43,8 +43,8 @@ using std::vector;
 
 TEST(IndexAccessMethodSetDifference, EmptyInputsShouldHaveNoDifference) {
     SimpleBSONObjComparator bsonCmp;
-    BSONObjSet left = bsonCmp.makeBSONObjSet();
-    BSONObjSet right = bsonCmp.makeBSONObjSet();
+    BSONObjFlatSet left = bsonCmp.makeBSONObjFlatSet();
+    BSONObjFlatSet right = bsonCmp.makeBSONObjFlatSet();
     auto diff = AbstractIndexAccessMethod::setDifference(left, right);
     ASSERT_EQ(0UL, diff.first.size());
     ASSERT_EQ(0UL, diff.second.size());
@@ -52,8 +52,8 @@ TEST(IndexAccessMethodSetDifference, EmptyInputsShouldHaveNoDifference) {
 
 TEST(IndexAccessMethodSetDifference, EmptyLeftShouldHaveNoDifference) {
     SimpleBSONObjComparator bsonCmp;
-    BSONObjSet left = bsonCmp.makeBSONObjSet();
-    BSONObjSet right = bsonCmp.makeBSONObjSet({BSON("" << 0)});
+    BSONObjFlatSet left = bsonCmp.makeBSONObjFlatSet();
+    BSONObjFlatSet right = bsonCmp.makeBSONObjFlatSet({BSON("" << 0)});
     auto diff = AbstractIndexAccessMethod::setDifference(left, right);
     ASSERT_EQ(0UL, diff.first.size());
     ASSERT_EQ(1UL, diff.second.size());
@@ -61,8 +61,8 @@ TEST(IndexAccessMethodSetDifference, EmptyLeftShouldHaveNoDifference) {
 
 TEST(IndexAccessMethodSetDifference, EmptyRightShouldReturnAllOfLeft) {
     SimpleBSONObjComparator bsonCmp;
-    BSONObjSet left = bsonCmp.makeBSONObjSet({BSON("" << 0), BSON("" << 1)});
-    BSONObjSet right = bsonCmp.makeBSONObjSet();
+    BSONObjFlatSet left = bsonCmp.makeBSONObjFlatSet({BSON("" << 0), BSON("" << 1)});
+    BSONObjFlatSet right = bsonCmp.makeBSONObjFlatSet();
     auto diff = AbstractIndexAccessMethod::setDifference(left, right);
     ASSERT_EQ(2UL, diff.first.size());
     ASSERT_EQ(0UL, diff.second.size());
@@ -70,11 +70,11 @@ TEST(IndexAccessMethodSetDifference, EmptyRightShouldReturnAllOfLeft) {
 
 TEST(IndexAccessMethodSetDifference, IdenticalSetsShouldHaveNoDifference) {
     SimpleBSONObjComparator bsonCmp;
-    BSONObjSet left = bsonCmp.makeBSONObjSet({BSON("" << 0),
+    BSONObjFlatSet left = bsonCmp.makeBSONObjFlatSet({BSON("" << 0),
                                               BSON(""
                                                    << "string"),
                                               BSON("" << BSONNULL)});
-    BSONObjSet right = bsonCmp.makeBSONObjSet({BSON("" << 0),
+    BSONObjFlatSet right = bsonCmp.makeBSONObjFlatSet({BSON("" << 0),
                                                BSON(""
                                                     << "string"),
                                                BSON("" << BSONNULL)});
@@ -89,8 +89,8 @@ TEST(IndexAccessMethodSetDifference, IdenticalSetsShouldHaveNoDifference) {
 
 void assertDistinct(BSONObj left, BSONObj right) {
     SimpleBSONObjComparator bsonCmp;
-    BSONObjSet leftSet = bsonCmp.makeBSONObjSet({left});
-    BSONObjSet rightSet = bsonCmp.makeBSONObjSet({right});
+    BSONObjFlatSet leftSet = bsonCmp.makeBSONObjFlatSet({left});
+    BSONObjFlatSet rightSet = bsonCmp.makeBSONObjFlatSet({right});
     auto diff = AbstractIndexAccessMethod::setDifference(leftSet, rightSet);
     ASSERT_EQ(1UL, diff.first.size());
     ASSERT_EQ(1UL, diff.second.size());
@@ -129,8 +129,8 @@ TEST(IndexAccessMethodSetDifference, ZerosOfDifferentTypesAreNotEquivalent) {
 
 TEST(IndexAccessMethodSetDifference, ShouldDetectOneDifferenceAmongManySimilarities) {
     SimpleBSONObjComparator bsonCmp;
-    BSONObjSet left =
-        bsonCmp.makeBSONObjSet({BSON("" << 0),
+    BSONObjFlatSet left =
+        bsonCmp.makeBSONObjFlatSet({BSON("" << 0),
                                 BSON(""
                                      << "string"),
                                 BSON("" << BSONNULL),
@@ -138,8 +138,8 @@ TEST(IndexAccessMethodSetDifference, ShouldDetectOneDifferenceAmongManySimilarit
                                 BSON("" << BSON("sub"
                                                 << "document")),
                                 BSON("" << BSON_ARRAY(1 << "hi" << 42))});
-    BSONObjSet right =
-        bsonCmp.makeBSONObjSet({BSON("" << 0),
+    BSONObjFlatSet right =
+        bsonCmp.makeBSONObjFlatSet({BSON("" << 0),
                                 BSON(""
                                      << "string"),
                                 BSON("" << BSONNULL),
@@ -154,8 +154,9 @@ TEST(IndexAccessMethodSetDifference, ShouldDetectOneDifferenceAmongManySimilarit
 
 TEST(IndexAccessMethodSetDifference, SingleObjInLeftShouldFindCorrespondingObjInRight) {
     SimpleBSONObjComparator bsonCmp;
-    BSONObjSet left = bsonCmp.makeBSONObjSet({BSON("" << 2)});
-    BSONObjSet right = bsonCmp.makeBSONObjSet({BSON("" << 1), BSON("" << 2), BSON("" << 3)});
+    BSONObjFlatSet left = bsonCmp.makeBSONObjFlatSet({BSON("" << 2)});
+    BSONObjFlatSet right =
+        bsonCmp.makeBSONObjFlatSet({BSON("" << 1), BSON("" << 2), BSON("" << 3)});
     auto diff = AbstractIndexAccessMethod::setDifference(left, right);
     ASSERT_EQUALS(0UL, diff.first.size());
     ASSERT_EQUALS(2UL, diff.second.size());
@@ -163,8 +164,9 @@ TEST(IndexAccessMethodSetDifference, SingleObjInLeftShouldFindCorrespondingObjIn
 
 TEST(IndexAccessMethodSetDifference, SingleObjInRightShouldFindCorrespondingObjInLeft) {
     SimpleBSONObjComparator bsonCmp;
-    BSONObjSet left = bsonCmp.makeBSONObjSet({BSON("" << 1), BSON("" << 2), BSON("" << 3)});
-    BSONObjSet right = bsonCmp.makeBSONObjSet({BSON("" << 2)});
+    BSONObjFlatSet left =
+        bsonCmp.makeBSONObjFlatSet({BSON("" << 1), BSON("" << 2), BSON("" << 3)});
+    BSONObjFlatSet right = bsonCmp.makeBSONObjFlatSet({BSON("" << 2)});
     auto diff = AbstractIndexAccessMethod::setDifference(left, right);
     ASSERT_EQUALS(2UL, diff.first.size());
     ASSERT_EQUALS(0UL, diff.second.size());
@@ -172,8 +174,10 @@ TEST(IndexAccessMethodSetDifference, SingleObjInRightShouldFindCorrespondingObjI
 
 TEST(IndexAccessMethodSetDifference, LeftSetAllSmallerThanRightShouldBeDisjoint) {
     SimpleBSONObjComparator bsonCmp;
-    BSONObjSet left = bsonCmp.makeBSONObjSet({BSON("" << 1), BSON("" << 2), BSON("" << 3)});
-    BSONObjSet right = bsonCmp.makeBSONObjSet({BSON("" << 4), BSON("" << 5), BSON("" << 6)});
+    BSONObjFlatSet left =
+        bsonCmp.makeBSONObjFlatSet({BSON("" << 1), BSON("" << 2), BSON("" << 3)});
+    BSONObjFlatSet right =
+        bsonCmp.makeBSONObjFlatSet({BSON("" << 4), BSON("" << 5), BSON("" << 6)});
     auto diff = AbstractIndexAccessMethod::setDifference(left, right);
     ASSERT_EQUALS(3UL, diff.first.size());
     ASSERT_EQUALS(3UL, diff.second.size());
@@ -187,8 +191,10 @@ TEST(IndexAccessMethodSetDifference, LeftSetAllSmallerThanRightShouldBeDisjoint)
 
 TEST(IndexAccessMethodSetDifference, LeftSetAllLargerThanRightShouldBeDisjoint) {
     SimpleBSONObjComparator bsonCmp;
-    BSONObjSet left = bsonCmp.makeBSONObjSet({BSON("" << 4), BSON("" << 5), BSON("" << 6)});
-    BSONObjSet right = bsonCmp.makeBSONObjSet({BSON("" << 1), BSON("" << 2), BSON("" << 3)});
+    BSONObjFlatSet left =
+        bsonCmp.makeBSONObjFlatSet({BSON("" << 4), BSON("" << 5), BSON("" << 6)});
+    BSONObjFlatSet right =
+        bsonCmp.makeBSONObjFlatSet({BSON("" << 1), BSON("" << 2), BSON("" << 3)});
     auto diff = AbstractIndexAccessMethod::setDifference(left, right);
     ASSERT_EQUALS(3UL, diff.first.size());
     ASSERT_EQUALS(3UL, diff.second.size());
@@ -202,9 +208,9 @@ TEST(IndexAccessMethodSetDifference, LeftSetAllLargerThanRightShouldBeDisjoint)
 
 TEST(IndexAccessMethodSetDifference, ShouldNotReportOverlapsFromNonDisjointSets) {
     SimpleBSONObjComparator bsonCmp;
-    BSONObjSet left =
-        bsonCmp.makeBSONObjSet({BSON("" << 0), BSON("" << 1), BSON("" << 4), BSON("" << 6)});
-    BSONObjSet right = bsonCmp.makeBSONObjSet(
+    BSONObjFlatSet left =
+        bsonCmp.makeBSONObjFlatSet({BSON("" << 0), BSON("" << 1), BSON("" << 4), BSON("" << 6)});
+    BSONObjFlatSet right = bsonCmp.makeBSONObjFlatSet(
         {BSON("" << -1), BSON("" << 1), BSON("" << 3), BSON("" << 4), BSON("" << 7)});
     auto diff = AbstractIndexAccessMethod::setDifference(left, right);
     ASSERT_EQUALS(2UL, diff.first.size());   // 0, 6.
@@ -37,6 +37,8 @@
 #include "mongo/db/catalog/index_catalog.h"
 #include "mongo/db/client.h"
 #include "mongo/db/db_raii.h"
+#include "mongo/db/field_ref.h"
+#include "mongo/db/field_ref_set.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/dbtests/dbtests.h"
 
@@ -186,12 +188,95 @@ private:
     Database* _db;
 };
 
+/**
+ * Test that IndexCatalog::updateRecord() skips indexes whose indexed paths do not intersect the
+ * update's modified paths.
+ */
+class UpdateRecordSkipsUnaffectedIndexes {
+public:
+    UpdateRecordSkipsUnaffectedIndexes() {
+        const ServiceContext::UniqueOperationContext opCtxPtr = cc().makeOperationContext();
+        OperationContext& opCtx = *opCtxPtr;
+        Lock::DBLock lk(&opCtx, nsToDatabaseSubstring(_ns), MODE_X);
+        OldClientContext ctx(&opCtx, _ns);
+        WriteUnitOfWork wuow(&opCtx);
+
+        _db = ctx.db();
+        _coll = _db->createCollection(&opCtx, _ns);
+        _catalog = _coll->getIndexCatalog();
+        wuow.commit();
+    }
+
+    ~UpdateRecordSkipsUnaffectedIndexes() {
+        const ServiceContext::UniqueOperationContext opCtxPtr = cc().makeOperationContext();
+        OperationContext& opCtx = *opCtxPtr;
+        Lock::DBLock lk(&opCtx, nsToDatabaseSubstring(_ns), MODE_X);
+        OldClientContext ctx(&opCtx, _ns);
+        WriteUnitOfWork wuow(&opCtx);
+
+        _db->dropCollection(&opCtx, _ns).transitional_ignore();
+        wuow.commit();
+    }
+
+    void run() {
+        const ServiceContext::UniqueOperationContext opCtxPtr = cc().makeOperationContext();
+        OperationContext& opCtx = *opCtxPtr;
+        dbtests::WriteContextForTests ctx(&opCtx, _ns);
+
+        ASSERT_OK(dbtests::createIndex(&opCtx, _ns, BSON("x" << 1)));
+
+        const BSONObj oldDoc = BSON("_id" << 1 << "x" << 1 << "y" << 1);
+        {
+            WriteUnitOfWork wuow(&opCtx);
+            OpDebug* const nullOpDebug = nullptr;
+            ASSERT_OK(_coll->insertDocument(&opCtx, InsertStatement(oldDoc), nullOpDebug));
+            wuow.commit();
+        }
+
+        auto record = _coll->getCursor(&opCtx)->next();
+        ASSERT(record);
+        const RecordId recordId = record->id;
+
+        const BSONObj newDoc = BSON("_id" << 1 << "x" << 2 << "y" << 2);
+        int64_t keysInserted;
+        int64_t keysDeleted;
+
+        // Even though the new document has a different value for the indexed field 'x', declaring
+        // that only 'y' was modified must cause index maintenance to be skipped entirely.
+        FieldRef yPath("y");
+        FieldRefSet modifiedPaths;
+        modifiedPaths.insert(&yPath);
+        {
+            WriteUnitOfWork wuow(&opCtx);
+            ASSERT_OK(_catalog->updateRecord(
+                &opCtx, oldDoc, newDoc, recordId, &modifiedPaths, &keysInserted, &keysDeleted));
+            ASSERT_EQUALS(0, keysInserted);
+            ASSERT_EQUALS(0, keysDeleted);
+        }
+
+        // With unknown modified paths, the same update must maintain the index on 'x'.
+        {
+            WriteUnitOfWork wuow(&opCtx);
+            ASSERT_OK(_catalog->updateRecord(
+                &opCtx, oldDoc, newDoc, recordId, nullptr, &keysInserted, &keysDeleted));
+            ASSERT_EQUALS(1, keysInserted);
+            ASSERT_EQUALS(1, keysDeleted);
+        }
+    }
+
+private:
+    IndexCatalog* _catalog;
+    Collection* _coll;
+    Database* _db;
+};
+
 class IndexCatalogTests : public Suite {
 public:
     IndexCatalogTests() : Suite("indexcatalogtests") {}
     void setupTests() {
         add<IndexIteratorTests>();
         add<RefreshEntry>();
+        add<UpdateRecordSkipsUnaffectedIndexes>();
     }
 };
 
@@ -391,6 +391,47 @@ public:
     }
 };
 
+//
+// Scan a bounded record-id range, as a partitioned scan over the collection would.
+//
+
+class QueryStageCollscanRecordIdRange : public QueryStageCollectionScanBase {
+public:
+    void run() {
+        dbtests::WriteContextForTests ctx(&_opCtx, nss.ns());
+        Collection* coll = ctx.getCollection();
+
+        // Get the RecordIds that would be returned by an in-order scan.
+        vector<RecordId> recordIds;
+        getRecordIds(coll, CollectionScanParams::FORWARD, &recordIds);
+
+        // Scan the middle third of the collection: [recordIds[10], recordIds[39]].
+        CollectionScanParams params;
+        params.direction = CollectionScanParams::FORWARD;
+        params.tailable = false;
+        params.start = recordIds[10];
+        params.maxRecord = recordIds[39];
+
+        WorkingSet ws;
+        unique_ptr<PlanStage> scan(new CollectionScan(&_opCtx, coll, params, &ws, NULL));
+
+        int count = 0;
+        while (!scan->isEOF()) {
+            WorkingSetID id = WorkingSet::INVALID_ID;
+            PlanStage::StageState state = scan->work(&id);
+            if (PlanStage::ADVANCED == state) {
+                WorkingSetMember* member = ws.get(id);
+                ASSERT_EQUALS(coll->docFor(&_opCtx, recordIds[10 + count]).value()["foo"].numberInt(),
+                              member->obj.value()["foo"].numberInt());
+                ++count;
+            }
+        }
+
+        // The range bounds are inclusive.
+        ASSERT_EQUALS(30, count);
+    }
+};
+
 class All : public Suite {
 public:
     All() : Suite("QueryStageCollectionScan") {}
@@ -405,6 +446,7 @@ public:
         add<QueryStageCollscanObjectsInOrderBackward>();
         add<QueryStageCollscanDeleteUpcomingObject>();
         add<QueryStageCollscanDeleteUpcomingObjectBackward>();
+        add<QueryStageCollscanRecordIdRange>();
     }
 };
 
@@ -221,6 +221,61 @@ public:
     }
 };
 
+//
+// Test that a fetch with 'neededFields' returns a document trimmed to those fields.
+//
+class FetchStageNeededFields : public QueryStageFetchBase {
+public:
+    void run() {
+        dbtests::WriteContextForTests ctx(&_opCtx, ns());
+        Database* db = ctx.db();
+        Collection* coll = db->getCollection(&_opCtx, ns());
+        if (!coll) {
+            WriteUnitOfWork wuow(&_opCtx);
+            coll = db->createCollection(&_opCtx, ns());
+            wuow.commit();
+        }
+
+        WorkingSet ws;
+
+        // Add an object to the DB.
+        insert(BSON("_id" << 1 << "foo" << 5 << "bar" << 6 << "baz" << 7));
+        set<RecordId> recordIds;
+        getRecordIds(&recordIds, coll);
+        ASSERT_EQUALS(size_t(1), recordIds.size());
+
+        // Create a mock stage that returns the WSM.
+        auto mockStage = make_unique<QueuedDataStage>(&_opCtx, &ws);
+
+        // Mock data.
+        {
+            WorkingSetID id = ws.allocate();
+            WorkingSetMember* mockMember = ws.get(id);
+            mockMember->recordId = *recordIds.begin();
+            ws.transitionToRecordIdAndIdx(id);
+            mockStage->pushBack(id);
+        }
+
+        unique_ptr<FetchStage> fetchStage(new FetchStage(
+            &_opCtx, &ws, mockStage.release(), NULL, coll, {"_id", "foo"}));
+
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        PlanStage::StageState state;
+
+        // The fetched object should contain only the requested fields, and should be owned so
+        // that it survives the fetch cursor.
+        state = fetchStage->work(&id);
+        ASSERT_EQUALS(PlanStage::ADVANCED, state);
+        WorkingSetMember* member = ws.get(id);
+        ASSERT_BSONOBJ_EQ(BSON("_id" << 1 << "foo" << 5), member->obj.value());
+        ASSERT_TRUE(member->obj.value().isOwned());
+
+        // No more data to fetch, so, EOF.
+        state = fetchStage->work(&id);
+        ASSERT_EQUALS(PlanStage::IS_EOF, state);
+    }
+};
+
 class All : public Suite {
 public:
     All() : Suite("query_stage_fetch") {}
@@ -228,6 +283,7 @@ public:
     void setupTests() {
         add<FetchStageAlreadyFetched>();
         add<FetchStageFilter>();
+        add<FetchStageNeededFields>();
     }
 };
 
@@ -785,5 +785,35 @@ TEST_F(WildcardMultikeyPersistenceTestFixture, IndexShouldBecomeMultikeyIfArrayI
     assertMultikeyPathSetEquals({"g.h"});
 }
 
+TEST_F(WildcardMultikeyPersistenceTestFixture, InvalidateMultikeyPathCacheOnNewMetadataKeys) {
+    // Create the test collection, add an initial document, and build a $** index.
+    assertSetupEnvironment(false, makeDocs({"{a: 1, b: [{c: 2}]}"}));
+
+    const stdx::unordered_set<std::string> fieldSet{"b.c", "d.e"};
+
+    auto queryMultikeyPaths = [&](MultikeyMetadataAccessStats* stats) {
+        AutoGetCollectionForRead autoColl(opCtx(), kDefaultNSS);
+        auto indexAccessMethod = getIndex(autoColl.getCollection(), kDefaultIndexName);
+        return indexAccessMethod->getMultikeyPathSet(opCtx(), fieldSet, stats);
+    };
+
+    // The first lookup scans the index and memoizes a result for each queried field.
+    MultikeyMetadataAccessStats stats;
+    ASSERT(queryMultikeyPaths(&stats) == std::set<FieldRef>{FieldRef("b")});
+    ASSERT_GT(stats.numSeeks, 0U);
+
+    // The second lookup is served from the cache without touching the index.
+    ASSERT(queryMultikeyPaths(&stats) == std::set<FieldRef>{FieldRef("b")});
+    ASSERT_EQ(stats.numSeeks, 0U);
+
+    // Committing a document which introduces a new multikey path invalidates the cache, and the
+    // next lookup must scan the index again and observe the new path.
+    assertInsertDocuments(makeDocs({"{d: {e: [3]}}"}));
+
+    const std::set<FieldRef> expectedPaths{FieldRef("b"), FieldRef("d.e")};
+    ASSERT(queryMultikeyPaths(&stats) == expectedPaths);
+    ASSERT_GT(stats.numSeeks, 0U);
+}
+
 }  // namespace
 }  // namespace mongo
@@ -116,6 +116,12 @@ public:
      */
     boost::optional<ConnectionHandle> tryGetConnection(const stdx::unique_lock<stdx::mutex>& lk);
 
+    /**
+     * Spawns connections towards minConnections without enqueueing a request. Used to warm up
+     * the pool ahead of the first requests.
+     */
+    void warmUp(stdx::unique_lock<stdx::mutex>& lk);
+
     /**
      * Triggers the shutdown procedure. This function marks the state as kInShutdown
      * and calls processFailure below with the status provided. This may not immediately
@@ -205,6 +211,18 @@ private:
 
     void spawnConnections(stdx::unique_lock<stdx::mutex>& lk);
 
+    /**
+     * Records the current connection demand (outstanding requests plus checked out
+     * connections) in the current demand window. Does nothing if demand tracking is disabled.
+     */
+    void recordDemandInLock();
+
+    /**
+     * Returns the peak demand over the current and previous demand windows, or zero if demand
+     * tracking is disabled.
+     */
+    size_t recentPeakDemand() const;
+
     // This internal helper is used both by tryGet and by fulfillRequests and differs in that it
     // skips some bookkeeping that the other callers do on their own
     boost::optional<ConnectionHandle> tryGetInternal(const stdx::unique_lock<stdx::mutex>& lk);
@@ -239,6 +257,13 @@ private:
 
     size_t _created;
 
+    // Peak connection demand over the current and previous demand windows. Deliberately not
+    // reset by processFailure() so that a pool drained by a transient failure is re-grown to
+    // its recent working size.
+    Date_t _demandWindowStart;
+    size_t _demandWindowPeak;
+    size_t _lastDemandWindowPeak;
+
     transport::Session::TagMask _tags = transport::Session::kPending;
 
     /**
@@ -273,6 +298,7 @@ size_t const ConnectionPool::kDefaultMinConns = 1;
 size_t const ConnectionPool::kDefaultMaxConnecting = std::numeric_limits<size_t>::max();
 constexpr Milliseconds ConnectionPool::kDefaultRefreshRequirement;
 constexpr Milliseconds ConnectionPool::kDefaultRefreshTimeout;
+constexpr Milliseconds ConnectionPool::kDefaultDemandTrackingWindow;
 
 const Status ConnectionPool::kConnectionStateUnknown =
     Status(ErrorCodes::InternalError, "Connection is in an unknown state");
@@ -386,6 +412,26 @@ boost::optional<ConnectionPool::ConnectionHandle> ConnectionPool::tryGet(
     return pool->tryGetConnection(lk);
 }
 
+void ConnectionPool::warmUp(const HostAndPort& hostAndPort, transport::ConnectSSLMode sslMode) {
+    std::shared_ptr<SpecificPool> pool;
+
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+
+    auto iter = _pools.find(hostAndPort);
+
+    if (iter == _pools.end()) {
+        pool = stdx::make_unique<SpecificPool>(this, hostAndPort, sslMode);
+        _pools[hostAndPort] = pool;
+    } else {
+        pool = iter->second;
+        pool->fassertSSLModeIs(sslMode);
+    }
+
+    invariant(pool);
+
+    pool->warmUp(lk);
+}
+
 Future<ConnectionPool::ConnectionHandle> ConnectionPool::get(const HostAndPort& hostAndPort,
                                                              transport::ConnectSSLMode sslMode,
                                                              Milliseconds timeout) {
@@ -459,6 +505,8 @@ ConnectionPool::SpecificPool::SpecificPool(ConnectionPool* parent,
       _inFulfillRequests(false),
       _inSpawnConnections(false),
       _created(0),
+      _demandWindowPeak(0),
+      _lastDemandWindowPeak(0),
       _state(State::kRunning) {}
 
 ConnectionPool::SpecificPool::~SpecificPool() {
@@ -506,12 +554,46 @@ Future<ConnectionPool::ConnectionHandle> ConnectionPool::SpecificPool::getConnec
 
     updateStateInLock();
 
+    recordDemandInLock();
     spawnConnections(lk);
     fulfillRequests(lk);
 
     return std::move(pf.future);
 }
 
+void ConnectionPool::SpecificPool::recordDemandInLock() {
+    const auto window = _parent->_options.demandTrackingWindow;
+    if (window <= Milliseconds(0))
+        return;
+
+    const auto now = _parent->_factory->now();
+    if (now - _demandWindowStart >= window) {
+        // If more than an entire window passed without any demand, the last peak is stale too.
+        _lastDemandWindowPeak = (now - _demandWindowStart >= window * 2) ? 0 : _demandWindowPeak;
+        _demandWindowPeak = 0;
+        _demandWindowStart = now;
+    }
+
+    _demandWindowPeak =
+        std::max(_demandWindowPeak, _requests.size() + _checkedOutPool.size());
+}
+
+size_t ConnectionPool::SpecificPool::recentPeakDemand() const {
+    if (_parent->_options.demandTrackingWindow <= Milliseconds(0))
+        return 0;
+
+    return std::max(_demandWindowPeak, _lastDemandWindowPeak);
+}
+
+void ConnectionPool::SpecificPool::warmUp(stdx::unique_lock<stdx::mutex>& lk) {
+    // Warming up is best effort; a pool that is already draining doesn't need new connections.
+    if (_state == State::kInShutdown)
+        return;
+
+    spawnConnections(lk);
+    updateStateInLock();
+}
+
 boost::optional<ConnectionPool::ConnectionHandle> ConnectionPool::SpecificPool::tryGetConnection(
     const stdx::unique_lock<stdx::mutex>& lk) {
     invariant(_state != State::kInShutdown);
@@ -783,11 +865,14 @@ void ConnectionPool::SpecificPool::spawnConnections(stdx::unique_lock<stdx::mute
     _inSpawnConnections = true;
     auto guard = makeGuard([&] { _inSpawnConnections = false; });
 
-    // We want minConnections <= outstanding requests <= maxConnections
+    // We want minConnections <= outstanding requests <= maxConnections. When demand tracking
+    // is enabled we also size for the recent peak demand, so that a pool that was drained
+    // refills in parallel instead of growing by one connection per queued request.
     auto target = [&] {
         return std::max(
             _parent->_options.minConnections,
-            std::min(_requests.size() + _checkedOutPool.size(), _parent->_options.maxConnections));
+            std::min(std::max(_requests.size() + _checkedOutPool.size(), recentPeakDemand()),
+                     _parent->_options.maxConnections));
     };
 
     // While all of our inflight connections are less than our target
@@ -82,6 +82,7 @@ public:
     static const size_t kDefaultMaxConnecting;
     static constexpr Milliseconds kDefaultRefreshRequirement = Milliseconds(60000);  // 1min
     static constexpr Milliseconds kDefaultRefreshTimeout = Milliseconds(20000);      // 20secs
+    static constexpr Milliseconds kDefaultDemandTrackingWindow = Milliseconds(0);  // disabled
 
     static const Status kConnectionStateUnknown;
 
@@ -126,6 +127,18 @@ public:
          */
         Milliseconds hostTimeout = kDefaultHostTimeout;
 
+        /**
+         * Length of the window over which a host's pool tracks its peak connection demand
+         * (outstanding requests plus checked out connections). When spawning connections the
+         * pool targets the larger of the current demand and the peak over the last two such
+         * windows, so that a pool drained by a transient failure or topology change is re-grown
+         * to its recent working size in parallel rather than one request at a time.
+         *
+         * A window of zero disables demand tracking and the pool sizes itself only from current
+         * demand.
+         */
+        Milliseconds demandTrackingWindow = kDefaultDemandTrackingWindow;
+
         /**
          * An egress tag closer manager which will provide global access to this connection pool.
          * The manager set's tags and potentially drops connections that don't match those tags.
@@ -161,6 +174,14 @@ public:
     boost::optional<ConnectionHandle> tryGet(const HostAndPort& hostAndPort,
                                              transport::ConnectSSLMode sslMode);
 
+    /**
+     * Proactively opens connections to the given host until minConnections is reached,
+     * creating the host's pool if it does not exist yet. Establishment runs in parallel but is
+     * paced by maxConnecting, like any other spawn. Intended to be called at startup or after
+     * a topology change so that the first requests do not each pay for a connection handshake.
+     */
+    void warmUp(const HostAndPort& hostAndPort, transport::ConnectSSLMode sslMode);
+
     void appendConnectionStats(ConnectionPoolStats* stats) const;
 
     size_t getNumConnectionsPerHost(const HostAndPort& hostAndPort) const;
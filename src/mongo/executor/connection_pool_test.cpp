@@ -919,6 +919,166 @@ TEST_F(ConnectionPoolTest, minPoolRespected) {
     ASSERT(!reachedC);
 }
 
+/**
+ * Verify that warmUp establishes minConnections connections to a host before any requests
+ * arrive, and that those connections then serve requests.
+ */
+TEST_F(ConnectionPoolTest, warmUpReachesMinConnections) {
+    ConnectionPool::Options options;
+    options.minConnections = 2;
+    options.maxConnections = 5;
+    ConnectionPool pool(stdx::make_unique<PoolImpl>(), "test pool", options);
+
+    auto now = Date_t::now();
+
+    PoolImpl::setNow(now);
+
+    pool.warmUp(HostAndPort(), transport::kGlobalSSLMode);
+
+    bool reachedA = false;
+    bool reachedB = false;
+    bool reachedC = false;
+
+    ConnectionImpl::pushSetup([&]() {
+        reachedA = true;
+        return Status::OK();
+    });
+    ConnectionImpl::pushSetup([&]() {
+        reachedB = true;
+        return Status::OK();
+    });
+    ConnectionImpl::pushSetup([&]() {
+        reachedC = true;
+        return Status::OK();
+    });
+
+    // Two setups were invoked without any requests (minConnections == 2)
+    ASSERT(reachedA);
+    ASSERT(reachedB);
+    ASSERT(!reachedC);
+    ASSERT_EQ(pool.getNumConnectionsPerHost(HostAndPort()), 2U);
+
+    // A request arriving after warm-up is served by a pre-established connection
+    ConnectionPool::ConnectionHandle conn;
+    pool.get_forTest(HostAndPort(),
+                     Milliseconds(5000),
+                     [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                         ASSERT(swConn.isOK());
+
+                         conn = std::move(swConn.getValue());
+                     });
+
+    ASSERT(conn);
+    doneWith(conn);
+    conn.reset();
+}
+
+/**
+ * Verify that with a demand tracking window, a pool that loses its connections is re-grown to
+ * its recent peak demand in parallel, rather than one connection per outstanding request.
+ */
+TEST_F(ConnectionPoolTest, demandWindowRegrowsDrainedPool) {
+    ConnectionPool::Options options;
+    options.minConnections = 1;
+    options.maxConnections = 5;
+    options.refreshRequirement = Milliseconds(5000);
+    options.refreshTimeout = Milliseconds(5000);
+    options.demandTrackingWindow = Milliseconds(10000);
+    ConnectionPool pool(stdx::make_unique<PoolImpl>(), "test pool", options);
+
+    auto now = Date_t::now();
+
+    PoolImpl::setNow(now);
+
+    ConnectionPool::ConnectionHandle conn1;
+    ConnectionPool::ConnectionHandle conn2;
+    ConnectionPool::ConnectionHandle conn3;
+
+    // Check out three connections at once to establish a peak demand of three
+    pool.get_forTest(HostAndPort(),
+                     Milliseconds(5000),
+                     [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                         ASSERT(swConn.isOK());
+
+                         conn1 = std::move(swConn.getValue());
+                     });
+    pool.get_forTest(HostAndPort(),
+                     Milliseconds(5000),
+                     [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                         ASSERT(swConn.isOK());
+
+                         conn2 = std::move(swConn.getValue());
+                     });
+    pool.get_forTest(HostAndPort(),
+                     Milliseconds(5000),
+                     [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                         ASSERT(swConn.isOK());
+
+                         conn3 = std::move(swConn.getValue());
+                     });
+
+    ConnectionImpl::pushSetup(Status::OK());
+    ConnectionImpl::pushSetup(Status::OK());
+    ConnectionImpl::pushSetup(Status::OK());
+
+    ASSERT(conn1);
+    ASSERT(conn2);
+    ASSERT(conn3);
+
+    PoolImpl::setNow(now + Milliseconds(1));
+    doneWith(conn1);
+    conn1.reset();
+    doneWith(conn2);
+    conn2.reset();
+    doneWith(conn3);
+    conn3.reset();
+
+    // Simulate a topology change dropping every pooled connection
+    pool.dropConnections(HostAndPort());
+    ASSERT_EQ(pool.getNumConnectionsPerHost(HostAndPort()), 0U);
+
+    // A single request should spawn back up to the recent peak demand of three, not just one
+    ConnectionPool::ConnectionHandle conn4;
+    pool.get_forTest(HostAndPort(),
+                     Milliseconds(5000),
+                     [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                         ASSERT(swConn.isOK());
+
+                         conn4 = std::move(swConn.getValue());
+                     });
+
+    bool reachedA = false;
+    bool reachedB = false;
+    bool reachedC = false;
+    bool reachedD = false;
+
+    ConnectionImpl::pushSetup([&]() {
+        reachedA = true;
+        return Status::OK();
+    });
+    ConnectionImpl::pushSetup([&]() {
+        reachedB = true;
+        return Status::OK();
+    });
+    ConnectionImpl::pushSetup([&]() {
+        reachedC = true;
+        return Status::OK();
+    });
+    ConnectionImpl::pushSetup([&]() {
+        reachedD = true;
+        return Status::OK();
+    });
+
+    ASSERT(reachedA);
+    ASSERT(reachedB);
+    ASSERT(reachedC);
+    ASSERT(!reachedD);
+
+    ASSERT(conn4);
+    doneWith(conn4);
+    conn4.reset();
+}
+
 
 /**
  * Verify that the hostTimeout is respected. This implies that an idle
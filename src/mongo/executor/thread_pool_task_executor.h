@@ -180,6 +180,13 @@ private:
      */
     void runCallback(std::shared_ptr<CallbackState> cbState);
 
+    /**
+     * Reacts to a network interface alarm set for "alarmTime" firing: batches all sleepers whose
+     * ready dates have passed into the thread pool and re-arms a single alarm for the next
+     * deadline, if any. See the comment on _earliestOutstandingAlarm.
+     */
+    void _alarmFired(Date_t alarmTime);
+
     bool _inShutdown_inlock() const;
     void _setState_inlock(State newState);
     stdx::unique_lock<stdx::mutex> _join(stdx::unique_lock<stdx::mutex> lk);
@@ -199,9 +206,16 @@ private:
     // Queue containing all items currently scheduled into the network interface.
     WorkQueue _networkInProgressQueue;
 
-    // Queue containing all items waiting for a particular point in time to execute.
+    // Queue containing all items waiting for a particular point in time to execute, sorted by
+    // ascending ready date.
     WorkQueue _sleepersQueue;
 
+    // The earliest time for which an alarm is outstanding with the network interface. Alarms are
+    // coalesced: scheduleWorkAt() only sets a new alarm when the new deadline precedes this one,
+    // and a firing alarm drains every due sleeper in one batch before re-arming for the next
+    // deadline. Date_t::max() means no alarm covers the front of _sleepersQueue.
+    Date_t _earliestOutstandingAlarm = Date_t::max();
+
     // List of all events that have yet to be signaled.
     EventList _unsignaledEvents;
 
@@ -31,6 +31,8 @@
 #pragma once
 
 
+#include <sstream>
+
 #include "mongo/base/disallow_copying.h"
 #include "mongo/base/status.h"
 #include "mongo/logger/appender.h"
@@ -55,8 +57,14 @@ public:
     explicit ConsoleAppender(std::unique_ptr<EventEncoder> encoder)
         : _encoder(std::move(encoder)) {}
     virtual Status append(const Event& event) {
+        // Format the event before constructing the Console, which holds the console mutex for
+        // its lifetime. Concurrent logging threads then serialize only on the write itself
+        // rather than on encoding, which is the expensive part of append.
+        std::ostringstream formatted;
+        if (!_encoder->encode(event, formatted))
+            return Status(ErrorCodes::LogWriteFailed, "Error formatting log message.");
         ConsoleType console;
-        _encoder->encode(event, console.out()).flush();
+        console.out() << formatted.str() << std::flush;
         if (!console.out())
             return Status(ErrorCodes::LogWriteFailed, "Error writing log message to console.");
         return Status::OK();
@@ -31,6 +31,8 @@
 #pragma once
 
 
+#include <sstream>
+
 #include "mongo/base/disallow_copying.h"
 #include "mongo/base/status.h"
 #include "mongo/logger/appender.h"
@@ -61,11 +63,17 @@ public:
         : _encoder(std::move(encoder)), _writer(writer) {}
 
     virtual Status append(const Event& event) {
+        // Format the event before acquiring the writer, whose Use object holds the writer
+        // mutex for its lifetime. Concurrent logging threads then serialize only on the file
+        // write itself rather than on encoding.
+        std::ostringstream formatted;
+        if (!_encoder->encode(event, formatted))
+            return Status(ErrorCodes::LogWriteFailed, "Error formatting log message.");
         RotatableFileWriter::Use useWriter(_writer);
         Status status = useWriter.status();
         if (!status.isOK())
             return status;
-        _encoder->encode(event, useWriter.stream()).flush();
+        useWriter.stream() << formatted.str() << std::flush;
         return useWriter.status();
     }
 
@@ -54,8 +54,15 @@ struct Validator<BSONObj> {
     }
 
     inline static Status validateLoad(const char* ptr, size_t length) {
-        return serverGlobalParams.objcheck ? validateBSON(ptr, length, enabledBSONVersion())
-                                           : Status::OK();
+        if (!serverGlobalParams.objcheck) {
+            return Status::OK();
+        }
+        // Objects read off the wire are validated against the latest BSON version, so the
+        // structure-only fast pass applies.
+        if (enabledBSONVersion() == BSONVersion::kLatest) {
+            return validateBSON(ptr, length);
+        }
+        return validateBSON(ptr, length, enabledBSONVersion());
     }
 
     static Status validateStore(const BSONObj& toStore);
@@ -41,6 +41,7 @@
 #include "mongo/db/bson/dotted_path_support.h"
 #include "mongo/rpc/object_check.h"
 #include "mongo/util/bufreader.h"
+#include "mongo/util/crc32c.h"
 #include "mongo/util/hex.h"
 #include "mongo/util/log.h"
 
@@ -49,6 +50,15 @@ namespace {
 
 auto kAllSupportedFlags = OpMsg::kChecksumPresent | OpMsg::kMoreToCome;
 
+constexpr int kCrc32Size = 4;
+
+// The checksum covers the whole message preceding it, header included.
+uint32_t calculateChecksum(const Message& message) {
+    invariant(message.operation() == dbMsg);
+    invariant(OpMsg::isFlagSet(message, OpMsg::kChecksumPresent));
+    return crc32c(message.singleData().view2ptr(), message.size() - kCrc32Size);
+}
+
 bool containsUnknownRequiredFlags(uint32_t flags) {
     const uint32_t kRequiredFlagMask = 0xffff;  // Low 2 bytes are required, high 2 are optional.
     return (flags & ~kAllSupportedFlags & kRequiredFlagMask) != 0;
@@ -77,6 +87,45 @@ void OpMsg::replaceFlags(Message* message, uint32_t flags) {
     DataView(message->singleData().data()).write<LittleEndian<uint32_t>>(flags);
 }
 
+uint32_t OpMsg::getChecksum(const Message& message) {
+    invariant(message.operation() == dbMsg);
+    invariant(isFlagSet(message, kChecksumPresent));
+    return BufReader(message.singleData().view2ptr() + message.size() - kCrc32Size, kCrc32Size)
+        .read<LittleEndian<uint32_t>>();
+}
+
+void OpMsg::appendChecksum(Message* message) {
+    invariant(message->operation() == dbMsg);
+    if (isFlagSet(*message, kChecksumPresent)) {
+        return;
+    }
+
+    setFlag(message, kChecksumPresent);
+
+    // The checksum goes at the very end of the message, so grow it by four bytes. The message
+    // buffer is sized exactly, so this always requires a copy.
+    const size_t newSize = message->size() + kCrc32Size;
+    auto buffer = SharedBuffer::allocate(newSize);
+    memcpy(buffer.get(), message->buf(), message->size());
+
+    Message checksummed(std::move(buffer));
+    checksummed.header().setLen(newSize);
+    DataView(checksummed.buf() + newSize - kCrc32Size)
+        .write<LittleEndian<uint32_t>>(calculateChecksum(checksummed));
+    *message = std::move(checksummed);
+}
+
+void OpMsg::removeChecksum(Message* message) {
+    if (!isFlagSet(*message, kChecksumPresent)) {
+        return;
+    }
+
+    replaceFlags(message, flags(*message) & ~kChecksumPresent);
+    // The checksum occupies the last four bytes; shrinking the advertised length is enough, the
+    // buffer itself need not be reallocated.
+    message->header().setLen(message->size() - kCrc32Size);
+}
+
 OpMsg OpMsg::parse(const Message& message) try {
     // It is the caller's responsibility to call the correct parser for a given message type.
     invariant(!message.empty());
@@ -88,7 +137,6 @@ OpMsg OpMsg::parse(const Message& message) try {
                           << std::bitset<32>(flags).to_string(),
             !containsUnknownRequiredFlags(flags));
 
-    constexpr int kCrc32Size = 4;
     const bool haveChecksum = flags & kChecksumPresent;
     const int checksumSize = haveChecksum ? kCrc32Size : 0;
 
@@ -153,6 +201,12 @@ OpMsg OpMsg::parse(const Message& message) try {
                 !inBody);
     }
 
+    if (haveChecksum) {
+        uassert(ErrorCodes::ChecksumMismatch,
+                "OP_MSG checksum failed",
+                getChecksum(message) == calculateChecksum(message));
+    }
+
     return msg;
 } catch (const DBException& ex) {
     LOG(1) << "invalid message: " << ex.code() << " " << redact(ex) << " -- "
@@ -160,6 +214,58 @@ OpMsg OpMsg::parse(const Message& message) try {
     throw;
 }
 
+OpMsgDocumentSequenceCursor::OpMsgDocumentSequenceCursor(const Message& message, StringData name) {
+    invariant(!message.empty());
+    invariant(message.operation() == dbMsg);
+
+    const uint32_t flags = OpMsg::flags(message);
+    uassert(ErrorCodes::IllegalOpMsgFlag,
+            str::stream() << "Message contains illegal flags value: Ob"
+                          << std::bitset<32>(flags).to_string(),
+            !containsUnknownRequiredFlags(flags));
+
+    const int checksumSize = (flags & OpMsg::kChecksumPresent) ? kCrc32Size : 0;
+
+    BufReader sectionsBuf(message.singleData().data() + sizeof(flags),
+                          message.dataSize() - sizeof(flags) - checksumSize);
+    while (!sectionsBuf.atEof()) {
+        const auto sectionKind = sectionsBuf.read<Section>();
+        switch (sectionKind) {
+            case Section::kBody:
+                // Skip over the body without materializing it; the leading int32 is the total
+                // object size including itself.
+                sectionsBuf.skip(sectionsBuf.peek<LittleEndian<int32_t>>());
+                break;
+
+            case Section::kDocSequence: {
+                // The first 4 bytes are the total size, including themselves.
+                const auto remainingSize =
+                    sectionsBuf.read<LittleEndian<int32_t>>() - sizeof(int32_t);
+                const char* seqStart =
+                    static_cast<const char*>(sectionsBuf.skip(remainingSize));
+                BufReader seqBuf(seqStart, remainingSize);
+                const auto seqName = seqBuf.readCStr();
+                if (seqName == name) {
+                    // BufReader is not copyable, so rebuild one over the documents region.
+                    _docs.emplace(seqStart + seqName.size() + 1,
+                                  remainingSize - (seqName.size() + 1));
+                    return;
+                }
+                break;
+            }
+
+            default:
+                uasserted(ErrorCodes::FailedToParse,
+                          str::stream() << "Unknown section kind " << uint32_t(sectionKind));
+        }
+    }
+}
+
+BSONObj OpMsgDocumentSequenceCursor::next() {
+    invariant(more());
+    return _docs->read<Validated<BSONObj>>();
+}
+
 Message OpMsg::serialize() const {
     OpMsgBuilder builder;
     for (auto&& seq : sequences) {
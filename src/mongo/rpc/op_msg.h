@@ -34,9 +34,12 @@
 #include <string>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include "mongo/base/string_data.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/rpc/message.h"
+#include "mongo/util/bufreader.h"
 
 namespace mongo {
 
@@ -74,6 +77,26 @@ struct OpMsg {
         replaceFlags(message, flags(*message) | flag);
     }
 
+    /**
+     * Returns the checksum stored at the end of the message. Only legal on an OP_MSG message with
+     * the kChecksumPresent flag set.
+     */
+    static uint32_t getChecksum(const Message& message);
+
+    /**
+     * Appends a CRC-32C checksum of the whole message (header included) at its end and sets the
+     * kChecksumPresent flag. Call this after the header fields are finalized, since they are
+     * covered by the checksum. Does nothing if the message is already checksummed.
+     */
+    static void appendChecksum(Message* message);
+
+    /**
+     * Removes the trailing checksum and clears the kChecksumPresent flag. Does nothing if the
+     * message is not checksummed. Use with appendChecksum() to make a checksum cover modified
+     * header fields.
+     */
+    static void removeChecksum(Message* message);
+
     /**
      * Parses and returns an OpMsg containing unowned BSON.
      */
@@ -111,6 +134,41 @@ struct OpMsg {
     std::vector<DocumentSequence> sequences;
 };
 
+/**
+ * A streaming cursor over one document sequence of an OP_MSG message, yielding unowned BSONObj
+ * views directly over the transport buffer held by the Message. OpMsg::parse() materializes a
+ * vector of every document in a sequence before callers see the first one; for large write
+ * batches this cursor lets the consumer walk the sequence in place with no intermediate copy or
+ * per-batch vector growth. Each document is validated as it is yielded, subject to the same
+ * objcheck setting as parse().
+ *
+ * The Message must outlive the cursor and any BSONObj obtained from it.
+ */
+class OpMsgDocumentSequenceCursor {
+public:
+    /**
+     * Seeks to the document sequence section named 'name'. Throws if the message is malformed.
+     * If there is no such sequence, exists() returns false and the cursor is exhausted.
+     */
+    OpMsgDocumentSequenceCursor(const Message& message, StringData name);
+
+    bool exists() const {
+        return _docs != boost::none;
+    }
+
+    bool more() const {
+        return _docs && !_docs->atEof();
+    }
+
+    /**
+     * Returns a view of the next document. Illegal to call when !more().
+     */
+    BSONObj next();
+
+private:
+    boost::optional<BufReader> _docs;
+};
+
 /**
  * An OpMsg that represents a request. This is a separate type from OpMsg only to provide better
  * type-safety along with a place to hang request-specific methods.
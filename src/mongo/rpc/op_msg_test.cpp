@@ -159,8 +159,9 @@ const char kDocSequenceSection = 1;
 const uint32_t kNoFlags = 0;
 const uint32_t kHaveChecksum = 1;
 
-// CRC filler value
-const uint32_t kFakeCRC = 0;  // TODO will need to compute real crc when SERVER-28679 is done.
+// An intentionally wrong CRC value. Tests that only care about sectioning use this; tests of the
+// checksum itself build a real one with OpMsg::appendChecksum().
+const uint32_t kFakeCRC = 0;
 
 TEST_F(OpMsgParser, SucceedsWithJustBody) {
     auto msg = OpMsgBytes{
@@ -173,18 +174,93 @@ TEST_F(OpMsgParser, SucceedsWithJustBody) {
     ASSERT_EQ(msg.sequences.size(), 0u);
 }
 
-TEST_F(OpMsgParser, IgnoresCrcIfPresent) {  // Until SERVER-28679 is done.
-    auto msg = OpMsgBytes{
-        kHaveChecksum,  //
+TEST_F(OpMsgParser, SucceedsWithValidChecksum) {
+    auto message = OpMsgBytes{
+        kNoFlags,  //
         kBodySection,
         fromjson("{ping: 1}"),
-        kFakeCRC,  // If not ignored, this would be read as a second body.
-    }.parse();
+    }.done();
+    OpMsg::appendChecksum(&message);
+
+    ASSERT(OpMsg::isFlagSet(message, OpMsg::kChecksumPresent));
+    auto msg = OpMsg::parseOwned(message);
 
     ASSERT_BSONOBJ_EQ(msg.body, fromjson("{ping: 1}"));
     ASSERT_EQ(msg.sequences.size(), 0u);
 }
 
+TEST_F(OpMsgParser, FailsWithInvalidChecksum) {
+    auto msg = OpMsgBytes{
+        kHaveChecksum,  //
+        kBodySection,
+        fromjson("{ping: 1}"),
+        kFakeCRC,  // The checksum is not ignored, so this fails to validate.
+    };
+
+    ASSERT_THROWS_WITH_CHECK(msg.parse(), AssertionException, [](const DBException& ex) {
+        ASSERT_EQ(ex.toStatus().code(), ErrorCodes::ChecksumMismatch);
+        ASSERT(ErrorCodes::isConnectionFatalMessageParseError(ex.toStatus().code()));
+    });
+}
+
+TEST_F(OpMsgParser, ChecksumCoversHeader) {
+    auto message = OpMsgBytes{
+        kNoFlags,  //
+        kBodySection,
+        fromjson("{ping: 1}"),
+    }.done();
+    OpMsg::appendChecksum(&message);
+
+    // Corrupting a header field (here the responseTo id) must be detected, since the checksum
+    // covers the whole message including the header.
+    DataView(message.buf()).write<LittleEndian<int32_t>>(1234, sizeof(int32_t));
+
+    ASSERT_THROWS_CODE(OpMsg::parse(message), AssertionException, ErrorCodes::ChecksumMismatch);
+}
+
+TEST_F(OpMsgParser, AppendChecksumIsIdempotent) {
+    auto message = OpMsgBytes{
+        kNoFlags,  //
+        kBodySection,
+        fromjson("{ping: 1}"),
+    }.done();
+    OpMsg::appendChecksum(&message);
+    const auto sizeAfterFirstAppend = message.size();
+    const auto checksum = OpMsg::getChecksum(message);
+
+    OpMsg::appendChecksum(&message);
+
+    ASSERT_EQ(message.size(), sizeAfterFirstAppend);
+    ASSERT_EQ(OpMsg::getChecksum(message), checksum);
+}
+
+TEST_F(OpMsgParser, RemoveChecksumRestoresOriginalMessage) {
+    auto message = OpMsgBytes{
+        kNoFlags,  //
+        kBodySection,
+        fromjson("{ping: 1}"),
+    }.done();
+    const auto originalSize = message.size();
+    OpMsg::appendChecksum(&message);
+
+    OpMsg::removeChecksum(&message);
+
+    ASSERT_EQ(message.size(), originalSize);
+    ASSERT(!OpMsg::isFlagSet(message, OpMsg::kChecksumPresent));
+    ASSERT_BSONOBJ_EQ(OpMsg::parse(message).body, fromjson("{ping: 1}"));
+
+    // Removing again is a no-op, and a remove/append cycle produces a checksum valid for a
+    // header modified in between.
+    OpMsg::removeChecksum(&message);
+    ASSERT_EQ(message.size(), originalSize);
+
+    OpMsg::appendChecksum(&message);
+    OpMsg::removeChecksum(&message);
+    message.header().setId(1234);
+    OpMsg::appendChecksum(&message);
+    ASSERT_BSONOBJ_EQ(OpMsg::parse(message).body, fromjson("{ping: 1}"));
+}
+
 TEST_F(OpMsgParser, SucceedsWithBodyThenSequence) {
     auto msg = OpMsgBytes{
         kNoFlags,  //
@@ -308,6 +384,58 @@ TEST_F(OpMsgParser, SucceedsWithBodyThenSequenceThenSequence) {
     ASSERT_EQ(msg.sequences[1].objs.size(), 0u);
 }
 
+TEST_F(OpMsgParser, DocumentSequenceCursorYieldsUnownedViews) {
+    auto msg = OpMsgBytes{
+        kNoFlags,  //
+        kBodySection,
+        fromjson("{insert: 'coll'}"),
+
+        kDocSequenceSection,
+        Sized{
+            "documents",  //
+            fromjson("{a: 1}"),
+            fromjson("{a: 2}"),
+            fromjson("{a: 3}"),
+        },
+    }.done();
+
+    OpMsgDocumentSequenceCursor cursor(msg, "documents");
+    ASSERT_TRUE(cursor.exists());
+
+    int count = 0;
+    while (cursor.more()) {
+        auto obj = cursor.next();
+        ++count;
+        ASSERT_BSONOBJ_EQ(obj, BSON("a" << count));
+        // The view must point directly into the message buffer.
+        ASSERT_FALSE(obj.isOwned());
+        ASSERT_GTE(obj.objdata(), msg.singleData().data());
+        ASSERT_LT(obj.objdata(), msg.singleData().data() + msg.dataSize());
+    }
+    ASSERT_EQ(count, 3);
+}
+
+TEST_F(OpMsgParser, DocumentSequenceCursorHandlesMissingAndEmptySequences) {
+    auto msg = OpMsgBytes{
+        kNoFlags,  //
+        kBodySection,
+        fromjson("{ping: 1}"),
+
+        kDocSequenceSection,
+        Sized{
+            "empty",  //
+        },
+    }.done();
+
+    OpMsgDocumentSequenceCursor empty(msg, "empty");
+    ASSERT_TRUE(empty.exists());
+    ASSERT_FALSE(empty.more());
+
+    OpMsgDocumentSequenceCursor missing(msg, "nothere");
+    ASSERT_FALSE(missing.exists());
+    ASSERT_FALSE(missing.more());
+}
+
 TEST_F(OpMsgParser, FailsIfNoBody) {
     auto msg = OpMsgBytes{
         kNoFlags,  //
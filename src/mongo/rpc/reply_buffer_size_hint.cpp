@@ -0,0 +1,59 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/rpc/reply_buffer_size_hint.h"
+
+#include <algorithm>
+
+namespace mongo {
+namespace rpc {
+namespace {
+
+const auto getReplyBufferSizeHint =
+    transport::Session::declareDecoration<ReplyBufferSizeHint>();
+
+}  // namespace
+
+ReplyBufferSizeHint& ReplyBufferSizeHint::get(const transport::SessionHandle& session) {
+    return getReplyBufferSizeHint(session.get());
+}
+
+void ReplyBufferSizeHint::recordReplySize(std::size_t bytes) {
+    const auto previous = static_cast<std::size_t>(_recommended.load());
+
+    // Grow to the new size immediately; shrink by an eighth per reply otherwise. Lost updates
+    // from concurrent stores are acceptable: this is a sizing heuristic, not an invariant.
+    const auto decayed = previous - previous / 8;
+    _recommended.store(std::min(std::max(bytes, decayed), kMaxRecommendation));
+}
+
+}  // namespace rpc
+}  // namespace mongo
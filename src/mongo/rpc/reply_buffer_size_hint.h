@@ -0,0 +1,78 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "mongo/platform/atomic_word.h"
+#include "mongo/transport/session.h"
+
+namespace mongo {
+namespace rpc {
+
+/**
+ * Tracks the sizes of replies sent over a transport session and recommends an initial capacity
+ * for the next reply's buffer. Reply sizes are typically very stable per session (one driver
+ * running the same workload), so starting the reply builder at a decayed high-water mark of the
+ * session's history avoids the doubling reallocations the BufBuilder would otherwise go through
+ * on every response.
+ */
+class ReplyBufferSizeHint {
+public:
+    /**
+     * Returns the hint state decorating 'session'.
+     */
+    static ReplyBufferSizeHint& get(const transport::SessionHandle& session);
+
+    /**
+     * Returns the number of bytes a reply builder for this session should pre-allocate, or 0 when
+     * no reply has been recorded yet. Callers combine this with any static per-command estimate.
+     */
+    std::size_t recommended() const {
+        return _recommended.load();
+    }
+
+    /**
+     * Records the logical (uncompressed) size of a reply sent over the session. The
+     * recommendation follows growth immediately and decays slowly when replies shrink, so one
+     * small reply in a stream of large ones doesn't throw the sizing away.
+     */
+    void recordReplySize(std::size_t bytes);
+
+private:
+    // Don't recommend pre-allocating more than this, no matter the history; beyond it the cost
+    // of growing once more is dwarfed by building the reply itself.
+    static constexpr std::size_t kMaxRecommendation = 16 * 1024 * 1024;
+
+    AtomicWord<unsigned long long> _recommended{0};
+};
+
+}  // namespace rpc
+}  // namespace mongo
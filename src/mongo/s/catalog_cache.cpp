@@ -155,28 +155,70 @@ StatusWith<CachedDatabaseInfo> CatalogCache::getDatabase(OperationContext* opCtx
                 // If this is the first time we are loading info for this database, also load the
                 // sharded collections.
                 // TODO (SERVER-34061): Stop loading sharded collections when loading a database.
+                auto loadNotification = dbEntry->collectionsLoadNotification;
+                if (loadNotification) {
+                    // Another thread is already loading the sharded collections. Wait for it
+                    // outside of the mutex and re-evaluate the entry afterwards.
+                    ul.unlock();
+                    uassertStatusOK(loadNotification->get(opCtx));
+                    continue;
+                }
+
+                loadNotification = (dbEntry->collectionsLoadNotification =
+                                        std::make_shared<Notification<Status>>());
 
-                const auto dbNameCopy = dbName.toString();
-                repl::OpTime collLoadConfigOptime;
-                const std::vector<CollectionType> collections =
-                    uassertStatusOK(Grid::get(opCtx)->catalogClient()->getCollections(
-                        opCtx, &dbNameCopy, &collLoadConfigOptime));
+                // The config server read below must not run under the mutex, otherwise every
+                // routing lookup on every thread stalls behind it.
+                ul.unlock();
 
-                CollectionInfoMap collectionEntries;
-                for (const auto& coll : collections) {
-                    if (coll.getDropped()) {
-                        continue;
+                auto loadStatus = [&]() -> Status {
+                    try {
+                        const auto dbNameCopy = dbName.toString();
+                        repl::OpTime collLoadConfigOptime;
+                        const std::vector<CollectionType> collections =
+                            uassertStatusOK(Grid::get(opCtx)->catalogClient()->getCollections(
+                                opCtx, &dbNameCopy, &collLoadConfigOptime));
+
+                        CollectionInfoMap collectionEntries;
+                        for (const auto& coll : collections) {
+                            if (coll.getDropped()) {
+                                continue;
+                            }
+                            collectionEntries[coll.getNs().ns()] =
+                                std::make_shared<CollectionRoutingInfoEntry>();
+                        }
+
+                        stdx::lock_guard<stdx::mutex> lg(_mutex);
+                        const auto it = _databases.find(dbName);
+                        if (it != _databases.end() && it->second == dbEntry) {
+                            // Only install the result if the entry we loaded for is still the
+                            // current one; the database may have been purged while the load was
+                            // running, in which case installing would resurrect a stale entry.
+                            _collectionsByDb[dbName] = std::move(collectionEntries);
+                            dbEntry->mustLoadShardedCollections = false;
+                        }
+                        dbEntry->collectionsLoadNotification->set(Status::OK());
+                        dbEntry->collectionsLoadNotification = nullptr;
+                        return Status::OK();
+                    } catch (const DBException& ex) {
+                        stdx::lock_guard<stdx::mutex> lg(_mutex);
+                        dbEntry->collectionsLoadNotification->set(ex.toStatus());
+                        dbEntry->collectionsLoadNotification = nullptr;
+                        return ex.toStatus();
                     }
-                    collectionEntries[coll.getNs().ns()] =
-                        std::make_shared<CollectionRoutingInfoEntry>();
-                }
-                _collectionsByDb[dbName] = std::move(collectionEntries);
-                dbEntry->mustLoadShardedCollections = false;
+                }();
+                uassertStatusOK(loadStatus);
+                continue;
             }
 
+            // Copy the database metadata out of the entry so the shard registry lookup below
+            // does not have to run under the mutex.
+            auto dbt = *dbEntry->dbt;
+            ul.unlock();
+
             auto primaryShard = uassertStatusOK(
-                Grid::get(opCtx)->shardRegistry()->getShard(opCtx, dbEntry->dbt->getPrimary()));
-            return {CachedDatabaseInfo(*dbEntry->dbt, std::move(primaryShard))};
+                Grid::get(opCtx)->shardRegistry()->getShard(opCtx, dbt.getPrimary()));
+            return {CachedDatabaseInfo(std::move(dbt), std::move(primaryShard))};
         }
     } catch (const DBException& ex) {
         return ex.toStatus();
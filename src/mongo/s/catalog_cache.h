@@ -282,6 +282,11 @@ private:
         // ensures only the first loads the collections.
         bool mustLoadShardedCollections{true};
 
+        // Contains a notification to be waited on while another thread is loading the sharded
+        // collections for the database (only set while such a load is in progress). This keeps
+        // the load's config server read outside of the cache mutex.
+        std::shared_ptr<Notification<Status>> collectionsLoadNotification;
+
         // Contains the cached info about the database (only available if needsRefresh is false)
         boost::optional<DatabaseType> dbt;
     };
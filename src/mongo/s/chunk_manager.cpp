@@ -59,6 +59,28 @@ void checkAllElementsAreOfType(BSONType type, const BSONObj& o) {
     }
 }
 
+/**
+ * Asserts that the 'left' chunk's max is exactly the 'right' chunk's min, i.e. that the two
+ * chunks are contiguous in the routing table.
+ */
+void checkChunkContinuity(const ChunkInfo& left, const ChunkInfo& right) {
+    if (SimpleBSONObjComparator::kInstance.evaluate(left.getMax() == right.getMin()))
+        return;
+
+    if (SimpleBSONObjComparator::kInstance.evaluate(left.getMax() < right.getMin()))
+        uasserted(ErrorCodes::ConflictingOperationInProgress,
+                  str::stream() << "Gap exists in the routing table between chunks "
+                                << left.getRange().toString()
+                                << " and "
+                                << right.getRange().toString());
+
+    uasserted(ErrorCodes::ConflictingOperationInProgress,
+              str::stream() << "Overlap exists in the routing table between chunks "
+                            << left.getRange().toString()
+                            << " and "
+                            << right.getRange().toString());
+}
+
 std::string extractKeyStringInternal(const BSONObj& shardKeyValue, Ordering ordering) {
     BSONObjBuilder strippedKeyValue;
     for (const auto& elem : shardKeyValue) {
@@ -77,7 +99,8 @@ RoutingTableHistory::RoutingTableHistory(NamespaceString nss,
                                          std::unique_ptr<CollatorInterface> defaultCollator,
                                          bool unique,
                                          ChunkInfoMap chunkMap,
-                                         ChunkVersion collectionVersion)
+                                         ChunkVersion collectionVersion,
+                                         ShardVersionMap shardVersions)
     : _sequenceNumber(nextCMSequenceNumber.addAndFetch(1)),
       _nss(std::move(nss)),
       _uuid(uuid),
@@ -86,8 +109,9 @@ RoutingTableHistory::RoutingTableHistory(NamespaceString nss,
       _defaultCollator(std::move(defaultCollator)),
       _unique(unique),
       _chunkMap(std::move(chunkMap)),
+      _flatChunkIndex(_buildFlatChunkIndex()),
       _collectionVersion(collectionVersion),
-      _shardVersions(_constructShardVersionMap()) {}
+      _shardVersions(std::move(shardVersions)) {}
 
 Chunk ChunkManager::findIntersectingChunk(const BSONObj& shardKey, const BSONObj& collation) const {
     const bool hasSimpleCollation = (collation.isEmpty() && !_rt->getDefaultCollator()) ||
@@ -101,25 +125,50 @@ Chunk ChunkManager::findIntersectingChunk(const BSONObj& shardKey, const BSONObj
         }
     }
 
-    const auto it = _rt->getChunkMap().upper_bound(_rt->_extractKeyString(shardKey));
+    auto chunkInfo = _rt->_findIntersectingChunkInfo(_rt->_extractKeyString(shardKey));
     uassert(ErrorCodes::ShardKeyNotFound,
             str::stream() << "Cannot target single shard using key " << shardKey,
-            it != _rt->getChunkMap().end() && it->second->containsKey(shardKey));
+            chunkInfo && chunkInfo->containsKey(shardKey));
 
-    return Chunk(*(it->second), _clusterTime);
+    return Chunk(*chunkInfo, _clusterTime);
 }
 
 bool ChunkManager::keyBelongsToShard(const BSONObj& shardKey, const ShardId& shardId) const {
     if (shardKey.isEmpty())
         return false;
 
-    const auto it = _rt->getChunkMap().upper_bound(_rt->_extractKeyString(shardKey));
-    if (it == _rt->getChunkMap().end())
+    auto chunkInfo = _rt->_findIntersectingChunkInfo(_rt->_extractKeyString(shardKey));
+    if (!chunkInfo)
         return false;
 
-    invariant(it->second->containsKey(shardKey));
+    invariant(chunkInfo->containsKey(shardKey));
 
-    return it->second->getShardIdAt(_clusterTime) == shardId;
+    return chunkInfo->getShardIdAt(_clusterTime) == shardId;
+}
+
+std::vector<std::string> ChunkManager::getOwnedRangeBoundsForShard(const ShardId& shardId) const {
+    std::vector<std::string> bounds;
+
+    // '_chunkMap' is ordered by chunk max, and the chunks partition the shard key space, so the
+    // owned ranges are visited in ascending order.
+    for (const auto& entry : _rt->getChunkMap()) {
+        const auto& chunkInfo = entry.second;
+        if (chunkInfo->getShardIdAt(_clusterTime) != shardId) {
+            continue;
+        }
+
+        std::string min = _rt->_extractKeyString(chunkInfo->getMin());
+        if (!bounds.empty() && bounds.back() == min) {
+            // This chunk is contiguous with the previous owned range; extend that range instead
+            // of starting a new one, so the boundary list stays strictly increasing.
+            bounds.back() = _rt->_extractKeyString(chunkInfo->getMax());
+        } else {
+            bounds.push_back(std::move(min));
+            bounds.push_back(_rt->_extractKeyString(chunkInfo->getMax()));
+        }
+    }
+
+    return bounds;
 }
 
 void ChunkManager::getShardIdsForQuery(OperationContext* opCtx,
@@ -405,87 +454,27 @@ std::string RoutingTableHistory::toString() const {
     return sb.str();
 }
 
-ShardVersionMap RoutingTableHistory::_constructShardVersionMap() const {
-    const OID& epoch = _collectionVersion.epoch();
-
-    ShardVersionMap shardVersions;
-    ChunkInfoMap::const_iterator current = _chunkMap.cbegin();
-
-    boost::optional<BSONObj> firstMin = boost::none;
-    boost::optional<BSONObj> lastMax = boost::none;
-
-    while (current != _chunkMap.cend()) {
-        const auto& firstChunkInRange = current->second;
-        const auto& currentRangeShardId = firstChunkInRange->getShardIdAt(boost::none);
-
-        // Tracks the max shard version for the shard on which the current range will reside
-        auto shardVersionIt = shardVersions.find(currentRangeShardId);
-        if (shardVersionIt == shardVersions.end()) {
-            shardVersionIt =
-                shardVersions.emplace(currentRangeShardId, ChunkVersion(0, 0, epoch)).first;
-        }
-
-        auto& maxShardVersion = shardVersionIt->second;
-
-        current =
-            std::find_if(current,
-                         _chunkMap.cend(),
-                         [&currentRangeShardId,
-                          &maxShardVersion](const ChunkInfoMap::value_type& chunkMapEntry) {
-                             const auto& currentChunk = chunkMapEntry.second;
-
-                             if (currentChunk->getShardIdAt(boost::none) != currentRangeShardId)
-                                 return true;
-
-                             if (currentChunk->getLastmod() > maxShardVersion)
-                                 maxShardVersion = currentChunk->getLastmod();
-
-                             return false;
-                         });
-
-        const auto rangeLast = std::prev(current);
-
-        const auto& rangeMin = firstChunkInRange->getMin();
-        const auto& rangeMax = rangeLast->second->getMax();
-
-        // Check the continuity of the chunks map
-        if (lastMax && !SimpleBSONObjComparator::kInstance.evaluate(*lastMax == rangeMin)) {
-            if (SimpleBSONObjComparator::kInstance.evaluate(*lastMax < rangeMin))
-                uasserted(ErrorCodes::ConflictingOperationInProgress,
-                          str::stream()
-                              << "Gap exists in the routing table between chunks "
-                              << _chunkMap.at(_extractKeyString(*lastMax))->getRange().toString()
-                              << " and "
-                              << rangeLast->second->getRange().toString());
-            else
-                uasserted(ErrorCodes::ConflictingOperationInProgress,
-                          str::stream()
-                              << "Overlap exists in the routing table between chunks "
-                              << _chunkMap.at(_extractKeyString(*lastMax))->getRange().toString()
-                              << " and "
-                              << rangeLast->second->getRange().toString());
-        }
-
-        if (!firstMin)
-            firstMin = rangeMin;
-
-        lastMax = rangeMax;
-
-        // If a shard has chunks it must have a shard version, otherwise we have an invalid chunk
-        // somewhere, which should have been caught at chunk load time
-        invariant(maxShardVersion.isSet());
-    }
-
-    if (!_chunkMap.empty()) {
-        invariant(!shardVersions.empty());
-        invariant(firstMin.is_initialized());
-        invariant(lastMax.is_initialized());
-
-        checkAllElementsAreOfType(MinKey, firstMin.get());
-        checkAllElementsAreOfType(MaxKey, lastMax.get());
+std::vector<std::pair<StringData, ChunkInfo*>> RoutingTableHistory::_buildFlatChunkIndex() const {
+    std::vector<std::pair<StringData, ChunkInfo*>> index;
+    index.reserve(_chunkMap.size());
+    for (const auto& entry : _chunkMap) {
+        index.emplace_back(StringData(entry.first), entry.second.get());
     }
+    return index;
+}
 
-    return shardVersions;
+ChunkInfo* RoutingTableHistory::_findIntersectingChunkInfo(
+    const std::string& shardKeyString) const {
+    // Like ChunkInfoMap, the index is keyed by each chunk's max, so the first entry strictly
+    // greater than the key is the chunk which contains it.
+    auto it = std::upper_bound(
+        _flatChunkIndex.begin(),
+        _flatChunkIndex.end(),
+        StringData(shardKeyString),
+        [](StringData key, const std::pair<StringData, ChunkInfo*>& entry) {
+            return key < entry.first;
+        });
+    return it == _flatChunkIndex.end() ? nullptr : it->second;
 }
 
 std::string RoutingTableHistory::_extractKeyString(const BSONObj& shardKeyValue) const {
@@ -506,7 +495,8 @@ std::shared_ptr<RoutingTableHistory> RoutingTableHistory::makeNew(
                                std::move(defaultCollator),
                                std::move(unique),
                                {},
-                               {0, 0, epoch})
+                               {0, 0, epoch},
+                               {})
         .makeUpdated(chunks);
 }
 
@@ -515,6 +505,11 @@ std::shared_ptr<RoutingTableHistory> RoutingTableHistory::makeUpdated(
 
     const auto startingCollectionVersion = getVersion();
     auto chunkMap = _chunkMap;
+    auto shardVersions = _shardVersions;
+
+    // The max key strings of the chunks applied below, used to validate the continuity of the
+    // modified neighbourhoods of the map once all the diffs have been applied.
+    std::vector<std::string> appliedChunkKeys;
 
     ChunkVersion collectionVersion = startingCollectionVersion;
     for (const auto& chunk : changedChunks) {
@@ -558,9 +553,9 @@ std::shared_ptr<RoutingTableHistory> RoutingTableHistory::makeUpdated(
         auto newChunk = std::make_shared<ChunkInfo>(chunk);
         if (foundSingleChunk) {
             auto chunkBeingReplacedBySplit = low->second;
-            auto bytesInReplacedChunk =
-                chunkBeingReplacedBySplit->getWritesTracker()->getBytesWritten();
-            newChunk->getWritesTracker()->addBytesWritten(bytesInReplacedChunk);
+            auto replacedChunkTracker = chunkBeingReplacedBySplit->getWritesTracker();
+            newChunk->getWritesTracker()->addBytesWritten(replacedChunkTracker->getBytesWritten(),
+                                                          replacedChunkTracker->getNumWrites());
         }
 
         // Erase all chunks from the map, which overlap the chunk we got from the persistent store
@@ -568,6 +563,54 @@ std::shared_ptr<RoutingTableHistory> RoutingTableHistory::makeUpdated(
 
         // Insert only the chunk itself
         chunkMap.insert(std::make_pair(chunkMaxKeyString, newChunk));
+        appliedChunkKeys.push_back(chunkMaxKeyString);
+
+        // Track the maximum shard version for the shard on which the chunk now resides
+        auto shardVersionIt = shardVersions.find(chunk.getShard());
+        if (shardVersionIt == shardVersions.end() || shardVersionIt->second < chunkVersion) {
+            shardVersions[chunk.getShard()] = chunkVersion;
+        }
+    }
+
+    // Only the neighbourhoods of the chunks which were just (re)inserted can contain new gaps or
+    // overlaps; the rest of the map was validated when it was originally constructed.
+    for (const auto& maxKeyString : appliedChunkKeys) {
+        auto it = chunkMap.find(maxKeyString);
+        if (it == chunkMap.end()) {
+            // This chunk was superseded by a later entry of the changed chunks list.
+            continue;
+        }
+
+        const auto& chunk = it->second;
+        if (it == chunkMap.begin()) {
+            checkAllElementsAreOfType(MinKey, chunk->getMin());
+        } else {
+            checkChunkContinuity(*std::prev(it)->second, *chunk);
+        }
+
+        const auto next = std::next(it);
+        if (next == chunkMap.end()) {
+            checkAllElementsAreOfType(MaxKey, chunk->getMax());
+        } else {
+            checkChunkContinuity(*chunk, *next->second);
+        }
+    }
+
+    // Migrations can drain a shard entirely, and a shard without chunks must not retain an entry
+    // in the shard version map, so establish which shards still own chunks.
+    if (!appliedChunkKeys.empty()) {
+        std::set<ShardId> shardsWithChunks;
+        for (const auto& entry : chunkMap) {
+            shardsWithChunks.insert(entry.second->getShardIdAt(boost::none));
+        }
+
+        for (auto it = shardVersions.begin(); it != shardVersions.end();) {
+            if (!shardsWithChunks.count(it->first)) {
+                shardVersions.erase(it++);
+            } else {
+                ++it;
+            }
+        }
     }
 
     // If at least one diff was applied, the metadata is correct, but it might not have changed so
@@ -588,7 +631,8 @@ std::shared_ptr<RoutingTableHistory> RoutingTableHistory::makeUpdated(
                                 CollatorInterface::cloneCollator(getDefaultCollator()),
                                 isUnique(),
                                 std::move(chunkMap),
-                                collectionVersion));
+                                collectionVersion,
+                                std::move(shardVersions)));
 }
 
 }  // namespace mongo
@@ -158,12 +158,20 @@ private:
                         std::unique_ptr<CollatorInterface> defaultCollator,
                         bool unique,
                         ChunkInfoMap chunkMap,
-                        ChunkVersion collectionVersion);
+                        ChunkVersion collectionVersion,
+                        ShardVersionMap shardVersions);
 
     /**
-     * Does a single pass over the chunkMap and constructs the ShardVersionMap object.
+     * Builds the flat sorted index over '_chunkMap' used by _findIntersectingChunkInfo().
      */
-    ShardVersionMap _constructShardVersionMap() const;
+    std::vector<std::pair<StringData, ChunkInfo*>> _buildFlatChunkIndex() const;
+
+    /**
+     * Returns the chunk containing the key encoded by 'shardKeyString', or nullptr if the key is
+     * past the end of the routing table. Binary-searches the flat chunk index, so routing lookups
+     * do not have to chase '_chunkMap' tree nodes.
+     */
+    ChunkInfo* _findIntersectingChunkInfo(const std::string& shardKeyString) const;
 
     std::string _extractKeyString(const BSONObj& shardKeyValue) const;
 
@@ -192,6 +200,11 @@ private:
     // ranges must cover the complete space from [MinKey, MaxKey).
     const ChunkInfoMap _chunkMap;
 
+    // Flat sorted view over '_chunkMap', in one contiguous allocation so that per-operation
+    // routing lookups are a cache-friendly binary search rather than a tree walk. The entries
+    // reference the keys and values owned by '_chunkMap', which never changes after construction.
+    const std::vector<std::pair<StringData, ChunkInfo*>> _flatChunkIndex;
+
     // Max version across all chunks
     const ChunkVersion _collectionVersion;
 
@@ -304,6 +317,23 @@ public:
      */
     bool keyBelongsToShard(const BSONObj& shardKey, const ShardId& shardId) const;
 
+    /**
+     * Returns the KeyString-encoded boundaries of the ranges owned by "shardId" in this routing
+     * table, alternating range start and range end, with contiguous chunks merged into a single
+     * range. The boundaries are strictly increasing, so a key is owned if and only if an odd
+     * number of boundaries sorts at or before it. Used by CollectionMetadata to compile the
+     * per-shard ownership filter consulted for every document during orphan filtering.
+     */
+    std::vector<std::string> getOwnedRangeBoundsForShard(const ShardId& shardId) const;
+
+    /**
+     * Encodes "shardKey" into the KeyString domain of the boundaries returned by
+     * getOwnedRangeBoundsForShard(), so ownership tests are plain byte comparisons.
+     */
+    std::string extractShardKeyString(const BSONObj& shardKey) const {
+        return _rt->_extractKeyString(shardKey);
+    }
+
     /**
      * Returns true if any chunk owned by the shard with the given "shardId" overlaps "range".
      */
@@ -45,10 +45,13 @@ public:
     static constexpr uint64_t kSplitTestFactor = 5;
 
     /**
-     * Add more bytes written to the chunk.
+     * Add more bytes written to the chunk. 'numWrites' is the number of write operations the
+     * bytes came from; callers transferring previously-tracked bytes between trackers pass zero
+     * so that the operation is not double counted.
      */
-    void addBytesWritten(uint64_t bytesWritten) {
+    void addBytesWritten(uint64_t bytesWritten, uint64_t numWrites = 1) {
         _bytesWritten.fetchAndAdd(bytesWritten);
+        _numWrites.fetchAndAdd(numWrites);
     }
 
     /**
@@ -58,6 +61,14 @@ public:
         return _bytesWritten.loadRelaxed();
     }
 
+    /**
+     * Returns the total number of write operations observed for the chunk. Unlike the byte
+     * count, this is never cleared, so monitoring can derive a write rate by sampling it.
+     */
+    uint64_t getNumWrites() {
+        return _numWrites.loadRelaxed();
+    }
+
     /**
      * Sets the number of bytes in the tracker to zero and returns the number
      * of bytes in the tracker prior to clearing it.
@@ -88,6 +99,12 @@ private:
      */
     AtomicWord<unsigned long long> _bytesWritten{0};
 
+    /**
+     * The number of write operations that have been observed for this chunk. May be modified
+     * concurrently by several threads.
+     */
+    AtomicWord<unsigned long long> _numWrites{0};
+
     /**
      * Protects _splitState when starting a split.
      */
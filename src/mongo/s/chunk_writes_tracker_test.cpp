@@ -50,6 +50,28 @@ TEST(ChunkWritesTrackerTest, AddBytesWrittenCorrectlyAddsBytes) {
     ASSERT_EQ(wt.getBytesWritten(), bytesToAdd);
 }
 
+TEST(ChunkWritesTrackerTest, AddBytesWrittenCountsOneWriteByDefault) {
+    ChunkWritesTracker wt;
+    wt.addBytesWritten(4ull);
+    wt.addBytesWritten(8ull);
+    ASSERT_EQ(wt.getNumWrites(), 2ull);
+}
+
+TEST(ChunkWritesTrackerTest, AddBytesWrittenWithExplicitNumWritesCountsThatManyWrites) {
+    ChunkWritesTracker wt;
+    wt.addBytesWritten(4ull, 0);
+    ASSERT_EQ(wt.getNumWrites(), 0ull);
+    wt.addBytesWritten(8ull, 3);
+    ASSERT_EQ(wt.getNumWrites(), 3ull);
+}
+
+TEST(ChunkWritesTrackerTest, ClearBytesWrittenDoesNotClearNumWrites) {
+    ChunkWritesTracker wt;
+    wt.addBytesWritten(4ull);
+    wt.clearBytesWritten();
+    ASSERT_EQ(wt.getNumWrites(), 1ull);
+}
+
 TEST(ChunkWritesTrackerTest, ClearBytesWrittenSetsBytesToZero) {
     ChunkWritesTracker wt;
     wt.addBytesWritten(4ull);
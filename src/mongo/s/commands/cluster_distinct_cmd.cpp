@@ -32,7 +32,7 @@
 
 #include "mongo/platform/basic.h"
 
-#include "mongo/bson/bsonobj_comparator.h"
+#include "mongo/bson/bsonelement_comparator.h"
 #include "mongo/db/commands.h"
 #include "mongo/db/query/collation/collator_factory_interface.h"
 #include "mongo/db/query/parsed_distinct.h"
@@ -214,34 +214,33 @@ public:
             return true;
         }
 
-        BSONObjComparator bsonCmp(
-            BSONObj(),
-            BSONObjComparator::FieldNamesMode::kConsider,
+        const BSONElementComparator eltCmp(
+            BSONElementComparator::FieldNamesMode::kIgnore,
             !collation.isEmpty()
                 ? collator.get()
                 : (routingInfo.cm() ? routingInfo.cm()->getDefaultCollator() : nullptr));
-        BSONObjSet all = bsonCmp.makeBSONObjSet();
+        BSONEltSet all = eltCmp.makeBSONEltSet();
 
+        // 'shardResponses' stays alive until the merged array has been appended to the result,
+        // so the deduplicated elements can reference the response buffers in place; this avoids
+        // copying every incoming value (duplicates included) into its own object just to union
+        // the sets.
         for (const auto& response : shardResponses) {
             auto status = response.swResponse.isOK()
                 ? getStatusFromCommandResult(response.swResponse.getValue().data)
                 : response.swResponse.getStatus();
             uassertStatusOK(status);
 
-            BSONObj res = std::move(response.swResponse.getValue().data);
-            BSONObjIterator it(res["values"].embeddedObject());
+            BSONObjIterator it(response.swResponse.getValue().data["values"].embeddedObject());
             while (it.more()) {
-                BSONElement nxt = it.next();
-                BSONObjBuilder temp(32);
-                temp.appendAs(nxt, "");
-                all.insert(temp.obj());
+                all.insert(it.next());
             }
         }
 
         BSONObjBuilder b(32);
         int n = 0;
-        for (auto&& obj : all) {
-            b.appendAs(obj.firstElement(), b.numStr(n++));
+        for (auto&& el : all) {
+            b.appendAs(el, b.numStr(n++));
         }
 
         result.appendArray("values", b.obj());
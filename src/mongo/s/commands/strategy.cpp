@@ -67,6 +67,7 @@
 #include "mongo/rpc/metadata/tracking_metadata.h"
 #include "mongo/rpc/op_msg.h"
 #include "mongo/rpc/op_msg_rpc_impls.h"
+#include "mongo/rpc/reply_buffer_size_hint.h"
 #include "mongo/s/cannot_implicitly_create_collection_info.h"
 #include "mongo/s/catalog_cache.h"
 #include "mongo/s/client/parallel.h"
@@ -213,7 +214,8 @@ void execCommandClient(OperationContext* opCtx,
             str::stream() << "Invalid database name: '" << dbname << "'",
             NamespaceString::validDBName(dbname, NamespaceString::DollarInDbNameBehavior::Allow));
 
-    StringMap<int> topLevelFields;
+    CommandHelpers::uassertNoDuplicateFields(request.body);
+
     for (auto&& element : request.body) {
         StringData fieldName = element.fieldNameStringData();
         if (fieldName == "help" && element.type() == Bool && element.Bool()) {
@@ -224,11 +226,6 @@ void execCommandClient(OperationContext* opCtx,
             CommandHelpers::appendSimpleCommandStatus(body, true, "");
             return;
         }
-
-        uassert(ErrorCodes::FailedToParse,
-                str::stream() << "Parsed command object contains duplicate top level key: "
-                              << fieldName,
-                topLevelFields[fieldName]++ == 0);
     }
 
     try {
@@ -658,6 +655,13 @@ DbResponse Strategy::queryOp(OperationContext* opCtx, const NamespaceString& nss
 
 DbResponse Strategy::clientCommand(OperationContext* opCtx, const Message& m) {
     auto reply = rpc::makeReplyBuilder(rpc::protocolForMessage(m));
+
+    // Start the reply buffer at the capacity this session's previous replies needed, avoiding
+    // the doubling reallocations of growing it from scratch on every response.
+    if (auto session = opCtx->getClient()->session()) {
+        reply->reserveBytes(rpc::ReplyBufferSizeHint::get(session).recommended());
+    }
+
     BSONObjBuilder errorBuilder;
 
     bool propagateException = false;
@@ -40,6 +40,7 @@
 #include "mongo/db/query/cursor_response.h"
 #include "mongo/db/query/getmore_request.h"
 #include "mongo/db/query/killcursors_request.h"
+#include "mongo/db/server_parameters.h"
 #include "mongo/executor/remote_command_request.h"
 #include "mongo/executor/remote_command_response.h"
 #include "mongo/util/assert_util.h"
@@ -50,6 +51,15 @@ namespace mongo {
 constexpr StringData AsyncResultsMerger::kSortKeyField;
 const BSONObj AsyncResultsMerger::kWholeSortKeySortPattern = BSON(kSortKeyField << 1);
 
+MONGO_EXPORT_SERVER_PARAMETER(internalQueryAsyncResultsMergerReadaheadWatermark, int, 1)
+    ->withValidator([](const int& newVal) {
+        if (newVal < 1) {
+            return Status(ErrorCodes::BadValue,
+                          "internalQueryAsyncResultsMergerReadaheadWatermark must be >= 1");
+        }
+        return Status::OK();
+    });
+
 namespace {
 
 // Maximum number of retries for network and replication notMaster errors (per host).
@@ -92,8 +102,7 @@ AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
       // since that is not supported we treat boost::none (unspecified) to mean 'kNormal'.
       _tailableMode(params.getTailableMode().value_or(TailableModeEnum::kNormal)),
       _params(std::move(params)),
-      _mergeQueue(MergingComparator(
-          _remotes, _params.getSort().value_or(BSONObj()), _params.getCompareWholeSortKey())),
+      _mergeQueue(MergingComparator(_remotes, _params.getSort().value_or(BSONObj()))),
       _promisedMinSortKeys(PromisedMinSortKeyComparator(_params.getSort().value_or(BSONObj()))) {
     if (params.getTxnNumber()) {
         invariant(params.getSessionId());
@@ -248,9 +257,7 @@ bool AsyncResultsMerger::_readySortedTailable(WithLock lk) {
     }
 
     auto smallestRemote = _mergeQueue.top();
-    auto smallestResult = _remotes[smallestRemote].docBuffer.front();
-    auto keyWeWantToReturn =
-        extractSortKey(*smallestResult.getResult(), _params.getCompareWholeSortKey());
+    auto keyWeWantToReturn = _remotes[smallestRemote].frontSortKey;
     // We should always have a minPromisedSortKey from every shard in the sorted tailable case.
     auto minPromisedSortKey = _getMinPromisedSortKey(lk);
     invariant(!minPromisedSortKey.isEmpty());
@@ -306,7 +313,9 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
     invariant(_remotes[smallestRemote].status.isOK());
 
     ClusterQueryResult front = _remotes[smallestRemote].docBuffer.front();
+    BSONObj frontKey = _remotes[smallestRemote].frontSortKey;
     _remotes[smallestRemote].docBuffer.pop();
+    _remotes[smallestRemote].refreshFrontSortKey(_params.getCompareWholeSortKey());
 
     // Re-populate the merging queue with the next result from 'smallestRemote', if it has a
     // next result.
@@ -316,8 +325,7 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
 
     // For sorted tailable awaitData cursors, update the high water mark to the document's sort key.
     if (_tailableMode == TailableModeEnum::kTailableAndAwaitData) {
-        _highWaterMark =
-            extractSortKey(*front.getResult(), _params.getCompareWholeSortKey()).getOwned();
+        _highWaterMark = frontKey.getOwned();
     }
 
     return front;
@@ -419,6 +427,8 @@ Status AsyncResultsMerger::scheduleGetMores() {
 }
 
 Status AsyncResultsMerger::_scheduleGetMores(WithLock lk) {
+    const auto watermark = _readaheadWatermark(lk);
+
     // Schedule remote work on hosts for which we need more results.
     for (size_t i = 0; i < _remotes.size(); ++i) {
         auto& remote = _remotes[i];
@@ -427,9 +437,11 @@ Status AsyncResultsMerger::_scheduleGetMores(WithLock lk) {
             return remote.status;
         }
 
-        if (!remote.hasNext() && !remote.exhausted() && !remote.cbHandle.isValid()) {
-            // If this remote is not exhausted and there is no outstanding request for it, schedule
-            // work to retrieve the next batch.
+        if (remote.docBuffer.size() < watermark && !remote.exhausted() &&
+            !remote.cbHandle.isValid()) {
+            // If this remote's buffer has dropped below the readahead watermark, it is not
+            // exhausted, and there is no outstanding request for it, schedule work to retrieve the
+            // next batch.
             auto nextBatchStatus = _askForNextBatch(lk, i);
             if (!nextBatchStatus.isOK()) {
                 return nextBatchStatus;
@@ -439,6 +451,16 @@ Status AsyncResultsMerger::_scheduleGetMores(WithLock lk) {
     return Status::OK();
 }
 
+size_t AsyncResultsMerger::_readaheadWatermark(WithLock) const {
+    // Tailable cursors must preserve the remote's batch boundaries, which readahead would coalesce,
+    // so they always fetch on drain.
+    if (_tailableMode != TailableModeEnum::kNormal) {
+        return 1;
+    }
+    const int watermark = internalQueryAsyncResultsMergerReadaheadWatermark.load();
+    return watermark < 1 ? 1 : static_cast<size_t>(watermark);
+}
+
 /*
  * Note: When nextEvent() is called to do retries, only the remotes with retriable errors will
  * be rescheduled because:
@@ -589,9 +611,25 @@ void AsyncResultsMerger::_cleanUpFailedBatch(WithLock lk, Status status, size_t
     if (_params.getAllowPartialResults() || remote.status == ErrorCodes::ExchangePassthrough) {
         remote.status = Status::OK();
 
+        // If a readahead getMore failed while this remote still had buffered results, the remote
+        // is on the merge queue and must be taken off it before its buffer is discarded.
+        if (_params.getSort() && remote.hasNext()) {
+            std::vector<size_t> otherRemotes;
+            while (!_mergeQueue.empty()) {
+                if (_mergeQueue.top() != remoteIndex) {
+                    otherRemotes.push_back(_mergeQueue.top());
+                }
+                _mergeQueue.pop();
+            }
+            for (auto otherIndex : otherRemotes) {
+                _mergeQueue.push(otherIndex);
+            }
+        }
+
         // Clear the results buffer and cursor id.
         std::queue<ClusterQueryResult> emptyBuffer;
         std::swap(remote.docBuffer, emptyBuffer);
+        remote.frontSortKey = BSONObj();
         remote.cursorId = 0;
     }
 }
@@ -632,11 +670,13 @@ void AsyncResultsMerger::_processBatchResults(WithLock lk,
     if (_tailableMode == TailableModeEnum::kTailable && !remote.hasNext()) {
         invariant(_remotes.size() == 1);
         _eofNext = true;
-    } else if (!remote.hasNext() && !remote.exhausted() && _lifecycleState == kAlive && _opCtx) {
-        // If this is normal or tailable-awaitData cursor and we still don't have anything buffered
-        // after receiving this batch, we can schedule work to retrieve the next batch right away.
-        // Be careful only to do this when '_opCtx' is non-null, since it is illegal to schedule a
-        // remote command on a user's behalf without a non-null OperationContext.
+    } else if (remote.docBuffer.size() < _readaheadWatermark(lk) && !remote.exhausted() &&
+               _lifecycleState == kAlive && _opCtx) {
+        // If this is a normal or tailable-awaitData cursor and this remote's buffer is still below
+        // the readahead watermark after receiving this batch, we can schedule work to retrieve the
+        // next batch right away. Be careful only to do this when '_opCtx' is non-null, since it is
+        // illegal to schedule a remote command on a user's behalf without a non-null
+        // OperationContext.
         remote.status = _askForNextBatch(lk, remoteIndex);
     }
 }
@@ -646,6 +686,11 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
                                            const CursorResponse& response) {
     auto& remote = _remotes[remoteIndex];
     _updateRemoteMetadata(lk, remoteIndex, response);
+
+    // With readahead, a batch may arrive while this remote still has buffered results, in which
+    // case the remote is already on the merge queue and its front result is unchanged.
+    const bool hadBufferedResults = remote.hasNext();
+
     for (const auto& obj : response.getBatch()) {
         // If there's a sort, we're expecting the remote node to have given us back a sort key.
         if (_params.getSort()) {
@@ -673,8 +718,12 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
     }
 
     // If we're doing a sorted merge, then we have to make sure to put this remote onto the merge
-    // queue.
-    if (_params.getSort() && !response.getBatch().empty()) {
+    // queue. A remote is on the merge queue if and only if it has buffered results, so we must not
+    // push it a second time if this batch arrived via readahead while results were still buffered.
+    // The remote's front sort key may only change when its buffer was previously empty; it must
+    // stay fixed while the remote is on the merge queue, since the queue orders by it.
+    if (_params.getSort() && !hadBufferedResults && remote.hasNext()) {
+        remote.refreshFrontSortKey(_params.getCompareWholeSortKey());
         _mergeQueue.push(remoteIndex);
     }
     return true;
@@ -782,17 +831,20 @@ bool AsyncResultsMerger::RemoteCursorData::exhausted() const {
     return cursorId == 0;
 }
 
+void AsyncResultsMerger::RemoteCursorData::refreshFrontSortKey(bool compareWholeSortKey) {
+    frontSortKey = docBuffer.empty()
+        ? BSONObj()
+        : extractSortKey(*docBuffer.front().getResult(), compareWholeSortKey);
+}
+
 //
 // AsyncResultsMerger::MergingComparator
 //
 
 bool AsyncResultsMerger::MergingComparator::operator()(const size_t& lhs, const size_t& rhs) {
-    const ClusterQueryResult& leftDoc = _remotes[lhs].docBuffer.front();
-    const ClusterQueryResult& rightDoc = _remotes[rhs].docBuffer.front();
-
-    return compareSortKeys(extractSortKey(*leftDoc.getResult(), _compareWholeSortKey),
-                           extractSortKey(*rightDoc.getResult(), _compareWholeSortKey),
-                           _sort) > 0;
+    // Compare the cached front-of-buffer sort keys, rather than re-extracting the $sortKey field
+    // from the buffered documents on every comparison.
+    return compareSortKeys(_remotes[lhs].frontSortKey, _remotes[rhs].frontSortKey, _sort) > 0;
 }
 
 bool AsyncResultsMerger::PromisedMinSortKeyComparator::operator()(
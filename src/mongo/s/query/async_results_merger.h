@@ -39,6 +39,7 @@
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/cursor_id.h"
 #include "mongo/executor/task_executor.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/s/query/async_results_merger_params_gen.h"
 #include "mongo/s/query/cluster_query_result.h"
 #include "mongo/stdx/mutex.h"
@@ -50,6 +51,11 @@ namespace mongo {
 
 class CursorResponse;
 
+// The number of buffered results per remote below which the AsyncResultsMerger keeps a getMore in
+// flight, so that the next batch is fetched while already-buffered results are being consumed. The
+// default of 1 requests a new batch only once a remote's buffer has fully drained.
+extern AtomicWord<int> internalQueryAsyncResultsMergerReadaheadWatermark;
+
 /**
  * Given a set of cursorIds across one or more shards, the AsyncResultsMerger calls getMore on the
  * cursors to present a single sorted or unsorted stream of documents.
@@ -191,7 +197,7 @@ public:
      * Schedules a getMore on any remote hosts which:
      *  - Do not have an error status set already.
      *  - Don't already have a request outstanding.
-     *  - We don't currently have any results buffered.
+     *  - Have fewer buffered results than the readahead watermark.
      *  - Are not exhausted (have a non-zero cursor id).
      * Returns an error if any of the remotes responded with an error, or if we encounter an error
      * while scheduling the getMore requests..
@@ -269,6 +275,12 @@ private:
          */
         bool exhausted() const;
 
+        /**
+         * Recomputes 'frontSortKey' from the result at the front of 'docBuffer'. Must be called
+         * whenever the front of the buffer changes during a sorted merge.
+         */
+        void refreshFrontSortKey(bool compareWholeSortKey);
+
         // Used when merging tailable awaitData cursors in sorted order. In order to return any
         // result to the client we have to know that no shard will ever return anything that sorts
         // before it. This object represents a promise from the remote that it will never return a
@@ -293,6 +305,12 @@ private:
         // The buffer of results that have been retrieved but not yet returned to the caller.
         std::queue<ClusterQueryResult> docBuffer;
 
+        // The sort key of the result at the front of 'docBuffer', or an empty object if the buffer
+        // is empty. Maintained only during sorted merges, so that each merge queue comparison need
+        // not re-extract the $sortKey field from the buffered documents. Points into the document
+        // at the front of 'docBuffer' and is invalidated when that document is popped.
+        BSONObj frontSortKey;
+
         // Is valid if there is currently a pending request to this remote.
         executor::TaskExecutor::CallbackHandle cbHandle;
 
@@ -307,10 +325,8 @@ private:
 
     class MergingComparator {
     public:
-        MergingComparator(const std::vector<RemoteCursorData>& remotes,
-                          const BSONObj& sort,
-                          bool compareWholeSortKey)
-            : _remotes(remotes), _sort(sort), _compareWholeSortKey(compareWholeSortKey) {}
+        MergingComparator(const std::vector<RemoteCursorData>& remotes, const BSONObj& sort)
+            : _remotes(remotes), _sort(sort) {}
 
         bool operator()(const size_t& lhs, const size_t& rhs);
 
@@ -318,11 +334,6 @@ private:
         const std::vector<RemoteCursorData>& _remotes;
 
         const BSONObj _sort;
-
-        // When '_compareWholeSortKey' is true, $sortKey is a scalar value, rather than an object.
-        // We extract the sort key {$sortKey: <value>}. The sort key pattern '_sort' is verified to
-        // be {$sortKey: 1}.
-        const bool _compareWholeSortKey;
     };
 
     using MinSortKeyRemoteIdPair = std::pair<BSONObj, size_t>;
@@ -436,6 +447,12 @@ private:
      */
     Status _scheduleGetMores(WithLock);
 
+    /**
+     * Returns the number of buffered results per remote below which we keep a getMore in flight.
+     * Tailable cursors must preserve remote batch boundaries, so they never read ahead.
+     */
+    size_t _readaheadWatermark(WithLock) const;
+
     /**
      * Schedules a killCursors command to be run on all remote hosts that have open cursors.
      */
@@ -2008,5 +2008,97 @@ TEST_F(AsyncResultsMergerTest, ShouldNotScheduleGetMoresWithoutAnOperationContex
     executor()->waitForEvent(killedEvent);
 }
 
+TEST_F(AsyncResultsMergerTest, DoesNotScheduleGetMoreWithResultsBufferedByDefault) {
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(makeRemoteCursor(
+        kTestShardIds[0],
+        kTestShardHosts[0],
+        CursorResponse(kTestNss, CursorId(123), {fromjson("{_id: 1}")})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors));
+
+    // With the default watermark of 1, no getMore may be issued while a result is buffered.
+    ASSERT_TRUE(arm->ready());
+    ASSERT_OK(arm->scheduleGetMores());
+    ASSERT_FALSE(networkHasReadyRequests());
+
+    auto killedEvent = arm->kill(operationContext());
+    executor()->waitForEvent(killedEvent);
+}
+
+TEST_F(AsyncResultsMergerTest, ReadaheadSchedulesGetMoreWhileResultsAreStillBuffered) {
+    auto oldWatermark = internalQueryAsyncResultsMergerReadaheadWatermark.swap(2);
+
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(makeRemoteCursor(
+        kTestShardIds[0],
+        kTestShardHosts[0],
+        CursorResponse(kTestNss, CursorId(123), {fromjson("{_id: 1}")})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors));
+
+    // A result is buffered, so the merger is ready, but the buffer is below the watermark and a
+    // readahead getMore should be issued.
+    ASSERT_TRUE(arm->ready());
+    ASSERT_OK(arm->scheduleGetMores());
+    ASSERT_TRUE(networkHasReadyRequests());
+
+    // The buffered result can be returned while the readahead request is in flight.
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 1}"), *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_FALSE(arm->ready());
+
+    // Deliver the readahead batch, exhausting the remote.
+    std::vector<CursorResponse> responses;
+    std::vector<BSONObj> batch = {fromjson("{_id: 2}")};
+    responses.emplace_back(kTestNss, CursorId(0), batch);
+    scheduleNetworkResponses(std::move(responses));
+
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 2}"), *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_TRUE(arm->ready());
+    ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
+
+    internalQueryAsyncResultsMergerReadaheadWatermark.store(oldWatermark);
+}
+
+TEST_F(AsyncResultsMergerTest, ReadaheadBatchArrivingWithResultsStillBufferedMergesInOrder) {
+    auto oldWatermark = internalQueryAsyncResultsMergerReadaheadWatermark.swap(2);
+
+    BSONObj findCmd = fromjson("{find: 'testcoll', sort: {_id: 1}}");
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(makeRemoteCursor(
+        kTestShardIds[0],
+        kTestShardHosts[0],
+        CursorResponse(kTestNss, CursorId(5), {fromjson("{$sortKey: {'': 3}}")})));
+    cursors.push_back(makeRemoteCursor(
+        kTestShardIds[1],
+        kTestShardHosts[1],
+        CursorResponse(kTestNss, CursorId(6), {fromjson("{$sortKey: {'': 4}}")})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors), findCmd);
+
+    // Every remote has a buffered result, so the merger is ready, but both buffers are below the
+    // watermark and readahead getMores should be issued.
+    ASSERT_TRUE(arm->ready());
+    ASSERT_OK(arm->scheduleGetMores());
+
+    // Deliver the readahead batches while the initial results are still buffered. The new results
+    // must not disturb the position of the remotes already on the merge queue.
+    std::vector<CursorResponse> responses;
+    std::vector<BSONObj> batch1 = {fromjson("{$sortKey: {'': 5}}")};
+    responses.emplace_back(kTestNss, CursorId(0), batch1);
+    std::vector<BSONObj> batch2 = {fromjson("{$sortKey: {'': 6}}")};
+    responses.emplace_back(kTestNss, CursorId(0), batch2);
+    scheduleNetworkResponses(std::move(responses));
+
+    // All four results are returned in sort order.
+    for (int expected = 3; expected <= 6; ++expected) {
+        ASSERT_TRUE(arm->ready());
+        ASSERT_BSONOBJ_EQ(BSON("$sortKey" << BSON("" << expected)),
+                          *unittest::assertGet(arm->nextReady()).getResult());
+    }
+    ASSERT_TRUE(arm->ready());
+    ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
+
+    internalQueryAsyncResultsMergerReadaheadWatermark.store(oldWatermark);
+}
+
 }  // namespace
 }  // namespace mongo
@@ -238,22 +238,19 @@ boost::optional<TxnNumber> ClusterCursorManager::PinnedCursor::getTxnNumber() co
     return _cursor->getTxnNumber();
 }
 
-ClusterCursorManager::ClusterCursorManager(ClockSource* clockSource)
-    : _clockSource(clockSource),
-      _pseudoRandom(std::unique_ptr<SecureRandom>(SecureRandom::create())->nextInt64()) {
+ClusterCursorManager::ClusterCursorManager(ClockSource* clockSource) : _clockSource(clockSource) {
     invariant(_clockSource);
 }
 
 ClusterCursorManager::~ClusterCursorManager() {
+    for (auto&& partition : _partitions) {
+        invariant(partition.nssToContainerMap.empty());
+    }
     invariant(_cursorIdPrefixToNamespaceMap.empty());
-    invariant(_namespaceToContainerMap.empty());
 }
 
 void ClusterCursorManager::shutdown(OperationContext* opCtx) {
-    {
-        stdx::lock_guard<stdx::mutex> lk(_mutex);
-        _inShutdown = true;
-    }
+    _inShutdown.store(true);
     killAllCursors(opCtx);
 }
 
@@ -267,9 +264,10 @@ StatusWith<CursorId> ClusterCursorManager::registerCursor(
     // Read the clock out of the lock.
     const auto now = _clockSource->now();
 
-    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    auto& partition = _partition(nss);
+    stdx::unique_lock<stdx::mutex> lk(partition.mutex);
 
-    if (_inShutdown) {
+    if (_inShutdown.load()) {
         lk.unlock();
         cursor->kill(opCtx);
         return Status(ErrorCodes::ShutdownInProgress,
@@ -280,26 +278,29 @@ StatusWith<CursorId> ClusterCursorManager::registerCursor(
     cursor->setLeftoverMaxTimeMicros(opCtx->getRemainingMaxTimeMicros());
 
     // Find the CursorEntryContainer for this namespace.  If none exists, create one.
-    auto nsToContainerIt = _namespaceToContainerMap.find(nss);
-    if (nsToContainerIt == _namespaceToContainerMap.end()) {
+    auto nsToContainerIt = partition.nssToContainerMap.find(nss);
+    if (nsToContainerIt == partition.nssToContainerMap.end()) {
         uint32_t containerPrefix = 0;
-        do {
-            // The server has always generated positive values for CursorId (which is a signed
-            // type), so we use std::abs() here on the prefix for consistency with this historical
-            // behavior. If the random number generated is INT_MIN, calling std::abs on it is
-            // undefined behavior on 2's complement systems so we need to generate a new number.
-            int32_t randomNumber = 0;
+        {
+            stdx::lock_guard<stdx::mutex> prefixLk(_mutex);
             do {
-                randomNumber = _pseudoRandom.nextInt32();
-            } while (randomNumber == std::numeric_limits<int32_t>::min());
-            containerPrefix = static_cast<uint32_t>(std::abs(randomNumber));
-        } while (_cursorIdPrefixToNamespaceMap.count(containerPrefix) > 0);
-        _cursorIdPrefixToNamespaceMap[containerPrefix] = nss;
+                // The server has always generated positive values for CursorId (which is a signed
+                // type), so we use std::abs() here on the prefix for consistency with this
+                // historical behavior. If the random number generated is INT_MIN, calling std::abs
+                // on it is undefined behavior on 2's complement systems so we need to generate a
+                // new number.
+                int32_t randomNumber = 0;
+                do {
+                    randomNumber = partition.pseudoRandom.nextInt32();
+                } while (randomNumber == std::numeric_limits<int32_t>::min());
+                containerPrefix = static_cast<uint32_t>(std::abs(randomNumber));
+            } while (_cursorIdPrefixToNamespaceMap.count(containerPrefix) > 0);
+            _cursorIdPrefixToNamespaceMap[containerPrefix] = nss;
+        }
 
         auto emplaceResult =
-            _namespaceToContainerMap.emplace(nss, CursorEntryContainer(containerPrefix));
+            partition.nssToContainerMap.emplace(nss, CursorEntryContainer(containerPrefix));
         invariant(emplaceResult.second);
-        invariant(_namespaceToContainerMap.size() == _cursorIdPrefixToNamespaceMap.size());
 
         nsToContainerIt = emplaceResult.first;
     } else {
@@ -311,7 +312,7 @@ StatusWith<CursorId> ClusterCursorManager::registerCursor(
     CursorEntryMap& entryMap = container.entryMap;
     CursorId cursorId = 0;
     do {
-        const uint32_t cursorSuffix = static_cast<uint32_t>(_pseudoRandom.nextInt32());
+        const uint32_t cursorSuffix = static_cast<uint32_t>(partition.pseudoRandom.nextInt32());
         cursorId = createCursorId(container.containerPrefix, cursorSuffix);
     } while (cursorId == 0 || entryMap.count(cursorId) > 0);
 
@@ -330,49 +331,66 @@ StatusWith<ClusterCursorManager::PinnedCursor> ClusterCursorManager::checkOutCur
     OperationContext* opCtx,
     AuthzCheckFn authChecker,
     AuthCheck checkSessionAuth) {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    auto& partition = _partition(nss);
+
+    // The partition lock is held only for the lookup and the transition to in-use; the checks
+    // below run against the released cursor. While the entry is marked as in use it cannot be
+    // destroyed (killers interrupt the using operation instead), so the heavier auth and session
+    // work doesn't serialize concurrent getMores on the partition.
+    std::unique_ptr<ClusterClientCursor> cursor;
+    CursorEntry* entry = nullptr;
+    {
+        stdx::lock_guard<stdx::mutex> lk(partition.mutex);
 
-    if (_inShutdown) {
-        return Status(ErrorCodes::ShutdownInProgress,
-                      "Cannot check out cursor as we are in the process of shutting down");
-    }
+        if (_inShutdown.load()) {
+            return Status(ErrorCodes::ShutdownInProgress,
+                          "Cannot check out cursor as we are in the process of shutting down");
+        }
 
-    CursorEntry* entry = _getEntry(lk, nss, cursorId);
-    if (!entry) {
-        return cursorNotFoundStatus(nss, cursorId);
+        entry = _getEntry(lk, partition, nss, cursorId);
+        if (!entry) {
+            return cursorNotFoundStatus(nss, cursorId);
+        }
+
+        if (entry->getOperationUsingCursor()) {
+            return cursorInUseStatus(nss, cursorId);
+        }
+
+        cursor = entry->releaseCursor(opCtx);
     }
 
-    // Check if the user is coauthorized to access this cursor.
+    // On any failure the cursor must be handed back so the entry returns to idle; a kill that
+    // raced with this failed checkout is then handled by the normal check-in path. This also
+    // closes the early-return hazard previously tracked as SERVER-31138.
+    auto failCheckOut = [&](Status status) -> StatusWith<PinnedCursor> {
+        cursor->reattachToOperationContext(opCtx);
+        checkInCursor(std::move(cursor), nss, cursorId, CursorState::NotExhausted);
+        return status;
+    };
+
+    // Check if the user is coauthorized to access this cursor. The authenticated user container
+    // is immutable after the entry is created, so reading it without the partition lock is safe.
     auto authCheckStatus = authChecker(entry->getAuthenticatedUsers());
     if (!authCheckStatus.isOK()) {
-        return authCheckStatus.withContext(
+        return failCheckOut(authCheckStatus.withContext(
             str::stream() << "cursor id " << cursorId
-                          << " was not created by the authenticated user");
+                          << " was not created by the authenticated user"));
     }
 
     if (checkSessionAuth == kCheckSession) {
-        const auto cursorPrivilegeStatus = checkCursorSessionPrivilege(opCtx, entry->getLsid());
+        auto cursorPrivilegeStatus = checkCursorSessionPrivilege(opCtx, cursor->getLsid());
         if (!cursorPrivilegeStatus.isOK()) {
-            return cursorPrivilegeStatus;
+            return failCheckOut(cursorPrivilegeStatus);
         }
     }
 
-    if (entry->getOperationUsingCursor()) {
-        return cursorInUseStatus(nss, cursorId);
-    }
-
-    // Note: due to SERVER-31138, despite putting this in a unique_ptr, it's actually not safe to
-    // return before the end of this function. Be careful to avoid any early returns/throws after
-    // this point.
-    auto cursor = entry->releaseCursor(opCtx);
-
     // We use pinning of a cursor as a proxy for active, user-initiated use of a cursor.  Therefore,
     // we pass down to the logical session cache and vivify the record (updating last use).
     if (cursor->getLsid()) {
         auto vivifyCursorStatus =
             LogicalSessionCache::get(opCtx)->vivify(opCtx, cursor->getLsid().get());
         if (!vivifyCursorStatus.isOK()) {
-            return vivifyCursorStatus;
+            return failCheckOut(vivifyCursorStatus);
         }
     }
     cursor->reattachToOperationContext(opCtx);
@@ -393,13 +411,16 @@ void ClusterCursorManager::checkInCursor(std::unique_ptr<ClusterClientCursor> cu
     cursor->detachFromOperationContext();
     cursor->setLastUseDate(now);
 
-    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    // killPending will be true if killCursor() was called while the cursor was in use. This
+    // inspects our own operation's interrupt state, so evaluate it before taking the partition
+    // lock rather than under it.
+    const bool killPending = !opCtx->checkForInterruptNoAssert().isOK();
 
-    CursorEntry* entry = _getEntry(lk, nss, cursorId);
-    invariant(entry);
+    auto& partition = _partition(nss);
+    stdx::unique_lock<stdx::mutex> lk(partition.mutex);
 
-    // killPending will be true if killCursor() was called while the cursor was in use.
-    const bool killPending = entry->isKillPending();
+    CursorEntry* entry = _getEntry(lk, partition, nss, cursorId);
+    invariant(entry);
 
     entry->setLastActive(now);
     entry->returnCursor(std::move(cursor));
@@ -411,15 +432,16 @@ void ClusterCursorManager::checkInCursor(std::unique_ptr<ClusterClientCursor> cu
 
     // After detaching the cursor, the entry will be destroyed.
     entry = nullptr;
-    detachAndKillCursor(std::move(lk), opCtx, nss, cursorId);
+    detachAndKillCursor(std::move(lk), partition, opCtx, nss, cursorId);
 }
 
 Status ClusterCursorManager::checkAuthForKillCursors(OperationContext* opCtx,
                                                      const NamespaceString& nss,
                                                      CursorId cursorId,
                                                      AuthzCheckFn authChecker) {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-    auto entry = _getEntry(lk, nss, cursorId);
+    auto& partition = _partition(nss);
+    stdx::lock_guard<stdx::mutex> lk(partition.mutex);
+    auto entry = _getEntry(lk, partition, nss, cursorId);
 
     if (!entry) {
         return cursorNotFoundStatus(nss, cursorId);
@@ -446,9 +468,10 @@ Status ClusterCursorManager::killCursor(OperationContext* opCtx,
                                         CursorId cursorId) {
     invariant(opCtx);
 
-    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    auto& partition = _partition(nss);
+    stdx::unique_lock<stdx::mutex> lk(partition.mutex);
 
-    CursorEntry* entry = _getEntry(lk, nss, cursorId);
+    CursorEntry* entry = _getEntry(lk, partition, nss, cursorId);
     if (!entry) {
         return cursorNotFoundStatus(nss, cursorId);
     }
@@ -463,7 +486,7 @@ Status ClusterCursorManager::killCursor(OperationContext* opCtx,
     }
 
     // No one is using the cursor, so we destroy it.
-    detachAndKillCursor(std::move(lk), opCtx, nss, cursorId);
+    detachAndKillCursor(std::move(lk), partition, opCtx, nss, cursorId);
 
     // We no longer hold the lock here.
 
@@ -471,10 +494,11 @@ Status ClusterCursorManager::killCursor(OperationContext* opCtx,
 }
 
 void ClusterCursorManager::detachAndKillCursor(stdx::unique_lock<stdx::mutex> lk,
+                                               Partition& partition,
                                                OperationContext* opCtx,
                                                const NamespaceString& nss,
                                                CursorId cursorId) {
-    auto detachedCursor = _detachCursor(lk, nss, cursorId);
+    auto detachedCursor = _detachCursor(lk, partition, nss, cursorId);
     invariant(detachedCursor.getStatus());
 
     // Deletion of the cursor can happen out of the lock.
@@ -485,8 +509,6 @@ void ClusterCursorManager::detachAndKillCursor(stdx::unique_lock<stdx::mutex> lk
 
 std::size_t ClusterCursorManager::killMortalCursorsInactiveSince(OperationContext* opCtx,
                                                                  Date_t cutoff) {
-    stdx::unique_lock<stdx::mutex> lk(_mutex);
-
     auto pred = [cutoff](CursorId cursorId, const CursorEntry& entry) -> bool {
         bool res = entry.getLifetimeType() == CursorLifetime::Mortal &&
             !entry.getOperationUsingCursor() && entry.getLastActive() <= cutoff;
@@ -499,97 +521,99 @@ std::size_t ClusterCursorManager::killMortalCursorsInactiveSince(OperationContex
         return res;
     };
 
-    return killCursorsSatisfying(std::move(lk), opCtx, std::move(pred));
+    return killCursorsSatisfying(opCtx, std::move(pred));
 }
 
 void ClusterCursorManager::killAllCursors(OperationContext* opCtx) {
-    stdx::unique_lock<stdx::mutex> lk(_mutex);
     auto pred = [](CursorId, const CursorEntry&) -> bool { return true; };
 
-    killCursorsSatisfying(std::move(lk), opCtx, std::move(pred));
+    killCursorsSatisfying(opCtx, std::move(pred));
 }
 
 std::size_t ClusterCursorManager::killCursorsSatisfying(
-    stdx::unique_lock<stdx::mutex> lk,
-    OperationContext* opCtx,
-    std::function<bool(CursorId, const CursorEntry&)> pred) {
+    OperationContext* opCtx, std::function<bool(CursorId, const CursorEntry&)> pred) {
     invariant(opCtx);
-    invariant(lk.owns_lock());
     std::size_t nKilled = 0;
 
-    std::vector<std::unique_ptr<ClusterClientCursor>> cursorsToDestroy;
-    auto nsContainerIt = _namespaceToContainerMap.begin();
-    while (nsContainerIt != _namespaceToContainerMap.end()) {
-        auto&& entryMap = nsContainerIt->second.entryMap;
-        auto cursorIdEntryIt = entryMap.begin();
-        while (cursorIdEntryIt != entryMap.end()) {
-            auto cursorId = cursorIdEntryIt->first;
-            auto& entry = cursorIdEntryIt->second;
-
-            if (!pred(cursorId, entry)) {
-                ++cursorIdEntryIt;
-                continue;
-            }
+    for (auto&& partition : _partitions) {
+        std::vector<std::unique_ptr<ClusterClientCursor>> cursorsToDestroy;
 
-            ++nKilled;
+        stdx::unique_lock<stdx::mutex> lk(partition.mutex);
+        auto nsContainerIt = partition.nssToContainerMap.begin();
+        while (nsContainerIt != partition.nssToContainerMap.end()) {
+            auto&& entryMap = nsContainerIt->second.entryMap;
+            auto cursorIdEntryIt = entryMap.begin();
+            while (cursorIdEntryIt != entryMap.end()) {
+                auto cursorId = cursorIdEntryIt->first;
+                auto& entry = cursorIdEntryIt->second;
 
-            if (entry.getOperationUsingCursor()) {
-                // Mark the OperationContext using the cursor as killed, and move on.
-                killOperationUsingCursor(lk, &entry);
-                ++cursorIdEntryIt;
-                continue;
-            }
+                if (!pred(cursorId, entry)) {
+                    ++cursorIdEntryIt;
+                    continue;
+                }
 
-            cursorsToDestroy.push_back(entry.releaseCursor(nullptr));
+                ++nKilled;
 
-            // Destroy the entry and set the iterator to the next element.
-            entryMap.erase(cursorIdEntryIt++);
-        }
+                if (entry.getOperationUsingCursor()) {
+                    // Mark the OperationContext using the cursor as killed, and move on.
+                    killOperationUsingCursor(lk, &entry);
+                    ++cursorIdEntryIt;
+                    continue;
+                }
 
-        if (entryMap.empty()) {
-            nsContainerIt = eraseContainer(nsContainerIt);
-        } else {
-            ++nsContainerIt;
+                cursorsToDestroy.push_back(entry.releaseCursor(nullptr));
+
+                // Destroy the entry and set the iterator to the next element.
+                entryMap.erase(cursorIdEntryIt++);
+            }
+
+            if (entryMap.empty()) {
+                nsContainerIt = eraseContainer(partition, nsContainerIt);
+            } else {
+                ++nsContainerIt;
+            }
         }
-    }
 
-    // Call kill() outside of the lock, as it may require waiting for callbacks to finish.
-    lk.unlock();
+        // Call kill() outside of the partition lock, as it may require waiting for callbacks to
+        // finish.
+        lk.unlock();
 
-    for (auto&& cursor : cursorsToDestroy) {
-        invariant(cursor.get());
-        cursor->kill(opCtx);
+        for (auto&& cursor : cursorsToDestroy) {
+            invariant(cursor.get());
+            cursor->kill(opCtx);
+        }
     }
 
     return nKilled;
 }
 
 ClusterCursorManager::Stats ClusterCursorManager::stats() const {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-
     Stats stats;
 
-    for (auto& nsContainerPair : _namespaceToContainerMap) {
-        for (auto& cursorIdEntryPair : nsContainerPair.second.entryMap) {
-            const CursorEntry& entry = cursorIdEntryPair.second;
-
-            if (entry.isKillPending()) {
-                // Killed cursors do not count towards the number of pinned cursors or the number of
-                // open cursors.
-                continue;
-            }
-
-            if (entry.getOperationUsingCursor()) {
-                ++stats.cursorsPinned;
-            }
-
-            switch (entry.getCursorType()) {
-                case CursorType::SingleTarget:
-                    ++stats.cursorsSingleTarget;
-                    break;
-                case CursorType::MultiTarget:
-                    ++stats.cursorsMultiTarget;
-                    break;
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lk(partition.mutex);
+        for (auto& nsContainerPair : partition.nssToContainerMap) {
+            for (auto& cursorIdEntryPair : nsContainerPair.second.entryMap) {
+                const CursorEntry& entry = cursorIdEntryPair.second;
+
+                if (entry.isKillPending()) {
+                    // Killed cursors do not count towards the number of pinned cursors or the
+                    // number of open cursors.
+                    continue;
+                }
+
+                if (entry.getOperationUsingCursor()) {
+                    ++stats.cursorsPinned;
+                }
+
+                switch (entry.getCursorType()) {
+                    case CursorType::SingleTarget:
+                        ++stats.cursorsSingleTarget;
+                        break;
+                    case CursorType::MultiTarget:
+                        ++stats.cursorsMultiTarget;
+                        break;
+                }
             }
         }
     }
@@ -598,20 +622,21 @@ ClusterCursorManager::Stats ClusterCursorManager::stats() const {
 }
 
 void ClusterCursorManager::appendActiveSessions(LogicalSessionIdSet* lsids) const {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-
-    for (const auto& nsContainerPair : _namespaceToContainerMap) {
-        for (const auto& cursorIdEntryPair : nsContainerPair.second.entryMap) {
-            const CursorEntry& entry = cursorIdEntryPair.second;
-
-            if (entry.isKillPending()) {
-                // Don't include sessions for killed cursors.
-                continue;
-            }
-
-            auto lsid = entry.getLsid();
-            if (lsid) {
-                lsids->insert(*lsid);
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lk(partition.mutex);
+        for (const auto& nsContainerPair : partition.nssToContainerMap) {
+            for (const auto& cursorIdEntryPair : nsContainerPair.second.entryMap) {
+                const CursorEntry& entry = cursorIdEntryPair.second;
+
+                if (entry.isKillPending()) {
+                    // Don't include sessions for killed cursors.
+                    continue;
+                }
+
+                auto lsid = entry.getLsid();
+                if (lsid) {
+                    lsids->insert(*lsid);
+                }
             }
         }
     }
@@ -639,28 +664,29 @@ std::vector<GenericCursor> ClusterCursorManager::getIdleCursors(
     const OperationContext* opCtx, MongoProcessInterface::CurrentOpUserMode userMode) const {
     std::vector<GenericCursor> cursors;
 
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-
     AuthorizationSession* ctxAuth = AuthorizationSession::get(opCtx->getClient());
 
-    for (const auto& nsContainerPair : _namespaceToContainerMap) {
-        for (const auto& cursorIdEntryPair : nsContainerPair.second.entryMap) {
-
-            const CursorEntry& entry = cursorIdEntryPair.second;
-            // If auth is enabled, and userMode is allUsers, check if the current user has
-            // permission to see this cursor.
-            if (ctxAuth->getAuthorizationManager().isAuthEnabled() &&
-                userMode == MongoProcessInterface::CurrentOpUserMode::kExcludeOthers &&
-                !ctxAuth->isCoauthorizedWith(entry.getAuthenticatedUsers())) {
-                continue;
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lk(partition.mutex);
+        for (const auto& nsContainerPair : partition.nssToContainerMap) {
+            for (const auto& cursorIdEntryPair : nsContainerPair.second.entryMap) {
+
+                const CursorEntry& entry = cursorIdEntryPair.second;
+                // If auth is enabled, and userMode is allUsers, check if the current user has
+                // permission to see this cursor.
+                if (ctxAuth->getAuthorizationManager().isAuthEnabled() &&
+                    userMode == MongoProcessInterface::CurrentOpUserMode::kExcludeOthers &&
+                    !ctxAuth->isCoauthorizedWith(entry.getAuthenticatedUsers())) {
+                    continue;
+                }
+                if (entry.isKillPending() || entry.getOperationUsingCursor()) {
+                    // Don't include sessions for killed or pinned cursors.
+                    continue;
+                }
+
+                cursors.emplace_back(
+                    entry.cursorToGenericCursor(cursorIdEntryPair.first, nsContainerPair.first));
             }
-            if (entry.isKillPending() || entry.getOperationUsingCursor()) {
-                // Don't include sessions for killed or pinned cursors.
-                continue;
-            }
-
-            cursors.emplace_back(
-                entry.cursorToGenericCursor(cursorIdEntryPair.first, nsContainerPair.first));
         }
     }
 
@@ -680,22 +706,23 @@ std::pair<Status, int> ClusterCursorManager::killCursorsWithMatchingSessions(
 
 stdx::unordered_set<CursorId> ClusterCursorManager::getCursorsForSession(
     LogicalSessionId lsid) const {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-
     stdx::unordered_set<CursorId> cursorIds;
 
-    for (auto&& nsContainerPair : _namespaceToContainerMap) {
-        for (auto&& cursorIdEntryPair : nsContainerPair.second.entryMap) {
-            const CursorEntry& entry = cursorIdEntryPair.second;
-
-            if (entry.isKillPending()) {
-                // Don't include sessions for killed cursors.
-                continue;
-            }
-
-            auto cursorLsid = entry.getLsid();
-            if (lsid == cursorLsid) {
-                cursorIds.insert(cursorIdEntryPair.first);
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lk(partition.mutex);
+        for (auto&& nsContainerPair : partition.nssToContainerMap) {
+            for (auto&& cursorIdEntryPair : nsContainerPair.second.entryMap) {
+                const CursorEntry& entry = cursorIdEntryPair.second;
+
+                if (entry.isKillPending()) {
+                    // Don't include sessions for killed cursors.
+                    continue;
+                }
+
+                auto cursorLsid = entry.getLsid();
+                if (lsid == cursorLsid) {
+                    cursorIds.insert(cursorIdEntryPair.first);
+                }
             }
         }
     }
@@ -714,11 +741,13 @@ boost::optional<NamespaceString> ClusterCursorManager::getNamespaceForCursorId(
     return it->second;
 }
 
-auto ClusterCursorManager::_getEntry(WithLock, NamespaceString const& nss, CursorId cursorId)
-    -> CursorEntry* {
+auto ClusterCursorManager::_getEntry(WithLock,
+                                     Partition& partition,
+                                     NamespaceString const& nss,
+                                     CursorId cursorId) -> CursorEntry* {
 
-    auto nsToContainerIt = _namespaceToContainerMap.find(nss);
-    if (nsToContainerIt == _namespaceToContainerMap.end()) {
+    auto nsToContainerIt = partition.nssToContainerMap.find(nss);
+    if (nsToContainerIt == partition.nssToContainerMap.end()) {
         return nullptr;
     }
     CursorEntryMap& entryMap = nsToContainerIt->second.entryMap;
@@ -730,7 +759,8 @@ auto ClusterCursorManager::_getEntry(WithLock, NamespaceString const& nss, Curso
     return &entryMapIt->second;
 }
 
-auto ClusterCursorManager::eraseContainer(NssToCursorContainerMap::iterator it)
+auto ClusterCursorManager::eraseContainer(Partition& partition,
+                                          NssToCursorContainerMap::iterator it)
     -> NssToCursorContainerMap::iterator {
     auto&& container = it->second;
     auto&& entryMap = container.entryMap;
@@ -738,17 +768,19 @@ auto ClusterCursorManager::eraseContainer(NssToCursorContainerMap::iterator it)
 
     // This was the last cursor remaining in the given namespace.  Erase all state associated
     // with this namespace.
-    size_t numDeleted = _cursorIdPrefixToNamespaceMap.erase(container.containerPrefix);
-    invariant(numDeleted == 1);
-    _namespaceToContainerMap.erase(it++);
-    invariant(_namespaceToContainerMap.size() == _cursorIdPrefixToNamespaceMap.size());
+    {
+        stdx::lock_guard<stdx::mutex> prefixLk(_mutex);
+        size_t numDeleted = _cursorIdPrefixToNamespaceMap.erase(container.containerPrefix);
+        invariant(numDeleted == 1);
+    }
+    partition.nssToContainerMap.erase(it++);
     return it;
 }
 
 StatusWith<std::unique_ptr<ClusterClientCursor>> ClusterCursorManager::_detachCursor(
-    WithLock lk, NamespaceString const& nss, CursorId cursorId) {
+    WithLock lk, Partition& partition, NamespaceString const& nss, CursorId cursorId) {
 
-    CursorEntry* entry = _getEntry(lk, nss, cursorId);
+    CursorEntry* entry = _getEntry(lk, partition, nss, cursorId);
     if (!entry) {
         return cursorNotFoundStatus(nss, cursorId);
     }
@@ -761,13 +793,13 @@ StatusWith<std::unique_ptr<ClusterClientCursor>> ClusterCursorManager::_detachCu
     std::unique_ptr<ClusterClientCursor> cursor = entry->releaseCursor(nullptr);
 
     // Destroy the entry.
-    auto nsToContainerIt = _namespaceToContainerMap.find(nss);
-    invariant(nsToContainerIt != _namespaceToContainerMap.end());
+    auto nsToContainerIt = partition.nssToContainerMap.find(nss);
+    invariant(nsToContainerIt != partition.nssToContainerMap.end());
     CursorEntryMap& entryMap = nsToContainerIt->second.entryMap;
     size_t eraseResult = entryMap.erase(cursorId);
     invariant(1 == eraseResult);
     if (entryMap.empty()) {
-        eraseContainer(nsToContainerIt);
+        eraseContainer(partition, nsToContainerIt);
     }
 
     return std::move(cursor);
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -39,10 +40,12 @@
 #include "mongo/db/kill_sessions.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/session_killer.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/random.h"
 #include "mongo/s/query/cluster_client_cursor.h"
 #include "mongo/s/query/cluster_client_cursor_params.h"
 #include "mongo/stdx/mutex.h"
+#include "mongo/stdx/new.h"
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/time_support.h"
@@ -478,6 +481,7 @@ public:
 private:
     class CursorEntry;
     struct CursorEntryContainer;
+    struct Partition;
     using CursorEntryMap = stdx::unordered_map<CursorId, CursorEntry>;
     using NssToCursorContainerMap = stdx::unordered_map<NamespaceString, CursorEntryContainer>;
 
@@ -498,31 +502,36 @@ private:
                        CursorState cursorState);
 
     /**
-     * Will detach a cursor, release the lock and then call kill() on it.
+     * Will detach a cursor, release the owning partition's lock and then call kill() on it.
      */
     void detachAndKillCursor(stdx::unique_lock<stdx::mutex> lk,
+                             Partition& partition,
                              OperationContext* opCtx,
                              const NamespaceString& nss,
                              CursorId cursorId);
 
     /**
-     * Returns a pointer to the CursorEntry for the given cursor.  If the given cursor is not
-     * registered, returns null.
+     * Returns a pointer to the CursorEntry for the given cursor, which must belong to the given
+     * partition.  If the given cursor is not registered, returns null.
      *
-     * Not thread-safe.
+     * The caller must hold the partition's mutex.
      */
-    CursorEntry* _getEntry(WithLock, NamespaceString const& nss, CursorId cursorId);
+    CursorEntry* _getEntry(WithLock,
+                           Partition& partition,
+                           NamespaceString const& nss,
+                           CursorId cursorId);
 
     /**
-     * De-registers the given cursor, and returns an owned pointer to the underlying
-     * ClusterClientCursor object.
+     * De-registers the given cursor, which must belong to the given partition, and returns an
+     * owned pointer to the underlying ClusterClientCursor object.
      *
      * If the given cursor is pinned, returns an error Status with code CursorInUse.  If the given
      * cursor is not registered, returns an error Status with code CursorNotFound.
      *
-     * Not thread-safe.
+     * The caller must hold the partition's mutex.
      */
     StatusWith<std::unique_ptr<ClusterClientCursor>> _detachCursor(WithLock,
+                                                                   Partition& partition,
                                                                    NamespaceString const& nss,
                                                                    CursorId cursorId);
 
@@ -532,12 +541,11 @@ private:
     void killOperationUsingCursor(WithLock, CursorEntry* entry);
 
     /**
-     * Kill the cursors satisfying the given predicate. Assumes that 'lk' is held upon entry.
+     * Kill the cursors satisfying the given predicate, visiting the partitions one at a time.
      *
      * Returns the number of cursors killed.
      */
-    std::size_t killCursorsSatisfying(stdx::unique_lock<stdx::mutex> lk,
-                                      OperationContext* opCtx,
+    std::size_t killCursorsSatisfying(OperationContext* opCtx,
                                       std::function<bool(CursorId, const CursorEntry&)> pred);
 
     /**
@@ -671,21 +679,53 @@ private:
 
     /**
      * Erase the container that 'it' points to and return an iterator to the next one. Assumes 'it'
-     * is an iterator in '_namespaceToContainerMap'.
+     * is an iterator in the given partition's namespace-to-container map, and that the caller
+     * holds the partition's mutex.
      */
-    NssToCursorContainerMap::iterator eraseContainer(NssToCursorContainerMap::iterator it);
+    NssToCursorContainerMap::iterator eraseContainer(Partition& partition,
+                                                     NssToCursorContainerMap::iterator it);
+
+    /**
+     * The namespace-to-container maps are partitioned by the hash of the namespace, so that
+     * cursor check-out and check-in, which run for every mongos getMore, do not all funnel
+     * through a single mutex. A cursor lives in exactly one partition, and a partition's mutex
+     * guards the containers and entries it owns. Operations that span namespaces (killing by
+     * predicate, stats, session reporting) visit the partitions one at a time.
+     */
+    struct alignas(stdx::hardware_destructive_interference_size) Partition {
+        mutable stdx::mutex mutex;
+
+        // Randomness source for cursor id generation, seeded independently per partition so that
+        // ids can be generated without any manager-wide synchronization.
+        PseudoRandom pseudoRandom{
+            std::unique_ptr<SecureRandom>(SecureRandom::create())->nextInt64()};
+
+        // Map from namespace to the CursorEntryContainer for that namespace.
+        //
+        // Entries are added when the first cursor on the given namespace is registered, and
+        // removed when the last cursor on the given namespace is destroyed.
+        NssToCursorContainerMap nssToContainerMap;
+    };
+
+    Partition& _partition(const NamespaceString& nss) const {
+        return _partitions[DefaultHasher<NamespaceString>{}(nss) % kNumPartitions];
+    }
 
     // Clock source.  Used when the 'last active' time for a cursor needs to be set/updated.  May be
     // concurrently accessed by multiple threads.
     ClockSource* _clockSource;
 
-    // Synchronizes access to all private state variables below.
-    mutable stdx::mutex _mutex;
+    static const size_t kNumPartitions = 16;
 
-    bool _inShutdown{false};
+    mutable std::array<Partition, kNumPartitions> _partitions;
 
-    // Randomness source.  Used for cursor id generation.
-    PseudoRandom _pseudoRandom;
+    // Set once at the start of shutdown; checked under the partition mutex by registration and
+    // check-out so that no new cursor can slip past killAllCursors().
+    AtomicWord<bool> _inShutdown{false};
+
+    // Guards '_cursorIdPrefixToNamespaceMap'.  When a partition mutex and '_mutex' are both
+    // needed, the partition mutex is always acquired first.
+    mutable stdx::mutex _mutex;
 
     // Map from cursor id prefix to associated namespace.  Exists only to provide namespace lookup
     // for (deprecated) getNamespaceForCursorId() method.
@@ -699,12 +739,6 @@ private:
     // when the last cursor on the given namespace is destroyed.
     stdx::unordered_map<uint32_t, NamespaceString> _cursorIdPrefixToNamespaceMap;
 
-    // Map from namespace to the CursorEntryContainer for that namespace.
-    //
-    // Entries are added when the first cursor on the given namespace is registered, and removed
-    // when the last cursor on the given namespace is destroyed.
-    NssToCursorContainerMap _namespaceToContainerMap;
-
     size_t _cursorsTimedOut = 0;
 };
 
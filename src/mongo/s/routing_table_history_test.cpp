@@ -319,5 +319,40 @@ TEST_F(RoutingTableHistoryTestThreeInitialChunks,
                               expectedBytesInChunksNotSplit);
 }
 
+TEST_F(RoutingTableHistoryTestThreeInitialChunks, MigrationUpdatesShardVersionsIncrementally) {
+    const ShardId otherShard("otherShard");
+    auto boundaries = getInitialChunkBoundaryPoints();
+
+    // Move all three chunks over to 'otherShard', one migration at a time.
+    auto rt = getInitialRoutingTable();
+    for (size_t i = 0; i < 3; ++i) {
+        auto version = rt->getVersion();
+        version.incMajor();
+        rt = rt->makeUpdated(
+            {ChunkType{kNss, ChunkRange{boundaries[i], boundaries[i + 1]}, version, otherShard}});
+
+        ASSERT_EQ(rt->getVersion(otherShard), version);
+        ASSERT_EQ(rt->getChunkMap().size(), 3ull);
+    }
+
+    // The donor no longer owns any chunks, so it must not retain an entry in the shard version
+    // map.
+    ASSERT_EQ(rt->getVersion(kThisShard),
+              ChunkVersion(0, 0, getInitialRoutingTable()->getVersion().epoch()));
+}
+
+TEST_F(RoutingTableHistoryTestThreeInitialChunks, UpdateLeavingGapInRoutingTableThrows) {
+    auto boundaries = getInitialChunkBoundaryPoints();
+
+    // Replace the middle chunk with one whose min leaves a gap to the first chunk's max.
+    auto version = getInitialRoutingTable()->getVersion();
+    version.incMajor();
+    ASSERT_THROWS_CODE(
+        getInitialRoutingTable()->makeUpdated(
+            {ChunkType{kNss, ChunkRange{BSON("a" << 15), boundaries[2]}, version, kThisShard}}),
+        AssertionException,
+        ErrorCodes::ConflictingOperationInProgress);
+}
+
 }  // namespace
 }  // namespace mongo
@@ -121,12 +121,8 @@ bool isValidShardKeyElementForStorage(const BSONElement& element) {
     return true;
 }
 
-BSONElement extractKeyElementFromMatchable(const MatchableDocument& matchable, StringData pathStr) {
-    ElementPath path;
-    path.init(pathStr);
-    path.setLeafArrayBehavior(ElementPath::LeafArrayBehavior::kNoTraversal);
-    path.setNonLeafArrayBehavior(ElementPath::NonLeafArrayBehavior::kNoTraversal);
-
+BSONElement extractKeyElementFromMatchable(const MatchableDocument& matchable,
+                                           const ElementPath& path) {
     MatchableDocument::IteratorHolder matchIt(&matchable, &path);
     if (!matchIt->more())
         return BSONElement();
@@ -138,6 +134,14 @@ BSONElement extractKeyElementFromMatchable(const MatchableDocument& matchable, S
     return matchEl;
 }
 
+BSONElement extractKeyElementFromMatchable(const MatchableDocument& matchable, StringData pathStr) {
+    ElementPath path;
+    path.init(pathStr);
+    path.setLeafArrayBehavior(ElementPath::LeafArrayBehavior::kNoTraversal);
+    path.setNonLeafArrayBehavior(ElementPath::NonLeafArrayBehavior::kNoTraversal);
+    return extractKeyElementFromMatchable(matchable, path);
+}
+
 BSONElement findEqualityElement(const EqualityMatches& equalities, const FieldRef& path) {
     int parentPathPart;
     const BSONElement parentEl =
@@ -185,17 +189,26 @@ Status ShardKeyPattern::checkShardKeyIsValidForMetadataStorage(const BSONObj& sh
 ShardKeyPattern::ShardKeyPattern(const BSONObj& keyPattern)
     : _keyPattern(keyPattern),
       _keyPatternPaths(parseShardKeyPattern(keyPattern)),
-      _hasId(keyPattern.hasField("_id"_sd)) {}
+      _hasId(keyPattern.hasField("_id"_sd)),
+      _isHashedPattern(isHashedPatternEl(keyPattern.firstElement())) {
+    // Parse each field's element path once here so that per-document extraction doesn't have to.
+    _elementPaths.reserve(_keyPatternPaths.size());
+    for (const auto& path : _keyPatternPaths) {
+        _elementPaths.emplace_back(path->dottedField(),
+                                   ElementPath::LeafArrayBehavior::kNoTraversal,
+                                   ElementPath::NonLeafArrayBehavior::kNoTraversal);
+    }
+}
 
 ShardKeyPattern::ShardKeyPattern(const KeyPattern& keyPattern)
     : ShardKeyPattern(keyPattern.toBSON()) {}
 
 bool ShardKeyPattern::isHashedPatternEl(const BSONElement& el) {
-    return el.type() == String && el.String() == IndexNames::HASHED;
+    return el.type() == String && el.valueStringData() == IndexNames::HASHED;
 }
 
 bool ShardKeyPattern::isHashedPattern() const {
-    return isHashedPatternEl(_keyPattern.toBSON().firstElement());
+    return _isHashedPattern;
 }
 
 const KeyPattern& ShardKeyPattern::getKeyPattern() const {
@@ -252,11 +265,12 @@ BSONObj ShardKeyPattern::normalizeShardKey(const BSONObj& shardKey) const {
 BSONObj ShardKeyPattern::extractShardKeyFromMatchable(const MatchableDocument& matchable) const {
     BSONObjBuilder keyBuilder;
 
+    size_t pathIndex = 0;
     BSONObjIterator patternIt(_keyPattern.toBSON());
     while (patternIt.more()) {
         BSONElement patternEl = patternIt.next();
         BSONElement matchEl =
-            extractKeyElementFromMatchable(matchable, patternEl.fieldNameStringData());
+            extractKeyElementFromMatchable(matchable, _elementPaths[pathIndex++]);
 
         if (!isValidShardKeyElement(matchEl))
             return BSONObj();
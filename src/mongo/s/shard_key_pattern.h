@@ -254,7 +254,13 @@ private:
     // Ordered, parsed paths
     std::vector<std::unique_ptr<FieldRef>> _keyPatternPaths;
 
+    // Element paths for the same fields, in the same order, parsed once at construction and
+    // reused for every document-level shard key extraction.
+    std::vector<ElementPath> _elementPaths;
+
     bool _hasId;
+
+    bool _isHashedPattern;
 };
 
 }  // namespace mongo
@@ -445,35 +445,74 @@ BatchedCommandRequest BatchWriteOp::buildBatchRequest(
     boost::optional<std::vector<write_ops::UpdateOpEntry>> updates;
     boost::optional<std::vector<write_ops::DeleteOpEntry>> deletes;
 
-    for (const auto& targetedWrite : targetedBatch.getWrites()) {
-        const WriteOpRef& writeOpRef = targetedWrite->writeOpRef;
+    const auto& targetedWrites = targetedBatch.getWrites();
 
+    // If this batch contains every write of the client batch in the original order (the common
+    // case when the whole batch targets a single shard), the client request's op entries can be
+    // reused wholesale rather than copied out one at a time.
+    const bool isWholeClientBatch = [&] {
+        if (targetedWrites.size() != _clientRequest.sizeWriteOps())
+            return false;
+        int expectedIndex = 0;
+        for (const auto& targetedWrite : targetedWrites) {
+            if (targetedWrite->writeOpRef.first != expectedIndex++)
+                return false;
+        }
+        return true;
+    }();
+
+    if (isWholeClientBatch) {
         switch (batchType) {
             case BatchedCommandRequest::BatchType_Insert:
-                if (!insertDocs)
-                    insertDocs.emplace();
-                insertDocs->emplace_back(
-                    _clientRequest.getInsertRequest().getDocuments().at(writeOpRef.first));
+                insertDocs.emplace(_clientRequest.getInsertRequest().getDocuments());
                 break;
             case BatchedCommandRequest::BatchType_Update:
-                if (!updates)
-                    updates.emplace();
-                updates->emplace_back(
-                    _clientRequest.getUpdateRequest().getUpdates().at(writeOpRef.first));
+                updates.emplace(_clientRequest.getUpdateRequest().getUpdates());
                 break;
             case BatchedCommandRequest::BatchType_Delete:
-                if (!deletes)
-                    deletes.emplace();
-                deletes->emplace_back(
-                    _clientRequest.getDeleteRequest().getDeletes().at(writeOpRef.first));
+                deletes.emplace(_clientRequest.getDeleteRequest().getDeletes());
                 break;
             default:
                 MONGO_UNREACHABLE;
         }
 
         if (stmtIdsForOp) {
-            stmtIdsForOp->push_back(write_ops::getStmtIdForWriteAt(
-                _clientRequest.getWriteCommandBase(), writeOpRef.first));
+            for (size_t i = 0; i < targetedWrites.size(); ++i) {
+                stmtIdsForOp->push_back(write_ops::getStmtIdForWriteAt(
+                    _clientRequest.getWriteCommandBase(), static_cast<int>(i)));
+            }
+        }
+    } else {
+        for (const auto& targetedWrite : targetedWrites) {
+            const WriteOpRef& writeOpRef = targetedWrite->writeOpRef;
+
+            switch (batchType) {
+                case BatchedCommandRequest::BatchType_Insert:
+                    if (!insertDocs)
+                        insertDocs.emplace();
+                    insertDocs->emplace_back(
+                        _clientRequest.getInsertRequest().getDocuments().at(writeOpRef.first));
+                    break;
+                case BatchedCommandRequest::BatchType_Update:
+                    if (!updates)
+                        updates.emplace();
+                    updates->emplace_back(
+                        _clientRequest.getUpdateRequest().getUpdates().at(writeOpRef.first));
+                    break;
+                case BatchedCommandRequest::BatchType_Delete:
+                    if (!deletes)
+                        deletes.emplace();
+                    deletes->emplace_back(
+                        _clientRequest.getDeleteRequest().getDeletes().at(writeOpRef.first));
+                    break;
+                default:
+                    MONGO_UNREACHABLE;
+            }
+
+            if (stmtIdsForOp) {
+                stmtIdsForOp->push_back(write_ops::getStmtIdForWriteAt(
+                    _clientRequest.getWriteCommandBase(), writeOpRef.first));
+            }
         }
     }
 
@@ -163,6 +163,73 @@ TEST_F(BatchWriteOpTest, SingleOp) {
     ASSERT(clientResponse.getOk());
 }
 
+// A batch that targets a single shard in its entirety must build a shard request containing every
+// document in the original order, whether it takes the whole-batch path or not.
+TEST_F(BatchWriteOpTest, BuildBatchRequestWholeBatchSingleShard) {
+    NamespaceString nss("foo.bar");
+    ShardEndpoint endpoint(ShardId("shard"), ChunkVersion::IGNORED());
+    MockNSTargeter targeter;
+    initTargeterFullRange(nss, endpoint, &targeter);
+
+    BatchedCommandRequest request([&] {
+        write_ops::Insert insertOp(nss);
+        insertOp.setDocuments({BSON("x" << 1), BSON("x" << 2), BSON("x" << 3)});
+        return insertOp;
+    }());
+
+    BatchWriteOp batchOp(operationContext(), request);
+
+    OwnedPointerMap<ShardId, TargetedWriteBatch> targetedOwned;
+    std::map<ShardId, TargetedWriteBatch*>& targeted = targetedOwned.mutableMap();
+    ASSERT_OK(batchOp.targetBatch(targeter, false, &targeted));
+    ASSERT_EQUALS(targeted.size(), 1u);
+
+    BatchedCommandRequest shardRequest = batchOp.buildBatchRequest(*targeted.begin()->second);
+    const auto& docs = shardRequest.getInsertRequest().getDocuments();
+    ASSERT_EQUALS(docs.size(), 3u);
+    ASSERT_BSONOBJ_EQ(docs[0], BSON("x" << 1));
+    ASSERT_BSONOBJ_EQ(docs[1], BSON("x" << 2));
+    ASSERT_BSONOBJ_EQ(docs[2], BSON("x" << 3));
+}
+
+// A batch split across shards must build shard requests containing only each shard's documents.
+TEST_F(BatchWriteOpTest, BuildBatchRequestSplitBatch) {
+    NamespaceString nss("foo.bar");
+    ShardEndpoint endpointA(ShardId("shardA"), ChunkVersion::IGNORED());
+    ShardEndpoint endpointB(ShardId("shardB"), ChunkVersion::IGNORED());
+    MockNSTargeter targeter;
+    initTargeterSplitRange(nss, endpointA, endpointB, &targeter);
+
+    BatchedCommandRequest request([&] {
+        write_ops::Insert insertOp(nss);
+        insertOp.setWriteCommandBase([] {
+            write_ops::WriteCommandBase writeCommandBase;
+            writeCommandBase.setOrdered(false);
+            return writeCommandBase;
+        }());
+        insertOp.setDocuments({BSON("x" << -1), BSON("x" << 1), BSON("x" << -2)});
+        return insertOp;
+    }());
+
+    BatchWriteOp batchOp(operationContext(), request);
+
+    OwnedPointerMap<ShardId, TargetedWriteBatch> targetedOwned;
+    std::map<ShardId, TargetedWriteBatch*>& targeted = targetedOwned.mutableMap();
+    ASSERT_OK(batchOp.targetBatch(targeter, false, &targeted));
+    ASSERT_EQUALS(targeted.size(), 2u);
+
+    BatchedCommandRequest requestA = batchOp.buildBatchRequest(*targeted[ShardId("shardA")]);
+    const auto& docsA = requestA.getInsertRequest().getDocuments();
+    ASSERT_EQUALS(docsA.size(), 2u);
+    ASSERT_BSONOBJ_EQ(docsA[0], BSON("x" << -1));
+    ASSERT_BSONOBJ_EQ(docsA[1], BSON("x" << -2));
+
+    BatchedCommandRequest requestB = batchOp.buildBatchRequest(*targeted[ShardId("shardB")]);
+    const auto& docsB = requestB.getInsertRequest().getDocuments();
+    ASSERT_EQUALS(docsB.size(), 1u);
+    ASSERT_BSONOBJ_EQ(docsB[0], BSON("x" << 1));
+}
+
 TEST_F(BatchWriteOpTest, SingleError) {
     NamespaceString nss("foo.bar");
     ShardEndpoint endpoint(ShardId("shard"), ChunkVersion::IGNORED());
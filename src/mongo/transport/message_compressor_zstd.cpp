@@ -32,6 +32,7 @@
 
 #include "mongo/platform/basic.h"
 
+#include <memory>
 #include <zstd.h>
 
 #include "mongo/base/init.h"
@@ -40,6 +41,34 @@
 #include "mongo/transport/message_compressor_zstd.h"
 
 namespace mongo {
+namespace {
+
+// The one-shot ZSTD_compress()/ZSTD_decompress() entry points allocate and free a context on
+// every call. For the small messages that dominate most links, that setup cost rivals the
+// compression itself, so keep one long-lived context of each kind per thread. A single
+// compressor instance is shared by every session, so the contexts cannot live on the instance
+// without locking.
+ZSTD_CCtx* getThreadLocalCCtx() {
+    struct CCtxDeleter {
+        void operator()(ZSTD_CCtx* ctx) const {
+            ZSTD_freeCCtx(ctx);
+        }
+    };
+    thread_local std::unique_ptr<ZSTD_CCtx, CCtxDeleter> cctx(ZSTD_createCCtx());
+    return cctx.get();
+}
+
+ZSTD_DCtx* getThreadLocalDCtx() {
+    struct DCtxDeleter {
+        void operator()(ZSTD_DCtx* ctx) const {
+            ZSTD_freeDCtx(ctx);
+        }
+    };
+    thread_local std::unique_ptr<ZSTD_DCtx, DCtxDeleter> dctx(ZSTD_createDCtx());
+    return dctx.get();
+}
+
+}  // namespace
 
 ZstdMessageCompressor::ZstdMessageCompressor() : MessageCompressorBase(MessageCompressor::kZstd) {}
 
@@ -49,11 +78,12 @@ std::size_t ZstdMessageCompressor::getMaxCompressedSize(size_t inputSize) {
 
 StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input,
                                                             DataRange output) {
-    size_t ret = ZSTD_compress(const_cast<char*>(output.data()),
-                               output.length(),
-                               input.data(),
-                               input.length(),
-                               ZSTD_CLEVEL_DEFAULT);
+    size_t ret = ZSTD_compressCCtx(getThreadLocalCCtx(),
+                                   const_cast<char*>(output.data()),
+                                   output.length(),
+                                   input.data(),
+                                   input.length(),
+                                   ZSTD_CLEVEL_DEFAULT);
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
@@ -65,8 +95,11 @@ StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input
 
 StatusWith<std::size_t> ZstdMessageCompressor::decompressData(ConstDataRange input,
                                                               DataRange output) {
-    size_t ret = ZSTD_decompress(
-        const_cast<char*>(output.data()), output.length(), input.data(), input.length());
+    size_t ret = ZSTD_decompressDCtx(getThreadLocalDCtx(),
+                                     const_cast<char*>(output.data()),
+                                     output.length(),
+                                     input.data(),
+                                     input.length());
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
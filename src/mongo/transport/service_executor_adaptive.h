@@ -81,6 +81,11 @@ public:
         // The maximum allowable depth of recursion for tasks scheduled with the MayRecurse flag
         // before stack unwinding is forced.
         virtual int recursionLimit() const = 0;
+
+        // Whether worker threads should be bound round-robin to the available CPU cores to
+        // improve cache locality. All threads keep servicing the shared reactor regardless, so
+        // the pool remains work-conserving.
+        virtual bool cpuAffinity() const = 0;
     };
 
     explicit ServiceExecutorAdaptive(ServiceContext* ctx, ReactorHandle reactor);
@@ -74,6 +74,10 @@ struct TestOptions : public ServiceExecutorAdaptive::Options {
     int recursionLimit() const final {
         return 0;
     }
+
+    bool cpuAffinity() const final {
+        return false;
+    }
 };
 
 struct RecursionOptions : public ServiceExecutorAdaptive::Options {
@@ -104,6 +108,10 @@ struct RecursionOptions : public ServiceExecutorAdaptive::Options {
     int recursionLimit() const final {
         return 10;
     }
+
+    bool cpuAffinity() const final {
+        return false;
+    }
 };
 
 class ServiceExecutorAdaptiveFixture : public unittest::Test {
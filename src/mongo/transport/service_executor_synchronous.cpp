@@ -40,6 +40,7 @@
 #include "mongo/transport/service_executor_task_names.h"
 #include "mongo/transport/thread_idle_callback.h"
 #include "mongo/util/log.h"
+#include "mongo/util/numa.h"
 #include "mongo/util/processinfo.h"
 
 namespace mongo {
@@ -50,6 +51,24 @@ namespace {
 // value.
 MONGO_EXPORT_SERVER_PARAMETER(synchronousServiceExecutorRecursionLimit, int, 8);
 
+// When true on a multi-node machine, each new worker thread is pinned to one NUMA node, chosen
+// round-robin, so its per-session allocations stay node-local under first-touch placement.
+MONGO_EXPORT_SERVER_PARAMETER(synchronousServiceExecutorBindToNumaNodes, bool, false);
+
+void bindWorkerToNumaNode() {
+    const auto nodes = numaNodeCount();
+    if (nodes < 2 || !synchronousServiceExecutorBindToNumaNodes.load()) {
+        return;
+    }
+
+    static AtomicWord<unsigned> nextNode;
+    const auto node = nextNode.fetchAndAdd(1) % nodes;
+    auto status = bindThreadToNumaNode(node);
+    if (!status.isOK()) {
+        LOG(1) << "failed to bind worker thread to NUMA node " << node << ": " << status;
+    }
+}
+
 constexpr auto kThreadsRunning = "threadsRunning"_sd;
 constexpr auto kExecutorLabel = "executor"_sd;
 constexpr auto kExecutorName = "passthrough"_sd;
@@ -127,6 +146,7 @@ Status ServiceExecutorSynchronous::schedule(Task task,
 
     Status status = launchServiceWorkerThread([ this, task = std::move(task) ] {
         _numRunningWorkerThreads.addAndFetch(1);
+        bindWorkerToNumaNode();
 
         _localWorkQueue.emplace_back(std::move(task));
         while (!_localWorkQueue.empty() && _stillRunning.loadRelaxed()) {
@@ -82,6 +82,10 @@ struct TestOptions : public ServiceExecutorAdaptive::Options {
     int recursionLimit() const final {
         return 0;
     }
+
+    bool cpuAffinity() const final {
+        return false;
+    }
 };
 
 /* This implements the portions of the transport::Reactor based on ASIO, but leaves out
@@ -40,6 +40,7 @@
 #include "mongo/db/stats/counters.h"
 #include "mongo/rpc/message.h"
 #include "mongo/rpc/op_msg.h"
+#include "mongo/rpc/reply_buffer_size_hint.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/transport/message_compressor_manager.h"
 #include "mongo/transport/service_entry_point.h"
@@ -148,6 +149,15 @@ Message makeExhaustMessage(Message requestMsg, DbResponse* dbresponse) {
     // 'synthetic' request.
     requestMsg.header().setId(dbresponse->response.header().getId());
     requestMsg.header().setResponseToMsgId(dbresponse->response.header().getResponseToMsgId());
+
+    // The checksum of a checksummed request covers the header just rewritten above, so recompute
+    // it; otherwise re-parsing the synthetic request fails with ChecksumMismatch, which is
+    // connection-fatal. Keeping the flag set also keeps the remaining exhaust responses
+    // checksummed, since each response mirrors the request it answers.
+    if (OpMsg::isFlagSet(requestMsg, OpMsg::kChecksumPresent)) {
+        OpMsg::removeChecksum(&requestMsg);
+        OpMsg::appendChecksum(&requestMsg);
+    }
     return requestMsg;
 }
 
@@ -452,6 +462,8 @@ void ServiceStateMachine::_processMessage(ThreadGuard guard) {
     if (!toSink.empty()) {
         invariant(!OpMsg::isFlagSet(_inMessage, OpMsg::kMoreToCome));
 
+        const bool requestChecksummed = OpMsg::isFlagSet(_inMessage, OpMsg::kChecksumPresent);
+
         // Update the header for the response message.
         toSink.header().setId(nextMessageId());
         toSink.header().setResponseToMsgId(_inMessage.header().getId());
@@ -465,8 +477,19 @@ void ServiceStateMachine::_processMessage(ThreadGuard guard) {
         _inMessage = makeExhaustMessage(_inMessage, &dbresponse);
         _inExhaust = !_inMessage.empty();
 
+        // A client opts in to checksummed responses by checksumming its request. This must happen
+        // after the response header is finalized, since the header is covered by the checksum, and
+        // before compression, which operates on the checksummed frame.
+        if (requestChecksummed) {
+            OpMsg::appendChecksum(&toSink);
+        }
+
         networkCounter.hitLogicalOut(toSink.size());
 
+        // Feed the uncompressed reply size back into the session's buffer sizing history so the
+        // next reply on this session starts from the right capacity.
+        rpc::ReplyBufferSizeHint::get(_sessionHandle).recordReplySize(toSink.size());
+
         if (_compressorId) {
             auto swm = compressorMgr.compressMessage(toSink, &_compressorId.value());
             uassertStatusOK(swm.getStatus());
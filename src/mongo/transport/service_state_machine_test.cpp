@@ -75,6 +75,7 @@ public:
     DbResponse handleRequest(OperationContext* opCtx, const Message& request) override {
         log() << "In handleRequest";
         _ranHandler = true;
+        _lastRequest = request;
         ASSERT_TRUE(haveClient());
 
         // Build out a dummy OK response, if no custom response message was set. Otherwise, use the
@@ -116,6 +117,10 @@ public:
         _responseMessage = std::move(m);
     }
 
+    Message getLastRequest() {
+        return _lastRequest;
+    }
+
     bool ranHandler() {
         bool ret = _ranHandler;
         _ranHandler = false;
@@ -128,6 +133,9 @@ private:
 
     // A custom response message to return from 'handleRequest'.
     Message _responseMessage;
+
+    // The request message most recently passed to 'handleRequest'.
+    Message _lastRequest;
 };
 
 using namespace transport;
@@ -478,6 +486,49 @@ TEST_F(ServiceStateMachineFixture, TestGetMoreWithExhaust) {
     ASSERT_EQ(firstResponseId, msg.header().getResponseToMsgId());
 }
 
+TEST_F(ServiceStateMachineFixture, TestGetMoreWithExhaustAndChecksum) {
+
+    // Construct a checksummed 'getMore' OP_MSG request with the exhaust flag set.
+    const int32_t initRequestId = 1;
+    const long long cursorId = 42;
+    const std::string nss = "test.coll";
+    Message getMoreWithExhaust = getMoreRequestWithExhaust(nss, cursorId, initRequestId);
+    OpMsg::appendChecksum(&getMoreWithExhaust);
+
+    // Construct a 'getMore' response, with a non-zero cursor id and an empty batch.
+    BSONObj getMoreResBody =
+        BSON("ok" << 1 << "cursor"
+                  << BSON("id" << cursorId << "ns" << nss << "nextBatch" << BSONArray()));
+    Message getMoreRes = buildOpMsg(getMoreResBody);
+
+    // Let the 'getMore' request be sourced from the network, processed in the database, and sunk
+    // to the TransportLayer. The exhaust flag should leave us in the 'Process' state.
+    runSourceAndSinkTest(_tl, _sep, getMoreWithExhaust, getMoreRes, State::Process, State::Process);
+
+    // A checksummed request gets a checksummed response; parsing verifies the checksum.
+    auto msg = _tl->getLastSunk();
+    ASSERT(!msg.empty());
+    ASSERT(OpMsg::isFlagSet(msg, OpMsg::kChecksumPresent));
+    ASSERT(OpMsg::isFlagSet(msg, OpMsg::kMoreToCome));
+    ASSERT_BSONOBJ_EQ(getMoreResBody, OpMsg::parse(msg).body);
+
+    // Run another exhaust round so the synthesized request is processed. Its header was rewritten
+    // after the original checksum was computed, so this would fail with ChecksumMismatch and kill
+    // the connection if the checksum were not recomputed.
+    _sep->setResponseMessage(getMoreRes);
+    log() << "runNext to process the synthesized exhaust request";
+    _ssm->runNext();
+    ASSERT_EQ(_ssm->state(), State::Process);
+
+    // The synthesized request is still checksummed, its checksum matches its rewritten header,
+    // and the follow-on response is checksummed as well.
+    Message synthesized = _sep->getLastRequest();
+    ASSERT(OpMsg::isFlagSet(synthesized, OpMsg::kChecksumPresent));
+    auto parsed = OpMsg::parse(synthesized);
+    ASSERT_EQ(cursorId, parsed.body["getMore"].numberLong());
+    ASSERT(OpMsg::isFlagSet(_tl->getLastSunk(), OpMsg::kChecksumPresent));
+}
+
 TEST_F(ServiceStateMachineFixture, TestGetMoreWithExhaustAndEmptyResponseNamespace) {
     // Construct a 'getMore' OP_MSG request with the exhaust flag set.
     const int32_t initRequestId = 1;
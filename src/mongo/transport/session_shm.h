@@ -0,0 +1,189 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstring>
+
+#include "mongo/base/data_view.h"
+#include "mongo/db/stats/counters.h"
+#include "mongo/stdx/memory.h"
+#include "mongo/transport/session.h"
+#include "mongo/transport/shm_ring_buffer.h"
+#include "mongo/transport/transport_layer_shm.h"
+#include "mongo/util/mongoutils/str.h"
+#include "mongo/util/net/hostandport.h"
+
+namespace mongo {
+namespace transport {
+
+/**
+ * On-disk (well, in-segment) layout of one shared memory connection. The segment is created and
+ * initialized by the connecting client; the data regions for the two rings follow the layout
+ * struct directly, client-to-server first.
+ */
+struct ShmConnectionLayout {
+    static constexpr uint64_t kMagic = 0x314d485353474e4dULL;  // "MNGSSHM1"
+    static constexpr uint32_t kVersion = 1;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t ringBytes;
+    ShmRingBuffer::Control clientToServer;
+    ShmRingBuffer::Control serverToClient;
+};
+
+/**
+ * A Session over one shared memory connection segment. Wire format on the rings is identical to
+ * the socket wire protocol: length-prefixed Message frames, so everything above the session is
+ * oblivious to the transport. Only synchronous operation is supported; the async methods
+ * complete inline.
+ */
+class ShmSession final : public Session {
+    MONGO_DISALLOW_COPYING(ShmSession);
+
+public:
+    enum class Side { kServer, kClient };
+
+    ShmSession(TransportLayer* tl, std::unique_ptr<ShmSegment> segment, Side side)
+        : _tl(tl), _isIngressSession(side == Side::kServer), _segment(std::move(segment)) {
+        auto* layout = reinterpret_cast<ShmConnectionLayout*>(_segment->data());
+        char* clientToServerData = _segment->data() + sizeof(ShmConnectionLayout);
+        char* serverToClientData = clientToServerData + layout->ringBytes;
+
+        if (side == Side::kServer) {
+            _in = stdx::make_unique<ShmRingBuffer>(&layout->clientToServer, clientToServerData);
+            _out = stdx::make_unique<ShmRingBuffer>(&layout->serverToClient, serverToClientData);
+        } else {
+            _in = stdx::make_unique<ShmRingBuffer>(&layout->serverToClient, serverToClientData);
+            _out = stdx::make_unique<ShmRingBuffer>(&layout->clientToServer, clientToServerData);
+        }
+    }
+
+    ~ShmSession() override {
+        end();
+    }
+
+    TransportLayer* getTransportLayer() const override {
+        return _tl;
+    }
+
+    void end() override {
+        _in->close();
+        _out->close();
+    }
+
+    StatusWith<Message> sourceMessage() override {
+        static constexpr auto kHeaderSize = sizeof(MSGHEADER::Value);
+
+        char lenBuffer[sizeof(int32_t)];
+        auto status = _in->read(lenBuffer, sizeof(lenBuffer), _configuredTimeout);
+        if (!status.isOK()) {
+            return status;
+        }
+
+        const auto msgLen = size_t(ConstDataView(lenBuffer).read<LittleEndian<int32_t>>());
+        if (msgLen < kHeaderSize || msgLen > MaxMessageSizeBytes) {
+            return Status(ErrorCodes::ProtocolError,
+                          str::stream() << "recv(): message msgLen " << msgLen << " is invalid. "
+                                        << "Min "
+                                        << kHeaderSize
+                                        << " Max: "
+                                        << MaxMessageSizeBytes);
+        }
+
+        auto buffer = SharedBuffer::allocate(msgLen);
+        memcpy(buffer.get(), lenBuffer, sizeof(lenBuffer));
+        status = _in->read(buffer.get() + sizeof(lenBuffer),
+                           msgLen - sizeof(lenBuffer),
+                           _configuredTimeout);
+        if (!status.isOK()) {
+            return status;
+        }
+
+        if (_isIngressSession) {
+            networkCounter.hitPhysicalIn(msgLen);
+        }
+        return Message(std::move(buffer));
+    }
+
+    Future<Message> asyncSourceMessage(const transport::BatonHandle& handle = nullptr) override {
+        return Future<Message>::makeReady(sourceMessage());
+    }
+
+    Status sinkMessage(Message message) override {
+        auto status = _out->write(message.buf(), message.size(), _configuredTimeout);
+        if (status.isOK() && _isIngressSession) {
+            networkCounter.hitPhysicalOut(message.size());
+        }
+        return status;
+    }
+
+    Future<void> asyncSinkMessage(Message message,
+                                  const transport::BatonHandle& handle = nullptr) override {
+        return Future<void>::makeReady(sinkMessage(std::move(message)));
+    }
+
+    void cancelAsyncOperations(const transport::BatonHandle& handle = nullptr) override {}
+
+    void setTimeout(boost::optional<Milliseconds> timeout) override {
+        invariant(!timeout || timeout->count() > 0);
+        _configuredTimeout = timeout;
+    }
+
+    bool isConnected() override {
+        return !_in->isClosed() && !_out->isClosed();
+    }
+
+    const HostAndPort& remote() const override {
+        return _remote;
+    }
+
+    const HostAndPort& local() const override {
+        return _local;
+    }
+
+private:
+    TransportLayer* const _tl;
+    const bool _isIngressSession;
+
+    std::unique_ptr<ShmSegment> _segment;
+    std::unique_ptr<ShmRingBuffer> _in;
+    std::unique_ptr<ShmRingBuffer> _out;
+
+    boost::optional<Milliseconds> _configuredTimeout;
+
+    // Shared memory peers have no network address. These stay default-constructed.
+    HostAndPort _remote;
+    HostAndPort _local;
+};
+
+}  // namespace transport
+}  // namespace mongo
@@ -0,0 +1,216 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/transport/shm_ring_buffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "mongo/base/static_assert.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+namespace transport {
+namespace {
+
+// The futex interface operates on raw 32-bit words, so the atomics must be address-identical
+// to their underlying integers.
+MONGO_STATIC_ASSERT(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+
+#ifdef __linux__
+
+// No FUTEX_PRIVATE_FLAG: the waiter and the waker are different processes sharing the mapping.
+void futexWait(const std::atomic<uint32_t>* addr,
+               uint32_t expected,
+               boost::optional<Date_t> deadline) {
+    timespec ts;
+    timespec* tsPtr = nullptr;
+    if (deadline) {
+        const auto remaining = *deadline - Date_t::now();
+        if (remaining <= Milliseconds::zero()) {
+            return;
+        }
+        ts.tv_sec = durationCount<Seconds>(remaining);
+        ts.tv_nsec = durationCount<Nanoseconds>(remaining - Seconds(ts.tv_sec));
+        tsPtr = &ts;
+    }
+    // EAGAIN (the word changed before we slept), EINTR, and ETIMEDOUT all just mean "go
+    // re-check the condition", which the calling loop does unconditionally.
+    syscall(SYS_futex, reinterpret_cast<const uint32_t*>(addr), FUTEX_WAIT, expected, tsPtr);
+}
+
+void futexWakeAll(const std::atomic<uint32_t>* addr) {
+    syscall(SYS_futex, reinterpret_cast<const uint32_t*>(addr), FUTEX_WAKE, INT_MAX);
+}
+
+#else
+
+void futexWait(const std::atomic<uint32_t>* addr,
+               uint32_t expected,
+               boost::optional<Date_t> deadline) {
+    // Portable fallback. The calling loop re-checks its condition after every wait, so a short
+    // sleep here is less efficient than a real futex wait but not less correct.
+    sleepmillis(1);
+}
+
+void futexWakeAll(const std::atomic<uint32_t>* addr) {}
+
+#endif
+
+Status closedStatus() {
+    return {ErrorCodes::HostUnreachable, "Shared memory ring closed by peer"};
+}
+
+Status timeoutStatus() {
+    return {ErrorCodes::NetworkTimeout, "Timed out waiting on shared memory ring"};
+}
+
+// Waits for the peer to move 'word' away from 'expected', subject to 'deadline'. Spurious
+// returns are fine; the caller loops.
+Status waitForPeer(const std::atomic<uint32_t>& word,
+                   uint32_t expected,
+                   boost::optional<Date_t> deadline) {
+    if (deadline && Date_t::now() >= *deadline) {
+        return timeoutStatus();
+    }
+    futexWait(&word, expected, deadline);
+    return Status::OK();
+}
+
+}  // namespace
+
+void ShmRingBuffer::initialize(Control* control, uint32_t capacity) {
+    invariant(capacity > 0 && (capacity & (capacity - 1)) == 0);
+    control->head.store(0);
+    control->tail.store(0);
+    control->closed.store(0);
+    control->capacity = capacity;
+}
+
+ShmRingBuffer::ShmRingBuffer(Control* control, char* data) : _control(control), _data(data) {
+    invariant(_control->capacity > 0 && (_control->capacity & (_control->capacity - 1)) == 0);
+}
+
+Status ShmRingBuffer::write(const char* data, size_t size, boost::optional<Milliseconds> timeout) {
+    const uint32_t capacity = _control->capacity;
+    boost::optional<Date_t> deadline;
+    if (timeout) {
+        deadline = Date_t::now() + *timeout;
+    }
+
+    size_t written = 0;
+    while (written < size) {
+        if (_control->closed.load(std::memory_order_acquire)) {
+            return closedStatus();
+        }
+
+        const uint32_t tail = _control->tail.load(std::memory_order_relaxed);
+        const uint32_t head = _control->head.load(std::memory_order_acquire);
+        const uint32_t available = capacity - (tail - head);
+        if (available == 0) {
+            auto status = waitForPeer(_control->head, head, deadline);
+            if (!status.isOK()) {
+                return status;
+            }
+            continue;
+        }
+
+        const uint32_t offset = tail & (capacity - 1);
+        const uint32_t contiguous = std::min<uint32_t>(capacity - offset, available);
+        const auto toCopy =
+            static_cast<uint32_t>(std::min<size_t>(contiguous, size - written));
+        memcpy(_data + offset, data + written, toCopy);
+        written += toCopy;
+        _control->tail.store(tail + toCopy, std::memory_order_release);
+        futexWakeAll(&_control->tail);
+    }
+
+    return Status::OK();
+}
+
+Status ShmRingBuffer::read(char* out, size_t size, boost::optional<Milliseconds> timeout) {
+    const uint32_t capacity = _control->capacity;
+    boost::optional<Date_t> deadline;
+    if (timeout) {
+        deadline = Date_t::now() + *timeout;
+    }
+
+    size_t consumed = 0;
+    while (consumed < size) {
+        const uint32_t head = _control->head.load(std::memory_order_relaxed);
+        const uint32_t tail = _control->tail.load(std::memory_order_acquire);
+        const uint32_t available = tail - head;
+        if (available == 0) {
+            // Check closed only when empty, so bytes the peer wrote before closing (or before
+            // crashing) can still be drained.
+            if (_control->closed.load(std::memory_order_acquire)) {
+                return closedStatus();
+            }
+            auto status = waitForPeer(_control->tail, tail, deadline);
+            if (!status.isOK()) {
+                return status;
+            }
+            continue;
+        }
+
+        const uint32_t offset = head & (capacity - 1);
+        const uint32_t contiguous = std::min<uint32_t>(capacity - offset, available);
+        const auto toCopy =
+            static_cast<uint32_t>(std::min<size_t>(contiguous, size - consumed));
+        memcpy(out + consumed, _data + offset, toCopy);
+        consumed += toCopy;
+        _control->head.store(head + toCopy, std::memory_order_release);
+        futexWakeAll(&_control->head);
+    }
+
+    return Status::OK();
+}
+
+void ShmRingBuffer::close() {
+    _control->closed.store(1, std::memory_order_release);
+    // Wake both sides; a woken waiter re-checks the closed flag.
+    futexWakeAll(&_control->head);
+    futexWakeAll(&_control->tail);
+}
+
+bool ShmRingBuffer::isClosed() const {
+    return _control->closed.load(std::memory_order_acquire) != 0;
+}
+
+}  // namespace transport
+}  // namespace mongo
@@ -0,0 +1,112 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/optional.hpp>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/base/status.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+namespace transport {
+
+/**
+ * A single-producer single-consumer byte ring over a caller-provided memory region, designed to
+ * be placed in shared memory and used from two processes at once. All coordination state lives
+ * in the Control block inside the shared region; this class holds only pointers into it and is
+ * constructed independently on each side.
+ *
+ * Blocked readers and writers wait on futexes on Linux, so a stalled side is woken directly by
+ * its peer process without polling; elsewhere waiting degrades to a sleep-poll loop.
+ */
+class ShmRingBuffer {
+    MONGO_DISALLOW_COPYING(ShmRingBuffer);
+
+public:
+    /**
+     * The shared coordination state, which must live inside the shared region at its natural
+     * alignment. 'head' and 'tail' are free-running counters: the ring is empty when they are
+     * equal and full when they differ by 'capacity'.
+     */
+    struct Control {
+        std::atomic<uint32_t> head;    // Next byte to read. Advanced only by the consumer.
+        std::atomic<uint32_t> tail;    // Next byte to write. Advanced only by the producer.
+        std::atomic<uint32_t> closed;  // Set once by either side, never cleared.
+        uint32_t capacity;             // Data bytes in the ring. Fixed at initialize() time.
+    };
+
+    /**
+     * Initializes 'control' for a ring of 'capacity' data bytes, which must be a power of two.
+     * Called exactly once, by whichever side creates the shared region, before the peer
+     * attaches.
+     */
+    static void initialize(Control* control, uint32_t capacity);
+
+    /**
+     * Attaches to an initialized ring whose data region of control->capacity bytes starts at
+     * 'data'.
+     */
+    ShmRingBuffer(Control* control, char* data);
+
+    /**
+     * Writes all 'size' bytes, blocking while the ring is full. Returns NetworkTimeout if
+     * 'timeout' expires first, or HostUnreachable if the ring has been closed.
+     */
+    Status write(const char* data,
+                 size_t size,
+                 boost::optional<Milliseconds> timeout = boost::none);
+
+    /**
+     * Reads exactly 'size' bytes, blocking while the ring is empty. Returns NetworkTimeout if
+     * 'timeout' expires first, or HostUnreachable if the ring is closed and fully drained.
+     */
+    Status read(char* out, size_t size, boost::optional<Milliseconds> timeout = boost::none);
+
+    /**
+     * Marks the ring closed and wakes any waiting peer. Idempotent. Bytes already in the ring
+     * can still be read by the consumer; further writes fail immediately.
+     */
+    void close();
+
+    bool isClosed() const;
+
+private:
+    Control* const _control;
+    char* const _data;
+};
+
+}  // namespace transport
+}  // namespace mongo
@@ -0,0 +1,172 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "mongo/stdx/thread.h"
+#include "mongo/transport/shm_ring_buffer.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace transport {
+namespace {
+
+// The ring logic only cares that the Control block and data region share an address space, so
+// the tests run it over plain heap memory instead of a real shared mapping.
+class TestRing {
+public:
+    explicit TestRing(uint32_t capacity) : _data(capacity) {
+        ShmRingBuffer::initialize(&_control, capacity);
+        _ring.emplace(&_control, _data.data());
+    }
+
+    ShmRingBuffer& ring() {
+        return *_ring;
+    }
+
+private:
+    ShmRingBuffer::Control _control;
+    std::vector<char> _data;
+    boost::optional<ShmRingBuffer> _ring;
+};
+
+TEST(ShmRingBuffer, RoundTripWithWraparound) {
+    TestRing fixture(64);
+    auto& ring = fixture.ring();
+
+    // Push several chunks larger than half the capacity through the ring so the offsets wrap
+    // multiple times.
+    char out[48];
+    char in[48];
+    for (int pass = 0; pass < 10; pass++) {
+        for (size_t i = 0; i < sizeof(out); i++) {
+            out[i] = char(pass * 31 + i);
+        }
+        ASSERT_OK(ring.write(out, sizeof(out)));
+        ASSERT_OK(ring.read(in, sizeof(in)));
+        ASSERT_EQ(memcmp(out, in, sizeof(out)), 0);
+    }
+}
+
+TEST(ShmRingBuffer, ConcurrentProducerConsumer) {
+    TestRing fixture(256);
+    auto& ring = fixture.ring();
+
+    // Stream a megabyte through a small ring so both sides block and wake repeatedly.
+    constexpr size_t kTotalBytes = 1 << 20;
+    stdx::thread producer([&] {
+        char chunk[97];
+        size_t sent = 0;
+        while (sent < kTotalBytes) {
+            const size_t toSend = std::min(sizeof(chunk), kTotalBytes - sent);
+            for (size_t i = 0; i < toSend; i++) {
+                chunk[i] = char((sent + i) % 251);
+            }
+            ASSERT_OK(ring.write(chunk, toSend));
+            sent += toSend;
+        }
+    });
+
+    char chunk[61];
+    size_t received = 0;
+    while (received < kTotalBytes) {
+        const size_t toReceive = std::min(sizeof(chunk), kTotalBytes - received);
+        ASSERT_OK(ring.read(chunk, toReceive));
+        for (size_t i = 0; i < toReceive; i++) {
+            ASSERT_EQ(chunk[i], char((received + i) % 251));
+        }
+        received += toReceive;
+    }
+    producer.join();
+}
+
+TEST(ShmRingBuffer, CloseWakesBlockedReader) {
+    TestRing fixture(64);
+    auto& ring = fixture.ring();
+
+    stdx::thread closer([&] {
+        sleepmillis(50);
+        ring.close();
+    });
+
+    char buffer[16];
+    ASSERT_EQ(ring.read(buffer, sizeof(buffer)), ErrorCodes::HostUnreachable);
+    closer.join();
+}
+
+TEST(ShmRingBuffer, ReadDrainsBufferedBytesAfterClose) {
+    TestRing fixture(64);
+    auto& ring = fixture.ring();
+
+    const char out[] = "pending";
+    ASSERT_OK(ring.write(out, sizeof(out)));
+    ring.close();
+
+    // Bytes written before the close are still readable; only the next read fails.
+    char in[sizeof(out)];
+    ASSERT_OK(ring.read(in, sizeof(in)));
+    ASSERT_EQ(memcmp(out, in, sizeof(out)), 0);
+    ASSERT_EQ(ring.read(in, 1), ErrorCodes::HostUnreachable);
+}
+
+TEST(ShmRingBuffer, WriteAfterCloseFails) {
+    TestRing fixture(64);
+    auto& ring = fixture.ring();
+
+    ring.close();
+    const char out[] = "late";
+    ASSERT_EQ(ring.write(out, sizeof(out)), ErrorCodes::HostUnreachable);
+}
+
+TEST(ShmRingBuffer, ReadTimesOut) {
+    TestRing fixture(64);
+    auto& ring = fixture.ring();
+
+    char buffer[16];
+    ASSERT_EQ(ring.read(buffer, sizeof(buffer), Milliseconds(50)), ErrorCodes::NetworkTimeout);
+}
+
+TEST(ShmRingBuffer, WriteTimesOutWhenFull) {
+    TestRing fixture(64);
+    auto& ring = fixture.ring();
+
+    char buffer[64];
+    memset(buffer, 'x', sizeof(buffer));
+    ASSERT_OK(ring.write(buffer, sizeof(buffer)));
+    ASSERT_EQ(ring.write(buffer, 1, Milliseconds(50)), ErrorCodes::NetworkTimeout);
+}
+
+}  // namespace
+}  // namespace transport
+}  // namespace mongo
@@ -0,0 +1,344 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kNetwork
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/transport/transport_layer_shm.h"
+
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/process_id.h"
+#include "mongo/transport/service_entry_point.h"
+#include "mongo/transport/session_shm.h"
+#include "mongo/util/errno_util.h"
+#include "mongo/util/log.h"
+#include "mongo/util/mongoutils/str.h"
+
+namespace mongo {
+namespace transport {
+namespace {
+
+// A connect request posted into the accept ring: the NUL-terminated name of the connection
+// segment the client has created and initialized. Fixed-size so requests never interleave.
+struct ConnectRequest {
+    char segmentName[256];
+};
+
+// Layout of the accept segment: just a ring of ConnectRequests.
+struct AcceptSegmentLayout {
+    static constexpr uint64_t kMagic = 0x314d48535043414dULL;  // "MACPSHM1"
+    static constexpr uint32_t kVersion = 1;
+
+    uint64_t magic;
+    uint32_t version;
+    ShmRingBuffer::Control ring;
+};
+
+// Must hold a few dozen pending ConnectRequests; connects are rare and small.
+constexpr uint32_t kAcceptRingBytes = 64 * 1024;
+
+bool isPowerOfTwo(uint32_t value) {
+    return value > 0 && (value & (value - 1)) == 0;
+}
+
+Status validateSegmentName(const std::string& name) {
+    if (name.empty() || name.front() != '/' ||
+        name.size() >= sizeof(ConnectRequest().segmentName)) {
+        return {ErrorCodes::BadValue,
+                str::stream() << "Invalid shared memory segment name: '" << name << "'"};
+    }
+    return Status::OK();
+}
+
+}  // namespace
+
+#ifndef _WIN32
+
+StatusWith<std::unique_ptr<ShmSegment>> ShmSegment::create(const std::string& name, size_t size) {
+    auto status = validateSegmentName(name);
+    if (!status.isOK()) {
+        return status;
+    }
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        return Status(ErrorCodes::SocketException,
+                      str::stream() << "shm_open(" << name
+                                    << ") failed: " << errnoWithDescription());
+    }
+
+    if (ftruncate(fd, size) != 0) {
+        auto ec = errnoWithDescription();
+        close(fd);
+        shm_unlink(name.c_str());
+        return Status(ErrorCodes::SocketException,
+                      str::stream() << "ftruncate(" << name << ") failed: " << ec);
+    }
+
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        auto ec = errnoWithDescription();
+        shm_unlink(name.c_str());
+        return Status(ErrorCodes::SocketException,
+                      str::stream() << "mmap(" << name << ") failed: " << ec);
+    }
+
+    memset(mapping, 0, size);
+    return std::unique_ptr<ShmSegment>(new ShmSegment(name, mapping, size, true /* owner */));
+}
+
+StatusWith<std::unique_ptr<ShmSegment>> ShmSegment::open(const std::string& name) {
+    auto status = validateSegmentName(name);
+    if (!status.isOK()) {
+        return status;
+    }
+
+    int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+        return Status(ErrorCodes::SocketException,
+                      str::stream() << "shm_open(" << name
+                                    << ") failed: " << errnoWithDescription());
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        auto ec = errnoWithDescription();
+        close(fd);
+        return Status(ErrorCodes::SocketException,
+                      str::stream() << "fstat(" << name << ") failed: " << ec);
+    }
+
+    void* mapping = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return Status(ErrorCodes::SocketException,
+                      str::stream() << "mmap(" << name << ") failed: " << errnoWithDescription());
+    }
+
+    return std::unique_ptr<ShmSegment>(
+        new ShmSegment(name, mapping, size_t(st.st_size), false /* owner */));
+}
+
+ShmSegment::~ShmSegment() {
+    munmap(_mapping, _size);
+    if (_owner) {
+        shm_unlink(_name.c_str());
+    }
+}
+
+#else  // _WIN32
+
+StatusWith<std::unique_ptr<ShmSegment>> ShmSegment::create(const std::string& name, size_t size) {
+    return Status(ErrorCodes::InvalidOptions,
+                  "The shared memory transport is not supported on this platform");
+}
+
+StatusWith<std::unique_ptr<ShmSegment>> ShmSegment::open(const std::string& name) {
+    return Status(ErrorCodes::InvalidOptions,
+                  "The shared memory transport is not supported on this platform");
+}
+
+ShmSegment::~ShmSegment() {}
+
+#endif  // _WIN32
+
+TransportLayerShm::TransportLayerShm(Options options, ServiceEntryPoint* sep)
+    : _options(std::move(options)), _sep(sep) {}
+
+TransportLayerShm::~TransportLayerShm() {
+    shutdown();
+}
+
+Status TransportLayerShm::setup() {
+    if (!isPowerOfTwo(_options.ringBytes)) {
+        return {ErrorCodes::BadValue, "Shared memory transport ring size must be a power of two"};
+    }
+
+    auto swSegment =
+        ShmSegment::create(_options.name, sizeof(AcceptSegmentLayout) + kAcceptRingBytes);
+    if (!swSegment.isOK()) {
+        return swSegment.getStatus();
+    }
+    _acceptSegment = std::move(swSegment.getValue());
+
+    auto* layout = reinterpret_cast<AcceptSegmentLayout*>(_acceptSegment->data());
+    ShmRingBuffer::initialize(&layout->ring, kAcceptRingBytes);
+    layout->version = AcceptSegmentLayout::kVersion;
+    layout->magic = AcceptSegmentLayout::kMagic;
+
+    _acceptRing = stdx::make_unique<ShmRingBuffer>(
+        &layout->ring, _acceptSegment->data() + sizeof(AcceptSegmentLayout));
+    return Status::OK();
+}
+
+Status TransportLayerShm::start() {
+    invariant(_acceptRing);
+    _acceptThread = stdx::thread([this] { _acceptLoop(); });
+    log() << "listening for shared memory connections on segment " << _options.name;
+    return Status::OK();
+}
+
+void TransportLayerShm::shutdown() {
+    if (_inShutdown.swap(true)) {
+        return;
+    }
+
+    if (_acceptRing) {
+        _acceptRing->close();
+    }
+    if (_acceptThread.joinable()) {
+        _acceptThread.join();
+    }
+    _acceptRing.reset();
+    _acceptSegment.reset();
+}
+
+void TransportLayerShm::_acceptLoop() {
+    while (!_inShutdown.load()) {
+        ConnectRequest request;
+        auto status = _acceptRing->read(reinterpret_cast<char*>(&request), sizeof(request));
+        if (!status.isOK()) {
+            // The ring only fails when it has been closed, i.e. at shutdown.
+            return;
+        }
+        request.segmentName[sizeof(request.segmentName) - 1] = '\0';
+
+        const std::string segmentName(request.segmentName);
+        auto swSegment = ShmSegment::open(segmentName);
+        if (!swSegment.isOK()) {
+            warning() << "failed to accept shared memory connection " << segmentName << ": "
+                      << swSegment.getStatus();
+            continue;
+        }
+
+        auto& segment = swSegment.getValue();
+        const auto* layout = reinterpret_cast<const ShmConnectionLayout*>(segment->data());
+        if (segment->size() < sizeof(ShmConnectionLayout) ||
+            layout->magic != ShmConnectionLayout::kMagic ||
+            layout->version != ShmConnectionLayout::kVersion ||
+            !isPowerOfTwo(layout->ringBytes) ||
+            segment->size() <
+                sizeof(ShmConnectionLayout) + 2 * size_t(layout->ringBytes)) {
+            warning() << "rejecting malformed shared memory connection segment " << segmentName;
+            continue;
+        }
+
+        auto session = std::make_shared<ShmSession>(
+            this, std::move(segment), ShmSession::Side::kServer);
+        _sep->startSession(std::move(session));
+    }
+}
+
+StatusWith<SessionHandle> TransportLayerShm::connectShm(const std::string& name,
+                                                        uint32_t ringBytes,
+                                                        Milliseconds timeout) {
+    if (!isPowerOfTwo(ringBytes)) {
+        return Status(ErrorCodes::BadValue,
+                      "Shared memory transport ring size must be a power of two");
+    }
+
+    auto swAcceptSegment = ShmSegment::open(name);
+    if (!swAcceptSegment.isOK()) {
+        return swAcceptSegment.getStatus();
+    }
+    auto& acceptSegment = swAcceptSegment.getValue();
+
+    auto* acceptLayout = reinterpret_cast<AcceptSegmentLayout*>(acceptSegment->data());
+    if (acceptSegment->size() < sizeof(AcceptSegmentLayout) + kAcceptRingBytes ||
+        acceptLayout->magic != AcceptSegmentLayout::kMagic ||
+        acceptLayout->version != AcceptSegmentLayout::kVersion) {
+        return Status(ErrorCodes::ProtocolError,
+                      str::stream() << "Segment " << name
+                                    << " is not a shared memory accept segment");
+    }
+
+    // Create and initialize this connection's segment before publishing its name.
+    static AtomicWord<unsigned long long> connectCounter;
+    const std::string segmentName = str::stream() << name << "-"
+                                                  << ProcessId::getCurrent().asInt64() << "-"
+                                                  << connectCounter.fetchAndAdd(1);
+
+    auto swSegment = ShmSegment::create(
+        segmentName, sizeof(ShmConnectionLayout) + 2 * size_t(ringBytes));
+    if (!swSegment.isOK()) {
+        return swSegment.getStatus();
+    }
+    auto& segment = swSegment.getValue();
+
+    auto* layout = reinterpret_cast<ShmConnectionLayout*>(segment->data());
+    ShmRingBuffer::initialize(&layout->clientToServer, ringBytes);
+    ShmRingBuffer::initialize(&layout->serverToClient, ringBytes);
+    layout->ringBytes = ringBytes;
+    layout->version = ShmConnectionLayout::kVersion;
+    layout->magic = ShmConnectionLayout::kMagic;
+
+    ConnectRequest request;
+    memset(&request, 0, sizeof(request));
+    strncpy(request.segmentName, segmentName.c_str(), sizeof(request.segmentName) - 1);
+
+    ShmRingBuffer acceptRing(&acceptLayout->ring,
+                             acceptSegment->data() + sizeof(AcceptSegmentLayout));
+    auto status = acceptRing.write(
+        reinterpret_cast<const char*>(&request), sizeof(request), timeout);
+    if (!status.isOK()) {
+        return status;
+    }
+
+    return SessionHandle(std::make_shared<ShmSession>(
+        nullptr, std::move(segment), ShmSession::Side::kClient));
+}
+
+StatusWith<SessionHandle> TransportLayerShm::connect(HostAndPort peer,
+                                                     ConnectSSLMode sslMode,
+                                                     Milliseconds timeout) {
+    return Status(ErrorCodes::HostUnreachable,
+                  "Shared memory peers are not addressable by host and port; use connectShm()");
+}
+
+Future<SessionHandle> TransportLayerShm::asyncConnect(HostAndPort peer,
+                                                      ConnectSSLMode sslMode,
+                                                      const ReactorHandle& reactor,
+                                                      Milliseconds timeout) {
+    return connect(std::move(peer), sslMode, timeout);
+}
+
+}  // namespace transport
+}  // namespace mongo
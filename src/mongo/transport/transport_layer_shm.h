@@ -0,0 +1,152 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "mongo/base/status_with.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/transport/shm_ring_buffer.h"
+#include "mongo/transport/transport_layer.h"
+
+namespace mongo {
+
+class ServiceEntryPoint;
+
+namespace transport {
+
+/**
+ * RAII wrapper around one POSIX shared memory segment mapping. The creating side owns the name
+ * and unlinks it on destruction; an opening side only unmaps.
+ */
+class ShmSegment {
+    MONGO_DISALLOW_COPYING(ShmSegment);
+
+public:
+    static StatusWith<std::unique_ptr<ShmSegment>> create(const std::string& name, size_t size);
+    static StatusWith<std::unique_ptr<ShmSegment>> open(const std::string& name);
+
+    ~ShmSegment();
+
+    char* data() const {
+        return static_cast<char*>(_mapping);
+    }
+
+    size_t size() const {
+        return _size;
+    }
+
+    const std::string& name() const {
+        return _name;
+    }
+
+private:
+    ShmSegment(std::string name, void* mapping, size_t size, bool owner)
+        : _name(std::move(name)), _mapping(mapping), _size(size), _owner(owner) {}
+
+    std::string _name;
+    void* _mapping;
+    size_t _size;
+    bool _owner;
+};
+
+/**
+ * A TransportLayer over ring buffers in POSIX shared memory, for clients co-located on the same
+ * host as the server (e.g. a sidecar mongos beside application pods, where loopback TCP still
+ * pays per-message syscalls and copies). Each connection is one shared memory segment holding a
+ * pair of single-producer single-consumer rings, one per direction, with futex wakeups; sourcing
+ * or sinking a message is then a memcpy plus an occasional wake, with no syscalls on the data
+ * path while both sides keep up.
+ *
+ * Connection establishment rendezvouses over a well-known "accept" segment owned by the server:
+ * a connecting client creates its connection segment and posts the segment's name into the
+ * accept ring, where the listener thread picks it up.
+ *
+ * Only synchronous operation is supported (the async Session methods complete inline), so this
+ * layer should be served by a synchronous service executor. The transport is enabled explicitly
+ * by constructing it with a segment name; peers are not addressable by HostAndPort and there is
+ * no automatic same-host detection.
+ */
+class TransportLayerShm final : public TransportLayer {
+    MONGO_DISALLOW_COPYING(TransportLayerShm);
+
+public:
+    struct Options {
+        // Name of the accept segment, e.g. "/mongodb-shm-27017". Must begin with '/'.
+        std::string name;
+
+        // Data bytes per direction for each connection. Must be a power of two.
+        uint32_t ringBytes = 1 << 20;
+    };
+
+    TransportLayerShm(Options options, ServiceEntryPoint* sep);
+    ~TransportLayerShm() override;
+
+    /**
+     * Creates a client connection to the server accepting on segment 'name'. This is the shared
+     * memory analogue of connect(). The returned session is not owned by any transport layer.
+     */
+    static StatusWith<SessionHandle> connectShm(const std::string& name,
+                                                uint32_t ringBytes,
+                                                Milliseconds timeout);
+
+    StatusWith<SessionHandle> connect(HostAndPort peer,
+                                      ConnectSSLMode sslMode,
+                                      Milliseconds timeout) override;
+
+    Future<SessionHandle> asyncConnect(HostAndPort peer,
+                                       ConnectSSLMode sslMode,
+                                       const ReactorHandle& reactor,
+                                       Milliseconds timeout) override;
+
+    Status setup() override;
+    Status start() override;
+    void shutdown() override;
+
+    ReactorHandle getReactor(WhichReactor which) override {
+        return nullptr;
+    }
+
+private:
+    void _acceptLoop();
+
+    const Options _options;
+    ServiceEntryPoint* const _sep;
+
+    std::unique_ptr<ShmSegment> _acceptSegment;
+    std::unique_ptr<ShmRingBuffer> _acceptRing;
+    stdx::thread _acceptThread;
+    AtomicWord<bool> _inShutdown{false};
+};
+
+}  // namespace transport
+}  // namespace mongo
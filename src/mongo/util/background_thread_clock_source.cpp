@@ -72,11 +72,14 @@ Status BackgroundThreadClockSource::setAlarm(Date_t when, unique_function<void()
 
 Date_t BackgroundThreadClockSource::now() {
     // Since this is called very frequently by many threads, the common case should not write to
-    // shared memory.
-    if (MONGO_unlikely(_timerWillPause.load())) {
+    // shared memory or use barriered loads.  Relaxed reads suffice: the timer thread republishes
+    // _current every _granularity, so a stale value is no worse than this clock's precision
+    // already allows, and the pause handshake stays safe because a pausing timer zeroes _current,
+    // which diverts readers to _slowNow() as soon as that store becomes visible.
+    if (MONGO_unlikely(_timerWillPause.loadRelaxed())) {
         return _slowNow();
     }
-    auto now = _current.load();
+    auto now = _current.loadRelaxed();
     if (MONGO_unlikely(!now)) {
         return _slowNow();
     }
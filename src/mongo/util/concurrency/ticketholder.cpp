@@ -34,10 +34,14 @@
 
 #include "mongo/util/concurrency/ticketholder.h"
 
+#include <algorithm>
 #include <iostream>
 
+#include "mongo/stdx/thread.h"
 #include "mongo/util/log.h"
 #include "mongo/util/mongoutils/str.h"
+#include "mongo/util/scopeguard.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
@@ -94,6 +98,14 @@ void TicketHolder::waitForTicket(OperationContext* opCtx) {
 }
 
 bool TicketHolder::waitForTicketUntil(OperationContext* opCtx, Date_t until) {
+    // Attempt a cheap acquire first so the uncontended path never touches the clock.
+    if (tryAcquire())
+        return true;
+
+    Timer queueTimer;
+    const auto recordQueueTime =
+        makeGuard([&] { _queuedTimeMicros.fetchAndAdd(queueTimer.micros()); });
+
     const Milliseconds intervalMs(500);
     struct timespec ts;
 
@@ -182,6 +194,12 @@ bool TicketHolder::tryAcquire() {
 
 void TicketHolder::waitForTicket(OperationContext* opCtx) {
     stdx::unique_lock<stdx::mutex> lk(_mutex);
+    if (_tryAcquire())
+        return;
+
+    Timer queueTimer;
+    const auto recordQueueTime =
+        makeGuard([&] { _queuedTimeMicros.fetchAndAdd(queueTimer.micros()); });
 
     if (opCtx) {
         opCtx->waitForConditionOrInterrupt(_newTicket, lk, [this] { return _tryAcquire(); });
@@ -192,6 +210,12 @@ void TicketHolder::waitForTicket(OperationContext* opCtx) {
 
 bool TicketHolder::waitForTicketUntil(OperationContext* opCtx, Date_t until) {
     stdx::unique_lock<stdx::mutex> lk(_mutex);
+    if (_tryAcquire())
+        return true;
+
+    Timer queueTimer;
+    const auto recordQueueTime =
+        makeGuard([&] { _queuedTimeMicros.fetchAndAdd(queueTimer.micros()); });
 
     if (opCtx) {
         return opCtx->waitForConditionOrInterruptUntil(
@@ -255,4 +279,111 @@ bool TicketHolder::_tryAcquire() {
     return true;
 }
 #endif
+
+LockFreeTicketHolder::LockFreeTicketHolder(int num) : _tickets(num), _outof(num) {}
+
+LockFreeTicketHolder::~LockFreeTicketHolder() = default;
+
+bool LockFreeTicketHolder::_tryAcquireFast() {
+    // Speculatively take a ticket; if the pool was exhausted, put it back. The uncontended
+    // acquire is thus a single fetch-and-subtract.
+    if (_tickets.subtractAndFetch(1) >= 0) {
+        return true;
+    }
+    _tickets.addAndFetch(1);
+    return false;
+}
+
+bool LockFreeTicketHolder::tryAcquire() {
+    // Cheap read avoids cache line ping-pong from failed speculative decrements when the pool
+    // is exhausted.
+    if (_tickets.load() <= 0) {
+        return false;
+    }
+    return _tryAcquireFast();
+}
+
+void LockFreeTicketHolder::waitForTicket(OperationContext* opCtx) {
+    waitForTicketUntil(opCtx, Date_t::max());
+}
+
+bool LockFreeTicketHolder::waitForTicketUntil(OperationContext* opCtx, Date_t until) {
+    if (tryAcquire()) {
+        return true;
+    }
+
+    Timer queueTimer;
+    const auto recordQueueTime =
+        makeGuard([&] { _queuedTimeMicros.fetchAndAdd(queueTimer.micros()); });
+
+    // Proportional backoff: spin a bit before parking, yielding more aggressively the longer
+    // tickets stay exhausted. This rides out the common case where a ticket is returned within
+    // a few microseconds without any kernel involvement.
+    for (int attempt = 0; attempt < 32; ++attempt) {
+        if (tryAcquire()) {
+            return true;
+        }
+        if (attempt >= 8) {
+            stdx::this_thread::yield();
+        }
+    }
+
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    _waiters.addAndFetch(1);
+    const auto guard = makeGuard([&] { _waiters.subtractAndFetch(1); });
+
+    const auto acquired = [&] {
+        if (opCtx) {
+            return opCtx->waitForConditionOrInterruptUntil(
+                _newTicket, lk, until, [&] { return tryAcquire(); });
+        }
+        return _newTicket.wait_until(lk, until.toSystemTimePoint(), [&] { return tryAcquire(); });
+    }();
+
+    return acquired;
+}
+
+void LockFreeTicketHolder::release() {
+    _tickets.addAndFetch(1);
+    // Only touch the mutex when someone is parked. The waiter count is incremented under
+    // _mutex before the waiter re-checks for a ticket, so a release that misses the counter
+    // update is guaranteed to have made its ticket visible to that re-check.
+    if (_waiters.load() > 0) {
+        {
+            stdx::lock_guard<stdx::mutex> lk(_mutex);
+        }
+        _newTicket.notify_one();
+    }
+}
+
+Status LockFreeTicketHolder::resize(int newSize) {
+    stdx::lock_guard<stdx::mutex> lk(_resizeMutex);
+
+    if (newSize < 5)
+        return Status(ErrorCodes::BadValue,
+                      str::stream() << "Minimum value for ticket holder is 5; given " << newSize);
+
+    // Applying the delta to the available count lets a shrink proceed without blocking; the
+    // count simply stays negative until enough tickets have been returned.
+    const int delta = newSize - _outof.swap(newSize);
+    _tickets.addAndFetch(delta);
+
+    if (delta > 0) {
+        stdx::lock_guard<stdx::mutex> waitersLk(_mutex);
+        _newTicket.notify_all();
+    }
+    return Status::OK();
+}
+
+int LockFreeTicketHolder::available() const {
+    return std::max(_tickets.load(), 0);
+}
+
+int LockFreeTicketHolder::used() const {
+    return outof() - available();
+}
+
+int LockFreeTicketHolder::outof() const {
+    return _outof.load();
+}
 }
@@ -82,7 +82,18 @@ public:
 
     int outof() const;
 
+    /**
+     * Returns the cumulative time, in microseconds, that acquirers have spent queued waiting for
+     * a ticket since startup. Only waits that did not succeed immediately are counted, so the
+     * uncontended path never touches the clock.
+     */
+    long long queuedTimeMicros() const {
+        return _queuedTimeMicros.load();
+    }
+
 private:
+    AtomicWord<long long> _queuedTimeMicros{0};
+
 #if defined(__linux__)
     mutable sem_t _sem;
 
@@ -99,6 +110,78 @@ private:
 #endif
 };
 
+/**
+ * A ticket holder whose uncontended acquire and release are each a single atomic
+ * fetch-and-add; no futex or semaphore is touched unless tickets are exhausted. When they are,
+ * acquirers spin briefly with proportional backoff and only then park on a condition variable.
+ * This keeps many-core boxes from serializing on the kernel when the ticket pool is large
+ * relative to the arrival rate.
+ *
+ * Mirrors TicketHolder's interface so call sites can choose between the two.
+ */
+class LockFreeTicketHolder {
+    MONGO_DISALLOW_COPYING(LockFreeTicketHolder);
+
+public:
+    explicit LockFreeTicketHolder(int num);
+    ~LockFreeTicketHolder();
+
+    bool tryAcquire();
+
+    /**
+     * See TicketHolder::waitForTicket.
+     */
+    void waitForTicket(OperationContext* opCtx);
+    void waitForTicket() {
+        waitForTicket(nullptr);
+    }
+
+    /**
+     * See TicketHolder::waitForTicketUntil.
+     */
+    bool waitForTicketUntil(OperationContext* opCtx, Date_t until);
+    bool waitForTicketUntil(Date_t until) {
+        return waitForTicketUntil(nullptr, until);
+    }
+
+    void release();
+
+    Status resize(int newSize);
+
+    int available() const;
+
+    int used() const;
+
+    int outof() const;
+
+    /**
+     * See TicketHolder::queuedTimeMicros.
+     */
+    long long queuedTimeMicros() const {
+        return _queuedTimeMicros.load();
+    }
+
+private:
+    bool _tryAcquireFast();
+
+    // Counts available tickets. Transiently dips below zero while an unsuccessful acquirer
+    // corrects its speculative decrement, and after a shrinking resize until enough tickets are
+    // returned.
+    AtomicWord<int> _tickets;
+
+    // Number of threads parked (or about to park) on _newTicket. release() only takes _mutex
+    // when this is non-zero.
+    AtomicWord<int> _waiters{0};
+
+    AtomicWord<long long> _queuedTimeMicros{0};
+
+    AtomicWord<int> _outof;
+
+    stdx::mutex _mutex;
+    stdx::condition_variable _newTicket;
+    stdx::mutex _resizeMutex;
+};
+
 class ScopedTicket {
 public:
     ScopedTicket(TicketHolder* holder) : _holder(holder) {
@@ -0,0 +1,81 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+
+#include "mongo/util/concurrency/ticketholder.h"
+
+namespace mongo {
+namespace {
+
+// The uncontended pool is sized so it is never exhausted at the maximum benchmark thread count;
+// this isolates the cost of the acquire/release fast path itself.
+const int kUncontendedTickets = 128;
+
+// The contended pool is deliberately smaller than the thread count so acquirers regularly find
+// the pool exhausted and exercise the slow path.
+const int kContendedTickets = 2;
+
+template <typename HolderType>
+void acquireReleaseLoop(HolderType& holder, benchmark::State& state) {
+    for (auto _ : state) {
+        holder.waitForTicket();
+        holder.release();
+    }
+}
+
+void BM_semaphoreUncontended(benchmark::State& state) {
+    static TicketHolder holder(kUncontendedTickets);
+    acquireReleaseLoop(holder, state);
+}
+
+void BM_lockFreeUncontended(benchmark::State& state) {
+    static LockFreeTicketHolder holder(kUncontendedTickets);
+    acquireReleaseLoop(holder, state);
+}
+
+void BM_semaphoreContended(benchmark::State& state) {
+    static TicketHolder holder(kContendedTickets);
+    acquireReleaseLoop(holder, state);
+}
+
+void BM_lockFreeContended(benchmark::State& state) {
+    static LockFreeTicketHolder holder(kContendedTickets);
+    acquireReleaseLoop(holder, state);
+}
+
+BENCHMARK(BM_semaphoreUncontended)->ThreadRange(1, 32);
+BENCHMARK(BM_lockFreeUncontended)->ThreadRange(1, 32);
+BENCHMARK(BM_semaphoreContended)->ThreadRange(1, 8);
+BENCHMARK(BM_lockFreeContended)->ThreadRange(1, 8);
+
+}  // namespace
+}  // namespace mongo
@@ -73,4 +73,60 @@ TEST(TicketholderTest, BasicTimeout) {
     holder.release();
     ASSERT_EQ(holder.used(), 0);
 }
+
+TEST(TicketholderTest, LockFreeBasicTimeout) {
+    LockFreeTicketHolder holder(1);
+    ASSERT_EQ(holder.used(), 0);
+    ASSERT_EQ(holder.available(), 1);
+    ASSERT_EQ(holder.outof(), 1);
+
+    ASSERT_TRUE(holder.tryAcquire());
+    ASSERT_EQ(holder.used(), 1);
+    ASSERT_EQ(holder.available(), 0);
+    ASSERT_EQ(holder.outof(), 1);
+
+    ASSERT_FALSE(holder.tryAcquire());
+    ASSERT_FALSE(holder.waitForTicketUntil(Date_t::now()));
+    ASSERT_FALSE(holder.waitForTicketUntil(Date_t::now() + Milliseconds(1)));
+
+    holder.release();
+    ASSERT_EQ(holder.used(), 0);
+    ASSERT_EQ(holder.available(), 1);
+
+    ASSERT(holder.waitForTicketUntil(Date_t::now()));
+    ASSERT_EQ(holder.used(), 1);
+    holder.release();
+    ASSERT_EQ(holder.used(), 0);
+}
+
+TEST(TicketholderTest, LockFreeResize) {
+    LockFreeTicketHolder holder(10);
+
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(holder.tryAcquire());
+    }
+    ASSERT_FALSE(holder.tryAcquire());
+    ASSERT_EQ(holder.used(), 10);
+
+    // Growing makes the extra tickets immediately available.
+    ASSERT_OK(holder.resize(12));
+    ASSERT_EQ(holder.outof(), 12);
+    ASSERT_EQ(holder.available(), 2);
+    ASSERT_TRUE(holder.tryAcquire());
+
+    // Shrinking below the used count succeeds; acquires stay blocked until enough tickets are
+    // returned.
+    ASSERT_OK(holder.resize(5));
+    ASSERT_EQ(holder.outof(), 5);
+    ASSERT_EQ(holder.available(), 0);
+    ASSERT_FALSE(holder.tryAcquire());
+
+    for (int i = 0; i < 11; ++i) {
+        holder.release();
+    }
+    ASSERT_EQ(holder.used(), 0);
+    ASSERT_EQ(holder.available(), 5);
+
+    ASSERT_NOT_OK(holder.resize(1));
+}
 }  // namespace
@@ -0,0 +1,205 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/crc32c.h"
+
+#include <cstring>
+
+#include "mongo/platform/endian.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#include <nmmintrin.h>
+#define MONGO_HAVE_CRC32C_SSE42 1
+#elif defined(__x86_64__)
+#include <cpuid.h>
+#include <nmmintrin.h>
+#define MONGO_HAVE_CRC32C_SSE42 1
+#define MONGO_CRC32C_SSE42_TARGET __attribute__((target("sse4.2")))
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define MONGO_HAVE_CRC32C_ARMV8 1
+#endif
+
+#ifndef MONGO_CRC32C_SSE42_TARGET
+#define MONGO_CRC32C_SSE42_TARGET
+#endif
+
+namespace mongo {
+namespace {
+
+using Crc32cImpl = uint32_t (*)(uint32_t, const char*, size_t);
+
+// CRC-32C (Castagnoli) polynomial, reflected.
+constexpr uint32_t kPolynomial = 0x82f63b78U;
+
+// Lookup tables for the slicing-by-eight software implementation, built once on first use.
+struct SlicingTables {
+    SlicingTables() {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc >> 1) ^ ((crc & 1) ? kPolynomial : 0);
+            }
+            entries[0][i] = crc;
+        }
+        for (int slice = 1; slice < 8; ++slice) {
+            for (uint32_t i = 0; i < 256; ++i) {
+                const uint32_t prev = entries[slice - 1][i];
+                entries[slice][i] = (prev >> 8) ^ entries[0][prev & 0xff];
+            }
+        }
+    }
+
+    uint32_t entries[8][256];
+};
+
+uint32_t crc32cSoftware(uint32_t crc, const char* data, size_t size) {
+    static const SlicingTables& tables = *new SlicingTables();  // Intentionally never destroyed.
+    const auto* p = reinterpret_cast<const unsigned char*>(data);
+
+    while (size > 0 && (reinterpret_cast<uintptr_t>(p) & 7) != 0) {
+        crc = tables.entries[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+        --size;
+    }
+
+    while (size >= 8) {
+        uint64_t chunk;
+        memcpy(&chunk, p, sizeof(chunk));
+        const uint64_t le = endian::littleToNative(chunk);
+        const uint32_t low = static_cast<uint32_t>(le) ^ crc;
+        const uint32_t high = static_cast<uint32_t>(le >> 32);
+        crc = tables.entries[7][low & 0xff] ^ tables.entries[6][(low >> 8) & 0xff] ^
+            tables.entries[5][(low >> 16) & 0xff] ^ tables.entries[4][low >> 24] ^
+            tables.entries[3][high & 0xff] ^ tables.entries[2][(high >> 8) & 0xff] ^
+            tables.entries[1][(high >> 16) & 0xff] ^ tables.entries[0][high >> 24];
+        p += 8;
+        size -= 8;
+    }
+
+    while (size > 0) {
+        crc = tables.entries[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+        --size;
+    }
+
+    return crc;
+}
+
+#if defined(MONGO_HAVE_CRC32C_SSE42)
+
+MONGO_CRC32C_SSE42_TARGET uint32_t crc32cHardware(uint32_t crc, const char* data, size_t size) {
+    const auto* p = reinterpret_cast<const unsigned char*>(data);
+    uint64_t crc64 = crc;
+
+    while (size > 0 && (reinterpret_cast<uintptr_t>(p) & 7) != 0) {
+        crc64 = _mm_crc32_u8(static_cast<uint32_t>(crc64), *p++);
+        --size;
+    }
+
+    while (size >= 8) {
+        uint64_t chunk;
+        memcpy(&chunk, p, sizeof(chunk));
+        crc64 = _mm_crc32_u64(crc64, chunk);
+        p += 8;
+        size -= 8;
+    }
+
+    while (size > 0) {
+        crc64 = _mm_crc32_u8(static_cast<uint32_t>(crc64), *p++);
+        --size;
+    }
+
+    return static_cast<uint32_t>(crc64);
+}
+
+bool haveSse42() {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 20)) != 0;
+#else
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+        return false;
+    }
+    return (ecx & (1U << 20)) != 0;
+#endif
+}
+
+#elif defined(MONGO_HAVE_CRC32C_ARMV8)
+
+uint32_t crc32cHardware(uint32_t crc, const char* data, size_t size) {
+    const auto* p = reinterpret_cast<const unsigned char*>(data);
+
+    while (size > 0 && (reinterpret_cast<uintptr_t>(p) & 7) != 0) {
+        crc = __crc32cb(crc, *p++);
+        --size;
+    }
+
+    while (size >= 8) {
+        uint64_t chunk;
+        memcpy(&chunk, p, sizeof(chunk));
+        crc = __crc32cd(crc, chunk);
+        p += 8;
+        size -= 8;
+    }
+
+    while (size > 0) {
+        crc = __crc32cb(crc, *p++);
+        --size;
+    }
+
+    return crc;
+}
+
+#endif
+
+Crc32cImpl pickImplementation() {
+#if defined(MONGO_HAVE_CRC32C_SSE42)
+    if (haveSse42()) {
+        return crc32cHardware;
+    }
+#elif defined(MONGO_HAVE_CRC32C_ARMV8)
+    // __ARM_FEATURE_CRC32 means the compiler was told the target supports the CRC32 extension.
+    return crc32cHardware;
+#endif
+    return crc32cSoftware;
+}
+
+}  // namespace
+
+uint32_t crc32c(const void* data, size_t size) {
+    static const Crc32cImpl impl = pickImplementation();
+    return ~impl(0xffffffffU, static_cast<const char*>(data), size);
+}
+
+}  // namespace mongo
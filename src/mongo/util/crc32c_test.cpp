@@ -0,0 +1,79 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/crc32c.h"
+
+#include <string>
+
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+// Test vectors from RFC 3720 appendix B.4.
+TEST(Crc32c, KnownVectors) {
+    ASSERT_EQUALS(0x0U, crc32c("", 0));
+
+    const std::string numbers = "123456789";
+    ASSERT_EQUALS(0xE3069283U, crc32c(numbers.data(), numbers.size()));
+
+    const std::string zeros(32, '\x00');
+    ASSERT_EQUALS(0x8A9136AAU, crc32c(zeros.data(), zeros.size()));
+
+    const std::string ones(32, '\xff');
+    ASSERT_EQUALS(0x62A8AB43U, crc32c(ones.data(), ones.size()));
+
+    std::string incrementing;
+    for (int i = 0; i < 32; ++i) {
+        incrementing.push_back(static_cast<char>(i));
+    }
+    ASSERT_EQUALS(0x46DD794EU, crc32c(incrementing.data(), incrementing.size()));
+}
+
+// The checksum of a byte range must not depend on the alignment of the buffer holding it, since
+// both implementations take byte-at-a-time prologues before their 8-byte main loops.
+TEST(Crc32c, IndependentOfAlignment) {
+    std::string data;
+    for (int i = 0; i < 1021; ++i) {
+        data.push_back(static_cast<char>(i * 131));
+    }
+    const uint32_t expected = crc32c(data.data(), data.size());
+
+    for (size_t offset = 1; offset <= 8; ++offset) {
+        std::string shifted(offset, '\x00');
+        shifted += data;
+        ASSERT_EQUALS(expected, crc32c(shifted.data() + offset, data.size()));
+    }
+}
+
+}  // namespace
+}  // namespace mongo
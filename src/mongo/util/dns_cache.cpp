@@ -0,0 +1,185 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/dns_cache.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_name.h"
+#include "mongo/util/system_clock_source.h"
+
+namespace mongo {
+namespace dns {
+
+DNSResolverCache::DNSResolverCache()
+    : DNSResolverCache(
+          [](const std::string& service) { return lookupSRVRecordsWithTTL(service); },
+          [](const std::string& service) { return getTXTRecordsWithTTL(service); },
+          SystemClockSource::get(),
+          Options()) {}
+
+DNSResolverCache::DNSResolverCache(SRVLookupFn srvLookup,
+                                   TXTLookupFn txtLookup,
+                                   ClockSource* clockSource,
+                                   Options options)
+    : _srvLookup(std::move(srvLookup)),
+      _txtLookup(std::move(txtLookup)),
+      _clockSource(clockSource),
+      _options(options),
+      _refresher([this] { _refreshLoop(); }) {
+    invariant(_options.minCacheTTL <= _options.maxCacheTTL);
+}
+
+DNSResolverCache::~DNSResolverCache() {
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _shutdown = true;
+    }
+    _refreshCV.notify_one();
+    _refresher.join();
+}
+
+std::vector<SRVHostEntry> DNSResolverCache::lookupSRVRecords(const std::string& service) {
+    return _cachedLookup(&_srvCache, &_srvRefreshQueue, _srvLookup, service).records;
+}
+
+std::vector<std::string> DNSResolverCache::getTXTRecords(const std::string& service) {
+    return _cachedLookup(&_txtCache, &_txtRefreshQueue, _txtLookup, service).records;
+}
+
+template <typename LookupResult, typename LookupFn>
+auto DNSResolverCache::_resolve(const LookupFn& lookupFn, const std::string& service)
+    -> Entry<LookupResult> {
+    Entry<LookupResult> entry;
+    try {
+        entry.result = lookupFn(service);
+    } catch (const ExceptionFor<ErrorCodes::DNSHostNotFound>& ex) {
+        entry.status = ex.toStatus();
+        entry.expiration = _clockSource->now() + _options.negativeCacheTTL;
+        entry.refreshAfter = Date_t::max();
+        return entry;
+    }
+
+    const auto now = _clockSource->now();
+    const auto ttl =
+        std::min(std::max(entry.result.ttl, _options.minCacheTTL), _options.maxCacheTTL);
+    entry.expiration = now + ttl;
+    entry.refreshAfter = now + ttl / 2;
+    return entry;
+}
+
+template <typename LookupResult, typename LookupFn>
+LookupResult DNSResolverCache::_cachedLookup(Cache<LookupResult>* cache,
+                                             std::vector<std::string>* refreshQueue,
+                                             const LookupFn& lookupFn,
+                                             const std::string& service) {
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        auto it = cache->find(service);
+        if (it != cache->end()) {
+            auto& entry = it->second;
+            const auto now = _clockSource->now();
+            if (now < entry.expiration) {
+                uassertStatusOK(entry.status);
+                if (now >= entry.refreshAfter && !entry.refreshInFlight) {
+                    entry.refreshInFlight = true;
+                    refreshQueue->push_back(service);
+                    _refreshCV.notify_one();
+                }
+                return entry.result;
+            }
+            cache->erase(it);
+        }
+    }
+
+    // Miss or expired entry: resolve inline without holding the mutex.
+    auto entry = _resolve<LookupResult>(lookupFn, service);
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    auto& stored = (*cache)[service] = std::move(entry);
+    uassertStatusOK(stored.status);
+    return stored.result;
+}
+
+void DNSResolverCache::_refreshLoop() {
+    setThreadName("DNSCacheRefresher");
+
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    while (true) {
+        _refreshCV.wait(lk, [&] {
+            return _shutdown || !_srvRefreshQueue.empty() || !_txtRefreshQueue.empty();
+        });
+        if (_shutdown) {
+            return;
+        }
+
+        _drainRefreshQueue(&_srvCache, &_srvRefreshQueue, _srvLookup, lk);
+        _drainRefreshQueue(&_txtCache, &_txtRefreshQueue, _txtLookup, lk);
+    }
+}
+
+template <typename LookupResult, typename LookupFn>
+void DNSResolverCache::_drainRefreshQueue(Cache<LookupResult>* cache,
+                                          std::vector<std::string>* refreshQueue,
+                                          const LookupFn& lookupFn,
+                                          stdx::unique_lock<stdx::mutex>& lk) {
+    while (!refreshQueue->empty() && !_shutdown) {
+        const auto service = std::move(refreshQueue->back());
+        refreshQueue->pop_back();
+
+        lk.unlock();
+        try {
+            auto entry = _resolve<LookupResult>(lookupFn, service);
+            lk.lock();
+            (*cache)[service] = std::move(entry);
+        } catch (const DBException&) {
+            // A transient resolver failure: keep serving the existing records until they expire,
+            // after which the next lookup retries inline.
+            lk.lock();
+            auto it = cache->find(service);
+            if (it != cache->end()) {
+                it->second.refreshInFlight = false;
+            }
+        }
+    }
+}
+
+DNSResolverCache& globalDNSCache() {
+    // Intentionally leaked so the refresh thread never races static destruction at shutdown.
+    static DNSResolverCache* cache = new DNSResolverCache();
+    return *cache;
+}
+
+}  // namespace dns
+}  // namespace mongo
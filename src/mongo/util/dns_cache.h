@@ -0,0 +1,181 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "mongo/base/status.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/functional.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/clock_source.h"
+#include "mongo/util/dns_query.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+namespace dns {
+
+/**
+ * A TTL-respecting in-process cache over the blocking resolvers in `dns_query.h`.
+ *
+ * Positive results are served from the cache until the smallest TTL among the looked-up records
+ * expires, clamped between `Options::minCacheTTL` and `Options::maxCacheTTL`. Once half of an
+ * entry's lifetime has elapsed, lookups still return the cached records but schedule a refresh on
+ * the cache's background thread, so names which are resolved regularly never pay resolver latency
+ * after their first resolution. Lookups which fail with `DNSHostNotFound` are cached negatively
+ * for `Options::negativeCacheTTL` and rethrown from the cache; other resolver errors are not
+ * cached.
+ *
+ * All methods are thread-safe. The cache's mutex is not held across resolver calls, so concurrent
+ * first-time lookups of the same name may each consult the resolver; the last writer wins, which
+ * is benign for DNS.
+ */
+class DNSResolverCache {
+public:
+    struct Options {
+        // Upper and lower clamps applied to record TTLs before use.
+        Seconds maxCacheTTL{600};
+        Seconds minCacheTTL{10};
+
+        // How long a `DNSHostNotFound` result is served from the cache.
+        Seconds negativeCacheTTL{5};
+    };
+
+    using SRVLookupFn = stdx::function<SRVLookupResult(const std::string&)>;
+    using TXTLookupFn = stdx::function<TXTLookupResult(const std::string&)>;
+
+    /**
+     * Constructs a cache over the real resolvers in `dns_query.h` and the system clock.
+     */
+    DNSResolverCache();
+
+    /**
+     * Constructs a cache with injected resolvers, clock, and tuning, for testing.
+     */
+    DNSResolverCache(SRVLookupFn srvLookup,
+                     TXTLookupFn txtLookup,
+                     ClockSource* clockSource,
+                     Options options);
+
+    ~DNSResolverCache();
+
+    /**
+     * As `dns::lookupSRVRecords`, but served from the cache when possible.
+     */
+    std::vector<SRVHostEntry> lookupSRVRecords(const std::string& service);
+
+    /**
+     * As `dns::getTXTRecords`, but served from the cache when possible.
+     */
+    std::vector<std::string> getTXTRecords(const std::string& service);
+
+private:
+    template <typename LookupResult>
+    struct Entry {
+        // Valid when `status` is OK; otherwise `status` holds the cached negative result.
+        LookupResult result;
+        Status status = Status::OK();
+
+        Date_t expiration;
+
+        // When the entry becomes eligible for a background refresh. Date_t::max() for negative
+        // entries, which simply expire.
+        Date_t refreshAfter;
+
+        bool refreshInFlight = false;
+    };
+
+    template <typename LookupResult>
+    using Cache = stdx::unordered_map<std::string, Entry<LookupResult>>;
+
+    /**
+     * Performs a blocking resolution of 'service' and packages the outcome (including a cached
+     * negative result for `DNSHostNotFound`) as a cache entry. Must be called without the cache
+     * mutex held; resolver errors other than `DNSHostNotFound` propagate to the caller.
+     */
+    template <typename LookupResult, typename LookupFn>
+    Entry<LookupResult> _resolve(const LookupFn& lookupFn, const std::string& service);
+
+    /**
+     * Serves 'service' from 'cache', falling back to an inline resolution on a miss or an expired
+     * entry, and scheduling a background refresh when the entry has passed its half-life.
+     */
+    template <typename LookupResult, typename LookupFn>
+    LookupResult _cachedLookup(Cache<LookupResult>* cache,
+                               std::vector<std::string>* refreshQueue,
+                               const LookupFn& lookupFn,
+                               const std::string& service);
+
+    /**
+     * Body of the background refresh thread: re-resolves names queued by _cachedLookup() until
+     * shutdown.
+     */
+    void _refreshLoop();
+
+    template <typename LookupResult, typename LookupFn>
+    void _drainRefreshQueue(Cache<LookupResult>* cache,
+                            std::vector<std::string>* refreshQueue,
+                            const LookupFn& lookupFn,
+                            stdx::unique_lock<stdx::mutex>& lk);
+
+    const SRVLookupFn _srvLookup;
+    const TXTLookupFn _txtLookup;
+    ClockSource* const _clockSource;
+    const Options _options;
+
+    stdx::mutex _mutex;
+    Cache<SRVLookupResult> _srvCache;
+    Cache<TXTLookupResult> _txtCache;
+
+    // Names whose cached entry has passed its refreshAfter point, awaiting re-resolution by the
+    // refresh thread. Guarded by _mutex.
+    std::vector<std::string> _srvRefreshQueue;
+    std::vector<std::string> _txtRefreshQueue;
+
+    // Guarded by _mutex; signalled when work is queued for the refresh thread or on shutdown.
+    bool _shutdown = false;
+    stdx::condition_variable _refreshCV;
+
+    // Must be initialized last so the thread observes fully-constructed state.
+    stdx::thread _refresher;
+};
+
+/**
+ * The process-wide resolver cache, used for mongodb+srv:// seed list resolution.
+ */
+DNSResolverCache& globalDNSCache();
+
+}  // namespace dns
+}  // namespace mongo
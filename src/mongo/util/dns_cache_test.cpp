@@ -0,0 +1,173 @@
+
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/dns_cache.h"
+
+#include <boost/optional.hpp>
+
+#include "mongo/platform/atomic_word.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/clock_source_mock.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+namespace dns {
+namespace {
+
+const std::string kService = "_mongodb._tcp.example.com";
+
+class DNSResolverCacheTest : public unittest::Test {
+protected:
+    DNSResolverCacheTest() {
+        _options.minCacheTTL = Seconds(10);
+        _options.maxCacheTTL = Seconds(600);
+        _options.negativeCacheTTL = Seconds(5);
+    }
+
+    DNSResolverCache& cache() {
+        if (!_cache) {
+            _cache.emplace(
+                [this](const std::string& service) {
+                    _srvLookups.fetchAndAdd(1);
+                    uassertStatusOK(_srvStatus);
+                    return _srvResult;
+                },
+                [this](const std::string& service) {
+                    _txtLookups.fetchAndAdd(1);
+                    return _txtResult;
+                },
+                &_clockSource,
+                _options);
+        }
+        return *_cache;
+    }
+
+    DNSResolverCache::Options _options;
+    ClockSourceMock _clockSource;
+
+    SRVLookupResult _srvResult{{{"a.example.com.", 27017}}, Seconds(60)};
+    Status _srvStatus = Status::OK();
+    AtomicWord<int> _srvLookups{0};
+
+    TXTLookupResult _txtResult{{"replicaSet=rs0"}, Seconds(60)};
+    AtomicWord<int> _txtLookups{0};
+
+private:
+    boost::optional<DNSResolverCache> _cache;
+};
+
+TEST_F(DNSResolverCacheTest, ServesCachedRecordsWithoutReResolving) {
+    ASSERT(cache().lookupSRVRecords(kService) == _srvResult.records);
+    ASSERT(cache().lookupSRVRecords(kService) == _srvResult.records);
+    ASSERT_EQ(1, _srvLookups.load());
+
+    ASSERT(cache().getTXTRecords(kService) == _txtResult.records);
+    ASSERT(cache().getTXTRecords(kService) == _txtResult.records);
+    ASSERT_EQ(1, _txtLookups.load());
+}
+
+TEST_F(DNSResolverCacheTest, ExpiredEntryIsReResolved) {
+    ASSERT(cache().lookupSRVRecords(kService) == _srvResult.records);
+
+    _clockSource.advance(Seconds(61));
+    _srvResult.records = {{"b.example.com.", 27017}};
+    ASSERT(cache().lookupSRVRecords(kService) == _srvResult.records);
+    ASSERT_EQ(2, _srvLookups.load());
+}
+
+TEST_F(DNSResolverCacheTest, ZeroTTLIsClampedToMinimum) {
+    _txtResult.ttl = Seconds(0);
+    ASSERT(cache().getTXTRecords(kService) == _txtResult.records);
+
+    // Still cached inside the minimum TTL window, re-resolved after it.
+    _clockSource.advance(Seconds(9));
+    ASSERT(cache().getTXTRecords(kService) == _txtResult.records);
+    ASSERT_EQ(1, _txtLookups.load());
+
+    _clockSource.advance(Seconds(2));
+    ASSERT(cache().getTXTRecords(kService) == _txtResult.records);
+    ASSERT_EQ(2, _txtLookups.load());
+}
+
+TEST_F(DNSResolverCacheTest, HostNotFoundIsCachedNegatively) {
+    _srvStatus = Status(ErrorCodes::DNSHostNotFound, "no such host");
+    ASSERT_THROWS_CODE(
+        cache().lookupSRVRecords(kService), DBException, ErrorCodes::DNSHostNotFound);
+    ASSERT_THROWS_CODE(
+        cache().lookupSRVRecords(kService), DBException, ErrorCodes::DNSHostNotFound);
+    ASSERT_EQ(1, _srvLookups.load());
+
+    // A negative entry expires after the negative-cache TTL and the name is retried.
+    _clockSource.advance(Seconds(6));
+    _srvStatus = Status::OK();
+    ASSERT(cache().lookupSRVRecords(kService) == _srvResult.records);
+    ASSERT_EQ(2, _srvLookups.load());
+}
+
+TEST_F(DNSResolverCacheTest, OtherResolverErrorsAreNotCached) {
+    _srvStatus = Status(ErrorCodes::DNSProtocolError, "resolver failure");
+    ASSERT_THROWS_CODE(
+        cache().lookupSRVRecords(kService), DBException, ErrorCodes::DNSProtocolError);
+
+    _srvStatus = Status::OK();
+    ASSERT(cache().lookupSRVRecords(kService) == _srvResult.records);
+    ASSERT_EQ(2, _srvLookups.load());
+}
+
+TEST_F(DNSResolverCacheTest, EntryPastHalfLifeIsRefreshedInBackground) {
+    ASSERT(cache().lookupSRVRecords(kService) == _srvResult.records);
+
+    // Past the entry's half-life, the stale records are still served but a background refresh is
+    // scheduled.
+    _clockSource.advance(Seconds(31));
+    const auto staleRecords = _srvResult.records;
+    _srvResult.records = {{"b.example.com.", 27017}};
+    ASSERT(cache().lookupSRVRecords(kService) == staleRecords);
+
+    // Wait for the refresh thread to install the new records.
+    const auto deadline = Date_t::now() + Seconds(30);
+    while (_srvLookups.load() < 2 && Date_t::now() < deadline) {
+        sleepmillis(10);
+    }
+    ASSERT_EQ(2, _srvLookups.load());
+
+    while (cache().lookupSRVRecords(kService) != _srvResult.records &&
+           Date_t::now() < deadline) {
+        sleepmillis(10);
+    }
+    ASSERT(cache().lookupSRVRecords(kService) == _srvResult.records);
+    ASSERT_EQ(2, _srvLookups.load());
+}
+
+}  // namespace
+}  // namespace dns
+}  // namespace mongo
@@ -32,6 +32,7 @@
 
 #include "mongo/util/dns_query.h"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
@@ -95,21 +96,23 @@ std::vector<std::string> dns::lookupARecords(const std::string& service) {
     return rv;
 }
 
-std::vector<dns::SRVHostEntry> dns::lookupSRVRecords(const std::string& service) {
+dns::SRVLookupResult dns::lookupSRVRecordsWithTTL(const std::string& service) {
     DNSQueryState dnsQuery;
 
     auto response = dnsQuery.lookup(service, DNSQueryClass::kInternet, DNSQueryType::kSRV);
 
-    std::vector<SRVHostEntry> rv;
+    SRVLookupResult rv;
+    rv.ttl = Seconds::max();
 
     for (const auto& entry : response) {
         try {
-            rv.push_back(entry.srvHostEntry());
+            rv.records.push_back(entry.srvHostEntry());
+            rv.ttl = std::min(rv.ttl, entry.ttl());
         } catch (const ExceptionFor<ErrorCodes::DNSRecordTypeMismatch>&) {
         }
     }
 
-    if (rv.empty()) {
+    if (rv.records.empty()) {
         StringBuilder oss;
         oss << "Looking up " << service << " SRV record yielded ";
         if (response.size() == 0) {
@@ -123,26 +126,46 @@ std::vector<dns::SRVHostEntry> dns::lookupSRVRecords(const std::string& service)
     return rv;
 }
 
-std::vector<std::string> dns::lookupTXTRecords(const std::string& service) {
+std::vector<dns::SRVHostEntry> dns::lookupSRVRecords(const std::string& service) {
+    return lookupSRVRecordsWithTTL(service).records;
+}
+
+dns::TXTLookupResult dns::lookupTXTRecordsWithTTL(const std::string& service) {
     DNSQueryState dnsQuery;
 
     auto response = dnsQuery.lookup(service, DNSQueryClass::kInternet, DNSQueryType::kTXT);
 
-    std::vector<std::string> rv;
+    TXTLookupResult rv;
+    rv.ttl = Seconds::max();
 
     for (auto& entry : response) {
         try {
             auto txtEntry = entry.txtEntry();
-            rv.insert(end(rv),
-                      std::make_move_iterator(begin(txtEntry)),
-                      std::make_move_iterator(end(txtEntry)));
+            rv.ttl = std::min(rv.ttl, entry.ttl());
+            rv.records.insert(end(rv.records),
+                              std::make_move_iterator(begin(txtEntry)),
+                              std::make_move_iterator(end(txtEntry)));
         } catch (const ExceptionFor<ErrorCodes::DNSRecordTypeMismatch>&) {
         }
     }
 
+    if (rv.records.empty()) {
+        rv.ttl = Seconds(0);
+    }
+
     return rv;
 }
 
+std::vector<std::string> dns::lookupTXTRecords(const std::string& service) {
+    return lookupTXTRecordsWithTTL(service).records;
+}
+
+dns::TXTLookupResult dns::getTXTRecordsWithTTL(const std::string& service) try {
+    return lookupTXTRecordsWithTTL(service);
+} catch (const ExceptionFor<ErrorCodes::DNSHostNotFound>&) {
+    return {{}, Seconds(0)};
+}
+
 std::vector<std::string> dns::getTXTRecords(const std::string& service) try {
     return lookupTXTRecords(service);
 } catch (const ExceptionFor<ErrorCodes::DNSHostNotFound>&) {
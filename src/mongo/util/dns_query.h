@@ -42,6 +42,7 @@
 #include <boost/noncopyable.hpp>
 
 #include "mongo/util/assert_util.h"
+#include "mongo/util/duration.h"
 
 namespace mongo {
 namespace dns {
@@ -111,5 +112,41 @@ std::vector<std::string> getTXTRecords(const std::string& service);
  * NOTE: This function mostly exists to provide an easy test of the OS DNS APIs in our test driver.
  */
 std::vector<std::string> lookupARecords(const std::string& service);
+
+/**
+ * The result of a raw SRV lookup: the matching records together with the smallest time-to-live
+ * observed among them. Caching layers (see `dns_cache.h`) use the TTL to bound how long the
+ * records may be served without consulting the resolver again.
+ */
+struct SRVLookupResult {
+    std::vector<SRVHostEntry> records;
+    Seconds ttl;
+};
+
+/**
+ * The result of a raw TXT lookup, together with the smallest time-to-live observed among the
+ * returned records.
+ */
+struct TXTLookupResult {
+    std::vector<std::string> records;
+    Seconds ttl;
+};
+
+/**
+ * As `lookupSRVRecords`, but also reports the smallest TTL among the returned records.
+ */
+SRVLookupResult lookupSRVRecordsWithTTL(const std::string& service);
+
+/**
+ * As `lookupTXTRecords`, but also reports the smallest TTL among the returned records. A lookup
+ * which found no records reports a TTL of zero.
+ */
+TXTLookupResult lookupTXTRecordsWithTTL(const std::string& service);
+
+/**
+ * As `getTXTRecords`, but also reports the smallest TTL among the returned records. A lookup
+ * which found no records reports a TTL of zero.
+ */
+TXTLookupResult getTXTRecordsWithTTL(const std::string& service);
 }  // namespace dns
 }  // namespace mongo
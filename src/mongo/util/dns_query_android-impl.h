@@ -65,6 +65,10 @@ public:
     SRVHostEntry srvHostEntry() const {
         throwNotSupported();
     }
+
+    Seconds ttl() const {
+        throwNotSupported();
+    }
 };
 
 using DNSResponse = std::vector<ResourceRecord>;
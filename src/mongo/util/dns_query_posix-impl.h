@@ -175,6 +175,13 @@ public:
         return {name, port};
     }
 
+    /**
+     * Returns the time-to-live reported for this record.
+     */
+    Seconds ttl() const {
+        return Seconds(ns_rr_ttl(this->_resource_record));
+    }
+
 private:
     void _badRecord() const {
         std::ostringstream oss;
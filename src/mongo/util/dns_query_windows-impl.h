@@ -136,6 +136,13 @@ public:
         return {data.pNameTarget + "."s, data.wPort};
     }
 
+    /**
+     * Returns the time-to-live reported for this record.
+     */
+    Seconds ttl() const {
+        return Seconds(this->_record->dwTtl);
+    }
+
 private:
     std::string _service;
     std::shared_ptr<DNS_RECORDA> _record;
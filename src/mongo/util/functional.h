@@ -30,7 +30,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
+#include <new>
 #include <type_traits>
 
 #include "mongo/stdx/type_traits.h"
@@ -46,6 +48,10 @@ class unique_function;
  * it is incapable of being copied.  Often this happens with C++14 or later lambdas which capture a
  * `std::unique_ptr` by move.  The interface of `unique_function` is nearly identical to
  * `std::function`, except that it is not copyable.
+ *
+ * Small functors that are nothrow move constructible are stored inline rather than on the heap, so
+ * wrapping them (and moving the wrapper) never allocates. Larger or potentially-throwing functors
+ * fall back to heap storage, keeping the move operations noexcept in all cases.
  */
 template <typename RetType, typename... Args>
 class unique_function<RetType(Args...)> {
@@ -66,18 +72,31 @@ private:
 public:
     using result_type = RetType;
 
-    ~unique_function() noexcept = default;
+    ~unique_function() noexcept {
+        reset();
+    }
+
     unique_function() = default;
 
     unique_function(const unique_function&) = delete;
     unique_function& operator=(const unique_function&) = delete;
 
-    unique_function(unique_function&&) noexcept = default;
-    unique_function& operator=(unique_function&&) noexcept = default;
+    unique_function(unique_function&& that) noexcept {
+        moveFrom(std::move(that));
+    }
+
+    unique_function& operator=(unique_function&& that) noexcept {
+        if (this != &that) {
+            reset();
+            moveFrom(std::move(that));
+        }
+        return *this;
+    }
 
     void swap(unique_function& that) noexcept {
-        using std::swap;
-        swap(this->impl, that.impl);
+        unique_function temp(std::move(that));
+        that = std::move(*this);
+        *this = std::move(temp);
     }
 
     friend void swap(unique_function& a, unique_function& b) noexcept {
@@ -99,8 +118,9 @@ public:
         std::enable_if_t<stdx::is_invocable_r<RetType, Functor, Args...>::value, TagType> =
             makeTag(),
         std::enable_if_t<std::is_move_constructible<Functor>::value, TagType> = makeTag(),
-        std::enable_if_t<!std::is_same<Functor, unique_function>::value, TagType> = makeTag())
-        : impl(makeImpl(std::forward<Functor>(functor))) {}
+        std::enable_if_t<!std::is_same<Functor, unique_function>::value, TagType> = makeTag()) {
+        makeImpl(std::forward<Functor>(functor));
+    }
 
     unique_function(std::nullptr_t) noexcept {}
 
@@ -110,7 +130,7 @@ public:
     }
 
     explicit operator bool() const noexcept {
-        return static_cast<bool>(this->impl);
+        return impl != nullptr;
     }
 
     // Needed to make `std::is_convertible<mongo::unique_function<...>, std::function<...>>` be
@@ -135,6 +155,11 @@ private:
     struct Impl {
         virtual ~Impl() noexcept = default;
         virtual RetType call(Args&&... args) = 0;
+
+        // Move-constructs a copy of this impl into the inline buffer at `dest` and returns a
+        // pointer to it. Only ever invoked on inline impls, which are guaranteed to be nothrow
+        // move constructible.
+        virtual Impl* moveTo(void* dest) noexcept = 0;
     };
 
     // These overload helpers are needed to squelch problems in the `T ()` -> `void ()` case.
@@ -151,7 +176,7 @@ private:
     }
 
     template <typename Functor>
-    static auto makeImpl(Functor&& functor) {
+    void makeImpl(Functor&& functor) {
         struct SpecificImpl : Impl {
             explicit SpecificImpl(Functor&& func) : f(std::forward<Functor>(func)) {}
 
@@ -159,13 +184,57 @@ private:
                 return callRegularVoid(std::is_void<RetType>(), f, std::forward<Args>(args)...);
             }
 
+            Impl* moveTo(void* dest) noexcept override {
+                return new (dest) SpecificImpl(std::move(f));
+            }
+
             std::decay_t<Functor> f;
         };
 
-        return std::make_unique<SpecificImpl>(std::forward<Functor>(functor));
+        constexpr bool kFitsInline = sizeof(SpecificImpl) <= sizeof(buffer) &&
+            alignof(SpecificImpl) <= alignof(decltype(buffer)) &&
+            std::is_nothrow_move_constructible<std::decay_t<Functor>>::value;
+        if (kFitsInline) {
+            impl = new (&buffer) SpecificImpl(std::forward<Functor>(functor));
+        } else {
+            impl = new SpecificImpl(std::forward<Functor>(functor));
+        }
+    }
+
+    bool isInline() const noexcept {
+        return static_cast<const void*>(impl) == static_cast<const void*>(&buffer);
+    }
+
+    void reset() noexcept {
+        if (!impl)
+            return;
+        if (isInline()) {
+            impl->~Impl();
+        } else {
+            delete impl;
+        }
+        impl = nullptr;
+    }
+
+    void moveFrom(unique_function&& that) noexcept {
+        if (!that.impl)
+            return;
+        if (that.isInline()) {
+            impl = that.impl->moveTo(&buffer);
+            that.reset();
+        } else {
+            impl = that.impl;
+            that.impl = nullptr;
+        }
     }
 
-    std::unique_ptr<Impl> impl;
+    // Inline storage for small functors, sized to cover the vtable pointer plus a few words of
+    // captures. Bigger functors are allocated on the heap.
+    static constexpr std::size_t kInlineStorageSize = 4 * sizeof(void*);
+    std::aligned_storage_t<kInlineStorageSize, alignof(std::max_align_t)> buffer;
+
+    // Points into `buffer` for inline impls and at a heap allocation otherwise.
+    Impl* impl = nullptr;
 };
 
 template <typename Signature>
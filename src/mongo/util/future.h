@@ -714,8 +714,8 @@ public:
 
     static Future<T> makeReady(Status status) {
         invariant(!status.isOK());
-        auto out = Future<T>(make_intrusive<SharedState<T>>());
-        out._shared->setError(std::move(status));
+        Future out;
+        out._immediateStatus = std::move(status);
         return out;
     }
 
@@ -744,7 +744,8 @@ public:
      * timeouts, that is unnecessary if the Future is ready already.
      */
     bool isReady() const {
-        return _immediate || _shared->state.load(std::memory_order_acquire) == SSBState::kFinished;
+        return _immediate || _immediateStatus ||
+            _shared->state.load(std::memory_order_acquire) == SSBState::kFinished;
     }
 
     /**
@@ -753,7 +754,7 @@ public:
      * Throws if the interruptible passed is interrupted (explicitly or via deadline).
      */
     void wait(Interruptible* interruptible = Interruptible::notInterruptible()) const {
-        if (_immediate) {
+        if (_immediate || _immediateStatus) {
             return;
         }
 
@@ -767,7 +768,7 @@ public:
      */
     Status waitNoThrow(Interruptible* interruptible = Interruptible::notInterruptible()) const
         noexcept {
-        if (_immediate) {
+        if (_immediate || _immediateStatus) {
             return Status::OK();
         }
 
@@ -805,6 +806,9 @@ public:
         if (_immediate) {
             return std::move(*_immediate);
         }
+        if (_immediateStatus) {
+            return std::move(*_immediateStatus);
+        }
 
         try {
             _shared->wait(interruptible);
@@ -821,6 +825,9 @@ public:
         if (_immediate) {
             return *_immediate;
         }
+        if (_immediateStatus) {
+            return *_immediateStatus;
+        }
 
         try {
             _shared->wait(interruptible);
@@ -1135,8 +1142,11 @@ public:
                 (std::is_same<T, FakeVoid>::value && std::is_same<Result, Future<void>>::value),
             "func passed to Future<T>::onError must return T, StatusWith<T>, or Future<T>");
 
-        if (_immediate || (isReady() && _shared->status.isOK()))
-            return std::move(*this);  // Avoid copy/moving func if we know we won't call it.
+        // Avoid copy/moving func if we know we won't call it.
+        if (_immediate ||
+            (_immediateStatus ? *_immediateStatus != code
+                              : isReady() && _shared->status.isOK()))
+            return std::move(*this);
 
         // TODO in C++17 with constexpr if this can be done cleaner and more efficiently by not
         // throwing.
@@ -1238,6 +1248,10 @@ private:
         if (_immediate) {
             return *_immediate;
         }
+        if (_immediateStatus) {
+            uassertStatusOK(*_immediateStatus);
+            MONGO_UNREACHABLE;
+        }
 
         _shared->wait(interruptible);
         uassertStatusOK(_shared->status);
@@ -1251,6 +1265,9 @@ private:
         if (_immediate) {
             return success(std::move(*_immediate));
         }
+        if (_immediateStatus) {
+            return fail(std::move(*_immediateStatus));
+        }
 
         auto oldState = _shared->state.load(std::memory_order_acquire);
         dassert(oldState != SSBState::kHaveContinuation);
@@ -1355,8 +1372,12 @@ private:
 
     explicit Future(boost::intrusive_ptr<SharedState<T>> ptr) : _shared(std::move(ptr)) {}
 
-    // At most one of these will be active.
+    // At most one of these will be active. The _immediate and _immediateStatus members hold ready
+    // results inline so that makeReady() and error propagation through already-ready continuation
+    // chains never allocate a SharedState; _shared is only needed when the result may be produced
+    // asynchronously.
     boost::optional<T> _immediate;
+    boost::optional<Status> _immediateStatus;
     boost::intrusive_ptr<SharedState<T>> _shared;
 };
 
@@ -1772,11 +1793,15 @@ template <typename T>
 
 template <typename T>
     inline SharedSemiFuture<T> Future<T>::share() && noexcept {
-    if (!_immediate)
+    if (!_immediate && !_immediateStatus)
         return SharedSemiFuture<T>(std::move(_shared));
 
     auto shared = make_intrusive<SharedState<T>>();
-    shared->emplaceValue(std::move(*_immediate));
+    if (_immediate) {
+        shared->emplaceValue(std::move(*_immediate));
+    } else {
+        shared->setError(std::move(*_immediateStatus));
+    }
     return SharedSemiFuture<T>(std::move(shared));
 }
 
@@ -65,6 +65,31 @@ void BM_futureIntReadyThen(benchmark::State& state) {
     }
 }
 
+NOINLINE_DECL Future<int> makeErrorFut() {
+    benchmark::ClobberMemory();
+    static const Status kError(ErrorCodes::BadValue, "benchmark error");
+    return Future<int>::makeReady(kError);
+}
+
+void BM_futureIntError(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(makeErrorFut().getNoThrow().getStatus().code());
+    }
+}
+
+void BM_futureIntErrorThen(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            makeErrorFut().then([](int i) { return i + 1; }).getNoThrow().getStatus().code());
+    }
+}
+
+void BM_futureIntErrorOnError(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(makeErrorFut().onError([](Status) { return 1; }).get() + 1);
+    }
+}
+
 NOINLINE_DECL Future<int> makeReadyFutWithPromise() {
     benchmark::ClobberMemory();
     auto pf = makePromiseFuture<int>();
@@ -204,6 +229,9 @@ void BM_futureInt4xDeferredThenChained(benchmark::State& state) {
 BENCHMARK(BM_plainIntReady);
 BENCHMARK(BM_futureIntReady);
 BENCHMARK(BM_futureIntReadyThen);
+BENCHMARK(BM_futureIntError);
+BENCHMARK(BM_futureIntErrorThen);
+BENCHMARK(BM_futureIntErrorOnError);
 BENCHMARK(BM_futureIntReadyWithPromise);
 BENCHMARK(BM_futureIntReadyWithPromiseThen);
 BENCHMARK(BM_futureIntDeferredThen);
@@ -0,0 +1,196 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/numa.h"
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "mongo/util/errno_util.h"
+#include "mongo/util/mongoutils/str.h"
+
+namespace mongo {
+
+#ifdef __linux__
+
+namespace {
+
+// From <linux/mempolicy.h>; spelled out here to avoid requiring libnuma or kernel headers.
+constexpr int kMpolInterleave = 3;
+
+// Parses sysfs list format ("0-7,16-23") and calls 'callback' with each member.
+template <typename Callback>
+bool parseSysfsList(const std::string& list, Callback callback) {
+    std::istringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        unsigned first, last;
+        const auto dash = range.find('-');
+        if (dash == std::string::npos) {
+            if (std::istringstream(range) >> first) {
+                last = first;
+            } else {
+                return false;
+            }
+        } else if (!(std::istringstream(range.substr(0, dash)) >> first) ||
+                   !(std::istringstream(range.substr(dash + 1)) >> last) || last < first) {
+            return false;
+        }
+        for (unsigned i = first; i <= last; i++) {
+            callback(i);
+        }
+    }
+    return true;
+}
+
+bool readFirstLine(const std::string& path, std::string* out) {
+    std::ifstream file(path);
+    return bool(std::getline(file, *out));
+}
+
+}  // namespace
+
+unsigned numaNodeCount() {
+    std::string possible;
+    if (!readFirstLine("/sys/devices/system/node/possible", &possible)) {
+        return 1;
+    }
+    unsigned highest = 0;
+    if (!parseSysfsList(possible, [&](unsigned node) { highest = std::max(highest, node); })) {
+        return 1;
+    }
+    return highest + 1;
+}
+
+Status setMemoryInterleavePolicy() {
+    const unsigned nodes = numaNodeCount();
+    std::vector<unsigned long> mask((nodes + 8 * sizeof(unsigned long) - 1) /
+                                    (8 * sizeof(unsigned long)));
+    for (unsigned node = 0; node < nodes; node++) {
+        mask[node / (8 * sizeof(unsigned long))] |= 1UL << (node % (8 * sizeof(unsigned long)));
+    }
+    if (syscall(SYS_set_mempolicy, kMpolInterleave, mask.data(), nodes + 1) != 0) {
+        return {ErrorCodes::OperationFailed,
+                str::stream() << "set_mempolicy failed: " << errnoWithDescription()};
+    }
+    return Status::OK();
+}
+
+Status bindThreadToNumaNode(unsigned node) {
+    std::string cpulist;
+    const std::string path = str::stream() << "/sys/devices/system/node/node" << node
+                                           << "/cpulist";
+    if (!readFirstLine(path, &cpulist)) {
+        return {ErrorCodes::OperationFailed,
+                str::stream() << "Could not read CPU list for NUMA node " << node};
+    }
+
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    if (!parseSysfsList(cpulist, [&](unsigned cpu) {
+            if (cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, &cpus);
+            }
+        }) ||
+        CPU_COUNT(&cpus) == 0) {
+        return {ErrorCodes::OperationFailed,
+                str::stream() << "Could not parse CPU list for NUMA node " << node << ": '"
+                              << cpulist
+                              << "'"};
+    }
+
+    if (sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+        return {ErrorCodes::OperationFailed,
+                str::stream() << "sched_setaffinity failed: " << errnoWithDescription()};
+    }
+    return Status::OK();
+}
+
+std::vector<NumaNodeStats> getNumaNodeStats() {
+    std::vector<NumaNodeStats> stats;
+    const unsigned nodes = numaNodeCount();
+    for (unsigned node = 0; node < nodes; node++) {
+        std::ifstream file(str::stream() << "/sys/devices/system/node/node" << node
+                                         << "/numastat");
+        if (!file) {
+            continue;
+        }
+        NumaNodeStats entry = {};
+        entry.node = node;
+        std::string name;
+        long long value;
+        while (file >> name >> value) {
+            if (name == "numa_hit") {
+                entry.numaHit = value;
+            } else if (name == "numa_miss") {
+                entry.numaMiss = value;
+            } else if (name == "numa_foreign") {
+                entry.numaForeign = value;
+            } else if (name == "local_node") {
+                entry.localNode = value;
+            } else if (name == "other_node") {
+                entry.otherNode = value;
+            }
+        }
+        stats.push_back(entry);
+    }
+    return stats;
+}
+
+#else  // __linux__
+
+unsigned numaNodeCount() {
+    return 1;
+}
+
+Status setMemoryInterleavePolicy() {
+    return {ErrorCodes::InvalidOptions, "NUMA memory policies are not supported on this platform"};
+}
+
+Status bindThreadToNumaNode(unsigned node) {
+    return {ErrorCodes::InvalidOptions, "NUMA thread binding is not supported on this platform"};
+}
+
+std::vector<NumaNodeStats> getNumaNodeStats() {
+    return {};
+}
+
+#endif  // __linux__
+
+}  // namespace mongo
@@ -0,0 +1,82 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "mongo/base/status.h"
+
+namespace mongo {
+
+/**
+ * Helpers for inspecting and controlling NUMA placement on multi-socket machines. On Linux they
+ * are implemented over sysfs and raw syscalls so no libnuma dependency is needed; on other
+ * platforms the machine is reported as a single node and the policy calls fail with
+ * InvalidOptions.
+ */
+
+/**
+ * Returns the number of NUMA nodes the machine may have, or 1 when the topology can not be
+ * determined.
+ */
+unsigned numaNodeCount();
+
+/**
+ * Sets this process's default memory policy to interleave page allocations round-robin across
+ * all nodes, like running under "numactl --interleave=all". Only affects pages first touched
+ * after the call, so this should run before large caches are allocated.
+ */
+Status setMemoryInterleavePolicy();
+
+/**
+ * Pins the calling thread to the CPUs of the given node, so its allocations and accesses stay
+ * node-local under the default first-touch policy.
+ */
+Status bindThreadToNumaNode(unsigned node);
+
+/**
+ * Per-node placement counters from the kernel, in pages. 'numaMiss' and 'otherNode' growing on
+ * a loaded machine means memory is being satisfied from remote nodes.
+ */
+struct NumaNodeStats {
+    unsigned node;
+    long long numaHit;
+    long long numaMiss;
+    long long numaForeign;
+    long long localNode;
+    long long otherNode;
+};
+
+/**
+ * Returns one entry per node, or an empty vector when the counters are unavailable.
+ */
+std::vector<NumaNodeStats> getNumaNodeStats();
+
+}  // namespace mongo
@@ -0,0 +1,92 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kControl
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/base/init.h"
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/server_parameters.h"
+#include "mongo/util/log.h"
+#include "mongo/util/numa.h"
+
+namespace mongo {
+namespace {
+
+// When true, the process default memory policy is switched to interleave pages across all NUMA
+// nodes before the storage engine starts, so large shared caches don't land entirely on the
+// node that first touched them. Equivalent to starting under "numactl --interleave=all".
+MONGO_EXPORT_STARTUP_SERVER_PARAMETER(numaInterleaveMemory, bool, false);
+
+MONGO_INITIALIZER(NumaMemoryPolicy)(InitializerContext*) {
+    if (!numaInterleaveMemory) {
+        return Status::OK();
+    }
+    auto status = setMemoryInterleavePolicy();
+    if (!status.isOK()) {
+        warning() << "failed to enable NUMA memory interleaving: " << status;
+    } else {
+        log() << "interleaving memory allocations across " << numaNodeCount() << " NUMA nodes";
+    }
+    return Status::OK();
+}
+
+class NumaServerStatusSection : public ServerStatusSection {
+public:
+    NumaServerStatusSection() : ServerStatusSection("numa") {}
+
+    bool includeByDefault() const override {
+        // Placement counters are only interesting on multi-node machines.
+        return numaNodeCount() > 1;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        BSONObjBuilder builder;
+        builder.appendNumber("numaNodes", numaNodeCount());
+        builder.appendBool("memoryInterleaved", numaInterleaveMemory);
+
+        BSONObjBuilder nodes(builder.subobjStart("nodes"));
+        for (const auto& stats : getNumaNodeStats()) {
+            BSONObjBuilder node(nodes.subobjStart(std::to_string(stats.node)));
+            node.appendNumber("numaHit", stats.numaHit);
+            node.appendNumber("numaMiss", stats.numaMiss);
+            node.appendNumber("numaForeign", stats.numaForeign);
+            node.appendNumber("localNode", stats.localNode);
+            node.appendNumber("otherNode", stats.otherNode);
+        }
+        nodes.done();
+
+        return builder.obj();
+    }
+} numaServerStatusSection;
+
+}  // namespace
+}  // namespace mongo
@@ -1,4 +1,3 @@
-
 /**
  *    Copyright (C) 2018-present MongoDB, Inc.
  *
@@ -35,12 +34,32 @@
 #include "mongo/db/client.h"
 #include "mongo/db/service_context.h"
 #include "mongo/util/clock_source.h"
-#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 
+namespace {
+
+// Maximum number of threads the shared worker pool may grow to. Periodic jobs are infrequent
+// housekeeping tasks, but some of them can block on one another, so the pool must be able to run
+// several iterations concurrently. Idle workers are reaped, so a quiescent runner holds no
+// threads beyond the scheduler.
+constexpr size_t kMaxWorkerThreads = 4;
+
+ThreadPool::Options makeWorkerPoolOptions(ServiceContext* svc) {
+    ThreadPool::Options options;
+    options.poolName = "PeriodicRunner";
+    options.minThreads = 0;
+    options.maxThreads = kMaxWorkerThreads;
+    options.onCreateThread = [svc](const std::string& threadName) {
+        Client::initThread(threadName, svc, nullptr);
+    };
+    return options;
+}
+
+}  // namespace
+
 PeriodicRunnerImpl::PeriodicRunnerImpl(ServiceContext* svc, ClockSource* clockSource)
-    : _svc(svc), _clockSource(clockSource) {}
+    : _svc(svc), _clockSource(clockSource), _workers(makeWorkerPoolOptions(svc)) {}
 
 PeriodicRunnerImpl::~PeriodicRunnerImpl() {
     PeriodicRunnerImpl::shutdown();
@@ -48,7 +67,7 @@ PeriodicRunnerImpl::~PeriodicRunnerImpl() {
 
 std::shared_ptr<PeriodicRunnerImpl::PeriodicJobImpl> PeriodicRunnerImpl::createAndAddJob(
     PeriodicJob job) {
-    auto impl = std::make_shared<PeriodicJobImpl>(std::move(job), this->_clockSource, this->_svc);
+    auto impl = std::make_shared<PeriodicJobImpl>(std::move(job), this->_clockSource, this);
 
     stdx::lock_guard<stdx::mutex> lk(_mutex);
     _jobs.push_back(impl);
@@ -56,84 +75,135 @@ std::shared_ptr<PeriodicRunnerImpl::PeriodicJobImpl> PeriodicRunnerImpl::createA
 }
 
 std::unique_ptr<PeriodicRunner::PeriodicJobHandle> PeriodicRunnerImpl::makeJob(PeriodicJob job) {
-    auto handle = std::make_unique<PeriodicJobHandleImpl>(createAndAddJob(job));
+    auto handle = std::make_unique<PeriodicJobHandleImpl>(createAndAddJob(std::move(job)));
     return std::move(handle);
 }
 
 void PeriodicRunnerImpl::scheduleJob(PeriodicJob job) {
-    auto impl = createAndAddJob(job);
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-    if (_running) {
+    auto impl = createAndAddJob(std::move(job));
+    bool running;
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        running = _running;
+    }
+    if (running) {
         impl->start();
     }
 }
 
 void PeriodicRunnerImpl::startup() {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    decltype(_jobs) jobs;
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
 
-    if (_running) {
-        return;
-    }
+        if (_running) {
+            return;
+        }
 
-    _running = true;
+        _running = true;
+        _workers.startup();
+        _scheduler = stdx::thread([this] { _schedulerThread(); });
+        jobs = _jobs;
+    }
 
-    // schedule any jobs that we have
-    for (auto& job : _jobs) {
+    // Schedule any jobs that we have. start() wakes the scheduler, so the runner's mutex must
+    // not be held here.
+    for (auto& job : jobs) {
         job->start();
     }
 }
 
 void PeriodicRunnerImpl::shutdown() {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-    if (_running) {
+    decltype(_jobs) jobs;
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        if (!_running) {
+            return;
+        }
+
         _running = false;
+        ++_wakeGeneration;
+        jobs.swap(_jobs);
+    }
+    _condvar.notify_one();
+    _scheduler.join();
 
-        for (auto& job : _jobs) {
-            job->stop();
-        }
-        _jobs.clear();
+    // The scheduler is gone, so no further iterations can be dispatched; stop() additionally
+    // waits out any iteration the worker pool is still running.
+    for (auto& job : jobs) {
+        job->stop();
     }
+
+    _workers.shutdown();
+    _workers.join();
 }
 
-PeriodicRunnerImpl::PeriodicJobImpl::PeriodicJobImpl(PeriodicJob job,
-                                                     ClockSource* source,
-                                                     ServiceContext* svc)
-    : _job(std::move(job)), _clockSource(source), _serviceContext(svc) {}
-
-void PeriodicRunnerImpl::PeriodicJobImpl::_run() {
-    _thread = stdx::thread([this] {
-        Client::initThread(_job.name, _serviceContext, nullptr);
-        while (true) {
-            auto start = _clockSource->now();
-
-            stdx::unique_lock<stdx::mutex> lk(_mutex);
-            // Wait until it's unpaused or canceled
-            _condvar.wait(lk, [&] { return _execStatus != ExecutionStatus::PAUSED; });
-            if (_execStatus == ExecutionStatus::CANCELED) {
-                break;
-            }
+void PeriodicRunnerImpl::_wakeScheduler() {
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        ++_wakeGeneration;
+    }
+    _condvar.notify_one();
+}
+
+void PeriodicRunnerImpl::_schedulerThread() {
+    Client::initThread("PeriodicRunnerScheduler", _svc, nullptr);
 
-            // Unlock while job is running so we can pause/cancel concurrently
-            lk.unlock();
-            _job.job(Client::getCurrent());
-            lk.lock();
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    while (_running) {
+        auto now = _clockSource->now();
+        boost::optional<Date_t> nextDeadline;
 
-            if (_clockSource->waitForConditionUntil(_condvar, lk, start + _job.interval, [&] {
-                    return _execStatus == ExecutionStatus::CANCELED;
-                })) {
-                break;
+        // Dispatch every job that has come due to the worker pool, and find the earliest
+        // deadline among the others.
+        for (auto& job : _jobs) {
+            auto next = job->nextScheduledRun();
+            if (!next) {
+                continue;
+            }
+            if (*next <= now) {
+                {
+                    stdx::lock_guard<stdx::mutex> jobLk(job->_mutex);
+                    job->_executing = true;
+                }
+                auto status = _workers.schedule([job] { job->runOnce(Client::getCurrent()); });
+                if (!status.isOK()) {
+                    // The worker pool is shutting down, so the runner is as well.
+                    stdx::lock_guard<stdx::mutex> jobLk(job->_mutex);
+                    job->_executing = false;
+                }
+            } else if (!nextDeadline || *next < *nextDeadline) {
+                nextDeadline = *next;
             }
         }
-    });
+
+        auto gen = _wakeGeneration;
+        auto wakePred = [&] { return !_running || _wakeGeneration != gen; };
+        if (nextDeadline) {
+            _clockSource->waitForConditionUntil(_condvar, lk, *nextDeadline, wakePred);
+        } else {
+            // Nothing is scheduled to run, so sleep until a job is added, started, resumed, or
+            // finishes an iteration.
+            _condvar.wait(lk, wakePred);
+        }
+    }
 }
 
+PeriodicRunnerImpl::PeriodicJobImpl::PeriodicJobImpl(PeriodicJob job,
+                                                     ClockSource* source,
+                                                     PeriodicRunnerImpl* parent)
+    : _job(std::move(job)), _clockSource(source), _parent(parent) {}
+
 void PeriodicRunnerImpl::PeriodicJobImpl::start() {
     {
         stdx::lock_guard<stdx::mutex> lk(_mutex);
         invariant(_execStatus == PeriodicJobImpl::ExecutionStatus::NOT_SCHEDULED);
         _execStatus = PeriodicJobImpl::ExecutionStatus::RUNNING;
+
+        // The first iteration runs immediately.
+        _nextRun = _clockSource->now();
     }
-    _run();
+    _parent->_wakeScheduler();
 }
 
 void PeriodicRunnerImpl::PeriodicJobImpl::pause() {
@@ -147,22 +217,61 @@ void PeriodicRunnerImpl::PeriodicJobImpl::resume() {
         stdx::lock_guard<stdx::mutex> lk(_mutex);
         invariant(_execStatus == PeriodicJobImpl::ExecutionStatus::PAUSED);
         _execStatus = PeriodicJobImpl::ExecutionStatus::RUNNING;
+
+        // Iterations which came due while the job was paused are dropped rather than replayed;
+        // the next iteration happens a full interval after the resume.
+        _nextRun = _clockSource->now() + _job.interval;
     }
-    _condvar.notify_one();
+    _parent->_wakeScheduler();
 }
 
 void PeriodicRunnerImpl::PeriodicJobImpl::stop() {
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    if (_execStatus != ExecutionStatus::RUNNING && _execStatus != ExecutionStatus::PAUSED) {
+        return;
+    }
+
+    _execStatus = PeriodicJobImpl::ExecutionStatus::CANCELED;
+
+    // An iteration dispatched before the cancellation may still be running on a worker thread.
+    // The caller is entitled to assume that the job cannot execute once stop() has returned, so
+    // wait it out.
+    _condvar.wait(lk, [this] { return !_executing; });
+}
+
+boost::optional<Date_t> PeriodicRunnerImpl::PeriodicJobImpl::nextScheduledRun() {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    if (_execStatus != ExecutionStatus::RUNNING || _executing) {
+        return boost::none;
+    }
+    return _nextRun;
+}
+
+void PeriodicRunnerImpl::PeriodicJobImpl::runOnce(Client* client) {
+    bool run = false;
     {
         stdx::lock_guard<stdx::mutex> lk(_mutex);
-        if (_execStatus != ExecutionStatus::RUNNING && _execStatus != ExecutionStatus::PAUSED)
-            return;
+        invariant(_executing);
+        run = (_execStatus == ExecutionStatus::RUNNING);
+    }
 
-        invariant(_thread.joinable());
+    if (run) {
+        // Measure the interval from the start of one iteration to the start of the next, so
+        // that a slow job does not drift its period.
+        auto start = _clockSource->now();
+        _job.job(client);
 
-        _execStatus = PeriodicJobImpl::ExecutionStatus::CANCELED;
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _nextRun = start + _job.interval;
+        _executing = false;
+    } else {
+        // The job was paused or canceled after it was dispatched; drop this iteration.
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _executing = false;
     }
-    _condvar.notify_one();
-    _thread.join();
+
+    _condvar.notify_all();
+    _parent->_wakeScheduler();
 }
 
 namespace {
@@ -33,11 +33,15 @@
 #include <memory>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/mutex.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/util/clock_source.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/periodic_runner.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
@@ -45,8 +49,9 @@ class Client;
 class ServiceContext;
 
 /**
- * An implementation of the PeriodicRunner which uses a thread per job and condvar waits on those
- * threads to independently sleep.
+ * An implementation of the PeriodicRunner which multiplexes all periodic jobs onto a single
+ * scheduler thread and a small shared worker pool, rather than dedicating a thread (with its own
+ * stack and timer wakeups) to every job.
  */
 class PeriodicRunnerImpl : public PeriodicRunner {
 public:
@@ -66,33 +71,64 @@ private:
 
     public:
         friend class PeriodicRunnerImpl;
-        PeriodicJobImpl(PeriodicJob job, ClockSource* source, ServiceContext* svc);
+        PeriodicJobImpl(PeriodicJob job, ClockSource* source, PeriodicRunnerImpl* parent);
 
         void start();
         void pause();
         void resume();
         void stop();
 
+        /**
+         * Returns the time at which this job next wants to run, or boost::none if the job should
+         * not be dispatched right now (it has not been started, is paused, is canceled, or an
+         * iteration of it is already executing on a worker thread).
+         */
+        boost::optional<Date_t> nextScheduledRun();
+
+        /**
+         * Runs one iteration of the job on the calling (worker pool) thread, unless the job was
+         * paused or canceled after it was dispatched. The scheduler must have marked the job as
+         * executing before scheduling this call.
+         */
+        void runOnce(Client* client);
+
         enum class ExecutionStatus { NOT_SCHEDULED, RUNNING, PAUSED, CANCELED };
 
     private:
-        void _run();
-
         PeriodicJob _job;
         ClockSource* _clockSource;
-        ServiceContext* _serviceContext;
-        stdx::thread _thread;
+        PeriodicRunnerImpl* _parent;
 
         stdx::mutex _mutex;
         stdx::condition_variable _condvar;
+
         /**
          * The current execution status of the job.
          */
         ExecutionStatus _execStatus{ExecutionStatus::NOT_SCHEDULED};
+
+        // The next time an iteration of this job should be dispatched.
+        Date_t _nextRun;
+
+        // True from the moment the scheduler dispatches the job to the worker pool until the
+        // iteration has finished running.
+        bool _executing = false;
     };
 
     std::shared_ptr<PeriodicRunnerImpl::PeriodicJobImpl> createAndAddJob(PeriodicJob job);
 
+    /**
+     * Body of the scheduler thread: dispatches due jobs to the worker pool and sleeps until the
+     * earliest next run time.
+     */
+    void _schedulerThread();
+
+    /**
+     * Wakes the scheduler thread so that it recomputes its next deadline. Must not be called with
+     * a job's mutex held, since the scheduler takes job mutexes while holding the runner's.
+     */
+    void _wakeScheduler();
+
     class PeriodicJobHandleImpl : public PeriodicJobHandle {
     public:
         explicit PeriodicJobHandleImpl(std::weak_ptr<PeriodicJobImpl> jobImpl)
@@ -109,9 +145,20 @@ private:
     ServiceContext* _svc;
     ClockSource* _clockSource;
 
+    // Executes job iterations. Shared by all jobs, and sized so that the handful of housekeeping
+    // jobs which can block on one another still make progress.
+    ThreadPool _workers;
+
     std::vector<std::shared_ptr<PeriodicJobImpl>> _jobs;
 
     stdx::mutex _mutex;
+    stdx::condition_variable _condvar;
+
+    // Incremented whenever the scheduler thread must recompute its next deadline because a job
+    // was added, started, resumed, or finished an iteration.
+    long long _wakeGeneration = 0;
+
+    stdx::thread _scheduler;
     bool _running = false;
 };
 
@@ -0,0 +1,97 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/with_alignment.h"
+
+namespace mongo {
+
+/**
+ * A long long counter sharded across several cache lines.
+ *
+ * Every thread is assigned a shard and only ever increments that shard, so concurrent writers
+ * on different cores do not all contend on a single cache line the way they do with a lone
+ * AtomicWord. Reads sum over every shard and are correspondingly more expensive. Memory use is
+ * one cache line per shard, so reserve this type for process-wide counters that are hit on
+ * every operation but only read for serverStatus-style reporting.
+ *
+ * get() is not an atomic snapshot with respect to concurrent increments; it has the same
+ * semantics as a relaxed load of a single counter.
+ */
+class ShardedCounter {
+public:
+    // With per-thread shard assignment, contention on a shard only appears once there are more
+    // active threads than shards. Higher values reduce contention on many-core machines at the
+    // price of one cache line of memory per shard per counter.
+    static const size_t kNumShards = 32;
+
+    /**
+     * Adds 'n' to this thread's shard and returns the resulting value of that shard (not of
+     * the whole counter). The shard value bounds the counter's contribution per shard, which
+     * lets callers implement cheap overflow checks without summing every shard.
+     */
+    long long increment(long long n = 1) {
+        return _shards[_currentShard()].fetchAndAddRelaxed(n) + n;
+    }
+
+    /**
+     * Returns the sum over all shards.
+     */
+    long long get() const {
+        long long total = 0;
+        for (size_t i = 0; i < kNumShards; i++) {
+            total += _shards[i].loadRelaxed();
+        }
+        return total;
+    }
+
+    /**
+     * Sets the counter back to zero. Increments racing with the reset may survive it.
+     */
+    void reset() {
+        for (size_t i = 0; i < kNumShards; i++) {
+            _shards[i].store(0);
+        }
+    }
+
+private:
+    static size_t _currentShard() {
+        static AtomicWord<unsigned> nextShard;
+        thread_local const size_t ourShard = nextShard.fetchAndAdd(1) % kNumShards;
+        return ourShard;
+    }
+
+    CacheAligned<AtomicWord<long long>> _shards[kNumShards];
+};
+
+}  // namespace mongo
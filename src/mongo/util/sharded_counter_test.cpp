@@ -0,0 +1,88 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <vector>
+
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/sharded_counter.h"
+
+namespace mongo {
+namespace {
+
+TEST(ShardedCounter, StartsAtZero) {
+    ShardedCounter counter;
+    ASSERT_EQUALS(0LL, counter.get());
+}
+
+TEST(ShardedCounter, IncrementsAreSummedAcrossShards) {
+    ShardedCounter counter;
+
+    counter.increment();
+    counter.increment(41);
+    ASSERT_EQUALS(42LL, counter.get());
+
+    counter.increment(-2);
+    ASSERT_EQUALS(40LL, counter.get());
+}
+
+TEST(ShardedCounter, ResetReturnsToZero) {
+    ShardedCounter counter;
+
+    counter.increment(100);
+    counter.reset();
+    ASSERT_EQUALS(0LL, counter.get());
+}
+
+TEST(ShardedCounter, ConcurrentIncrementsAreNotLost) {
+    const size_t nThreads = 8;
+    const long long incrementsPerThread = 10000;
+
+    ShardedCounter counter;
+
+    std::vector<stdx::thread> threads;
+    for (size_t i = 0; i < nThreads; i++) {
+        threads.emplace_back([&] {
+            for (long long n = 0; n < incrementsPerThread; n++) {
+                counter.increment();
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQUALS(static_cast<long long>(nThreads) * incrementsPerThread, counter.get());
+}
+
+}  // namespace
+}  // namespace mongo
@@ -165,6 +165,8 @@ public:
             appendNumericPropertyIfAvailable(
                 sub, "aggressive_memory_decommit", "tcmalloc.aggressive_memory_decommit");
 
+            sub.append("release_rate", MallocExtension::instance()->GetMemoryReleaseRate());
+
             appendNumericPropertyIfAvailable(
                 sub, "pageheap_committed_bytes", "tcmalloc.pageheap_committed_bytes");
             appendNumericPropertyIfAvailable(
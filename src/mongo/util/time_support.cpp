@@ -34,6 +34,7 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <string>
 
@@ -150,10 +151,37 @@ void _dateToISOString(Date_t date, bool local, DateStringBuffer* result) {
     invariant(date.isFormattable());
     static const int bufSize = DateStringBuffer::dataCapacity;
     char* const buf = result->data;
+
+    // The log line encoder formats a date for every message, and consecutive messages usually
+    // fall within the same second. Everything in the formatted string except the millisecond
+    // digits depends only on the second, so remember the last result per thread and patch the
+    // milliseconds in place on a hit, skipping the localtime/strftime work entirely.
+    struct CachedSecond {
+        time_t second = -1;
+        bool local = false;
+        int millisPos = 0;
+        int size = 0;
+        char data[DateStringBuffer::dataCapacity];
+    };
+    static thread_local CachedSecond cache;
+
+    const time_t seconds = date.toTimeT();
+    if (seconds == cache.second && local == cache.local) {
+        memcpy(buf, cache.data, cache.size);
+        const int millis = static_cast<int>(date.asInt64() % 1000);
+        char* cur = buf + cache.millisPos + 1;  // Skip over the '.'.
+        cur[0] = '0' + millis / 100;
+        cur[1] = '0' + (millis / 10) % 10;
+        cur[2] = '0' + millis % 10;
+        result->size = cache.size;
+        return;
+    }
+
     struct tm t;
-    time_t_to_Struct(date.toTimeT(), &t, local);
+    time_t_to_Struct(seconds, &t, local);
     int pos = strftime(buf, bufSize, MONGO_ISO_DATE_FMT_NO_TZ, &t);
     dassert(0 < pos);
+    const int millisPos = pos;
     char* cur = buf + pos;
     int bufRemaining = bufSize - pos;
     pos = snprintf(cur, bufRemaining, ".%03d", static_cast<int32_t>(date.asInt64() % 1000));
@@ -194,6 +222,12 @@ void _dateToISOString(Date_t date, bool local, DateStringBuffer* result) {
     }
     result->size = cur - buf;
     dassert(result->size < DateStringBuffer::dataCapacity);
+
+    cache.second = seconds;
+    cache.local = local;
+    cache.millisPos = millisPos;
+    cache.size = result->size;
+    memcpy(cache.data, buf, cache.size);
 }
 
 void _dateToCtimeString(Date_t date, DateStringBuffer* result) {
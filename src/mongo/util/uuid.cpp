@@ -30,25 +30,19 @@
 
 #include "mongo/platform/basic.h"
 
-#include <regex>
-
 #include "mongo/util/uuid.h"
 
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/platform/random.h"
-#include "mongo/stdx/mutex.h"
 #include "mongo/util/hex.h"
 
 namespace mongo {
 
 namespace {
 
-stdx::mutex uuidGenMutex;
-auto uuidGen = SecureRandom::create();
-
-// Regex to match valid version 4 UUIDs with variant bits set
-std::regex uuidRegex("[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{12}",
-                     std::regex::optimize);
+// 4 Octets - 2 Octets - 2 Octets - 2 Octets - 6 Octets
+constexpr size_t kUUIDStringLength = 36;
+constexpr std::array<size_t, 4> kHyphenPositions{8, 13, 18, 23};
 
 }  // namespace
 
@@ -94,7 +88,22 @@ UUID UUID::makeDefaultForChangeStream() {
 }
 
 bool UUID::isUUIDString(const std::string& s) {
-    return std::regex_match(s, uuidRegex);
+    if (s.length() != kUUIDStringLength) {
+        return false;
+    }
+
+    size_t hyphen = 0;
+    for (size_t i = 0; i < kUUIDStringLength; i++) {
+        if (hyphen < kHyphenPositions.size() && i == kHyphenPositions[hyphen]) {
+            if (s[i] != '-') {
+                return false;
+            }
+            hyphen++;
+        } else if (!fromHex(s[i]).isOK()) {
+            return false;
+        }
+    }
+    return true;
 }
 
 bool UUID::isRFC4122v4() const {
@@ -102,15 +111,15 @@ bool UUID::isRFC4122v4() const {
 }
 
 UUID UUID::gen() {
-    int64_t randomWords[2];
+    // Each thread draws from its own generator so concurrent callers never contend on shared
+    // state.
+    thread_local auto uuidGen = SecureRandom::create();
 
-    {
-        stdx::lock_guard<stdx::mutex> lk(uuidGenMutex);
+    int64_t randomWords[2];
 
-        // Generate 128 random bits
-        randomWords[0] = uuidGen->nextInt64();
-        randomWords[1] = uuidGen->nextInt64();
-    }
+    // Generate 128 random bits
+    randomWords[0] = uuidGen->nextInt64();
+    randomWords[1] = uuidGen->nextInt64();
 
     UUIDStorage randomBytes;
     memcpy(&randomBytes, randomWords, sizeof(randomBytes));